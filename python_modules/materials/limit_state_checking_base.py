@@ -39,6 +39,21 @@ class LimitStateControllerBase(object):
         '''Crack control.'''
         lmsg.error('limit state check not implemented.')
 
+    def defineNativeCheck(self,checker,sectionDefinition):
+        '''Defines the check in the native checker (see 
+           postprocess.native_limit_state_checking).
+
+        :param checker: xc.LimitStateChecker object.
+        :param sectionDefinition: container with the section definitions.
+        '''
+        lmsg.error('native limit state check not implemented.')
+
+    def getNativeControlVars(self,checker):
+        '''Returns the control variables for each element section
+           computed by the native checker.'''
+        lmsg.error('native limit state check not implemented.')
+        return None
+
 class TensionedRebarsBasicProperties(object):
     '''Basic properties of tensioned rebars (used in shear checking).
 
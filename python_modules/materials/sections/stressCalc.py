@@ -213,6 +213,7 @@ class StressCalc(object):
       mx= max(abs(sgMax),abs(sgMin))
       if(mx<=1e6):
         self.sgc= self.elasticStressAc()
+        self.sgc0= self.elasticStressAc0()
         self.sgs= self.elasticStressAs()
         self.sgsp= self.elasticStressAsp()
         self.xx= self.xElasticNeutralAxis()
@@ -227,9 +228,9 @@ class StressCalc(object):
           d= self.h-self.r
           xx2= 0.6*d
           sgs2= self.M/(0.8*self.As*d)
-          Ns2= self.getNs()
+          Ns2= self.As*sgs2
           sgc2= -2*self.Ec*Ns2*xx2/(self.b*self.Ec*xx2**2+2*self.Asp*self.Es*xx2-2*self.Asp*self.Es*self.rp)
-          sgsp2= self.sgc*self.Es*(xx2-self.rp)/(self.Ec*xx2)
+          sgsp2= sgc2*self.Es*(xx2-self.rp)/(self.Ec*xx2)
           self.xx= (xx1+xx2)/2.0
           self.sgc= (sgc1+sgc2)/2.0
           self.sgs= (sgs1+sgs2)/2.0
@@ -244,9 +245,9 @@ class StressCalc(object):
           d= self.h-self.r
           xx2= 0.6*d
           sgs2= self.M/(0.8*self.As*d)
-          Ns2= self.getNs()
+          Ns2= self.As*sgs2
           sgc2= -2*self.Ec*Ns2*xx2/(self.b*self.Ec*xx2**2+2*self.Asp*self.Es*xx2-2*self.Asp*self.Es*self.rp)
-          sgsp2= self.sgc*self.Es*(xx2-self.rp)/(self.Ec*xx2)
+          sgsp2= sgc2*self.Es*(xx2-self.rp)/(self.Ec*xx2)
           self.xx= (xx1+xx2)/2.0
           self.sgc= (sgc1+sgc2)/2.0
           self.sgs= (sgs1+sgs2)/2.0
@@ -18,6 +18,7 @@ import geom
 from materials.sections.fiber_section import fiber_sets
 from materials.sections import stressCalc as sc
 from miscUtils import LogMessages as lmsg
+from postprocess import native_limit_state_checking as nlsc
 
 # Returns adherence stress (Pa) for concrete type (tableau 19 SIA 262).
 adherenceStress_x= [12e6 , 16e6,20e6 ,25e6 ,30e6 ,35e6 ,40e6 ,45e6 ,50e6]
@@ -85,6 +86,24 @@ class BiaxialBendingNormalStressController(lsc.LimitStateControllerBase):
       if(CFtmp>e.getProp(self.limitStateLabel).CF):
         e.setProp(self.limitStateLabel,cv.BiaxialBendingControlVars(idSection,nmbComb,CFtmp,Ntmp,MyTmp,MzTmp)) # Worst case.
 
+  def defineNativeCheck(self,checker,sectionDefinition):
+    '''Defines the check in the native checker.
+
+      :param checker: xc.LimitStateChecker object.
+      :param sectionDefinition: container with the section definitions.
+    '''
+    kernel= checker.newCheck('normal_stresses',self.limitStateLabel)
+    for sectionName, diagInt in sectionDefinition.mapInteractionDiagrams.items():
+      kernel.setInteractionDiagram(sectionName,diagInt)
+    return kernel
+
+  def getNativeControlVars(self,checker):
+    '''Returns the control variables computed by the native checker.'''
+    retval= list()
+    for r in nlsc.getResults(checker,self.limitStateLabel):
+      retval.append(cv.BiaxialBendingControlVars(r['idSection'],r['combName'],r['CF'],r['N'],r['My'],r['Mz']))
+    return retval
+
 class UniaxialBendingNormalStressController(lsc.LimitStateControllerBase):
   '''Object that controls normal stresses limit state (uniaxial bending).'''
 
@@ -118,6 +137,25 @@ class UniaxialBendingNormalStressController(lsc.LimitStateControllerBase):
       if(CFtmp>e.getProp(self.limitStateLabel).CF):
         e.setProp(self.limitStateLabel,cv.BiaxialBendingControlVars(idSection,nmbComb,CFtmp,Ntmp,MyTmp)) # Worst case.
 
+  def defineNativeCheck(self,checker,sectionDefinition):
+    '''Defines the check in the native checker (the interaction
+       diagrams must be of type NMy).
+
+      :param checker: xc.LimitStateChecker object.
+      :param sectionDefinition: container with the section definitions.
+    '''
+    kernel= checker.newCheck('normal_stresses',self.limitStateLabel)
+    for sectionName, diagInt in sectionDefinition.mapInteractionDiagrams.items():
+      kernel.setInteractionDiagram2d(sectionName,diagInt)
+    return kernel
+
+  def getNativeControlVars(self,checker):
+    '''Returns the control variables computed by the native checker.'''
+    retval= list()
+    for r in nlsc.getResults(checker,self.limitStateLabel):
+      retval.append(cv.BiaxialBendingControlVars(r['idSection'],r['combName'],r['CF'],r['N'],r['My']))
+    return retval
+
 # Shear checking.
 
 def VuNoShearRebars(concrete,steel,Nd,Md,AsTrac,b,d):
@@ -257,6 +295,30 @@ class ShearController(lsc.LimitStateControllerBase):
         e.setProp(self.limitStateLabel,cv.RCShearControlVars(idSection,nmbComb,FCtmp,NTmp,MyTmp,MzTmp,Mu,VyTmp,VzTmp,theta,self.Vcu,self.Vsu,VuTmp)) # Worst case
       #13.02.2018 End of changes
 
+  def defineNativeCheck(self,checker,sectionDefinition):
+    '''Defines the check in the native checker.
+
+      :param checker: xc.LimitStateChecker object.
+      :param sectionDefinition: container with the section definitions.
+    '''
+    kernel= checker.newCheck('shear_sia262',self.limitStateLabel)
+    self.strutAngles= dict() # Angle of the concrete struts for each section.
+    for sectionName, section in sectionDefinition.mapSections.items():
+      self.setSection(section)
+      self.strutAngles[sectionName]= section.shReinfY.angThetaConcrStruts
+      MuFict= self.concrete.Ecm()*section.getIz_RClocalZax()*1e-3/section.h
+      diagInt= sectionDefinition.mapInteractionDiagrams[sectionName]
+      kernel.setSectionParameters(sectionName,self.concrete.taucd(),self.width,self.depthUtil,self.AsTrsv,self.steel.fyd(),self.mechanicLeverArm,math.radians(30),section.getRoughVcuEstimation(),MuFict,diagInt)
+    return kernel
+
+  def getNativeControlVars(self,checker):
+    '''Returns the control variables computed by the native checker.'''
+    retval= list()
+    for r in nlsc.getResults(checker,self.limitStateLabel):
+      theta= self.strutAngles[r['idSection']]
+      retval.append(cv.RCShearControlVars(r['idSection'],r['combName'],r['CF'],r['N'],r['My'],r['Mz'],r['Mu'],r['Vy'],r['Vz'],theta,r['Vcu'],r['Vsu'],r['Vu']))
+    return retval
+
 
 class CrackControlSIA262(lsc.CrackControlBaseParameters):
   '''Crack control checking of a reinforced concrete section
@@ -360,6 +422,34 @@ class CrackControlSIA262PlanB(CrackControlSIA262):
         elementControlVars.crackControlVarsNeg= cv.CrackControlBaseVars(nmbComb,CFNeg,Ntmp,MyTmp,MzTmp,sigma_sNeg)
       e.setProp(self.limitStateLabel,elementControlVars)
 
+  def defineNativeCheck(self,checker,sectionDefinition):
+    '''Defines the check in the native checker (a check for
+       each face of the section).
+
+      :param checker: xc.LimitStateChecker object.
+      :param sectionDefinition: container with the section definitions.
+    '''
+    kernels= list()
+    for face in ['Pos','Neg']:
+      kernel= checker.newCheck('crack_control',self.limitStateLabel+face)
+      kernel.negativeFace= (face=='Neg')
+      for sectionName, section in sectionDefinition.mapSections.items():
+        s= section.getStressCalculator()
+        kernel.setSectionParameters(sectionName,s.b,s.h,s.r,s.rp,s.As,s.Asp,s.Ec,s.Es,self.limitStress)
+      kernels.append(kernel)
+    return kernels
+
+  def getNativeControlVars(self,checker):
+    '''Returns the control variables computed by the native checker.'''
+    retval= list()
+    resultsPos= nlsc.getResults(checker,self.limitStateLabel+'Pos')
+    resultsNeg= nlsc.getResults(checker,self.limitStateLabel+'Neg')
+    for rp,rn in zip(resultsPos,resultsNeg):
+      varsPos= cv.CrackControlBaseVars(rp['combName'],rp['CF'],rp['N'],rp['My'],rp['Mz'],rp['steelStress'])
+      varsNeg= cv.CrackControlBaseVars(rn['combName'],rn['CF'],rn['N'],rn['My'],rn['Mz'],rn['steelStress'])
+      retval.append(cv.CrackControlVars(rp['idSection'],varsPos,varsNeg))
+    return retval
+
 
 def procesResultVerifFISSIA262(preprocessor,nmbComb,limitStress):
   '''Crack control checking of reinforced concrete sections.'''
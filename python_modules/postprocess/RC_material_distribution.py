@@ -9,6 +9,7 @@ import xc
 # Macros
 from solution import predefined_solutions
 from postprocess import phantom_model as phm
+from postprocess import native_limit_state_checking as nlsc
 from materials.sections import RCsectionsContainer as sc
 from model.sets import sets_mng as sUtils
 
@@ -134,6 +135,34 @@ class RCMaterialDistribution(object):
     result= phantomModel.runChecking(limitStateData)
     return (feProblem, result)
 
+  def runNativeChecking(self,limitStateData,matDiagType,threeDim= True,numThreads= 0):
+    '''Runs the verification using the native checker (no phantom
+       model is built, see postprocess.native_limit_state_checking).
+       The native checks reproduce the computations of the Python
+       controllers (the rebar stresses of the crack control and
+       fatigue checks are those of materials.sections.stressCalc).
+
+    :param limitStateData: object that contains the name of the file
+                           containing the internal forces 
+                           obtained for each element 
+                           for the combinations analyzed and the
+                           controller to use for the checking.
+    :param matDiagType: type of the material diagram (d: design, 
+           k: characteristic).
+    :param threeDim: true if it's 3D (Fx,Fy,Fz,Mx,My,Mz) 
+           false if it's 2D (Fx,Fy,Mz).
+    :param numThreads: number of threads (0: as many as the hardware supports).
+    '''
+    feProblem= xc.FEProblem()
+    preprocessor= feProblem.getPreprocessor
+    self.sectionDefinition.createRCsections(preprocessor,matDiagType)
+    if(threeDim):
+      self.sectionDefinition.calcInteractionDiagrams(preprocessor,matDiagType)
+    else:
+      self.sectionDefinition.calcInteractionDiagrams(preprocessor,matDiagType,'NMy')
+    result= nlsc.runChecking(self,limitStateData,numThreads)
+    return (feProblem, result)
+
   def internalForcesVerification3D(self,limitStateData,matDiagType):
     '''Limit state verification based on internal force (Fx,Fy,Fz,Mx,My,Mz) values.
 
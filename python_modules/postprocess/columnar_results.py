@@ -0,0 +1,112 @@
+# -*- coding: utf-8 -*-
+''' Utilities to write and read the columnar results files (internal
+    forces and displacements for each load combination) written by the
+    element_forces_columnar_recorder and node_disp_columnar_recorder
+    recorders.'''
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018 LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import numpy
+import xc
+from materials.sections import internal_forces
+
+# Element types whose internal forces are written by the native recorder.
+nativeElementTypes= ['ElasticBeam2d','ElasticBeam3d','ForceBeamColumn2d','ForceBeamColumn3d','NLBeamColumn2d']
+
+def isNativeElementType(elementType):
+  ''' Return true if the internal forces of the elements of this
+      type can be written by the native recorder.'''
+  for t in nativeElementTypes:
+    if(elementType.endswith(t)):
+      return True
+  return False
+
+def nativeRecordable(elemSet):
+  ''' Return true if the internal forces of all the elements
+      of the set can be written by the native recorder.'''
+  for e in elemSet:
+    if(not isNativeElementType(e.type())):
+      return False
+  return True
+
+def installInternalForcesRecorder(domain,elemSet,fileName,compressionLevel= 0):
+  ''' Create a recorder that writes the internal forces of the elements
+      for each load combination in a columnar results file.
+
+  :param domain: domain of the finite element problem.
+  :param elemSet: elements whose internal forces will be written.
+  :param fileName: name of the results file.
+  :param compressionLevel: 0: no compression (the columns can be mapped
+                           in memory without copying), 1-9 zlib level.
+  '''
+  recorder= domain.newRecorder("element_forces_columnar_recorder",None)
+  recorder.setElements(xc.ID([e.tag for e in elemSet]))
+  recorder.compressionLevel= compressionLevel
+  recorder.open(fileName)
+  return recorder
+
+def installDisplacementsRecorder(domain,nodSet,fileName,compressionLevel= 0):
+  ''' Create a recorder that writes the displacements of the nodes
+      for each load combination in a columnar results file.
+
+  :param domain: domain of the finite element problem.
+  :param nodSet: nodes whose displacements will be written.
+  :param fileName: name of the results file.
+  :param compressionLevel: 0: no compression (the columns can be mapped
+                           in memory without copying), 1-9 zlib level.
+  '''
+  recorder= domain.newRecorder("node_disp_columnar_recorder",None)
+  recorder.setNodes(xc.ID([n.tag for n in nodSet]))
+  recorder.compressionLevel= compressionLevel
+  recorder.open(fileName)
+  return recorder
+
+class ColumnView(object):
+  ''' Exposes a column of a results file through the NumPy array
+      interface. Keeps a reference to the reader so the memory
+      shared with the arrays remains valid.'''
+  def __init__(self,reader,chunkName,columnName):
+    self.reader= reader
+    self.__array_interface__= reader.getArrayInterface(chunkName,columnName)
+
+def getColumn(reader,chunkName,columnName):
+  ''' Return a (read only) NumPy array that shares the memory of the
+      column of the chunk (no copy is made unless the file is
+      compressed).
+
+  :param reader: xc.ColumnarResultsReader object.
+  :param chunkName: name of the chunk (load combination).
+  :param columnName: name of the column (i.e. 'Elem', 'N', 'Ux',...).
+  '''
+  return numpy.asarray(ColumnView(reader,chunkName,columnName))
+
+def isColumnarResultsFile(fileName):
+  ''' Return true if the file is a columnar results file.'''
+  with open(fileName,'rb') as f:
+    return (f.read(8)=='XCCOLRES')
+
+def readInternalForces(fileName):
+  ''' Return the internal forces stored in the file as a list of
+      CrossSectionInternalForces objects (with the idComb, tagElem
+      and idSection attributes assigned).
+
+  :param fileName: name of the results file.
+  '''
+  retval= list()
+  reader= xc.ColumnarResultsReader(fileName)
+  labels= ['N','Vy','Vz','T','My','Mz']
+  for comb in reader.getChunkNames():
+    tags= getColumn(reader,comb,'Elem')
+    sections= getColumn(reader,comb,'Sect')
+    values= [getColumn(reader,comb,l) for l in labels]
+    for i in range(0,len(tags)):
+      crossSectionInternalForces= internal_forces.CrossSectionInternalForces(*[float(v[i]) for v in values])
+      crossSectionInternalForces.idComb= comb
+      crossSectionInternalForces.tagElem= int(tags[i])
+      crossSectionInternalForces.idSection= int(sections[i])
+      retval.append(crossSectionInternalForces)
+  return retval
@@ -11,6 +11,7 @@ import os
 from solution import predefined_solutions
 from postprocess.reports import export_internal_forces as eif
 from postprocess.reports import export_displacements as edisp
+from postprocess import columnar_results as cr
 from miscUtils import LogMessages as lmsg
 
 def defaultAnalysis(feProb,steps= 1):
@@ -22,6 +23,8 @@ def defaultAnalysis(feProb,steps= 1):
 class LimitStateData(object):
   check_results_directory= './' #Path to verifRsl* files.
   internal_forces_results_directory= './' #Path to esf_el* f
+  resultsFormat= 'csv' # 'csv': text files, 'binary': columnar results files.
+  resultsCompressionLevel= 0 # Compression of the binary results (0: none, 1-9: zlib level).
   def __init__(self,limitStateLabel,outputDataBaseFileName):
     '''Limit state data constructor
     label; limit state check label; Something like "Fatigue" or "CrackControl"
@@ -31,14 +34,34 @@ class LimitStateData(object):
     self.label= limitStateLabel
     self.outputDataBaseFileName= outputDataBaseFileName
     self.controller= None
-  def getInternalForcesFileName(self):
+  def getResultsFileExtension(self,resultsFormat= None):
+    '''Return the extension of the results files.
+
+    :param resultsFormat: format of the files (if None use 
+                          self.resultsFormat).
+    '''
+    if(not resultsFormat):
+      resultsFormat= self.resultsFormat
+    if(resultsFormat=='binary'):
+      return '.xcr'
+    return '.csv'
+  def getResultsFileName(self,prefix,resultsFormat= None):
+    '''Return the name of a results file. If no format is given and
+    the binary file doesn't exist (saveAll fell back to CSV files) 
+    return the name of the CSV file.'''
+    retval= self.internal_forces_results_directory+prefix+ self.label
+    if((not resultsFormat) and (self.resultsFormat=='binary')):
+      if(not os.path.isfile(retval+'.xcr')):
+        resultsFormat= 'csv'
+    return retval+self.getResultsFileExtension(resultsFormat)
+  def getInternalForcesFileName(self,resultsFormat= None):
     '''Return the file name to read: combination name, element number and 
     internal forces.'''
-    return self.internal_forces_results_directory+'intForce_'+ self.label +'.csv'
-  def getDisplacementsFileName(self):
+    return self.getResultsFileName('intForce_',resultsFormat)
+  def getDisplacementsFileName(self,resultsFormat= None):
     '''Return the file name to read: combination name, node number and 
     displacements (ux,uy,uz,rotX,rotY,rotZ).'''
-    return self.internal_forces_results_directory+'displ_'+ self.label +'.csv'
+    return self.getResultsFileName('displ_',resultsFormat)
   def getOutputDataBaseFileName(self):
     '''Return the output file name without extension.'''
     return self.check_results_directory+self.outputDataBaseFileName
@@ -69,10 +92,18 @@ class LimitStateData(object):
     loadCombinations= self.dumpCombinations(combContainer,loadCombinations)
     elemSet= setCalc.getElements
     nodSet= setCalc.getNodes
-    fNameInfForc= self.getInternalForcesFileName()
-    fNameDispl= self.getDisplacementsFileName()
-    os.system("rm -f " + fNameInfForc) #Clear obsolete files.
-    os.system("rm -f " + fNameDispl)
+    for fmt in ['csv','binary']: #Clear obsolete files.
+      os.system("rm -f " + self.getInternalForcesFileName(fmt))
+      os.system("rm -f " + self.getDisplacementsFileName(fmt))
+    resultsFormat= self.resultsFormat
+    if(resultsFormat=='binary'):
+      if(cr.nativeRecordable(elemSet)):
+        self.saveAllBinary(feProblem,loadCombinations,elemSet,nodSet,analysisToPerform)
+        return
+      lmsg.warning('some elements can\'t be written in the binary results file; using CSV files.')
+      resultsFormat= 'csv'
+    fNameInfForc= self.getInternalForcesFileName(resultsFormat)
+    fNameDispl= self.getDisplacementsFileName(resultsFormat)
     fIntF= open(fNameInfForc,"a")
     fDisp= open(fNameDispl,"a")
     fIntF.write(" Comb. , Elem. , Sect. , N , Vy , Vz , T , My , Mz \n")
@@ -94,6 +125,32 @@ class LimitStateData(object):
       fDisp.close()
       comb.removeFromDomain() #Remove combination from the model.
 
+  def saveAllBinary(self,feProblem,loadCombinations,elemSet,nodSet,analysisToPerform= defaultAnalysis):
+    '''Write internal forces and displacements for each combination
+     in columnar results files (see postprocess.columnar_results).
+     The results are written by native recorders when the analysis
+     commits.
+     
+    :param feProblem: XC finite element problem to deal with.
+    :param loadCombinations: load combinations to analyze.
+    :param elemSet: elements whose internal forces will be written.
+    :param nodSet: nodes whose displacements will be written.
+    '''
+    domain= feProblem.getDomain
+    recIntF= cr.installInternalForcesRecorder(domain,elemSet,self.getInternalForcesFileName('binary'),self.resultsCompressionLevel)
+    recDisp= cr.installDisplacementsRecorder(domain,nodSet,self.getDisplacementsFileName('binary'),self.resultsCompressionLevel)
+    for key in loadCombinations.getKeys():
+      comb= loadCombinations[key]
+      feProblem.getPreprocessor.resetLoadCase()
+      comb.addToDomain() #Combination to analyze.
+      #Solution (results are written on commit).
+      result= analysisToPerform(feProblem)
+      comb.removeFromDomain() #Remove combination from the model.
+    recIntF.close()
+    recDisp.close()
+    domain.removeRecorder(recIntF)
+    domain.removeRecorder(recDisp)
+
 class NormalStressesRCLimitStateData(LimitStateData):
   ''' Reinforced concrete normal stresses data for limit state checking.'''
   def __init__(self):
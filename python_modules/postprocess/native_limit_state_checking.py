@@ -0,0 +1,127 @@
+# -*- coding: utf-8 -*-
+''' Limit state checking using the native checker (xc.LimitStateChecker):
+    the internal forces are checked in bulk (a combination at a time)
+    without building a phantom model.'''
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018 LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import os
+import csv
+import scipy
+import xc
+from collections import defaultdict
+from postprocess import columnar_results
+from miscUtils import LogMessages as lmsg
+
+def setElementSections(checker,rcMaterialDistribution):
+  ''' Assigns to the checker the sections of each element.
+
+  :param checker: xc.LimitStateChecker object.
+  :param rcMaterialDistribution: RC sections distribution over the elements.
+  '''
+  sectionDistribution= rcMaterialDistribution.sectionDistribution
+  for tagElem in sectionDistribution.keys():
+    sectionNames= sectionDistribution[tagElem]
+    for i in range(0,len(sectionNames)):
+      checker.setElementSection(tagElem,i,sectionNames[i])
+
+def checkCSVFile(checker,fileName):
+  ''' Checks the internal forces written in a CSV file by 
+      LimitStateData.saveAll.'''
+  rows= defaultdict(list)
+  combs= list()
+  with open(fileName,'r') as f:
+    internalForcesListing= csv.reader(f)
+    internalForcesListing.next() #skip first line (head)
+    for lst in internalForcesListing:
+      if(len(lst)>0):
+        comb= lst[0].strip()
+        if(not comb in rows):
+          combs.append(comb)
+        rows[comb].append([int(lst[1]),int(lst[2])]+[float(v) for v in lst[3:9]])
+  retval= 0
+  for comb in combs:
+    values= zip(*rows[comb])
+    retval= checker.checkInternalForces(comb,xc.ID(list(values[0])),xc.ID(list(values[1])),*[xc.Vector(list(v)) for v in values[2:]])
+    if(retval!=0):
+      break
+  return retval
+
+def checkInternalForcesFile(checker,fileName):
+  ''' Checks the internal forces written by LimitStateData.saveAll
+      (columnar results file or CSV file).'''
+  if(columnar_results.isColumnarResultsFile(fileName)):
+    return checker.checkFile(fileName)
+  return checkCSVFile(checker,fileName)
+
+def getResults(checker,label):
+  ''' Returns a list with the worst case of the check for each 
+      element section. Each item is a dictionary with the keys:
+      idSection, combName, CF, N, Vy, Vz, T, My, Mz and the names
+      of the auxiliary values of the check.'''
+  CFs= checker.getCapacityFactors(label)
+  combs= checker.getGoverningCombinations(label)
+  sectionNames= checker.getSectionNames()
+  values= dict()
+  for c in ['N','Vy','Vz','T','My','Mz']:
+    values[c]= checker.getInternalForces(label,c)
+  for a in checker.getCheck(label).getAuxNames():
+    values[a]= checker.getAuxValues(label,a)
+  retval= list()
+  for i in range(0,len(CFs)):
+    r= {'idSection':sectionNames[i], 'combName':combs[i], 'CF':CFs[i]}
+    for key in values:
+      r[key]= values[key][i]
+    retval.append(r)
+  return retval
+
+def writeControlVars(controlVarName,checker,controlVars,outputFileName):
+  '''Writes control var values into a file for doing graphics and
+     into a latex file (same format as 
+     control_vars.writeControlVarsFromElements).
+
+  :param controlVarName: name of the control var. 
+  :param checker: checker that computed the control vars.
+  :param controlVars: control vars for each element section.
+  :param outputFileName: name of the files to write (.py and .tex)
+  '''
+  tags= checker.getElementTags()
+  sections= checker.getSectionIndexes()
+  texOutput= ["Section 1\n","Section 2\n"]
+  fcs= [[],[]] #Capacity factors at each section.
+  with open(outputFileName+".py","w") as xcOutput:
+    for eTag,iSect,controlVar in zip(tags,sections,controlVars):
+      j= min(iSect,1)
+      fcs[j].append(controlVar.getCF())
+      texOutput[j]+= controlVar.getLaTeXString(eTag,1e-3)
+      xcOutput.write(controlVar.strElementProp(eTag,controlVarName+'Sect'+str(j+1),1e-3))
+  with open(outputFileName+".tex","w") as f:
+    f.write(texOutput[0]+texOutput[1])
+  return [scipy.mean(fcs[0]),scipy.mean(fcs[1])]
+
+def runChecking(rcMaterialDistribution,limitStateData,numThreads= 0):
+  '''Checks the internal forces obtained for each combination
+     (see LimitStateData.saveAll) and writes the results.
+
+  :param rcMaterialDistribution: RC sections distribution over the elements
+         (with the interaction diagrams already computed).
+  :param limitStateData: object that contains the name of the file
+         containing the internal forces and the controller to use
+         for the checking.
+  :param numThreads: number of threads (0: as many as the hardware supports).
+  '''
+  controller= limitStateData.controller
+  checker= xc.LimitStateChecker(numThreads)
+  setElementSections(checker,rcMaterialDistribution)
+  controller.defineNativeCheck(checker,rcMaterialDistribution.sectionDefinition)
+  if(checkInternalForcesFile(checker,limitStateData.getInternalForcesFileName())!=0):
+    lmsg.error('native checking failed.')
+    return -1.0
+  if(checker.numUnassignedRows>0):
+    lmsg.warning(str(checker.numUnassignedRows)+' internal forces without assigned section ignored.')
+  controlVars= controller.getNativeControlVars(checker)
+  return writeControlVars(controller.limitStateLabel,checker,controlVars,limitStateData.getOutputDataBaseFileName())
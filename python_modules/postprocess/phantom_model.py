@@ -26,6 +26,7 @@ from model import predefined_spaces
 from materials import typical_materials
 from materials.sections import section_properties
 from postprocess import control_vars as cv
+from postprocess import columnar_results
 from solution import predefined_solutions
 from miscUtils import LogMessages as lmsg
 from materials.sections import internal_forces
@@ -59,8 +60,15 @@ class PhantomModel(object):
     '''
     self.elementTags= set()
     self.idCombs= set()
-    f= open(intForcCombFileName,"r")
     self.internalForcesValues= defaultdict(list)
+    if(columnar_results.isColumnarResultsFile(intForcCombFileName)):
+      for crossSectionInternalForces in columnar_results.readInternalForces(intForcCombFileName):
+        self.idCombs.add(crossSectionInternalForces.idComb)
+        tagElem= crossSectionInternalForces.tagElem
+        self.elementTags.add(tagElem)
+        self.internalForcesValues[tagElem].append(crossSectionInternalForces)
+      return
+    f= open(intForcCombFileName,"r")
     internalForcesListing= csv.reader(f)
     internalForcesListing.next()    #skip first line (head)
     for lst in internalForcesListing:    #lst: list of internal forces for each combination and element
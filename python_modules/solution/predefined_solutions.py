@@ -17,6 +17,9 @@ class SolutionProcedure(object):
   :ivar sm:
   :ivar numberer:  DOF numberer. Determines the mapping between equation 
                    numbers and degrees of freedom (how DOF are numbered)
+  :ivar numbererAlgorithm: algorithm used by the DOF numberer (defaults
+                   to "rcm"; "amd", "nested_dissection" and "auto" give
+                   less fill with sparse solvers).
   :ivar cHandler:  constraint handler. Determines how the constraint equations 
                    are enforced in the analysis, how it handles the boundary
                    conditions/imposed displacements 
@@ -51,6 +54,7 @@ class SolutionProcedure(object):
     self.solCtrl= None
     self.sm= None
     self.numberer= None
+    self.numbererAlgorithm= "rcm"
     self.cHandler= None
     self.analysisAggregation= None
     self.solAlgo= None
@@ -67,7 +71,7 @@ class SolutionProcedure(object):
     solModels= self.solCtrl.getModelWrapperContainer
     self.sm= solModels.newModelWrapper("sm")
     self.numberer= self.sm.newNumberer("default_numberer")
-    self.numberer.useAlgorithm("rcm")
+    self.numberer.useAlgorithm(self.numbererAlgorithm)
     self.cHandler= self.sm.newConstraintHandler("penalty_constraint_handler")
     self.cHandler.alphaSP= 1.0e15
     self.cHandler.alphaMP= 1.0e15
@@ -85,7 +89,7 @@ class SolutionProcedure(object):
     solModels= self.solCtrl.getModelWrapperContainer
     self.sm= solModels.newModelWrapper("sm")
     self.numberer= self.sm.newNumberer("default_numberer")
-    self.numberer.useAlgorithm("rcm")
+    self.numberer.useAlgorithm(self.numbererAlgorithm)
     self.cHandler= self.sm.newConstraintHandler("lagrange_constraint_handler")
     analysisAggregations= self.solCtrl.getAnalysisAggregationContainer
     self.analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
@@ -102,7 +106,7 @@ class SolutionProcedure(object):
     solModels= self.solCtrl.getModelWrapperContainer
     self.sm= solModels.newModelWrapper("sm")
     self.numberer= self.sm.newNumberer("default_numberer")
-    self.numberer.useAlgorithm("rcm")
+    self.numberer.useAlgorithm(self.numbererAlgorithm)
     self.cHandler= self.sm.newConstraintHandler("transformation_constraint_handler")
     analysisAggregations= self.solCtrl.getAnalysisAggregationContainer
     self.analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
@@ -175,7 +179,7 @@ class SolutionProcedure(object):
     solModels= self.solCtrl.getModelWrapperContainer
     self.sm= solModels.newModelWrapper("sm")
     self.numberer= self.sm.newNumberer("default_numberer")
-    self.numberer.useAlgorithm("rcm")
+    self.numberer.useAlgorithm(self.numbererAlgorithm)
     self.cHandler= self.sm.newConstraintHandler("penalty_constraint_handler")
     self.cHandler.alphaSP= 1.0e15
     self.cHandler.alphaMP= 1.0e15
@@ -198,7 +202,7 @@ class SolutionProcedure(object):
     solModels= self.solCtrl.getModelWrapperContainer
     self.sm= solModels.newModelWrapper("sm")
     self.numberer= self.sm.newNumberer("default_numberer")
-    self.numberer.useAlgorithm("rcm")
+    self.numberer.useAlgorithm(self.numbererAlgorithm)
     self.cHandler= self.sm.newConstraintHandler("penalty_constraint_handler")
     self.cHandler.alphaSP= 1.0e18
     self.cHandler.alphaMP= 1.0e18
@@ -222,7 +226,7 @@ class SolutionProcedure(object):
     self.sm= solModels.newModelWrapper("sm")
     self.cHandler= self.sm.newConstraintHandler("transformation_constraint_handler")
     self.numberer= self.sm.newNumberer("default_numberer")
-    self.numberer.useAlgorithm("rcm")
+    self.numberer.useAlgorithm(self.numbererAlgorithm)
     analysisAggregations= self.solCtrl.getAnalysisAggregationContainer
     self.analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
     self.solAlgo= self.analysisAggregation.newSolutionAlgorithm("frequency_soln_algo")
@@ -41,6 +41,7 @@
 #include "utility/database/FileDatastore.h"
 #include "utility/database/MySqlDatastore.h"
 #include "utility/database/BerkeleyDbDatastore.h"
+#include "utility/database/MemoryDatastore.h"
 #include "utility/database/SQLiteDatastore.h"
 
 #include "domain/mesh/Mesh.h"
@@ -73,6 +74,8 @@ XC::FE_Datastore *XC::FEProblem::defineDatabase(const std::string &tipo, const s
       dataBase= new BerkeleyDbDatastore(nombre, preprocessor, theBroker);
     else if(tipo == "SQLite")
       dataBase= new SQLiteDatastore(nombre, preprocessor, theBroker);
+    else if(tipo == "Memory")
+      dataBase= new MemoryDatastore(nombre, preprocessor, theBroker);
     else
       {  
         std::cerr << "WARNING No database type exists ";
@@ -83,6 +86,10 @@ XC::FE_Datastore *XC::FEProblem::defineDatabase(const std::string &tipo, const s
     return dataBase; 
   }
 
+//! @brief Return the object broker used by the databases.
+XC::FEM_ObjectBroker &XC::FEProblem::getBroker(void)
+  { return theBroker; }
+
 XC::FEProblem::~FEProblem(void)
   { clearAll(); }
 
@@ -35,11 +35,13 @@
 #include "solution/ProcSolu.h"
 #include "post_process/MapFields.h"
 #include "utility/handler/DataOutputHandler.h"
+#include "utility/Profiler.h"
 
 //! @brief Open source finite element program for structural analysis
 namespace XC {
 class Domain;
 class FE_Datastore;
+class FEM_ObjectBroker;
 class FEM_ObjectBrokerAllClasses;
 class MEDMesh;
 class MEDMeshing;
@@ -100,6 +102,7 @@ class FEProblem: public EntCmd
       { return gVERSION_SHORT; }
     void clearAll(void);
     FE_Datastore *defineDatabase(const std::string &tipo, const std::string &nombre);
+    static FEM_ObjectBroker &getBroker(void);
     inline FE_Datastore *getDataBase(void)
       { return dataBase; }
     inline const Preprocessor &getPreprocessor(void) const
@@ -118,6 +121,9 @@ class FEProblem: public EntCmd
       { return fields; }
     inline DataOutputHandler::map_output_handlers *getOutputHandlers(void) const
       { return &output_handlers; }
+    //! @brief Returns the analysis profiler.
+    inline Profiler &getProfiler(void)
+      { return Profiler::get(); }
   };
 
 inline std::string getXCVersion(void)
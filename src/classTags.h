@@ -77,12 +77,14 @@
 #define EigenSOE_TAGS_SymBandEigenSOE   3
 #define EigenSOE_TAGS_BandArpackppSOE 	4
 #define EigenSOE_TAGS_FullGenEigenSOE   5
+#define EigenSOE_TAGS_SparseGenColEigenSOE 6
 
 #define EigenSOLVER_TAGS_BandArpackSolver 	1
 #define EigenSOLVER_TAGS_SymArpackSolver 	2
 #define EigenSOLVER_TAGS_SymBandEigenSolver     3
 #define EigenSOLVER_TAGS_BandArpackppSolver 	4
 #define EigenSOLVER_TAGS_FullGenEigenSolver  5
+#define EigenSOLVER_TAGS_ShiftInvertLanczosSolver 6
 
 #define EigenALGORITHM_TAGS_Frequency 1
 #define EigenALGORITHM_TAGS_Standard  2
@@ -372,6 +374,8 @@
 #define GraphNUMBERER_TAG_SimpleNumberer   	2
 #define GraphNUMBERER_TAG_MyRCM   		3
 #define GraphNUMBERER_TAG_Metis   		4
+#define GraphNUMBERER_TAG_AMD   		5
+#define GraphNUMBERER_TAG_NestedDissection	6
 
 
 #define AnaMODEL_TAGS_AnalysisModel 	1
@@ -454,6 +458,7 @@
 #define LinSOE_TAGS_SparseGenRowLinSOE		20
 #define LinSOE_TAGS_DistributedSparseGenRowLinSOE       21
 #define LinSOE_TAGS_DistributedDiagonalSOE 22
+#define LinSOE_TAGS_SupernodalSPDLinSOE 23
 
 #define SOLVER_TAGS_FullGenLinLapackSolver  	1
 #define SOLVER_TAGS_BandGenLinLapackSolver  	2
@@ -477,6 +482,8 @@
 #define SOLVER_TAGS_DiagonalDirectSolver 20
 #define SOLVER_TAGS_PetscSparseSeqSolver 21
 #define SOLVER_TAGS_DistributedDiagonalSolver 22
+#define SOLVER_TAGS_SupernodalSPDLinSolver 23
+#define SOLVER_TAGS_KrylovSparseSolver 24
 
 
 #define RECORDER_TAGS_ElementRecorder		1
@@ -495,6 +502,10 @@
 #define RECORDER_TAGS_TclFeViewer		14
 #define RECORDER_TAGS_NodePropRecorder		115
 #define RECORDER_TAGS_ElementPropRecorder	215
+#define RECORDER_TAGS_NodePropEnvelopeRecorder	116
+#define RECORDER_TAGS_ElementPropEnvelopeRecorder	216
+#define RECORDER_TAGS_NodeDispColumnarRecorder	117
+#define RECORDER_TAGS_ElementForcesColumnarRecorder	217
 #define RECORDER_TAGS_EnvelopeData              16
 
 #define DATAHANDLER_TAGS_DataOutputStreamHandler		1
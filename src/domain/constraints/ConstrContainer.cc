@@ -938,7 +938,7 @@ XC::DbTagData &XC::ConstrContainer::getDbTagData(void) const
 int XC::ConstrContainer::sendLPatternsTags(const int &posFlag,const int &posDbTag,CommParameters &cp)
   {
     int res= 0;
-    static ID loadPatternsTags;
+    static thread_local ID loadPatternsTags;
     const std::deque<int> tags= getTagsLPs();
     const size_t sz= tags.size();
     if(sz>0)
@@ -959,7 +959,7 @@ int XC::ConstrContainer::recvLPatternsTags(const int &posFlag,const int &posDbTa
   {
     Domain *dom= getDomain();
     int res= 0;
-    static ID loadPatternsTags;
+    static thread_local ID loadPatternsTags;
     const int flag= getDbTagDataPos(posFlag);
     if(flag != 0)
       {
@@ -1005,7 +1005,7 @@ int XC::ConstrContainer::recvLPatternsTags(const int &posFlag,const int &posDbTa
 int XC::ConstrContainer::sendNLockersTags(const int &posFlag,const int &posDbTag,CommParameters &cp)
   {
     int res= 0;
-    static ID nLockersTags;
+    static thread_local ID nLockersTags;
     const std::deque<int> tags= getTagsNLs();
     const size_t sz= tags.size();
     if(sz>0)
@@ -1026,7 +1026,7 @@ int XC::ConstrContainer::recvNLockersTags(const int &posFlag,const int &posDbTag
   {
     Domain *dom= getDomain();
     int res= 0;
-    static ID nLockersTags;
+    static thread_local ID nLockersTags;
     const int flag= getDbTagDataPos(posFlag);
     if(flag != 0)
       {
@@ -129,7 +129,7 @@ int XC::ImposedMotionBase::recvData(const CommParameters &cp)
 //! @brief Sends object through the channel being passed as parameter.
 int XC::ImposedMotionBase::sendSelf(CommParameters &cp)
   {
-    static ID data(8);
+    static thread_local ID data(8);
     int result= sendData(cp);
     const int dbTag= getDbTag();
     result+= cp.sendIdData(getDbTagData(),dbTag);
@@ -141,7 +141,7 @@ int XC::ImposedMotionBase::sendSelf(CommParameters &cp)
 //! @brief Receives object through the channel being passed as parameter.
 int XC::ImposedMotionBase::recvSelf(const CommParameters &cp)
   {
-    static ID data(8);
+    static thread_local ID data(8);
     const int dataTag= getDbTag();
     int res= cp.receiveIdData(getDbTagData(),dataTag);
     if(res<0)
@@ -114,7 +114,7 @@ int XC::ImposedMotionSP1::recvData(const CommParameters &cp)
 //! @brief Sends object through the channel being passed as parameter.
 int XC::ImposedMotionSP1::sendSelf(CommParameters &cp)
   {
-    static ID data(10);
+    static thread_local ID data(10);
     int result= sendData(cp);
     const int dbTag = this->getDbTag();
     result+= cp.sendIdData(getDbTagData(),dbTag);
@@ -126,7 +126,7 @@ int XC::ImposedMotionSP1::sendSelf(CommParameters &cp)
 //! @brief Receives object through the channel being passed as parameter.
 int XC::ImposedMotionSP1::recvSelf(const CommParameters &cp)
   {
-    static ID data(10);
+    static thread_local ID data(10);
     const int dataTag= getDbTag();
     int res= cp.receiveIdData(getDbTagData(),dataTag);
     if(res<0)
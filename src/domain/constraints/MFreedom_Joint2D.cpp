@@ -232,7 +232,7 @@ int XC::MFreedom_Joint2D::applyConstraint(double timeStamp)
 //! @brief Sends the object through the channel being passed as parameter.
 int XC::MFreedom_Joint2D::sendSelf(CommParameters &cp)
   {
-    static ID data(18);
+    static thread_local ID data(18);
     int result= sendData(cp);
     data(13) = MainDOF;
     data(14) = AuxDOF;
@@ -252,7 +252,7 @@ int XC::MFreedom_Joint2D::sendSelf(CommParameters &cp)
 //! @brief Receives the object through the channel being passed as parameter.
 int XC::MFreedom_Joint2D::recvSelf(const CommParameters &cp)
   {
-    static ID data(18);
+    static thread_local ID data(18);
     const int dataTag= getDbTag();
     int result = cp.receiveIdData(getDbTagData(),dataTag);
     if(result < 0)
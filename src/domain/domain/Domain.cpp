@@ -102,6 +102,7 @@
 
 
 #include "utility/actor/actor/ArrayCommMetaData.h"
+#include "utility/Profiler.h"
 
 
 void XC::Domain::free_mem(void)
@@ -118,8 +119,8 @@ void XC::Domain::free_mem(void)
 //! @param owr: object that contains this one.
 XC::Domain::Domain(EntCmd *owr,DataOutputHandler::map_output_handlers *oh)
   :ObjWithRecorders(owr,oh),timeTracker(),CallbackCommit(""), dbTag(0),
-   currentGeoTag(0), hasDomainChangedFlag(false), commitTag(0),
-   mesh(this), constraints(this), theRegions(nullptr),
+   currentGeoTag(0), hasDomainChangedFlag(false), currentLoadTag(0),
+   commitTag(0), mesh(this), constraints(this), theRegions(nullptr),
    nmbCombActual(""), lastChannel(0), lastGeoSendTag(-1) {}
 
 //! @brief Constructor.
@@ -136,8 +137,8 @@ XC::Domain::Domain(EntCmd *owr,DataOutputHandler::map_output_handlers *oh)
 //! @param numNodeLockers: number of node lockers.
 XC::Domain::Domain(EntCmd *owr,int numNodes, int numElements, int numSPs, int numMPs, int numLoadPatterns,int numNodeLockers,DataOutputHandler::map_output_handlers *oh)
   :ObjWithRecorders(owr,oh),timeTracker(), CallbackCommit(""), dbTag(0),
-   currentGeoTag(0), hasDomainChangedFlag(false), commitTag(0), mesh(this),
-   constraints(this), theRegions(nullptr), nmbCombActual(""), lastChannel(0),
+   currentGeoTag(0), hasDomainChangedFlag(false), currentLoadTag(0),
+   commitTag(0), mesh(this), constraints(this), theRegions(nullptr), nmbCombActual(""), lastChannel(0),
    lastGeoSendTag(-1) {}
 
 //! @brief Removes all components from domain (nodes, elements, loads &
@@ -178,6 +179,7 @@ void XC::Domain::clearAll(void)
     hasDomainChangedFlag = false;
 
     currentGeoTag = 0;
+    currentLoadTag= 0;
     lastGeoSendTag = -1;
     lastChannel = 0;
   }
@@ -304,7 +306,7 @@ bool XC::Domain::addNodalLoad(NodalLoad *load, int pattern)
     if(result)
       {
         load->setDomain(this); // done in LoadPattern::addNodalLoad()
-        this->domainChange();
+        loadChange(); // model topology doesn't change.
       }
     return result;
   }
@@ -337,7 +339,7 @@ bool XC::Domain::addElementalLoad(ElementalLoad *load, int pattern)
       }
 
     // load->setDomain(this); // done in LoadPattern::addElementalLoad()
-    this->domainChange();
+    loadChange(); // model topology doesn't change.
     return result;
   }
 
@@ -432,7 +434,11 @@ bool XC::Domain::addLoadPattern(LoadPattern *load)
     if(result)
       {
         load->setDomain(this);
-        domainChange();
+        // the constraint handlers have to be redone
+        // only if the pattern imposes displacements.
+        if(load->getNumSPs()>0)
+          domainChange();
+        loadChange();
       }
     else
       {
@@ -499,6 +505,7 @@ bool XC::Domain::removeLoadPattern(int tag)
         // as the constraint handlers have to be redone
         if(numSPs>0)
           domainChange();
+        loadChange();
       }
     // finally return the load pattern
     return result;
@@ -569,6 +576,7 @@ void XC::Domain::removeLPs(void)
     // as the constraint handlers have to be redone
     if(numSPs>0)
       domainChange();
+    loadChange();
   }
 
 //! @brief Remove all node lockers from domain.
@@ -585,14 +593,24 @@ void XC::Domain::removeNLs(void)
 //! @param nodalLoadTag: Nodal load identifier.
 //! @param loadPattern: Load pattern identifier.
 bool XC::Domain::removeNodalLoad(int nodalLoadTag, int loadPattern)
-  { return constraints.removeNodalLoad(nodalLoadTag,loadPattern); }
+  {
+    const bool retval= constraints.removeNodalLoad(nodalLoadTag,loadPattern);
+    if(retval)
+      loadChange();
+    return retval;
+  }
 
 
 //! @brief Removes from domain the elemental load being passed as parameter.
 //! @param elemLoadTag: Identifier of the load over elements to remove.
 //! @param loadPattern: Load pattern identifier.
 bool XC::Domain::removeElementalLoad(int elemLoadTag, int loadPattern)
-  { return constraints.removeElementalLoad(elemLoadTag,loadPattern); }
+  {
+    const bool retval= constraints.removeElementalLoad(elemLoadTag,loadPattern);
+    if(retval)
+      loadChange();
+    return retval;
+  }
 
 //! @brief Removes from domain the single freedom constraint being passed as parameter.
 ///! @param singleFreedomTag: Single freedom identifier.
@@ -794,6 +812,7 @@ int XC::Domain::setRayleighDampingFactors(const RayleighDampingFactors &rF)
 //! equal to the current time and lastly increments its commit tag by \f$1\f$.  
 int XC::Domain::commit(void)
   {
+    ProfilerScope scope("Domain::commit");
     //
     // first invoke commit on all nodes and elements in the domain
     //
@@ -867,6 +886,7 @@ int XC::Domain::revertToStart(void)
 //! update()}. 
 int XC::Domain::update(void)
   {
+    ProfilerScope scope("Domain::update");
     // set the global constants
     FEProblem::theActiveDomain= this;
     return mesh.update();
@@ -1002,6 +1022,16 @@ void XC::Domain::setDomainChangeStamp(int newStamp)
 void XC::Domain::domainChange(void)
   { hasDomainChangedFlag= true; }
 
+//! @brief Marks the loads of the domain as changed.
+//!
+//! This method is invoked whenever a load (or a load pattern without
+//! imposed displacements) is added to or removed from the domain. Those
+//! changes don't modify the model topology so, unlike domainChange(), the
+//! analysis can keep the equation numbering, the DOF graph and the
+//! storage of the system of equations.
+void XC::Domain::loadChange(void)
+  { currentLoadTag++; }
+
 //! @brief Returns true if the model has changed.
 //!
 //! To return an integer stamp indicating the state of the
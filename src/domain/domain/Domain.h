@@ -122,6 +122,7 @@ class Domain: public ObjWithRecorders, public DistributedBase
     int dbTag; //!< Tag for the database.
     int currentGeoTag; //!< an integer used to mark if domain has changed
     bool hasDomainChangedFlag; //!< a bool flag used to indicate if GeoTag needs to be ++
+    int currentLoadTag; //!< an integer used to mark if the loads have changed (without changing the model topology).
     int commitTag;
     Mesh mesh; //!< Nodes and element container.
     ConstrContainer constraints;//!< Constraint container.
@@ -212,6 +213,10 @@ class Domain: public ObjWithRecorders, public DistributedBase
       { return timeTracker; }
     inline int getCurrentGeoTag(void) const
       { return currentGeoTag; }
+    //! @brief Returns the stamp that changes each time the loads
+    //! of the domain change (see loadChange).
+    inline int getLoadChangeStamp(void) const
+      { return currentLoadTag; }
     virtual int getCommitTag(void) const;
     virtual int getNumElements(void) const;
     virtual int getNumNodes(void) const;
@@ -263,6 +268,7 @@ class Domain: public ObjWithRecorders, public DistributedBase
     virtual void domainChange(void);
     virtual int hasDomainChanged(void);
     virtual void setDomainChangeStamp(int newStamp);
+    virtual void loadChange(void);
 
     virtual int addRegion(MeshRegion &theRegion);
     virtual MeshRegion *getRegion(int region);
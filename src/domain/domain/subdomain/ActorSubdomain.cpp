@@ -756,7 +756,7 @@ int XC::ActorSubdomain::update(void)
 
 int XC::ActorSubdomain::updateTimeDt(void)
   {
-    static XC::Vector data(2);
+    static thread_local XC::Vector data(2);
     this->recvVector(data);
     double newTime = data(0);
     double dT = data(1);
@@ -766,7 +766,7 @@ int XC::ActorSubdomain::updateTimeDt(void)
 
 int XC::ActorSubdomain::barrierCheck(int myResult)
   {
-    static XC::ID data(1);
+    static thread_local XC::ID data(1);
     data(0) = myResult;
     this->sendID(data);
     this->recvID(data);
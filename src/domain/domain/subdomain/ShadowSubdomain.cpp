@@ -848,7 +848,7 @@ int XC::ShadowSubdomain::update(void)
 
 int XC::ShadowSubdomain::update(double newTime, double dT)
   {
-    static Vector data(2);
+    static thread_local Vector data(2);
     DomainDecompositionAnalysis *theDDA = this->getDDAnalysis();
     if(theDDA != 0 && theDDA->doesIndependentAnalysis() != true)
       {
@@ -864,14 +864,14 @@ int XC::ShadowSubdomain::update(double newTime, double dT)
 
 int XC::ShadowSubdomain::barrierCheckIN(void)
   {
-    static ID data(1);
+    static thread_local ID data(1);
     this->recvID(data);
     return data(0);
   }
 
 int XC::ShadowSubdomain::barrierCheckOUT(int result)
   {
-    static ID data(1);
+    static thread_local ID data(1);
     data(0) = result;
     this->sendID(data);
     return 0;
@@ -882,7 +882,7 @@ int XC::ShadowSubdomain::setRayleighDampingFactors(const RayleighDampingFactors
   {
     msgData(0) = ShadowActorSubdomain_setRayleighDampingFactors;
     this->sendID(msgData);
-    static Vector data(4);
+    static thread_local Vector data(4);
 //     data(0) = alphaM;
 //     data(1) = betaK;
 //     data(2) = betaK0;
@@ -1187,7 +1187,7 @@ int XC::ShadowSubdomain::newStep(double dT)
   {
     msgData(0) =  ShadowActorSubdomain_newStep;
     this->sendID(msgData);
-    static Vector timeStep(4);
+    static thread_local Vector timeStep(4);
     timeStep(0) = dT;
     this->sendVector(timeStep);
     return 0;
@@ -1256,7 +1256,7 @@ int XC::ShadowSubdomain::buildMap(void) const
 
 double XC::ShadowSubdomain::getNodeDisp(int nodeTag, int dof, int &errorFlag)
   {
-    static Vector data(1);
+    static thread_local Vector data(1);
     data(0) = 0.0;
 
     msgData(0) = ShadowActorSubdomain_getNodeDisp;
@@ -88,7 +88,7 @@
 #include <utility/Timer.h>
 
 
-XC::Matrix XC::Subdomain::badResult(1,1); // for returns from getStiff, getMass and getDamp
+thread_local XC::Matrix XC::Subdomain::badResult(1,1); // for returns from getStiff, getMass and getDamp
 
 //! @brief Constructor.
 //!
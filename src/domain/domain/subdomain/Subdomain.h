@@ -114,7 +114,7 @@ class Subdomain: public Element, public Domain
     SubdomainNodIter *theNodIter;
 
     PartitionedModelBuilder *thePartitionedModelBuilder;
-    static Matrix badResult;
+    static thread_local Matrix badResult;
   protected:
     virtual int buildMap(void) const;
     mutable bool mapBuilt;
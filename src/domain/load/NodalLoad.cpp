@@ -70,7 +70,7 @@
 #include "utility/actor/actor/ArrayCommMetaData.h"
 
 // AddingSensitivity:BEGIN /////////////////////////////////////
- XC::Vector XC::NodalLoad::gradientVector(1);
+thread_local XC::Vector XC::NodalLoad::gradientVector(1);
 // AddingSensitivity:END ///////////////////////////////////////
 
 //! @brief Constructor.
@@ -161,7 +161,7 @@ int XC::NodalLoad::getNodeTag(void) const
 //! @brief Returns the componentes of the force vector.
 const XC::Vector &XC::NodalLoad::getForce(void) const
   {
-    static Vector retval(3);
+    static thread_local Vector retval(3);
     retval.Zero();
     if(!loadedNodePtr)
       loadedNodePtr= const_cast<NodalLoad *>(this)->get_node_ptr();
@@ -218,7 +218,7 @@ const XC::Vector &XC::NodalLoad::getForce(void) const
 //! @brief Returns the components of the moment.
 const XC::Vector &XC::NodalLoad::getMoment(void) const
   {
-    static Vector retval(3);
+    static thread_local Vector retval(3);
     retval.Zero();
     if(!loadedNodePtr)
       loadedNodePtr= const_cast<NodalLoad *>(this)->get_node_ptr();
@@ -88,7 +88,7 @@ class NodalLoad : public Load
     bool  konstant; //!< true if load is load factor independent (pushover analysis).
     // AddingSensitivity:BEGIN /////////////////////////////////////
     int parameterID;
-    static Vector gradientVector;
+    static thread_local Vector gradientVector;
     // AddingSensitivity:END ///////////////////////////////////////
 
     Node *get_node_ptr(void);
@@ -63,7 +63,7 @@
 #include "material/section/repres/CrossSectionProperties3d.h"
 #include "utility/actor/actor/MovableID.h"
 
-XC::Vector XC::Beam2dPointLoad::data(3);
+thread_local XC::Vector XC::Beam2dPointLoad::data(3);
 
 XC::Beam2dPointLoad::Beam2dPointLoad(int tag, double Pt, double dist, const XC::ID &theElementTags, double Pa)
   :BeamPointLoad(tag, LOAD_TAG_Beam2dPointLoad,Pt,dist,theElementTags,Pa) {}
@@ -104,7 +104,7 @@ XC::Vector XC::Beam2dPointLoad::getLocalMoment(void) const
 //! @brief Returns force vectors (one for each element) expressed in local coordinates.
 const XC::Matrix &XC::Beam2dPointLoad::getLocalForces(void) const
   {
-    static Matrix retval;
+    static thread_local Matrix retval;
     const size_t sz= numElements();
     retval= Matrix(sz,2);
     for(size_t i=0; i<sz; i++)
@@ -118,7 +118,7 @@ const XC::Matrix &XC::Beam2dPointLoad::getLocalForces(void) const
 //! @brief Returns moment vectors (one for each element) expressed in local coordinates.
 const XC::Matrix &XC::Beam2dPointLoad::getLocalMoments(void) const
   {
-    static Matrix retval;
+    static thread_local Matrix retval;
     const size_t sz= numElements();
     retval= Matrix(sz,1);
     for(size_t i=0; i<sz; i++)
@@ -130,7 +130,7 @@ const XC::Matrix &XC::Beam2dPointLoad::getLocalMoments(void) const
 const XC::Matrix &XC::Beam2dPointLoad::getAppliedSectionForces(const double &L,const XC::Matrix &xi,const double &loadFactor) const
   {
     const size_t nSections= xi.noCols();
-    static Matrix retval(3,nSections); //Sólo se ejecuta una vez.
+    static thread_local Matrix retval(3,nSections); //Sólo se ejecuta una vez.
     retval.resize(3,nSections);
     retval.Zero();
     const double aOverL= X();
@@ -67,7 +67,7 @@ class FVector;
 class Beam2dPointLoad: public BeamPointLoad
   {
   private:
-    static Vector data;
+    static thread_local Vector data;
   protected:
 
   public:
@@ -63,7 +63,7 @@
 #include "domain/mesh/element/utils/fvectors/FVector.h"
 #include "material/section/repres/CrossSectionProperties3d.h"
 
-XC::Vector XC::Beam2dUniformLoad::data(2);
+thread_local XC::Vector XC::Beam2dUniformLoad::data(2);
 
 XC::Beam2dUniformLoad::Beam2dUniformLoad(int tag, double wt, double wa,const XC::ID &theElementTags)
   :BeamUniformLoad(tag, LOAD_TAG_Beam2dUniformLoad,wt,wa,theElementTags) {}
@@ -105,7 +105,7 @@ XC::Vector XC::Beam2dUniformLoad::getLocalMoment(void) const
 //! @brief Returns distributed force vectors (one for each element) expressed in local coordinates.
 const XC::Matrix &XC::Beam2dUniformLoad::getLocalForces(void) const
   {
-    static Matrix retval;
+    static thread_local Matrix retval;
     const size_t sz= numElements();
     retval= Matrix(sz,2);
     for(size_t i=0; i<sz; i++)
@@ -119,7 +119,7 @@ const XC::Matrix &XC::Beam2dUniformLoad::getLocalForces(void) const
 //! @brief Returns distributed force moments (one for each element) expressed in local coordinates.
 const XC::Matrix &XC::Beam2dUniformLoad::getLocalMoments(void) const
   {
-    static Matrix retval;
+    static thread_local Matrix retval;
     const size_t sz= numElements();
     retval= Matrix(sz,1);
     for(size_t i=0; i<sz; i++)
@@ -131,7 +131,7 @@ const XC::Matrix &XC::Beam2dUniformLoad::getLocalMoments(void) const
 const XC::Matrix &XC::Beam2dUniformLoad::getAppliedSectionForces(const double &L,const Matrix &xi_pt,const double &loadFactor) const
   {
     const size_t nSections= xi_pt.noRows();
-    static Matrix retval(3,1); //Compile time definition.
+    static thread_local Matrix retval(3,1); //Compile time definition.
     retval.resize(3,nSections); //Resize.
     retval.Zero();
     const double wa= WAxial()*loadFactor;  // Axial
@@ -66,7 +66,7 @@ class FVector;
 class Beam2dUniformLoad : public BeamUniformLoad
   {
   private:
-    static Vector data;
+    static thread_local Vector data;
   public:
     Beam2dUniformLoad(int tag, double wTrans, double wAxial,const ID &theElementTags);
     Beam2dUniformLoad(int tag);
@@ -62,7 +62,7 @@
 #include "material/section/repres/CrossSectionProperties3d.h"
 #include "utility/actor/actor/MovableVector.h"
 
-XC::Vector XC::Beam3dPointLoad::data(4);
+thread_local XC::Vector XC::Beam3dPointLoad::data(4);
 
 XC::Beam3dPointLoad::Beam3dPointLoad(int tag, double py, double pz, double dist,const XC::ID &theElementTags, double px)
   :BeamPointLoad(tag, LOAD_TAG_Beam3dPointLoad,py,dist,theElementTags,px), Pz(pz) {}
@@ -104,7 +104,7 @@ XC::Vector XC::Beam3dPointLoad::getLocalMoment(void) const
 //! @brief Returns force vectors (one for each element) expressed in local coordinates.
 const XC::Matrix &XC::Beam3dPointLoad::getLocalForces(void) const
   {
-    static Matrix retval;
+    static thread_local Matrix retval;
     const size_t sz= numElements();
     retval= Matrix(sz,3);
     for(size_t i=0; i<sz; i++)
@@ -119,7 +119,7 @@ const XC::Matrix &XC::Beam3dPointLoad::getLocalForces(void) const
 //! @brief Returns moment vectors (one for each element) expressed in local coordinates.
 const XC::Matrix &XC::Beam3dPointLoad::getLocalMoments(void) const
   {
-    static Matrix retval;
+    static thread_local Matrix retval;
     const size_t sz= numElements();
     retval= Matrix(sz,3);
     for(size_t i=0; i<sz; i++)
@@ -135,7 +135,7 @@ const XC::Matrix &XC::Beam3dPointLoad::getLocalMoments(void) const
 const XC::Matrix &XC::Beam3dPointLoad::getAppliedSectionForces(const double &L,const XC::Matrix &xi,const double &loadFactor) const
   {
     const size_t nSections= xi.noCols();
-    static Matrix retval(5,nSections); //Executed once only.
+    static thread_local Matrix retval(5,nSections); //Executed once only.
     retval.resize(5,nSections);
     retval.Zero();
     const double Py= py()*loadFactor;
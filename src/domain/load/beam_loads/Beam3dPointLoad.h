@@ -68,7 +68,7 @@ class Beam3dPointLoad : public BeamPointLoad
   {
   private:
     double Pz; //!< magnitude of the transverse load
-    static Vector data;
+    static thread_local Vector data;
   protected:
     DbTagData &getDbTagData(void) const;
 
@@ -64,7 +64,7 @@
 #include "material/section/repres/CrossSectionProperties3d.h"
 #include "domain/mesh/element/Element1D.h"
 
-XC::Vector XC::Beam3dUniformLoad::data(4);
+thread_local XC::Vector XC::Beam3dUniformLoad::data(4);
 
 XC::Beam3dUniformLoad::Beam3dUniformLoad(int tag, double wY, double wZ, double wX, double tX,const XC::ID &theElementTags)
   :BeamUniformLoad(tag, LOAD_TAG_Beam3dUniformLoad,wY,wX, theElementTags), wz(wZ), tx(tX) {}
@@ -85,7 +85,7 @@ int XC::Beam3dUniformLoad::getType(void)
 const XC::Matrix &XC::Beam3dUniformLoad::getAppliedSectionForces(const double &L,const Matrix &xi_pt,const double &loadFactor) const
   {
     const size_t nSections=  xi_pt.noRows();
-    static Matrix retval(5,nSections); //Sólo se ejecuta una vez.
+    static thread_local Matrix retval(5,nSections); //Sólo se ejecuta una vez.
     retval.resize(5,nSections);
     retval.Zero();
     const double wy = Wy()*loadFactor;  // Transverse
@@ -290,7 +290,7 @@ XC::Vector XC::Beam3dUniformLoad::getLocalMoment(void) const
 //! @brief Returns distributed force vectors (one for each element) expressed in local coordinates.
 const XC::Matrix &XC::Beam3dUniformLoad::getLocalForces(void) const
   {
-    static Matrix retval;
+    static thread_local Matrix retval;
     const size_t sz= numElements();
     retval= Matrix(sz,3);
     for(size_t i=0; i<sz; i++)
@@ -305,7 +305,7 @@ const XC::Matrix &XC::Beam3dUniformLoad::getLocalForces(void) const
 //! @brief Returns distributed moment vectors (one for each element) expressed in local coordinates.
 const XC::Matrix &XC::Beam3dUniformLoad::getLocalMoments(void) const
   {
-    static Matrix retval;
+    static thread_local Matrix retval;
     const size_t sz= numElements();
     retval= Matrix(sz,3);
     for(size_t i=0; i<sz; i++)
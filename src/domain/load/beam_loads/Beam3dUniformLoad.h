@@ -68,7 +68,7 @@ class Beam3dUniformLoad: public BeamUniformLoad
   private:
     double wz;  // Transverse
     double tx;  // Torsor.
-    static Vector data;
+    static thread_local Vector data;
   protected:
     DbTagData &getDbTagData(void) const;
     int sendData(CommParameters &cp);
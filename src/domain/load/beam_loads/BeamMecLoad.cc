@@ -46,7 +46,7 @@ XC::BeamMecLoad::BeamMecLoad(int tag,int classTag)
 //! @brief Returns applied section forces due to this load (called in element's addLoad method). 
 const XC::Matrix &XC::BeamMecLoad::getAppliedSectionForces(const double &L,const Matrix &xi,const double &loadFactor) const
   {
-    static Matrix retval;
+    static thread_local Matrix retval;
     std::cerr << "getAppliedSectionForces no definida." << std::endl;
     return retval;
   }
@@ -109,7 +109,7 @@ XC::Vector XC::BeamMecLoad::getLocalMoment(void) const
 //! @brief Returns punctual/distributed force vectors (one for each element) expressed in local coordinates.
 const XC::Matrix &XC::BeamMecLoad::getLocalForces(void) const
   {
-    static Matrix retval;
+    static thread_local Matrix retval;
     const size_t sz= numElements();
     retval= Matrix(sz,2);
     for(size_t i=0; i<sz; i++)
@@ -123,7 +123,7 @@ const XC::Matrix &XC::BeamMecLoad::getLocalForces(void) const
 //! @brief Returns puntual/distributed force moments (one for each element) expressed in local coordinates.
 const XC::Matrix &XC::BeamMecLoad::getLocalMoments(void) const
   {
-    static Matrix retval;
+    static thread_local Matrix retval;
     const size_t sz= numElements();
     retval= Matrix(sz,1);
     for(size_t i=0; i<sz; i++)
@@ -133,7 +133,7 @@ const XC::Matrix &XC::BeamMecLoad::getLocalMoments(void) const
 
 const XC::Matrix &XC::BeamMecLoad::getGlobalVectors(const Matrix &localVectors) const
   {
-    static Matrix retval;
+    static thread_local Matrix retval;
     retval= localVectors;
     const Domain *ptrDom= getDomain();
     if(ptrDom)
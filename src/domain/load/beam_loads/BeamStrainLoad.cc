@@ -59,7 +59,7 @@ int XC::BeamStrainLoad::recvData(const CommParameters &cp)
 
 int XC::BeamStrainLoad::sendSelf(CommParameters &cp)
   {
-    static ID data(3);
+    static thread_local ID data(3);
     int res= sendData(cp);
     const int dataTag= getDbTag();
     res+= cp.sendIdData(getDbTagData(),dataTag);
@@ -70,7 +70,7 @@ int XC::BeamStrainLoad::sendSelf(CommParameters &cp)
 
 int XC::BeamStrainLoad::recvSelf(const CommParameters &cp)
   {
-    static ID data(3);
+    static thread_local ID data(3);
     const int dataTag= getDbTag();
     int res= cp.receiveIdData(getDbTagData(),dataTag);
     if(res<0)
@@ -48,7 +48,7 @@ XC::TrussStrainLoad::TrussStrainLoad(void)
 
 int XC::TrussStrainLoad::sendSelf(CommParameters &cp)
   {
-    static ID data(2);
+    static thread_local ID data(2);
     int res= sendData(cp);
     res+= cp.sendDoubles(e1,e2,getDbTagData(),CommMetaData(1));
     const int dataTag= getDbTag();
@@ -60,7 +60,7 @@ int XC::TrussStrainLoad::sendSelf(CommParameters &cp)
 
 int XC::TrussStrainLoad::recvSelf(const CommParameters &cp)
   {
-    static ID data(2);
+    static thread_local ID data(2);
     const int dataTag= getDbTag();
     int res= cp.receiveIdData(getDbTagData(),dataTag);
     if(res<0)
@@ -217,7 +217,7 @@ const XC::Vector &XC::InterpolatedGroundMotion::getDispVelAccel(double time) con
       }
 
     data.Zero();
-    static XC::Vector motionData(3);
+    static thread_local XC::Vector motionData(3);
 
     const int numMotions = factors->Size();
     for(int i=0; i<numMotions; i++)
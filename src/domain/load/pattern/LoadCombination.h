@@ -103,6 +103,7 @@ class LoadCombination: public ForceReprComponent
 
 
     friend class LoadCombinationGroup;
+    friend class StaticAnalysis;
     LoadCombination(LoadCombinationGroup *owr= nullptr,const std::string &nmb= "",int tag= 0,LoadHandler *ll= nullptr);
     inline void setNombre(const std::string &nmb)
       { nombre= nmb;}
@@ -111,7 +111,7 @@ int XC::PulseSeries::recvData(const CommParameters &cp)
 //! @brief Sends object through the channel being passed as parameter.
 int XC::PulseSeries::sendSelf(CommParameters &cp)
   {
-    static ID data(4);
+    static thread_local ID data(4);
     int result= sendData(cp);
 
     const int dataTag= getDbTag();
@@ -126,7 +126,7 @@ int XC::PulseSeries::sendSelf(CommParameters &cp)
 //! @brief Receives object through the channel being passed as parameter.
 int XC::PulseSeries::recvSelf(const CommParameters &cp)
   {
-    static ID data(4);
+    static thread_local ID data(4);
 
     const int dataTag = this->getDbTag();  
     int result = cp.receiveIdData(getDbTagData(),dataTag);
@@ -95,7 +95,7 @@ double XC::TriangleSeries::getFactor(double pseudoTime) const
 
 int XC::TriangleSeries::sendSelf(CommParameters &cp)
   {
-    static ID data(3);
+    static thread_local ID data(3);
     int result= sendData(cp);
 
     const int dataTag= getDbTag();
@@ -108,7 +108,7 @@ int XC::TriangleSeries::sendSelf(CommParameters &cp)
 
 int XC::TriangleSeries::recvSelf(const CommParameters &cp)
   {
-    static ID data(3);
+    static thread_local ID data(3);
 
     const int dataTag = this->getDbTag();  
     int result = cp.receiveIdData(getDbTagData(),dataTag);
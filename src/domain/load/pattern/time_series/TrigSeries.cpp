@@ -86,7 +86,7 @@ double XC::TrigSeries::getFactor(double pseudoTime) const
 
 int XC::TrigSeries::sendSelf(CommParameters &cp)
   {
-    static ID data(3);
+    static thread_local ID data(3);
     int result= sendData(cp);
 
     const int dataTag= getDbTag();
@@ -99,7 +99,7 @@ int XC::TrigSeries::sendSelf(CommParameters &cp)
 
 int XC::TrigSeries::recvSelf(const CommParameters &cp)
   {
-    static ID data(3);
+    static thread_local ID data(3);
 
     const int dataTag = this->getDbTag();  
     int result = cp.receiveIdData(getDbTagData(),dataTag);
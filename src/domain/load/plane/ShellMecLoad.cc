@@ -91,7 +91,7 @@ XC::Vector XC::ShellMecLoad::getLocalMoment(void) const
 //! @brief Returns the componentes of the force vectors.
 const XC::Matrix &XC::ShellMecLoad::getLocalForces(void) const
   {
-    static Matrix retval;
+    static thread_local Matrix retval;
     const size_t sz= numElements();
     retval= Matrix(sz,3);
     for(size_t i=0; i<sz; i++)
@@ -106,7 +106,7 @@ const XC::Matrix &XC::ShellMecLoad::getLocalForces(void) const
 //! @brief Returns the components of the vector moments.
 const XC::Matrix &XC::ShellMecLoad::getLocalMoments(void) const
   {
-    static Matrix retval;
+    static thread_local Matrix retval;
     const size_t sz= numElements();
     retval= Matrix(sz,3);
     for(size_t i=0; i<sz; i++)
@@ -121,7 +121,7 @@ const XC::Matrix &XC::ShellMecLoad::getLocalMoments(void) const
 //! @brief Returns the vectors expressed in global coordinates.
 const XC::Matrix &XC::ShellMecLoad::getGlobalVectors(const Matrix &localVectors) const
   {
-    static Matrix retval;
+    static thread_local Matrix retval;
     retval= localVectors;
     const Domain *ptrDom= getDomain();
     if(ptrDom)
@@ -64,7 +64,7 @@ size_t XC::ShellUniformLoad::getMomentVectorDimension(void) const
 //! @brief Returns the components of the force vectors.
 const XC::Matrix &XC::ShellUniformLoad::getLocalForces(void) const
   {
-    static Matrix retval;
+    static thread_local Matrix retval;
     const size_t sz= numElements();
     retval= Matrix(sz,3);
     for(size_t i=0; i<sz; i++)
@@ -79,7 +79,7 @@ const XC::Matrix &XC::ShellUniformLoad::getLocalForces(void) const
 //! @brief Returns the components of the moment vectors.
 const XC::Matrix &XC::ShellUniformLoad::getLocalMoments(void) const
   {
-    static Matrix retval;
+    static thread_local Matrix retval;
     const size_t sz= numElements();
     retval= Matrix(sz,3);
     for(size_t i=0; i<sz; i++)
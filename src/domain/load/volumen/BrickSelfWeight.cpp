@@ -60,7 +60,7 @@
 #include <utility/matrix/Vector.h>
 #include "utility/matrix/ID.h"
 
-XC::Vector XC::BrickSelfWeight::data(1);
+thread_local XC::Vector XC::BrickSelfWeight::data(1);
 
 XC::BrickSelfWeight::BrickSelfWeight(int tag, const XC::ID &theElementTags)
   :ElementBodyLoad(tag, LOAD_TAG_BrickSelfWeight, theElementTags) {}
@@ -92,7 +92,7 @@ int XC::BrickSelfWeight::recvData(const CommParameters &cp)
 
 int XC::BrickSelfWeight::sendSelf(CommParameters &cp)
   {
-    static ID data(5);
+    static thread_local ID data(5);
     int result= sendData(cp);
     
     const int dataTag= getDbTag();
@@ -104,7 +104,7 @@ int XC::BrickSelfWeight::sendSelf(CommParameters &cp)
 
 int XC::BrickSelfWeight::recvSelf(const CommParameters &cp)
   {
-    static ID data(5);
+    static thread_local ID data(5);
     const int dataTag= getDbTag();
     int res= cp.receiveIdData(getDbTagData(),dataTag);
     if(res<0)
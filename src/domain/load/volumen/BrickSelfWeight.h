@@ -41,7 +41,7 @@ namespace XC {
 class BrickSelfWeight: public ElementBodyLoad
   {
   private:
-    static Vector data;
+    static thread_local Vector data;
   protected:
     int sendData(CommParameters &cp);
     int recvData(const CommParameters &cp);
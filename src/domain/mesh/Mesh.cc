@@ -42,6 +42,7 @@
 
 #include <utility/tagged/storage/MapOfTaggedObjects.h>
 #include <utility/tagged/storage/MapOfTaggedObjectsIter.h>
+#include <utility/tagged/storage/VectorOfTaggedObjects.h>
 
 #include <solution/graph/graph/Vertex.h>
 #include <utility/actor/objectBroker/FEM_ObjectBroker.h>
@@ -50,6 +51,8 @@
 #include "domain/mesh/element/utils/NodePtrsWithIDs.h"
 #include <climits>
 #include "xc_utils/src/geom/pos_vec/Pos3d.h"
+#include "preprocessor/set_mgmt/DqPtrsNode.h"
+#include "preprocessor/set_mgmt/DqPtrsElem.h"
 
 #include "utility/actor/actor/MovableVector.h"
 
@@ -84,6 +87,109 @@ void XC::Mesh::alloc_containers(void)
     theElements= new MapOfTaggedObjects(this,"element");
   }
 
+//! @brief Creates a container for the components of the mesh.
+//!
+//! @param mode: "map" (std::map indexed by tag) or "vector" (dense vector
+//!              with a tag to position hash table).
+//! @param containerName: name of the container.
+XC::TaggedObjectStorage *XC::Mesh::new_container(const std::string &mode,const std::string &containerName)
+  {
+    TaggedObjectStorage *retval= nullptr;
+    if(mode=="map")
+      retval= new MapOfTaggedObjects(this,containerName);
+    else if(mode=="vector")
+      retval= new VectorOfTaggedObjects(this,containerName);
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+	        << "; unknown storage mode: '" << mode
+                << "' (must be 'map' or 'vector').\n";
+    return retval;
+  }
+
+//! @brief Moves the components from one container to another.
+void XC::Mesh::move_components(TaggedObjectStorage &from,TaggedObjectStorage &to)
+  {
+    to.setSize(from.getNumComponents());
+    TaggedObject *ptr= nullptr;
+    TaggedObjectIter &theIter= from.getComponents();
+    while((ptr= theIter()) != nullptr)
+      to.addComponent(ptr);
+    from.clearAll(false); //Don't delete the components.
+  }
+
+//! @brief Marks the domain as changed if the iteration order
+//! of a non-empty mesh has changed (the analysis model
+//! must be rebuilt).
+void XC::Mesh::component_order_changed(void)
+  {
+    if(getNumNodes()>0 || getNumElements()>0)
+      {
+        Domain *dom= getDomain();
+        if(dom)
+          dom->domainChange();
+      }
+  }
+
+//! @brief Returns the storage mode of nodes and elements
+//! ("map" or "vector").
+std::string XC::Mesh::getStorageMode(void) const
+  {
+    std::string retval= "map";
+    if(dynamic_cast<const VectorOfTaggedObjects *>(theNodes))
+      retval= "vector";
+    return retval;
+  }
+
+//! @brief Sets the storage mode of nodes and elements.
+//!
+//! The "vector" mode stores the components in a dense vector (iterated
+//! in insertion order) with a hash table to find them by its tag,
+//! while the "map" mode (default) uses a std::map (iterated in tag
+//! order). The components already in the mesh are moved to the new
+//! containers.
+//!
+//! @param mode: "map" or "vector".
+void XC::Mesh::setStorageMode(const std::string &mode)
+  {
+    if(mode!=getStorageMode())
+      {
+        TaggedObjectStorage *newNodes= new_container(mode,"node");
+        TaggedObjectStorage *newElements= new_container(mode,"element");
+        if(newNodes && newElements)
+          {
+            move_components(*theNodes,*newNodes);
+            move_components(*theElements,*newElements);
+            if(theEleIter) delete theEleIter;
+            if(theElements) delete theElements;
+            if(theNodIter) delete theNodIter;
+            if(theNodes) delete theNodes;
+            theNodes= newNodes;
+            theElements= newElements;
+            alloc_iters();
+            component_order_changed();
+          }
+        else
+          {
+            if(newNodes) delete newNodes;
+            if(newElements) delete newElements;
+          }
+      }
+  }
+
+//! @brief Sorts nodes and elements by its tag (only
+//! for the "vector" storage mode, see setStorageMode).
+void XC::Mesh::sortComponentsByTag(void)
+  {
+    VectorOfTaggedObjects *vNodes= dynamic_cast<VectorOfTaggedObjects *>(theNodes);
+    VectorOfTaggedObjects *vElements= dynamic_cast<VectorOfTaggedObjects *>(theElements);
+    if(vNodes && vElements)
+      {
+        vNodes->sortByTag();
+        vElements->sortByTag();
+        component_order_changed();
+      }
+  }
+
 //! @brief Allocates memory for iterators.
 void XC::Mesh::alloc_iters(void)
   {
@@ -113,7 +219,7 @@ void XC::Mesh::init_bounds(void)
 //! @brief Constructor.
 XC::Mesh::Mesh(EntCmd *owr)
   :MeshComponentContainer(owr,DOMAIN_TAG_Mesh), eleGraphBuiltFlag(false), nodeGraphBuiltFlag(false),
-   theBounds(6), lockers(this)
+   theBounds(6), lockers(this), nodeStatePoolFlag(false)
   {
     alloc_containers();
     alloc_iters();
@@ -125,7 +231,7 @@ XC::Mesh::Mesh(EntCmd *owr)
 //! @brief Constructor.
 XC::Mesh::Mesh(EntCmd *owr,TaggedObjectStorage &theNodesStorage,TaggedObjectStorage &theElementsStorage)
   : MeshComponentContainer(owr,DOMAIN_TAG_Mesh), eleGraphBuiltFlag(false),
-    nodeGraphBuiltFlag(false), theNodes(&theNodesStorage), theElements(&theElementsStorage), theBounds(6), lockers(this)
+    nodeGraphBuiltFlag(false), theNodes(&theNodesStorage), theElements(&theElementsStorage), theBounds(6), lockers(this), nodeStatePoolFlag(false)
   {
     // init the iters
     alloc_iters();
@@ -144,7 +250,7 @@ XC::Mesh::Mesh(EntCmd *owr,TaggedObjectStorage &theNodesStorage,TaggedObjectStor
 XC::Mesh::Mesh(EntCmd *owr,TaggedObjectStorage &theStorage)
   : MeshComponentContainer(owr,DOMAIN_TAG_Mesh),
     eleGraphBuiltFlag(false), nodeGraphBuiltFlag(false),
-    theBounds(6), lockers(this)
+    theBounds(6), lockers(this), nodeStatePoolFlag(false)
   {
     // init the arrays for storing the mesh components
     theStorage.clearAll(); // clear the storage just in case populated
@@ -166,9 +272,12 @@ XC::Mesh::Mesh(EntCmd *owr,TaggedObjectStorage &theStorage)
 //!  casting a XC::MeshComponent from theElements to an XC::Element is o.k.
 void XC::Mesh::clearAll(void)
   {
+    nodeStatePool.clear();
     // clean out the containers
     if(theElements) theElements->clearAll();
     if(theNodes) theNodes->clearAll();
+    kdtreeElements.clear();
+    kdtreeNodes.clear();
     lockers.clearAll();
 
     // set the bounds around the origin
@@ -333,7 +442,10 @@ bool XC::Mesh::addNode(Node * node)
       }
     bool result= theNodes->addComponent(node);
     if(result)
-      add_node_to_domain(node);
+      {
+        nodeStatePool.clear(); // rebuilt on next commit.
+        add_node_to_domain(node);
+      }
     else
       std::cerr << getClassName() << "::" << __FUNCTION__
 	        << "; node with tag " << nodTag
@@ -354,16 +466,16 @@ bool XC::Mesh::addNode(Node * node)
 //! domainChange()} on itself before a pointer to the element is returned. 
 bool XC::Mesh::removeElement(int tag)
   {
+    // remove the element from the spatial index before deleting it.
+    const Element *elem= getElement(tag);
+    if(elem) kdtreeElements.erase(*elem);
+
     // remove the object from the container
     bool res= theElements->removeComponent(tag);
     
     if(res)
       {
         Domain *dom= getDomain();
-
-        Element *elem= dom->getElement(tag);
-        if(elem) kdtreeElements.erase(*elem);
-
         dom->domainChange(); //mark the domain as having changed
       }
     return res;
@@ -379,6 +491,12 @@ bool XC::Mesh::removeElement(int tag)
 //! domainChange()} on itself before a pointer to the Node is returned. 
 bool XC::Mesh::removeNode(int tag)
   {
+    if(theNodes->getComponentPtr(tag))
+      nodeStatePool.clear(); // rebuilt on next commit.
+
+    // remove the node from the spatial index before deleting it.
+    const Node *nod= getNode(tag);
+    if(nod) kdtreeNodes.erase(*nod);
 
     // remove the object from the container
     bool res= theNodes->removeComponent(tag);
@@ -386,10 +504,6 @@ bool XC::Mesh::removeNode(int tag)
     if(res)
       {
         Domain *dom= getDomain();
-
-        Node *nod= dom->getNode(tag);
-        if(nod) kdtreeNodes.erase(*nod);
-
         // mark the domain has having changed
         dom->domainChange();
       }
@@ -502,6 +616,65 @@ const XC::Node *XC::Mesh::getNearestNode(const Pos3d &p) const
     return this_no_const->getNearestNode(p);
   }
 
+//! @brief Returns the k nodes closest to the point (sorted by
+//! increasing distance).
+XC::DqPtrsNode XC::Mesh::getNearestNodes(const Pos3d &p,const size_t &k)
+  { return DqPtrsNode(kdtreeNodes.getKNearest(p,k)); }
+
+//! @brief Returns the nodes at a distance not greater than r
+//! from the point.
+XC::DqPtrsNode XC::Mesh::pickNodesWithinRadius(const Pos3d &p,const double &r)
+  { return DqPtrsNode(kdtreeNodes.getWithinRadius(p,r)); }
+
+//! @brief Returns the nodes inside the box defined by its corners.
+XC::DqPtrsNode XC::Mesh::pickNodesInsideBox(const Pos3d &pMin,const Pos3d &pMax)
+  { return DqPtrsNode(kdtreeNodes.getInsideBox(pMin,pMax)); }
+
+//! @brief Returns the nodes in the half space bounded by the plane
+//! that passes through org with outward normal n.
+XC::DqPtrsNode XC::Mesh::pickNodesInsideHalfSpace(const Pos3d &org,const Vector3d &n,const double &tol)
+  { return DqPtrsNode(kdtreeNodes.getInsideHalfSpace(org,n,tol)); }
+
+//! @brief Returns the nodes inside the geometric object.
+XC::DqPtrsNode XC::Mesh::pickNodesInside(const GeomObj3d &geomObj,const double &tol)
+  { return DqPtrsNode(kdtreeNodes.getInside(geomObj,tol)); }
+
+//! @brief Returns the nodes inside the prism obtained by extruding
+//! the 2D object (defined on the XY plane) between zMin and zMax.
+XC::DqPtrsNode XC::Mesh::pickNodesInsidePrism(const GeomObj2d &geomObj,const double &zMin,const double &zMax,const double &tol)
+  { return DqPtrsNode(kdtreeNodes.getInsidePrism(geomObj,zMin,zMax,tol)); }
+
+//! @brief Returns the k elements whose centroids are closest to
+//! the point (sorted by increasing distance).
+XC::DqPtrsElem XC::Mesh::getNearestElements(const Pos3d &p,const size_t &k)
+  { return DqPtrsElem(kdtreeElements.getKNearest(p,k)); }
+
+//! @brief Returns the elements whose centroids are at a distance
+//! not greater than r from the point.
+XC::DqPtrsElem XC::Mesh::pickElemsWithinRadius(const Pos3d &p,const double &r)
+  { return DqPtrsElem(kdtreeElements.getWithinRadius(p,r)); }
+
+//! @brief Returns the elements whose nodes lie inside the box
+//! defined by its corners.
+XC::DqPtrsElem XC::Mesh::pickElemsInsideBox(const Pos3d &pMin,const Pos3d &pMax)
+  { return DqPtrsElem(kdtreeElements.getInsideBox(pMin,pMax)); }
+
+//! @brief Returns the elements whose nodes lie in the half space
+//! bounded by the plane that passes through org with outward normal n.
+XC::DqPtrsElem XC::Mesh::pickElemsInsideHalfSpace(const Pos3d &org,const Vector3d &n,const double &tol)
+  { return DqPtrsElem(kdtreeElements.getInsideHalfSpace(org,n,tol)); }
+
+//! @brief Returns the elements whose nodes lie inside the
+//! geometric object.
+XC::DqPtrsElem XC::Mesh::pickElemsInside(const GeomObj3d &geomObj,const double &tol)
+  { return DqPtrsElem(kdtreeElements.getInside(geomObj,tol)); }
+
+//! @brief Returns the elements whose nodes lie inside the prism
+//! obtained by extruding the 2D object (defined on the XY plane)
+//! between zMin and zMax.
+XC::DqPtrsElem XC::Mesh::pickElemsInsidePrism(const GeomObj2d &geomObj,const double &zMin,const double &zMax,const double &tol)
+  { return DqPtrsElem(kdtreeElements.getInsidePrism(geomObj,zMin,zMax,tol)); }
+
 //! @brief Freezes inactive nodes (prescribes zero displacement for all DOFs
 //! on inactive nodes).
 void XC::Mesh::freeze_dead_nodes(const std::string &nmbLocker)
@@ -771,10 +944,15 @@ int XC::Mesh::setRayleighDampingFactors(const RayleighDampingFactors &rF)
 int XC::Mesh::commit(void)
   {
     // invoke commit on all nodes and elements in the mesh
-    Node *nodePtr= nullptr;
-    NodeIter &theNodeIter = this->getNodes();
-    while((nodePtr = theNodeIter()) != 0)
-      { nodePtr->commitState(); }
+    if(update_node_state_pool())
+      nodeStatePool.commit();
+    else
+      {
+        Node *nodePtr= nullptr;
+        NodeIter &theNodeIter = this->getNodes();
+        while((nodePtr = theNodeIter()) != 0)
+          { nodePtr->commitState(); }
+      }
 
     Element *elePtr= nullptr;
     ElementIter &theElemIter = this->getElements();
@@ -784,6 +962,30 @@ int XC::Mesh::commit(void)
     return 0;
   }
 
+//! @brief Stores the state (displacements, velocities and
+//! accelerations) of all the nodes in contiguous arrays, so
+//! commit and revertToLastCommit operate on the whole mesh
+//! with bulk copies.
+void XC::Mesh::setUseNodeStatePool(const bool &b)
+  {
+    nodeStatePoolFlag= b;
+    if(nodeStatePoolFlag)
+      update_node_state_pool();
+    else
+      nodeStatePool.clear();
+  }
+
+//! @brief Builds the node state pool if it's needed and
+//! returns true if it's active.
+bool XC::Mesh::update_node_state_pool(void)
+  {
+    if(!nodeStatePoolFlag)
+      return false;
+    if(nodeStatePool.empty() && (getNumNodes()>0))
+      nodeStatePool.build(getNodes());
+    return !nodeStatePool.empty();
+  }
+
 //! @brief Returns the mesh to its last commited state.
 int XC::Mesh::revertToLastCommit(void)
   {
@@ -791,10 +993,18 @@ int XC::Mesh::revertToLastCommit(void)
     // first invoke revertToLastCommit  on all nodes and elements in the mesh
     //
 
+    const bool bulk= update_node_state_pool();
+    if(bulk)
+      nodeStatePool.revertToLastCommit();
     Node *nodePtr;
     NodeIter &theNodeIter = this->getNodes();
     while((nodePtr = theNodeIter()) != 0)
-      nodePtr->revertToLastCommit();
+      {
+        if(bulk)
+          nodePtr->zeroReaction();
+        else
+          nodePtr->revertToLastCommit();
+      }
 
     Element *elePtr;
     ElementIter &theElemIter = this->getElements();
@@ -34,13 +34,19 @@
 #include "NodeLockers.h"
 #include "solution/graph/graph/Graph.h"
 #include "node/KDTreeNodes.h"
+#include "node/NodeStatePool.h"
 #include "element/utils/KDTreeElements.h"
 
 class Pos3d;
+class Vector3d;
+class GeomObj3d;
+class GeomObj2d;
 
 namespace XC {
 class Element;
 class Node;
+class DqPtrsNode;
+class DqPtrsElem;
 
 class ElementIter;
 class NodeIter;
@@ -78,14 +84,19 @@ class Mesh: public MeshComponentContainer
 
     TaggedObjectStorage *theElements;
     SingleDomEleIter *theEleIter;
-    KDTreeElements kdtreeElements; //!< space-partitioning data structure for organizing nodes. Search finite element by its position (x,y,x).
+    KDTreeElements kdtreeElements; //!< space-partitioning data structure for organizing elements. Search finite element by its position (x,y,x).
 
     Vector theBounds;
     int tagNodeCheckReactionException;//!< Exception for checking reactions (see Domain::checkNodalReactions).
 
     NodeLockers lockers; //!< To block deactivated (dead) nodes.
+    bool nodeStatePoolFlag; //!< if true store the node state in nodeStatePool.
+    NodeStatePool nodeStatePool; //!< Contiguous storage for the node state (commit/revert in bulk).
 
     void alloc_containers(void);
+    TaggedObjectStorage *new_container(const std::string &,const std::string &);
+    static void move_components(TaggedObjectStorage &,TaggedObjectStorage &);
+    void component_order_changed(void);
     void alloc_iters(void);
     bool check_containers(void) const;
     void init_bounds(void);
@@ -94,6 +105,7 @@ class Mesh: public MeshComponentContainer
     void add_element_to_domain(Element *);
     void add_nodes_to_domain(void);
     void add_elements_to_domain(void);
+    bool update_node_state_pool(void);
 
     Mesh(const Mesh &otra);
     Mesh &operator=(const Mesh &otra);
@@ -117,6 +129,10 @@ class Mesh: public MeshComponentContainer
 
     virtual void clearAll(void);
 
+    std::string getStorageMode(void) const;
+    void setStorageMode(const std::string &);
+    void sortComponentsByTag(void);
+
     void setNodeReactionException(const int &);
     void checkNodalReactions(const double &);
 
@@ -154,6 +170,20 @@ class Mesh: public MeshComponentContainer
     Node *getNearestNode(const Pos3d &p);
     const Node *getNearestNode(const Pos3d &p) const;
 
+    // spatial queries
+    DqPtrsNode getNearestNodes(const Pos3d &,const size_t &);
+    DqPtrsNode pickNodesWithinRadius(const Pos3d &,const double &);
+    DqPtrsNode pickNodesInsideBox(const Pos3d &,const Pos3d &);
+    DqPtrsNode pickNodesInsideHalfSpace(const Pos3d &,const Vector3d &,const double &tol= 0.0);
+    DqPtrsNode pickNodesInside(const GeomObj3d &,const double &tol= 0.0);
+    DqPtrsNode pickNodesInsidePrism(const GeomObj2d &,const double &,const double &,const double &tol= 0.0);
+    DqPtrsElem getNearestElements(const Pos3d &,const size_t &);
+    DqPtrsElem pickElemsWithinRadius(const Pos3d &,const double &);
+    DqPtrsElem pickElemsInsideBox(const Pos3d &,const Pos3d &);
+    DqPtrsElem pickElemsInsideHalfSpace(const Pos3d &,const Vector3d &,const double &tol= 0.0);
+    DqPtrsElem pickElemsInside(const GeomObj3d &,const double &tol= 0.0);
+    DqPtrsElem pickElemsInsidePrism(const GeomObj2d &,const double &,const double &,const double &tol= 0.0);
+
     // methods to query the state of the mesh
     virtual int getNumElements(void) const;
     virtual int getNumNodes(void) const;
@@ -177,6 +207,17 @@ class Mesh: public MeshComponentContainer
     virtual Graph &getElementGraph(void);
     virtual Graph &getNodeGraph(void);
 
+    void setUseNodeStatePool(const bool &);
+    //! @brief Returns true if the node state is stored in a NodeStatePool.
+    inline bool getUseNodeStatePool(void) const
+      { return nodeStatePoolFlag; }
+    //! @brief Returns the number of threads used to commit/revert the node state pool.
+    inline size_t getNodeStatePoolNumThreads(void) const
+      { return nodeStatePool.getNumThreads(); }
+    //! @brief Sets the number of threads used to commit/revert the node state pool.
+    inline void setNodeStatePoolNumThreads(const size_t &n)
+      { nodeStatePool.setNumThreads(n); }
+
     virtual int commit(void);
     virtual int revertToLastCommit(void);
     virtual int revertToStart(void);
@@ -73,7 +73,7 @@ XC::MeshComponent::MeshComponent(int tag, int classTag)
 int XC::MeshComponent::sendIdsEtiquetas(int posDbTag,CommParameters &cp)
   {
     int res= 0;
-    static ID etiqIds;
+    static thread_local ID etiqIds;
     const std::set<int> ids= labels.getIdsEtiquetas();
     const size_t sz= ids.size();
     if(sz>0)
@@ -93,7 +93,7 @@ int XC::MeshComponent::sendIdsEtiquetas(int posDbTag,CommParameters &cp)
 int XC::MeshComponent::recvIdsEtiquetas(int posDbTag,const CommParameters &cp)
   {
     int res= 0;
-    static ID etiqIds;
+    static thread_local ID etiqIds;
     if(getDbTagDataPos(posDbTag)!= 0)
       {
         const DiccionarioEtiquetas &dic= labels.getDiccionario();
@@ -324,7 +324,7 @@ const XC::Vector &XC::Element::getResistingForceIncInertia(void) const
 //! node.
 const XC::Vector &XC::Element::getNodeResistingComponents(const size_t &iNod,const Vector &rf) const
   {
-    static Vector retval;
+    static thread_local Vector retval;
     const int ndof= getNodePtrs()[iNod]->getNumberDOF(); // number of DOFs in the node.
     retval.resize(ndof);
     for(int i=0;i<ndof;i++)
@@ -478,19 +478,19 @@ int XC::Element::activateParameter(int parameterID)
 
 const XC::Vector &XC::Element::getResistingForceSensitivity(int gradNumber)
   {
-    static XC::Vector dummy(1);
+    static thread_local XC::Vector dummy(1);
     return dummy;
   }
 
 const XC::Matrix &XC::Element::getInitialStiffSensitivity(int gradNumber)
   {
-    static XC::Matrix dummy(1,1);
+    static thread_local XC::Matrix dummy(1,1);
     return dummy;
   }
 
 const XC::Matrix &XC::Element::getMassSensitivity(int gradNumber)
   {
-    static XC::Matrix dummy(1,1);
+    static thread_local XC::Matrix dummy(1,1);
     return dummy;
   }
 
@@ -1041,7 +1041,7 @@ Pos3d XC::Element::getPosCdg(bool initialGeometry) const
   {
     std::cerr << getClassName() << "::" << __FUNCTION__
               << " is not implemented." << std::endl;
-    static Pos3d retval;
+    static thread_local Pos3d retval;
     return retval;
   }
 
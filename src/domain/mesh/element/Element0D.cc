@@ -143,7 +143,7 @@ int XC::Element0D::getNumDOF(void) const
 //! @brief Returns the direction vector of local X axis (first row of the transformation).
 const XC::Vector &XC::Element0D::getX(void) const
   {
-    static Vector retval(3);
+    static thread_local Vector retval(3);
     retval(0)= transformation(0,0);
     retval(1)= transformation(0,1);
     retval(2)= transformation(0,2);
@@ -153,7 +153,7 @@ const XC::Vector &XC::Element0D::getX(void) const
 //! @brief Returns the direction vector of local Y axis (second row of the transformation).
 const XC::Vector &XC::Element0D::getY(void) const
   {
-    static Vector retval(3);
+    static thread_local Vector retval(3);
     retval(0)= transformation(1,0);
     retval(1)= transformation(1,1);
     retval(2)= transformation(1,2);
@@ -163,7 +163,7 @@ const XC::Vector &XC::Element0D::getY(void) const
 //! @brief Returns the direction vector of local Z axis (third row of the transformation).
 const XC::Vector &XC::Element0D::getZ(void) const
   {
-    static Vector retval(3);
+    static thread_local Vector retval(3);
     retval(0)= transformation(2,0);
     retval(1)= transformation(2,1);
     retval(2)= transformation(2,2);
@@ -206,13 +206,13 @@ void XC::Element0D::setUpVectors(const Vector &x, const Vector &yp)
 			
     // establish orientation of element for the transformation matrix
     // z = x cross yp
-    static Vector z(3);
+    static thread_local Vector z(3);
     z(0)= x(1)*yp(2) - x(2)*yp(1);
     z(1)= x(2)*yp(0) - x(0)*yp(2);
     z(2)= x(0)*yp(1) - x(1)*yp(0);
 
     // y = z cross x
-    static Vector y(3);
+    static thread_local Vector y(3);
     y(0)= z(1)*x(2) - z(2)*x(1);
     y(1)= z(2)*x(0) - z(0)*x(2);
     y(2)= z(0)*x(1) - z(1)*x(0);
@@ -73,7 +73,7 @@ void XC::Element1D::vector2dUniformLoadLocal(const Vector &v)
   {
     Preprocessor *preprocessor= getPreprocessor();
     MapLoadPatterns &casos= preprocessor->getLoadHandler().getLoadPatterns();
-    static ID eTags(1);
+    static thread_local ID eTags(1);
     eTags[0]= getTag(); //Load for this element.
     const int &loadTag= casos.getCurrentElementLoadTag(); //Load identifier.
 
@@ -124,7 +124,7 @@ void XC::Element1D::vector2dPointByRelDistLoadLocal(const double &x,const Vector
       {
         Preprocessor *preprocessor= getPreprocessor();
         MapLoadPatterns &casos= preprocessor->getLoadHandler().getLoadPatterns();
-        static ID eTags(1);
+        static thread_local ID eTags(1);
         eTags[0]= getTag(); //Load for this element.
         const int &loadTag= casos.getCurrentElementLoadTag(); //Load identifier.
 
@@ -196,7 +196,7 @@ void XC::Element1D::vector3dUniformLoadLocal(const Vector &v)
       {
         Preprocessor *preprocessor= getPreprocessor();
         MapLoadPatterns &casos= preprocessor->getLoadHandler().getLoadPatterns();
-        static ID eTags(1);
+        static thread_local ID eTags(1);
         eTags[0]= getTag(); //Load for this element.
         const int &loadTag= casos.getCurrentElementLoadTag(); //Load identifier.
 
@@ -240,7 +240,7 @@ void XC::Element1D::vector3dPointByRelDistLoadLocal(const double &x,const Vector
       {
         Preprocessor *preprocessor= getPreprocessor();
         MapLoadPatterns &casos= preprocessor->getLoadHandler().getLoadPatterns();
-        static ID eTags(1);
+        static thread_local ID eTags(1);
         eTags[0]= getTag(); //Load for this element.
         const int &loadTag= casos.getCurrentElementLoadTag(); //Load identifier.
 
@@ -291,7 +291,7 @@ void XC::Element1D::strainLoad(const DeformationPlane &p1,const DeformationPlane
   {
     Preprocessor *preprocessor= getPreprocessor();
     MapLoadPatterns &casos= preprocessor->getLoadHandler().getLoadPatterns();
-    static ID eTags(1);
+    static thread_local ID eTags(1);
     eTags[0]= getTag(); //Load for this element.
     const int &loadTag= casos.getCurrentElementLoadTag(); //Load identifier.
 
@@ -511,7 +511,7 @@ const XC::CrdTransf *XC::Element1D::checkCoordTransf(void) const
 //! [[x1,y1,z1],[x2,y2,z2],...·]
 XC::Matrix XC::Element1D::getLocalAxes(bool initialGeometry) const
   {
-    static Matrix retval;
+    static thread_local Matrix retval;
     const CrdTransf *crdTransf= getCoordTransf();
     if(crdTransf)
       retval= crdTransf->getLocalAxes(initialGeometry);
@@ -537,7 +537,7 @@ XC::Matrix XC::Element1D::getLocalAxes(bool initialGeometry) const
 //! @brief Return points distributed between the nodes as a matrix with the coordinates as rows.
 const XC::Matrix &XC::Element1D::getCooPoints(const size_t &ndiv) const
   {
-    static Matrix retval;
+    static thread_local Matrix retval;
     const CrdTransf *tmp= getCoordTransf();
     if(tmp)
       retval= tmp->getCooPoints(ndiv);
@@ -562,7 +562,7 @@ const XC::Matrix &XC::Element1D::getCooPoints(const size_t &ndiv) const
 //! @brief Return the point that correspond to the relative coordinate 0<=xrel<=1.
 const XC::Vector &XC::Element1D::getCooPoint(const double &xrel) const
   {
-    static Vector retval;
+    static thread_local Vector retval;
     const CrdTransf *tmp= getCoordTransf();
     if(tmp)
       retval= tmp->getCooPoint(xrel);
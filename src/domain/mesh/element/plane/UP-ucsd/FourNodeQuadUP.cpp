@@ -52,13 +52,13 @@
 #include <utility/recorder/response/ElementResponse.h>
 #include "domain/component/Parameter.h"
 
- XC::Matrix XC::FourNodeQuadUP::K(12,12);
- XC::Vector XC::FourNodeQuadUP::P(12);
-double XC::FourNodeQuadUP::shp[3][4][4];
+thread_local XC::Matrix XC::FourNodeQuadUP::K(12,12);
+thread_local XC::Vector XC::FourNodeQuadUP::P(12);
+thread_local double XC::FourNodeQuadUP::shp[3][4][4];
 double XC::FourNodeQuadUP::pts[4][2];
 double XC::FourNodeQuadUP::wts[4];
-double XC::FourNodeQuadUP::dvol[4];
-double XC::FourNodeQuadUP::shpBar[3][4];
+thread_local double XC::FourNodeQuadUP::dvol[4];
+thread_local double XC::FourNodeQuadUP::shpBar[3][4];
 
 XC::FourNodeQuadUP::FourNodeQuadUP(int tag, int nd1, int nd2, int nd3, int nd4,
                                    NDMaterial &m, const std::string &type, double t, double bulk, double r,
@@ -152,7 +152,7 @@ int XC::FourNodeQuadUP::update(void)
         const Vector &disp3 = nd3Ptr()->getTrialDisp();
         const Vector &disp4 = nd4Ptr()->getTrialDisp();
 
-        static double u[2][4];
+        static thread_local double u[2][4];
 
         u[0][0] = disp1(0);
         u[1][0] = disp1(1);
@@ -163,7 +163,7 @@ int XC::FourNodeQuadUP::update(void)
         u[0][3] = disp4(0);
         u[1][3] = disp4(1);
 
-        static Vector eps(3);
+        static thread_local Vector eps(3);
 
         int ret = 0;
 
@@ -290,7 +290,7 @@ const XC::Matrix &XC::FourNodeQuadUP::getInitialStiff(void) const
 
 const XC::Matrix &XC::FourNodeQuadUP::getDamp(void) const
 {
-  static XC::Matrix Kdamp(12,12);
+  static thread_local XC::Matrix Kdamp(12,12);
   Kdamp.Zero();
 
   if(rayFactors.getBetaK() != 0.0)
@@ -531,7 +531,7 @@ const XC::Vector &XC::FourNodeQuadUP::getResistingForceIncInertia(void) const
     const Vector &accel3 = nd3Ptr()->getTrialAccel();
     const Vector &accel4 = nd4Ptr()->getTrialAccel();
 
-    static double a[12];
+    static thread_local double a[12];
 
     a[0] = accel1(0);
     a[1] = accel1(1);
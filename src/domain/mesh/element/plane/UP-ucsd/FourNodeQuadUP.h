@@ -61,8 +61,8 @@ class FourNodeQuadUP : public QuadBase4N<SolidMech2D>
   {
   private:
 
-    static Matrix K; //!< Element stiffness, damping, and mass Matrix
-    static Vector P; //!< Element resisting force vector
+    static thread_local Matrix K; //!< Element stiffness, damping, and mass Matrix
+    static thread_local Vector P; //!< Element resisting force vector
     BodyForces2D bf; //!< Body forces
     Vector pressureLoad; //!< Pressure load at nodes
 
@@ -71,11 +71,11 @@ class FourNodeQuadUP : public QuadBase4N<SolidMech2D>
     double pressure; //!< Normal surface traction (pressure) over entire element (note: positive for outward normal).
     double perm[2]; //!< lateral/vertical permeability
 
-    static double shp[3][4][4];	//!< Stores shape functions and derivatives (overwritten)
+    static thread_local double shp[3][4][4];	//!< Stores shape functions and derivatives (overwritten)
     static double pts[4][2]; //!< Stores quadrature points
     static double wts[4]; //!< Stores quadrature weights
-    static double dvol[4];  //!< Stores detJacobian (overwritten)
-    static double shpBar[3][4]; //!< Stores averaged shap functions (overwritten)
+    static thread_local double dvol[4];  //!< Stores detJacobian (overwritten)
+    static thread_local double shpBar[3][4]; //!< Stores averaged shap functions (overwritten)
 
     Node *nd1Ptr(void);
     const Node *nd1Ptr(void) const;
@@ -54,19 +54,19 @@
 #include "domain/component/Parameter.h"
 #include "utility/actor/actor/MatrixCommMetaData.h"
 
-XC::Matrix XC::NineFourNodeQuadUP::K(22,22);
-XC::Vector XC::NineFourNodeQuadUP::P(22);
-double XC::NineFourNodeQuadUP::shgu[3][9][9];
-double XC::NineFourNodeQuadUP::shgp[3][4][4];
-double XC::NineFourNodeQuadUP::shgq[3][9][4];
+thread_local XC::Matrix XC::NineFourNodeQuadUP::K(22,22);
+thread_local XC::Vector XC::NineFourNodeQuadUP::P(22);
+thread_local double XC::NineFourNodeQuadUP::shgu[3][9][9];
+thread_local double XC::NineFourNodeQuadUP::shgp[3][4][4];
+thread_local double XC::NineFourNodeQuadUP::shgq[3][9][4];
 double XC::NineFourNodeQuadUP::shlu[3][9][9];
 double XC::NineFourNodeQuadUP::shlp[3][4][4];
 double XC::NineFourNodeQuadUP::shlq[3][9][4];
 double XC::NineFourNodeQuadUP::wu[9];
 double XC::NineFourNodeQuadUP::wp[4];
-double XC::NineFourNodeQuadUP::dvolu[9];
-double XC::NineFourNodeQuadUP::dvolp[4];
-double XC::NineFourNodeQuadUP::dvolq[4];
+thread_local double XC::NineFourNodeQuadUP::dvolu[9];
+thread_local double XC::NineFourNodeQuadUP::dvolp[4];
+thread_local double XC::NineFourNodeQuadUP::dvolq[4];
 const int XC::NineFourNodeQuadUP::nintu=9;
 const int XC::NineFourNodeQuadUP::nintp=4;
 const int XC::NineFourNodeQuadUP::nenu=9;
@@ -138,7 +138,7 @@ void XC::NineFourNodeQuadUP::setDomain(Domain *theDomain)
 
 int XC::NineFourNodeQuadUP::update()
 {
-  static double u[2][9];
+  static thread_local double u[2][9];
   int i;
   for(i = 0; i < nenu; i++) {
     const XC::Vector &disp = theNodes[i]->getTrialDisp();
@@ -146,7 +146,7 @@ int XC::NineFourNodeQuadUP::update()
     u[1][i] = disp(1);
   }
 
-  static XC::Vector eps(3);
+  static thread_local XC::Vector eps(3);
 
   int ret = 0;
 
@@ -177,8 +177,8 @@ int XC::NineFourNodeQuadUP::update()
 const XC::Matrix &XC::NineFourNodeQuadUP::getTangentStiff(void) const
 {
   int i, j, j2, j2m1, ik, ib, jk, jb;
-  static XC::Matrix B(3,nenu*2);
-  static XC::Matrix BTDB(nenu*2,nenu*2);
+  static thread_local XC::Matrix B(3,nenu*2);
+  static thread_local XC::Matrix BTDB(nenu*2,nenu*2);
 
   B.Zero();
   BTDB.Zero();
@@ -238,8 +238,8 @@ const XC::Matrix &XC::NineFourNodeQuadUP::getInitialStiff(void) const
       {
 
   int i, j, j2, j2m1, ik, ib, jk, jb;
-  static XC::Matrix B(3,nenu*2);
-  static XC::Matrix BTDB(nenu*2,nenu*2);
+  static thread_local XC::Matrix B(3,nenu*2);
+  static thread_local XC::Matrix BTDB(nenu*2,nenu*2);
 
   B.Zero();
   BTDB.Zero();
@@ -302,7 +302,7 @@ const XC::Matrix &XC::NineFourNodeQuadUP::getInitialStiff(void) const
 
 const XC::Matrix &XC::NineFourNodeQuadUP::getDamp(void) const
 {
-  static XC::Matrix Kdamp(22,22);
+  static thread_local XC::Matrix Kdamp(22,22);
   Kdamp.Zero();
 
   if(rayFactors.getBetaK() != 0.0)
@@ -432,7 +432,7 @@ int XC::NineFourNodeQuadUP::addInertiaLoadToUnbalance(const XC::Vector &accel)
   // accel = uDotDotG (see XC::EarthquakePattern.cpp)
   // Get R * accel from the nodes
 
-  static XC::Vector ra(22);
+  static thread_local XC::Vector ra(22);
   int i, j, ik;
 
   ra.Zero();
@@ -520,7 +520,7 @@ const XC::Vector &XC::NineFourNodeQuadUP::getResistingForce(void) const
 const XC::Vector &XC::NineFourNodeQuadUP::getResistingForceIncInertia(void) const
   {
     int i, j, ik;
-    static double a[22];
+    static thread_local double a[22];
 
     for(i=0; i<nenu; i++)
       {
@@ -744,7 +744,7 @@ int XC::NineFourNodeQuadUP::updateParameter(int parameterID, Information &info)
 
 void XC::NineFourNodeQuadUP::globalShapeFunction(double *dvol, double *w, int nint, int nen, int mode) const
 {
-  static double coord[2][9], xs[2][2], det, temp;
+  static thread_local double coord[2][9], xs[2][2], det, temp;
   int i, j, k, m;
 
   for(i=0; i<3; i++) {
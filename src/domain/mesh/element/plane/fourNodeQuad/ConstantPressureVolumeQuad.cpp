@@ -67,11 +67,11 @@
 #include "domain/mesh/element/utils/gauss_models/GaussModel.h"
 
 //static data
-double XC::ConstantPressureVolumeQuad::matrixData[64];
- XC::Matrix XC::ConstantPressureVolumeQuad::stiff(matrixData,8,8);
- XC::Vector XC::ConstantPressureVolumeQuad::resid(8);
- XC::Matrix XC::ConstantPressureVolumeQuad::mass(8,8);
- XC::Matrix XC::ConstantPressureVolumeQuad::damping(8,8);
+thread_local double XC::ConstantPressureVolumeQuad::matrixData[64];
+thread_local XC::Matrix XC::ConstantPressureVolumeQuad::stiff(matrixData,8,8);
+thread_local XC::Vector XC::ConstantPressureVolumeQuad::resid(8);
+thread_local XC::Matrix XC::ConstantPressureVolumeQuad::mass(8,8);
+thread_local XC::Matrix XC::ConstantPressureVolumeQuad::damping(8,8);
 
 //volume-pressure constants
 double XC::ConstantPressureVolumeQuad::one3  = 1.0 / 3.0;
@@ -142,15 +142,15 @@ int XC::ConstantPressureVolumeQuad::update( )
   int node;
   int success = 0;
 
-  static double tmp_shp[3][4]; //shape functions
+  static thread_local double tmp_shp[3][4]; //shape functions
 
-  static double shp[3][4][4]; //shape functions at each gauss point
+  static thread_local double shp[3][4][4]; //shape functions at each gauss point
 
-  static double vol_avg_shp[3][4]; // volume averaged shape functions
+  static thread_local double vol_avg_shp[3][4]; // volume averaged shape functions
 
   double xsj;  // determinant jacaobian matrix
 
-  static Matrix sx(2,2); // inverse jacobian matrix
+  static thread_local Matrix sx(2,2); // inverse jacobian matrix
 
   double dvol[4]; //volume elements
 
@@ -158,11 +158,11 @@ int XC::ConstantPressureVolumeQuad::update( )
 
   double theta = 0.0; //average volume change (trace of strain)
 
-  static Vector strain(4); //strain in vector form
+  static thread_local Vector strain(4); //strain in vector form
 
   double trace = 0.0; //trace of the strain
 
-  static Vector one(4); //rank 2 identity as a vector
+  static thread_local Vector one(4); //rank 2 identity as a vector
 
   //one vector
   one(0) = 1.0;
@@ -306,56 +306,56 @@ const XC::Matrix& XC::ConstantPressureVolumeQuad::getInitialStiff(void) const
     int i,  j,  k, l;
     int jj, kk;
 
-  static double tmp_shp[3][4]; //shape functions
+  static thread_local double tmp_shp[3][4]; //shape functions
 
-  static double shp[3][4][4]; //shape functions at each gauss point
+  static thread_local double shp[3][4][4]; //shape functions at each gauss point
 
-  static double vol_avg_shp[3][4]; // volume averaged shape functions
+  static thread_local double vol_avg_shp[3][4]; // volume averaged shape functions
 
   double xsj;  // determinant jacaobian matrix
 
-  static XC::Matrix sx(2,2); // inverse jacobian matrix
+  static thread_local XC::Matrix sx(2,2); // inverse jacobian matrix
 
   double dvol[4]; //volume elements
 
   double volume = 0.0; //volume of element
 
-  static XC::Vector strain(4); //strain in vector form
+  static thread_local XC::Vector strain(4); //strain in vector form
 
   // static XC::Vector sigBar(4); //stress in vector form
-  static XC::Vector sig(4); //mixed stress in vector form
+  static thread_local XC::Vector sig(4); //mixed stress in vector form
 
-  static XC::Matrix BJtran(2,4);
-  static XC::Matrix BK(4,2);
+  static thread_local XC::Matrix BJtran(2,4);
+  static thread_local XC::Matrix BK(4,2);
 
-  static XC::Matrix littleBJtran(2,1);
-  static XC::Matrix littleBK(1,2);
+  static thread_local XC::Matrix littleBJtran(2,1);
+  static thread_local XC::Matrix littleBK(1,2);
 
-  static XC::Matrix stiffJK(2,2); //nodeJ-nodeK 2x2 stiffness
-  static XC::Vector residJ(2); //nodeJ residual
+  static thread_local XC::Matrix stiffJK(2,2); //nodeJ-nodeK 2x2 stiffness
+  static thread_local XC::Vector residJ(2); //nodeJ residual
 
-  static XC::Vector one(4); //rank 2 identity as a vector
+  static thread_local XC::Vector one(4); //rank 2 identity as a vector
 
-  static XC::Matrix Pdev(4,4); //deviator projector
+  static thread_local XC::Matrix Pdev(4,4); //deviator projector
 
   //  static XC::Matrix dd(4,4);  //material tangent
 
-  static XC::Matrix ddPdev(4,4);
-  static XC::Matrix PdevDD(4,4);
+  static thread_local XC::Matrix ddPdev(4,4);
+  static thread_local XC::Matrix PdevDD(4,4);
 
-  static double Pdev_dd_Pdev_data[16];
-  static double Pdev_dd_one_data[4];
-  static double one_dd_Pdev_data[4];
-  static XC::Matrix Pdev_dd_Pdev(Pdev_dd_Pdev_data, 4, 4);
-  static XC::Matrix Pdev_dd_one(Pdev_dd_one_data, 4, 1);
-  static XC::Matrix one_dd_Pdev(one_dd_Pdev_data, 1,4);
+  static thread_local double Pdev_dd_Pdev_data[16];
+  static thread_local double Pdev_dd_one_data[4];
+  static thread_local double one_dd_Pdev_data[4];
+  static thread_local XC::Matrix Pdev_dd_Pdev(Pdev_dd_Pdev_data, 4, 4);
+  static thread_local XC::Matrix Pdev_dd_one(Pdev_dd_one_data, 4, 1);
+  static thread_local XC::Matrix one_dd_Pdev(one_dd_Pdev_data, 1,4);
 
   double bulk= 0.0;
-  static XC::Matrix BJtranD(2,4);
-  static XC::Matrix BJtranDone(2,1);
+  static thread_local XC::Matrix BJtranD(2,4);
+  static thread_local XC::Matrix BJtranDone(2,1);
 
-  static XC::Matrix littleBJoneD(2,4);
-  static XC::Matrix littleBJtranBulk(2,1);
+  static thread_local XC::Matrix littleBJoneD(2,4);
+  static thread_local XC::Matrix littleBJtranBulk(2,1);
 
   //zero stiffness and residual
   stiff.Zero();
@@ -424,7 +424,7 @@ const XC::Matrix& XC::ConstantPressureVolumeQuad::getInitialStiff(void) const
   //residual and tangent calculations gauss loop
   for( i = 0; i < 4; i++ ) {
 
-    static XC::Matrix dd(4,4);
+    static thread_local XC::Matrix dd(4,4);
 
     dd = physicalProperties[i]->getInitialTangent( );
 
@@ -482,8 +482,8 @@ const XC::Matrix& XC::ConstantPressureVolumeQuad::getInitialStiff(void) const
       //littleBJoneD     =  littleBJtran * one_dd_Pdev;
       // littleBJoneD.addMatrixProduct(0.0,  littleBJtran, one_dd_Pdev, 1.0);
 
-      static double Adata[8];
-      static XC::Matrix A(Adata, 2, 4);
+      static thread_local double Adata[8];
+      static thread_local XC::Matrix A(Adata, 2, 4);
 
       // A = BJtranD;
       // A += littleBJoneD;
@@ -611,7 +611,7 @@ const XC::Vector& XC::ConstantPressureVolumeQuad::getResistingForce(void) const
 const XC::Vector& XC::ConstantPressureVolumeQuad::getResistingForceIncInertia(void) const
   {
     int tang_flag = 0; //don't get the tangent
-    static Vector res(8);
+    static thread_local Vector res(8);
 
     //do tangent and residual here
     formResidAndTangent( tang_flag );
@@ -654,11 +654,11 @@ void   XC::ConstantPressureVolumeQuad::formInertiaTerms( int tangFlag ) const
 
   double dvol; //volume element
 
-  static double shp[nShape][numberNodes];  //shape functions at a gauss point
+  static thread_local double shp[nShape][numberNodes];  //shape functions at a gauss point
 
-  static XC::Vector momentum(ndf);
+  static thread_local XC::Vector momentum(ndf);
 
-  static XC::Matrix sx(ndm,ndm);
+  static thread_local XC::Matrix sx(ndm,ndm);
 
   int i, j, k, p;
   int jj, kk;
@@ -751,15 +751,15 @@ void XC::ConstantPressureVolumeQuad::formResidAndTangent( int tang_flag ) const
   int i,  j,  k, l;
   int jj, kk;
 
-  static double tmp_shp[3][4]; //shape functions
+  static thread_local double tmp_shp[3][4]; //shape functions
 
-  static double shp[3][4][4]; //shape functions at each gauss point
+  static thread_local double shp[3][4][4]; //shape functions at each gauss point
 
-  static double vol_avg_shp[3][4]; // volume averaged shape functions
+  static thread_local double vol_avg_shp[3][4]; // volume averaged shape functions
 
   double xsj;  // determinant jacaobian matrix
 
-  static XC::Matrix sx(2,2); // inverse jacobian matrix
+  static thread_local XC::Matrix sx(2,2); // inverse jacobian matrix
 
   double dvol[4]; //volume elements
 
@@ -767,44 +767,44 @@ void XC::ConstantPressureVolumeQuad::formResidAndTangent( int tang_flag ) const
 
   double pressure = 0.0; //constitutive pressure
 
-  static XC::Vector strain(4); //strain in vector form
+  static thread_local XC::Vector strain(4); //strain in vector form
 
   // static XC::Vector sigBar(4); //stress in vector form
-  static XC::Vector sig(4); //mixed stress in vector form
+  static thread_local XC::Vector sig(4); //mixed stress in vector form
 
   double trace = 0.0; //trace of the strain
 
-  static XC::Matrix BJtran(2,4);
-  static XC::Matrix BK(4,2);
+  static thread_local XC::Matrix BJtran(2,4);
+  static thread_local XC::Matrix BK(4,2);
 
-  static XC::Matrix littleBJtran(2,1);
-  static XC::Matrix littleBK(1,2);
+  static thread_local XC::Matrix littleBJtran(2,1);
+  static thread_local XC::Matrix littleBK(1,2);
 
-  static XC::Matrix stiffJK(2,2); //nodeJ-nodeK 2x2 stiffness
-  static XC::Vector residJ(2); //nodeJ residual
+  static thread_local XC::Matrix stiffJK(2,2); //nodeJ-nodeK 2x2 stiffness
+  static thread_local XC::Vector residJ(2); //nodeJ residual
 
-  static XC::Vector one(4); //rank 2 identity as a vector
+  static thread_local XC::Vector one(4); //rank 2 identity as a vector
 
-  static XC::Matrix Pdev(4,4); //deviator projector
+  static thread_local XC::Matrix Pdev(4,4); //deviator projector
 
   //  static XC::Matrix dd(4,4);  //material tangent
 
-  static XC::Matrix ddPdev(4,4);
-  static XC::Matrix PdevDD(4,4);
+  static thread_local XC::Matrix ddPdev(4,4);
+  static thread_local XC::Matrix PdevDD(4,4);
 
-  static double Pdev_dd_Pdev_data[16];
-  static double Pdev_dd_one_data[4];
-  static double one_dd_Pdev_data[4];
-  static XC::Matrix Pdev_dd_Pdev(Pdev_dd_Pdev_data, 4, 4);
-  static XC::Matrix Pdev_dd_one(Pdev_dd_one_data, 4, 1);
-  static XC::Matrix one_dd_Pdev(one_dd_Pdev_data, 1,4);
+  static thread_local double Pdev_dd_Pdev_data[16];
+  static thread_local double Pdev_dd_one_data[4];
+  static thread_local double one_dd_Pdev_data[4];
+  static thread_local XC::Matrix Pdev_dd_Pdev(Pdev_dd_Pdev_data, 4, 4);
+  static thread_local XC::Matrix Pdev_dd_one(Pdev_dd_one_data, 4, 1);
+  static thread_local XC::Matrix one_dd_Pdev(one_dd_Pdev_data, 1,4);
 
   double bulk= 0.0;
-  static XC::Matrix BJtranD(2,4);
-  static XC::Matrix BJtranDone(2,1);
+  static thread_local XC::Matrix BJtranD(2,4);
+  static thread_local XC::Matrix BJtranDone(2,1);
 
-  static XC::Matrix littleBJoneD(2,4);
-  static XC::Matrix littleBJtranBulk(2,1);
+  static thread_local XC::Matrix littleBJoneD(2,4);
+  static thread_local XC::Matrix littleBJtranBulk(2,1);
 
   //zero stiffness and residual
   if( tang_flag == 1 )
@@ -893,7 +893,7 @@ void XC::ConstantPressureVolumeQuad::formResidAndTangent( int tang_flag ) const
 
     if( tang_flag == 1 ) {    // compute matrices for stiffness calculation
 
-      static XC::Matrix dd(4,4);
+      static thread_local XC::Matrix dd(4,4);
       dd = physicalProperties[i]->getTangent( );
 
       dd *= dvol[i];
@@ -994,8 +994,8 @@ void XC::ConstantPressureVolumeQuad::formResidAndTangent( int tang_flag ) const
         //littleBJoneD     =  littleBJtran * one_dd_Pdev;
         // littleBJoneD.addMatrixProduct(0.0,  littleBJtran, one_dd_Pdev, 1.0);
 
-        static double Adata[8];
-        static XC::Matrix A(Adata, 2, 4);
+        static thread_local double Adata[8];
+        static thread_local XC::Matrix A(Adata, 2, 4);
 
         // A = BJtranD;
         // A += littleBJoneD;
@@ -1104,7 +1104,7 @@ void XC::ConstantPressureVolumeQuad::shape2d( double ss, double tt,
   static const double s[] = { -0.5,  0.5, 0.5, -0.5 };
   static const double t[] = { -0.5, -0.5, 0.5,  0.5 };
 
-  static double xs[2][2];
+  static thread_local double xs[2][2];
 
   //  static XC::Matrix xs(2,2);
 
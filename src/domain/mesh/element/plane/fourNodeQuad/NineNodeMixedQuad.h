@@ -69,14 +69,14 @@ class NDMaterial;
 class NineNodeMixedQuad : public ElemWithMaterial<9,NDMaterialPhysicalProperties>
   {
   private: 
-    static double xl[][9]; //!< nodal coordinates, two coordinates for each of nine nodes
+    static thread_local double xl[][9]; //!< nodal coordinates, two coordinates for each of nine nodes
     mutable Matrix *Ki;
 
     //static data
-    static Matrix stiff;
-    static Vector resid;
-    static Matrix mass;
-    static Matrix damping;
+    static thread_local Matrix stiff;
+    static thread_local Vector resid;
+    static thread_local Matrix mass;
+    static thread_local Matrix damping;
     
     
     //quadrature data
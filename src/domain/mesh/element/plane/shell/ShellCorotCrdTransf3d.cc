@@ -187,7 +187,7 @@ XC::Vector XC::ShellCorotCrdTransf3d::global_to_local_accel_nod(const int &i) co
 const XC::Vector &XC::ShellCorotCrdTransf3d::local_to_global_resisting_force(const Vector &pl) const
   {
     // transform resisting forces  from local to global coordinates
-    static Vector pg(24);
+    static thread_local Vector pg(24);
     const Matrix R= getR();
     const Matrix Rd= R*getR0T();
     pg= local_to_global(R,Rd,pl);
@@ -283,7 +283,7 @@ XC::Vector XC::ShellCorotCrdTransf3d::local_to_global(const Matrix &R,const Matr
 //! @param kl: matrix expressed in local coordinates.
 XC::Matrix XC::ShellCorotCrdTransf3d::local_to_global(const Matrix &R,const Matrix &Rd,const Matrix &kl) const
   {
-    static Matrix tmp(24,24);
+    static thread_local Matrix tmp(24,24);
 
     // Transform local matrix to global system
     // First compute kl*T_{lg}
@@ -32,7 +32,6 @@
 #include "domain/mesh/element/plane/QuadBase4N.h"
 #include "domain/mesh/element/utils/physical_properties/SectionFDPhysicalProperties.h"
 #include "ShellCrdTransf3dBase.h"
-#include "ShellBData.h"
 #include <utility/matrix/Vector.h>
 #include <utility/matrix/Matrix.h>
 #include "domain/mesh/element/utils/fvectors/FVectorShell.h"
@@ -61,12 +60,10 @@ class ShellMITC4Base : public QuadBase4N<SectionFDPhysicalProperties>
     std::vector<Vector> inicDisp; //!< Initial displacements.
 
     //static data
-    static Matrix stiff;
-    static Vector resid;
-    static Matrix mass;
-    static Matrix damping;
-
-    static ShellBData BData; //!< B-bar data
+    static thread_local Matrix stiff;
+    static thread_local Vector resid;
+    static thread_local Matrix mass;
+    static thread_local Matrix damping;
 
     void free_mem(void);
     void alloc(const ShellCrdTransf3dBase *);
@@ -54,9 +54,9 @@
 #include "domain/load/plane/ShellUniformLoad.h"
 
 //static data
-XC::Matrix  XC::ShellNL::stiff(54,54);
-XC::Vector  XC::ShellNL::resid(54); 
-XC::Matrix  XC::ShellNL::mass(54,54);
+thread_local XC::Matrix  XC::ShellNL::stiff(54,54);
+thread_local XC::Vector  XC::ShellNL::resid(54); 
+thread_local XC::Matrix  XC::ShellNL::mass(54,54);
 
 //! @brief null constructor
 XC::ShellNL::ShellNL(void)
@@ -84,8 +84,8 @@ void XC::ShellNL::setDomain(Domain *theDomain )
   {
     QuadBase9N<SectionFDPhysicalProperties>::setDomain(theDomain);
 
-    static Vector eig(3);
-    static Matrix ddMembrane(3,3);
+    static thread_local Vector eig(3);
+    static thread_local Matrix ddMembrane(3,3);
 
 
     //compute drilling stiffness penalty parameter
@@ -148,31 +148,31 @@ const XC::Matrix &XC::ShellNL::getInitialStiff(void) const
 
     double volume= 0.0;
 
-    static double xsj;  // determinant jacaobian matrix 
-    static double dvol[ngauss]; //volume element
-    static double shp[3][numnodes];  //shape functions at a gauss point
+    static thread_local double xsj;  // determinant jacaobian matrix 
+    static thread_local double dvol[ngauss]; //volume element
+    static thread_local double shp[3][numnodes];  //shape functions at a gauss point
 
-    static Matrix stiffJK(ndf,ndf); //nodeJK stiffness 
-    static Matrix dd(nstress,nstress);  //material tangent
+    static thread_local Matrix stiffJK(ndf,ndf); //nodeJK stiffness 
+    static thread_local Matrix dd(nstress,nstress);  //material tangent
 
     //static Matrix J0(2,2);  //Jacobian at center
  
     //static Matrix J0inv(2,2); //inverse of Jacobian at center
 
     //---------B-matrices------------------------------------
-    static Matrix BJ(nstress,ndf);      // B matrix node J
-    static Matrix BJtran(ndf,nstress);
-    static Matrix BK(nstress,ndf);      // B matrix node k
-    static Matrix BJtranD(ndf,nstress);
-    static Matrix Bbend(3,3);  // bending B matrix
-    static Matrix Bshear(2,3); // shear B matrix
-    static Matrix Bmembrane(3,2); // membrane B matrix
-    static double BdrillJ[ndf]; //drill B matrix
-    static double BdrillK[ndf];  
+    static thread_local Matrix BJ(nstress,ndf);      // B matrix node J
+    static thread_local Matrix BJtran(ndf,nstress);
+    static thread_local Matrix BK(nstress,ndf);      // B matrix node k
+    static thread_local Matrix BJtranD(ndf,nstress);
+    static thread_local Matrix Bbend(3,3);  // bending B matrix
+    static thread_local Matrix Bshear(2,3); // shear B matrix
+    static thread_local Matrix Bmembrane(3,2); // membrane B matrix
+    static thread_local double BdrillJ[ndf]; //drill B matrix
+    static thread_local double BdrillK[ndf];  
 
     double *drillPointer;
 
-    static double saveB[nstress][ndf][numnodes];
+    static thread_local double saveB[nstress][ndf][numnodes];
 
     //-------------------------------------------------------
     stiff.Zero();
@@ -376,7 +376,7 @@ const XC::Vector &XC::ShellNL::getResistingForce(void) const
 //! @brief get residual with inertia terms
 const XC::Vector &XC::ShellNL::getResistingForceIncInertia(void) const
   {
-    static Vector res(54);
+    static thread_local Vector res(54);
     res= getResistingForce();
 
     formInertiaTerms(0);
@@ -400,8 +400,8 @@ void XC::ShellNL::formInertiaTerms(int tangFlag) const
 
     double xsj;  // determinant jacaobian matrix 
     double dvol; //volume element
-    static double shp[nShape][numberNodes];  //shape functions at a gauss point
-    static Vector momentum(ndf);
+    static thread_local double shp[nShape][numberNodes];  //shape functions at a gauss point
+    static thread_local Vector momentum(ndf);
 
 
     double temp, rhoH, massJK;
@@ -511,33 +511,33 @@ void XC::ShellNL::formResidAndTangent(int tang_flag) const
   
     double volume= 0.0;
 
-    static double xsj;  // determinant jacaobian matrix 
-    static double dvol[ngauss]; //volume element
-    static Vector strain(nstress);  //strain
-    static double shp[3][numnodes];  //shape functions at a gauss point
-    static Vector residJ(ndf); //nodeJ residual 
-    static Matrix stiffJK(ndf,ndf); //nodeJK stiffness 
-    static Vector stress(nstress);  //stress resultants
-    static Matrix dd(nstress,nstress);  //material tangent
+    static thread_local double xsj;  // determinant jacaobian matrix 
+    static thread_local double dvol[ngauss]; //volume element
+    static thread_local Vector strain(nstress);  //strain
+    static thread_local double shp[3][numnodes];  //shape functions at a gauss point
+    static thread_local Vector residJ(ndf); //nodeJ residual 
+    static thread_local Matrix stiffJK(ndf,ndf); //nodeJK stiffness 
+    static thread_local Vector stress(nstress);  //stress resultants
+    static thread_local Matrix dd(nstress,nstress);  //material tangent
 
     double epsDrill= 0.0;  //drilling "strain"
     double tauDrill= 0.0; //drilling "stress"
 
     //---------B-matrices------------------------------------
 
-    static Matrix BJ(nstress,ndf);      // B matrix node J
-    static Matrix BJtran(ndf,nstress);
-    static Matrix BK(nstress,ndf);      // B matrix node k
-    static Matrix BJtranD(ndf,nstress);
-    static Matrix Bbend(3,3);  // bending B matrix
-    static Matrix Bshear(2,3); // shear B matrix
-    static Matrix Bmembrane(3,2); // membrane B matrix
-    static double BdrillJ[ndf]; //drill B matrix
-    static double BdrillK[ndf];  
+    static thread_local Matrix BJ(nstress,ndf);      // B matrix node J
+    static thread_local Matrix BJtran(ndf,nstress);
+    static thread_local Matrix BK(nstress,ndf);      // B matrix node k
+    static thread_local Matrix BJtranD(ndf,nstress);
+    static thread_local Matrix Bbend(3,3);  // bending B matrix
+    static thread_local Matrix Bshear(2,3); // shear B matrix
+    static thread_local Matrix Bmembrane(3,2); // membrane B matrix
+    static thread_local double BdrillJ[ndf]; //drill B matrix
+    static thread_local double BdrillK[ndf];  
 
     double *drillPointer;
 
-    static double saveB[nstress][ndf][numnodes];
+    static thread_local double saveB[nstress][ndf][numnodes];
 
     //-------------------------------------------------------
    
@@ -707,10 +707,10 @@ void XC::ShellNL::computeBasis(void)
 //! @brief compute Bdrill
 double *XC::ShellNL::computeBdrill( int node, const double shp[3][9] ) const
   {
-    static double Bdrill[6];
-    static double B1;
-    static double B2;
-    static double B6;
+    static thread_local double Bdrill[6];
+    static thread_local double B1;
+    static thread_local double B2;
+    static thread_local double B6;
 
     //---Bdrill Matrix in standard {1,2,3} mechanics notation---------
     //             -                                       -
@@ -743,12 +743,12 @@ const XC::Matrix &XC::ShellNL::assembleB( const Matrix &Bmembrane, const Matrix
     //Matrix Bshear(2,3); // plate shear B matrix
     //Matrix Bmembrane(3,2); // plate membrane B matrix
 
-    static Matrix B(8,6);
-    static Matrix BmembraneShell(3,3); 
-    static Matrix BbendShell(3,3); 
-    static Matrix BshearShell(2,6);
-    static Matrix Gmem(2,3);
-    static Matrix Gshear(3,6);
+    static thread_local Matrix B(8,6);
+    static thread_local Matrix BmembraneShell(3,3); 
+    static thread_local Matrix BbendShell(3,3); 
+    static thread_local Matrix BshearShell(2,6);
+    static thread_local Matrix Gmem(2,3);
+    static thread_local Matrix Gshear(3,6);
     int pp;
 
     // For Shell : 
@@ -832,7 +832,7 @@ const XC::Matrix &XC::ShellNL::assembleB( const Matrix &Bmembrane, const Matrix
 //! @brief compute Bmembrane matrix
 const XC::Matrix &XC::ShellNL::computeBmembrane( int node, const double shp[3][9] ) const
   {
-    static Matrix Bmembrane(3,2);
+    static thread_local Matrix Bmembrane(3,2);
 
     //---Bmembrane Matrix in standard {1,2,3} mechanics notation---------
     //                -             -
@@ -856,7 +856,7 @@ const XC::Matrix &XC::ShellNL::computeBmembrane( int node, const double shp[3][9
 //! @brief compute Bbend matrix
 const XC::Matrix &XC::ShellNL::computeBbend( int node, const double shp[3][9] ) const
   {
-    static Matrix Bbend(3,2);
+    static thread_local Matrix Bbend(3,2);
 
     //---Bbend Matrix in standard {1,2,3} mechanics notation---------
     //            -             -
@@ -879,7 +879,7 @@ const XC::Matrix &XC::ShellNL::computeBbend( int node, const double shp[3][9] )
 //! @brief compute standard Bshear matrix
 const XC::Matrix &XC::ShellNL::computeBshear( int node, const double shp[3][9] ) const
   {
-    static Matrix Bshear(2,3);
+    static thread_local Matrix Bshear(2,3);
 
     //---Bshear Matrix in standard {1,2,3} mechanics notation------
     //             -                -
@@ -903,8 +903,8 @@ void XC::ShellNL::shape2d( double ss, double tt,const double x[2][9], double shp
   {
     static const double s[]= { -0.5,  0.5, 0.5, -0.5 };
     static const double t[]= { -0.5, -0.5, 0.5,  0.5 };
-    static double xs[2][2];
-    static double sx[2][2];
+    static thread_local double xs[2][2];
+    static thread_local double sx[2][2];
 
     for(int i= 0; i < 4; i++ )
       {
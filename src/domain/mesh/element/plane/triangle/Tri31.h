@@ -80,11 +80,11 @@ class Tri31: public TriBase3N<SolidMech2D>
 
     mutable Matrix *Ki;
    
-    static double matrixData[36]; //!< array data for matrix
-    static Matrix K; //!< Element stiffness, damping, and mass Matrix
-    static Vector P; //!< Element resisting force vector
+    static thread_local double matrixData[36]; //!< array data for matrix
+    static thread_local Matrix K; //!< Element stiffness, damping, and mass Matrix
+    static thread_local Vector P; //!< Element resisting force vector
 
-    static double shp[3][3]; //!< Stores shape functions and derivatives (overwritten)
+    static thread_local double shp[3][3]; //!< Stores shape functions and derivatives (overwritten)
 
     // private member functions - only objects of this class can call these
     double shapeFunction(const GaussPoint &) const;
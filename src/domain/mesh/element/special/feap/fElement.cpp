@@ -71,8 +71,8 @@
 // initialise all class wise pointers to 0 and numfElements to 0
 int    XC::fElement::numfElements(0);
 
-static double *work = 0;
-static int sizeWork = 0;
+static thread_local double *work = 0;
+static thread_local int sizeWork = 0;
 
 const int MAX_NST=64;
 std::vector<XC::Matrix *> XC::fElement::fElementM(MAX_NST+1,nullptr);
@@ -383,7 +383,7 @@ int XC::fElement::revertToStart()
 
 const XC::Matrix &XC::fElement::getTangentStiff(void) const
   {
-    static Matrix K;
+    static thread_local Matrix K;
     // check for quick return
     if(nen == 0)
       K= (*fElementM[0]);
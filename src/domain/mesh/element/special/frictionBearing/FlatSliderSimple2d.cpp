@@ -45,8 +45,8 @@
 
 
 // initialize the class wide variables
-XC::Matrix XC::FlatSliderSimple2d::theMatrix(6,6);
-XC::Vector XC::FlatSliderSimple2d::theVector(6);
+thread_local XC::Matrix XC::FlatSliderSimple2d::theMatrix(6,6);
+thread_local XC::Vector XC::FlatSliderSimple2d::theVector(6);
 
 XC::FlatSliderSimple2d::FlatSliderSimple2d(int tag, int Nd1, int Nd2,
 					   FrictionModel &thefrnmdl, double _uy,const std::vector<UniaxialMaterial *> &materials,
@@ -158,7 +158,7 @@ int XC::FlatSliderSimple2d::update()
     const Vector &vel1 = theNodes[0]->getTrialVel();
     const Vector &vel2 = theNodes[1]->getTrialVel();
     
-    static Vector ug(6), ugdot(6), uldot(6), ubdot(3);
+    static thread_local Vector ug(6), ugdot(6), uldot(6), ubdot(3);
     for (int i=0; i<3; i++)  {
         ug(i)   = dsp1(i);  ugdot(i)   = vel1(i);
         ug(i+3) = dsp2(i);  ugdot(i+3) = vel2(i);
@@ -257,7 +257,7 @@ const XC::Matrix &XC::FlatSliderSimple2d::getTangentStiff()
     theMatrix.Zero();
     
     // transform from basic to local system
-    static Matrix kl(6,6);
+    static thread_local Matrix kl(6,6);
     kl.addMatrixTripleProduct(0.0, Tlb, kb, 1.0);
     
     // add geometric stiffness to local stiffness
@@ -279,7 +279,7 @@ const XC::Matrix &XC::FlatSliderSimple2d::getInitialStiff()
     theMatrix.Zero();
     
     // transform from basic to local system
-    static Matrix kl(6,6);
+    static thread_local Matrix kl(6,6);
     kl.addMatrixTripleProduct(0.0, Tlb, kbInit, 1.0);
     
     // transform from local to global system
@@ -353,7 +353,7 @@ const XC::Vector& XC::FlatSliderSimple2d::getResistingForce()
     theVector.Zero();
     
     // determine resisting forces in local system
-    static Vector ql(6);
+    static thread_local Vector ql(6);
     ql = Tlb^qb;
     
     // add P-Delta moments to local forces
@@ -970,9 +970,9 @@ XC::Response* XC::BeamColumnJoint2d::setResponse(const std::vector<std::string>
 int
 XC::BeamColumnJoint2d::getResponse(int responseID, Information &eleInfo)
 {
-        static XC::Vector delta(13);
-        static XC::Vector def(4);
-        static XC::Vector U(16);
+        static thread_local XC::Vector delta(13);
+        static thread_local XC::Vector def(4);
+        static thread_local XC::Vector U(16);
         int tr,ty;
         double bsFa, bsFb, bsFc, bsFd;
         double bsFac, bsFbd, isFac, isFbd;
@@ -66,8 +66,8 @@
 #include <domain/mesh/node/Node.h>
 
 
-XC::Matrix XC::Joint2D::K(16,16);
-XC::Vector XC::Joint2D::V(16);
+thread_local XC::Matrix XC::Joint2D::K(16,16);
+thread_local XC::Vector XC::Joint2D::V(16);
 
 //////////////////////////////////////////////////////////////////////
 // Construction/Destruction
@@ -83,8 +83,8 @@ class Joint2D : public ElemWithMaterial<5,Joint2DPhysicalProperties>
     DamageModel *theDamages[5];
     ID	InternalConstraints;
     int	numDof, nodeDbTag, dofDbTag;
-    static	Matrix K;
-    static	Vector V;
+    static thread_local Matrix K;
+    static thread_local Vector V;
 
     // AddingSensitivity:BEGIN //////////////////////////////////////////
     int parameterID;
@@ -65,8 +65,8 @@
 #include <material/uniaxial/UniaxialMaterial.h>
 
 
-XC::Matrix XC::Joint3D::K(45,45);
-XC::Vector XC::Joint3D::V(45);
+thread_local XC::Matrix XC::Joint3D::K(45,45);
+thread_local XC::Vector XC::Joint3D::V(45);
 
 //////////////////////////////////////////////////////////////////////
 // Construction/Destruction
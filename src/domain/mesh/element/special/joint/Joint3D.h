@@ -89,8 +89,8 @@ class Joint3D: public ElemWithMaterial<7,Joint3DPhysicalProperties>
     ID ExternalNodes;
     ID InternalConstraints;
     int numDof, nodeDbTag, dofDbTag;
-    static Matrix K;
-    static Vector V;
+    static thread_local Matrix K;
+    static thread_local Vector V;
   protected:
    int addMFreedom_Joint(Domain *theDomain, int mpNum, int RetNodeID, int ConNodeID,
                     int RotNodeID, int Rdof, int DspNodeID, int Ddof, 
@@ -177,7 +177,7 @@ const XC::Vector &XC::BeamColumnWithSectionFDTrf3d::getVDirStrongAxisGlobalCoord
       }
     else
       {
-        static Vector tmp(3);
+        static thread_local Vector tmp(3);
         return tmp;
       }
   }
@@ -196,7 +196,7 @@ const XC::Vector &XC::BeamColumnWithSectionFDTrf3d::getVDirWeakAxisGlobalCoord(c
       }
     else
       {
-        static Vector tmp(3);
+        static thread_local Vector tmp(3);
         return tmp;
       }
   }
@@ -73,9 +73,9 @@ class NLForceBeamColumn2dBase: public BeamColumnWithSectionFDTrf2d
 
     mutable Matrix Ki;
 
-    static Matrix theMatrix;
-    static Vector theVector;
-    static double workArea[];
+    static thread_local Matrix theMatrix;
+    static thread_local Vector theVector;
+    static thread_local double workArea[];
 
     void resizeMatrices(const size_t &nSections);
     void initializeSectionHistoryVariables(void);
@@ -186,7 +186,7 @@ const XC::Matrix &XC::beam2d02::getStiff(void) const
   {
     const XC::Vector &v = theCoordTransf->getBasicTrialDisp();
     q.addMatrixVector(0.0,Kd,v,1.0);
-    static Matrix K;
+    static thread_local Matrix K;
     K= theCoordTransf->getGlobalStiffMatrix(Kd, q);
     if(isDead())
       K*=dead_srf;
@@ -241,7 +241,7 @@ const XC::Vector &XC::beam2d02::getResistingForce(void) const
     const XC::Vector &v = theCoordTransf->getBasicTrialDisp();
     q.addMatrixVector(0.0,Kd,v,1.0);
 
-    static XC::Vector uniLoad(2);
+    static thread_local XC::Vector uniLoad(2);
 
     rForce = theCoordTransf->getGlobalResistingForce(q, uniLoad);
 
@@ -298,7 +298,7 @@ int XC::beam2d02::recvData(const CommParameters &cp)
 //! @brief Sends object through the channel being passed as parameter.
 int XC::beam2d02::sendSelf(CommParameters &cp)
   {
-    static ID data(10);
+    static thread_local ID data(10);
     int res= sendData(cp);
 
     const int dataTag= getDbTag();
@@ -311,7 +311,7 @@ int XC::beam2d02::sendSelf(CommParameters &cp)
 //! @brief Receives object through the channel being passed as parameter.
 int XC::beam2d02::recvSelf(const CommParameters &cp)
   {
-    static ID data(10);
+    static thread_local ID data(10);
     const int dataTag= getDbTag();
     int res = cp.receiveIdData(getDbTagData(),dataTag);
     if(res<0)
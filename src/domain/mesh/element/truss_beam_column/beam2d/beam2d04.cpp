@@ -78,8 +78,8 @@
 #include <cmath>
 #include <cstdlib>
 
- XC::Matrix XC::beam2d04::k(6,6);
- XC::Matrix XC::beam2d04::trans(6,6);
+thread_local XC::Matrix XC::beam2d04::k(6,6);
+thread_local XC::Matrix XC::beam2d04::trans(6,6);
 
 // beam2d04(int tag, double A, double E, double I, int Nd1, int Nd2);
 //        constructor which takes the unique element tag, the elements A,E and
@@ -82,8 +82,8 @@ class beam2d04 : public beam2d
     mutable Vector rForce;
     mutable int isStiffFormed;
 
-    static Matrix k;
-    static Matrix trans; //!< hold part of transformation matrix
+    static thread_local Matrix k;
+    static thread_local Matrix trans; //!< hold part of transformation matrix
 
     const Matrix &getStiff(void) const;    
     void formVar(void) const;
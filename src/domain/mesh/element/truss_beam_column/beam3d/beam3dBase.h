@@ -46,9 +46,9 @@ class beam3dBase : public ProtoBeam3d
     mutable Vector rForce;
     mutable bool isStiffFormed;
 
-    static Matrix k; // the stiffness matrix
-    static Matrix m; // the mass matrix	
-    static Matrix d; // the damping matrix
+    static thread_local Matrix k; // the stiffness matrix
+    static thread_local Matrix m; // the mass matrix	
+    static thread_local Matrix d; // the damping matrix
 
     virtual const Matrix &getStiff(void) const= 0;
 
@@ -97,9 +97,9 @@ class BeamWithHinges3d: public BeamColumnWithSectionFDTrf3d
     FVectorBeamColumn3d p0; // Reactions in the basic system due to element loads
     FVectorBeamColumn3d v0; // Basic deformations due to element loads on the interior
   
-    static Matrix theMatrix;
-    static Vector theVector;
-    static double workArea[];
+    static thread_local Matrix theMatrix;
+    static thread_local Vector theVector;
+    static thread_local double workArea[];
 
     void checkNodePtrs(Domain *theDomain);
     void setHinges(void);
@@ -72,9 +72,9 @@
 #include "material/section/ResponseId.h"
 #include "utility/actor/actor/MovableVector.h"
 
- XC::Matrix XC::DispBeamColumn2d::K(6,6);
- XC::Vector XC::DispBeamColumn2d::P(6);
-double XC::DispBeamColumn2d::workArea[100];
+thread_local XC::Matrix XC::DispBeamColumn2d::K(6,6);
+thread_local XC::Vector XC::DispBeamColumn2d::P(6);
+thread_local double XC::DispBeamColumn2d::workArea[100];
  XC::GaussQuadRule1d01 XC::DispBeamColumn2d::quadRule;
 
 XC::DispBeamColumn2d::DispBeamColumn2d(int tag, int nd1, int nd2,
@@ -257,7 +257,7 @@ XC::DispBeamColumn2d::update(void)
 
 const XC::Matrix &XC::DispBeamColumn2d::getTangentStiff(void) const
 {
-  static Matrix kb(3,3);
+  static thread_local Matrix kb(3,3);
 
   // Zero for integral
   kb.Zero();
@@ -357,7 +357,7 @@ const XC::Matrix &XC::DispBeamColumn2d::getTangentStiff(void) const
 
 const XC::Matrix &XC::DispBeamColumn2d::getInitialBasicStiff(void) const
 {
-  static XC::Matrix kb(3,3);
+  static thread_local XC::Matrix kb(3,3);
 
   // Zero for integral
   kb.Zero();
@@ -752,8 +752,8 @@ int XC::DispBeamColumn2d::getResponse(int responseID, Information &eleInfo)
 
   // Plastic rotation
   else if(responseID == 4) {
-    static XC::Vector vp(3);
-    static XC::Vector ve(3);
+    static thread_local XC::Vector vp(3);
+    static thread_local XC::Vector ve(3);
     const XC::Matrix &kb = this->getInitialBasicStiff();
     kb.Solve(q, ve);
     vp = theCoordTransf->getBasicTrialDisp();
@@ -946,11 +946,11 @@ XC::DispBeamColumn2d::getResistingForceSensitivity(int gradNumber)
 
         // Zero for integration
         q.Zero();
-        static XC::Vector qsens(3);
+        static thread_local XC::Vector qsens(3);
         qsens.Zero();
 
         // Some extra declarations
-        static XC::Matrix kbmine(3,3);
+        static thread_local XC::Matrix kbmine(3,3);
         kbmine.Zero();
 
         int j, k;
@@ -958,7 +958,7 @@ XC::DispBeamColumn2d::getResistingForceSensitivity(int gradNumber)
 
         // Check if a nodal coordinate is random
         bool randomNodeCoordinate = false;
-        static XC::ID nodeParameterID(2);
+        static thread_local XC::ID nodeParameterID(2);
         nodeParameterID(0) = theNodes[0]->getCrdsSensitivity();
         nodeParameterID(1) = theNodes[1]->getCrdsSensitivity();
         if(nodeParameterID(0) != 0 || nodeParameterID(1) != 0) {
@@ -1070,18 +1070,18 @@ XC::DispBeamColumn2d::getResistingForceSensitivity(int gradNumber)
 
         }
 
-        static XC::Vector dqdh(3);
+        static thread_local XC::Vector dqdh(3);
         const XC::Vector &dAdh_u = theCoordTransf->getBasicTrialDispShapeSensitivity();
         //dqdh = (1.0/L) * (kbmine * dAdh_u);
         dqdh.addMatrixVector(0.0, kbmine, dAdh_u, oneOverL);
 
-        static XC::Vector dkbdh_v(3);
+        static thread_local XC::Vector dkbdh_v(3);
         const XC::Vector &A_u = theCoordTransf->getBasicTrialDisp();
         //dkbdh_v = (d1oLdh) * (kbmine * A_u);
         dkbdh_v.addMatrixVector(0.0, kbmine, A_u, d1oLdh);
 
         // Transform forces
-        static XC::Vector dummy(3);                // No distributed loads
+        static thread_local XC::Vector dummy(3);                // No distributed loads
 
         // Term 5
         P = theCoordTransf->getGlobalResistingForce(qsens,dummy);
@@ -1108,7 +1108,7 @@ int XC::DispBeamColumn2d::commitSensitivity(int gradNumber, int numGrads)
     // Get basic deformation and sensitivities
         const XC::Vector &v = theCoordTransf->getBasicTrialDisp();
 
-        static XC::Vector vsens(3);
+        static thread_local XC::Vector vsens(3);
         vsens = theCoordTransf->getBasicDisplSensitivity(gradNumber);
 
         double L = theCoordTransf->getInitialLength();
@@ -1121,7 +1121,7 @@ int XC::DispBeamColumn2d::commitSensitivity(int gradNumber, int numGrads)
 
         // Check if a nodal coordinate is random
         bool randomNodeCoordinate = false;
-        static XC::ID nodeParameterID(2);
+        static thread_local XC::ID nodeParameterID(2);
         nodeParameterID(0) = theNodes[0]->getCrdsSensitivity();
         nodeParameterID(1) = theNodes[1]->getCrdsSensitivity();
         if(nodeParameterID(0) != 0 || nodeParameterID(1) != 0) {
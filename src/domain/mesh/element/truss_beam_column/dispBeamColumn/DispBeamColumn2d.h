@@ -88,10 +88,10 @@ class DispBeamColumn2d : public BeamColumnWithSectionFDTrf2d
 
     const Matrix &getInitialBasicStiff(void) const;
 
-    static Matrix K;		// Element stiffness, damping, and mass Matrix
-    static Vector P;		// Element resisting force vector
+    static thread_local Matrix K;		// Element stiffness, damping, and mass Matrix
+    static thread_local Vector P;		// Element resisting force vector
 
-    static double workArea[];
+    static thread_local double workArea[];
 
     static GaussQuadRule1d01 quadRule;
 
@@ -321,9 +321,9 @@ const XC::Matrix &XC::ForceBeamColumn2d::getInitialStiff(void) const
     // check for quick return
     if(Ki.isEmpty())
       {
-        static Matrix f(NEBD, NEBD); // element flexibility matrix
+        static thread_local Matrix f(NEBD, NEBD); // element flexibility matrix
         this->getInitialFlexibility(f);
-        static Matrix kvInit(NEBD, NEBD);
+        static thread_local Matrix kvInit(NEBD, NEBD);
         f.Invert(kvInit);
         Ki= Matrix(theCoordTransf->getInitialGlobalStiffMatrix(kvInit));
       }
@@ -344,13 +344,13 @@ int XC::ForceBeamColumn2d::update(void)
     // get basic displacements and increments
     const Vector &v= theCoordTransf->getBasicTrialDisp();
 
-    static Vector dv(NEBD);
+    static thread_local Vector dv(NEBD);
     dv= theCoordTransf->getBasicIncrDeltaDisp();
 
     if(initialFlag != 0 && dv.Norm() <= DBL_EPSILON && (sp.isEmpty()))
       return 0;
 
-    static Vector vin(NEBD);
+    static thread_local Vector vin(NEBD);
     vin= v;
     vin-= dv;
     const double L= theCoordTransf->getInitialLength();
@@ -363,10 +363,10 @@ int XC::ForceBeamColumn2d::update(void)
     std::vector<double> wt(section_matrices.getMaxNumSections());
     beamIntegr->getSectionWeights(numSections, L, &wt[0]);
 
-    static Vector vr(NEBD);       // element residual displacements
-    static Matrix f(NEBD,NEBD);   // element flexibility matrix
+    static thread_local Vector vr(NEBD);       // element residual displacements
+    static thread_local Matrix f(NEBD,NEBD);   // element flexibility matrix
 
-    static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
+    static thread_local Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
     double dW= 0.0;                   // section strain energy (work) norm
 
     I.Zero();
@@ -375,11 +375,11 @@ int XC::ForceBeamColumn2d::update(void)
 
     int numSubdivide = 1;
     bool converged = false;
-    static Vector dSe(NEBD);
-    static Vector dvToDo(NEBD);
-    static Vector dvTrial(NEBD);
-    static Vector SeTrial(NEBD);
-    static Matrix kvTrial(NEBD, NEBD);
+    static thread_local Vector dSe(NEBD);
+    static thread_local Vector dvToDo(NEBD);
+    static thread_local Vector dvTrial(NEBD);
+    static thread_local Vector SeTrial(NEBD);
+    static thread_local Matrix kvTrial(NEBD, NEBD);
 
     dvToDo= dv;
     dvTrial= dvToDo;
@@ -447,10 +447,10 @@ int XC::ForceBeamColumn2d::update(void)
                       {
                         const int order= theSections[i]->getOrder();
                         const ID &code = theSections[i]->getType();
-                        static Vector Ss;
-                        static Vector dSs;
-                        static Vector dvs;
-                        static Matrix fb;
+                        static thread_local Vector Ss;
+                        static thread_local Vector dSs;
+                        static thread_local Vector dvs;
+                        static thread_local Matrix fb;
     
                         Ss.setData(workArea, order);
                         dSs.setData(&workArea[order], order);
@@ -1049,7 +1049,7 @@ int XC::ForceBeamColumn2d::getInitialFlexibility(Matrix &fe) const
 void XC::ForceBeamColumn2d::compSectionDisplacements(std::vector<Vector> &sectionCoords,std::vector<Vector> &sectionDispls) const
   {
     // get basic displacements and increments
-    static Vector ub(NEBD);
+    static thread_local Vector ub(NEBD);
     ub = theCoordTransf->getBasicTrialDisp();
 
     const double L = theCoordTransf->getInitialLength();
@@ -1058,7 +1058,7 @@ void XC::ForceBeamColumn2d::compSectionDisplacements(std::vector<Vector> &sectio
     //   const XC::Matrix &xi_pt  = quadRule.getIntegrPointCoords(numSections);
     // get integration point positions and weights
     const size_t numSections= getNumSections();
-    static double pts[SectionMatrices::maxNumSections];
+    static thread_local double pts[SectionMatrices::maxNumSections];
     beamIntegr->getSectionLocations(numSections, L, pts);
 
     // setup Vandermode and CBDI influence matrices
@@ -1070,7 +1070,7 @@ void XC::ForceBeamColumn2d::compSectionDisplacements(std::vector<Vector> &sectio
 
     // get section curvatures
     Vector kappa(numSections);  // curvature
-    static XC::Vector vs;              // section deformations
+    static thread_local XC::Vector vs;              // section deformations
 
     for(size_t i=0; i<numSections; i++)
       {
@@ -1096,8 +1096,8 @@ void XC::ForceBeamColumn2d::compSectionDisplacements(std::vector<Vector> &sectio
       }
 
      Vector w(numSections);
-     static XC::Vector xl(NDM), uxb(NDM);
-     static XC::Vector xg(NDM), uxg(NDM);
+     static thread_local XC::Vector xl(NDM), uxb(NDM);
+     static thread_local XC::Vector xg(NDM), uxg(NDM);
 
      // w = ls * kappa;
      w.addMatrixVector (0.0, ls, kappa, 1.0);
@@ -1152,16 +1152,16 @@ void XC::ForceBeamColumn2d::Print(std::ostream &s, int flag)
         s << "#END_FORCES " << P << " " << -V+p0[2] << " " << M2 << std::endl;
 
         // plastic hinge rotation
-        static Vector vp(3);
-        static Matrix fe(3,3);
+        static thread_local Vector vp(3);
+        static thread_local Matrix fe(3,3);
         this->getInitialFlexibility(fe);
         vp= theCoordTransf->getBasicTrialDisp();
         vp.addMatrixVector(1.0, fe, Se, -1.0);
         s << "#PLASTIC_HINGE_ROTATION " << vp[1] << " " << vp[2] << " " << 0.1*L << " " << 0.1*L << std::endl;
 
         // allocate array of vectors to store section coordinates and displacements
-	static std::vector<Vector> coords;
-	static std::vector<Vector> displs;
+	static thread_local std::vector<Vector> coords;
+	static thread_local std::vector<Vector> displs;
         coords.resize(numSections);
         displs.resize(numSections);
         for(size_t i= 0;i<numSections;i++)
@@ -1268,8 +1268,8 @@ XC::Response *XC::ForceBeamColumn2d::setResponse(const std::vector<std::string>
 
 int XC::ForceBeamColumn2d::getResponse(int responseID, Information &eleInfo)
   {
-    static XC::Vector vp(3);
-    static XC::Matrix fe(3,3);
+    static thread_local XC::Vector vp(3);
+    static thread_local XC::Matrix fe(3,3);
 
     if(responseID == 1)
       return eleInfo.setVector(this->getResistingForce());
@@ -1363,7 +1363,7 @@ int XC::ForceBeamColumn2d::getResponse(int responseID, Information &eleInfo)
 
         d3+= beamIntegr->getTangentDriftJ(L, LI, Se(1), Se(2));
 
-        static XC::Vector d(2);
+        static thread_local XC::Vector d(2);
         d(0) = d2;
         d(1) = d3;
         return eleInfo.setVector(d);
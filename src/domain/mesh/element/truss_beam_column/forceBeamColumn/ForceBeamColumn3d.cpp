@@ -289,17 +289,17 @@ const XC::Matrix &XC::ForceBeamColumn3d::getInitialStiff(void) const
     // check for quick return
     if(Ki.isEmpty())
       {
-        static Matrix f(NEBD,NEBD);   // element flexibility matrix
+        static thread_local Matrix f(NEBD,NEBD);   // element flexibility matrix
         this->getInitialFlexibility(f);
 
-        static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
+        static thread_local Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
         I.Zero();
         for(size_t i=0; i<NEBD; i++)
           I(i,i) = 1.0;
 
         // calculate element stiffness matrix
         // invert3by3Matrix(f, kv);
-        static Matrix kvInit(NEBD, NEBD);
+        static thread_local Matrix kvInit(NEBD, NEBD);
         if(f.Solve(I, kvInit) < 0)
           std::cerr << "%s -- could not invert flexibility, ForceBeamColumn3d::getInitialStiff()\n";
         Ki= Matrix(theCoordTransf->getInitialGlobalStiffMatrix(kvInit));
@@ -321,13 +321,13 @@ int XC::ForceBeamColumn3d::update(void)
     // get basic displacements and increments
     const Vector &v = theCoordTransf->getBasicTrialDisp();
 
-    static Vector dv(NEBD);
+    static thread_local Vector dv(NEBD);
     dv = theCoordTransf->getBasicIncrDeltaDisp();
 
     if(initialFlag != 0 && dv.Norm() <= DBL_EPSILON && sp.isEmpty())
       return 0;
 
-    static Vector vin(NEBD);
+    static thread_local Vector vin(NEBD);
     vin = v;
     vin -= dv;
     const double L= theCoordTransf->getInitialLength();
@@ -340,10 +340,10 @@ int XC::ForceBeamColumn3d::update(void)
     double wt[SectionMatrices::maxNumSections];
     beamIntegr->getSectionWeights(numSections, L, wt);
 
-    static Vector vr(NEBD);       // element residual displacements
-    static Matrix f(NEBD,NEBD);   // element flexibility matrix
+    static thread_local Vector vr(NEBD);       // element residual displacements
+    static thread_local Matrix f(NEBD,NEBD);   // element flexibility matrix
 
-    static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
+    static thread_local Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
     double dW= 0.0;                    // section strain energy (work) norm
 
     I.Zero();
@@ -352,11 +352,11 @@ int XC::ForceBeamColumn3d::update(void)
 
     int numSubdivide = 1;
     bool converged = false;
-    static Vector dSe(NEBD);
-    static Vector dvToDo(NEBD);
-    static Vector dvTrial(NEBD);
-    static EsfBeamColumn3d SeTrial;
-    static Matrix kvTrial(NEBD, NEBD);
+    static thread_local Vector dSe(NEBD);
+    static thread_local Vector dvToDo(NEBD);
+    static thread_local Vector dvTrial(NEBD);
+    static thread_local EsfBeamColumn3d SeTrial;
+    static thread_local Matrix kvTrial(NEBD, NEBD);
 
     dvToDo = dv;
     dvTrial = dvToDo;
@@ -433,10 +433,10 @@ int XC::ForceBeamColumn3d::update(void)
                        const int order= theSections[i]->getOrder();
                        const ID &code = theSections[i]->getType();
 
-                       static Vector Ss;
-                       static Vector dSs;
-                       static Vector dvs;
-                       static Matrix fb;
+                       static thread_local Vector Ss;
+                       static thread_local Vector dSs;
+                       static thread_local Vector dvs;
+                       static thread_local Matrix fb;
 
                         Ss.setData(workArea, order);
                         dSs.setData(&workArea[order], order);
@@ -1169,14 +1169,14 @@ int XC::ForceBeamColumn3d::getInitialFlexibility(Matrix &fe) const
 void XC::ForceBeamColumn3d::compSectionDisplacements(std::vector<Vector> &sectionCoords,std::vector<Vector> &sectionDispls) const
   {
     // get basic displacements and increments
-    static Vector ub(NEBD);
+    static thread_local Vector ub(NEBD);
     ub = theCoordTransf->getBasicTrialDisp();
 
     const double L = theCoordTransf->getInitialLength();
 
     // get integration point positions and weights
     const size_t numSections= getNumSections();
-    static double pts[SectionMatrices::maxNumSections];
+    static thread_local double pts[SectionMatrices::maxNumSections];
     beamIntegr->getSectionLocations(numSections, L, pts);
 
     // setup Vandermode and CBDI influence matrices
@@ -1188,7 +1188,7 @@ void XC::ForceBeamColumn3d::compSectionDisplacements(std::vector<Vector> &sectio
     // get section curvatures
     Vector kappa_y(numSections);  // curvature
     Vector kappa_z(numSections);  // curvature
-    static XC::Vector vs; // section deformations
+    static thread_local XC::Vector vs; // section deformations
 
     for(size_t i=0; i<numSections; i++)
       {
@@ -1222,8 +1222,8 @@ void XC::ForceBeamColumn3d::compSectionDisplacements(std::vector<Vector> &sectio
       }
 
     Vector v(numSections), w(numSections);
-    static XC::Vector xl(NDM), uxb(NDM);
-    static XC::Vector xg(NDM), uxg(NDM);
+    static thread_local XC::Vector xl(NDM), uxb(NDM);
+    static thread_local XC::Vector xg(NDM), uxg(NDM);
     // double theta;                             // angle of twist of the sections
 
     // v = ls * kappa_z;
@@ -1296,9 +1296,9 @@ void XC::ForceBeamColumn3d::Print(std::ostream &s, int flag)
     // flag set to 2 used to print everything .. used for viewing data for UCSD renderer
     else if(flag == 2)
       {
-        static XC::Vector xAxis(3);
-        static XC::Vector yAxis(3);
-        static XC::Vector zAxis(3);
+        static thread_local XC::Vector xAxis(3);
+        static thread_local XC::Vector yAxis(3);
+        static thread_local XC::Vector zAxis(3);
 
         theCoordTransf->getLocalAxes(xAxis, yAxis, zAxis);
 
@@ -1337,8 +1337,8 @@ void XC::ForceBeamColumn3d::Print(std::ostream &s, int flag)
           << T << ' ' << MY2 << ' '  <<  MZ2 << std::endl;
 
         // plastic hinge rotation
-        static XC::Vector vp(6);
-        static XC::Matrix fe(6,6);
+        static thread_local XC::Vector vp(6);
+        static thread_local XC::Matrix fe(6,6);
         this->getInitialFlexibility(fe);
         vp = theCoordTransf->getBasicTrialDisp();
         vp.addMatrixVector(1.0, fe, Se, -1.0);
@@ -1347,8 +1347,8 @@ void XC::ForceBeamColumn3d::Print(std::ostream &s, int flag)
 
         // allocate array of vectors to store section coordinates and displacements
         const size_t numSections= getNumSections();
-	static std::vector<Vector> coords;
-	static std::vector<Vector> displs;
+	static thread_local std::vector<Vector> coords;
+	static thread_local std::vector<Vector> displs;
         coords.resize(numSections);
         displs.resize(numSections);
         for(size_t i= 0;i<numSections;i++)
@@ -1461,8 +1461,8 @@ XC::Response *XC::ForceBeamColumn3d::setResponse(const std::vector<std::string>
 
 int XC::ForceBeamColumn3d::getResponse(int responseID, Information &eleInfo)
   {
-    static XC::Vector vp(6);
-    static XC::Matrix fe(6,6);
+    static thread_local XC::Vector vp(6);
+    static thread_local XC::Matrix fe(6,6);
 
     if(responseID == 1)
       return eleInfo.setVector(this->getResistingForce());
@@ -1517,7 +1517,7 @@ int XC::ForceBeamColumn3d::getResponse(int responseID, Information &eleInfo)
 
   // Point of inflection
   else if(responseID == 5) {
-    static XC::Vector LI(2);
+    static thread_local XC::Vector LI(2);
     LI(0) = 0.0;
     LI(1) = 0.0;
 
@@ -1607,7 +1607,7 @@ int XC::ForceBeamColumn3d::getResponse(int responseID, Information &eleInfo)
     d3z += beamIntegr->getTangentDriftJ(L, LIz, Se(1), Se(2));
     d3y += beamIntegr->getTangentDriftJ(L, LIy, Se(3), Se(4), true);
 
-    static XC::Vector d(4);
+    static thread_local XC::Vector d(4);
     d(0) = d2z;
     d(1) = d3z;
     d(2) = d2y;
@@ -83,7 +83,7 @@ void XC::BeamIntegration::getWeightsDeriv(int nIP, double L, double dLdh,double
 //! @brief Returns the coordenadas normalizadas (entre 0 y 1).
 const XC::Matrix &XC::BeamIntegration::getIntegrPointCoords(int numSections, double L) const
   {
-    static Matrix retval;
+    static thread_local Matrix retval;
     std::vector<double> xi(numSections);
     getSectionLocations(numSections,L,&xi[0]);
     retval= Matrix(&xi[0],numSections,1);
@@ -93,7 +93,7 @@ const XC::Matrix &XC::BeamIntegration::getIntegrPointCoords(int numSections, dou
 //! @brief Returns the coordenadas naturales (entre -1 y 1) a partir de las normalizadas.
 const XC::Matrix &XC::BeamIntegration::getIntegrPointNaturalCoords(int numSections, double L) const
   {
-    static Matrix retval;
+    static thread_local Matrix retval;
     retval= getIntegrPointCoords(numSections,L); //Coordenadas normalizadas.
     for(int i = 0;i<numSections; i++)
       retval(i,1)= 2.0*retval(i,1) - 1.0;
@@ -103,7 +103,7 @@ const XC::Matrix &XC::BeamIntegration::getIntegrPointNaturalCoords(int numSectio
 //! @brief Returns the coordenadas locales (entre 0 y L) a partir de las normalizadas.
 const XC::Matrix &XC::BeamIntegration::getIntegrPointLocalCoords(int numSections, double L) const
   {
-    static Matrix retval;
+    static thread_local Matrix retval;
     retval= getIntegrPointCoords(numSections,L); //Coordenadas normalizadas.
     for(int i = 0;i<numSections; i++)
       retval(i,1)*= L;
@@ -122,7 +122,7 @@ const XC::Matrix &XC::BeamIntegration::getIntegrPointNormalizedCoords(int nIP,co
 const XC::Matrix &XC::BeamIntegration::getIntegrPointLocalCoords(int nIP,const CrdTransf &trf) const
   {
     const Matrix tmp= getIntegrPointLocalCoords(nIP,trf.getInitialLength());
-    static Matrix retval;
+    static thread_local Matrix retval;
     retval.resize(nIP,3);
     retval.Zero();
     for(int i= 0;i<nIP;i++)
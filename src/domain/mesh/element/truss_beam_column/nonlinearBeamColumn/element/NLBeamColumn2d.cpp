@@ -301,8 +301,8 @@ const XC::Matrix &XC::NLBeamColumn2d::getInitialStiff(void) const
         const Matrix &xi_pt  = quadRule.getIntegrPointCoords(nSections);
         const Vector &weight = quadRule.getIntegrPointWeights(nSections);
 
-        static Matrix f(NEBD,NEBD);   // element flexibility matrix
-        static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
+        static thread_local Matrix f(NEBD,NEBD);   // element flexibility matrix
+        static thread_local Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
 
         I.Zero();
         for(size_t i=0; i<NEBD; i++)
@@ -389,7 +389,7 @@ const XC::Matrix &XC::NLBeamColumn2d::getInitialStiff(void) const
         f*= L;
         // calculate element stiffness matrix
         // invert3by3Matrix(f, kv);
-        static Matrix kvInit(NEBD, NEBD);
+        static thread_local Matrix kvInit(NEBD, NEBD);
         if(f.Solve(I, kvInit) < 0)
           std::cerr << "XC::NLBeamColumn2d::getInitialStiff() -- could not invert flexibility\n";
         Ki= Matrix(theCoordTransf->getInitialGlobalStiffMatrix(kvInit));
@@ -412,10 +412,10 @@ int XC::NLBeamColumn2d::update()
 
     // get basic displacements and increments
     const Vector &v = theCoordTransf->getBasicTrialDisp();
-    static Vector dv(NEBD);
+    static thread_local Vector dv(NEBD);
     dv = theCoordTransf->getBasicIncrDeltaDisp();
 
-    static Vector vin(NEBD);
+    static thread_local Vector vin(NEBD);
     vin = v;
     vin -= dv;
 
@@ -426,10 +426,10 @@ int XC::NLBeamColumn2d::update()
     const Matrix &xi_pt  = quadRule.getIntegrPointCoords(nSections);
     const Vector &weight = quadRule.getIntegrPointWeights(nSections);
 
-    static Vector vr(NEBD);       // element residual displacements
-    static Matrix f(NEBD,NEBD);   // element flexibility matrix
+    static thread_local Vector vr(NEBD);       // element residual displacements
+    static thread_local Matrix f(NEBD,NEBD);   // element flexibility matrix
 
-    static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
+    static thread_local Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
     double dW= 0.0;                   // section strain energy (work) norm
 
     I.Zero();
@@ -438,11 +438,11 @@ int XC::NLBeamColumn2d::update()
 
     int numSubdivide = 1;
     bool converged = false;
-    static Vector dSe(NEBD);
-    static Vector dvToDo(NEBD);
-    static Vector dvTrial(NEBD);
-    static Vector SeTrial(NEBD);
-    static Matrix kvTrial(NEBD, NEBD);
+    static thread_local Vector dSe(NEBD);
+    static thread_local Vector dvToDo(NEBD);
+    static thread_local Vector dvTrial(NEBD);
+    static thread_local Vector SeTrial(NEBD);
+    static thread_local Matrix kvTrial(NEBD, NEBD);
 
     dvToDo = dv;
     dvTrial = dvToDo;
@@ -505,10 +505,10 @@ int XC::NLBeamColumn2d::update()
 		      const int order= theSections[i]->getOrder();
 		      const ID &code = theSections[i]->getType();
 
-		      static Vector Ss;
-		      static Vector dSs;
-		      static Vector dvs;
-		      static Matrix fb;
+		      static thread_local Vector Ss;
+		      static thread_local Vector dSs;
+		      static thread_local Vector dvs;
+		      static thread_local Matrix fb;
 
 		      Ss.setData(workArea, order);
 		      dSs.setData(&workArea[order], order);
@@ -1028,7 +1028,7 @@ void XC::NLBeamColumn2d::compSectionDisplacements(std::vector<Vector> &sectionCo
    theCoordTransf->update();
 
    // get basic displacements and increments
-   static Vector ub(NEBD);
+   static thread_local Vector ub(NEBD);
    ub = theCoordTransf->getBasicTrialDisp();
 
    const size_t nSections= getNumSections();
@@ -1073,8 +1073,8 @@ void XC::NLBeamColumn2d::compSectionDisplacements(std::vector<Vector> &sectionCo
        //std::cerr << "kappa: " << kappa;
 
    Vector w(nSections);
-   static XC::Vector xl(NDM), uxb(NDM);
-   static XC::Vector xg(NDM), uxg(NDM);
+   static thread_local XC::Vector xl(NDM), uxb(NDM);
+   static thread_local XC::Vector xg(NDM), uxg(NDM);
 
    // w = ls * kappa;
    w.addMatrixVector (0.0, ls, kappa, 1.0);
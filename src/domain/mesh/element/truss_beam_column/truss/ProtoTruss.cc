@@ -32,26 +32,26 @@
 #include "utility/actor/actor/MatrixCommMetaData.h"
 
 // initialise the class wide variables
- XC::Matrix XC::ProtoTruss::trussM2(2,2);
- XC::Matrix XC::ProtoTruss::trussM3(3,3);
- XC::Matrix XC::ProtoTruss::trussM4(4,4);
- XC::Matrix XC::ProtoTruss::trussM6(6,6);
- XC::Matrix XC::ProtoTruss::trussM12(12,12);
- XC::Vector XC::ProtoTruss::trussV2(2);
- XC::Vector XC::ProtoTruss::trussV3(3);
- XC::Vector XC::ProtoTruss::trussV4(4);
- XC::Vector XC::ProtoTruss::trussV6(6);
- XC::Vector XC::ProtoTruss::trussV12(12);
+thread_local XC::Matrix XC::ProtoTruss::trussM2(2,2);
+thread_local XC::Matrix XC::ProtoTruss::trussM3(3,3);
+thread_local XC::Matrix XC::ProtoTruss::trussM4(4,4);
+thread_local XC::Matrix XC::ProtoTruss::trussM6(6,6);
+thread_local XC::Matrix XC::ProtoTruss::trussM12(12,12);
+thread_local XC::Vector XC::ProtoTruss::trussV2(2);
+thread_local XC::Vector XC::ProtoTruss::trussV3(3);
+thread_local XC::Vector XC::ProtoTruss::trussV4(4);
+thread_local XC::Vector XC::ProtoTruss::trussV6(6);
+thread_local XC::Vector XC::ProtoTruss::trussV12(12);
 
 //! Default constructor.
 XC::ProtoTruss::ProtoTruss(int tag, int classTag,int Nd1,int Nd2,int ndof,int ndim)
-  : Element1D(tag,classTag,Nd1,Nd2),numDOF(ndof),dimSpace(ndim), theMatrix(nullptr), theVector(nullptr)
+  : Element1D(tag,classTag,Nd1,Nd2),numDOF(ndof),dimSpace(ndim)
   {}
 
 
 //! @brief Copy constructor.
 XC::ProtoTruss::ProtoTruss(const ProtoTruss &otro)
-  : Element1D(otro),numDOF(otro.numDOF),dimSpace(otro.dimSpace),theMatrix(otro.theMatrix), theVector(otro.theVector)
+  : Element1D(otro),numDOF(otro.numDOF),dimSpace(otro.dimSpace)
   {}
 
 //! @brief Assignment operator.
@@ -60,8 +60,6 @@ XC::ProtoTruss &XC::ProtoTruss::operator=(const ProtoTruss &otro)
     Element1D::operator=(otro);
     numDOF= otro.numDOF;
     dimSpace= otro.dimSpace;
-    theMatrix= otro.theMatrix;
-    theVector= otro.theVector;
     return *this;
   }
 
@@ -82,39 +80,67 @@ XC::Material &XC::ProtoTruss::getMaterialRef(void)
     return *ptr;
   }
 
-//! @brief Set the number of dof for element and set matrix and vector pointers.
+//! @brief Return the class wide matrix (one for each thread)
+//! that corresponds to the number of DOFs of the element.
+XC::Matrix &XC::ProtoTruss::getClassWideMatrix(void) const
+  {
+    switch(numDOF)
+      {
+      case 2:
+        return trussM2;
+      case 3:
+        return trussM3;
+      case 4:
+        return trussM4;
+      case 12:
+        return trussM12;
+      default:
+        return trussM6;
+      }
+  }
+
+//! @brief Return the class wide vector (one for each thread)
+//! that corresponds to the number of DOFs of the element.
+XC::Vector &XC::ProtoTruss::getClassWideVector(void) const
+  {
+    switch(numDOF)
+      {
+      case 2:
+        return trussV2;
+      case 3:
+        return trussV3;
+      case 4:
+        return trussV4;
+      case 12:
+        return trussV12;
+      default:
+        return trussV6;
+      }
+  }
+
+//! @brief Set the number of dof for element.
 void XC::ProtoTruss::setup_matrix_vector_ptrs(int dofNd1)
   {
     const int numDim= getNumDIM();
     if(numDim == 1 && dofNd1 == 1)
       {
         numDOF = 2;
-        theMatrix = &trussM2;
-        theVector = &trussV2;
       }
     else if(numDim == 2 && dofNd1 == 2)
       {
         numDOF = 4;
-        theMatrix = &trussM4;
-        theVector = &trussV4;
       }
     else if(numDim == 2 && dofNd1 == 3)
       {
         numDOF = 6;
-        theMatrix = &trussM6;
-        theVector = &trussV6;
       }
     else if(numDim == 3 && dofNd1 == 3)
       {
         numDOF = 6;
-        theMatrix = &trussM6;
-        theVector = &trussV6;
       }
     else if(numDim == 3 && dofNd1 == 6)
       {
         numDOF = 12;
-        theMatrix = &trussM12;
-        theVector = &trussV12;
       }
     else
       {
@@ -130,8 +156,6 @@ void XC::ProtoTruss::setup_matrix_vector_ptrs(int dofNd1)
 
         // fill this in so don't segment fault later
         numDOF = 6;
-        theMatrix = &trussM6;
-        theVector = &trussV6;
         return;
       }
   }
@@ -141,8 +165,6 @@ int XC::ProtoTruss::sendData(CommParameters &cp)
   {
     int res= Element1D::sendData(cp);
     res+= cp.sendInts(numDOF,dimSpace,getDbTagData(),CommMetaData(7));
-    res+= cp.sendMatrixPtr(theMatrix,getDbTagData(),MatrixCommMetaData(8,9,10,11)); 
-    res+= cp.sendVectorPtr(theVector,getDbTagData(),ArrayCommMetaData(12,13,14)); 
     return res;
   }
 
@@ -151,7 +173,5 @@ int XC::ProtoTruss::recvData(const CommParameters &cp)
   {
     int res= Element1D::recvData(cp);
     res+= cp.receiveInts(numDOF,dimSpace,getDbTagData(),CommMetaData(7));
-    theMatrix= cp.receiveMatrixPtr(theMatrix,getDbTagData(),MatrixCommMetaData(8,9,10,11)); 
-    theVector= cp.receiveVectorPtr(theVector,getDbTagData(),ArrayCommMetaData(12,13,14)); 
     return res;
   }
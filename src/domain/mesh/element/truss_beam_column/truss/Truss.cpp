@@ -219,8 +219,6 @@ void XC::Truss::setDomain(Domain *theDomain)
       {
         // fill this in so don't segment fault later
         numDOF = 2;
-        theMatrix = &trussM2;
-        theVector = &trussV2;
         return;
       }
 
@@ -237,8 +235,6 @@ void XC::Truss::setDomain(Domain *theDomain)
 
         // fill this in so don't segment fault later
         numDOF = 2;
-        theMatrix = &trussM2;
-        theVector = &trussV2;
         return;
       }
 
@@ -312,14 +308,14 @@ const XC::Matrix &XC::Truss::getTangentStiff(void) const
   {
     if(L == 0.0)
       { // - problem in setDomain() no further warnings
-        theMatrix->Zero();
-        return *theMatrix;
+        getClassWideMatrix().Zero();
+        return getClassWideMatrix();
       }
 
     double E = theMaterial->getTangent();
 
     // come back later and redo this if too slow
-    Matrix &stiff= *theMatrix;
+    Matrix &stiff= getClassWideMatrix();
 
     int numDOF2 = numDOF/2;
     double temp;
@@ -345,14 +341,14 @@ const XC::Matrix &XC::Truss::getInitialStiff(void) const
   {
     if(L == 0.0)
       { // - problem in setDomain() no further warnings
-        theMatrix->Zero();
-        return *theMatrix;
+        getClassWideMatrix().Zero();
+        return getClassWideMatrix();
       }
 
     const double E = theMaterial->getInitialTangent();
 
     // come back later and redo this if too slow
-    Matrix &stiff = *theMatrix;
+    Matrix &stiff = getClassWideMatrix();
 
     int numDOF2 = numDOF/2;
     double temp;
@@ -368,22 +364,22 @@ const XC::Matrix &XC::Truss::getInitialStiff(void) const
     }
 
     if(isDead())
-      (*theMatrix)*=dead_srf;
-    return *theMatrix;
+      getClassWideMatrix()*=dead_srf;
+    return getClassWideMatrix();
   }
 
 //! @brief Returns the matriz de amortiguamiento.
 const XC::Matrix &XC::Truss::getDamp(void) const
   {
     if(L == 0.0) { // - problem in setDomain() no further warnings
-        theMatrix->Zero();
-        return *theMatrix;
+        getClassWideMatrix().Zero();
+        return getClassWideMatrix();
     }
 
     double eta = theMaterial->getDampTangent();
 
     // come back later and redo this if too slow
-    Matrix &damp = *theMatrix;
+    Matrix &damp = getClassWideMatrix();
 
     int numDOF2 = numDOF/2;
     double temp;
@@ -416,7 +412,7 @@ double XC::Truss::getRho(void) const
 const XC::Matrix &XC::Truss::getMass(void) const
   {
     // zero the matrix
-    Matrix &mass= *theMatrix;
+    Matrix &mass= getClassWideMatrix();
     mass.Zero();
 
     const double rho= getRho();
@@ -594,10 +590,11 @@ int XC::Truss::addInertiaLoadSensitivityToUnbalance(const XC::Vector &accel, boo
 //! @brief Returns the reaction of the element.
 const XC::Vector &XC::Truss::getResistingForce(void) const
   {
+    Vector &theVector= getClassWideVector();
     if(L == 0.0)
       { // - problem in setDomain() no further warnings
-        theVector->Zero();
-        return *theVector;
+        theVector.Zero();
+        return theVector;
       }
 
     // R = Ku - Pext
@@ -608,21 +605,22 @@ const XC::Vector &XC::Truss::getResistingForce(void) const
     for(int i = 0; i < getNumDIM(); i++)
       {
         temp = cosX[i]*force;
-        (*theVector)(i) = -temp;
-        (*theVector)(i+numDOF2) = temp;
+        theVector(i) = -temp;
+        theVector(i+numDOF2) = temp;
       }
 
     // subtract external load:  Ku - P
-    (*theVector)-= *getLoad();
+    theVector-= *getLoad();
 
     if(isDead())
-      (*theVector)*=dead_srf;
-    return *theVector;
+      theVector*=dead_srf;
+    return theVector;
   }
 
 //! @brief Returns the reaction of the element includin inertia forces.
 const XC::Vector &XC::Truss::getResistingForceIncInertia(void) const
   {
+    Vector &theVector= getClassWideVector();
     this->getResistingForce();
 
     const double rho= getRho();
@@ -637,23 +635,23 @@ const XC::Vector &XC::Truss::getResistingForceIncInertia(void) const
         const double M = 0.5*rho*L;
         for(int i = 0; i < getNumDIM(); i++)
           {
-            (*theVector)(i) += M*accel1(i);
-            (*theVector)(i+numDOF2) += M*accel2(i);
+            theVector(i) += M*accel1(i);
+            theVector(i+numDOF2) += M*accel2(i);
           }
 
         // add the damping forces if rayleigh damping
         if(!rayFactors.nullValues())
-          (*theVector)+= this->getRayleighDampingForces();
+          theVector+= this->getRayleighDampingForces();
       }
     else
       {
         // add the damping forces if rayleigh damping
         if(!rayFactors.nullKValues())
-          (*theVector) += this->getRayleighDampingForces();
+          theVector += this->getRayleighDampingForces();
       }
     if(isDead())
-      (*theVector)*=dead_srf; //XXX Se aplica 2 veces sobre getResistingForce: arreglar.
-    return *theVector;
+      theVector*=dead_srf; //XXX Se aplica 2 veces sobre getResistingForce: arreglar.
+    return theVector;
   }
 
 //! @brief Returns a vector to store the dbTags
@@ -720,6 +718,7 @@ int XC::Truss::recvSelf(const CommParameters &cp)
 
 void XC::Truss::Print(std::ostream &s, int flag)
   {
+    Vector &theVector= getClassWideVector();
     // compute the strain and axial force in the member
     const double strain = theMaterial->getStrain();
     const double force = A * theMaterial->getStress();
@@ -739,10 +738,10 @@ void XC::Truss::Print(std::ostream &s, int flag)
             for(int i = 0; i < getNumDIM(); i++)
               {
                 temp = cosX[i]*force;
-                (*theVector)(i) = -temp;
-                (*theVector)(i+numDOF2) = temp;
+                theVector(i) = -temp;
+                theVector(i+numDOF2) = temp;
               }
-            s << " \n\t unbalanced load: " << *theVector;
+            s << " \n\t unbalanced load: " << theVector;
           }
         s << " \t XC::Material: " << *theMaterial;
         s << std::endl;
@@ -806,7 +805,7 @@ XC::Response *XC::Truss::setResponse(const std::vector<std::string> &argv, Infor
       return new ElementResponse(this, 2, 0.0);
     // tangent stiffness matrix
     else if(argv[0] == "stiff")
-      return new ElementResponse(this, 3, *theMatrix);
+      return new ElementResponse(this, 3, getClassWideMatrix());
     // a material quantity
     else if(argv[0] == "material" || argv[0] == "-material")
       return  setMaterialResponse(theMaterial,argv,1,eleInfo);
@@ -890,7 +889,7 @@ int XC::Truss::activateParameter(int passedParameterID)
 
 const XC::Matrix &XC::Truss::getKiSensitivity(int gradNumber)
   {
-    Matrix &stiff = *theMatrix;
+    Matrix &stiff = getClassWideMatrix();
     stiff.Zero();
 
     if(parameterID == 0)
@@ -941,7 +940,7 @@ const XC::Matrix &XC::Truss::getKiSensitivity(int gradNumber)
 
 const XC::Matrix &XC::Truss::getMassSensitivity(int gradNumber)
   {
-    Matrix &mass = *theMatrix;
+    Matrix &mass = getClassWideMatrix();
     mass.Zero();
 
     if(parameterID == 2)
@@ -960,7 +959,8 @@ const XC::Matrix &XC::Truss::getMassSensitivity(int gradNumber)
 
 const XC::Vector &XC::Truss::getResistingForceSensitivity(int gradNumber)
   {
-    theVector->Zero();
+    Vector &theVector= getClassWideVector();
+    theVector.Zero();
 
     // Initial declarations
     int i;
@@ -1067,15 +1067,15 @@ const XC::Vector &XC::Truss::getResistingForceSensitivity(int gradNumber)
     if(parameterID == 1) {            // Cross-sectional area
       for(i = 0; i < getNumDIM(); i++) {
         temp = (stress + A*stressSensitivity)*cosX[i];
-        (*theVector)(i) = -temp;
-        (*theVector)(i+numDOF2) = temp;
+        theVector(i) = -temp;
+        theVector(i+numDOF2) = temp;
       }
     }
     else {        // Density, material parameter or nodal coordinate
       for(i = 0; i < getNumDIM(); i++) {
         temp = A*(stressSensitivity*cosX[i] + stress*dcosXdh[i]);
-        (*theVector)(i) = -temp;
-        (*theVector)(i+numDOF2) = temp;
+        theVector(i) = -temp;
+        theVector(i+numDOF2) = temp;
       }
     }
 
@@ -1083,9 +1083,9 @@ const XC::Vector &XC::Truss::getResistingForceSensitivity(int gradNumber)
     if(!theLoadSens)
       set_load_sens(Vector(numDOF));
 
-    (*theVector)-= *theLoadSens;
+    theVector-= *theLoadSens;
 
-    return *theVector;
+    return theVector;
   }
 
 int XC::Truss::commitSensitivity(int gradNumber, int numGrads)
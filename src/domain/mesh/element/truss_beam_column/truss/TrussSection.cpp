@@ -159,8 +159,6 @@ void XC::TrussSection::setDomain(Domain *theDomain)
 
       // fill this in so don't segment fault later
       numDOF = 2;
-      theMatrix = &trussM2;
-      theVector = &trussV2;
 
       return;
     }
@@ -175,8 +173,6 @@ void XC::TrussSection::setDomain(Domain *theDomain)
 
       // fill this in so don't segment fault later
       numDOF = 2;
-      theMatrix = &trussM2;
-      theVector = &trussV2;
 
       return;
     }
@@ -241,8 +237,8 @@ int XC::TrussSection::update(void)
 const XC::Matrix &XC::TrussSection::getTangentStiff(void) const
   {
     if(L == 0.0) { // - problem in setDomain() no further warnings
-        theMatrix->Zero();
-        return *theMatrix;
+        getClassWideMatrix().Zero();
+        return getClassWideMatrix();
     }
 
     int order = theSection->getOrder();
@@ -257,7 +253,7 @@ const XC::Matrix &XC::TrussSection::getTangentStiff(void) const
     }
 
     // come back later and redo this if too slow
-    Matrix &stiff = *theMatrix;
+    Matrix &stiff = getClassWideMatrix();
 
     int numDOF2 = numDOF/2;
     double temp;
@@ -273,15 +269,15 @@ const XC::Matrix &XC::TrussSection::getTangentStiff(void) const
     }
 
     if(isDead())
-      (*theMatrix)*=dead_srf;
-    return *theMatrix;
+      getClassWideMatrix()*=dead_srf;
+    return getClassWideMatrix();
   }
 
 const XC::Matrix &XC::TrussSection::getInitialStiff(void) const
   {
     if(L == 0.0) { // - problem in setDomain() no further warnings
-        theMatrix->Zero();
-        return *theMatrix;
+        getClassWideMatrix().Zero();
+        return getClassWideMatrix();
     }
 
     int order = theSection->getOrder();
@@ -296,7 +292,7 @@ const XC::Matrix &XC::TrussSection::getInitialStiff(void) const
     }
 
     // come back later and redo this if too slow
-    Matrix &stiff = *theMatrix;
+    Matrix &stiff = getClassWideMatrix();
 
     int numDOF2 = numDOF/2;
     double temp;
@@ -312,8 +308,8 @@ const XC::Matrix &XC::TrussSection::getInitialStiff(void) const
     }
 
     if(isDead())
-      (*theMatrix)*=dead_srf;
-    return *theMatrix;
+      getClassWideMatrix()*=dead_srf;
+    return getClassWideMatrix();
   }
 
 const XC::Material *XC::TrussSection::getMaterial(void) const
@@ -328,7 +324,7 @@ double XC::TrussSection::getRho(void) const
 const XC::Matrix &XC::TrussSection::getMass(void) const
   {
     // zero the matrix
-    Matrix &mass = *theMatrix;
+    Matrix &mass = getClassWideMatrix();
     mass.Zero();
 
     const double rho= getRho();
@@ -402,9 +398,10 @@ int XC::TrussSection::addInertiaLoadToUnbalance(const XC::Vector &accel)
 
 const XC::Vector &XC::TrussSection::getResistingForce(void) const
   {
+    Vector &theVector= getClassWideVector();
     if(L == 0.0) { // - problem in setDomain() no further warnings
-        theVector->Zero();
-        return *theVector;
+        theVector.Zero();
+        return theVector;
     }
 
     int order = theSection->getOrder();
@@ -422,22 +419,23 @@ const XC::Vector &XC::TrussSection::getResistingForce(void) const
     double temp;
     for(i = 0; i < getNumDIM(); i++) {
       temp = cosX[i]*force;
-      (*theVector)(i) = -temp;
-      (*theVector)(i+numDOF2) = temp;
+      theVector(i) = -temp;
+      theVector(i+numDOF2) = temp;
     }
 
     // add P
-    (*theVector)-= *getLoad();
+    theVector-= *getLoad();
 
     if(isDead())
-      (*theVector)*=dead_srf;
-    return *theVector;
+      theVector*=dead_srf;
+    return theVector;
   }
 
 
 
 const XC::Vector &XC::TrussSection::getResistingForceIncInertia(void) const
   {
+    Vector &theVector= getClassWideVector();
     this->getResistingForce();
     const double rho= getRho();
     // now include the mass portion
@@ -451,18 +449,18 @@ const XC::Vector &XC::TrussSection::getResistingForceIncInertia(void) const
         const int start = numDOF/2;
         for(int i=0; i<dof; i++)
           {
-            (*theVector)(i)+= M*accel1(i);
-            (*theVector)(i+start)+= M*accel2(i);
+            theVector(i)+= M*accel1(i);
+            theVector(i+start)+= M*accel2(i);
           }
       }
 
     // add the damping forces if rayleigh damping
     if(!rayFactors.nullValues())
-      *theVector+= this->getRayleighDampingForces();
+      theVector+= this->getRayleighDampingForces();
 
     if(isDead())
-      (*theVector)*=dead_srf; //XXX Se aplica 2 veces sobre getResistingForce: arreglar.
-    return *theVector;
+      theVector*=dead_srf; //XXX Se aplica 2 veces sobre getResistingForce: arreglar.
+    return theVector;
   }
 
 //! @brief Send members through the channel being passed as parameter.
@@ -507,6 +505,7 @@ int XC::TrussSection::recvSelf(const CommParameters &cp)
 
 void XC::TrussSection::Print(std::ostream &s, int flag)
   {
+    Vector &theVector= getClassWideVector();
     // compute the strain and axial force in the member
     double strain, force= 0.0;
     if(L == 0.0)
@@ -542,8 +541,8 @@ void XC::TrussSection::Print(std::ostream &s, int flag)
     int numDOF2 = numDOF/2;
     for(int i=0; i<getNumDIM(); i++) {
       temp = force*cosX[i];
-      (*theVector)(i) = -force;
-      (*theVector)(i+numDOF2) = force;
+      theVector(i) = -force;
+      theVector(i+numDOF2) = force;
     }
 
     if(flag == 0) { // print everything
@@ -553,8 +552,7 @@ void XC::TrussSection::Print(std::ostream &s, int flag)
 
         s << " \n\t strain: " << strain;
         s << " axial load: " << force;
-        if(theVector != 0)
-            s << " \n\t unbalanced load: " << *theVector;
+        s << " \n\t unbalanced load: " << theVector;
         s << " \t Section: " << *theSection;
         s << std::endl;
     } else if(flag == 1) {
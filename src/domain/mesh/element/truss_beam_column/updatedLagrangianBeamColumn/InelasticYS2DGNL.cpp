@@ -47,11 +47,11 @@
 #define TAG_InelasticYS2DGNL -1
 
 // Vector XC::InelasticYS2DGNL::trialForce(6);
- XC::Vector XC::InelasticYS2DGNL::elasticForce(6);
- XC::Vector XC::InelasticYS2DGNL::F1(6);
- XC::Vector XC::InelasticYS2DGNL::F2(6);
- XC::Vector XC::InelasticYS2DGNL::Fs(6);
-double XC::InelasticYS2DGNL::storage(0);
+thread_local XC::Vector XC::InelasticYS2DGNL::elasticForce(6);
+thread_local XC::Vector XC::InelasticYS2DGNL::F1(6);
+thread_local XC::Vector XC::InelasticYS2DGNL::F2(6);
+thread_local XC::Vector XC::InelasticYS2DGNL::Fs(6);
+thread_local double XC::InelasticYS2DGNL::storage(0);
 
 const int XC::InelasticYS2DGNL::INSIDE(-1);
 const int XC::InelasticYS2DGNL::WITHIN(0);
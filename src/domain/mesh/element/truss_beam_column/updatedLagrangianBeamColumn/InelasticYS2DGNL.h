@@ -43,8 +43,8 @@ namespace XC {
 class InelasticYS2DGNL : public UpdatedLagrangianBeam2D
 {
  protected:
-  static Vector elasticForce;
-  static Vector F1, F2, Fs;
+  static thread_local Vector elasticForce;
+  static thread_local Vector F1, F2, Fs;
   
 
   YieldSurface_BC *ys1, *ys2;
@@ -67,7 +67,7 @@ class InelasticYS2DGNL : public UpdatedLagrangianBeam2D
   
   const static int INSIDE, OUTSIDE, WITHIN;
   
-  static double storage;
+  static thread_local double storage;
  public:
   InelasticYS2DGNL(int tag, 
 		   int Nd1, int Nd2,
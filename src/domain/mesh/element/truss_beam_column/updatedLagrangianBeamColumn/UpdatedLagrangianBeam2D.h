@@ -95,22 +95,22 @@ class UpdatedLagrangianBeam2D : public Element1D
 
     mutable Matrix *Ki;
 
-    static Matrix K, Kg, Kt; // stiffness matrices
-    static Matrix M; // mass matrix
-    static Matrix D; // damping matrix
-    static Matrix T; // transformation matrix
+    static thread_local Matrix K, Kg, Kt; // stiffness matrices
+    static thread_local Matrix M; // mass matrix
+    static thread_local Matrix D; // damping matrix
+    static thread_local Matrix T; // transformation matrix
     
-    static Vector disp;
-    static Vector force;
+    static thread_local Vector disp;
+    static thread_local Vector force;
     
     // ZeroVector and ZeroMatrix should always have zero value,
     // used for quick return
-    static Vector ZeroVector;
-    static Matrix ZeroMatrix;
+    static thread_local Vector ZeroVector;
+    static thread_local Matrix ZeroMatrix;
     
     // used for temporarily storing nodal displacements
-    static Vector end1IncrDisp;
-    static Vector end2IncrDisp;
+    static thread_local Vector end1IncrDisp;
+    static thread_local Vector end2IncrDisp;
     
     virtual void  getLocalStiff(Matrix &K) const=0;
     virtual void  getLocalMass(Matrix &M) const=0;
@@ -29,9 +29,9 @@
 #include "QuadraticCyclic.h"
 #include <cmath>
 
-XC::Matrix XC::QuadraticCyclic::X(3,3);
-XC::Vector XC::QuadraticCyclic::Y(3);
-XC::Vector XC::QuadraticCyclic::A(3);
+thread_local XC::Matrix XC::QuadraticCyclic::X(3,3);
+thread_local XC::Vector XC::QuadraticCyclic::Y(3);
+thread_local XC::Vector XC::QuadraticCyclic::A(3);
 
 XC::QuadraticCyclic::QuadraticCyclic(int tag, double wt, double fac_y)
 :CyclicModel(tag, -1), weightFactor(wt), facty(fac_y),
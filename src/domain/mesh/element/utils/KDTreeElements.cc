@@ -28,59 +28,126 @@
 
 #include "KDTreeElements.h"
 #include "domain/mesh/element/Element.h"
+#include "domain/mesh/node/Node.h"
+#include "domain/mesh/element/utils/NodePtrsWithIDs.h"
 #include "xc_utils/src/geom/pos_vec/Pos3d.h"
+#include "xc_utils/src/geom/pos_vec/Pos2d.h"
+#include "xc_utils/src/geom/pos_vec/Vector3d.h"
+#include "xc_utils/src/geom/d3/GeomObj3d.h"
+#include "xc_utils/src/geom/d2/GeomObj2d.h"
 
-//! @brief Constructor.
-XC::ElemPos::ElemPos(const Element &e)
-  :  KDTreePos(e.getPosCdg()), elemPtr(&e){}
-
-//! @brief Constructor.
-XC::ElemPos::ElemPos(const Pos3d &p)
-  : KDTreePos(p), elemPtr(nullptr) {}
-  
-//! @brief Constructor.
-XC::KDTreeElements::KDTreeElements(void)
-  : tree_type(std::ptr_fun(ElemPos::tac)), pend_optimizar(0) {}
+namespace {
+  //! @brief Returns the candidates whose nodes (initial positions)
+  //! all satisfy the predicate.
+  template <class Pred>
+  XC::KDTreeElements::ptr_vector all_nodes_satisfy(const XC::KDTreeElements::ptr_vector &candidates,Pred pred)
+    {
+      XC::KDTreeElements::ptr_vector retval;
+      retval.reserve(candidates.size());
+      for(XC::KDTreeElements::ptr_vector::const_iterator i= candidates.begin();i!=candidates.end();i++)
+        {
+          const XC::NodePtrs &nodes= (*i)->getNodePtrs();
+          bool ok= true;
+          for(XC::NodePtrs::const_iterator j= nodes.begin();j!=nodes.end();j++)
+            if(*j && !pred((*j)->getInitialPosition3d()))
+              { ok= false; break; }
+          if(ok)
+            retval.push_back(*i);
+        }
+      return retval;
+    }
+}
 
+//! @brief Return the position of the element used in the index.
+Pos3d XC::ElementPositionTraits::getPosition(const Element &e)
+  { return e.getPosCdg(true); }
 
-void XC::KDTreeElements::insert(const Element &n)
+//! @brief Return the move counter value when any of the element
+//! nodes was last moved.
+size_t XC::ElementPositionTraits::getPositionStamp(const Element &e)
   {
-    tree_type::insert(n);
+    size_t retval= 0;
+    const NodePtrs &nodes= e.getNodePtrs();
+    for(NodePtrs::const_iterator i= nodes.begin();i!=nodes.end();i++)
+      if(*i)
+        retval= std::max(retval,(*i)->getPositionStamp());
+    return retval;
   }
 
-void XC::KDTreeElements::erase(const Element &n)
+//! @brief Return the current value of the node move counter.
+size_t XC::ElementPositionTraits::getMoveCounter(void)
+  { return Node::getMoveCounter(); }
+
+//! @brief Append the elements connected to the nodes moved since the
+//! move counter had the value being passed as parameter (false if
+//! those nodes are not known).
+bool XC::ElementPositionTraits::getMovedSince(const size_t &counter,std::vector<const Element *> &moved)
   {
-    tree_type::erase(n);
-    pend_optimizar++;
-    if(pend_optimizar>=10)
+    std::vector<const Node *> movedNodes;
+    const bool retval= Node::getMovedSince(counter,movedNodes);
+    for(std::vector<const Node *>::const_iterator i= movedNodes.begin();i!=movedNodes.end();i++)
       {
-	tree_type::optimise();
-        pend_optimizar= 0;
+        const Node::ElementConstPtrSet elements= (*i)->getConnectedElements();
+        moved.insert(moved.end(),elements.begin(),elements.end());
       }
+    return retval;
+  }
+
+//! @brief Constructor.
+XC::KDTreeElements::KDTreeElements(void)
+  : tree_type() {}
+
+//! @brief Returns the elements inside the box defined by its corners.
+XC::KDTreeElements::ptr_vector XC::KDTreeElements::getInsideBox(const Pos3d &pMin,const Pos3d &pMax) const
+  {
+    const SpatialIndexBox bnd(pMin,pMax);
+    return all_nodes_satisfy(tree_type::getInsideBox(bnd),[&bnd](const Pos3d &p)
+                               {
+                                 const double x[3]= {p.x(),p.y(),p.z()};
+                                 return bnd.In(x);
+                               });
   }
 
-void XC::KDTreeElements::clear(void)
-  { tree_type::clear(); }
+//! @brief Returns the elements that lie in the half space bounded by
+//! the plane that passes through org with outward normal n.
+//!
+//! @param org: point of the boundary plane.
+//! @param n: outward normal of the boundary plane.
+//! @param tol: tolerance.
+XC::KDTreeElements::ptr_vector XC::KDTreeElements::getInsideHalfSpace(const Pos3d &org,const Vector3d &n,const double &tol) const
+  {
+    const double nn[3]= {n.x(),n.y(),n.z()};
+    const double lim= nn[0]*org.x()+nn[1]*org.y()+nn[2]*org.z()+tol*sqrt(nn[0]*nn[0]+nn[1]*nn[1]+nn[2]*nn[2]);
+    return all_nodes_satisfy(tree_type::getInsideHalfSpace(org,nn,tol),[&nn,lim](const Pos3d &p)
+                               { return (nn[0]*p.x()+nn[1]*p.y()+nn[2]*p.z())<=lim; });
+  }
 
-//! @brief Returns the node closest to the position being passed as parameter.
-const XC::Element *XC::KDTreeElements::getNearest(const Pos3d &pos) const
+//! @brief Returns the elements whose nodes (initial positions)
+//! lie inside the geometric object. The bounding box of the object
+//! is used to select the candidates.
+//!
+//! @param geomObj: geometric object that must contain the elements.
+//! @param tol: tolerance for "In" function.
+XC::KDTreeElements::ptr_vector XC::KDTreeElements::getInside(const GeomObj3d &geomObj,const double &tol) const
   {
-    const Element *retval= nullptr;
-    ElemPos target(pos);
-    std::pair<tree_type::const_iterator,double> found = find_nearest(target);
-    if(found.first != end())
-      retval= found.first->getElementPtr();
-    return retval;
+    SpatialIndexBox bnd(geomObj);
+    bnd.expand(tol);
+    return all_nodes_satisfy(tree_type::getInsideBox(bnd),[&geomObj,tol](const Pos3d &p)
+                               { return geomObj.In(p,tol); });
   }
 
-//! @brief Returns the element closest to the position
-//! being passed as parameter.
-const XC::Element *XC::KDTreeElements::getNearest(const Pos3d &pos, const double &r) const
+//! @brief Returns the elements inside the prism obtained by extruding
+//! the 2D object (defined on the XY plane) between zMin and zMax.
+//!
+//! @param geomObj: prism base (polygon, circle,...).
+//! @param zMin: minimum z of the prism.
+//! @param zMax: maximum z of the prism.
+//! @param tol: tolerance for "In" function.
+XC::KDTreeElements::ptr_vector XC::KDTreeElements::getInsidePrism(const GeomObj2d &geomObj,const double &zMin,const double &zMax,const double &tol) const
   {
-    const Element *retval= nullptr;
-    ElemPos target(pos);
-    std::pair<tree_type::const_iterator,double> found = find_nearest(target,r);
-    if(found.first != end())
-      retval= found.first->getElementPtr();
-    return retval;
+    SpatialIndexBox bnd(geomObj,zMin,zMax);
+    bnd.expand(tol);
+    const double z0= bnd.getMin(2), z1= bnd.getMax(2);
+    return all_nodes_satisfy(tree_type::getInsideBox(bnd),[&geomObj,z0,z1,tol](const Pos3d &p)
+                               { return (p.z()>=z0) && (p.z()<=z1) && geomObj.In(Pos2d(p.x(),p.y()),tol); });
   }
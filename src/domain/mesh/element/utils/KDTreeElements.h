@@ -28,47 +28,47 @@
 #ifndef KDTreeElements_h
 #define KDTreeElements_h
 
-#include "xc_utils/src/geom/pos_vec/KDTreePos.h"
-#include "xc_basic/src/kdtree++/kdtree.hpp"
+#include "utility/spatial_index/SpatialIndex3d.h"
 
 class Pos3d;
+class Vector3d;
+class GeomObj3d;
+class GeomObj2d;
 
 namespace XC {
 class Element;
 
 //! \ingroup FEMisc
 //
-//! @brief Element position for KDTree building.
-class ElemPos: public KDTreePos
+//! @brief Access to the element positions (centroids) from the
+//! spatial index.
+struct ElementPositionTraits
   {
-  private:
-    const Element *elemPtr;
-  public:
-    ElemPos(const Element &);
-    explicit ElemPos(const Pos3d &p);
-    inline const Element *getElementPtr(void) const
-      { return elemPtr; }
-
-    static inline double tac( ElemPos p, size_t k ) { return p[k]; }
+    static Pos3d getPosition(const Element &);
+    static size_t getPositionStamp(const Element &);
+    static size_t getMoveCounter(void);
+    static bool getMovedSince(const size_t &,std::vector<const Element *> &);
   };
 
-inline bool operator==(const ElemPos &A,const ElemPos &B)
-  { return ((A.getElementPtr()== B.getElementPtr()) && (A[0] == B[0]) && (A[1] == B[1]) && (A[2] == B[2])); }
-
-
-class KDTreeElements: protected kd_tree::KDTree<3, ElemPos, std::pointer_to_binary_function<ElemPos,size_t,double> >
+//! \ingroup FEMisc
+//
+//! @brief Balanced kd-tree over the element centroids (initial geometry).
+//!
+//! The queries for regions (box, half space, geometric object, prism)
+//! return the elements whose nodes lie all inside the region; the
+//! centroids are used only to select the candidates. The elements
+//! whose nodes have been moved since the last query are relocated
+//! automatically.
+class KDTreeElements: public SpatialIndex3d<Element,ElementPositionTraits>
   {
-    size_t pend_optimizar;
   public:
-    typedef kd_tree::KDTree<3, ElemPos, std::pointer_to_binary_function<ElemPos,size_t,double> > tree_type;
+    typedef SpatialIndex3d<Element,ElementPositionTraits> tree_type;
     KDTreeElements(void);
 
-    void insert(const Element &);
-    void erase(const Element &);
-    void clear(void);
-
-    const Element *getNearest(const Pos3d &pos) const;
-    const Element *getNearest(const Pos3d &pos, const double &r) const;
+    ptr_vector getInsideBox(const Pos3d &,const Pos3d &) const;
+    ptr_vector getInsideHalfSpace(const Pos3d &,const Vector3d &,const double &tol= 0.0) const;
+    ptr_vector getInside(const GeomObj3d &,const double &tol= 0.0) const;
+    ptr_vector getInsidePrism(const GeomObj2d &,const double &,const double &,const double &tol= 0.0) const;
   };
 
 } // end of XC namespace 
@@ -256,7 +256,7 @@ double XC::NodePtrs::MinCooNod(int icoo) const
 //! @brief Returns a vector con los tags of the nodes.
 const std::vector<int> &XC::NodePtrs::getTags(void) const
   {
-    static std::vector<int> retval;
+    static thread_local std::vector<int> retval;
     const size_t sz= size();
     retval.resize(sz);
     for(size_t i=0; i<sz; i++)
@@ -328,7 +328,7 @@ size_t XC::NodePtrs::getDimension(void) const
 //! @brief Returns a matriz con las coordinates of the nodes.
 const XC::Matrix &XC::NodePtrs::getCoordinates(void) const
   {
-    static Matrix retval;
+    static thread_local Matrix retval;
     const size_t sz= size();
     const size_t dim= getDimension();
     retval= Matrix(sz,dim);
@@ -90,13 +90,13 @@ class CorotCrdTransf3d: public CrdTransf3d
     Vector ulcommit; //!< commited local displacements
     Vector ulpr; //!< previous local displacements
     
-    static Matrix RI; //!< nodal triad for node 1
-    static Matrix RJ; //!< nodal triad for node 2
-    static Matrix Rbar; //!< mean nodal triad 
-    static Matrix e; //!< base vectors
+    static thread_local Matrix RI; //!< nodal triad for node 1
+    static thread_local Matrix RJ; //!< nodal triad for node 2
+    static thread_local Matrix Rbar; //!< mean nodal triad 
+    static thread_local Matrix e; //!< base vectors
     static Matrix Tp; //!< transformation matrix to renumber dofs
-    static Matrix T; //!< transformation matrix from basic to global system
-    static Matrix Lr2, Lr3, A; //!< auxiliary matrices	
+    static thread_local Matrix T; //!< transformation matrix from basic to global system
+    static thread_local Matrix Lr2, Lr3, A; //!< auxiliary matrices	
 
     inline int computeElemtLengthAndOrient(void) const
       {
@@ -90,10 +90,10 @@ class CrdTransf3d: public CrdTransf
     void calc_Wu(const double *ug,double *ul,double *Wu) const;
     const Vector &calc_ub(const double *ul,Vector &) const;
 
-    static Vector vectorI;
-    static Vector vectorJ;
-    static Vector vectorK;
-    static Vector vectorCoo;
+    static thread_local Vector vectorI;
+    static thread_local Vector vectorJ;
+    static thread_local Vector vectorK;
+    static thread_local Vector vectorCoo;
     virtual int computeElemtLengthAndOrient(void) const= 0;
     virtual int calculaEjesLocales(void) const= 0;
 
@@ -108,8 +108,8 @@ int XC::PDeltaCrdTransf2d::revertToStart(void)
 
 int XC::PDeltaCrdTransf2d::update(void)
   {
-    static Vector nodeIDisp(3);
-    static Vector nodeJDisp(3);
+    static thread_local Vector nodeIDisp(3);
+    static thread_local Vector nodeJDisp(3);
     nodeIDisp = nodeIPtr->getTrialDisp();
     nodeJDisp = nodeJPtr->getTrialDisp();
     
@@ -146,7 +146,7 @@ int XC::PDeltaCrdTransf2d::update(void)
 const XC::Vector &XC::PDeltaCrdTransf2d::getGlobalResistingForce(const XC::Vector &pb, const XC::Vector &p0) const
   {
     // transform resisting forces from the basic system to local coordinates
-    static double pl[6];
+    static thread_local double pl[6];
     
     double q0 = pb(0);
     double q1 = pb(1);
@@ -173,7 +173,7 @@ const XC::Vector &XC::PDeltaCrdTransf2d::getGlobalResistingForce(const XC::Vecto
     pl[4] -= NoverL;
     
     // transform resisting forces  from local to global coordinates
-    static XC::Vector pg(6);
+    static thread_local XC::Vector pg(6);
     
     pg(0) = cosTheta*pl[0] - sinTheta*pl[1];
     pg(1) = sinTheta*pl[0] + cosTheta*pl[1];
@@ -200,12 +200,12 @@ const XC::Vector &XC::PDeltaCrdTransf2d::getGlobalResistingForce(const XC::Vecto
 
 const XC::Matrix &XC::PDeltaCrdTransf2d::getGlobalStiffMatrix(const XC::Matrix &kb, const XC::Vector &pb) const
   {
-    static XC::Matrix kg(6,6);
+    static thread_local XC::Matrix kg(6,6);
     
     const double oneOverL = 1.0/L;
     
     // Transform basic stiffness to local system
-    static Matrix kl(6,6);
+    static thread_local Matrix kl(6,6);
     kl(0,0)=  kb(0,0);
     kl(1,0)= -oneOverL*(kb(1,0)+kb(2,0));
     kl(2,0)= -kb(1,0);
@@ -262,7 +262,7 @@ const XC::Matrix &XC::PDeltaCrdTransf2d::getGlobalStiffMatrix(const XC::Matrix &
     const double t45= T45();
     
     // Now transform from local to global ... compute kl*T
-    static Matrix tmp(6,6);
+    static thread_local Matrix tmp(6,6);
     tmp(0,0) = kl(0,0)*cosTheta - kl(0,1)*sinTheta;
     tmp(1,0) = kl(1,0)*cosTheta - kl(1,1)*sinTheta;
     tmp(2,0) = kl(2,0)*cosTheta - kl(2,1)*sinTheta;
@@ -371,7 +371,7 @@ const XC::Matrix &XC::PDeltaCrdTransf2d::getInitialGlobalStiffMatrix (const XC::
     const bool nodeIOffsetNotZero= (nodeIOffset.Norm2()>0.0);
     const bool nodeJOffsetNotZero= (nodeJOffset.Norm2()>0.0);
 
-    static Matrix tmp(6,6);
+    static thread_local Matrix tmp(6,6);
     tmp(0,0) = -cosTheta*kb(0,0) - sl*(kb(0,1)+kb(0,2));
     tmp(0,1) = -sinTheta*kb(0,0) + cl*(kb(0,1)+kb(0,2));
     tmp(0,2) = (nodeIOffsetNotZero) ? t02*kb(0,0) + t12*kb(0,1) + t22*kb(0,2) : kb(0,1);
@@ -393,7 +393,7 @@ const XC::Matrix &XC::PDeltaCrdTransf2d::getInitialGlobalStiffMatrix (const XC::
     tmp(2,4) = -tmp(2,1);
     tmp(2,5) = (nodeJOffsetNotZero) ? t05*kb(2,0) + t15*kb(2,1) + t25*kb(2,2) : kb(2,2);
     
-    static Matrix kg(6,6);
+    static thread_local Matrix kg(6,6);
     kg(0,0) = -cosTheta*tmp(0,0) - sl*(tmp(1,0)+tmp(2,0));
     kg(0,1) = -cosTheta*tmp(0,1) - sl*(tmp(1,1)+tmp(2,1));
     kg(0,2) = -cosTheta*tmp(0,2) - sl*(tmp(1,2)+tmp(2,2));
@@ -66,7 +66,7 @@ class FVectorData: public FVector
 template <size_t SZ>
 const Vector &FVectorData<SZ>::getVector(void) const
   {
-    static Vector retval(SZ);
+    static thread_local Vector retval(SZ);
     double *tmp= const_cast<double *>(p);
     retval= Vector(tmp,SZ);
     return retval;
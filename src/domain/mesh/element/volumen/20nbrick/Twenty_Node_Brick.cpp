@@ -67,19 +67,19 @@
 
 namespace XC{
 //static data
-double  XC::Twenty_Node_Brick::xl[3][20] ;
+thread_local double  XC::Twenty_Node_Brick::xl[3][20] ;
 
-XC::Matrix  XC::Twenty_Node_Brick::stiff(60,60) ;
-XC::Vector  XC::Twenty_Node_Brick::resid(60) ;
-XC::Matrix  XC::Twenty_Node_Brick::mass(60,60) ;
-XC::Matrix  XC::Twenty_Node_Brick::damp(60,60) ;
+thread_local XC::Matrix  XC::Twenty_Node_Brick::stiff(60,60) ;
+thread_local XC::Vector  XC::Twenty_Node_Brick::resid(60) ;
+thread_local XC::Matrix  XC::Twenty_Node_Brick::mass(60,60) ;
+thread_local XC::Matrix  XC::Twenty_Node_Brick::damp(60,60) ;
 
 const int XC::Twenty_Node_Brick::nintu=27;
 const int XC::Twenty_Node_Brick::nenu=20;
-double XC::Twenty_Node_Brick::shgu[4][20][27];
+thread_local double XC::Twenty_Node_Brick::shgu[4][20][27];
 double XC::Twenty_Node_Brick::shlu[4][20][27];
 double XC::Twenty_Node_Brick::wu[27];
-double XC::Twenty_Node_Brick::dvolu[27];
+thread_local double XC::Twenty_Node_Brick::dvolu[27];
 }
 
 //null constructor
@@ -160,8 +160,8 @@ void  XC::Twenty_Node_Brick::Print( std::ostream &s, int flag )
                 }
 
                 // spit out the section location & invoke print on the scetion
-                static Vector avgStress(7);
-                static Vector avgStrain(nstress);
+                static thread_local Vector avgStress(7);
+                static thread_local Vector avgStrain(nstress);
                 avgStress= physicalProperties.getCommittedAvgStress();
                 avgStrain= physicalProperties.getCommittedAvgStrain();
 
@@ -216,9 +216,9 @@ int
 XC::Twenty_Node_Brick::update()
 {
         int i, j;
-        static double u[3][20];
-        static double xsj;
-        static XC::Matrix B(6, 3);
+        static thread_local double u[3][20];
+        static thread_local double xsj;
+        static thread_local XC::Matrix B(6, 3);
         double volume = 0.;
 
         for(i = 0; i < nenu; i++) {
@@ -228,7 +228,7 @@ XC::Twenty_Node_Brick::update()
              u[2][i] = disp(2);
     }
 
-        static XC::Vector eps(6);
+        static thread_local XC::Vector eps(6);
 
         int ret = 0;
 
@@ -304,7 +304,7 @@ XC::Twenty_Node_Brick::update()
 //return tangent stiffness matrix
 const XC::Matrix &XC::Twenty_Node_Brick::getTangentStiff(void) const
   {
-    static Matrix K;
+    static thread_local Matrix K;
     K= getStiff(1);
     if(isDead())
       K*=dead_srf;
@@ -314,7 +314,7 @@ const XC::Matrix &XC::Twenty_Node_Brick::getTangentStiff(void) const
 // return initial stiffness matrix
 const XC::Matrix &XC::Twenty_Node_Brick::getInitialStiff(void) const
   {
-    static Matrix K;
+    static thread_local Matrix K;
     K= getStiff(0);
     if(isDead())
       K*=dead_srf;
@@ -334,13 +334,13 @@ const XC::Matrix&  XC::Twenty_Node_Brick::getStiff(int flag) const
 
         int i, j ;
 
-        static double xsj ;  // determinant jacaobian matrix
+        static thread_local double xsj ;  // determinant jacaobian matrix
         double volume = 0.;
         //-------------------------------------------------------
         int j3, j3m1, j3m2;
-        static XC::Matrix B(6,nenu*3);
-        static XC::Matrix BTDB(nenu*3,nenu*3);
-        static XC::Matrix D(6, 6);
+        static thread_local XC::Matrix B(6,nenu*3);
+        static thread_local XC::Matrix BTDB(nenu*3,nenu*3);
+        static thread_local XC::Matrix D(6, 6);
         B.Zero();
         BTDB.Zero();
         stiff.Zero();
@@ -489,7 +489,7 @@ int XC::Twenty_Node_Brick::addLoad(ElementalLoad *theLoad, double loadFactor)
 
 int XC::Twenty_Node_Brick::addInertiaLoadToUnbalance(const XC::Vector &accel)
 {
-        static XC::Vector ra(60);
+        static thread_local XC::Vector ra(60);
 //        printf("calling addInertiaLoadToUnbalance()\n");
         ra.Zero();
 
@@ -530,7 +530,7 @@ const XC::Vector &XC::Twenty_Node_Brick::getResistingForce(void) const
   {
         int i, j, k, k1;
         double xsj;
-        static XC::Matrix B(6, 3);
+        static thread_local XC::Matrix B(6, 3);
         double volume = 0.;
 
 //        printf("calling getResistingForce()\n");
@@ -610,12 +610,12 @@ const XC::Vector &XC::Twenty_Node_Brick::getResistingForce(void) const
 //get residual with inertia terms
 const XC::Vector &XC::Twenty_Node_Brick::getResistingForceIncInertia(void) const
   {
-        static XC::Vector res(60);
+        static thread_local XC::Vector res(60);
 
 //        printf("getResistingForceIncInertia()\n");
 
         int i, j;
-        static double a[60];
+        static thread_local double a[60];
 
         for(i=0; i<nenu; i++) {
                 const XC::Vector &accel = theNodes[i]->getTrialAccel();
@@ -679,7 +679,7 @@ const XC::Vector &XC::Twenty_Node_Brick::getResistingForceIncInertia(void) const
 
 void   XC::Twenty_Node_Brick::formInertiaTerms( int tangFlag ) const
 {
-        static double xsj ;  // determinant jacaobian matrix
+        static thread_local double xsj ;  // determinant jacaobian matrix
         int i, j, k, m;
         double Nrho;
 
@@ -822,7 +822,7 @@ XC::Response *XC::Twenty_Node_Brick::setResponse(const std::vector<std::string>
 
 int XC::Twenty_Node_Brick::getResponse(int responseID, Information &eleInfo)
   {
-        static Vector stresses(162);
+        static thread_local Vector stresses(162);
 
         if(responseID == 1)
                 return eleInfo.setVector(this->getResistingForce());
@@ -864,7 +864,7 @@ void XC::Twenty_Node_Brick::compuLocalShapeFunction()
   {
 
         int i, k, j;
-        static double shl[4][20][27], w[27];
+        static thread_local double shl[4][20][27], w[27];
         // solid phase
         brcshl(shl, w, nintu, nenu);
         for(k = 0; k < nintu; k++) {
@@ -880,9 +880,9 @@ void XC::Twenty_Node_Brick::Jacobian3d(int gaussPoint, double& xsj, int mode)
 {
         int i, j, k, nint, nen;
         double rxsj, c1, c2, c3;
-        static double xs[3][3];
-        static double ad[3][3];
-        static double shp[4][20];
+        static thread_local double xs[3][3];
+        static thread_local double ad[3][3];
+        static thread_local double shp[4][20];
 
         if( mode == 0 ) { // solid
                 nint = nintu;
@@ -67,10 +67,10 @@ class Twenty_Node_Brick : public ElemWithMaterial<20,NDMaterialPhysicalPropertie
 
     typedef ElemWithMaterial<20,NDMaterialPhysicalProperties> Twenty_Node_Brick_Base;
     //static data
-    static Matrix stiff ;
-    static Vector resid ;
-    static Matrix mass ;
-    static Matrix damp ;
+    static thread_local Matrix stiff ;
+    static thread_local Vector resid ;
+    static thread_local Matrix mass ;
+    static thread_local Matrix damp ;
 
     //quadrature data
     static const int nintu;
@@ -78,12 +78,12 @@ class Twenty_Node_Brick : public ElemWithMaterial<20,NDMaterialPhysicalPropertie
 
     //local nodal coordinates, three coordinates for each of twenty nodes
     //    static double xl[3][20] ;
-    static double xl[3][20] ;
+    static thread_local double xl[3][20] ;
 
-    static double shgu[4][20][27];	// Stores shape functions and derivatives (overwritten)
+    static thread_local double shgu[4][20][27];	// Stores shape functions and derivatives (overwritten)
     static double shlu[4][20][27];	// Stores shape functions and derivatives
     static double wu[27];		// Stores quadrature weights
-    static double dvolu[27];  // Stores detJacobian (overwritten)
+    static thread_local double dvolu[27];  // Stores detJacobian (overwritten)
 
     void formInertiaTerms( int tangFlag ) const;
     void formDampingTerms( int tangFlag ) const;
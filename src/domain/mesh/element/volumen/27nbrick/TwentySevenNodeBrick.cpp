@@ -77,10 +77,10 @@
 #define FixedOrder 3
 
 namespace XC{
- XC::Matrix XC::TwentySevenNodeBrick::K(81, 81);
- XC::Matrix XC::TwentySevenNodeBrick::C(81, 81);
- XC::Matrix XC::TwentySevenNodeBrick::M(81, 81);
- XC::Vector XC::TwentySevenNodeBrick::P(81);
+thread_local XC::Matrix XC::TwentySevenNodeBrick::K(81, 81);
+thread_local XC::Matrix XC::TwentySevenNodeBrick::C(81, 81);
+thread_local XC::Matrix XC::TwentySevenNodeBrick::M(81, 81);
+thread_local XC::Vector XC::TwentySevenNodeBrick::P(81);
  XC::Vector InfoMoment(109+3);  //For computing moment
  XC::Vector InfoPlastic(FixedOrder*FixedOrder*FixedOrder*4+1); //Plastic info
  XC::Vector InfoStress(FixedOrder*FixedOrder*FixedOrder*6+1); //Stress info
@@ -3367,7 +3367,7 @@ std::cerr << "XC::TwentySevenNodeBrick::addInertiaLoadToUnbalance " <<
     return -1;
     }
 
-  static XC::Vector ra(81);  // Changed form 60 to 81  Guanzhou Oct. 2003
+  static thread_local XC::Vector ra(81);  // Changed form 60 to 81  Guanzhou Oct. 2003
 
   ra( 0) = Raccel1(0);
   ra( 1) = Raccel1(1);
@@ -3692,7 +3692,7 @@ const XC::Vector &XC::TwentySevenNodeBrick::getResistingForceIncInertia(void) co
 	const Vector &accel26 = theNodes[25]->getTrialAccel();
 	const Vector &accel27 = theNodes[26]->getTrialAccel();
 
-	static Vector a(81);  // originally 8
+	static thread_local Vector a(81);  // originally 8
 
 	a( 0) = accel1(0);
 	a( 1) = accel1(1);
@@ -4864,7 +4864,7 @@ double XC::TwentySevenNodeBrick::get_Gauss_p_c(short order, short point_numb)
   {
 //  Abscissae coefficient of the Gaussian quadrature formula
 // starting from 1 not from 0
-    static double Gauss_coordinates[7][7];
+    static thread_local double Gauss_coordinates[7][7];
 
     Gauss_coordinates[1][1] = 0.0 ;
     Gauss_coordinates[2][1] = -0.577350269189626;
@@ -4895,7 +4895,7 @@ double XC::TwentySevenNodeBrick::get_Gauss_p_w(short order, short point_numb)
   {
 //  Weight coefficient of the Gaussian quadrature formula
 // starting from 1 not from 0
-    static double Gauss_weights[7][7]; // static data ??
+    static thread_local double Gauss_weights[7][7]; // static data ??
 
     Gauss_weights[1][1] = 2.0;
     Gauss_weights[2][1] = 1.0;
@@ -82,10 +82,10 @@
 
 #define FixedOrder 2
 
- XC::Matrix XC::EightNodeBrick::K(24, 24);
- XC::Matrix XC::EightNodeBrick::C(24, 24);
- XC::Matrix XC::EightNodeBrick::M(24, 24);
- XC::Vector XC::EightNodeBrick::P(24);
+thread_local XC::Matrix XC::EightNodeBrick::K(24, 24);
+thread_local XC::Matrix XC::EightNodeBrick::C(24, 24);
+thread_local XC::Matrix XC::EightNodeBrick::M(24, 24);
+thread_local XC::Vector XC::EightNodeBrick::P(24);
  XC::Vector InfoP(FixedOrder*FixedOrder*FixedOrder*4+1); //Plastic info(coor+pls) 32+1 2X2X2
  XC::Vector InfoP1(FixedOrder*FixedOrder*FixedOrder+1); //Plastic info, no Gauss point coordinates
  XC::Vector InfoS(FixedOrder*FixedOrder*FixedOrder*6+1); //Stress 8*6+1  2X2X2
@@ -2842,7 +2842,7 @@ int XC::EightNodeBrick::addInertiaLoadToUnbalance(const XC::Vector &accel)
       return -1;
     }
 
-  static XC::Vector ra(24);  // Changed form 8 to 24(3*8)  Xiaoyan 09/27/00
+  static thread_local XC::Vector ra(24);  // Changed form 8 to 24(3*8)  Xiaoyan 09/27/00
 
   ra(0)=  Raccel1(0);
   ra(1)=  Raccel1(1);
@@ -2997,7 +2997,7 @@ const XC::Vector &XC::EightNodeBrick::getResistingForceIncInertia(void) const
 	const Vector &accel7= theNodes[6]->getTrialAccel();
 	const Vector &accel8= theNodes[7]->getTrialAccel();
 
-	static Vector a(24);  // originally 8
+	static thread_local Vector a(24);  // originally 8
 
 	a(0)=  accel1(0);
 	a(1)=  accel1(1);
@@ -3967,7 +3967,7 @@ double XC::EightNodeBrick::get_Gauss_p_c(short order, short point_numb) const
   {
 //  Abscissae coefficient of the Gaussian quadrature formula
 // starting from 1 not from 0
-    static double Gauss_coordinates[7][7];
+    static thread_local double Gauss_coordinates[7][7];
 
     Gauss_coordinates[1][1]= 0.0 ;
     Gauss_coordinates[2][1]= -0.577350269189626;
@@ -3998,7 +3998,7 @@ double XC::EightNodeBrick::get_Gauss_p_w(short order, short point_numb) const
   {
 //  Weight coefficient of the Gaussian quadrature formula
 // starting from 1 not from 0
-    static double Gauss_weights[7][7]; // static data ??
+    static thread_local double Gauss_weights[7][7]; // static data ??
 
     Gauss_weights[1][1]= 2.0;
     Gauss_weights[2][1]= 1.0;
@@ -67,10 +67,10 @@ class NDMaterial;
 class TotalLagrangianFD20NodeBrick: public ElemWithMaterial<20,NDMaterialPhysicalProperties>
   {
   private:
-    static Matrix K; //!< Element stiffness Matrix
+    static thread_local Matrix K; //!< Element stiffness Matrix
 //    static Matrix C; //!< Element damping matrix
-    static Matrix M; //!< Element mass matrix
-    static Vector P; //!< Element resisting force vector
+    static thread_local Matrix M; //!< Element mass matrix
+    static thread_local Vector P; //!< Element resisting force vector
     static const double pts[3]; //!< Stores quadrature points
     static const double wts[3]; //!< Stores quadrature weights
     BodyForces3D bf; //!< Body forces
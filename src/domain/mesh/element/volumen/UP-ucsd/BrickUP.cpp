@@ -78,12 +78,12 @@
 
 namespace XC{
 //static data
-double  BrickUP::xl[4][8] ;
+thread_local double  BrickUP::xl[4][8] ;
 
- XC::Matrix  BrickUP::stiff(32,32) ;
- XC::Vector  BrickUP::resid(32) ;
- XC::Matrix  BrickUP::mass(32,32) ;
- XC::Matrix  BrickUP::damp(32,32) ;
+thread_local XC::Matrix  BrickUP::stiff(32,32) ;
+thread_local XC::Vector  BrickUP::resid(32) ;
+thread_local XC::Matrix  BrickUP::mass(32,32) ;
+thread_local XC::Matrix  BrickUP::damp(32,32) ;
 
 //quadrature data
 const double  BrickUP::sg[] = { -one_over_root3,
@@ -167,8 +167,8 @@ void  XC::BrickUP::Print( std::ostream &s, int flag )
      }
 
     // spit out the section location & invoke print on the scetion
-    static Vector avgStress(7);
-    static Vector avgStrain(nstress);
+    static thread_local Vector avgStress(7);
+    static thread_local Vector avgStrain(nstress);
     avgStress= physicalProperties.getCommittedAvgStress();
     avgStrain= physicalProperties.getCommittedAvgStrain();
 
@@ -240,26 +240,26 @@ const XC::Matrix&  XC::BrickUP::getInitialStiff(void) const
   int i, j, k, p, q ;
   int jj, kk ;
 
-  static double volume ;
-  static double xsj ;  // determinant jacaobian matrix
-  static double dvol[numberGauss] ; //volume element
-  static double gaussPoint[ndm] ;
-  static XC::Vector strain(nstress) ;  //strain
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
-  static XC::Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness
-  static XC::Matrix dd(nstress,nstress) ;  //material tangent
+  static thread_local double volume ;
+  static thread_local double xsj ;  // determinant jacaobian matrix
+  static thread_local double dvol[numberGauss] ; //volume element
+  static thread_local double gaussPoint[ndm] ;
+  static thread_local XC::Vector strain(nstress) ;  //strain
+  static thread_local double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  static thread_local double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+  static thread_local XC::Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness
+  static thread_local XC::Matrix dd(nstress,nstress) ;  //material tangent
 
 
   //---------B-matrices------------------------------------
 
-    static XC::Matrix BJ(nstress,ndf) ;      // B matrix node J
+    static thread_local XC::Matrix BJ(nstress,ndf) ;      // B matrix node J
 
-    static XC::Matrix BJtran(ndf,nstress) ;
+    static thread_local XC::Matrix BJtran(ndf,nstress) ;
 
-    static XC::Matrix BK(nstress,ndf) ;      // B matrix node k
+    static thread_local XC::Matrix BK(nstress,ndf) ;      // B matrix node k
 
-    static XC::Matrix BJtranD(ndf,nstress) ;
+    static thread_local XC::Matrix BJtranD(ndf,nstress) ;
 
   //-------------------------------------------------------
 
@@ -394,13 +394,13 @@ void XC::BrickUP::formDampingTerms(int tangFlag) const
   static const int numberGauss = 8 ;
   static const int numberDOFs = 32 ;
   static const int nShape = 4 ;
-  static double volume ;
-  static double xsj ;  // determinant jacaobian matrix
-  static double dvol[numberGauss] ; //volume element
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
-  static double gaussPoint[ndm] ;
-  static XC::Vector a(ndff*numberNodes) ;
+  static thread_local double volume ;
+  static thread_local double xsj ;  // determinant jacaobian matrix
+  static thread_local double dvol[numberGauss] ; //volume element
+  static thread_local double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  static thread_local double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+  static thread_local double gaussPoint[ndm] ;
+  static thread_local XC::Vector a(ndff*numberNodes) ;
 
   int i, j, k, p, q, m, i1, j1;
   //int jj, kk ;
@@ -569,7 +569,7 @@ const XC::Vector&  XC::BrickUP::getResistingForce(void) const
 //get residual with inertia terms
 const XC::Vector&  XC::BrickUP::getResistingForceIncInertia(void) const
   {
-    static Vector res(32);
+    static thread_local Vector res(32);
 
     int tang_flag = 0 ; //don't get the tangent
 
@@ -600,13 +600,13 @@ void   XC::BrickUP::formInertiaTerms(int tangFlag) const
   static const int numberGauss = 8 ;
   static const int nShape = 4 ;
   static const int massIndex = nShape - 1 ;
-  static double volume ;
-  static double xsj ;  // determinant jacaobian matrix
-  static double dvol[numberGauss] ; //volume element
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
-  static double gaussPoint[ndm] ;
-  static XC::Vector a(ndff*numberNodes) ;
+  static thread_local double volume ;
+  static thread_local double xsj ;  // determinant jacaobian matrix
+  static thread_local double dvol[numberGauss] ; //volume element
+  static thread_local double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  static thread_local double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+  static thread_local double gaussPoint[ndm] ;
+  static thread_local XC::Vector a(ndff*numberNodes) ;
 
   int i, j, k, p, q ;
   int jj, kk ;
@@ -729,24 +729,24 @@ void  XC::BrickUP::formResidAndTangent(int tang_flag) const
 
   int success ;
 
-  static double volume ;
-  static double xsj ;  // determinant jacaobian matrix
-  static double dvol[numberGauss] ; //volume element
-  static double gaussPoint[ndm] ;
-  static XC::Vector strain(nstress) ;  //strain
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
-  static XC::Vector residJ(ndf) ; //nodeJ residual
-  static XC::Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness
-  static XC::Vector stress(nstress) ;  //stress
-  static XC::Matrix dd(nstress,nstress) ;  //material tangent
+  static thread_local double volume ;
+  static thread_local double xsj ;  // determinant jacaobian matrix
+  static thread_local double dvol[numberGauss] ; //volume element
+  static thread_local double gaussPoint[ndm] ;
+  static thread_local XC::Vector strain(nstress) ;  //strain
+  static thread_local double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  static thread_local double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+  static thread_local XC::Vector residJ(ndf) ; //nodeJ residual
+  static thread_local XC::Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness
+  static thread_local XC::Vector stress(nstress) ;  //stress
+  static thread_local XC::Matrix dd(nstress,nstress) ;  //material tangent
 
 
   //---------B-matrices------------------------------------
-    static XC::Matrix BJ(nstress,ndf) ;      // B matrix node J
-    static XC::Matrix BJtran(ndf,nstress) ;
-    static XC::Matrix BK(nstress,ndf) ;      // B matrix node k
-    static XC::Matrix BJtranD(ndf,nstress) ;
+    static thread_local XC::Matrix BJ(nstress,ndf) ;      // B matrix node J
+    static thread_local XC::Matrix BJtran(ndf,nstress) ;
+    static thread_local XC::Matrix BK(nstress,ndf) ;      // B matrix node k
+    static thread_local XC::Matrix BJtranD(ndf,nstress) ;
   //-------------------------------------------------------
 
 
@@ -939,7 +939,7 @@ void XC::BrickUP::computeBasis(void) const
 const XC::Matrix &XC::BrickUP::computeB( int node, const double shp[4][8] ) const
 {
 
-  static XC::Matrix B(6,3) ;
+  static thread_local XC::Matrix B(6,3) ;
 
 //---B XC::Matrix in standard {1,2,3} mechanics notation---------
 //
@@ -1074,7 +1074,7 @@ XC::Response *XC::BrickUP::setResponse(const std::vector<std::string> &argv, Inf
 
 int XC::BrickUP::getResponse(int responseID, Information &eleInfo)
   {
-    static XC::Vector stresses(48);
+    static thread_local XC::Vector stresses(48);
     if(responseID == 1)
       return eleInfo.setVector(this->getResistingForce());
     else if(responseID == 2)
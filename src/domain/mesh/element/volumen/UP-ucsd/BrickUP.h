@@ -82,10 +82,10 @@ class BrickUP : public BrickBase
     mutable Matrix *Ki;
 
     //static data
-    static Matrix stiff ;
-    static Vector resid ;
-    static Matrix mass ;
-    static Matrix damp ;
+    static thread_local Matrix stiff ;
+    static thread_local Vector resid ;
+    static thread_local Matrix mass ;
+    static thread_local Matrix damp ;
 
     //quadrature data
     static const double sg[2] ;
@@ -94,7 +94,7 @@ class BrickUP : public BrickBase
 
     //local nodal coordinates, three coordinates for each of four nodes
     //    static double xl[3][8] ;
-    static double xl[][8] ;
+    static thread_local double xl[][8] ;
 
     void formInertiaTerms(int tangFlag) const;
     void formDampingTerms(int tangFlag) const;
@@ -66,28 +66,28 @@
 #include <iostream>
 
 //static data
-double  XC::TwentyEightNodeBrickUP::xl[3][20] ;
+thread_local double  XC::TwentyEightNodeBrickUP::xl[3][20] ;
 
-XC::Matrix  XC::TwentyEightNodeBrickUP::stiff(68,68) ;
-XC::Vector  XC::TwentyEightNodeBrickUP::resid(68) ;
-XC::Matrix  XC::TwentyEightNodeBrickUP::mass(68,68) ;
-XC::Matrix  XC::TwentyEightNodeBrickUP::damp(68,68) ;
+thread_local XC::Matrix  XC::TwentyEightNodeBrickUP::stiff(68,68) ;
+thread_local XC::Vector  XC::TwentyEightNodeBrickUP::resid(68) ;
+thread_local XC::Matrix  XC::TwentyEightNodeBrickUP::mass(68,68) ;
+thread_local XC::Matrix  XC::TwentyEightNodeBrickUP::damp(68,68) ;
 
 const int XC::TwentyEightNodeBrickUP::nintu=27;
 const int XC::TwentyEightNodeBrickUP::nintp=8;
 const int XC::TwentyEightNodeBrickUP::nenu=20;
 const int XC::TwentyEightNodeBrickUP::nenp=8;
-double XC::TwentyEightNodeBrickUP::shgu[4][20][27];
-double XC::TwentyEightNodeBrickUP::shgp[4][8][8];
-double XC::TwentyEightNodeBrickUP::shgq[4][20][8];
+thread_local double XC::TwentyEightNodeBrickUP::shgu[4][20][27];
+thread_local double XC::TwentyEightNodeBrickUP::shgp[4][8][8];
+thread_local double XC::TwentyEightNodeBrickUP::shgq[4][20][8];
 double XC::TwentyEightNodeBrickUP::shlu[4][20][27];
 double XC::TwentyEightNodeBrickUP::shlp[4][8][8];
 double XC::TwentyEightNodeBrickUP::shlq[4][20][8];
 double XC::TwentyEightNodeBrickUP::wu[27];
 double XC::TwentyEightNodeBrickUP::wp[8];
-double XC::TwentyEightNodeBrickUP::dvolu[27];
-double XC::TwentyEightNodeBrickUP::dvolp[8];
-double XC::TwentyEightNodeBrickUP::dvolq[8];
+thread_local double XC::TwentyEightNodeBrickUP::dvolu[27];
+thread_local double XC::TwentyEightNodeBrickUP::dvolp[8];
+thread_local double XC::TwentyEightNodeBrickUP::dvolq[8];
 
 //null constructor
 XC::TwentyEightNodeBrickUP::TwentyEightNodeBrickUP(void)
@@ -199,8 +199,8 @@ void  XC::TwentyEightNodeBrickUP::Print( std::ostream &s, int flag )
 
                 // spit out the section location & invoke print on the scetion
  
-                static XC::Vector avgStress(7);
-                static XC::Vector avgStrain(nstress);
+                static thread_local XC::Vector avgStress(7);
+                static thread_local XC::Vector avgStrain(nstress);
                 avgStress= physicalProperties.getCommittedAvgStress();
                 avgStrain= physicalProperties.getCommittedAvgStrain();
 
@@ -255,9 +255,9 @@ int
 XC::TwentyEightNodeBrickUP::update()
   {
         int i, j;
-        static double u[3][20];
-        static double xsj;
-        static XC::Matrix B(6, 3);
+        static thread_local double u[3][20];
+        static thread_local double xsj;
+        static thread_local XC::Matrix B(6, 3);
         double volume = 0.;
 
         for(i = 0; i < nenu; i++) {
@@ -267,7 +267,7 @@ XC::TwentyEightNodeBrickUP::update()
              u[2][i] = disp(2);
     }
 
-        static XC::Vector eps(6);
+        static thread_local XC::Vector eps(6);
 
         int ret = 0;
 
@@ -343,7 +343,7 @@ XC::TwentyEightNodeBrickUP::update()
 //return tangent stiffness matrix
 const XC::Matrix&  XC::TwentyEightNodeBrickUP::getTangentStiff(void) const
   {
-    static Matrix K;
+    static thread_local Matrix K;
     K= getStiff(1);
     if(isDead())
       K*=dead_srf;
@@ -353,7 +353,7 @@ const XC::Matrix&  XC::TwentyEightNodeBrickUP::getTangentStiff(void) const
 // return initial stiffness matrix
 const XC::Matrix&  XC::TwentyEightNodeBrickUP::getInitialStiff(void) const
   {
-    static Matrix K;
+    static thread_local Matrix K;
     K= getStiff(0);
     if(isDead())
       K*=dead_srf;
@@ -373,13 +373,13 @@ const XC::Matrix&  XC::TwentyEightNodeBrickUP::getStiff(int flag) const
 
         int i, j ;
 
-        static double xsj ;  // determinant jacaobian matrix
+        static thread_local double xsj ;  // determinant jacaobian matrix
         double volume = 0.;
         //-------------------------------------------------------
         int j3, j3m1, j3m2, ik, ib, jk, jb;
-        static XC::Matrix B(6,nenu*3);
-        static XC::Matrix BTDB(nenu*3,nenu*3);
-        static XC::Matrix D(6, 6);
+        static thread_local XC::Matrix B(6,nenu*3);
+        static thread_local XC::Matrix BTDB(nenu*3,nenu*3);
+        static thread_local XC::Matrix D(6, 6);
         B.Zero();
         BTDB.Zero();
         stiff.Zero();
@@ -507,7 +507,7 @@ const XC::Matrix&  XC::TwentyEightNodeBrickUP::getDamp(void) const
 
 void XC::TwentyEightNodeBrickUP::formDampingTerms( int tangFlag ) const
   {
-    static double xsj ;  // determinant jacaobian matrix
+    static thread_local double xsj ;  // determinant jacaobian matrix
     int i, j, k, m, ik, jk;
     double volume = 0.;
     //zero damp
@@ -610,7 +610,7 @@ int XC::TwentyEightNodeBrickUP::addLoad(ElementalLoad *theLoad, double loadFacto
 
 int XC::TwentyEightNodeBrickUP::addInertiaLoadToUnbalance(const XC::Vector &accel)
   {
-    static Vector ra(68);
+    static thread_local Vector ra(68);
     int i,ik;
     ra.Zero();
 
@@ -655,7 +655,7 @@ const XC::Vector &XC::TwentyEightNodeBrickUP::getResistingForce(void) const
   {
     int i, j, jk, k, k1;
     double xsj;
-    static XC::Matrix B(6, 3);
+    static thread_local XC::Matrix B(6, 3);
     double volume = 0.;
 
 //        printf("calling getResistingForce()\n");
@@ -757,10 +757,10 @@ const XC::Vector &XC::TwentyEightNodeBrickUP::getResistingForce(void) const
 //get residual with inertia terms
 const XC::Vector&  XC::TwentyEightNodeBrickUP::getResistingForceIncInertia(void) const
   {
-    static XC::Vector res(68);
+    static thread_local XC::Vector res(68);
 
     int i, j, ik;
-    static double a[68];
+    static thread_local double a[68];
 
     for(i=0; i<nenu; i++) {
             const XC::Vector &accel = theNodes[i]->getTrialAccel();
@@ -832,7 +832,7 @@ const XC::Vector&  XC::TwentyEightNodeBrickUP::getResistingForceIncInertia(void)
 
 void   XC::TwentyEightNodeBrickUP::formInertiaTerms( int tangFlag ) const
 {
-    static double xsj ;  // determinant jacaobian matrix
+    static thread_local double xsj ;  // determinant jacaobian matrix
     int i, j, k, ik, m, jk;
     double Nrho;
 
@@ -1007,7 +1007,7 @@ XC::Response*XC::TwentyEightNodeBrickUP::setResponse(const std::vector<std::stri
 int
 XC::TwentyEightNodeBrickUP::getResponse(int responseID, Information &eleInfo)
 {
-    static XC::Vector stresses(162);
+    static thread_local XC::Vector stresses(162);
 
     if(responseID == 1)
             return eleInfo.setVector(this->getResistingForce());
@@ -1049,7 +1049,7 @@ void
 XC::TwentyEightNodeBrickUP::compuLocalShapeFunction() {
 
     int i, k, j;
-    static double shl[4][20][27], w[27];
+    static thread_local double shl[4][20][27], w[27];
     // solid phase
     brcshl(shl, w, nintu, nenu);
     for(k = 0; k < nintu; k++) {
@@ -1081,9 +1081,9 @@ void XC::TwentyEightNodeBrickUP::Jacobian3d(int gaussPoint, double& xsj, int mod
 {
     int i, j, k, nint, nen;
     double rxsj, c1, c2, c3;
-    static double xs[3][3];
-    static double ad[3][3];
-    static double shp[4][20];
+    static thread_local double xs[3][3];
+    static thread_local double ad[3][3];
+    static thread_local double shp[4][20];
 
     if( mode == 0 ) { // solid
             nint = nintu;
@@ -67,10 +67,10 @@ class TwentyEightNodeBrickUP : public ElemWithMaterial<20,NDMaterialPhysicalProp
     mutable Matrix *Ki;
 
     //static data
-    static Matrix stiff ;
-    static Vector resid ;
-    static Matrix mass ;
-    static Matrix damp ;
+    static thread_local Matrix stiff ;
+    static thread_local Vector resid ;
+    static thread_local Matrix mass ;
+    static thread_local Matrix damp ;
 
     //quadrature data
     static const int nintu;
@@ -81,19 +81,19 @@ class TwentyEightNodeBrickUP : public ElemWithMaterial<20,NDMaterialPhysicalProp
 
     //local nodal coordinates, three coordinates for each of twenty nodes
     //    static double xl[3][20] ;
-    static double xl[3][20] ;
+    static thread_local double xl[3][20] ;
 
-    static double shgu[4][20][27];	// Stores shape functions and derivatives (overwritten)
-    static double shgp[4][8][8];	// Stores shape functions and derivatives (overwritten)
-    static double shgq[4][20][8];	// Stores shape functions and derivatives (overwritten)
+    static thread_local double shgu[4][20][27];	// Stores shape functions and derivatives (overwritten)
+    static thread_local double shgp[4][8][8];	// Stores shape functions and derivatives (overwritten)
+    static thread_local double shgq[4][20][8];	// Stores shape functions and derivatives (overwritten)
     static double shlu[4][20][27];	// Stores shape functions and derivatives
     static double shlp[4][8][8];	// Stores shape functions and derivatives
     static double shlq[4][20][8];	// Stores shape functions and derivatives
     static double wu[27];		// Stores quadrature weights
     static double wp[8];		// Stores quadrature weights
-    static double dvolu[27];  // Stores detJacobian (overwritten)
-    static double dvolp[8];  // Stores detJacobian (overwritten)
-    static double dvolq[8];  // Stores detJacobian (overwritten)
+    static thread_local double dvolu[27];  // Stores detJacobian (overwritten)
+    static thread_local double dvolp[8];  // Stores detJacobian (overwritten)
+    static thread_local double dvolq[8];  // Stores detJacobian (overwritten)
 
     //inertia terms
     void formInertiaTerms( int tangFlag ) const;
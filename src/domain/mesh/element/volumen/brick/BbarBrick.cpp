@@ -69,11 +69,11 @@
 #include "domain/mesh/element/utils/gauss_models/GaussModel.h"
 
 //static data
-double  XC::BbarBrick::xl[3][8] ;
+thread_local double  XC::BbarBrick::xl[3][8] ;
 
- XC::Matrix  XC::BbarBrick::stiff(24,24) ;
- XC::Vector  XC::BbarBrick::resid(24) ;
- XC::Matrix  XC::BbarBrick::mass(24,24) ;
+thread_local XC::Matrix  XC::BbarBrick::stiff(24,24) ;
+thread_local XC::Vector  XC::BbarBrick::resid(24) ;
+thread_local XC::Matrix  XC::BbarBrick::mass(24,24) ;
 
 
 //quadrature data
@@ -189,23 +189,23 @@ const XC::Matrix &XC::BbarBrick::getInitialStiff(void) const
     int i, j, k, p, q ;
     int jj, kk ;
 
-    static double volume ;
-    static double xsj ;  // determinant jacaobian matrix
-    static double dvol[numberGauss] ; //volume element
-    static double gaussPoint[ndm] ;
-    static XC::Vector strain(nstress) ;  //strain
-    static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
-    static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
-    static double shpBar[nShape][numberNodes] ;  //mean value of shape functions
-    static XC::Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness
-    static XC::Matrix dd(nstress,nstress) ;  //material tangent
+    static thread_local double volume ;
+    static thread_local double xsj ;  // determinant jacaobian matrix
+    static thread_local double dvol[numberGauss] ; //volume element
+    static thread_local double gaussPoint[ndm] ;
+    static thread_local XC::Vector strain(nstress) ;  //strain
+    static thread_local double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+    static thread_local double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+    static thread_local double shpBar[nShape][numberNodes] ;  //mean value of shape functions
+    static thread_local XC::Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness
+    static thread_local XC::Matrix dd(nstress,nstress) ;  //material tangent
 
 
     //---------B-matrices------------------------------------
-    static XC::Matrix BJ(nstress,ndf) ;      // B matrix node J
-    static XC::Matrix BJtran(ndf,nstress) ;
-    static XC::Matrix BK(nstress,ndf) ;      // B matrix node k
-    static XC::Matrix BJtranD(ndf,nstress) ;
+    static thread_local XC::Matrix BJ(nstress,ndf) ;      // B matrix node J
+    static thread_local XC::Matrix BJtran(ndf,nstress) ;
+    static thread_local XC::Matrix BK(nstress,ndf) ;      // B matrix node k
+    static thread_local XC::Matrix BJtranD(ndf,nstress) ;
     //-------------------------------------------------------
 
     //zero stiffness and residual
@@ -395,7 +395,7 @@ const XC::Vector &XC::BbarBrick::getResistingForce(void) const
 //! @brief Get residual with inertia terms
 const XC::Vector &XC::BbarBrick::getResistingForceIncInertia(void) const
   {
-    static Vector res(24);
+    static thread_local Vector res(24);
     int tang_flag = 0 ; //don't get the tangent
 
     //do tangent and residual here
@@ -437,13 +437,13 @@ void XC::BbarBrick::formInertiaTerms( int tangFlag ) const
 
   double dvol[numberGauss] ; //volume element
 
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  static thread_local double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+  static thread_local double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
 
-  static double gaussPoint[ndm] ;
+  static thread_local double gaussPoint[ndm] ;
 
-  static XC::Vector momentum(ndf) ;
+  static thread_local XC::Vector momentum(ndf) ;
 
   int i, j, k, p, q ;
   int jj, kk ;
@@ -576,40 +576,40 @@ void  XC::BbarBrick::formResidAndTangent( int tang_flag ) const
 
   int success ;
 
-  static double volume ;
+  static thread_local double volume ;
 
-  static double xsj ;  // determinant jacaobian matrix
+  static thread_local double xsj ;  // determinant jacaobian matrix
 
-  static double dvol[numberGauss] ; //volume element
+  static thread_local double dvol[numberGauss] ; //volume element
 
-  static double gaussPoint[ndm] ;
+  static thread_local double gaussPoint[ndm] ;
 
-  static XC::Vector strain(nstress) ;  //strain
+  static thread_local XC::Vector strain(nstress) ;  //strain
 
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  static thread_local double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+  static thread_local double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
 
-  static double shpBar[nShape][numberNodes] ;  //mean value of shape functions
+  static thread_local double shpBar[nShape][numberNodes] ;  //mean value of shape functions
 
-  static XC::Vector residJ(ndf) ; //nodeJ residual
+  static thread_local XC::Vector residJ(ndf) ; //nodeJ residual
 
-  static XC::Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness
+  static thread_local XC::Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness
 
-  static XC::Vector stress(nstress) ;  //stress
+  static thread_local XC::Vector stress(nstress) ;  //stress
 
-  static XC::Matrix dd(nstress,nstress) ;  //material tangent
+  static thread_local XC::Matrix dd(nstress,nstress) ;  //material tangent
 
 
   //---------B-matrices------------------------------------
 
-    static XC::Matrix BJ(nstress,ndf) ;      // B matrix node J
+    static thread_local XC::Matrix BJ(nstress,ndf) ;      // B matrix node J
 
-    static XC::Matrix BJtran(ndf,nstress) ;
+    static thread_local XC::Matrix BJtran(ndf,nstress) ;
 
-    static XC::Matrix BK(nstress,ndf) ;      // B matrix node k
+    static thread_local XC::Matrix BK(nstress,ndf) ;      // B matrix node k
 
-    static XC::Matrix BJtranD(ndf,nstress) ;
+    static thread_local XC::Matrix BJtranD(ndf,nstress) ;
 
   //-------------------------------------------------------
 
@@ -810,13 +810,13 @@ const XC::Matrix &XC::BbarBrick::computeBbar( int node,
                                  const double shpBar[4][8]) const
 {
 
-  static XC::Matrix Bbar(6,3) ;
+  static thread_local XC::Matrix Bbar(6,3) ;
 
   //static XC::Matrix Bdev(3,3) ;
-  static double Bdev[3][3] ;
+  static thread_local double Bdev[3][3] ;
 
   //static XC::Matrix BbarVol(3,3) ;
-  static double BbarVol[3][3] ;
+  static thread_local double BbarVol[3][3] ;
 
   static const double one3 = 1.0/3.0 ;
 
@@ -999,7 +999,7 @@ XC::Response *XC::BbarBrick::setResponse(const std::vector<std::string> &argv, I
 
 int XC::BbarBrick::getResponse(int responseID, Information &eleInfo)
 {
-  static XC::Vector stresses(48);
+  static thread_local XC::Vector stresses(48);
 
   if(responseID == 1)
     return eleInfo.setVector(this->getResistingForce());
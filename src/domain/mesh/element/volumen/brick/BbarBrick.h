@@ -64,10 +64,10 @@ class BbarBrick : public BrickBase
  {
  private : 
    //static data
-   static Matrix stiff ;
-   static Vector resid ;
-   static Matrix mass ;
-   static Matrix damping ;
+   static thread_local Matrix stiff ;
+   static thread_local Vector resid ;
+   static thread_local Matrix mass ;
+   static thread_local Matrix damping ;
 
    //quadrature data
    static const double sg[2] ;
@@ -76,7 +76,7 @@ class BbarBrick : public BrickBase
   
    //local nodal coordinates, three coordinates for each of four nodes
    //    static double xl[3][8] ; 
-   static double xl[][8] ; 
+   static thread_local double xl[][8] ; 
 
    BodyForces3D bf; //!< Body forces
    mutable Matrix *Ki;
@@ -70,17 +70,17 @@ class Brick : public BrickBase
     // static attributes
     //
 
-    static Matrix stiff;
-    static Vector resid;
-    static Matrix mass;
-    static Matrix damping;
+    static thread_local Matrix stiff;
+    static thread_local Vector resid;
+    static thread_local Matrix mass;
+    static thread_local Matrix damping;
 
     //quadrature data
     static const double sg[2];
     static const double wg[8];
   
     //local nodal coordinates, three coordinates for each of eight nodes
-    static double xl[3][8];
+    static thread_local double xl[3][8];
 
     //
     // private methods
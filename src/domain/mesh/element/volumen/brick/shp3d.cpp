@@ -59,8 +59,8 @@ void  XC::shp3d(const double ss[3],double &xsj,double shp[4][8],const double xl[
 
     double rxsj, ap1, am1, ap2, am2, ap3, am3, c1,c2,c3 ;
 
-    static double xs[3][3] ; 
-    static double ad[3][3] ;
+    static thread_local double xs[3][3] ; 
+    static thread_local double ad[3][3] ;
 
 
       //Compute shape functions and their natural coord. derivatives
@@ -86,10 +86,10 @@ const int XC::EightNodeBrick_u_p_U::Num_Dof = 7;
 const int XC::EightNodeBrick_u_p_U::Num_ElemDof = 56;
 const double XC::EightNodeBrick_u_p_U::pts[2] = {-0.577350269189626, +0.577350269189626};
 const double XC::EightNodeBrick_u_p_U::wts[2] = {1.0, 1.0};
- XC::Matrix XC::EightNodeBrick_u_p_U::K(Num_ElemDof, Num_ElemDof);
- XC::Matrix XC::EightNodeBrick_u_p_U::C(Num_ElemDof, Num_ElemDof);
- XC::Matrix XC::EightNodeBrick_u_p_U::M(Num_ElemDof, Num_ElemDof);
- XC::Vector XC::EightNodeBrick_u_p_U::P(Num_ElemDof);
+thread_local XC::Matrix XC::EightNodeBrick_u_p_U::K(Num_ElemDof, Num_ElemDof);
+thread_local XC::Matrix XC::EightNodeBrick_u_p_U::C(Num_ElemDof, Num_ElemDof);
+thread_local XC::Matrix XC::EightNodeBrick_u_p_U::M(Num_ElemDof, Num_ElemDof);
+thread_local XC::Vector XC::EightNodeBrick_u_p_U::P(Num_ElemDof);
  XC::BJtensor XC::EightNodeBrick_u_p_U::perm(2,def_dim_2,0.0);
 
 
@@ -158,7 +158,7 @@ void XC::EightNodeBrick_u_p_U::setDomain(Domain *theDomain)
 //======================================================================
 const XC::Matrix &XC::EightNodeBrick_u_p_U::getTangentStiff(void) const
   {
-    static Matrix retval;
+    static thread_local Matrix retval;
     retval= getStiff(1);
     if(isDead())
       retval*= dead_srf;
@@ -168,7 +168,7 @@ const XC::Matrix &XC::EightNodeBrick_u_p_U::getTangentStiff(void) const
 //======================================================================
 const XC::Matrix &XC::EightNodeBrick_u_p_U::getInitialStiff(void) const
   {
-    static Matrix retval;
+    static thread_local Matrix retval;
     retval= getStiff(0);
     if(isDead())
       retval*= dead_srf;
@@ -277,7 +277,7 @@ int XC::EightNodeBrick_u_p_U::addLoad(ElementalLoad *theLoad, double loadFactor)
 //======================================================================
 int XC::EightNodeBrick_u_p_U::addInertiaLoadToUnbalance(const XC::Vector &accel)
 {
-  static XC::Vector ra(Num_ElemDof);
+  static thread_local XC::Vector ra(Num_ElemDof);
 
   int i, ik;
 
@@ -440,7 +440,7 @@ int XC::EightNodeBrick_u_p_U::getResponse(int responseID, Information &eleInfo)
     return eleInfo.setMatrix(getDamp());
 
   else if(responseID == 5) {
-    static XC::Vector stresses(Num_TotalGaussPts*6);
+    static thread_local XC::Vector stresses(Num_TotalGaussPts*6);
     stresstensor sigma;
     int cnt = 0;
     int i;
@@ -458,7 +458,7 @@ int XC::EightNodeBrick_u_p_U::getResponse(int responseID, Information &eleInfo)
   }
 
   else if(responseID == 6) {
-    static XC::Vector Gpts(Num_TotalGaussPts*Num_Dim);
+    static thread_local XC::Vector Gpts(Num_TotalGaussPts*Num_Dim);
     BJtensor GCoord;
     int cnt = 0;
     int i,j;
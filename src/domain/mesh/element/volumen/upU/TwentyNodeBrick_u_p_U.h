@@ -73,10 +73,10 @@ namespace XC {
 class TwentyNodeBrick_u_p_U: public ElemWithMaterial<20,NDMaterialPhysicalProperties>
   {
   private:
-    static Matrix K;               // Stiffness
-    static Matrix C;		   // Damping
-    static Matrix M;		   // Mass
-    static Vector P;		   // Residual
+    static thread_local Matrix K;               // Stiffness
+    static thread_local Matrix C;		   // Damping
+    static thread_local Matrix M;		   // Mass
+    static thread_local Vector P;		   // Residual
 
     static const int  Num_IntegrationPts;
     static const int  Num_TotalGaussPts;
@@ -162,9 +162,9 @@ class ZeroLengthContact3D: public ZeroLengthContact
     Matrix *Ki; // pointer to objects matrix (a class Matrix)
   
     //static variables for 3D contact
-    static Matrix stiff; // for stiff matrix
-    static Vector resid; // for force residual vector
-    static Matrix zeroMatrix;
+    static thread_local Matrix stiff; // for stiff matrix
+    static thread_local Vector resid; // for force residual vector
+    static thread_local Matrix zeroMatrix;
   public:
     ZeroLengthContact3D(int tag= 0);
     ZeroLengthContact3D(int tag,int Nd1, int Nd2,int direction, double Kn, double Kt, double fRatio, double c, double originX, double originY);
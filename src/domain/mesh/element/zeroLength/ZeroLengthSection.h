@@ -94,21 +94,20 @@ class ZeroLengthSection: public Element0D
     Matrix A; //!< Transformation matrix ... e = A*(u2-u1)
     mutable Vector v; //!< Section deformation vector, the element basic deformations
     
-    Matrix *K; //!< Pointer to element stiffness matrix
-    Vector *P; //!< Pointer to element force vector
-    
     SectionForceDeformation *theSection;  //!< Pointer to section object
     int order;	//!< Order of the section model
     
     // Class wide matrices for return
-    static Matrix K6;
-    static Matrix K12;
+    static thread_local Matrix K6;
+    static thread_local Matrix K12;
     
     // Class wide vectors for return
-    static Vector P6;
-    static Vector P12;
+    static thread_local Vector P6;
+    static thread_local Vector P12;
 
     // private methods
+    Matrix &getClassWideMatrix(void) const;
+    Vector &getClassWideVector(void) const;
     void setTransformation(void);
     void computeSectionDefs(void) const;
 
@@ -29,57 +29,86 @@
 #include "KDTreeNodes.h"
 #include "Node.h"
 #include "xc_utils/src/geom/pos_vec/Pos3d.h"
+#include "xc_utils/src/geom/pos_vec/Pos2d.h"
+#include "xc_utils/src/geom/pos_vec/Vector3d.h"
+#include "xc_utils/src/geom/d3/GeomObj3d.h"
+#include "xc_utils/src/geom/d2/GeomObj2d.h"
 
-//! @brief Constructor.
-XC::NodePos::NodePos(const Node &n)
-  : KDTreePos(n.getInitialPosition3d()), nodPtr(&n) {}
+//! @brief Return the position of the node used in the index.
+Pos3d XC::NodePositionTraits::getPosition(const Node &n)
+  { return n.getInitialPosition3d(); }
+
+//! @brief Return the move counter value when the node was last moved.
+size_t XC::NodePositionTraits::getPositionStamp(const Node &n)
+  { return n.getPositionStamp(); }
+
+//! @brief Return the current value of the node move counter.
+size_t XC::NodePositionTraits::getMoveCounter(void)
+  { return Node::getMoveCounter(); }
+
+//! @brief Append the nodes moved since the move counter had the
+//! value being passed as parameter (false if they are not known).
+bool XC::NodePositionTraits::getMovedSince(const size_t &counter,std::vector<const Node *> &moved)
+  { return Node::getMovedSince(counter,moved); }
 
-//! @brief Constructor.
-XC::NodePos::NodePos(const Pos3d &p)
-  : KDTreePos(p), nodPtr(nullptr) {}
-  
 //! @brief Constructor.
 XC::KDTreeNodes::KDTreeNodes(void)
-  : tree_type(std::ptr_fun(NodePos::tac)), pend_optimizar(0) {}
-
+  : tree_type() {}
 
-void XC::KDTreeNodes::insert(const Node &n)
-  {
-    tree_type::insert(n);
-  }
+//! @brief Returns the nodes inside the box defined by its corners.
+XC::KDTreeNodes::ptr_vector XC::KDTreeNodes::getInsideBox(const Pos3d &pMin,const Pos3d &pMax) const
+  { return tree_type::getInsideBox(SpatialIndexBox(pMin,pMax)); }
 
-void XC::KDTreeNodes::erase(const Node &n)
+//! @brief Returns the nodes that lie in the half space bounded by
+//! the plane that passes through org with outward normal n.
+//!
+//! @param org: point of the boundary plane.
+//! @param n: outward normal of the boundary plane.
+//! @param tol: tolerance.
+XC::KDTreeNodes::ptr_vector XC::KDTreeNodes::getInsideHalfSpace(const Pos3d &org,const Vector3d &n,const double &tol) const
   {
-    tree_type::erase(n);
-    pend_optimizar++;
-    if(pend_optimizar>=10)
-      {
-	tree_type::optimise();
-        pend_optimizar= 0;
-      }
+    const double nn[3]= {n.x(),n.y(),n.z()};
+    return tree_type::getInsideHalfSpace(org,nn,tol);
   }
 
-void XC::KDTreeNodes::clear(void)
-  { tree_type::clear(); }
-  
-//! @brief Returns the node closest to the position being passed as parameter.
-const XC::Node *XC::KDTreeNodes::getNearest(const Pos3d &pos) const
+//! @brief Returns the nodes whose initial position lies
+//! inside the geometric object. The bounding box of the object
+//! is used to select the candidates.
+//!
+//! @param geomObj: geometric object that must contain the nodes.
+//! @param tol: tolerance for "In" function.
+XC::KDTreeNodes::ptr_vector XC::KDTreeNodes::getInside(const GeomObj3d &geomObj,const double &tol) const
   {
-    const Node *retval= nullptr;
-    NodePos target(pos);
-    std::pair<tree_type::const_iterator,double> found = find_nearest(target);
-    if(found.first != end())
-      retval= found.first->getNodePtr();
+    SpatialIndexBox bnd(geomObj);
+    bnd.expand(tol);
+    const ptr_vector candidates= tree_type::getInsideBox(bnd);
+    ptr_vector retval;
+    retval.reserve(candidates.size());
+    for(ptr_vector::const_iterator i= candidates.begin();i!=candidates.end();i++)
+      if(geomObj.In((*i)->getInitialPosition3d(),tol))
+        retval.push_back(*i);
     return retval;
   }
 
-//! @brief Returns the node closest to the position being passed as parameter.
-const XC::Node *XC::KDTreeNodes::getNearest(const Pos3d &pos, const double &r) const
+//! @brief Returns the nodes inside the prism obtained by extruding
+//! the 2D object (defined on the XY plane) between zMin and zMax.
+//!
+//! @param geomObj: prism base (polygon, circle,...).
+//! @param zMin: minimum z of the prism.
+//! @param zMax: maximum z of the prism.
+//! @param tol: tolerance for "In" function.
+XC::KDTreeNodes::ptr_vector XC::KDTreeNodes::getInsidePrism(const GeomObj2d &geomObj,const double &zMin,const double &zMax,const double &tol) const
   {
-    const Node *retval= nullptr;
-    NodePos target(pos);
-    std::pair<tree_type::const_iterator,double> found = find_nearest(target,r);
-    if(found.first != end())
-      retval= found.first->getNodePtr();
+    SpatialIndexBox bnd(geomObj,zMin,zMax);
+    bnd.expand(tol);
+    const ptr_vector candidates= tree_type::getInsideBox(bnd);
+    ptr_vector retval;
+    retval.reserve(candidates.size());
+    for(ptr_vector::const_iterator i= candidates.begin();i!=candidates.end();i++)
+      {
+        const Pos3d pos= (*i)->getInitialPosition3d();
+        if(geomObj.In(Pos2d(pos.x(),pos.y()),tol))
+          retval.push_back(*i);
+      }
     return retval;
   }
@@ -28,46 +28,43 @@
 #ifndef KDTreeNodes_h
 #define KDTreeNodes_h
 
-#include "xc_utils/src/geom/pos_vec/KDTreePos.h"
-#include "xc_basic/src/kdtree++/kdtree.hpp"
+#include "utility/spatial_index/SpatialIndex3d.h"
 
 class Pos3d;
+class Vector3d;
+class GeomObj3d;
+class GeomObj2d;
 
 namespace XC {
 class Node;
 
 //! \ingroup Nod
 //
-//! @brief Node position for its use in the KDTree.
-class NodePos: public KDTreePos
+//! @brief Access to the node positions from the spatial index.
+struct NodePositionTraits
   {
-  private:
-    const Node *nodPtr;
-  public:
-    NodePos(const Node &);
-    explicit NodePos(const Pos3d &p);
-    inline const Node *getNodePtr(void) const
-      { return nodPtr; }
-    static inline double tac( NodePos p, size_t k ) { return p[k]; }
+    static Pos3d getPosition(const Node &);
+    static size_t getPositionStamp(const Node &);
+    static size_t getMoveCounter(void);
+    static bool getMovedSince(const size_t &,std::vector<const Node *> &);
   };
 
-inline bool operator==(const NodePos &A,const NodePos &B)
-  { return ((A.getNodePtr()== B.getNodePtr()) && (A[0] == B[0]) && (A[1] == B[1]) && (A[2] == B[2])); }
-
-
-class KDTreeNodes: protected kd_tree::KDTree<3, NodePos, std::pointer_to_binary_function<NodePos,size_t,double> >
+//! \ingroup Nod
+//
+//! @brief Balanced kd-tree over the initial positions of the nodes.
+//!
+//! The nodes moved (Node::setPos, Node::Mueve,...) since the
+//! last query are relocated automatically.
+class KDTreeNodes: public SpatialIndex3d<Node,NodePositionTraits>
   {
-    size_t pend_optimizar;
   public:
-    typedef kd_tree::KDTree<3, NodePos, std::pointer_to_binary_function<NodePos,size_t,double> > tree_type;
+    typedef SpatialIndex3d<Node,NodePositionTraits> tree_type;
     KDTreeNodes(void);
 
-    void insert(const Node &);
-    void erase(const Node &);
-    void clear(void);
-
-    const Node *getNearest(const Pos3d &pos) const;
-    const Node *getNearest(const Pos3d &pos, const double &r) const;
+    ptr_vector getInsideBox(const Pos3d &,const Pos3d &) const;
+    ptr_vector getInsideHalfSpace(const Pos3d &,const Vector3d &,const double &tol= 0.0) const;
+    ptr_vector getInside(const GeomObj3d &,const double &tol= 0.0) const;
+    ptr_vector getInsidePrism(const GeomObj2d &,const double &,const double &,const double &tol= 0.0) const;
   };
 
 } // end of XC namespace 
@@ -98,6 +98,10 @@
 
 std::deque<XC::Matrix> XC::Node::theMatrices;
 XC::DefaultTag XC::Node::defaultTag;
+size_t XC::Node::moveCounter= 0;
+std::vector<const XC::Node *> XC::Node::moveLog;
+size_t XC::Node::moveLogBase= 0;
+const size_t XC::Node::maxMoveLogSize;
 
 //! @brief Default constructor.
 //! @param theClassTag: tag of the class.
@@ -109,7 +113,7 @@ XC::DefaultTag XC::Node::defaultTag;
 //! to recvSelf().
 XC::Node::Node(int theClassTag)
  :MeshComponent(defaultTag++,theClassTag),numberDOF(0), theDOF_GroupPtr(nullptr), 
-  disp(), vel(), accel(), unbalLoad(numberDOF), unbalLoadWithInertia(numberDOF), reaction(numberDOF),
+  positionStamp(0), disp(), vel(), accel(), unbalLoad(numberDOF), unbalLoadWithInertia(numberDOF), reaction(numberDOF),
   alphaM(0.0), tributary(0.0)
   {
     // for FEM_ObjectBroker, recvSelf() must be invoked on object
@@ -127,7 +131,7 @@ XC::Node::Node(int theClassTag)
 //! subclasses who wish to handle their own data management.
 XC::Node::Node(int tag, int theClassTag)
   :MeshComponent(tag,theClassTag),
-   numberDOF(0), theDOF_GroupPtr(nullptr),
+   numberDOF(0), theDOF_GroupPtr(nullptr), positionStamp(0),
    disp(), vel(), accel(), 
    unbalLoad(numberDOF), unbalLoadWithInertia(numberDOF), reaction(numberDOF),
    alphaM(0.0), tributary(0.0)
@@ -154,7 +158,7 @@ XC::Node::Node(int tag, int theClassTag)
 XC::Node::Node(int tag, int ndof, double Crd1)
   :MeshComponent(tag,NOD_TAG_Node),
    numberDOF(ndof), theDOF_GroupPtr(nullptr),
-   Crd(1), disp(), vel(), accel(),
+   Crd(1), positionStamp(0), disp(), vel(), accel(),
    mass(ndof,ndof), unbalLoad(numberDOF), unbalLoadWithInertia(numberDOF),
    reaction(numberDOF), alphaM(0.0), tributary(0.0)
   {
@@ -186,7 +190,7 @@ XC::Node::Node(int tag, int ndof, double Crd1)
 //! reduce the memory demands on the system in certain situations.
 XC::Node::Node(int tag, int ndof, double Crd1, double Crd2)
   :MeshComponent(tag,NOD_TAG_Node),numberDOF(ndof), theDOF_GroupPtr(nullptr),
-   Crd(2), disp(), vel(), accel(),
+   Crd(2), positionStamp(0), disp(), vel(), accel(),
    mass(ndof,ndof), unbalLoad(numberDOF), unbalLoadWithInertia(numberDOF), reaction(numberDOF),
    alphaM(0.0), tributary(0.0)
   {
@@ -220,7 +224,7 @@ XC::Node::Node(int tag, int ndof, double Crd1, double Crd2)
 //! reduce the memory demands on the system in certain situations.
 XC::Node::Node(int tag, int ndof, double Crd1, double Crd2, double Crd3)
   :MeshComponent(tag,NOD_TAG_Node), numberDOF(ndof), theDOF_GroupPtr(nullptr),
-   Crd(3), disp(), vel(), accel(),
+   Crd(3), positionStamp(0), disp(), vel(), accel(),
    mass(ndof,ndof), unbalLoad(numberDOF), unbalLoadWithInertia(numberDOF), reaction(numberDOF),
    alphaM(0.0), tributary(0.0)
   {
@@ -244,7 +248,7 @@ XC::Node::Node(int tag, int ndof, double Crd1, double Crd2, double Crd3)
 XC::Node::Node(int tag, int ndof, const Vector &crds)
   :MeshComponent(tag,NOD_TAG_Node),
    numberDOF(ndof), theDOF_GroupPtr(nullptr),
-   Crd(crds), disp(), vel(), accel(),
+   Crd(crds), positionStamp(0), disp(), vel(), accel(),
    mass(ndof,ndof), unbalLoad(numberDOF), unbalLoadWithInertia(numberDOF), reaction(numberDOF),
     alphaM(0.0), tributary(0.0)
   {
@@ -262,7 +266,7 @@ XC::Node::Node(int tag, int ndof, const Vector &crds)
 //!  we should really set the mass to 0.0
 XC::Node::Node(const Node &otherNode, bool copyMass)
   :MeshComponent(otherNode), numberDOF(otherNode.numberDOF),
-   theDOF_GroupPtr(nullptr), Crd(otherNode.Crd),
+   theDOF_GroupPtr(nullptr), Crd(otherNode.Crd), positionStamp(0),
    disp(otherNode.disp), vel(otherNode.vel), accel(otherNode.accel),
    R(otherNode.R), unbalLoad(otherNode.unbalLoad),
    unbalLoadWithInertia(otherNode.unbalLoadWithInertia),
@@ -360,7 +364,7 @@ void XC::Node::freeze_if_dead(NodeLocker *locker)
 //! @brief Returns a vector with the constraints identifiers. 
 const XC::ID &XC::Node::get_id_constraints(void) const
   {
-    static ID retval;
+    static thread_local ID retval;
     size_t cont= 0;
     retval.resize(freeze_constraints.size());
     for(std::set<int>::const_iterator i= freeze_constraints.begin();i!=freeze_constraints.end();i++,cont++)
@@ -416,6 +420,8 @@ void XC::Node::alive(void)
 XC::Node::~Node(void)
   {
     if(theDOF_GroupPtr) theDOF_GroupPtr->resetNodePtr();
+    if(positionStamp>moveLogBase) //The move log points to this node.
+      clear_move_log();
   }
 
 //! @brief Returns a default value for node identifier.
@@ -500,7 +506,9 @@ const XC::Vector &XC::Node::getCrds(void) const
 //! 
 //! Returns the original coordinates in a Vector. The size of the vector
 //! is 2 if node object was created for a 2d problem and the size is 3 if
-//! created for a 3d problem.
+//! created for a 3d problem. Changes made through this reference don't
+//! update the position stamp, so the spatial indexes won't see them;
+//! use setPos or Mueve to move the node.
 XC::Vector &XC::Node::getCrds(void)
   { return Crd; }
 
@@ -774,12 +782,13 @@ void XC::Node::setPos(const Pos3d &p)
         Crd[1]= p.y();
         Crd[2]= p.z();
       }
+    position_changed();
   }
 
 //! @brief Applies to the node position the transformation being passed as parameter.
 void XC::Node::Transforma(const TrfGeom &trf)
   {
-    static Pos3d p;
+    static thread_local Pos3d p;
     setPos(trf.Transforma(getInitialPosition3d()));
   }
 
@@ -1148,6 +1157,27 @@ int XC::Node::revertToStart(void)
     return 0;
   }
 
+//! @brief Places the displacement, velocity and acceleration vectors
+//! in the storage being passed as parameter (one pointer for each
+//! vector: trial, commited,...). Called by NodeStatePool.
+int XC::Node::setStateStorage(const std::vector<double *> &dispSlots,const std::vector<double *> &velSlots,const std::vector<double *> &accelSlots)
+  {
+    int retval= disp.setStorage(dispSlots,numberDOF);
+    retval+= vel.setStorage(velSlots,numberDOF);
+    retval+= accel.setStorage(accelSlots,numberDOF);
+    return retval;
+  }
+
+//! @brief Moves the displacement, velocity and acceleration vectors
+//! back to storage owned by the node.
+int XC::Node::releaseStateStorage(void)
+  {
+    int retval= disp.releaseStorage(numberDOF);
+    retval+= vel.releaseStorage(numberDOF);
+    retval+= accel.releaseStorage(numberDOF);
+    return retval;
+  }
+
 //! @brief Return the matriz de masas of the node.
 //!
 //! Returns the mass matrix set for the node, which is a matrix of size
@@ -1666,6 +1696,7 @@ int XC::Node::recvData(const CommParameters &cp)
     res+= cp.receiveVector(unbalLoad,getDbTagData(),CommMetaData(7));
     res+= cp.receiveVector(unbalLoadWithInertia,getDbTagData(),CommMetaData(8));
     res+= cp.receiveVector(Crd,getDbTagData(),CommMetaData(9));
+    position_changed();
     res+= cp.receiveMatrix(R,getDbTagData(),CommMetaData(10));
     res+= cp.receiveDoubles(alphaM,tributary,getDbTagData(),CommMetaData(11));
     res+= cp.receiveMatrix(theEigenvectors,getDbTagData(),CommMetaData(12));
@@ -1855,6 +1886,7 @@ int XC::Node::updateParameter(int pparameterID, Information &info)
             {
               //Set el value of the coordenada.
               Crd(pparameterID-4) = info.theDouble;
+              position_changed();
 
               // Need to "setDomain" to make the change take effect.
               Domain *theDomain = this->getDomain();
@@ -1981,7 +2013,7 @@ const XC::MeshEdge *XC::Node::next(const std::deque<MeshEdge> &edges, const std:
 //! @brief Return the action of the elements from the set over this node.
 const XC::Vector &XC::Node::getResistingForce(const std::set<const Element *> &elements,const bool &inc_inertia) const
   {
-    static Vector retval;
+    static thread_local Vector retval;
     retval.resize(numberDOF);
     retval.Zero();
     if(isAlive())
@@ -2096,4 +2128,40 @@ void XC::Node::Mueve(const Vector3d &desplaz)
     Crd(0)+= desplaz.x();
     Crd(1)+= desplaz.y();
     Crd(2)+= desplaz.z();
+    position_changed();
+  }
+
+//! @brief Updates the position stamp of the node so the spatial
+//! indexes that contain it relocate it on its next query.
+void XC::Node::position_changed(void)
+  {
+    if(moveLog.size()>=maxMoveLogSize)
+      clear_move_log();
+    positionStamp= ++moveCounter;
+    moveLog.push_back(this);
+  }
+
+//! @brief Clears the move log (the spatial indexes that have not
+//! read it yet will check the position stamps of all their objects).
+void XC::Node::clear_move_log(void)
+  {
+    moveLog.clear();
+    moveLogBase= moveCounter;
+  }
+
+//! @brief Appends to moved the nodes whose position has changed
+//! since the move counter had the value being passed as parameter
+//! (a node can appear more than once). Returns false if the move
+//! log doesn't reach back that far.
+bool XC::Node::getMovedSince(const size_t &counter,std::vector<const Node *> &moved)
+  {
+    bool retval= false;
+    if(counter>=moveLogBase)
+      {
+        const size_t first= counter-moveLogBase; //moveLog[i] was moved when moveCounter became moveLogBase+i+1.
+        if(first<moveLog.size())
+          moved.insert(moved.end(),moveLog.begin()+first,moveLog.end());
+        retval= true;
+      }
+    return retval;
   }
@@ -70,6 +70,7 @@
 #include "NodeAccelVectors.h"
 #include "utility/matrix/Matrix.h"
 #include <boost/python/list.hpp>
+#include <vector>
 
 class Pos2d;
 class Pos3d;
@@ -114,6 +115,7 @@ class Node: public MeshComponent
     int numberDOF; //!< number of DOFs at Node
     DOF_Group *theDOF_GroupPtr; //!< pointer to associated DOF_Group
     Vector Crd; //!< original nodal coords
+    size_t positionStamp; //!< value of moveCounter when the node was last moved.
     
     NodeDispVectors disp; //! Displacement vectors (commited,trial,...)
     NodeVelVectors vel; //! Velocity vectors (commited,trial,...)
@@ -145,6 +147,12 @@ class Node: public MeshComponent
     void set_id_constraints(const ID &);
 
     static DefaultTag defaultTag; //<! tag for next new node.
+    static size_t moveCounter; //!< incremented each time a node changes its position.
+    static std::vector<const Node *> moveLog; //!< nodes moved since the log was cleared (in move order).
+    static size_t moveLogBase; //!< value of moveCounter when the move log was cleared.
+    static const size_t maxMoveLogSize= 65536; //!< maximum number of entries in the move log.
+    static void clear_move_log(void);
+    void position_changed(void);
   protected:
 
     DbTagData &getDbTagData(void) const;
@@ -210,6 +218,14 @@ class Node: public MeshComponent
     bool Out(const GeomObj3d &,const double &factor= 1.0, const double &tol= 0.0) const;
     bool Out(const GeomObj2d &,const double &factor= 1.0, const double &tol= 0.0) const;
     void setPos(const Pos3d &);
+    //! @brief Return the value of the move counter when the node
+    //! position was last changed (used to update spatial indexes).
+    inline size_t getPositionStamp(void) const
+      { return positionStamp; }
+    //! @brief Return the number of node position changes.
+    static inline size_t getMoveCounter(void)
+      { return moveCounter; }
+    static bool getMovedSince(const size_t &,std::vector<const Node *> &);
     void Mueve(const Vector3d &desplaz);  
     void Transforma(const TrfGeom &trf);
     double getDist2(const Pos2d &p,bool initialGeometry= true) const;
@@ -258,6 +274,13 @@ class Node: public MeshComponent
     virtual int revertToLastCommit();    
     virtual int revertToStart();        
 
+    // storage of the state in a domain wide pool (see NodeStatePool).
+    int setStateStorage(const std::vector<double *> &,const std::vector<double *> &,const std::vector<double *> &);
+    int releaseStateStorage(void);
+    //! @brief Zeroes the reaction (used by bulk reverts of the mesh).
+    inline void zeroReaction(void)
+      { reaction.Zero(); }
+
     // public methods for dynamic analysis
     virtual const Matrix &getMass(void);
     virtual int setMass(const Matrix &theMass);
@@ -29,6 +29,7 @@
 #include <domain/mesh/node/NodeDispVectors.h>
 #include <utility/tagged/TaggedObject.h>
 #include <utility/matrix/Vector.h>
+#include <algorithm>
 
 
 
@@ -121,9 +122,9 @@ int XC::NodeDispVectors::setTrialDispComponent(const size_t &nDOF,const double &
     // perform the assignment .. we dont't go through Vector interface
     // as we are sure of size and this way is quicker
     const double tDisp = value;
-    values[dof+2*nDOF]= tDisp - values[dof+nDOF];
-    values[dof+3*nDOF]= tDisp - values[dof];
-    values[dof]= tDisp;
+    slots[2][dof]= tDisp - slots[1][dof];
+    slots[3][dof]= tDisp - slots[0][dof];
+    slots[0][dof]= tDisp;
 
     return 0;
   }
@@ -154,12 +155,16 @@ int XC::NodeDispVectors::setTrialDisp(const size_t &nDOF,const Vector &newTrialD
 
     // perform the assignment .. we dont't go through Vector interface
     // as we are sure of size and this way is quicker
+    double *trial= slots[0];
+    const double *commit= slots[1];
+    double *incr= slots[2];
+    double *incrDelta= slots[3];
     for(size_t i=0;i<nDOF;i++)
       {
         const double tDisp = newTrialDisp(i);
-        values[i+2*nDOF]= tDisp - values[i+nDOF];
-        values[i+3*nDOF]= tDisp - values[i];
-        values[i] = tDisp;
+        incr[i]= tDisp - commit[i];
+        incrDelta[i]= tDisp - trial[i];
+        trial[i] = tDisp;
       }
     return 0;
   }
@@ -188,20 +193,23 @@ int XC::NodeDispVectors::incrTrialDisp(const size_t &nDOF,const Vector &incrDisp
         for(size_t i=0;i<nDOF;i++)
           {
             const double incrDispI = incrDispl(i);
-            values[i]= incrDispI;
-            values[i+2*nDOF]= incrDispI;
-            values[i+3*nDOF]= incrDispI;
+            slots[0][i]= incrDispI;
+            slots[2][i]= incrDispI;
+            slots[3][i]= incrDispI;
           }
         return 0;
       }
 
     // otherwise set trial = incr + trial
+    double *trial= slots[0];
+    double *incr= slots[2];
+    double *incrDelta= slots[3];
     for(size_t i= 0;i<nDOF;i++)
       {
         double incrDispI = incrDispl(i);
-        values[i]+= incrDispI;
-        values[i+2*nDOF]+= incrDispI;
-        values[i+3*nDOF]= incrDispI;
+        trial[i]+= incrDispI;
+        incr[i]+= incrDispI;
+        incrDelta[i]= incrDispI;
       }
     return 0;
   }
@@ -211,14 +219,11 @@ int XC::NodeDispVectors::incrTrialDisp(const size_t &nDOF,const Vector &incrDisp
 int XC::NodeDispVectors::commitState(const size_t &nDOF)
   {
     // check disp exists, if does set commit = trial, incr = 0.0
-    if(trialData)
+    if(hasData())
       {
-        for(size_t i=0; i<nDOF; i++)
-          {
-            values[i+nDOF]= values[i];
-            values[i+2*nDOF]= 0.0;
-            values[i+3*nDOF]= 0.0;
-          }
+        std::copy(slots[0],slots[0]+nDOF,slots[1]);
+        std::fill(slots[2],slots[2]+nDOF,0.0);
+        std::fill(slots[3],slots[3]+nDOF,0.0);
       }
     return 0;
   }
@@ -229,14 +234,11 @@ int XC::NodeDispVectors::commitState(const size_t &nDOF)
 int XC::NodeDispVectors::revertToLastCommit(const size_t &nDOF)
   {
     // check disp exists, if does set trial = last commit, incr = 0
-    if(!values.isEmpty())
+    if(hasData())
       {
-        for(size_t i=0;i<nDOF;i++)
-          {
-            values[i] = values[i+nDOF];
-            values[i+2*nDOF]= 0.0;
-            values[i+3*nDOF]= 0.0;
-          }
+        std::copy(slots[1],slots[1]+nDOF,slots[0]);
+        std::fill(slots[2],slots[2]+nDOF,0.0);
+        std::fill(slots[3],slots[3]+nDOF,0.0);
       }
     return 0;
   }
@@ -255,10 +257,20 @@ void XC::NodeDispVectors::Print(std::ostream &s,int flag)
 int XC::NodeDispVectors::createDisp(const size_t &nDOF)
   {
     // trial , committed, incr = (committed-trial)
-    NodeVectors::createData(nDOF);
+    return NodeVectors::createData(nDOF);
+  }
+
+//! @brief Creates the Vector objects for the committed and trial
+//! displacements and its increments.
+//! @param nDOF: number of degrees of freedom.
+int XC::NodeDispVectors::createViews(const size_t &nDOF)
+  {
+    const int retval= NodeVectors::createViews(nDOF);
+    if(retval<0)
+      return retval;
 
-    incrDisp = new Vector(&values[2*nDOF], nDOF);
-    incrDeltaDisp = new Vector(&values[3*nDOF], nDOF);
+    incrDisp = new Vector(slots[2], nDOF);
+    incrDeltaDisp = new Vector(slots[3], nDOF);
 
     if(incrDisp == nullptr || incrDeltaDisp == nullptr)
       {
@@ -46,7 +46,8 @@ class NodeDispVectors: public NodeVectors
     Vector *incrDisp;
     Vector *incrDeltaDisp;
   protected:
-    void free_mem(void);
+    virtual int createViews(const size_t &);
+    virtual void free_mem(void);
   public:
     // constructors
     NodeDispVectors(void);
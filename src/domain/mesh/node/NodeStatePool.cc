@@ -0,0 +1,146 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//NodeStatePool.cc
+
+#include "NodeStatePool.h"
+#include "Node.h"
+#include "NodeIter.h"
+#include <algorithm>
+#include <functional>
+#include <iostream>
+
+//! @brief Constructor.
+XC::NodeStatePool::NodeStatePool(void)
+  : nodes(), numDOFs(0), workers(1) {}
+
+//! @brief Destructor (moves the state back to the nodes).
+XC::NodeStatePool::~NodeStatePool(void)
+  { clear(); }
+
+//! @brief Sets the number of threads used in the bulk operations.
+void XC::NodeStatePool::setNumThreads(const size_t &n)
+  { workers.setNumThreads(n); }
+
+//! @brief Returns the pointers to the first component of the node
+//! (offset) in each of the nv vectors stored in data.
+std::vector<double *> XC::NodeStatePool::get_slots(std::vector<double> &data,const size_t &nv,const size_t &nDOFs,const size_t &offset)
+  {
+    std::vector<double *> retval(nv);
+    for(size_t k= 0;k<nv;k++)
+      retval[k]= &data[k*nDOFs+offset];
+    return retval;
+  }
+
+//! @brief Moves the state of the nodes being iterated to
+//! the pool. The current values of the node vectors are kept.
+int XC::NodeStatePool::build(NodeIter &theNodes)
+  {
+    clear();
+    Node *nodePtr= nullptr;
+    while((nodePtr= theNodes()) != nullptr)
+      {
+        nodes.push_back(nodePtr);
+        numDOFs+= nodePtr->getNumberDOF();
+      }
+    if(numDOFs==0)
+      {
+        nodes.clear();
+        return 0;
+      }
+    dispData.assign(4*numDOFs,0.0);
+    velData.assign(2*numDOFs,0.0);
+    accelData.assign(2*numDOFs,0.0);
+
+    int retval= 0;
+    size_t offset= 0;
+    for(node_ptrs::const_iterator i= nodes.begin();i!=nodes.end();i++)
+      {
+        Node *n= *i;
+        const size_t nDOF= n->getNumberDOF();
+        if(nDOF>0)
+          retval+= n->setStateStorage(get_slots(dispData,4,numDOFs,offset),get_slots(velData,2,numDOFs,offset),get_slots(accelData,2,numDOFs,offset));
+        offset+= nDOF;
+      }
+    if(retval!=0)
+      std::cerr << "NodeStatePool::" << __FUNCTION__
+                << "; error when moving node state to the pool.\n";
+    return retval;
+  }
+
+//! @brief Moves the state back to the nodes and frees the pool.
+void XC::NodeStatePool::clear(void)
+  {
+    for(node_ptrs::const_iterator i= nodes.begin();i!=nodes.end();i++)
+      (*i)->releaseStateStorage();
+    nodes.clear();
+    numDOFs= 0;
+    dispData.clear();
+    velData.clear();
+    accelData.clear();
+  }
+
+//! @brief Commits the DOFs in the range [begin,end):
+//! commited= trial, displacement increments= 0.
+void XC::NodeStatePool::commit_range(const size_t &begin,const size_t &end)
+  {
+    const size_t n= numDOFs;
+    double *d= dispData.data();
+    std::copy(d+begin,d+end,d+n+begin);
+    std::fill(d+2*n+begin,d+2*n+end,0.0);
+    std::fill(d+3*n+begin,d+3*n+end,0.0);
+    double *v= velData.data();
+    std::copy(v+begin,v+end,v+n+begin);
+    double *a= accelData.data();
+    std::copy(a+begin,a+end,a+n+begin);
+  }
+
+//! @brief Reverts the DOFs in the range [begin,end):
+//! trial= commited, displacement increments= 0.
+void XC::NodeStatePool::revert_range(const size_t &begin,const size_t &end)
+  {
+    const size_t n= numDOFs;
+    double *d= dispData.data();
+    std::copy(d+n+begin,d+n+end,d+begin);
+    std::fill(d+2*n+begin,d+2*n+end,0.0);
+    std::fill(d+3*n+begin,d+3*n+end,0.0);
+    double *v= velData.data();
+    std::copy(v+n+begin,v+n+end,v+begin);
+    double *a= accelData.data();
+    std::copy(a+n+begin,a+n+end,a+begin);
+  }
+
+//! @brief Commits the state of all the nodes in the pool
+//! (same effect as calling commitState on each node).
+void XC::NodeStatePool::commit(void)
+  {
+    if(numDOFs>0)
+      workers.run_blocks(std::bind(&NodeStatePool::commit_range,this,std::placeholders::_1,std::placeholders::_2),numDOFs);
+  }
+
+//! @brief Returns the displacements, velocities and accelerations of
+//! all the nodes in the pool to its last commited values (the node
+//! reactions are not changed).
+void XC::NodeStatePool::revertToLastCommit(void)
+  {
+    if(numDOFs>0)
+      workers.run_blocks(std::bind(&NodeStatePool::revert_range,this,std::placeholders::_1,std::placeholders::_2),numDOFs);
+  }
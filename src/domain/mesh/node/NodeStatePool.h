@@ -0,0 +1,94 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//NodeStatePool.h
+
+#ifndef NodeStatePool_h
+#define NodeStatePool_h
+
+#include <vector>
+#include <cstddef>
+#include "utility/WorkerPool.h"
+
+namespace XC {
+class Node;
+class NodeIter;
+
+//! \ingroup Nod
+//
+//! @brief Domain wide storage for the displacement, velocity
+//! and acceleration vectors of the nodes.
+//!
+//! The state of the nodes is stored as a structure of arrays: all
+//! the trial displacements are contiguous, all the commited
+//! displacements are contiguous and so on. The vectors returned
+//! by the nodes (getTrialDisp, getDisp,...) are views into these
+//! arrays, so committing or reverting the whole mesh reduces
+//! to a few bulk copies, that can be split between threads.
+class NodeStatePool
+  {
+  public:
+    typedef std::vector<Node *> node_ptrs;
+  private:
+    node_ptrs nodes; //!< nodes whose state is stored in the pool.
+    size_t numDOFs; //!< total number of degrees of freedom.
+    std::vector<double> dispData; //!< trial, commited, incremental and delta incremental displacements.
+    std::vector<double> velData; //!< trial and commited velocities.
+    std::vector<double> accelData; //!< trial and commited accelerations.
+    WorkerPool workers; //!< threads for the bulk operations.
+
+    static std::vector<double *> get_slots(std::vector<double> &,const size_t &,const size_t &,const size_t &);
+    void commit_range(const size_t &,const size_t &);
+    void revert_range(const size_t &,const size_t &);
+
+    NodeStatePool(const NodeStatePool &);
+    NodeStatePool &operator=(const NodeStatePool &);
+  public:
+    NodeStatePool(void);
+    ~NodeStatePool(void);
+
+    int build(NodeIter &);
+    void clear(void);
+    //! @brief Returns true if there are no nodes in the pool.
+    inline bool empty(void) const
+      { return nodes.empty(); }
+    //! @brief Returns the number of nodes in the pool.
+    inline size_t getNumNodes(void) const
+      { return nodes.size(); }
+    //! @brief Returns the total number of degrees of freedom.
+    inline size_t getNumDOFs(void) const
+      { return numDOFs; }
+    //! @brief Returns the nodes whose state is stored in the pool.
+    inline const node_ptrs &getNodes(void) const
+      { return nodes; }
+
+    //! @brief Returns the number of threads used in the bulk operations.
+    inline size_t getNumThreads(void) const
+      { return workers.getNumThreads(); }
+    void setNumThreads(const size_t &);
+
+    void commit(void);
+    void revertToLastCommit(void);
+  };
+
+} // end of XC namespace
+
+#endif
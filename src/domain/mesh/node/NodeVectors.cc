@@ -30,6 +30,7 @@
 #include <utility/tagged/TaggedObject.h>
 #include <utility/matrix/Vector.h>
 #include <utility/matrix/ID.h>
+#include <algorithm>
 
 #include <utility/actor/objectBroker/FEM_ObjectBroker.h>
 
@@ -42,32 +43,36 @@ void XC::NodeVectors::free_mem(void)
     trialData= nullptr;
   }
 
+//! @brief Copy the values from the object being passed as parameter
+//! (the copy always owns its storage).
 void XC::NodeVectors::copia(const NodeVectors &otro)
   {
     free_mem();
     numVectors= otro.numVectors;
-    if(otro.commitData)
+    slots.clear();
+    values= Vector();
+    externalStorage= false;
+    if(otro.hasData())
       {
         const size_t nDOF= otro.getVectorsSize();
-        const size_t sz= numVectors*nDOF;
         if(this->createData(nDOF) < 0)
           {
             std::cerr << " FATAL NodeVectors::Node(node *) - ran out of memory for data\n";
             exit(-1);
           }
-        for(register size_t i=0;i<sz;i++)
-          values[i] = otro.values[i];
+        for(size_t k= 0;k<numVectors;k++)
+          std::copy(otro.slots[k],otro.slots[k]+nDOF,slots[k]);
       }
   }
 
 //! @brief Constructor.
 XC::NodeVectors::NodeVectors(const size_t &nv)
-  :EntCmd(),MovableObject(NOD_TAG_NodeVectors), numVectors(nv), commitData(nullptr),trialData(nullptr), values() {}
+  :EntCmd(),MovableObject(NOD_TAG_NodeVectors), numVectors(nv), commitData(nullptr),trialData(nullptr), values(), slots(), externalStorage(false) {}
 
 
 //! @brief Constructor de copia.
 XC::NodeVectors::NodeVectors(const NodeVectors &otro)
-  : EntCmd(otro),MovableObject(NOD_TAG_NodeVectors), numVectors(otro.numVectors), commitData(nullptr), trialData(nullptr), values()
+  : EntCmd(otro),MovableObject(NOD_TAG_NodeVectors), numVectors(otro.numVectors), commitData(nullptr), trialData(nullptr), values(), slots(), externalStorage(false)
   { copia(otro); }
 
 XC::NodeVectors &XC::NodeVectors::operator=(const NodeVectors &otro)
@@ -147,8 +152,8 @@ int XC::NodeVectors::setTrialData(const size_t &nDOF,const double &value,const s
 
     // perform the assignment .. we dont't go through Vector interface
     // as we are sure of size and this way is quicker
-    if(!values.isEmpty())
-      values[dof]= value;
+    if(hasData())
+      slots[0][dof]= value;
     return 0;
   }
 
@@ -165,7 +170,7 @@ int XC::NodeVectors::setTrialData(const size_t &nDOF,const Vector &newTrialData)
     // construct memory and Vectors for trial and committed
     // accel on first call to this method, getTrialData(),
     // getData(), or incrTrialData()
-    if(values.isEmpty())
+    if(!hasData())
       {
         if(this->createData(nDOF) < 0)
           {
@@ -176,8 +181,9 @@ int XC::NodeVectors::setTrialData(const size_t &nDOF,const Vector &newTrialData)
 
     // perform the assignment .. we dont't go through XC::Vector interface
     // as we are sure of size and this way is quicker
+    double *trial= slots[0];
     for(size_t i=0;i<nDOF;i++)
-      values[i]= newTrialData(i);
+      trial[i]= newTrialData(i);
     return 0;
   }
 
@@ -192,7 +198,7 @@ int XC::NodeVectors::incrTrialData(const size_t &nDOF,const Vector &incrData)
       }
 
     // create a copy if no trial exists andd add committed
-    if(values.isEmpty())
+    if(!hasData())
       {
         if(this->createData(nDOF) < 0)
           {
@@ -201,8 +207,9 @@ int XC::NodeVectors::incrTrialData(const size_t &nDOF,const Vector &incrData)
           }
       }
     // set trial = incr + trial
+    double *trial= slots[0];
     for(size_t i= 0;i<nDOF;i++)
-      values[i]+= incrData(i);
+      trial[i]+= incrData(i);
     return 0;
   }
 
@@ -210,11 +217,8 @@ int XC::NodeVectors::incrTrialData(const size_t &nDOF,const Vector &incrData)
 int XC::NodeVectors::commitState(const size_t &nDOF)
   {
     // check data exists, if does set commit = trial, incr = 0.0
-    if(trialData)
-      {
-        for(register size_t i=0; i<nDOF; i++)
-          values[i+nDOF] = values[i];
-      }
+    if(hasData())
+      std::copy(slots[0],slots[0]+nDOF,slots[1]);
     return 0;
   }
 
@@ -223,11 +227,8 @@ int XC::NodeVectors::commitState(const size_t &nDOF)
 int XC::NodeVectors::revertToLastCommit(const size_t &nDOF)
   {
     // check data exists, if does set trial = last commit, incr = 0
-    if(!values.isEmpty())
-      {
-        for(size_t i=0;i<nDOF;i++)
-          values[i] = values[nDOF+i];
-      }
+    if(hasData())
+      std::copy(slots[1],slots[1]+nDOF,slots[0]);
     return 0;
   }
 
@@ -236,11 +237,10 @@ int XC::NodeVectors::revertToLastCommit(const size_t &nDOF)
 int XC::NodeVectors::revertToStart(const size_t &nDOF)
   {
     // check data exists, if does set all to zero
-    const size_t sz= numVectors*nDOF;
-    if(!values.isEmpty())
+    if(hasData())
       {
-        for(size_t i=0;i<sz;i++)
-          values[i]= 0.0;
+        for(size_t k= 0;k<numVectors;k++)
+          std::fill(slots[k],slots[k]+nDOF,0.0);
       }
     return 0;
   }
@@ -248,34 +248,97 @@ int XC::NodeVectors::revertToStart(const size_t &nDOF)
 
 //! @brief private method to create the arrays to hold the data
 //! values and the Vector objects for the committed and trial quantities.
+//!
+//! If the data is stored in a NodeStatePool the values are zeroed
+//! and the Vector objects rebuilt over that storage.
 int XC::NodeVectors::createData(const size_t &nDOF)
   {
     free_mem();
-    // trial , committed, incr = (committed-trial)
-    const size_t sz= numVectors*nDOF;
-    values= Vector(sz);
-
-    if(!values.isEmpty())
+    if(externalStorage && (slots.size()==numVectors))
+      {
+        for(size_t k= 0;k<numVectors;k++)
+          std::fill(slots[k],slots[k]+nDOF,0.0);
+      }
+    else
       {
+        externalStorage= false;
+        // trial , committed, incr = (committed-trial)
+        const size_t sz= numVectors*nDOF;
+        values= Vector(sz);
+        if(values.isEmpty())
+          {
+            slots.clear();
+            std::cerr << "WARNING - XC::NodeVectors::createData() ran out of memory for array of size " << sz << std::endl;
+            return -1;
+          }
         for(size_t i=0;i<sz;i++)
           values[i]= 0.0;
+        slots.resize(numVectors);
+        for(size_t k= 0;k<numVectors;k++)
+          slots[k]= &values[k*nDOF];
+      }
+    return createViews(nDOF);
+  }
 
-        trialData= new Vector(&values[0], nDOF);
-        commitData= new Vector(&values[nDOF], nDOF);
+//! @brief Creates the Vector objects for the committed and trial
+//! quantities over the storage pointed by the slots.
+int XC::NodeVectors::createViews(const size_t &nDOF)
+  {
+    trialData= new Vector(slots[0], nDOF);
+    commitData= new Vector(slots[1], nDOF);
 
-        if(!commitData || !trialData)
-          {
-            std::cerr << "WARNING - XC::NodeVectors::createData() "
+    if(!commitData || !trialData)
+      {
+        std::cerr << "WARNING - XC::NodeVectors::createData() "
                   << "ran out of memory creating Vectors(double *,int)";
-            return -2;
-          }
-        return 0;
+        return -2;
       }
-    else
+    return 0;
+  }
+
+//! @brief Moves the data to the storage being passed as parameter
+//! (one pointer for each vector: trial, commited,...). Used by
+//! NodeStatePool to place the state of all the nodes in contiguous
+//! arrays. The current values (if any) are copied to the new storage.
+int XC::NodeVectors::setStorage(const std::vector<double *> &ptrs,const size_t &nDOF)
+  {
+    if(ptrs.size()!=numVectors)
       {
-        std::cerr << "WARNING - XC::NodeVectors::createData() ran out of memory for array of size " << sz << std::endl;
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; wrong number of vectors: " << ptrs.size()
+                  << " (" << numVectors << " expected).\n";
         return -1;
       }
+    for(size_t k= 0;k<numVectors;k++)
+      {
+        if(hasData())
+          std::copy(slots[k],slots[k]+nDOF,ptrs[k]);
+        else
+          std::fill(ptrs[k],ptrs[k]+nDOF,0.0);
+      }
+    free_mem();
+    slots= ptrs;
+    values= Vector();
+    externalStorage= true;
+    return createViews(nDOF);
+  }
+
+//! @brief Moves the data from the NodeStatePool back to storage
+//! owned by this object.
+int XC::NodeVectors::releaseStorage(const size_t &nDOF)
+  {
+    int retval= 0;
+    if(externalStorage)
+      {
+        const std::vector<double *> tmp= slots;
+        externalStorage= false;
+        slots.clear();
+        retval= createData(nDOF);
+        if(retval==0)
+          for(size_t k= 0;k<numVectors;k++)
+            std::copy(tmp[k],tmp[k]+nDOF,slots[k]);
+      }
+    return retval;
   }
 
 //! @brief Returns a vector to store the dbTags
@@ -331,8 +394,7 @@ int XC::NodeVectors::recvData(const CommParameters &cp)
           }
 
         // set the trial quantities equal to committed
-        for(int i=0; i<nDOF; i++)
-          values[i]= values[i+nDOF]; // set trial equal commited
+        std::copy(slots[1],slots[1]+nDOF,slots[0]); // set trial equal commited
       }
     else if(commitData)
       {
@@ -33,6 +33,7 @@
 #include "utility/actor/actor/MovableObject.h"
 #include "xc_utils/src/nucleo/EntCmd.h"
 #include "utility/matrix/Vector.h"
+#include <vector>
 
 namespace XC {
 
@@ -52,12 +53,18 @@ class NodeVectors: public EntCmd, public MovableObject
     Vector *trialData; //!< trial quantities
     
     Vector values; //!< double array holding the displacement/velocity/acceleration.
+    std::vector<double *> slots; //!< pointers to the first component of each vector (trial, commited,...).
+    bool externalStorage; //!< true if the data is stored in a NodeStatePool.
 
+    //! @brief Returns true if the storage for the vectors exists.
+    inline bool hasData(void) const
+      { return !slots.empty(); }
     DbTagData &getDbTagData(void) const;
     int sendData(CommParameters &);
     int recvData(const CommParameters &);
     int createData(const size_t &);
-    void free_mem(void);
+    virtual int createViews(const size_t &);
+    virtual void free_mem(void);
     void copia(const NodeVectors &);
   public:
     // constructors
@@ -68,6 +75,16 @@ class NodeVectors: public EntCmd, public MovableObject
 
     // public methods dealing with the DOF at the node
     size_t getVectorsSize(void) const;
+    //! @brief Returns the number of vectors (trial, commited,...).
+    inline size_t getNumVectors(void) const
+      { return numVectors; }
+
+    // storage of the data in a domain wide pool.
+    int setStorage(const std::vector<double *> &,const size_t &nDOF);
+    int releaseStorage(const size_t &nDOF);
+    //! @brief Returns true if the data is stored in a NodeStatePool.
+    inline bool hasExternalStorage(void) const
+      { return externalStorage; }
 
     // public methods for obtaining committed and trial 
     // response quantities of the node
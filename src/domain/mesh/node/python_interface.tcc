@@ -21,7 +21,7 @@
 //----------------------------------------------------------------------------
 //python_interface.tcc
 
-XC::Vector &(XC::Node::*getCooRef)(void)= &XC::Node::getCrds;
+const XC::Vector &(XC::Node::*getCooRef)(void) const= &XC::Node::getCrds;
 XC::Vector (XC::Node::*getDistributionFactor)(int) const= &XC::Node::getDistributionFactor;
 XC::Vector (XC::Node::*getDistributionFactorForDOFs)(int,const std::set<int> &) const= &XC::Node::getDistributionFactor;
 double (XC::Node::*getModalParticipationFactor)(int) const= &XC::Node::getModalParticipationFactor;
@@ -38,7 +38,8 @@ void (XC::Node::*fixDOFs)(const XC::ID &, const XC::Vector &)= &XC::Node::fix;
 bool (XC::Node::*In3D)(const GeomObj3d &,const double &,const double &) const= &XC::Node::In;
 bool (XC::Node::*Out3D)(const GeomObj3d &,const double &,const double &) const= &XC::Node::Out;
 class_<XC::Node, XC::Node *, bases<XC::MeshComponent>, boost::noncopyable >("Node", no_init)
-  .add_property("getCoo", make_function( getCooRef, return_internal_reference<>() ),"Return node coordinates.")
+  .add_property("getCoo", make_function( getCooRef, return_value_policy<copy_const_reference>() ),"Return a copy of the node coordinates (use setPos to move the node).")
+  .def("setPos", &XC::Node::setPos,"setPos(pos3d): move the node to the given position.")
   .add_property("mass",make_function(&XC::Node::getMass, return_internal_reference<>()) ,&XC::Node::setMass,"Node mass.")
   .add_property("get3dCoo", &XC::Node::getCrds3d,"Return 3D coordinates of the node.")
   .add_property("getPos2d", &XC::Node::getPosition2d,"getPosition2d(v), returns the 2D position obtained by adding the vector to the position of node.")
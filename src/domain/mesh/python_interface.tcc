@@ -51,6 +51,22 @@ class_<XC::Mesh, bases<XC::MeshComponentContainer>, boost::noncopyable >("Mesh",
   .def("getNumLiveElements", &XC::Mesh::getNumLiveElements,"Returns the number of live elements.")
   .def("getNumDeadElements", &XC::Mesh::getNumDeadElements,"Returns the number of dead elements.")
   .def("getNearestElement",make_function(getNearestElementPtrMesh, return_internal_reference<>() ),"Returns nearest node.")
+  .def("getNearestNodes", &XC::Mesh::getNearestNodes,"getNearestNodes(p,k) returns the k nodes closest to p.")
+  .def("pickNodesWithinRadius", &XC::Mesh::pickNodesWithinRadius,"pickNodesWithinRadius(p,r) returns the nodes at a distance not greater than r from p.")
+  .def("pickNodesInsideBox", &XC::Mesh::pickNodesInsideBox,"pickNodesInsideBox(pMin,pMax) returns the nodes inside the box defined by its corners.")
+  .def("pickNodesInsideHalfSpace", &XC::Mesh::pickNodesInsideHalfSpace,"pickNodesInsideHalfSpace(org,n,tol) returns the nodes in the half space bounded by the plane through org with outward normal n.")
+  .def("pickNodesInside", &XC::Mesh::pickNodesInside,"pickNodesInside(geomObj,tol) returns the nodes inside the geometric object.")
+  .def("pickNodesInsidePrism", &XC::Mesh::pickNodesInsidePrism,"pickNodesInsidePrism(geomObj2d,zMin,zMax,tol) returns the nodes inside the prism obtained by extruding the 2D object between zMin and zMax.")
+  .def("getNearestElements", &XC::Mesh::getNearestElements,"getNearestElements(p,k) returns the k elements whose centroids are closest to p.")
+  .def("pickElemsWithinRadius", &XC::Mesh::pickElemsWithinRadius,"pickElemsWithinRadius(p,r) returns the elements whose centroid is at a distance not greater than r from p.")
+  .def("pickElemsInsideBox", &XC::Mesh::pickElemsInsideBox,"pickElemsInsideBox(pMin,pMax) returns the elements inside the box defined by its corners.")
+  .def("pickElemsInsideHalfSpace", &XC::Mesh::pickElemsInsideHalfSpace,"pickElemsInsideHalfSpace(org,n,tol) returns the elements in the half space bounded by the plane through org with outward normal n.")
+  .def("pickElemsInside", &XC::Mesh::pickElemsInside,"pickElemsInside(geomObj,tol) returns the elements inside the geometric object.")
+  .def("pickElemsInsidePrism", &XC::Mesh::pickElemsInsidePrism,"pickElemsInsidePrism(geomObj2d,zMin,zMax,tol) returns the elements inside the prism obtained by extruding the 2D object between zMin and zMax.")
+  .add_property("storageMode", &XC::Mesh::getStorageMode, &XC::Mesh::setStorageMode,"Storage mode of nodes and elements: 'map' (iterated in tag order) or 'vector' (dense storage iterated in insertion order).")
+  .def("sortComponentsByTag", &XC::Mesh::sortComponentsByTag,"Sort nodes and elements by tag (only for 'vector' storage mode).")
+  .add_property("useNodeStatePool", &XC::Mesh::getUseNodeStatePool, &XC::Mesh::setUseNodeStatePool,"If true, the displacements, velocities and accelerations of the nodes are stored in contiguous arrays and committed/reverted in bulk.")
+  .add_property("nodeStatePoolNumThreads", &XC::Mesh::getNodeStatePoolNumThreads, &XC::Mesh::setNodeStatePoolNumThreads,"Number of threads used to commit/revert the node state pool.")
   .def("setDeadSRF",XC::Mesh::setDeadSRF,"Assigns Stress Reduction Factor for element deactivation. Syntax: setDeadSRF(factor)")
   .staticmethod("setDeadSRF")
   ;
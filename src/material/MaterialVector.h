@@ -297,7 +297,7 @@ m_double MaterialVector<MAT>::getGeneralizedStrains(void) const
 template <class MAT>
 const Vector &MaterialVector<MAT>::getMeanGeneralizedStress(void) const
   {
-    static Vector retval;
+    static thread_local Vector retval;
     retval= (*this)[0]->getGeneralizedStress();
     const size_t nMat= this->size();
     for(size_t i= 1;i<nMat;i++)
@@ -310,7 +310,7 @@ const Vector &MaterialVector<MAT>::getMeanGeneralizedStress(void) const
 template <class MAT>
 const Vector &MaterialVector<MAT>::getMeanGeneralizedStrain(void) const
   {
-    static Vector retval;
+    static thread_local Vector retval;
     retval= (*this)[0]->getGeneralizedStrain();
     const size_t nMat= this->size();
     for(size_t i= 0;i<nMat;i++)
@@ -61,8 +61,8 @@
 //XC::Tensor XC::ElasticCrossAnisotropic::rank2 (2, def_dim_2, 0.0 ) ;
 //XC::Tensor XC::ElasticCrossAnisotropic::rank4 (2, def_dim_2, 0.0 ) ;
 
-XC::Vector XC::ElasticCrossAnisotropic::sigma(6);
-XC::Matrix XC::ElasticCrossAnisotropic::D(6, 6);
+thread_local XC::Vector XC::ElasticCrossAnisotropic::sigma(6);
+thread_local XC::Matrix XC::ElasticCrossAnisotropic::D(6, 6);
 
 ///////////////////////////////////////////////////////////////////////////////
 XC::ElasticCrossAnisotropic::ElasticCrossAnisotropic(int tag,double Ehp, double Evp, 
@@ -226,7 +226,7 @@ const XC::straintensor &XC::ElasticCrossAnisotropic::getStrainTensor(void) const
 const XC::straintensor &XC::ElasticCrossAnisotropic::getPlasticStrainTensor(void) const
   {
      //Return zero XC::straintensor
-     static XC::straintensor t;
+     static thread_local XC::straintensor t;
      return t;
   }
 
@@ -67,8 +67,8 @@ namespace XC {
 class ElasticCrossAnisotropic : public NDMaterial
   {
   private:
-    static Vector sigma; //!< Stress vector ... class-wide for returns
-    static Matrix D; //!< Elastic constants
+    static thread_local Vector sigma; //!< Stress vector ... class-wide for returns
+    static thread_local Matrix D; //!< Elastic constants
     Vector Tepsilon; //!< Trial strain vector
     Vector Cepsilon; //!< Commited strains
 
@@ -65,21 +65,21 @@
 #include <cfloat>
 #include "material/nD/TipoMaterialND.h"
 
-double XC::FeapMaterial::d[200];
-double XC::FeapMaterial::sig[6];
-double XC::FeapMaterial::dd[36];
+thread_local double XC::FeapMaterial::d[200];
+thread_local double XC::FeapMaterial::sig[6];
+thread_local double XC::FeapMaterial::dd[36];
 
-XC::Vector XC::FeapMaterial::strain3(3);
-XC::Vector XC::FeapMaterial::strain4(4);
-XC::Vector XC::FeapMaterial::strain6(6);
+thread_local XC::Vector XC::FeapMaterial::strain3(3);
+thread_local XC::Vector XC::FeapMaterial::strain4(4);
+thread_local XC::Vector XC::FeapMaterial::strain6(6);
 
-XC::Vector XC::FeapMaterial::sigma3(3);
-XC::Vector XC::FeapMaterial::sigma4(4);
-XC::Vector XC::FeapMaterial::sigma6(sig,6);
+thread_local XC::Vector XC::FeapMaterial::sigma3(3);
+thread_local XC::Vector XC::FeapMaterial::sigma4(4);
+thread_local XC::Vector XC::FeapMaterial::sigma6(sig,6);
 
-XC::Matrix XC::FeapMaterial::tangent3(3,3);
-XC::Matrix XC::FeapMaterial::tangent4(4,4);
-XC::Matrix XC::FeapMaterial::tangent6(dd,6,6);
+thread_local XC::Matrix XC::FeapMaterial::tangent3(3,3);
+thread_local XC::Matrix XC::FeapMaterial::tangent4(4,4);
+thread_local XC::Matrix XC::FeapMaterial::tangent6(dd,6,6);
 
 XC::FeapMaterial::FeapMaterial(int tag, int classTag, int nhv, int ndata, double r)
   :XC::NDMaterial(tag,classTag), ud(0), hstv(0), rho(r),
@@ -355,7 +355,7 @@ int XC::FeapMaterial::sendSelf(CommParameters &cp)
   {
     int res = 0;
   
-    static ID idData(4);
+    static thread_local ID idData(4);
   
     idData(0) = this->getTag();
     idData(1) = numHV;
@@ -387,7 +387,7 @@ int XC::FeapMaterial::recvSelf(const CommParameters &cp)
 {
   int res = 0;
   
-  static ID idData(4);
+  static thread_local ID idData(4);
   
   res += cp.receiveIdData(this->getDbTag());
   if(res < 0) {
@@ -97,8 +97,8 @@ class Response;
 class NDMaterial: public Material
   {
   private:
-    static Matrix errMatrix;
-    static Vector errVector;
+    static thread_local Matrix errMatrix;
+    static thread_local Vector errVector;
     static Tensor errTensor;
     static stresstensor errstresstensor;
     static straintensor errstraintensor;
@@ -24,9 +24,9 @@
 #include "DruckerPragerPlaneStrain.h"
 
 //static vectors and matrices
-XC::Vector XC::DruckerPragerPlaneStrain::strain(3);
-XC::Vector XC::DruckerPragerPlaneStrain::stress(3);
-XC::Matrix XC::DruckerPragerPlaneStrain::tangent(3,3);
+thread_local XC::Vector XC::DruckerPragerPlaneStrain::strain(3);
+thread_local XC::Vector XC::DruckerPragerPlaneStrain::stress(3);
+thread_local XC::Matrix XC::DruckerPragerPlaneStrain::tangent(3,3);
 
 //null constructor
 XC::DruckerPragerPlaneStrain::DruckerPragerPlaneStrain() : 
@@ -59,8 +59,8 @@
 #include <utility/matrix/Matrix.h>
 #include "material/nD/TipoMaterialND.h"
 
-XC::Vector XC::ElasticIsotropicBeamFiber::sigma(3);
-XC::Matrix XC::ElasticIsotropicBeamFiber::D(3,3);
+thread_local XC::Vector XC::ElasticIsotropicBeamFiber::sigma(3);
+thread_local XC::Matrix XC::ElasticIsotropicBeamFiber::D(3,3);
 
 XC::ElasticIsotropicBeamFiber::ElasticIsotropicBeamFiber(int tag, double E, double nu, double rho) :
   ElasticIsotropicMaterial(tag, ND_TAG_ElasticIsotropicBeamFiber,3, E, nu, rho)
@@ -54,7 +54,7 @@
 #include <utility/matrix/Matrix.h>
 #include "material/nD/TipoMaterialND.h"
 
-XC::Vector XC::ElasticIsotropicPlaneStrain2D::sigma(3);
+thread_local XC::Vector XC::ElasticIsotropicPlaneStrain2D::sigma(3);
 
 //! @brief Constructor.
 //!
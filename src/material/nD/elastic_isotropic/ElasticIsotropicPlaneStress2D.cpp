@@ -55,7 +55,7 @@
 #include <utility/matrix/Matrix.h>
 #include "material/nD/TipoMaterialND.h"
 
-XC::Vector XC::ElasticIsotropicPlaneStress2D::sigma(3);
+thread_local XC::Vector XC::ElasticIsotropicPlaneStress2D::sigma(3);
 
 //! @brief Constructor.
 //! 
@@ -76,7 +76,7 @@ namespace XC {
 class ElasticIsotropicPlaneStress2D: public ElasticIsotropic2D
   {
   private:
-    static Vector sigma; //!< Stress vector ... class-wide for returns
+    static thread_local Vector sigma; //!< Stress vector ... class-wide for returns
   public:
     ElasticIsotropicPlaneStress2D(int tag, double E, double nu, double rho);
     ElasticIsotropicPlaneStress2D(int tag);
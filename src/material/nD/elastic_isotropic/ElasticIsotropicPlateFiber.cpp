@@ -55,8 +55,8 @@
 #include "utility/matrix/Matrix.h"
 #include "material/nD/TipoMaterialND.h"
 
-XC::Vector XC::ElasticIsotropicPlateFiber::sigma(5);
-XC::Matrix XC::ElasticIsotropicPlateFiber::D(5,5);
+thread_local XC::Vector XC::ElasticIsotropicPlateFiber::sigma(5);
+thread_local XC::Matrix XC::ElasticIsotropicPlateFiber::D(5,5);
 
 XC::ElasticIsotropicPlateFiber::ElasticIsotropicPlateFiber(int tag, double E, double nu, double rho)
   : ElasticIsotropicMaterial(tag, ND_TAG_ElasticIsotropicPlateFiber,5, E, nu, rho)
@@ -64,8 +64,8 @@
 
 #include "material/nD/TipoMaterialND.h"
 
-XC::Matrix XC::PressureDependentElastic3D::D(6,6);   // global for XC::ElasticIsotropic3D only
-XC::Vector XC::PressureDependentElastic3D::sigma(6); // global for XC::ElasticIsotropic3D only
+thread_local XC::Matrix XC::PressureDependentElastic3D::D(6,6);   // global for XC::ElasticIsotropic3D only
+thread_local XC::Vector XC::PressureDependentElastic3D::sigma(6); // global for XC::ElasticIsotropic3D only
 
 
 XC::PressureDependentElastic3D::PressureDependentElastic3D(int tag, double E, double nu, double rhop, double expp, double pr, double pop):
@@ -210,7 +210,7 @@ const XC::straintensor &XC::PressureDependentElastic3D::getStrainTensor(void) co
 const XC::straintensor &XC::PressureDependentElastic3D::getPlasticStrainTensor(void) const
   {
     //Return zero XC::straintensor
-    static XC::straintensor t;
+    static thread_local XC::straintensor t;
     return t;
   }
 
@@ -80,9 +80,9 @@
 #include "material/nD/TipoMaterialND.h"
 
 //static vectors and matrices
-XC::Vector XC::J2AxiSymm::strain_vec(4) ;
-XC::Vector XC::J2AxiSymm::stress_vec(4) ;
-XC::Matrix XC::J2AxiSymm::tangent_matrix(4,4) ;
+thread_local XC::Vector XC::J2AxiSymm::strain_vec(4) ;
+thread_local XC::Vector XC::J2AxiSymm::stress_vec(4) ;
+thread_local XC::Matrix XC::J2AxiSymm::tangent_matrix(4,4) ;
 
 
 //null constructor
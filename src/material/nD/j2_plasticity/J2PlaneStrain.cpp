@@ -87,9 +87,9 @@
 #include "material/nD/TipoMaterialND.h"
 
 //static vectors and matrices
-XC::Vector XC::J2PlaneStrain::strain_vec(3) ;
-XC::Vector XC::J2PlaneStrain::stress_vec(3) ;
-XC::Matrix XC::J2PlaneStrain::tangent_matrix(3,3) ;
+thread_local XC::Vector XC::J2PlaneStrain::strain_vec(3) ;
+thread_local XC::Vector XC::J2PlaneStrain::stress_vec(3) ;
+thread_local XC::Matrix XC::J2PlaneStrain::tangent_matrix(3,3) ;
 
 
 //null constructor
@@ -169,7 +169,7 @@ int XC::J2PlaneStrain::setTrialStrain( const XC::Vector &v, const XC::Vector &r
 
 int XC::J2PlaneStrain::setTrialStrainIncr( const XC::Vector &v ) 
 {
-  static XC::Vector newStrain(3);
+  static thread_local XC::Vector newStrain(3);
   newStrain(0) = strain(0,0) + v(0);
   newStrain(1) = strain(1,1) + v(1);
   newStrain(2) = 2.0 * strain(0,1) + v(2);
@@ -83,9 +83,9 @@
 #include <cmath> 
 #include "material/nD/TipoMaterialND.h"
 
-XC::Vector XC::J2PlaneStress::strain_vec(3) ;
-XC::Vector XC::J2PlaneStress::stress_vec(3) ;
-XC::Matrix XC::J2PlaneStress::tangent_matrix(3,3) ;
+thread_local XC::Vector XC::J2PlaneStress::strain_vec(3) ;
+thread_local XC::Vector XC::J2PlaneStress::stress_vec(3) ;
+thread_local XC::Matrix XC::J2PlaneStress::tangent_matrix(3,3) ;
 
 XC::J2PlaneStress:: J2PlaneStress(int tag)
   : XC::J2Plasticity(tag, ND_TAG_J2PlaneStress) 
@@ -207,7 +207,7 @@ int XC::J2PlaneStress::setTrialStrain( const XC::Vector &v, const XC::Vector &r
 
 int XC::J2PlaneStress::setTrialStrainIncr( const XC::Vector &v ) 
 {
-  static XC::Vector newStrain(3);
+  static thread_local XC::Vector newStrain(3);
   newStrain(0) = strain(0,0) + v(0);
   newStrain(1) = strain(1,1) + v(1);
   newStrain(2) = 2.0 * strain(0,1) + v(2);
@@ -89,9 +89,9 @@
 #include "material/nD/TipoMaterialND.h"
 
 //static vectors and matrices
-XC::Vector XC::J2ThreeDimensional::strain_vec(6) ;
-XC::Vector XC::J2ThreeDimensional::stress_vec(6) ;
-XC::Matrix XC::J2ThreeDimensional::tangent_matrix(6,6) ;
+thread_local XC::Vector XC::J2ThreeDimensional::strain_vec(6) ;
+thread_local XC::Vector XC::J2ThreeDimensional::stress_vec(6) ;
+thread_local XC::Matrix XC::J2ThreeDimensional::tangent_matrix(6,6) ;
 
 XC::J2ThreeDimensional::J2ThreeDimensional(int tag)
   : XC::J2Plasticity(tag,ND_TAG_J2ThreeDimensional) 
@@ -178,7 +178,7 @@ int XC::J2ThreeDimensional::setTrialStrain( const XC::Vector &v, const XC::Vecto
 
 int XC::J2ThreeDimensional::setTrialStrainIncr( const XC::Vector &v ) 
 {
-  static XC::Vector newStrain(6);
+  static thread_local XC::Vector newStrain(6);
   newStrain(0) = strain(0,0) + v(0);
   newStrain(1) = strain(1,1) + v(1);
   newStrain(2) = strain(2,2) + v(2);
@@ -70,8 +70,8 @@ class BeamFiberMaterial: public NDAdaptorMaterial
     double Cstrain33;
     double Cgamma23;
 
-    static Vector stress;
-    static Matrix tangent;
+    static thread_local Vector stress;
+    static thread_local Matrix tangent;
 
     int indexMap(int i) const;
   protected:
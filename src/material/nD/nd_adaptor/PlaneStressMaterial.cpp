@@ -63,8 +63,8 @@
 
 
 //static vector and matrices
-XC::Vector  XC::PlaneStressMaterial::stress(3) ;
-XC::Matrix  XC::PlaneStressMaterial::tangent(3,3) ;
+thread_local XC::Vector  XC::PlaneStressMaterial::stress(3) ;
+thread_local XC::Matrix  XC::PlaneStressMaterial::tangent(3,3) ;
 
 
 //! @brief Constructor.
@@ -143,15 +143,15 @@ int XC::PlaneStressMaterial::setTrialStrain( const XC::Vector &strainFromElement
   // return theMaterial->setTrialStrain( threeDstrain ) ;
   double norm ;
 
-  static XC::Vector outOfPlaneStress(3) ;
-  static XC::Vector strainIncrement(3) ;
-  static XC::Vector threeDstress(6) ;
-  static XC::Vector threeDstrain(6) ;
-  static XC::Matrix threeDtangent(6,6) ;
-  static XC::Vector threeDstressCopy(6) ; 
-  static XC::Matrix threeDtangentCopy(6,6) ;
+  static thread_local XC::Vector outOfPlaneStress(3) ;
+  static thread_local XC::Vector strainIncrement(3) ;
+  static thread_local XC::Vector threeDstress(6) ;
+  static thread_local XC::Vector threeDstrain(6) ;
+  static thread_local XC::Matrix threeDtangent(6,6) ;
+  static thread_local XC::Vector threeDstressCopy(6) ; 
+  static thread_local XC::Matrix threeDtangentCopy(6,6) ;
 
-  static XC::Matrix dd22(3,3) ;
+  static thread_local XC::Matrix dd22(3,3) ;
 
   int i, j ;
   int ii, jj ;
@@ -234,7 +234,7 @@ const XC::Vector &XC::PlaneStressMaterial::getStress(void) const
 {
   //three dimensional stress
   const XC::Vector &threeDstress = theMaterial->getStress();
-  static XC::Vector threeDstressCopy(6);
+  static thread_local XC::Vector threeDstressCopy(6);
 
   //partitioned stresses and tangent
   //swap matrix indices to sort out-of-plane components 
@@ -256,13 +256,13 @@ const XC::Vector &XC::PlaneStressMaterial::getStress(void) const
 //send back the tangent 
 const XC::Matrix &XC::PlaneStressMaterial::getTangent(void) const
 {
-  static XC::Matrix dd11(3,3) ;
-  static XC::Matrix dd12(3,3) ;
-  static XC::Matrix dd21(3,3) ;
-  static XC::Matrix dd22(3,3) ;
+  static thread_local XC::Matrix dd11(3,3) ;
+  static thread_local XC::Matrix dd12(3,3) ;
+  static thread_local XC::Matrix dd21(3,3) ;
+  static thread_local XC::Matrix dd22(3,3) ;
 
-  static XC::Matrix dd22invdd21(3,3) ;
-  static XC::Matrix threeDtangentCopy(6,6);
+  static thread_local XC::Matrix dd22invdd21(3,3) ;
+  static thread_local XC::Matrix threeDtangentCopy(6,6);
 
   //three dimensional tangent 
   const XC::Matrix &threeDtangent = theMaterial->getTangent( ) ;
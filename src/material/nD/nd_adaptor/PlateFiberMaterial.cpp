@@ -62,8 +62,8 @@
 #include "material/nD/TipoMaterialND.h"
 
 //static vector and matrices
-XC::Vector  XC::PlateFiberMaterial::stress(5);
-XC::Matrix  XC::PlateFiberMaterial::tangent(5,5);
+thread_local XC::Vector  XC::PlateFiberMaterial::stress(5);
+thread_local XC::Matrix  XC::PlateFiberMaterial::tangent(5,5);
 
 XC::PlateFiberMaterial::PlateFiberMaterial(int tag)
   : XC::NDAdaptorMaterial(ND_TAG_PlateFiberMaterial,tag,5)
@@ -112,15 +112,15 @@ int XC::PlateFiberMaterial::setTrialStrain(const XC::Vector &strainFromElement)
   this->strain(4) = strainFromElement(4); //31
 
   double norm;
-  static XC::Vector outOfPlaneStress(1);
-  static XC::Vector strainIncrement(1);
-  static XC::Vector threeDstress(6);
-  static XC::Vector threeDstrain(6);
-  static XC::Matrix threeDtangent(6,6);
-  static XC::Vector threeDstressCopy(6); 
+  static thread_local XC::Vector outOfPlaneStress(1);
+  static thread_local XC::Vector strainIncrement(1);
+  static thread_local XC::Vector threeDstress(6);
+  static thread_local XC::Vector threeDstrain(6);
+  static thread_local XC::Matrix threeDtangent(6,6);
+  static thread_local XC::Vector threeDstressCopy(6); 
 
-  static XC::Matrix threeDtangentCopy(6,6);
-  static XC::Matrix dd22(1,1);
+  static thread_local XC::Matrix threeDtangentCopy(6,6);
+  static thread_local XC::Matrix dd22(1,1);
 
   int i, j;
   int ii, jj;
@@ -199,7 +199,7 @@ int XC::PlateFiberMaterial::setTrialStrain(const XC::Vector &strainFromElement)
 const XC::Vector &XC::PlateFiberMaterial::getStress(void) const
 {
   const XC::Vector &threeDstress = theMaterial->getStress();
-  static XC::Vector threeDstressCopy(6);
+  static thread_local XC::Vector threeDstressCopy(6);
 
   //swap matrix indices to sort out-of-plane components 
   int i, ii;
@@ -220,13 +220,13 @@ const XC::Vector &XC::PlateFiberMaterial::getStress(void) const
 //send back the tangent 
 const XC::Matrix  &XC::PlateFiberMaterial::getTangent(void) const
 {
-  static XC::Matrix dd11(5,5);
-  static XC::Matrix dd12(5,1);
-  static XC::Matrix dd21(1,5);
-  static XC::Matrix dd22(1,1);
-  static XC::Matrix dd22invdd21(1,5);
+  static thread_local XC::Matrix dd11(5,5);
+  static thread_local XC::Matrix dd12(5,1);
+  static thread_local XC::Matrix dd21(1,5);
+  static thread_local XC::Matrix dd22(1,1);
+  static thread_local XC::Matrix dd22invdd21(1,5);
 
-  static XC::Matrix threeDtangentCopy(6,6);
+  static thread_local XC::Matrix threeDtangentCopy(6,6);
   const XC::Matrix &threeDtangent = theMaterial->getTangent();
 
   //swap matrix indices to sort out-of-plane components 
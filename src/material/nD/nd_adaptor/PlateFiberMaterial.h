@@ -66,8 +66,8 @@ namespace XC{
 class PlateFiberMaterial: public NDAdaptorMaterial
   {
   private :
-    static Vector stress;
-    static Matrix tangent;
+    static thread_local Vector stress;
+    static thread_local Matrix tangent;
 
     int indexMap(int i) const;
   public : 
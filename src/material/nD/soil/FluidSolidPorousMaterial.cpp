@@ -53,10 +53,10 @@ double* XC::FluidSolidPorousMaterial::combinedBulkModulusx = 0;
 int XC::FluidSolidPorousMaterial::matCount = 0;
 double XC::FluidSolidPorousMaterial::pAtm = 101;
 
-XC::Vector XC::FluidSolidPorousMaterial::workV3(3);
-XC::Vector XC::FluidSolidPorousMaterial::workV6(6);
-XC::Matrix XC::FluidSolidPorousMaterial::workM3(3,3);
-XC::Matrix XC::FluidSolidPorousMaterial::workM6(6,6);
+thread_local XC::Vector XC::FluidSolidPorousMaterial::workV3(3);
+thread_local XC::Vector XC::FluidSolidPorousMaterial::workV6(6);
+thread_local XC::Matrix XC::FluidSolidPorousMaterial::workM3(3,3);
+thread_local XC::Matrix XC::FluidSolidPorousMaterial::workM6(6,6);
 
 void XC::FluidSolidPorousMaterial::free_mem(void)
   {
@@ -321,7 +321,7 @@ const XC::Vector & XC::FluidSolidPorousMaterial::getCommittedStrain(void)
 const XC::Vector & XC::FluidSolidPorousMaterial::getCommittedPressure(void)
   {
     //int ndm = ndmx[matN];
-    static XC::Vector temp(2);
+    static thread_local XC::Vector temp(2);
     temp[0] = currentExcessPressure;
     temp[1] = temp[0]/initMaxPress;
     return temp;
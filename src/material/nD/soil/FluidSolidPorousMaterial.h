@@ -68,10 +68,10 @@ class FluidSolidPorousMaterial: public NDMaterial
     mutable double initMaxPress;
     mutable int e2p;
 
-    static Vector workV3;
-    static Vector workV6;
-    static Matrix workM3;
-    static Matrix workM6;
+    static thread_local Vector workV3;
+    static thread_local Vector workV6;
+    static thread_local Matrix workM3;
+    static thread_local Matrix workM6;
 
     void free_mem(void);
     void alloc(const NDMaterial *);
@@ -234,7 +234,7 @@ const XC::Matrix & XC::PressureDependMultiYield::getTangent(void) const
   if(ndm==3) 
     return theTangent;
   else {
-    static XC::Matrix workM(3,3);
+    static thread_local XC::Matrix workM(3,3);
     workM(0,0) = theTangent(0,0);
     workM(0,1) = theTangent(0,1);
     workM(0,2) = 0.;
@@ -338,7 +338,7 @@ const XC::Vector & XC::PressureDependMultiYield::getStress(void) const
   if(ndm==3)
     return trialStress.t2Vector();
   else {
-                static XC::Vector workV(3);
+                static thread_local XC::Vector workV(3);
     workV[0] = trialStress.t2Vector()[0];
     workV[1] = trialStress.t2Vector()[1];
     workV[2] = trialStress.t2Vector()[3];
@@ -875,9 +875,9 @@ int XC::PressureDependMultiYield::stressCorrection(int crossedSurface) const
     double refShearModulus = refShearModulusx[matN];
         double refBulkModulus = refBulkModulusx[matN];
 
-  static XC::T2Vector contactStress;
+  static thread_local XC::T2Vector contactStress;
   getContactStress(contactStress);
-  static XC::T2Vector surfNormal;
+  static thread_local XC::T2Vector surfNormal;
   getSurfaceNormal(contactStress, surfNormal);
   double plasticPotential = getPlasticPotential(contactStress,surfNormal);
   if(plasticPotential==LOCK_VALUE && (onPPZ == -1 || onPPZ == 1)) {
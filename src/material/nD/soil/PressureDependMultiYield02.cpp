@@ -260,7 +260,7 @@ const XC::Matrix &XC::PressureDependMultiYield02::getTangent(void) const
   if(ndm==3)
     return theTangent;
   else {
-    static XC::Matrix workM(3,3);
+    static thread_local XC::Matrix workM(3,3);
     workM(0,0) = theTangent(0,0);
     workM(0,1) = theTangent(0,1);
     workM(0,2) = 0.;
@@ -378,7 +378,7 @@ const XC::Vector & XC::PressureDependMultiYield02::getStress(void) const
   if(ndm==3)
     return trialStress.t2Vector();
   else {
-        static XC::Vector workV(3);
+        static thread_local XC::Vector workV(3);
     workV[0] = trialStress.t2Vector()[0];
     workV[1] = trialStress.t2Vector()[1];
     workV[2] = trialStress.t2Vector()[3];
@@ -475,7 +475,7 @@ const XC::Vector & XC::PressureDependMultiYield02::getCommittedStress(void)
         double scale = currentStress.deviatorRatio(residualPress)/committedSurfaces[numOfSurfaces].size();
         if(loadStagex[matN] != 1) scale = 0.;
   if(ndm==3) {
-                static XC::Vector temp7(7);
+                static thread_local XC::Vector temp7(7);
                 workV6 = currentStress.t2Vector();
     temp7[0] = workV6[0];
     temp7[1] = workV6[1];
@@ -497,7 +497,7 @@ const XC::Vector & XC::PressureDependMultiYield02::getCommittedStress(void)
         }
 
   else {
-    static XC::Vector temp5(5);
+    static thread_local XC::Vector temp5(5);
         workV6 = currentStress.t2Vector();
     temp5[0] = workV6[0];
     temp5[1] = workV6[1];
@@ -1001,9 +1001,9 @@ int XC::PressureDependMultiYield02::stressCorrection(int crossedSurface) const
     double refShearModulus = refShearModulusx[matN];
     double refBulkModulus = refBulkModulusx[matN];
 
-    static XC::T2Vector contactStress;
+    static thread_local XC::T2Vector contactStress;
     getContactStress(contactStress);
-    static XC::T2Vector surfNormal;
+    static thread_local XC::T2Vector surfNormal;
     getSurfaceNormal(contactStress, surfNormal);
     double plasticPotential = getPlasticPotential(contactStress,surfNormal);
     double tVolume = trialStress.volume();
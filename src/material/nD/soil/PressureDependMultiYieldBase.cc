@@ -55,9 +55,9 @@ double* XC::PressureDependMultiYieldBase::Hvx=0;
 double* XC::PressureDependMultiYieldBase::Pvx=0;
 
 double XC::PressureDependMultiYieldBase::pAtm = 101.;
-XC::T2Vector XC::PressureDependMultiYieldBase::trialStrain;
-XC::Vector XC::PressureDependMultiYieldBase::workV6(6);
-XC::T2Vector XC::PressureDependMultiYieldBase::workT2V;
+thread_local XC::T2Vector XC::PressureDependMultiYieldBase::trialStrain;
+thread_local XC::Vector XC::PressureDependMultiYieldBase::workV6(6);
+thread_local XC::T2Vector XC::PressureDependMultiYieldBase::workT2V;
 
 const double pi= 3.14159265358979;
 
@@ -361,7 +361,7 @@ const XC::Matrix & XC::PressureDependMultiYieldBase::getInitialTangent(void)
   if(ndm==3) 
     return theTangent;
   else {
-    static XC::Matrix workM(3,3);
+    static thread_local XC::Matrix workM(3,3);
     workM(0,0) = theTangent(0,0);
     workM(0,1) = theTangent(0,1);
     workM(0,2) = 0.;
@@ -532,7 +532,7 @@ XC::Response *XC::PressureDependMultiYieldBase::setResponse(const std::vector<st
       {
         const int argc= argv.size();
         const int numOfSurfaces = numOfSurfacesx[matN];
-        static XC::Matrix curv(numOfSurfaces+1,(argc-1)*2);
+        static thread_local XC::Matrix curv(numOfSurfaces+1,(argc-1)*2);
         for(int i=1; i<argc; i++)
           curv(0,(i-1)*2) = atoi(argv[i]);
         return new MaterialResponse(this, 4, curv);
@@ -627,7 +627,7 @@ const XC::Vector & XC::PressureDependMultiYieldBase::getCommittedStress(void)
         double scale = currentStress.deviatorRatio(residualPress)/committedSurfaces[numOfSurfaces].size();
         if(loadStagex[matN] != 1) scale = 0.;
   if(ndm==3) {
-                static XC::Vector temp7(7);
+                static thread_local XC::Vector temp7(7);
                 workV6 = currentStress.t2Vector();
     temp7[0] = workV6[0];
     temp7[1] = workV6[1];
@@ -640,7 +640,7 @@ const XC::Vector & XC::PressureDependMultiYieldBase::getCommittedStress(void)
         }
 
   else {
-    static XC::Vector temp5(5);  
+    static thread_local XC::Vector temp5(5);  
                 workV6 = currentStress.t2Vector();
     temp5[0] = workV6[0];
     temp5[1] = workV6[1];
@@ -667,7 +667,7 @@ const XC::Vector & XC::PressureDependMultiYieldBase::getCommittedStrain(void)
   if(ndm==3)
     return currentStrain.t2Vector(1);
   else {
-                static XC::Vector workV(3);
+                static thread_local XC::Vector workV(3);
                 workV6 = currentStrain.t2Vector(1);
     workV[0] = workV6[0];
     workV[1] = workV6[1];
@@ -703,7 +703,7 @@ void XC::PressureDependMultiYieldBase::deviatorScaling(T2Vector & stress,
   if( surfaceNum < numOfSurfaces && diff < 0. ) {
     double sz = -surfaces[surfaceNum].size()*coneHeight;
     double deviaSz = sqrt(sz*sz + diff);
-    static XC::Vector devia(6);
+    static thread_local XC::Vector devia(6);
     devia = stress.deviator(); 
     workV6 = devia;
     workV6.addVector(1.0, surfaces[surfaceNum].center(), -coneHeight);
@@ -733,7 +733,7 @@ void XC::PressureDependMultiYieldBase::initSurfaceUpdate(void) const
   if(committedActiveSurf == 0) return; 
   
   double coneHeight = - (currentStress.volume() - residualPress);
-  static XC::Vector devia(6); 
+  static thread_local XC::Vector devia(6); 
   devia = currentStress.deviator();
   double Ms = sqrt(3./2.*(devia && devia));
 
@@ -843,7 +843,7 @@ void XC::PressureDependMultiYieldBase::getContactStress(T2Vector &contactStress)
     double residualPress = residualPressx[matN];
 
   double conHeig = trialStress.volume() - residualPress;
-  static XC::Vector center(6);
+  static thread_local XC::Vector center(6);
   center = theSurfaces[activeSurfaceNum].center(); 
   //workV6 = trialStress.deviator() - center*conHeig;
   workV6 = trialStress.deviator();
@@ -879,7 +879,7 @@ void XC::PressureDependMultiYieldBase::getSurfaceNormal(const XC::T2Vector & str
 
   double conHeig = stress.volume() - residualPress;
   workV6 = stress.deviator();
-  static XC::Vector center(6);
+  static thread_local XC::Vector center(6);
   center = theSurfaces[activeSurfaceNum].center(); 
   double sz = theSurfaces[activeSurfaceNum].size();
   double volume = conHeig*((center && center) - 2./3.*sz*sz) - (workV6 && center);
@@ -945,10 +945,10 @@ void XC::PressureDependMultiYieldBase::updateActiveSurface(void) const
   if(activeSurfaceNum == numOfSurfaces) return;
 
   double A, B, C, X;
-  static XC::Vector t1(6);
-  static XC::Vector t2(6);
-  static XC::Vector center(6);
-  static XC::Vector outcenter(6);
+  static thread_local XC::Vector t1(6);
+  static thread_local XC::Vector t2(6);
+  static thread_local XC::Vector center(6);
+  static thread_local XC::Vector outcenter(6);
   double conHeig = trialStress.volume() - residualPress;
   center = theSurfaces[activeSurfaceNum].center();
   double size = theSurfaces[activeSurfaceNum].size();
@@ -1020,8 +1020,8 @@ void XC::PressureDependMultiYieldBase::updateInnerSurface(void) const
     double residualPress = residualPressx[matN];
 
         if(activeSurfaceNum <= 1) return;
-        static XC::Vector devia(6);
-        static XC::Vector center(6);
+        static thread_local XC::Vector devia(6);
+        static thread_local XC::Vector center(6);
 
         double conHeig = currentStress.volume() - residualPress;
         devia = currentStress.deviator();
@@ -77,7 +77,7 @@ class PressureDependMultiYieldBase: public PressureMultiYieldBase
      mutable double cumuTranslateStrainOcta;
      mutable double prePPZStrainOcta;
      mutable double oppoPrePPZStrainOcta;
-     static T2Vector trialStrain;
+     static thread_local T2Vector trialStrain;
      mutable T2Vector PPZPivot;
      mutable T2Vector PPZCenter;
 
@@ -89,8 +89,8 @@ class PressureDependMultiYieldBase: public PressureMultiYieldBase
      T2Vector PPZPivotCommitted;
      T2Vector PPZCenterCommitted;
 
-     static Vector workV6;
-     static T2Vector workT2V;
+     static thread_local Vector workV6;
+     static thread_local T2Vector workT2V;
      double maxPress;
      
      void elast2Plast(void) const;
@@ -131,7 +131,7 @@ int XC::PressureIndependMultiYield::setTrialStrain(const Vector &strain)
 {
   int ndm = ndmx[matN];
 
-  static XC::Vector temp(6);
+  static thread_local XC::Vector temp(6);
   if(ndm==3 && strain.Size()==6) 
     temp = strain;
   else if(ndm==2 && strain.Size()==3) {
@@ -166,7 +166,7 @@ int XC::PressureIndependMultiYield::setTrialStrainIncr(const XC::Vector &strain)
 {
   int ndm = ndmx[matN];
 
-  static XC::Vector temp(6);
+  static thread_local XC::Vector temp(6);
   if(ndm==3 && strain.Size()==6) 
     temp = strain;
   else if(ndm==2 && strain.Size()==3) {
@@ -210,7 +210,7 @@ const XC::Matrix &XC::PressureIndependMultiYield::getTangent(void) const
   }
   else {
     double coeff;
-    static XC::Vector devia(6);
+    static thread_local XC::Vector devia(6);
     
     /*if(committedActiveSurf > 0) {
       //devia = currentStress.deviator()-committedSurfaces[committedActiveSurf].center();
@@ -245,7 +245,7 @@ const XC::Matrix &XC::PressureIndependMultiYield::getTangent(void) const
   if(ndm==3) 
     return theTangent;
   else {
-    static XC::Matrix workM(3,3);
+    static thread_local XC::Matrix workM(3,3);
     workM(0,0) = theTangent(0,0);
     workM(0,1) = theTangent(0,1);
     workM(0,2) = theTangent(0,3);
@@ -275,7 +275,7 @@ const XC::Matrix & XC::PressureIndependMultiYield::getInitialTangent(void) const
   if(ndm==3) 
     return theTangent;
   else {
-    static XC::Matrix workM(3,3);
+    static thread_local XC::Matrix workM(3,3);
     workM(0,0) = theTangent(0,0);
     workM(0,1) = theTangent(0,1);
     workM(0,2) = theTangent(0,3);
@@ -302,7 +302,7 @@ const XC::Vector & XC::PressureIndependMultiYield::getStress(void) const
   if(loadStage!=1) {  //linear elastic
     //trialStrain.setData(currentStrain.t2Vector() + strainRate.t2Vector());
     getTangent();
-    static XC::Vector a(6);
+    static thread_local XC::Vector a(6);
     a = currentStress.t2Vector();
         a.addMatrixVector(1.0, theTangent, strainRate.t2Vector(1), 1.0);
     trialStress.setData(a);
@@ -339,7 +339,7 @@ const XC::Vector & XC::PressureIndependMultiYield::getStress(void) const
   if(ndm==3)
     return trialStress.t2Vector();
   else {
-    static XC::Vector workV(3);
+    static thread_local XC::Vector workV(3);
     workV[0] = trialStress.t2Vector()[0];
     workV[1] = trialStress.t2Vector()[1];
     workV[2] = trialStress.t2Vector()[3];
@@ -360,7 +360,7 @@ int XC::PressureIndependMultiYield::commitState(void)
   currentStress = trialStress;
   
   //currentStrain = XC::T2Vector(currentStrain.t2Vector() + strainRate.t2Vector());
-  static XC::Vector temp(6);
+  static thread_local XC::Vector temp(6);
   temp = currentStrain.t2Vector();
   temp += strainRate.t2Vector();
   currentStrain.setData(temp);
@@ -480,7 +480,7 @@ XC::Response *XC::PressureIndependMultiYield::setResponse(const std::vector<std:
       {
         const int argc= argv.size();
         int numOfSurfaces = numOfSurfacesx[matN];
-        static Matrix curv(numOfSurfaces+1,(argc-1)*2);
+        static thread_local Matrix curv(numOfSurfaces+1,(argc-1)*2);
         for(int i=1; i<argc; i++)
           curv(0,(i-1)*2) = atoi(argv[i]);
         return new MaterialResponse(this, 4, curv);
@@ -569,7 +569,7 @@ const XC::Vector & XC::PressureIndependMultiYield::getCommittedStress(void) cons
         double scale = sqrt(3./2.)*currentStress.deviatorLength()/committedSurfaces[numOfSurfaces].size();
         if(loadStagex[matN] != 1) scale = 0.;
         if(ndm==3) {
-                static XC::Vector temp7(7), temp6(6);
+                static thread_local XC::Vector temp7(7), temp6(6);
                 temp6 = currentStress.t2Vector();
     temp7[0] = temp6[0];
     temp7[1] = temp6[1];
@@ -581,7 +581,7 @@ const XC::Vector & XC::PressureIndependMultiYield::getCommittedStress(void) cons
         return temp7;
         }
   else {
-    static XC::Vector temp5(5), temp6(6);
+    static thread_local XC::Vector temp5(5), temp6(6);
                 temp6 = currentStress.t2Vector();
     temp5[0] = temp6[0];
     temp5[1] = temp6[1];
@@ -600,7 +600,7 @@ const XC::Vector & XC::PressureIndependMultiYield::getCommittedStrain(void) cons
   if(ndm==3)
     return currentStrain.t2Vector(1);
   else {
-    static XC::Vector workV(3), temp6(6);
+    static thread_local XC::Vector workV(3), temp6(6);
                 temp6 = currentStrain.t2Vector(1);
     workV[0] = temp6[0];
     workV[1] = temp6[1];
@@ -665,7 +665,7 @@ void XC::PressureIndependMultiYield::setUpSurfaces(double * gredu)
         if(plast_modul > UP_LIMIT) plast_modul = UP_LIMIT;
         if(ii==numOfSurfaces) plast_modul = 0;
 
-                    static XC::Vector temp(6);
+                    static thread_local XC::Vector temp(6);
         committedSurfaces[ii] = MultiYieldSurface(temp,size,plast_modul);
                 }  // ii
         } 
@@ -724,7 +724,7 @@ void XC::PressureIndependMultiYield::setUpSurfaces(double * gredu)
       }
       if(plast_modul > UP_LIMIT) plast_modul = UP_LIMIT;
 
-                  static XC::Vector temp(6);
+                  static thread_local XC::Vector temp(6);
       committedSurfaces[i] = MultiYieldSurface(temp,size,plast_modul);
 
                         if(i==(numOfSurfaces-1)) {
@@ -743,7 +743,7 @@ void XC::PressureIndependMultiYield::setUpSurfaces(double * gredu)
 
 double XC::PressureIndependMultiYield::yieldFunc(const XC::T2Vector & stress, const std::vector<MultiYieldSurface> &surfaces, int surfaceNum) const
   {
-    static Vector temp(6);
+    static thread_local Vector temp(6);
     //temp = stress.deviator() - surfaces[surfaceNum].center();
     temp = stress.deviator();
     temp -= surfaces[surfaceNum].center();
@@ -763,9 +763,9 @@ void XC::PressureIndependMultiYield::deviatorScaling(T2Vector &stress,const std:
         if( surfaceNum < numOfSurfaces && diff < 0. ) {
                 double sz = surfaces[surfaceNum].size();
                 double deviaSz = sqrt(sz*sz + diff);
-                static XC::Vector devia(6);
+                static thread_local XC::Vector devia(6);
                 devia = stress.deviator(); 
-                static XC::Vector temp(6);
+                static thread_local XC::Vector temp(6);
                 temp = devia - surfaces[surfaceNum].center();
                 double coeff = (sz-deviaSz) / deviaSz;
                 if(coeff < 1.e-13) coeff = 1.e-13;
@@ -776,7 +776,7 @@ void XC::PressureIndependMultiYield::deviatorScaling(T2Vector &stress,const std:
 
         if(surfaceNum==numOfSurfaces && fabs(diff) > LOW_LIMIT) {
                 double sz = surfaces[surfaceNum].size();
-                static XC::Vector newDevia(6);
+                static thread_local XC::Vector newDevia(6);
                 newDevia.addVector(0.0, stress.deviator(), sz/sqrt(diff+sz*sz));
                 stress.setData(newDevia, stress.volume());
         }
@@ -789,10 +789,10 @@ void XC::PressureIndependMultiYield::initSurfaceUpdate(void) const
 
         int numOfSurfaces = numOfSurfacesx[matN];
 
-        static XC::Vector devia(6);
+        static thread_local XC::Vector devia(6);
         devia = currentStress.deviator();
         double Ms = sqrt(3./2.*(devia && devia));
-        static XC::Vector newCenter(6);
+        static thread_local XC::Vector newCenter(6);
 
         if(committedActiveSurf < numOfSurfaces) { // failure surface can't move
                 //newCenter = devia * (1. - committedSurfaces[activeSurfaceNum].size() / Ms); 
@@ -825,7 +825,7 @@ void XC::PressureIndependMultiYield::paramScaling(void) const
            refBulkModulus *= scale;
 
         double plastModul, size;
-        static XC::Vector temp(6);
+        static thread_local XC::Vector temp(6);
         for(int i=1; i<=numOfSurfaces; i++) {
           plastModul = committedSurfaces[i].modulus() * scale;
           size = committedSurfaces[i].size() * conHeig;
@@ -837,7 +837,7 @@ void XC::PressureIndependMultiYield::paramScaling(void) const
 
 void XC::PressureIndependMultiYield::setTrialStress(const T2Vector &stress) const
 {
-  static XC::Vector devia(6);
+  static thread_local XC::Vector devia(6);
   //devia = stress.deviator() + subStrainRate.deviator()*2.*refShearModulus;
   devia = stress.deviator();
   devia.addVector(1.0, subStrainRate.deviator(), 2.*refShearModulus);
@@ -863,11 +863,11 @@ int XC::PressureIndependMultiYield::setSubStrainRate(void) const
           elast_plast_modulus = 2*refShearModulus*plast_modulus 
             / (2*refShearModulus+plast_modulus);
         }
-        static XC::Vector incre(6);
+        static thread_local XC::Vector incre(6);
         //incre = strainRate.deviator()*elast_plast_modulus;
         incre.addVector(0.0, strainRate.deviator(),elast_plast_modulus);
 
-        static XC::T2Vector increStress;
+        static thread_local XC::T2Vector increStress;
         increStress.setData(incre, 0);
         double singleCross = theSurfaces[numOfSurfaces].size() / numOfSurfaces;
         double totalCross = 3.*increStress.octahedralShear() / sqrt(2.);
@@ -884,9 +884,9 @@ int XC::PressureIndependMultiYield::setSubStrainRate(void) const
 
 void XC::PressureIndependMultiYield::getContactStress(T2Vector &contactStress) const
 {
-        static XC::Vector center(6);
+        static thread_local XC::Vector center(6);
         center = theSurfaces[activeSurfaceNum].center(); 
-        static XC::Vector devia(6);
+        static thread_local XC::Vector devia(6);
         //devia = trialStress.deviator() - center;
         devia = trialStress.deviator();
         devia -= center;
@@ -904,12 +904,12 @@ int XC::PressureIndependMultiYield::isLoadReversal(void) const
 {
   if(activeSurfaceNum == 0) return 0;
 
-  static XC::Vector surfaceNormal(6);
+  static thread_local XC::Vector surfaceNormal(6);
   getSurfaceNormal(currentStress, surfaceNormal);
  
   //(((trialStress.deviator() - currentStress.deviator()) && surfaceNormal) < 0) 
   // return 1;
-  static XC::Vector a(6);
+  static thread_local XC::Vector a(6);
   a = trialStress.deviator();
   a-= currentStress.deviator();
   if((a && surfaceNormal) < 0) 
@@ -940,7 +940,7 @@ double XC::PressureIndependMultiYield::getLoadingFunc(const XC::T2Vector & conta
   //for crossing first surface
   double temp = temp1 + temp2;
   //loadingFunc = (surfaceNormal && (trialStress.deviator()-contactStress.deviator()))/temp;
-  static XC::Vector tmp(6);
+  static thread_local XC::Vector tmp(6);
   tmp =trialStress.deviator();
   tmp -= contactStress.deviator();
   loadingFunc = (surfaceNormal && tmp)/temp;
@@ -956,12 +956,12 @@ double XC::PressureIndependMultiYield::getLoadingFunc(const XC::T2Vector & conta
 
 void XC::PressureIndependMultiYield::stressCorrection(int crossedSurface) const
 {
-        static XC::T2Vector contactStress;
+        static thread_local XC::T2Vector contactStress;
         this->getContactStress(contactStress);
-        static XC::Vector surfaceNormal(6);
+        static thread_local XC::Vector surfaceNormal(6);
         this->getSurfaceNormal(contactStress, surfaceNormal);
         double loadingFunc = getLoadingFunc(contactStress, surfaceNormal, crossedSurface);
-        static XC::Vector devia(6);
+        static thread_local XC::Vector devia(6);
 
         //devia = trialStress.deviator() - surfaceNormal * 2 * refShearModulus * loadingFunc;
         devia.addVector(0.0, surfaceNormal, -2*refShearModulus*loadingFunc);
@@ -984,14 +984,14 @@ void XC::PressureIndependMultiYield::updateActiveSurface(void) const
   if(activeSurfaceNum == numOfSurfaces) return;
 
         double A, B, C, X;
-        static XC::T2Vector direction;
-        static XC::Vector t1(6);
-        static XC::Vector t2(6);
-        static XC::Vector temp(6);
-        static XC::Vector center(6);
+        static thread_local XC::T2Vector direction;
+        static thread_local XC::Vector t1(6);
+        static thread_local XC::Vector t2(6);
+        static thread_local XC::Vector temp(6);
+        static thread_local XC::Vector center(6);
         center = theSurfaces[activeSurfaceNum].center();
         double size = theSurfaces[activeSurfaceNum].size();
-        static XC::Vector outcenter(6);
+        static thread_local XC::Vector outcenter(6);
         outcenter= theSurfaces[activeSurfaceNum+1].center();
         double outsize = theSurfaces[activeSurfaceNum+1].size();
 
@@ -1050,12 +1050,12 @@ void XC::PressureIndependMultiYield::updateInnerSurface(void) const
 {
         if(activeSurfaceNum <= 1) return;
 
-        static XC::Vector devia(6);
+        static thread_local XC::Vector devia(6);
         devia = currentStress.deviator();
-        static XC::Vector center(6);
+        static thread_local XC::Vector center(6);
         center = theSurfaces[activeSurfaceNum].center();
         double size = theSurfaces[activeSurfaceNum].size();
-        static XC::Vector newcenter(6);
+        static thread_local XC::Vector newcenter(6);
 
         for(int i=1; i<activeSurfaceNum; i++) {
                 //newcenter = devia - (devia - center) * theSurfaces[i].size() / size;
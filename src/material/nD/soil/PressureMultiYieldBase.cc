@@ -52,8 +52,8 @@ std::vector<int> XC::PressureMultiYieldBase::numOfSurfacesx;
 std::vector<double> XC::PressureMultiYieldBase::residualPressx;
 std::vector<double> XC::PressureMultiYieldBase::stressRatioPTx;
 
-XC::Matrix XC::PressureMultiYieldBase::theTangent(6,6);
-XC::T2Vector XC::PressureMultiYieldBase::subStrainRate;
+thread_local XC::Matrix XC::PressureMultiYieldBase::theTangent(6,6);
+thread_local XC::T2Vector XC::PressureMultiYieldBase::subStrainRate;
 
 const double pi= 3.14159265358979;
 
@@ -58,8 +58,8 @@ class PressureMultiYieldBase: public NDMaterial
      // internal
      static std::vector<double> residualPressx;
      static std::vector<double> stressRatioPTx;
-     static Matrix theTangent;
-     static T2Vector subStrainRate;
+     static thread_local Matrix theTangent;
+     static thread_local T2Vector subStrainRate;
 
      int matN;
      mutable int e2p;
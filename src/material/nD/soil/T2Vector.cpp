@@ -40,7 +40,7 @@
 #include <material/nD/soil/T2Vector.h>
 
 
-XC::Vector XC::T2Vector::engrgStrain(6);
+thread_local XC::Vector XC::T2Vector::engrgStrain(6);
 
 double XC::operator && (const XC::Vector & a, const XC::Vector & b)
 {
@@ -70,7 +70,7 @@ class T2Vector: public MovableObject
     Vector theT2Vector;
     Vector theDeviator;
     double theVolume;
-    static Vector engrgStrain;
+    static thread_local Vector engrgStrain;
   protected:
     int sendData(CommParameters &);
     int recvData(const CommParameters &);
@@ -118,7 +118,7 @@ const double XC::MultiaxialCyclicPlasticity::four3  = 4.0 / 3.0;
 const double XC::MultiaxialCyclicPlasticity::root23 = sqrt( 2.0 / 3.0 );
 const double XC::MultiaxialCyclicPlasticity::infinity  = 1.0e12;
 
-double XC::MultiaxialCyclicPlasticity::initialTangent[3][3][3][3];   //material tangent
+thread_local double XC::MultiaxialCyclicPlasticity::initialTangent[3][3][3][3];   //material tangent
 double XC::MultiaxialCyclicPlasticity::IIdev[3][3][3][3]; //rank 4 deviatoric 
 double XC::MultiaxialCyclicPlasticity::IbunI[3][3][3][3]; //rank 4 I bun I 
 
@@ -518,8 +518,8 @@ void XC::MultiaxialCyclicPlasticity::Print( std::ostream &s, int flag )
 
 void XC::MultiaxialCyclicPlasticity::elastic_integrator(void)
   {
-    static Matrix dev_strain(3,3); //deviatoric strain  
-    static Matrix dev_stress(3,3); //deviatoric stress
+    static thread_local Matrix dev_strain(3,3); //deviatoric strain  
+    static thread_local Matrix dev_stress(3,3); //deviatoric stress
 
     // add
     double pressure= 0.0;  // 1/3 trace(stress) 
@@ -545,9 +545,9 @@ void XC::MultiaxialCyclicPlasticity::elastic_integrator(void)
         pressure  *= bulk_K0;                                                 
       }
 
-    static Matrix IncrStrain(3,3);
-    static Matrix DevStress_n(3,3);
-    static double pressure_n;
+    static thread_local Matrix IncrStrain(3,3);
+    static thread_local Matrix DevStress_n(3,3);
+    static thread_local double pressure_n;
 
     if(IncrFormulationFlag==1)
       {
@@ -864,23 +864,23 @@ void XC::MultiaxialCyclicPlasticity::plastic_integrator()
   int ii,jj;              // for loop iterators
   int i,j,k,l;
 
-  static XC::Matrix de(3,3);   //incremental deviatoric strain  
-  static XC::Matrix  s(3,3);   //deviatoric stress
+  static thread_local XC::Matrix de(3,3);   //incremental deviatoric strain  
+  static thread_local XC::Matrix  s(3,3);   //deviatoric stress
  // add
-  static double p;          // pressure, 1/3 trace(stress) 
-  static double e;          // incr. vol.strain, trace(incremental strains)
+  static thread_local double p;          // pressure, 1/3 trace(stress) 
+  static thread_local double e;          // incr. vol.strain, trace(incremental strains)
 
-  static XC::Matrix IncrStrain(3,3); // Frank let all XC::Matrix be static
-  static XC::Matrix s_n(3,3);        // dev. stress at t_n 
-  static double p_n;             // pressure at t_n
+  static thread_local XC::Matrix IncrStrain(3,3); // Frank let all XC::Matrix be static
+  static thread_local XC::Matrix s_n(3,3);        // dev. stress at t_n 
+  static thread_local double p_n;             // pressure at t_n
   //static XC::Matrix soinit(3,3);   // save s0_n here
   double normchi=0;
-  static XC::Matrix strial(3,3);
-  static XC::Matrix chitri(3,3);
-  static XC::Matrix alpha_n(3,3); // backstress of loading surface at t_n
-  static double  Psi_split; // Psi for strain split step
-  static XC::Matrix temp6(3,3);
-  static double dottemp6;
+  static thread_local XC::Matrix strial(3,3);
+  static thread_local XC::Matrix chitri(3,3);
+  static thread_local XC::Matrix alpha_n(3,3); // backstress of loading surface at t_n
+  static thread_local double  Psi_split; // Psi for strain split step
+  static thread_local XC::Matrix temp6(3,3);
+  static thread_local double dottemp6;
   double norm = 0;
     
   double Hn =0;
@@ -1777,7 +1777,7 @@ LABEL10:
 }  // end of this subroutine
 
 
-XC::Vector XC::MultiaxialCyclicPlasticity::MCPparameter(10);
+thread_local XC::Vector XC::MultiaxialCyclicPlasticity::MCPparameter(10);
 
 
 
@@ -166,7 +166,7 @@ class MultiaxialCyclicPlasticity: public NDMaterial
   Matrix so_n;                   // unload point for t=n
 
   double tangent[3][3][3][3] ;   // material tangent
-  static double initialTangent[3][3][3][3] ;   //material tangent
+  static thread_local double initialTangent[3][3][3][3] ;   //material tangent
   static double IIdev[3][3][3][3] ; //rank 4 deviatoric 
   static double IbunI[3][3][3][3] ; //rank 4 I bun I 
 
@@ -184,7 +184,7 @@ class MultiaxialCyclicPlasticity: public NDMaterial
   static const double root23 ;
   static const double infinity ;
 
-  static Vector MCPparameter; // debug tool
+  static thread_local Vector MCPparameter; // debug tool
 
   
   void initialize(void); //initialize internal variables
@@ -60,9 +60,9 @@
 #include "material/nD/TipoMaterialND.h"
 
 //static vectors and matrices
-XC::Vector XC::MultiaxialCyclicPlasticity3D::strain_vec(6) ;
-XC::Vector XC::MultiaxialCyclicPlasticity3D::stress_vec(6) ;
-XC::Matrix XC::MultiaxialCyclicPlasticity3D::tangent_matrix(6,6) ;
+thread_local XC::Vector XC::MultiaxialCyclicPlasticity3D::strain_vec(6) ;
+thread_local XC::Vector XC::MultiaxialCyclicPlasticity3D::stress_vec(6) ;
+thread_local XC::Matrix XC::MultiaxialCyclicPlasticity3D::tangent_matrix(6,6) ;
 
 
 XC::MultiaxialCyclicPlasticity3D::MultiaxialCyclicPlasticity3D(int tag)
@@ -168,7 +168,7 @@ int XC::MultiaxialCyclicPlasticity3D::setTrialStrain( const XC::Vector &v, const
 
 int XC::MultiaxialCyclicPlasticity3D::setTrialStrainIncr( const XC::Vector &v ) 
 {
-  static XC::Vector newStrain(6);
+  static thread_local XC::Vector newStrain(6);
   newStrain(0) = strain(0,0) + v(0);
   newStrain(1) = strain(1,1) + v(1);
   newStrain(2) = strain(2,2) + v(2);
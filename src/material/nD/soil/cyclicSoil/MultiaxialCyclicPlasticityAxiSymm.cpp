@@ -59,9 +59,9 @@
 
 using namespace XC;
 //static vectors and matrices
-XC::Vector XC::MultiaxialCyclicPlasticityAxiSymm::strain_vec(4) ;
-XC::Vector XC::MultiaxialCyclicPlasticityAxiSymm::stress_vec(4) ;
-XC::Matrix XC::MultiaxialCyclicPlasticityAxiSymm::tangent_matrix(4,4) ;
+thread_local XC::Vector XC::MultiaxialCyclicPlasticityAxiSymm::strain_vec(4) ;
+thread_local XC::Vector XC::MultiaxialCyclicPlasticityAxiSymm::stress_vec(4) ;
+thread_local XC::Matrix XC::MultiaxialCyclicPlasticityAxiSymm::tangent_matrix(4,4) ;
 
 XC::MultiaxialCyclicPlasticityAxiSymm::MultiaxialCyclicPlasticityAxiSymm(int tag)
   : XC::MultiaxialCyclicPlasticity(tag, ND_TAG_MultiaxialCyclicPlasticityAxiSymm) 
@@ -153,7 +153,7 @@ int XC::MultiaxialCyclicPlasticityAxiSymm::setTrialStrain( const XC::Vector &v,
 int XC::MultiaxialCyclicPlasticityAxiSymm::setTrialStrainIncr( const XC::Vector &v ) 
 {
     // implemented Dec. 5, 2003, Gang Wang
-    static XC::Vector newStrain(4);
+    static thread_local XC::Vector newStrain(4);
     newStrain(0) = strain(0,0) + v(0);
     newStrain(1) = strain(1,1) + v(1);
     newStrain(2) = strain(2,2) + v(2);
@@ -170,7 +170,7 @@ int XC::MultiaxialCyclicPlasticityAxiSymm::setTrialStrainIncr( const XC::Vector
     //return this->setTrialStrainIncr(v);
 
    // implemented April. 4, 2004, Gang Wang
-    static XC::Vector newStrain(4);
+    static thread_local XC::Vector newStrain(4);
     newStrain(0) = strain(0,0) + v(0);
     newStrain(1) = strain(1,1) + v(1);
     newStrain(2) = strain(2,2) + v(2);
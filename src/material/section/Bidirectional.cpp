@@ -53,8 +53,8 @@
 #include <utility/matrix/Vector.h>
 #include "material/section/ResponseId.h"
 
-XC::Vector XC::Bidirectional::s(2);
-XC::Matrix XC::Bidirectional::ks(2,2);
+thread_local XC::Vector XC::Bidirectional::s(2);
+thread_local XC::Matrix XC::Bidirectional::ks(2,2);
 
 //! @brief Constructor.
 XC::Bidirectional::Bidirectional(int tag, double e, double sy, double Hi, double Hk)
@@ -118,13 +118,13 @@ int XC::Bidirectional::setTrialSectionDeformation(const XC::Vector &e)
 //! @brief Returns the tangent stiffness matrix.
 const XC::Matrix &XC::Bidirectional::getSectionTangent(void) const
   {
-    static Vector def;
+    static thread_local Vector def;
     def= getSectionDeformation();
     // Compute trial stress using elastic tangent
     s(0) = E*(def[0]-eP_n[0]);
     s(1) = E*(def[1]-eP_n[1]);
 
-    static XC::Vector xsi(2);
+    static thread_local XC::Vector xsi(2);
 
     // Predicted stress minus back stress
     xsi(0) = s(0) - q_n[0];
@@ -200,12 +200,12 @@ const XC::Matrix &XC::Bidirectional::getInitialTangent(void) const
 const XC::Vector &XC::Bidirectional::getStressResultant(void) const
   {
     // Compute trial stress using elastic tangent
-    static Vector def;
+    static thread_local Vector def;
     def= getSectionDeformation();
     s(0) = E*(def[0]-eP_n[0]);
     s(1) = E*(def[1]-eP_n[1]);
 
-    static XC::Vector xsi(2);
+    static thread_local XC::Vector xsi(2);
 
     // Predicted stress minus back stress
     xsi(0) = s(0) - q_n[0];
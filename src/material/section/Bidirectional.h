@@ -87,8 +87,8 @@ class Bidirectional: public SectionForceDeformation
     double alpha_n;
     mutable double alpha_n1;
 	
-    static Vector s;
-    static Matrix ks;
+    static thread_local Vector s;
+    static thread_local Matrix ks;
   protected:
     int sendData(CommParameters &);
     int recvData(const CommParameters &);
@@ -45,7 +45,6 @@ class CrossSectionKR: public EntCmd
     double kData[16]; //!< Stiffness matrix vector.
     Matrix *K; //!< Stiffness matrix.
 
-    static double value,vas1,vas2,vas1as2;//Para guardar resultados parciales.
   protected:
     void free_mem(void);
     void alloc(const size_t &dim);
@@ -62,8 +61,8 @@ class CrossSectionKR: public EntCmd
       }
     static inline void updateK2d(double k[],const double &fiberArea,const double &y,const double &tangent)
       {
-        value= tangent*fiberArea;
-        vas1= y*value;
+        const double value= tangent*fiberArea;
+        const double vas1= y*value;
 
         k[0]+= value; //Axial stiffness
         k[1]+= vas1;
@@ -73,10 +72,10 @@ class CrossSectionKR: public EntCmd
       { updateK2d(kData,fiberArea,y,tangent); }
     static inline void updateK3d(double k[],const double &fiberArea,const double &y,const double &z,const double &tangent)
       {
-        value= tangent * fiberArea;
-        vas1= y*value;
-        vas2= z*value;
-        vas1as2= vas1*z;
+        const double value= tangent * fiberArea;
+        const double vas1= y*value;
+        const double vas2= z*value;
+        const double vas1as2= vas1*z;
 
         k[0]+= value; //Axial stiffness
         k[1]+= vas1;
@@ -91,10 +90,10 @@ class CrossSectionKR: public EntCmd
       { updateK3d(kData,fiberArea,y,z,tangent); }
     static inline void updateKGJ(double k[],const double &fiberArea,const double &y,const double &z,const double &tangent)
       {
-        value= tangent * fiberArea;
-        vas1= y*value;
-        vas2= z*value;
-        vas1as2= vas1*z;
+        const double value= tangent * fiberArea;
+        const double vas1= y*value;
+        const double vas2= z*value;
+        const double vas1as2= vas1*z;
 
         k[0]+= value; //(0,0)->0
         k[1]+= vas1; //(0,1)->4 y (1,0)->1
@@ -69,8 +69,8 @@
 #include <cstring>
 #include "material/section/ResponseId.h"
 
-XC::Vector XC::GenericSection1d::s(1);
-XC::Matrix XC::GenericSection1d::ks(1,1);
+thread_local XC::Vector XC::GenericSection1d::s(1);
+thread_local XC::Matrix XC::GenericSection1d::ks(1,1);
 XC::ResponseId XC::GenericSection1d::c(1);
 
 //! @brief Constructor.
@@ -127,7 +127,7 @@ void XC::GenericSection1d::zeroInitialSectionDeformation(void)
 //! (generalized: axial and bending).
 const XC::Vector &XC::GenericSection1d::getInitialSectionDeformation(void) const
   {
-    static Vector e(1); // static for class-wide returns
+    static thread_local Vector e(1); // static for class-wide returns
     e(0) = theModel->getInitialStrain();
     return e;
   }
@@ -135,7 +135,7 @@ const XC::Vector &XC::GenericSection1d::getInitialSectionDeformation(void) const
 //! @brief Returns material's trial generalized deformation.
 const XC::Vector &XC::GenericSection1d::getSectionDeformation(void) const
   {
-    static Vector e(1); // static for class-wide returns
+    static thread_local Vector e(1); // static for class-wide returns
     e(0) = theModel->getStrain();
     return e;
   }
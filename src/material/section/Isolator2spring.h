@@ -99,10 +99,10 @@ class Isolator2spring : public SectionForceDeformation
 
     mutable Vector x0;
     mutable Matrix ks;
-    static Vector f0;
-    static Matrix df;
-    static Vector s;
-    static Vector s3;
+    static thread_local Vector f0;
+    static thread_local Matrix df;
+    static thread_local Vector s;
+    static thread_local Vector s3;
   protected:
     int sendData(CommParameters &);
     int recvData(const CommParameters &);
@@ -77,7 +77,7 @@ const size_t maxOrder= 10;
 
 // Assumes section order is less than or equal to maxOrder.
 // Can increase if needed!!!
-double XC::SectionAggregator::workArea[2*maxOrder*(maxOrder+1)];
+thread_local double XC::SectionAggregator::workArea[2*maxOrder*(maxOrder+1)];
 //int    XC::SectionAggregator::codeArea[maxOrder]; Not sharing area anymore
 //                                                  LCPT 19/09/2016
 
@@ -108,11 +108,12 @@ void XC::SectionAggregator::alloc_storage_ptrs(void)
     if(order>0)
       {
         theCode= new ResponseId(order);
-        def= new Vector(workArea, order);
-        defzero= new Vector(workArea, order);
-        s= new Vector(&workArea[maxOrder], order);
-        ks= new Matrix(&workArea[2*maxOrder], order, order);
-        fs= new Matrix(&workArea[maxOrder*(maxOrder+2)], order, order);
+        //Not sharing workArea anymore (concurrent state determination).
+        def= new Vector(order);
+        defzero= new Vector(def->getDataPtr(), order);
+        s= new Vector(order);
+        ks= new Matrix(order, order);
+        fs= new Matrix(order, order);
         check_ptrs();
       }
     else
@@ -402,7 +403,7 @@ const XC::Vector &XC::SectionAggregator::getSectionDeformation(void) const
           (*def)(i)= eSec(i);
       }
     theAdditions.getStrain(*def,theSectionOrder);
-    static Vector retval;
+    static thread_local Vector retval;
     retval= (*def)-(*defzero);
     return retval;
   }
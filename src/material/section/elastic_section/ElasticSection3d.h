@@ -80,7 +80,7 @@ class Information;
 class ElasticSection3d: public BaseElasticSection3d
   {
   private:   
-    static Vector s;
+    static thread_local Vector s;
   protected:
 
   public:
@@ -280,7 +280,7 @@ int XC::FiberSection2d::activateParameter(int passedParameterID)
 
 const XC::Vector &XC::FiberSection2d::getSectionDeformationSensitivity(int gradNumber)
   {
-    static XC::Vector dummy(2);
+    static thread_local XC::Vector dummy(2);
     return dummy;
   }
 
@@ -289,7 +289,7 @@ const XC::Vector &XC::FiberSection2d::getStressResultantSensitivity(int gradNumb
 
 const XC::Matrix &XC::FiberSection2d::getSectionTangentSensitivity(int gradNumber)
   {
-    static XC::Matrix something(2,2);
+    static thread_local XC::Matrix something(2,2);
     something.Zero();
     return something;
   }
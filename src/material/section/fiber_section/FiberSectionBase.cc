@@ -200,7 +200,7 @@ int XC::FiberSectionBase::setTrialSectionDeformation(const Vector &deforms)
 //! @brief Returns material's trial generalized strain.
 const XC::Vector &XC::FiberSectionBase::getSectionDeformation(void) const
   {
-    static Vector retval;
+    static thread_local Vector retval;
     retval= eTrial-eInic;
     return retval;
   }
@@ -634,13 +634,16 @@ void XC::FiberSectionBase::getInteractionDiagramPointsForTheta(NMyMzPointCloud &
       }
   }
 
-//! @brief Returns the points that define the interaction diagram
-//! on the plane defined by the \f$\theta\f$ angle being passed as parameter.
-const XC::NMPointCloud &XC::FiberSectionBase::getInteractionDiagramPointsForPlane(const InteractionDiagramData &diag_data, const double &theta)
+//! @brief Appends to the point cloud the points that define the
+//! interaction diagram for each of the \f$\theta\f$ angles
+//! being passed as parameter (in the same order). Returns
+//! a negative value if the fibers of concrete or steel
+//! are not found.
+//!
+//! The section is reverted to its initial state afterwards.
+int XC::FiberSectionBase::getInteractionDiagramPointsForThetas(NMyMzPointCloud &lista_esfuerzos,const InteractionDiagramData &diag_data,const std::vector<double> &thetas)
   {
-    static NMPointCloud retval;
-    retval.clear();
-    retval.setUmbral(diag_data.getUmbral());
+    int retval= 0;
     const FiberDeque &fsC= sel_mat_tag(diag_data.getConcreteSetName(),diag_data.getConcreteTag())->second;
     if(fsC.empty())
       std::cerr << "Fibers for concrete material, identified by tag: "
@@ -652,79 +655,66 @@ const XC::NMPointCloud &XC::FiberSectionBase::getInteractionDiagramPointsForPlan
                 << ", not found." << std::endl;
     if(!fsC.empty() && !fsS.empty())
       {
-        static NMyMzPointCloud tmp;
-        tmp.clear();
-        tmp.setUmbral(diag_data.getUmbral());
-        getInteractionDiagramPointsForTheta(tmp,diag_data,fsC,fsS,theta);
-        getInteractionDiagramPointsForTheta(tmp,diag_data,fsC,fsS,theta+M_PI); //theta+M_PI
-        retval= tmp.getNM(theta);
+        for(std::vector<double>::const_iterator i= thetas.begin();i!=thetas.end();i++)
+          getInteractionDiagramPointsForTheta(lista_esfuerzos,diag_data,fsC,fsS,*i);
         revertToStart();
       }
     else
-      std::cerr << "Can't compute interaction diagram." << std::endl;
+      {
+        std::cerr << "Can't compute interaction diagram." << std::endl;
+        retval= -1;
+      }
     return retval;
   }
 
-//! @brief Returns the points that define the interaction diagram of the section.
-const XC::NMyMzPointCloud &XC::FiberSectionBase::getInteractionDiagramPoints(const InteractionDiagramData &diag_data)
+//! @brief Returns the angles \f$\theta\f$ used to compute
+//! the interaction diagram of the section.
+std::vector<double> XC::FiberSectionBase::getInteractionDiagramThetas(const InteractionDiagramData &diag_data)
   {
-    static NMyMzPointCloud lista_esfuerzos;
-    lista_esfuerzos.clear();
-    lista_esfuerzos.setUmbral(diag_data.getUmbral());
-    const FiberDeque &fsC= sel_mat_tag(diag_data.getConcreteSetName(),diag_data.getConcreteTag())->second;
-    if(fsC.empty())
-      std::cerr << "Fibers for concrete material, identified by tag: "
-		<< diag_data.getConcreteTag()
-                << ", not found." << std::endl;
-    const FiberDeque &fsS= sel_mat_tag(diag_data.getNmbSetArmadura(),diag_data.getTagArmadura())->second;
-    if(fsS.empty())
-      std::cerr << "Fibers for steel material, identified by tag: " << diag_data.getTagArmadura()
-                << ", not found." << std::endl;
-    if(!fsC.empty() && !fsS.empty())
-      {
-        for(double theta= 0.0;theta<2*M_PI;theta+=diag_data.getIncTheta())
-          getInteractionDiagramPointsForTheta(lista_esfuerzos,diag_data,fsC,fsS,theta);
-        revertToStart();
-      }
-    else
-      std::cerr << "Can't compute interaction diagram." << std::endl;
-    return lista_esfuerzos;
+    std::vector<double> retval;
+    for(double theta= 0.0;theta<2*M_PI;theta+=diag_data.getIncTheta())
+      retval.push_back(theta);
+    return retval;
   }
 
-//! @brief Returns the interaction diagram.
-XC::InteractionDiagram XC::FiberSectionBase::GetInteractionDiagram(const InteractionDiagramData &diag_data)
+//! @brief Returns the angles \f$\theta\f$ used to compute
+//! the interaction diagram on the plane defined by the angle
+//! being passed as parameter.
+std::vector<double> XC::FiberSectionBase::getInteractionDiagramThetasForPlane(const double &theta)
   {
-    const NMyMzPointCloud lp= getInteractionDiagramPoints(diag_data);
-    InteractionDiagram retval;
-    if(!lp.empty())
-      {
-        retval= InteractionDiagram(Pos3d(0,0,0),Triang3dMesh(get_convex_hull(lp)));
-        const double error= fabs(retval.FactorCapacidad(lp).Norm2()-lp.size())/lp.size();
-        if(error>0.005)
-	  std::cerr << getClassName() << "::" << __FUNCTION__
-	            << "; error in computation of interaction diagram ("
-                    << error << ") seems too big." << std::endl;
-      }
+    std::vector<double> retval(2);
+    retval[0]= theta;
+    retval[1]= theta+M_PI;
     return retval;
   }
 
-//! @brief Returns the interaction diagram.
-XC::InteractionDiagram2d XC::FiberSectionBase::GetInteractionDiagramForPlane(const InteractionDiagramData &diag_data, const double &theta)
+//! @brief Returns the points that define the interaction diagram
+//! on the plane defined by the \f$\theta\f$ angle being passed as parameter.
+XC::NMPointCloud XC::FiberSectionBase::getInteractionDiagramPointsForPlane(const InteractionDiagramData &diag_data, const double &theta)
   {
-    const NMPointCloud lp= getInteractionDiagramPointsForPlane(diag_data, theta);
-    InteractionDiagram2d retval;
-    if(!lp.empty())
-      {
-        retval= InteractionDiagram2d(get_convex_hull2d(lp));
-        const double error= fabs(retval.FactorCapacidad(lp).Norm2()-lp.size())/lp.size();
-        if(error>0.005)
-	  std::cerr << getClassName() << "::" << __FUNCTION__
-	            << "; error in computation of interaction diagram ("
-                    << error << ") seems too big." << std::endl;
-      }
+    NMPointCloud retval(diag_data.getUmbral());
+    NMyMzPointCloud tmp(diag_data.getUmbral());
+    if(getInteractionDiagramPointsForThetas(tmp,diag_data,getInteractionDiagramThetasForPlane(theta))>=0)
+      retval= tmp.getNM(theta);
     return retval;
   }
 
+//! @brief Returns the points that define the interaction diagram of the section.
+XC::NMyMzPointCloud XC::FiberSectionBase::getInteractionDiagramPoints(const InteractionDiagramData &diag_data)
+  {
+    NMyMzPointCloud lista_esfuerzos(diag_data.getUmbral());
+    getInteractionDiagramPointsForThetas(lista_esfuerzos,diag_data,getInteractionDiagramThetas(diag_data));
+    return lista_esfuerzos;
+  }
+
+//! @brief Returns the interaction diagram.
+XC::InteractionDiagram XC::FiberSectionBase::GetInteractionDiagram(const InteractionDiagramData &diag_data)
+  { return build_interaction_diagram(getInteractionDiagramPoints(diag_data)); }
+
+//! @brief Returns the interaction diagram.
+XC::InteractionDiagram2d XC::FiberSectionBase::GetInteractionDiagramForPlane(const InteractionDiagramData &diag_data, const double &theta)
+  { return build_interaction_diagram_2d(getInteractionDiagramPointsForPlane(diag_data, theta)); }
+
 //! @brief Returns the interaction diagram on plane N-My.
 XC::InteractionDiagram2d XC::FiberSectionBase::GetNMyInteractionDiagram(const InteractionDiagramData &diag_data)
   { return GetInteractionDiagramForPlane(diag_data,M_PI/2.0); }
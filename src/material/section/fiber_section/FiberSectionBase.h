@@ -81,8 +81,8 @@ class FiberSectionBase: public PrismaticBarCrossSection
     Pos3d Esf2Pos3d(void) const;
     Pos3d getNMyMz(const DeformationPlane &);
     void getInteractionDiagramPointsForTheta(NMyMzPointCloud &lista_esfuerzos,const InteractionDiagramData &,const FiberDeque &,const FiberDeque &,const double &);
-    const NMyMzPointCloud &getInteractionDiagramPoints(const InteractionDiagramData &);
-    const NMPointCloud &getInteractionDiagramPointsForPlane(const InteractionDiagramData &, const double &);
+    NMyMzPointCloud getInteractionDiagramPoints(const InteractionDiagramData &);
+    NMPointCloud getInteractionDiagramPointsForPlane(const InteractionDiagramData &, const double &);
   public:
     FiberSectionBase(int classTag,int dim,MaterialHandler *mat_ldr= nullptr); 
     FiberSectionBase(int tag, int classTag,int dim,MaterialHandler *mat_ldr= nullptr);
@@ -96,6 +96,8 @@ class FiberSectionBase: public PrismaticBarCrossSection
       { return fibers.getNumFibers(); }
     inline FiberContainer &getFibers(void)
       { return fibers; }
+    inline const FiberContainer &getFibers(void) const
+      { return fibers; }
     virtual Fiber *addFiber(Fiber &)= 0;
     virtual Fiber *addFiber(int tag,const MaterialHandler &,const std::string &nmbMat,const double &, const Vector &position)= 0;
     Fiber *addFiber(const std::string &nmbMat,const double &area,const Vector &coo);
@@ -161,6 +163,9 @@ class FiberSectionBase: public PrismaticBarCrossSection
       { return fibers.getYCdg(); }
     double getArea(void) const;
 
+    static std::vector<double> getInteractionDiagramThetas(const InteractionDiagramData &);
+    static std::vector<double> getInteractionDiagramThetasForPlane(const double &);
+    int getInteractionDiagramPointsForThetas(NMyMzPointCloud &,const InteractionDiagramData &,const std::vector<double> &);
     InteractionDiagram GetInteractionDiagram(const InteractionDiagramData &);
     InteractionDiagram2d GetInteractionDiagramForPlane(const InteractionDiagramData &,const double &);
     InteractionDiagram2d GetNMyInteractionDiagram(const InteractionDiagramData &);
@@ -67,6 +67,8 @@
 
 #include "xc_utils/src/geom/pos_vec/Pos2d.h"
 
+size_t XC::Fiber::modificationCounter= 0;
+
 //! @brief constructor.
 XC::Fiber::Fiber(int tag, int classTag)
   : TaggedObject(tag), MovableObject(classTag), dead(false) {}
@@ -89,12 +89,19 @@ class Response;
 class Fiber: public TaggedObject, public MovableObject
   {
     bool dead; //!< True if fiber is inactive.
+    static size_t modificationCounter; //!< incremented each time the material, position or area of a fiber changes.
   protected:
+    //! @brief Records a change in the material, position or area of the fiber.
+    static inline void modified(void)
+      { modificationCounter++; }
     int sendData(CommParameters &);
     int recvData(const CommParameters &);
 
   public:
     Fiber(int tag, int classTag);
+    //! @brief Return the number of fiber modifications.
+    static inline size_t getModificationCounter(void)
+      { return modificationCounter; }
 
     virtual int setTrialFiberStrain(const Vector &vs)=0;
     virtual Vector &getFiberStressResultants(void) =0;
@@ -0,0 +1,342 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//FiberArrays.cc
+
+#include "FiberArrays.h"
+#include "material/section/fiber_section/fiber/Fiber.h"
+#include "material/uniaxial/UniaxialMaterial.h"
+#include "material/uniaxial/ElasticMaterial.h"
+#include "material/uniaxial/steel/Steel01.h"
+#include "material/uniaxial/steel/Steel02.h"
+#include "material/uniaxial/concrete/Concrete01.h"
+#include "material/uniaxial/concrete/Concrete02.h"
+#include <typeinfo>
+
+namespace XC {
+
+//! @brief Trial state of the materials of the group, for material
+//! types that implement setTrial (the call is qualified so it
+//! can't be dispatched through the virtual table).
+template <class M>
+int group_set_trial(const std::vector<UniaxialMaterial *> &mats,const std::vector<double> &strain,std::vector<double> &stress,std::vector<double> &tangent)
+  {
+    int retval= 0;
+    const size_t n= mats.size();
+    for(size_t i= 0;i<n;i++)
+      {
+        M *theMat= static_cast<M *>(mats[i]);
+        retval+= theMat->M::setTrial(strain[i],stress[i],tangent[i]);
+      }
+    return retval;
+  }
+
+//! @brief Trial state of the materials of the group, for material
+//! types that only implement setTrialStrain (see UniaxialMaterial::setTrial).
+template <class M>
+int group_set_trial_strain(const std::vector<UniaxialMaterial *> &mats,const std::vector<double> &strain,std::vector<double> &stress,std::vector<double> &tangent)
+  {
+    int retval= 0;
+    const size_t n= mats.size();
+    for(size_t i= 0;i<n;i++)
+      {
+        M *theMat= static_cast<M *>(mats[i]);
+        const int res= theMat->M::setTrialStrain(strain[i]);
+        if(res == 0)
+          {
+            stress[i]= theMat->M::getStress();
+            tangent[i]= theMat->M::getTangent();
+          }
+        else
+          std::cerr << theMat->getClassName() << "::" << __FUNCTION__
+                    << "; material failed in setTrialStrain().\n";
+        retval+= res;
+      }
+    return retval;
+  }
+
+} // end of XC namespace
+
+//! @brief Clears the group data.
+void XC::FiberArrays::Group::clear(void)
+  {
+    materials.clear();
+    y.clear();
+    z.clear();
+    area.clear();
+    strain.clear();
+    stress.clear();
+    tangent.clear();
+  }
+
+//! @brief Appends a fiber to the group.
+void XC::FiberArrays::Group::push_back(UniaxialMaterial *mat,const double &yLoc,const double &zLoc,const double &fiberArea)
+  {
+    materials.push_back(mat);
+    y.push_back(yLoc);
+    z.push_back(zLoc);
+    area.push_back(fiberArea);
+  }
+
+//! @brief Allocates the strain, stress and tangent arrays.
+void XC::FiberArrays::Group::resizeResults(void)
+  {
+    const size_t n= size();
+    strain.resize(n,0.0);
+    stress.resize(n,0.0);
+    tangent.resize(n,0.0);
+  }
+
+//! @brief Computes the fiber strains from the section deformation
+//! (2D: axial strain and curvature about z).
+void XC::FiberArrays::Group::computeStrains(const double &e0,const double &kz)
+  {
+    const size_t n= size();
+    const double *py= y.data();
+    double *pe= strain.data();
+    for(size_t i= 0;i<n;i++)
+      pe[i]= e0 + py[i]*kz;
+  }
+
+//! @brief Computes the fiber strains from the section deformation
+//! (3D: axial strain and curvatures about z and y).
+void XC::FiberArrays::Group::computeStrains(const double &e0,const double &kz,const double &ky)
+  {
+    const size_t n= size();
+    const double *py= y.data();
+    const double *pz= z.data();
+    double *pe= strain.data();
+    for(size_t i= 0;i<n;i++)
+      pe[i]= e0 + py[i]*kz + pz[i]*ky;
+  }
+
+//! @brief Adds the contribution of the group fibers to the
+//! stiffness (k[0],k[1],k[2]) and to the stress resultant (r[0],r[1])
+//! (see CrossSectionKR::updateK2d and CrossSectionKR::updateNMz).
+void XC::FiberArrays::Group::accumulate2d(double k[],double r[]) const
+  {
+    const size_t n= size();
+    const double *py= y.data();
+    const double *pA= area.data();
+    const double *ps= stress.data();
+    const double *pt= tangent.data();
+    double k0= 0.0, k1= 0.0, k2= 0.0;
+    double r0= 0.0, r1= 0.0;
+    for(size_t i= 0;i<n;i++)
+      {
+        const double value= pt[i]*pA[i];
+        const double vas1= py[i]*value;
+        k0+= value;
+        k1+= vas1;
+        k2+= vas1*py[i];
+        const double fs0= ps[i]*pA[i];
+        r0+= fs0;
+        r1+= fs0*py[i];
+      }
+    k[0]+= k0; k[1]+= k1; k[2]+= k2;
+    r[0]+= r0; r[1]+= r1;
+  }
+
+//! @brief Adds the contribution of the group fibers to the
+//! stiffness (upper triangle of the 3x3 matrix) and to the
+//! stress resultant (see CrossSectionKR::updateK3d and
+//! CrossSectionKR::updateNMzMy).
+void XC::FiberArrays::Group::accumulate3d(double k[],double r[]) const
+  {
+    const size_t n= size();
+    const double *py= y.data();
+    const double *pz= z.data();
+    const double *pA= area.data();
+    const double *ps= stress.data();
+    const double *pt= tangent.data();
+    double k0= 0.0, k1= 0.0, k2= 0.0, k4= 0.0, k5= 0.0, k8= 0.0;
+    double r0= 0.0, r1= 0.0, r2= 0.0;
+    for(size_t i= 0;i<n;i++)
+      {
+        const double value= pt[i]*pA[i];
+        const double vas1= py[i]*value;
+        const double vas2= pz[i]*value;
+        k0+= value;
+        k1+= vas1;
+        k2+= vas2;
+        k4+= vas1*py[i];
+        k5+= vas1*pz[i];
+        k8+= vas2*pz[i];
+        const double fs0= ps[i]*pA[i];
+        r0+= fs0;
+        r1+= fs0*py[i];
+        r2+= fs0*pz[i];
+      }
+    k[0]+= k0; k[1]+= k1; k[2]+= k2;
+    k[4]+= k4; k[5]+= k5;
+    k[8]+= k8;
+    r[0]+= r0; r[1]+= r1; r[2]+= r2;
+  }
+
+//! @brief Constructor.
+XC::FiberArrays::FiberArrays(void)
+  : containerRevision(0), fiberRevision(0), numFibers(0), packed(false), nullAreaFibers(false) {}
+
+//! @brief Copy constructor (the packed data refers to the fibers
+//! of the original container so it's not copied).
+XC::FiberArrays::FiberArrays(const FiberArrays &)
+  : containerRevision(0), fiberRevision(0), numFibers(0), packed(false), nullAreaFibers(false) {}
+
+//! @brief Assignment operator (the packed data refers to the fibers
+//! of the original container so it's not copied).
+XC::FiberArrays &XC::FiberArrays::operator=(const FiberArrays &)
+  {
+    clear();
+    return *this;
+  }
+
+//! @brief Returns the type of the material for grouping purposes.
+//! The comparison is made with the exact type (a class derived from
+//! one of the specialized materials can override its behaviour).
+XC::FiberArrays::MaterialType XC::FiberArrays::getMaterialType(const UniaxialMaterial *mat)
+  {
+    MaterialType retval= OTHER;
+    const std::type_info &t= typeid(*mat);
+    if(t==typeid(Steel01))
+      retval= STEEL01;
+    else if(t==typeid(Steel02))
+      retval= STEEL02;
+    else if(t==typeid(Concrete01))
+      retval= CONCRETE01;
+    else if(t==typeid(Concrete02))
+      retval= CONCRETE02;
+    else if(t==typeid(ElasticMaterial))
+      retval= ELASTIC;
+    return retval;
+  }
+
+//! @brief Frees the packed data.
+void XC::FiberArrays::clear(void)
+  {
+    packed= false;
+    numFibers= 0;
+    for(size_t i= 0;i<NUM_MATERIAL_TYPES;i++)
+      groups[i].clear();
+  }
+
+//! @brief Packs the fibers of the container.
+//!
+//! @param fiberPtrs: fibers to pack.
+//! @param revision: revision of the fiber container.
+//! @param nullArea: if true pack also the fibers with zero area.
+void XC::FiberArrays::setup(const std::deque<Fiber *> &fiberPtrs,const size_t &revision,const bool &nullArea)
+  {
+    clear();
+    nullAreaFibers= nullArea;
+    for(std::deque<Fiber *>::const_iterator i= fiberPtrs.begin();i!=fiberPtrs.end();i++)
+      {
+        Fiber *f= *i;
+        const double fiberArea= f->getArea();
+        if(nullAreaFibers || (fiberArea!=0.0))
+          {
+            UniaxialMaterial *theMat= f->getMaterial();
+            groups[getMaterialType(theMat)].push_back(theMat,f->getLocY(),f->getLocZ(),fiberArea);
+          }
+      }
+    for(size_t i= 0;i<NUM_MATERIAL_TYPES;i++)
+      groups[i].resizeResults();
+    containerRevision= revision;
+    fiberRevision= Fiber::getModificationCounter();
+    numFibers= fiberPtrs.size();
+    packed= true;
+  }
+
+//! @brief Returns true if the packed data corresponds to the
+//! fibers of the container, i.e. neither the container nor any
+//! fiber have been modified since the arrays were set up.
+//!
+//! @param fiberPtrs: fiber container.
+//! @param revision: revision of the fiber container.
+//! @param nullArea: if true the fibers with zero area must be packed too.
+bool XC::FiberArrays::isUpToDate(const std::deque<Fiber *> &fiberPtrs,const size_t &revision,const bool &nullArea) const
+  {
+    return (packed && (revision==containerRevision)
+            && (Fiber::getModificationCounter()==fiberRevision)
+            && (fiberPtrs.size()==numFibers) && (nullArea==nullAreaFibers));
+  }
+
+//! @brief Returns the number of packed fibers whose material
+//! is of the type being passed as parameter.
+size_t XC::FiberArrays::getNumFibers(const MaterialType &t) const
+  { return groups[t].size(); }
+
+//! @brief Computes the trial state of the materials of each group
+//! from the strains previously computed.
+int XC::FiberArrays::computeTrialState(void)
+  {
+    int retval= 0;
+    Group &st01= groups[STEEL01];
+    retval+= group_set_trial<Steel01>(st01.materials,st01.strain,st01.stress,st01.tangent);
+    Group &st02= groups[STEEL02];
+    retval+= group_set_trial_strain<Steel02>(st02.materials,st02.strain,st02.stress,st02.tangent);
+    Group &c01= groups[CONCRETE01];
+    retval+= group_set_trial<Concrete01>(c01.materials,c01.strain,c01.stress,c01.tangent);
+    Group &c02= groups[CONCRETE02];
+    retval+= group_set_trial_strain<Concrete02>(c02.materials,c02.strain,c02.stress,c02.tangent);
+    Group &el= groups[ELASTIC];
+    retval+= group_set_trial<ElasticMaterial>(el.materials,el.strain,el.stress,el.tangent);
+    //Per-fiber path (virtual calls).
+    Group &other= groups[OTHER];
+    const size_t n= other.size();
+    for(size_t i= 0;i<n;i++)
+      retval+= other.materials[i]->setTrial(other.strain[i],other.stress[i],other.tangent[i]);
+    return retval;
+  }
+
+//! @brief Sets the trial strains of a 2D section and adds the
+//! fiber contributions to the stiffness and to the stress resultant.
+//!
+//! @param e0: axial strain.
+//! @param kz: curvature about z axis.
+//! @param k: stiffness matrix data (see CrossSectionKR).
+//! @param r: stress resultant data (see CrossSectionKR).
+int XC::FiberArrays::setTrialSectionDeformation(const double &e0,const double &kz,double k[],double r[])
+  {
+    for(size_t i= 0;i<NUM_MATERIAL_TYPES;i++)
+      groups[i].computeStrains(e0,kz);
+    const int retval= computeTrialState();
+    for(size_t i= 0;i<NUM_MATERIAL_TYPES;i++)
+      groups[i].accumulate2d(k,r);
+    return retval;
+  }
+
+//! @brief Sets the trial strains of a 3D section and adds the
+//! fiber contributions to the stiffness and to the stress resultant.
+//!
+//! @param e0: axial strain.
+//! @param kz: curvature about z axis.
+//! @param ky: curvature about y axis.
+//! @param k: stiffness matrix data (see CrossSectionKR).
+//! @param r: stress resultant data (see CrossSectionKR).
+int XC::FiberArrays::setTrialSectionDeformation(const double &e0,const double &kz,const double &ky,double k[],double r[])
+  {
+    for(size_t i= 0;i<NUM_MATERIAL_TYPES;i++)
+      groups[i].computeStrains(e0,kz,ky);
+    const int retval= computeTrialState();
+    for(size_t i= 0;i<NUM_MATERIAL_TYPES;i++)
+      groups[i].accumulate3d(k,r);
+    return retval;
+  }
@@ -0,0 +1,103 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//FiberArrays.h
+
+#ifndef FiberArrays_h
+#define FiberArrays_h
+
+#include <deque>
+#include <vector>
+
+namespace XC {
+class Fiber;
+class UniaxialMaterial;
+
+//! \ingroup MATSCCFibers
+//
+//! @brief Fiber data packed in contiguous arrays (structure of arrays).
+//!
+//! The fibers are grouped by the type of their material so that, for
+//! the most common materials (Steel01, Steel02, Concrete01, Concrete02
+//! and ElasticMaterial), the trial state can be computed with direct
+//! (non virtual) calls. Fiber strains, stresses and tangents are stored
+//! in contiguous arrays so that the computation of the strains and the
+//! accumulation of the section stiffness and stress resultant can be
+//! done in a single sweep over each group. Fibers whose material
+//! is of any other type use the per-fiber (virtual) path.
+//!
+//! The packed data are a cache of the fiber container. It is rebuilt
+//! (see setup) when the revision of the container or the fiber
+//! modification counter (Fiber::getModificationCounter) changes, so
+//! checking it costs a couple of integer comparisons.
+class FiberArrays
+  {
+  public:
+    //! @brief Material types with a specialized trial state computation.
+    enum MaterialType {STEEL01, STEEL02, CONCRETE01, CONCRETE02, ELASTIC, OTHER, NUM_MATERIAL_TYPES};
+  protected:
+    //! @brief Data of the fibers sharing the same material type.
+    struct Group
+      {
+        std::vector<UniaxialMaterial *> materials; //!< fiber materials.
+        std::vector<double> y; //!< fiber y coordinates.
+        std::vector<double> z; //!< fiber z coordinates.
+        std::vector<double> area; //!< fiber areas.
+        std::vector<double> strain; //!< fiber trial strains.
+        std::vector<double> stress; //!< fiber trial stresses.
+        std::vector<double> tangent; //!< fiber trial tangents.
+
+        inline size_t size(void) const
+          { return materials.size(); }
+        void clear(void);
+        void push_back(UniaxialMaterial *,const double &,const double &,const double &);
+        void resizeResults(void);
+        void computeStrains(const double &,const double &);
+        void computeStrains(const double &,const double &,const double &);
+        void accumulate2d(double k[],double r[]) const;
+        void accumulate3d(double k[],double r[]) const;
+      };
+    size_t containerRevision; //!< Revision of the fiber container when packed.
+    size_t fiberRevision; //!< Fiber modification counter when packed.
+    size_t numFibers; //!< Number of fibers in the container when packed.
+    bool packed; //!< True if the arrays have been set up since the last clear.
+    Group groups[NUM_MATERIAL_TYPES]; //!< Fiber data grouped by material type.
+    bool nullAreaFibers; //!< True if the fibers with zero area are packed too.
+
+    static MaterialType getMaterialType(const UniaxialMaterial *);
+    int computeTrialState(void);
+  public:
+    FiberArrays(void);
+    FiberArrays(const FiberArrays &);
+    FiberArrays &operator=(const FiberArrays &);
+
+    void clear(void);
+    void setup(const std::deque<Fiber *> &,const size_t &,const bool &);
+    bool isUpToDate(const std::deque<Fiber *> &,const size_t &,const bool &) const;
+    size_t getNumFibers(const MaterialType &) const;
+
+    int setTrialSectionDeformation(const double &,const double &,double k[],double r[]);
+    int setTrialSectionDeformation(const double &,const double &,const double &,double k[],double r[]);
+  };
+
+} // end of XC namespace
+
+#endif
@@ -68,6 +68,7 @@ void XC::FiberContainer::free_mem(void)
           (*this)[i]= nullptr;
         }
     resize(0);
+    packedFibers.clear();
   }
 
 //! @brief Default constructor.
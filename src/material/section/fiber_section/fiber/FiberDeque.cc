@@ -55,12 +55,12 @@
 
 //! @brief Constructor.
 XC::FiberDeque::FiberDeque(const size_t &num)
-  : EntCmd(), fiber_ptrs_dq(num,static_cast<Fiber *>(nullptr)), yCDG(0.0), zCDG(0.0)
+  : EntCmd(), fiber_ptrs_dq(num,static_cast<Fiber *>(nullptr)), yCDG(0.0), zCDG(0.0), revision(0)
   {}
 
 //! @brief Copy constructor.
 XC::FiberDeque::FiberDeque(const FiberDeque &otro)
-  : EntCmd(otro), fiber_ptrs_dq(otro), yCDG(otro.yCDG), zCDG(otro.zCDG)
+  : EntCmd(otro), fiber_ptrs_dq(otro), yCDG(otro.yCDG), zCDG(otro.zCDG), revision(0)
   {}
 
 //! @brief Assignment operator.
@@ -68,6 +68,8 @@ XC::FiberDeque &XC::FiberDeque::operator=(const FiberDeque &otro)
   {
     EntCmd::operator=(otro);
     fiber_ptrs_dq::operator=(otro);
+    revision++;
+    packedFibers.clear();
     yCDG= otro.yCDG;
     zCDG= otro.zCDG;
     return *this;
@@ -83,7 +85,10 @@ XC::Fiber *XC::FiberDeque::inserta(const Fiber &f)
 
 //! @brief Adds the fiber to the container.
 void XC::FiberDeque::push_back(Fiber *f)
-   { fiber_ptrs_dq::push_back(f); }
+   {
+     fiber_ptrs_dq::push_back(f);
+     revision++;
+   }
 
 
 //! @brief Search for the fiber identified by the parameter.
@@ -317,7 +322,7 @@ const XC::Vector &XC::FiberDeque::getCdgHomogenizedSection(const double &E0) con
         else
           std::cerr << "FiberDeque::getIyHomogenizedSection; pointer to material nulo." << std::endl;
       }
-    static Vector retval(2);
+    static thread_local Vector retval(2);
     retval[0]= -Qz/Atot; //Coordenada y del CDG  XXX ¿Signo menos?
     retval[1]= Qy/Atot; //Coordenada z del CDG 
     return retval;
@@ -424,7 +429,7 @@ double XC::FiberDeque::getIHomogenizedSection(const double &E0,const unsigned sh
 //! @brief Returns the tensor of inertia computed with respect to the object centroid.
 XC::Matrix &XC::FiberDeque::getIHomogenizedSection(const double &E0) const
   {
-    static Matrix i(2,2);
+    static thread_local Matrix i(2,2);
     i(0,0)= getIyHomogenizedSection(E0); i(0,1)= -getPyzHomogenizedSection(E0);
     i(1,0)= i(0,1);   i(1,1)= getIzHomogenizedSection(E0);
     return i;
@@ -433,7 +438,7 @@ XC::Matrix &XC::FiberDeque::getIHomogenizedSection(const double &E0) const
 //! @brief Returns the tensor of inertia respector al punto o.
 XC::Matrix &XC::FiberDeque::getIHomogenizedSection(const double &E0,const Pos2d &o) const
   {
-    static Matrix retval(2,2);
+    static thread_local Matrix retval(2,2);
     const Matrix Ig= getIHomogenizedSection(E0);
     Vector O(2); O[0]= o.x(); O[1]= o.y();
     const Vector og= getCdgHomogenizedSection(E0) - O;
@@ -772,8 +777,8 @@ double XC::FiberDeque::getMzComp(const double &y0) const
 //! que «ref» (por defecto cero) compresiones, si no hay returns (0,0).
 const XC::Vector &XC::FiberDeque::baricentroCompresiones(void) const
   {
-    static Vector retval(2);
-    static double f,r;
+    static thread_local Vector retval(2);
+    double f,r;
     retval[0]= 0.0; retval[1]= 0.0; f= 0.0; r= 0.0;
     register std::deque<Fiber *>::const_iterator i= begin();
     for(;i!= end();i++)
@@ -797,8 +802,8 @@ const XC::Vector &XC::FiberDeque::baricentroCompresiones(void) const
 //! the value passed as parameter.
 const XC::Vector &XC::FiberDeque::baricentroDefMenores(const double &defRef) const
   {
-    static Vector retval(2);
-    static double def,r;
+    static thread_local Vector retval(2);
+    double def,r;
     retval[0]= 0.0; retval[1]= 0.0; def= 0.0; r= 0.0;
     register std::deque<Fiber *>::const_iterator i= begin();
     for(;i!= end();i++)
@@ -872,8 +877,8 @@ double XC::FiberDeque::getMyTracc(const double &z0) const
 //! no hay tracciones returns (0,0).
 const XC::Vector &XC::FiberDeque::baricentroTracciones(void) const
   {
-    static Vector retval(2);
-    static double f,r;
+    static thread_local Vector retval(2);
+    double f,r;
     retval[0]= 0.0; retval[1]= 0.0; f= 0.0; r= 0.0;
     register std::deque<Fiber *>::const_iterator i= begin();
     for(;i!= end();i++)
@@ -897,8 +902,8 @@ const XC::Vector &XC::FiberDeque::baricentroTracciones(void) const
 //! the value being passed as parameter.
 const XC::Vector &XC::FiberDeque::baricentroDefMayores(const double &defRef) const
   {
-    static Vector retval(2);
-    static double def,r;
+    static thread_local Vector retval(2);
+    double def,r;
     retval[0]= 0.0; retval[1]= 0.0; def= 0.0; r= 0.0;
     register std::deque<Fiber *>::const_iterator i= begin();
     for(;i!= end();i++)
@@ -1563,30 +1568,12 @@ int XC::FiberDeque::setInitialSectionDeformation(const FiberSection2d &Section2d
 //! @brief Sets trial strains values.
 int XC::FiberDeque::setTrialSectionDeformation(const FiberSection2d &Section2d,CrossSectionKR &kr2)
   {
-    int retval= 0;
     kr2.zero();
-    UniaxialMaterial *theMat;
-    double y,fiberArea,strain,tangent,stress, fs0; 
-    std::deque<Fiber *>::iterator i= begin();
-    for(;i!= end();i++)
-      {
-        theMat= (*i)->getMaterial();
-        y= (*i)->getLocY();
-        fiberArea= (*i)->getArea();
-        if(fiberArea!=0.0)
-          {
-            // determine material strain and set it
-            strain= Section2d.get_strain(y);
-            retval+= theMat->setTrial(strain, stress, tangent);
-
-            //Updating stiffness matrix.
-            kr2.updateK2d(fiberArea,y,tangent);
-
-            //Updating stress resultant.
-            fs0= stress * fiberArea;
-            kr2.updateNMz(fs0,y);
-          }
-      }
+    // fibers with zero area are ignored.
+    if(!packedFibers.isUpToDate(*this,revision,false))
+      packedFibers.setup(*this,revision,false);
+    const Vector &def= Section2d.getSectionDeformation();
+    const int retval= packedFibers.setTrialSectionDeformation(def(0),def(1),kr2.kData,kr2.rData);
     kr2.kData[2]= kr2.kData[1]; //Simetría.
     return retval;
   }
@@ -1618,10 +1605,10 @@ int XC::FiberDeque::revertToStart(FiberSection2d &Section2d,CrossSectionKR &kr2)
 //! @brief Returns the initial tangent stiffness matrix.
 const XC::Matrix &XC::FiberDeque::getInitialTangent(const FiberSection2d &Section2d) const
   {
-    static double kInitial[4];
+    static thread_local double kInitial[4];
     kInitial[0]= 0.0; kInitial[1]= 0.0;
     kInitial[2]= 0.0; kInitial[3]= 0.0;
-    static Matrix kInitialMatrix(kInitial, 2, 2);
+    static thread_local Matrix kInitialMatrix(kInitial, 2, 2);
 
     std::deque<Fiber *>::const_iterator i= begin();
     UniaxialMaterial *theMat= nullptr;
@@ -1645,7 +1632,7 @@ const XC::Matrix &XC::FiberDeque::getInitialTangent(const FiberSection2d &Sectio
 
 const XC::Vector &XC::FiberDeque::getStressResultantSensitivity(int gradNumber, bool conditional)
   {
-    static XC::Vector ds(2);
+    static thread_local XC::Vector ds(2);
     ds.Zero();
     double y, fiberArea, stressGradient;
     std::deque<Fiber *>::const_iterator i= begin();
@@ -1749,31 +1736,12 @@ int XC::FiberDeque::setInitialSectionDeformation(const FiberSection3d &Section3d
 //! @brief Set the trial strains.
 int XC::FiberDeque::setTrialSectionDeformation(FiberSection3d &Section3d,CrossSectionKR &kr3)
   {
-    int retval= 0;
     kr3.zero();
-    std::deque<Fiber *>::iterator i= begin();
-    UniaxialMaterial *theMat;
-    double y,z,fiberArea,tangent,stress, fs0; 
-    for(;i!= end();i++)
-      {
-        theMat= (*i)->getMaterial();
-        y= (*i)->getLocY();
-        z= (*i)->getLocZ();
-
-        // determine material strain and set it
-        retval+= theMat->setTrial(Section3d.get_strain(y,z), stress, tangent);
-
-        //Updating stiffness matrix.
-        fiberArea= (*i)->getArea();
-        if(fiberArea!=0.0)
-          {
-            kr3.updateK3d(fiberArea,y,z,tangent);
-
-            //Updating stress resultant.
-            fs0= stress * fiberArea;
-            kr3.updateNMzMy(fs0,y,z);
-          }
-      }
+    // the trial strain of the fibers with zero area is set too.
+    if(!packedFibers.isUpToDate(*this,revision,true))
+      packedFibers.setup(*this,revision,true);
+    const Vector &def= Section3d.getSectionDeformation();
+    const int retval= packedFibers.setTrialSectionDeformation(def(0),def(1),def(2),kr3.kData,kr3.rData);
     kr3.kData[3]= kr3.kData[1]; //Stiffness matrix symmetry.
     kr3.kData[6]= kr3.kData[2];
     kr3.kData[7]= kr3.kData[5];
@@ -1808,8 +1776,8 @@ int XC::FiberDeque::revertToStart(FiberSection3d &Section3d,CrossSectionKR &kr3)
 //! @brief Returns the tangent stiffness matrix inicial.
 const XC::Matrix &XC::FiberDeque::getInitialTangent(const FiberSection3d &Section3d) const
   {
-    static double kInitialData[9];
-    static XC::Matrix kInitial(kInitialData, 3, 3);
+    static thread_local double kInitialData[9];
+    static thread_local XC::Matrix kInitial(kInitialData, 3, 3);
 
     kInitialData[0]= 0.0; kInitialData[1]= 0.0; kInitialData[2]= 0.0;
     kInitialData[3]= 0.0; kInitialData[4]= 0.0; kInitialData[5]= 0.0;
@@ -1974,14 +1942,14 @@ int XC::FiberDeque::revertToStart(FiberSectionGJ &SectionGJ,CrossSectionKR &krGJ
 //! @brief Returns the initial tangent stiffness matrix.
 const XC::Matrix &XC::FiberDeque::getInitialTangent(const FiberSectionGJ &SectionGJ) const
   {
-    static double kInitialData[16];
+    static thread_local double kInitialData[16];
 
     kInitialData[0]= 0.0; kInitialData[1]= 0.0; kInitialData[2]= 0.0; kInitialData[3]= 0.0;
     kInitialData[4]= 0.0; kInitialData[5]= 0.0; kInitialData[6]= 0.0; kInitialData[7]= 0.0;
     kInitialData[8]= 0.0; kInitialData[9]= 0.0; kInitialData[10]= 0.0; kInitialData[11]= 0.0;
     kInitialData[12]= 0.0; kInitialData[13]= 0.0; kInitialData[14]= 0.0; kInitialData[15]= 0.0;
 
-    static XC::Matrix kInitial(kInitialData, 4, 4);
+    static thread_local XC::Matrix kInitial(kInitialData, 4, 4);
     UniaxialMaterial *theMat;
     double y,z,fiberArea,tangent; 
     std::deque<Fiber *>::const_iterator i= begin();
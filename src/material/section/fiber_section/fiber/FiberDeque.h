@@ -31,6 +31,7 @@
 
 #include "xc_utils/src/nucleo/EntCmd.h"
 #include "xc_utils/src/geom/GeomObj.h"
+#include "FiberArrays.h"
 #include <deque>
 
 class Ref3d3d;
@@ -75,10 +76,12 @@ class FiberDeque : public EntCmd, public std::deque<Fiber *>
     mutable std::deque<std::list<Poligono2d> > dq_ac_effective; //!< (Where appropriate) effective concrete areas for each fiber.
     mutable std::deque<double> recubs; //! Cover for each fiber.
     mutable std::deque<double> seps; //! Spacing for each fiber.
+    size_t revision; //!< Incremented each time the fiber container changes.
+    FiberArrays packedFibers; //!< Fiber data packed by material type (trial state computation).
 
     Fiber *inserta(const Fiber &f);
     inline void resize(const size_t &nf)
-      { fiber_ptrs_dq::resize(nf,nullptr); }
+      { fiber_ptrs_dq::resize(nf,nullptr); revision++; }
 
 
 
@@ -91,6 +94,14 @@ class FiberDeque : public EntCmd, public std::deque<Fiber *>
     FiberDeque &operator=(const FiberDeque &otro);
 
     void push_back(Fiber *f);
+    inline void clear(void)
+      { fiber_ptrs_dq::clear(); revision++; }
+    inline iterator erase(iterator first,iterator last)
+      { revision++; return fiber_ptrs_dq::erase(first,last); }
+    //! @brief Return the revision of the container (the fibers
+    //! must be inserted or removed through this interface).
+    inline size_t getRevision(void) const
+      { return revision; }
      inline size_t getNumFibers(void) const
       { return size(); }
 
@@ -109,7 +109,10 @@ XC::UniaxialFiber::UniaxialFiber(int tag, int classTag,const MaterialHandler &ld
 //! @brief Copy constructor.
 XC::UniaxialFiber::UniaxialFiber(const UniaxialFiber &otra)
   : Fiber(otra),theMaterial(nullptr), area(otra.area)
-  { setMaterial(otra.theMaterial); }
+  {
+    if(otra.theMaterial)
+      alloc(*otra.theMaterial);
+  }
 
 //! @brief Assignment operator.
 XC::UniaxialFiber &XC::UniaxialFiber::operator=(const UniaxialFiber &otra)
@@ -131,6 +134,7 @@ void XC::UniaxialFiber::setMaterial(const UniaxialMaterial *theMat)
       alloc(*theMat);
     else
       free_mem();
+    modified();
   }
 
 //! @brief Sets the fiber material (identified by name).
@@ -170,5 +174,6 @@ int XC::UniaxialFiber::recvData(const CommParameters &cp)
     int res= Fiber::recvData(cp);
     theMaterial= cp.getBrokedMaterial(theMaterial,getDbTagData(),BrokedPtrCommMetaData(2,3,4));
     res+= cp.receiveDouble(area,getDbTagData(),CommMetaData(5));
+    modified(); //Material, area and (derived classes) position may have changed.
     return res;
   }
@@ -24,9 +24,10 @@
 #include "fiber/python_interface.tcc"
 
 XC::Fiber *(XC::FiberSectionBase::*addFiberAdHoc)(const std::string &,const double &,const XC::Vector &)= &XC::FiberSectionBase::addFiber; 
+XC::FiberContainer &(XC::FiberSectionBase::*getFibersRef)(void)= &XC::FiberSectionBase::getFibers;
 class_<XC::FiberSectionBase, bases<XC::PrismaticBarCrossSection>, boost::noncopyable >("FiberSectionBase", no_init)
   .def("addFiber",make_function(addFiberAdHoc,return_internal_reference<>()),"Adds a fiber to the section.")
-.def("getFibers",make_function(&XC::FiberSectionBase::getFibers,return_internal_reference<>()),"Return a fiber container with the fibers in the section.")
+.def("getFibers",make_function(getFibersRef,return_internal_reference<>()),"Return a fiber container with the fibers in the section.")
 .def("getFiberSets",make_function(&XC::FiberSectionBase::getFiberSets,return_internal_reference<>()),"Return the fiber sets in the fiber section.")
 .def("setInitialSectionDeformation",&XC::FiberSectionBase::setInitialSectionDeformation,"Set generalized initial strains values in the section from the components of the vector passed as parameter")
   .def("setTrialSectionDeformation",&XC::FiberSectionBase::setTrialSectionDeformation,"Set generalized trial strains values in the section from the components of the vector passed as parameter")
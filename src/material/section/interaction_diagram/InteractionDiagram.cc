@@ -28,6 +28,7 @@
 
 #include "InteractionDiagram.h"
 #include "xc_utils/src/geom/d2/Triang3dMesh.h"
+#include "xc_utils/src/geom/d3/ConvexHull3d.h"
 #include "xc_utils/src/geom/d2/Plano3d.h"
 #include "xc_utils/src/geom/d2/Triangulo3d.h"
 #include "xc_basic/src/util/mchne_eps.h"
@@ -37,6 +38,8 @@
 
 #include "material/section/fiber_section/FiberSectionBase.h"
 #include "material/section/interaction_diagram/InteractionDiagramData.h"
+#include "material/section/interaction_diagram/NMyMzPointCloud.h"
+#include "utility/run_blocks.h"
 
 
 
@@ -50,8 +53,11 @@ void XC::InteractionDiagram::clasifica_triedro(const Triedro3d &tdro)
 void XC::InteractionDiagram::clasifica_triedros(void)
   {
     //Clasificamos los triedros por cuadrantes.
+    for(int i= 0;i<8;i++)
+      triedros_cuadrante[i].clear();
     for(XC::InteractionDiagram::const_iterator i= begin();i!=end();i++)
       clasifica_triedro(*i);
+    grid.setup(triedros);
   }
 
 //! @brief Default constructor.
@@ -93,14 +99,18 @@ const Triedro3d *XC::InteractionDiagram::BuscaPtrTriedro(const Pos3d &p) const
                   << std::endl;
         return retval;
       }
-    const int cuadrante= p.Cuadrante();
-    const set_ptr_triedros &set_triedros= triedros_cuadrante[cuadrante-1];
-    for(set_ptr_triedros::const_iterator i= set_triedros.begin();i!=set_triedros.end();i++)
-      if((*i)->In(p,tol))
-        {
-          retval= *i;
-          break;
-        }
+    retval= grid.find(p,tol); //Search the candidates of the grid cell.
+    if(!retval) //Not found, so search in the quadrant.
+      {
+        const int cuadrante= p.Cuadrante();
+        const set_ptr_triedros &set_triedros= triedros_cuadrante[cuadrante-1];
+        for(set_ptr_triedros::const_iterator i= set_triedros.begin();i!=set_triedros.end();i++)
+          if((*i)->In(p,tol))
+            {
+              retval= *i;
+              break;
+            }
+      }
     if(!retval) //Not found, so brute-force search.
       {
         for(XC::InteractionDiagram::const_iterator i= begin();i!=end();i++)
@@ -282,15 +292,88 @@ double XC::InteractionDiagram::FactorCapacidad(const Pos3d &esf_d) const
     return retval;
   }
 
+//! @brief Returns the capacity factor for the internal forces triplet
+//! being passed as parameters.
+//!
+//! The trihedron that contains the triplet is searched in the angular
+//! grid and the capacity factor is obtained from the intersection of
+//! the ray with the plane of its base. If the trihedron is not found
+//! (or the ray doesn't intersect its base) the general algorithm is used.
+double XC::InteractionDiagram::get_capacity_factor(const double &N,const double &My,const double &Mz) const
+  {
+    double retval= 0.0;
+    const double d= sqrt(N*N+My*My+Mz*Mz); //Distance from the internal force triplet to origin.
+    if(d<mchne_eps_dbl) //Point is almost at origin.
+      retval= 0.0;
+    else if(d>rMax*10.0) //Point is far from diagram surface.
+      retval= d/rMax;
+    else
+      {
+        bool found= false;
+        const TrihedronGrid::TrihedronData *t= grid.findData(N,My,Mz);
+        if(t && (t->d!=0.0))
+          {
+            retval= (t->n[0]*N+t->n[1]*My+t->n[2]*Mz)/t->d;
+            found= (retval>0.0);
+          }
+        if(!found)
+          retval= FactorCapacidad(Pos3d(N,My,Mz));
+      }
+    return retval;
+  }
+
 XC::Vector XC::InteractionDiagram::FactorCapacidad(const GeomObj::list_Pos3d &lp) const
   {
-    Vector retval(lp.size());
-    int i= 0;
+    const size_t sz= lp.size();
+    std::vector<double> N(sz), My(sz), Mz(sz);
+    size_t i= 0;
     for(GeomObj::list_Pos3d::const_iterator j= lp.begin();j!=lp.end(); j++, i++)
-      retval[i]= FactorCapacidad(*j);
+      {
+        N[i]= j->x(); My[i]= j->y(); Mz[i]= j->z();
+      }
+    Vector retval(sz);
+    FactorCapacidad(N.data(),My.data(),Mz.data(),retval.getDataPtr(),sz,std::thread::hardware_concurrency());
     return retval;
   }
 
+//! @brief Computes the capacity factors of a batch of internal forces
+//! triplets.
+//! @param N: axial forces.
+//! @param My: bending moments about the y axis.
+//! @param Mz: bending moments about the z axis.
+//! @param factors: capacity factors (output).
+//! @param sz: number of triplets.
+//! @param nThreads: number of threads to use.
+void XC::InteractionDiagram::FactorCapacidad(const double *N,const double *My,const double *Mz,double *factors,const size_t &sz,const size_t &nThreads) const
+  {
+    const size_t minBlockSize= 1024; //Don't use threads for small batches.
+    run_blocks([&](size_t begin, size_t end)
+      {
+        for(size_t i= begin;i<end;i++)
+          factors[i]= get_capacity_factor(N[i],My[i],Mz[i]);
+      },sz,std::min(nThreads,sz/minBlockSize+1));
+  }
+
+//! @brief Returns the capacity factors of the internal forces triplets
+//! whose components are being passed as parameters.
+XC::Vector XC::InteractionDiagram::FactorCapacidad(const Vector &N,const Vector &My,const Vector &Mz,const size_t &nThreads) const
+  {
+    const int sz= N.Size();
+    Vector retval(sz);
+    if((My.Size()!=sz) || (Mz.Size()!=sz))
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; vectors of different sizes." << std::endl;
+    else
+      FactorCapacidad(N.getDataPtr(),My.getDataPtr(),Mz.getDataPtr(),retval.getDataPtr(),sz,nThreads);
+    return retval;
+  }
+
+//! @brief Returns the capacity factors of the internal forces triplets
+//! whose components are being passed as parameters (using all the
+//! available threads).
+XC::Vector XC::InteractionDiagram::FactorCapacidad(const Vector &N,const Vector &My,const Vector &Mz) const
+  { return FactorCapacidad(N,My,Mz,std::thread::hardware_concurrency()); }
+
 
 void XC::InteractionDiagram::Print(std::ostream &os) const
   {
@@ -303,6 +386,23 @@ void XC::InteractionDiagram::setMatrizPosiciones(const Matrix &m)
     clasifica_triedros();   
   }
 
+//! @brief Returns the interaction diagram defined by the convex hull
+//! of the point cloud being passed as parameter.
+XC::InteractionDiagram XC::build_interaction_diagram(const NMyMzPointCloud &lp)
+  {
+    InteractionDiagram retval;
+    if(!lp.empty())
+      {
+        retval= InteractionDiagram(Pos3d(0,0,0),Triang3dMesh(get_convex_hull(lp)));
+        const double error= fabs(retval.FactorCapacidad(lp).Norm2()-lp.size())/lp.size();
+        if(error>0.005)
+	  std::cerr << "XC::" << __FUNCTION__
+	            << "; error in computation of interaction diagram ("
+                    << error << ") seems too big." << std::endl;
+      }
+    return retval;
+  }
+
 XC::InteractionDiagram XC::calc_interaction_diagram(const FiberSectionBase &scc,const InteractionDiagramData &data= InteractionDiagramData())
   {
     InteractionDiagram retval;
@@ -33,6 +33,7 @@
 #include <set>
 #include <deque>
 #include "ClosedTriangleMesh.h"
+#include "TrihedronGrid.h"
 
 class Triang3dMesh;
 
@@ -41,6 +42,7 @@ namespace XC {
 class Vector;
 class FiberSectionBase;
 class InteractionDiagramData;
+class NMyMzPointCloud;
 
 //! \@ingroup MATSCCDiagInt
 //
@@ -52,6 +54,7 @@ class InteractionDiagram: public ClosedTriangleMesh
 
     
     set_ptr_triedros triedros_cuadrante[8];
+    TrihedronGrid grid; //!< Angular grid used to search the trihedrons.
 
     void clasifica_triedro(const Triedro3d &tdro);
     void clasifica_triedros(void);
@@ -67,11 +70,16 @@ class InteractionDiagram: public ClosedTriangleMesh
     const Triedro3d *BuscaPtrTriedro(const Pos3d &p) const;
     Pos3d getIntersection(const Pos3d &) const;
     double FactorCapacidad(const Pos3d &) const;
+    double get_capacity_factor(const double &,const double &,const double &) const;
     Vector FactorCapacidad(const GeomObj::list_Pos3d &) const;
+    void FactorCapacidad(const double *,const double *,const double *,double *,const size_t &,const size_t &nThreads) const;
+    Vector FactorCapacidad(const Vector &,const Vector &,const Vector &,const size_t &nThreads) const;
+    Vector FactorCapacidad(const Vector &,const Vector &,const Vector &) const;
 
     void Print(std::ostream &os) const;
   };
 
+InteractionDiagram build_interaction_diagram(const NMyMzPointCloud &);
 InteractionDiagram calc_interaction_diagram(const FiberSectionBase &,const InteractionDiagramData &);
 
 } // end of XC namespace
@@ -32,6 +32,10 @@
 
 #include "material/section/fiber_section/FiberSectionBase.h"
 #include "material/section/interaction_diagram/InteractionDiagramData.h"
+#include "material/section/interaction_diagram/NMPointCloud.h"
+#include "xc_utils/src/geom/d2/ConvexHull2d.h"
+#include "xc_basic/src/util/mchne_eps.h"
+#include "utility/run_blocks.h"
 
 
 inline double angle(const Pos2d &p)
@@ -122,19 +126,153 @@ double XC::InteractionDiagram2d::FactorCapacidad(const Pos2d &esf_d) const
 
 XC::Vector XC::InteractionDiagram2d::FactorCapacidad(const GeomObj::list_Pos2d &lp) const
   {
-    Vector retval(lp.size());
-    int i= 0;
+    const size_t sz= lp.size();
+    std::vector<double> N(sz), M(sz);
+    size_t i= 0;
     for(GeomObj::list_Pos2d::const_iterator j= lp.begin();j!=lp.end(); j++, i++)
-      retval[i]= FactorCapacidad(*j);
+      {
+        N[i]= j->x(); M[i]= j->y();
+      }
+    Vector retval(sz);
+    FactorCapacidad(N.data(),M.data(),retval.getDataPtr(),sz,std::thread::hardware_concurrency());
+    return retval;
+  }
+
+//! @brief Default constructor (empty index).
+XC::DiagramEdgeIndex::DiagramEdgeIndex(void)
+  : ok(false) {}
+
+//! @brief Constructor.
+XC::DiagramEdgeIndex::DiagramEdgeIndex(const Poligono2d &plg)
+  : ok(false)
+  {
+    const size_t nv= plg.GetNumVertices();
+    if(nv<3)
+      return;
+    vertices.reserve(nv);
+    for(size_t i= 1;i<=nv;i++)
+      vertices.push_back(plg.Vertice(i));
+    std::sort(vertices.begin(),vertices.end(),comp);
+    angles.reserve(nv);
+    for(size_t i= 0;i<nv;i++)
+      angles.push_back(angle(vertices[i]));
+    //The origin must be strictly inside the (convex) polygon.
+    ok= true;
+    for(size_t k= 0;k<nv;k++)
+      {
+        const Pos2d &a= vertices[k];
+        const Pos2d &b= vertices[(k+1)%nv];
+        const double cross= a.x()*b.y()-a.y()*b.x();
+        if(cross<=0.0)
+          {
+            ok= false;
+            break;
+          }
+      }
+  }
+
+//! @brief Returns the capacity factor for the (N,M) pair being
+//! passed as parameter (or a negative number if the edge
+//! is not found).
+double XC::DiagramEdgeIndex::capacity_factor(const double &x,const double &y) const
+  {
+    double retval= -1.0;
+    const size_t nv= vertices.size();
+    //Edge k goes from vertex k to vertex k+1.
+    const double th= atan2(y,x);
+    size_t k= std::upper_bound(angles.begin(),angles.end(),th)-angles.begin();
+    k= (k+nv-1)%nv;
+    const Pos2d &a= vertices[k];
+    const Pos2d &b= vertices[(k+1)%nv];
+    const double ex= b.x()-a.x();
+    const double ey= b.y()-a.y();
+    const double den= a.x()*ey-a.y()*ex;
+    if(den!=0.0)
+      retval= (x*ey-y*ex)/den;
+    return retval;
+  }
+
+//! @brief Returns the capacity factor of the internal forces pair
+//! using the edge index of the diagram (that must be built from this
+//! diagram). If the index can't be used the general algorithm is
+//! used instead.
+//! @param index: angular index of the diagram edges.
+//! @param N: axial force.
+//! @param M: bending moment.
+double XC::InteractionDiagram2d::get_capacity_factor(const DiagramEdgeIndex &index,const double &N,const double &M) const
+  {
+    const double d= sqrt(N*N+M*M);
+    double retval= -1.0;
+    if(d<mchne_eps_dbl) //If the point is almost at the origin.
+      retval= 0.0;
+    else if(index.usable())
+      retval= index.capacity_factor(N,M);
+    if(retval<0.0) //Not computed, use the general algorithm.
+      retval= FactorCapacidad(Pos2d(N,M));
     return retval;
   }
 
+//! @brief Computes the capacity factors of a batch of internal forces
+//! pairs.
+//! @param N: axial forces.
+//! @param M: bending moments.
+//! @param factors: capacity factors (output).
+//! @param sz: number of pairs.
+//! @param nThreads: number of threads to use.
+void XC::InteractionDiagram2d::FactorCapacidad(const double *N,const double *M,double *factors,const size_t &sz,const size_t &nThreads) const
+  {
+    const DiagramEdgeIndex index(*this);
+    const size_t minBlockSize= 1024; //Don't use threads for small batches.
+    run_blocks([&](size_t begin, size_t end)
+      {
+        for(size_t i= begin;i<end;i++)
+          factors[i]= get_capacity_factor(index,N[i],M[i]);
+      },sz,std::min(nThreads,sz/minBlockSize+1));
+  }
+
+//! @brief Returns the capacity factors of the internal forces pairs
+//! whose components are being passed as parameters.
+XC::Vector XC::InteractionDiagram2d::FactorCapacidad(const Vector &N,const Vector &M,const size_t &nThreads) const
+  {
+    const int sz= N.Size();
+    Vector retval(sz);
+    if(M.Size()!=sz)
+      std::cerr << "InteractionDiagram2d::" << __FUNCTION__
+                << "; vectors of different sizes." << std::endl;
+    else
+      FactorCapacidad(N.getDataPtr(),M.getDataPtr(),retval.getDataPtr(),sz,nThreads);
+    return retval;
+  }
+
+//! @brief Returns the capacity factors of the internal forces pairs
+//! whose components are being passed as parameters (using all the
+//! available threads).
+XC::Vector XC::InteractionDiagram2d::FactorCapacidad(const Vector &N,const Vector &M) const
+  { return FactorCapacidad(N,M,std::thread::hardware_concurrency()); }
+
 
 void XC::InteractionDiagram2d::Print(std::ostream &os) const
   {
     std::cerr << "InteractionDiagram2d::Print not implemented." << std::endl;
   }
 
+//! @brief Returns the interaction diagram defined by the convex hull
+//! of the point cloud being passed as parameter.
+XC::InteractionDiagram2d XC::build_interaction_diagram_2d(const NMPointCloud &lp)
+  {
+    InteractionDiagram2d retval;
+    if(!lp.empty())
+      {
+        retval= InteractionDiagram2d(get_convex_hull2d(lp));
+        const double error= fabs(retval.FactorCapacidad(lp).Norm2()-lp.size())/lp.size();
+        if(error>0.005)
+	  std::cerr << "XC::" << __FUNCTION__
+	            << "; error in computation of interaction diagram ("
+                    << error << ") seems too big." << std::endl;
+      }
+    return retval;
+  }
+
 XC::InteractionDiagram2d XC::calcPlaneInteractionDiagram(const FiberSectionBase &scc,const InteractionDiagramData &data, const double &theta)
   {
     InteractionDiagram2d retval;
@@ -30,12 +30,35 @@
 #define INTERACTION_DIAGRAM2D_H
 
 #include "xc_utils/src/geom/d2/poligonos2d/Poligono2d.h"
+#include <vector>
 
 namespace XC {
 
 class Vector;
 class FiberSectionBase;
 class InteractionDiagramData;
+class NMPointCloud;
+
+//! \@ingroup MATSCCDiagInt
+//
+//! @brief Angular index of the edges of a convex diagram that
+//! contains the origin.
+//!
+//! The vertices are sorted by its polar angle so the edge
+//! intersected by the ray from the origin to a point can be
+//! found by binary search.
+class DiagramEdgeIndex
+  {
+    std::vector<double> angles; //!< Polar angles of the vertices (sorted).
+    std::vector<Pos2d> vertices; //!< Vertices sorted by polar angle.
+    bool ok; //!< True if the index can be used.
+  public:
+    DiagramEdgeIndex(void);
+    DiagramEdgeIndex(const Poligono2d &);
+    inline bool usable(void) const
+      { return ok; }
+    double capacity_factor(const double &,const double &) const;
+  };
 
 //! \@ingroup MATSCCDiagInt
 //
@@ -52,11 +75,16 @@ class InteractionDiagram2d: public Poligono2d
     void Simplify(void);
     Pos2d getIntersection(const Pos2d &) const;
     double FactorCapacidad(const Pos2d &esf_d) const;
+    double get_capacity_factor(const DiagramEdgeIndex &,const double &,const double &) const;
     Vector FactorCapacidad(const GeomObj::list_Pos2d &lp) const;
+    void FactorCapacidad(const double *,const double *,double *,const size_t &,const size_t &nThreads) const;
+    Vector FactorCapacidad(const Vector &,const Vector &,const size_t &nThreads) const;
+    Vector FactorCapacidad(const Vector &,const Vector &) const;
 
     void Print(std::ostream &os) const;
   };
 
+InteractionDiagram2d build_interaction_diagram_2d(const NMPointCloud &);
 InteractionDiagram2d calcPlaneInteractionDiagram(const FiberSectionBase &scc,const InteractionDiagramData &, const double &);
 InteractionDiagram2d calcNMyInteractionDiagram(const FiberSectionBase &scc,const InteractionDiagramData &);
 InteractionDiagram2d calcNMzInteractionDiagram(const FiberSectionBase &scc,const InteractionDiagramData &);
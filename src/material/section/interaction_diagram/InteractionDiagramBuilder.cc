@@ -0,0 +1,547 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//InteractionDiagramBuilder.cc
+
+#include "InteractionDiagramBuilder.h"
+#include "InteractionDiagramData.h"
+#include "NMPointCloud.h"
+#include "NMyMzPointCloud.h"
+#include "material/section/fiber_section/FiberSectionBase.h"
+#include "material/section/fiber_section/fiber/Fiber.h"
+#include "material/uniaxial/UniaxialMaterial.h"
+#include "utility/matrix/Vector.h"
+#include "utility/run_blocks.h"
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <chrono>
+#include <fstream>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <iomanip>
+
+namespace {
+
+//! @brief Version of the cache file format and of the algorithm used
+//! to compute the diagram points. It must be incremented each time
+//! any of them changes, so the files written by previous versions
+//! are not used.
+const std::uint32_t cacheVersion= 1;
+
+//! @brief Identifies the interaction diagram cache files.
+const char cacheMagic[4]= {'X','C','I','D'};
+
+//! @brief Kinds of diagram stored in the cache files.
+const std::uint32_t cacheDiagram3d= 3; //!< (N,My,Mz) diagram.
+const std::uint32_t cacheDiagram2d= 2; //!< points of a (N,M) diagram.
+
+//! @brief Writes the header of a cache file (magic number, version
+//! and kind of diagram).
+void write_cache_header(std::ostream &out,const std::uint32_t &kind)
+  {
+    out.write(cacheMagic,sizeof cacheMagic);
+    out.write((const char *) &cacheVersion,sizeof cacheVersion);
+    out.write((const char *) &kind,sizeof kind);
+  }
+
+//! @brief Reads the header of a cache file and returns true if it
+//! has been written by this version for the same kind of diagram.
+bool read_cache_header(std::istream &input,const std::uint32_t &kind)
+  {
+    char magic[4];
+    std::uint32_t version= 0, fileKind= 0;
+    input.read(magic,sizeof magic);
+    input.read((char *) &version,sizeof version);
+    input.read((char *) &fileKind,sizeof fileKind);
+    return (!input.fail() && (std::memcmp(magic,cacheMagic,sizeof magic)==0) && (version==cacheVersion) && (fileKind==kind));
+  }
+
+//! @brief 64-bit FNV-1a hash used to compute the keys of the
+//! interaction diagram cache.
+class KeyHash
+  {
+    std::uint64_t h;
+  public:
+    KeyHash(void)
+      : h(14695981039346656037ULL) {}
+    void add(const void *data,const size_t &sz)
+      {
+        const unsigned char *p= static_cast<const unsigned char *>(data);
+        for(size_t i= 0;i<sz;i++)
+          {
+            h^= p[i];
+            h*= 1099511628211ULL;
+          }
+      }
+    void add(const double &d)
+      {
+        const double v= (d==0.0 ? 0.0 : d); //Same key for 0.0 and -0.0.
+        add(&v,sizeof(v));
+      }
+    void add(const int &i)
+      { add(&i,sizeof(i)); }
+    void add(const size_t &i)
+      { add(&i,sizeof(i)); }
+    void add(const std::string &s)
+      {
+        add(s.size());
+        add(s.data(),s.size());
+      }
+    std::string getHex(void) const
+      {
+        std::ostringstream os;
+        os << std::hex << std::setw(16) << std::setfill('0') << h;
+        return os.str();
+      }
+  };
+
+//! @brief Adds to the key the response of the material sampled over
+//! the strain range [epsMin,epsMax].
+void add_material_response(KeyHash &key,const XC::UniaxialMaterial &mat,const double &epsMin,const double &epsMax)
+  {
+    XC::UniaxialMaterial *tmp= mat.getCopy();
+    if(tmp)
+      {
+        const size_t nSamples= 32;
+        const double inc= (epsMax-epsMin)/nSamples;
+        for(size_t i= 0;i<=nSamples;i++)
+          {
+            tmp->setTrialStrain(epsMin+i*inc);
+            key.add(tmp->getStress());
+          }
+        delete tmp;
+      }
+  }
+
+} // end of anonymous namespace
+
+//! @brief Default constructor.
+XC::InteractionDiagramBuilder::InteractionDiagramBuilder(void)
+  : EntCmd(), numThreads(std::max(1U,std::thread::hardware_concurrency())),
+    cacheDirectory(), numComputed(0), numCacheHits(0)
+  {}
+
+//! @brief Sets the number of threads used to compute the points
+//! of the diagrams.
+void XC::InteractionDiagramBuilder::setNumThreads(const size_t &n)
+  { numThreads= std::max(size_t(1),n); }
+
+//! @brief Sets the directory of the persistent cache (the directory
+//! must exist). If empty, the diagrams are cached only in memory.
+void XC::InteractionDiagramBuilder::setCacheDirectory(const std::string &dir)
+  { cacheDirectory= dir; }
+
+//! @brief Resets the number of diagrams computed and retrieved from
+//! the cache.
+void XC::InteractionDiagramBuilder::resetCounters(void)
+  {
+    numComputed= 0;
+    numCacheHits= 0;
+  }
+
+//! @brief Removes the diagrams stored in memory (the files of the
+//! persistent cache are not removed).
+void XC::InteractionDiagramBuilder::clearCache(void)
+  {
+    diagrams.clear();
+    diagrams2d.clear();
+  }
+
+//! @brief Returns the key of the diagram computed from the section
+//! and the parameters being passed as parameter.
+//!
+//! The key is a hash of the cache version, the kind of diagram, the
+//! angles used to compute it, the diagram parameters, the fiber
+//! positions and areas and the response of the fiber materials sampled
+//! over the range of strains of the diagram.
+//! @param kind: kind of diagram.
+//! @param section: fiber section.
+//! @param data: interaction diagram parameters.
+//! @param thetas: angles used to compute the diagram points.
+std::string XC::InteractionDiagramBuilder::get_key(const std::string &kind,const FiberSectionBase &section,const InteractionDiagramData &data,const std::vector<double> &thetas)
+  {
+    KeyHash key;
+    key.add(&cacheVersion,sizeof cacheVersion);
+    key.add(kind);
+    key.add(thetas.size());
+    for(std::vector<double>::const_iterator i= thetas.begin();i!=thetas.end();i++)
+      key.add(*i);
+    key.add(data.getUmbral());
+    key.add(data.getIncEps());
+    const PivotsUltimateStrains &pivots= data.getDefsAgotPivots();
+    const double epsA= pivots.getDefAgotPivotA();
+    const double epsB= pivots.getDefAgotPivotB();
+    const double epsC= pivots.getDefAgotPivotC();
+    key.add(epsA); key.add(epsB); key.add(epsC);
+    key.add(data.getConcreteSetName());
+    key.add(data.getConcreteTag());
+    key.add(data.getNmbSetArmadura());
+    key.add(data.getTagArmadura());
+
+    key.add(section.getClassTag());
+    const Vector &e0= section.getInitialSectionDeformation();
+    for(int i= 0;i<e0.Size();i++)
+      key.add(e0(i));
+    const FiberContainer &fibers= section.getFibers();
+    key.add(fibers.size());
+    const double epsMin= 1.5*std::min(std::min(epsB,epsC),-epsA);
+    const double epsMax= 1.5*std::max(epsA,-epsB);
+    std::set<std::pair<int,int> > sampled; //Materials already sampled.
+    for(FiberContainer::const_iterator i= fibers.begin();i!=fibers.end();i++)
+      {
+        const Fiber *f= *i;
+        key.add(f->getLocY());
+        key.add(f->getLocZ());
+        key.add(f->getArea());
+        const UniaxialMaterial *mat= f->getMaterial();
+        if(mat)
+          {
+            const std::pair<int,int> id(mat->getClassTag(),mat->getTag());
+            key.add(id.first);
+            key.add(id.second);
+            if(sampled.find(id)==sampled.end())
+              {
+                add_material_response(key,*mat,epsMin,epsMax);
+                sampled.insert(id);
+              }
+          }
+      }
+    return key.getHex();
+  }
+
+//! @brief Returns the key of the (N,My,Mz) interaction diagram of
+//! the section.
+std::string XC::InteractionDiagramBuilder::getKey(const FiberSectionBase &section,const InteractionDiagramData &data)
+  { return get_key("NMyMz",section,data,FiberSectionBase::getInteractionDiagramThetas(data)); }
+
+//! @brief Returns the key of the interaction diagram of the section
+//! on the plane defined by the angle being passed as parameter.
+std::string XC::InteractionDiagramBuilder::getPlaneKey(const FiberSectionBase &section,const InteractionDiagramData &data,const double &theta)
+  { return get_key("NM",section,data,FiberSectionBase::getInteractionDiagramThetasForPlane(theta)); }
+
+//! @brief Returns the name of the cache file for the key.
+std::string XC::InteractionDiagramBuilder::get_cache_file_name(const std::string &key) const
+  { return cacheDirectory+"/"+key+".bin"; }
+
+//! @brief Reads the diagram from the persistent cache (if any).
+bool XC::InteractionDiagramBuilder::read_from_cache(const std::string &key,InteractionDiagram &diag) const
+  {
+    bool retval= false;
+    if(!cacheDirectory.empty())
+      {
+        std::ifstream input(get_cache_file_name(key).c_str(), std::ios::in | std::ios::binary);
+        if(input && read_cache_header(input,cacheDiagram3d))
+          {
+            diag.read(input);
+            retval= !input.fail();
+          }
+      }
+    return retval;
+  }
+
+//! @brief Reads the diagram from the persistent cache (if any).
+bool XC::InteractionDiagramBuilder::read_from_cache(const std::string &key,InteractionDiagram2d &diag) const
+  {
+    bool retval= false;
+    if(!cacheDirectory.empty())
+      {
+        std::ifstream input(get_cache_file_name(key).c_str(), std::ios::in | std::ios::binary);
+        if(input && read_cache_header(input,cacheDiagram2d))
+          {
+            size_t sz= 0;
+            input.read((char *) &sz,sizeof sz);
+            NMPointCloud lp;
+            double xy[2];
+            for(size_t i= 0;(i<sz) && input;i++)
+              {
+                input.read((char *) xy,sizeof xy);
+                lp.push_back(Pos2d(xy[0],xy[1]));
+              }
+            retval= !input.fail();
+            if(retval)
+              diag= build_interaction_diagram_2d(lp);
+          }
+      }
+    return retval;
+  }
+
+namespace {
+
+//! @brief Returns a temporary file name for the cache file.
+//!
+//! The diagram is written to a temporary file that is renamed
+//! afterwards, so other processes never read an incomplete file.
+std::string get_tmp_file_name(const std::string &fName)
+  {
+    std::ostringstream os;
+    os << fName << ".tmp" << std::chrono::high_resolution_clock::now().time_since_epoch().count();
+    return os.str();
+  }
+
+//! @brief Moves the temporary file to its final name.
+void commit_cache_file(std::ofstream &out,const std::string &tmpName,const std::string &fName)
+  {
+    out.close();
+    if(out.fail() || (std::rename(tmpName.c_str(),fName.c_str())!=0))
+      {
+        std::cerr << "InteractionDiagramBuilder::" << __FUNCTION__
+                  << "; can't write cache file: '" << fName
+                  << "'." << std::endl;
+        std::remove(tmpName.c_str());
+      }
+  }
+
+} // end of anonymous namespace
+
+//! @brief Writes the diagram in the persistent cache (if any).
+void XC::InteractionDiagramBuilder::write_to_cache(const std::string &key,InteractionDiagram &diag) const
+  {
+    if(!cacheDirectory.empty())
+      {
+        const std::string fName= get_cache_file_name(key);
+        const std::string tmpName= get_tmp_file_name(fName);
+        std::ofstream out(tmpName.c_str(), std::ios::out | std::ios::binary);
+        write_cache_header(out,cacheDiagram3d);
+        diag.write(out);
+        commit_cache_file(out,tmpName,fName);
+      }
+  }
+
+//! @brief Writes the points of the 2D diagram in the persistent
+//! cache (if any). The diagram is rebuilt from them when read.
+void XC::InteractionDiagramBuilder::write_to_cache(const std::string &key,const NMPointCloud &lp) const
+  {
+    if(!cacheDirectory.empty())
+      {
+        const std::string fName= get_cache_file_name(key);
+        const std::string tmpName= get_tmp_file_name(fName);
+        std::ofstream out(tmpName.c_str(), std::ios::out | std::ios::binary);
+        write_cache_header(out,cacheDiagram2d);
+        const size_t sz= lp.size();
+        out.write((char *) &sz,sizeof sz);
+        for(NMPointCloud::const_iterator i= lp.begin();i!=lp.end();i++)
+          {
+            const double xy[2]= {i->x(),i->y()};
+            out.write((char *) xy,sizeof xy);
+          }
+        commit_cache_file(out,tmpName,fName);
+      }
+  }
+
+//! @brief Computes the points of the diagrams of the sections.
+//!
+//! The work items (section, angle) are distributed between the
+//! threads; each thread works on its own copy of the section and
+//! the points are merged afterwards in the same order used by
+//! FiberSectionBase, so the result doesn't depend on the number
+//! of threads.
+//! @param sections: fiber sections.
+//! @param data: interaction diagram parameters.
+//! @param thetas: angles used to compute the points of each section.
+std::vector<XC::NMyMzPointCloud> XC::InteractionDiagramBuilder::compute_points(const section_ptrs &sections,const InteractionDiagramData &data,const std::vector<std::vector<double> > &thetas) const
+  {
+    std::vector<std::pair<size_t,double> > items; //(section, angle).
+    for(size_t i= 0;i<sections.size();i++)
+      for(std::vector<double>::const_iterator j= thetas[i].begin();j!=thetas[i].end();j++)
+        items.push_back(std::pair<size_t,double>(i,*j));
+    // Points of each run of items (not filtered).
+    std::vector<NMyMzPointCloud> raw(items.size(),NMyMzPointCloud(-1.0));
+    std::mutex copyMutex;
+    run_blocks([&](size_t begin, size_t end)
+      {
+        size_t i= begin;
+        while(i<end)
+          {
+            const size_t iSection= items[i].first;
+            std::vector<double> runThetas;
+            size_t j= i;
+            for(;(j<end) && (items[j].first==iSection);j++)
+              runThetas.push_back(items[j].second);
+            FiberSectionBase *tmp= nullptr;
+            {
+              std::lock_guard<std::mutex> lock(copyMutex);
+              tmp= dynamic_cast<FiberSectionBase *>(sections[iSection]->getCopy());
+            }
+            if(tmp)
+              {
+                tmp->getInteractionDiagramPointsForThetas(raw[i],data,runThetas);
+                std::lock_guard<std::mutex> lock(copyMutex);
+                delete tmp;
+              }
+            else
+              std::cerr << "InteractionDiagramBuilder::compute_points"
+                        << "; can't get a copy of the section." << std::endl;
+            i= j;
+          }
+      },items.size(),numThreads);
+
+    std::vector<NMyMzPointCloud> retval(sections.size(),NMyMzPointCloud(data.getUmbral()));
+    for(size_t i= 0;i<items.size();i++)
+      {
+        NMyMzPointCloud &lp= retval[items[i].first];
+        for(NMyMzPointCloud::const_iterator j= raw[i].begin();j!=raw[i].end();j++)
+          lp.append(*j);
+      }
+    return retval;
+  }
+
+//! @brief Returns the (N,My,Mz) interaction diagrams of the sections.
+//!
+//! The diagrams are retrieved from the cache if possible, otherwise
+//! they are computed (in parallel) and stored in the cache.
+std::vector<XC::InteractionDiagram> XC::InteractionDiagramBuilder::getInteractionDiagrams(const section_ptrs &sections,const InteractionDiagramData &data)
+  {
+    const size_t sz= sections.size();
+    std::vector<InteractionDiagram> retval(sz);
+    std::vector<std::string> keys(sz);
+    std::vector<bool> found(sz,false);
+    std::map<std::string,size_t> pendingKeys;
+    section_ptrs pending;
+    std::vector<std::vector<double> > pendingThetas;
+    for(size_t i= 0;i<sz;i++)
+      {
+        keys[i]= getKey(*sections[i],data);
+        std::map<std::string,InteractionDiagram>::const_iterator j= diagrams.find(keys[i]);
+        if(j!=diagrams.end())
+          {
+            retval[i]= j->second;
+            found[i]= true;
+          }
+        else if(read_from_cache(keys[i],retval[i]))
+          {
+            diagrams[keys[i]]= retval[i];
+            found[i]= true;
+          }
+        if(found[i] || (pendingKeys.find(keys[i])!=pendingKeys.end()))
+          numCacheHits++;
+        else
+          {
+            pendingKeys[keys[i]]= pending.size();
+            pending.push_back(sections[i]);
+            pendingThetas.push_back(FiberSectionBase::getInteractionDiagramThetas(data));
+          }
+      }
+    if(!pending.empty())
+      {
+        const std::vector<NMyMzPointCloud> points= compute_points(pending,data,pendingThetas);
+        for(std::map<std::string,size_t>::const_iterator i= pendingKeys.begin();i!=pendingKeys.end();i++)
+          {
+            const NMyMzPointCloud &lp= points[i->second];
+            InteractionDiagram diag= build_interaction_diagram(lp);
+            numComputed++;
+            if(!lp.empty())
+              {
+                write_to_cache(i->first,diag);
+                diagrams[i->first]= diag;
+              }
+          }
+        for(size_t i= 0;i<sz;i++)
+          if(!found[i])
+            {
+              std::map<std::string,InteractionDiagram>::const_iterator j= diagrams.find(keys[i]);
+              if(j!=diagrams.end())
+                retval[i]= j->second;
+            }
+      }
+    return retval;
+  }
+
+//! @brief Returns the interaction diagrams of the sections on the plane
+//! defined by the angle being passed as parameter.
+//!
+//! The diagrams are retrieved from the cache if possible, otherwise
+//! they are computed (in parallel) and stored in the cache.
+std::vector<XC::InteractionDiagram2d> XC::InteractionDiagramBuilder::getPlaneInteractionDiagrams(const section_ptrs &sections,const InteractionDiagramData &data,const double &theta)
+  {
+    const size_t sz= sections.size();
+    std::vector<InteractionDiagram2d> retval(sz);
+    std::vector<std::string> keys(sz);
+    std::vector<bool> found(sz,false);
+    std::map<std::string,size_t> pendingKeys;
+    section_ptrs pending;
+    std::vector<std::vector<double> > pendingThetas;
+    for(size_t i= 0;i<sz;i++)
+      {
+        keys[i]= getPlaneKey(*sections[i],data,theta);
+        std::map<std::string,InteractionDiagram2d>::const_iterator j= diagrams2d.find(keys[i]);
+        if(j!=diagrams2d.end())
+          {
+            retval[i]= j->second;
+            found[i]= true;
+          }
+        else if(read_from_cache(keys[i],retval[i]))
+          {
+            diagrams2d[keys[i]]= retval[i];
+            found[i]= true;
+          }
+        if(found[i] || (pendingKeys.find(keys[i])!=pendingKeys.end()))
+          numCacheHits++;
+        else
+          {
+            pendingKeys[keys[i]]= pending.size();
+            pending.push_back(sections[i]);
+            pendingThetas.push_back(FiberSectionBase::getInteractionDiagramThetasForPlane(theta));
+          }
+      }
+    if(!pending.empty())
+      {
+        const std::vector<NMyMzPointCloud> points= compute_points(pending,data,pendingThetas);
+        for(std::map<std::string,size_t>::const_iterator i= pendingKeys.begin();i!=pendingKeys.end();i++)
+          {
+            const NMPointCloud lp= points[i->second].getNM(theta);
+            const InteractionDiagram2d diag= build_interaction_diagram_2d(lp);
+            numComputed++;
+            if(!lp.empty())
+              {
+                write_to_cache(i->first,lp);
+                diagrams2d[i->first]= diag;
+              }
+          }
+        for(size_t i= 0;i<sz;i++)
+          if(!found[i])
+            {
+              std::map<std::string,InteractionDiagram2d>::const_iterator j= diagrams2d.find(keys[i]);
+              if(j!=diagrams2d.end())
+                retval[i]= j->second;
+            }
+      }
+    return retval;
+  }
+
+//! @brief Returns the (N,My,Mz) interaction diagram of the section.
+XC::InteractionDiagram XC::InteractionDiagramBuilder::getInteractionDiagram(const FiberSectionBase &section,const InteractionDiagramData &data)
+  { return getInteractionDiagrams(section_ptrs(1,&section),data)[0]; }
+
+//! @brief Returns the interaction diagram of the section on the plane
+//! defined by the angle being passed as parameter.
+XC::InteractionDiagram2d XC::InteractionDiagramBuilder::getPlaneInteractionDiagram(const FiberSectionBase &section,const InteractionDiagramData &data,const double &theta)
+  { return getPlaneInteractionDiagrams(section_ptrs(1,&section),data,theta)[0]; }
+
+//! @brief Returns the interaction diagram of the section on the N-My plane.
+XC::InteractionDiagram2d XC::InteractionDiagramBuilder::getNMyInteractionDiagram(const FiberSectionBase &section,const InteractionDiagramData &data)
+  { return getPlaneInteractionDiagram(section,data,M_PI/2.0); }
+
+//! @brief Returns the interaction diagram of the section on the N-Mz plane.
+XC::InteractionDiagram2d XC::InteractionDiagramBuilder::getNMzInteractionDiagram(const FiberSectionBase &section,const InteractionDiagramData &data)
+  { return getPlaneInteractionDiagram(section,data,0.0); }
@@ -0,0 +1,100 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//InteractionDiagramBuilder.h
+
+#ifndef INTERACTIONDIAGRAMBUILDER_H
+#define INTERACTIONDIAGRAMBUILDER_H
+
+#include "xc_utils/src/nucleo/EntCmd.h"
+#include "InteractionDiagram.h"
+#include "InteractionDiagram2d.h"
+#include <map>
+#include <vector>
+#include <string>
+
+namespace XC {
+
+class FiberSectionBase;
+class InteractionDiagramData;
+class NMPointCloud;
+class NMyMzPointCloud;
+
+//! \@ingroup MATSCCDiagInt
+//
+//! @brief Computes the interaction diagrams of fiber sections.
+//!
+//! The points of the diagrams are computed in parallel: each work
+//! item is a (section, angle) pair and each thread works on its own
+//! copy of the section. The diagrams are stored in a cache indexed
+//! by a hash of the fiber geometry, the material responses and the
+//! diagram parameters, so the diagram of a section is computed only
+//! once. If a cache directory is defined the diagrams are also
+//! written to disk and reused in later runs.
+class InteractionDiagramBuilder: public EntCmd
+  {
+  public:
+    typedef std::vector<const FiberSectionBase *> section_ptrs;
+  private:
+    size_t numThreads; //!< number of threads used to compute the diagram points.
+    std::string cacheDirectory; //!< directory for the persistent cache (none if empty).
+    std::map<std::string,InteractionDiagram> diagrams; //!< 3D diagrams already computed.
+    std::map<std::string,InteractionDiagram2d> diagrams2d; //!< 2D diagrams already computed.
+    size_t numComputed; //!< number of diagrams computed.
+    size_t numCacheHits; //!< number of diagrams retrieved from the cache.
+
+    std::string get_cache_file_name(const std::string &) const;
+    bool read_from_cache(const std::string &,InteractionDiagram &) const;
+    bool read_from_cache(const std::string &,InteractionDiagram2d &) const;
+    void write_to_cache(const std::string &,InteractionDiagram &) const;
+    void write_to_cache(const std::string &,const NMPointCloud &) const;
+    std::vector<NMyMzPointCloud> compute_points(const section_ptrs &,const InteractionDiagramData &,const std::vector<std::vector<double> > &) const;
+    static std::string get_key(const std::string &,const FiberSectionBase &,const InteractionDiagramData &,const std::vector<double> &);
+  public:
+    InteractionDiagramBuilder(void);
+
+    inline size_t getNumThreads(void) const
+      { return numThreads; }
+    void setNumThreads(const size_t &);
+    inline const std::string &getCacheDirectory(void) const
+      { return cacheDirectory; }
+    void setCacheDirectory(const std::string &);
+    inline size_t getNumComputed(void) const
+      { return numComputed; }
+    inline size_t getNumCacheHits(void) const
+      { return numCacheHits; }
+    void resetCounters(void);
+    void clearCache(void);
+
+    static std::string getKey(const FiberSectionBase &,const InteractionDiagramData &);
+    static std::string getPlaneKey(const FiberSectionBase &,const InteractionDiagramData &,const double &);
+
+    std::vector<InteractionDiagram> getInteractionDiagrams(const section_ptrs &,const InteractionDiagramData &);
+    std::vector<InteractionDiagram2d> getPlaneInteractionDiagrams(const section_ptrs &,const InteractionDiagramData &,const double &);
+    InteractionDiagram getInteractionDiagram(const FiberSectionBase &,const InteractionDiagramData &);
+    InteractionDiagram2d getPlaneInteractionDiagram(const FiberSectionBase &,const InteractionDiagramData &,const double &);
+    InteractionDiagram2d getNMyInteractionDiagram(const FiberSectionBase &,const InteractionDiagramData &);
+    InteractionDiagram2d getNMzInteractionDiagram(const FiberSectionBase &,const InteractionDiagramData &);
+  };
+
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,274 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//TrihedronGrid.cc
+
+#include "TrihedronGrid.h"
+#include "xc_utils/src/geom/d2/Triedro3d.h"
+#include "xc_utils/src/geom/pos_vec/Pos3d.h"
+#include <cmath>
+#include <algorithm>
+
+namespace {
+
+inline double dot(const double *a,const double *b)
+  { return a[0]*b[0]+a[1]*b[1]+a[2]*b[2]; }
+
+inline void cross(const double *a,const double *b,double *c)
+  {
+    c[0]= a[1]*b[2]-a[2]*b[1];
+    c[1]= a[2]*b[0]-a[0]*b[2];
+    c[2]= a[0]*b[1]-a[1]*b[0];
+  }
+
+inline double norm(const double *a)
+  { return sqrt(dot(a,a)); }
+
+//! @brief Relative tolerance for the test of the lateral faces.
+const double faceTol= 1e-10;
+
+} // end of anonymous namespace
+
+//! @brief Default constructor.
+XC::TrihedronGrid::TrihedronGrid(void)
+  : nPolar(0), nAzimuth(0)
+  { org[0]= 0.0; org[1]= 0.0; org[2]= 0.0; }
+
+//! @brief Removes all the trihedrons.
+void XC::TrihedronGrid::clear(void)
+  {
+    nPolar= 0;
+    nAzimuth= 0;
+    trihedrons.clear();
+    cellBegin.clear();
+    cellItems.clear();
+    allCells.clear();
+  }
+
+//! @brief Returns the index of the cell that contains the direction
+//! being passed as parameter.
+size_t XC::TrihedronGrid::get_cell(const double &x,const double &y,const double &z) const
+  {
+    const double r= sqrt(x*x+y*y+z*z);
+    if(r<=0.0)
+      return 0;
+    const double polar= acos(std::max(-1.0,std::min(1.0,z/r)));
+    const double azimuth= atan2(y,x)+M_PI;
+    const size_t i= std::min(nPolar-1,size_t(polar*nPolar/M_PI));
+    const size_t j= std::min(nAzimuth-1,size_t(azimuth*nAzimuth/(2*M_PI)));
+    return i*nAzimuth+j;
+  }
+
+//! @brief Returns the cells that intersect the spherical cap with
+//! the center and the angular radius being passed as parameters.
+std::vector<size_t> XC::TrihedronGrid::get_cells(const double *center,const double &radius) const
+  {
+    std::vector<size_t> retval;
+    const double dPolar= M_PI/nPolar;
+    const double dAzimuth= 2*M_PI/nAzimuth;
+    const double polar= acos(std::max(-1.0,std::min(1.0,center[2])));
+    const double azimuth= atan2(center[1],center[0])+M_PI;
+    const double lo= polar-radius;
+    const double hi= polar+radius;
+    const size_t iLo= (lo<=0.0 ? 0 : std::min(nPolar-1,size_t(lo/dPolar)));
+    const size_t iHi= (hi>=M_PI ? nPolar-1 : std::min(nPolar-1,size_t(hi/dPolar)));
+    // Azimuth range (all of them if the cap contains a pole).
+    bool allAzimuths= (lo<=0.0) || (hi>=M_PI);
+    long jLo= 0, jHi= nAzimuth-1;
+    if(!allAzimuths)
+      {
+        const double s= sin(radius)/sin(polar);
+        if(s>=1.0)
+          allAzimuths= true;
+        else
+          {
+            const double halfWidth= asin(s);
+            jLo= long(floor((azimuth-halfWidth)/dAzimuth));
+            jHi= long(floor((azimuth+halfWidth)/dAzimuth));
+            if(jHi-jLo+1>=long(nAzimuth))
+              allAzimuths= true;
+          }
+      }
+    if(allAzimuths)
+      { jLo= 0; jHi= nAzimuth-1; }
+    for(size_t i= iLo;i<=iHi;i++)
+      for(long j= jLo;j<=jHi;j++)
+        {
+          const long jj= ((j%long(nAzimuth))+long(nAzimuth))%long(nAzimuth);
+          retval.push_back(i*nAzimuth+jj);
+        }
+    return retval;
+  }
+
+//! @brief Builds the grid for the trihedrons being passed as parameter
+//! (all of them must have the same cusp).
+//!
+//! Each trihedron is bounded by the spherical cap centered on the mean
+//! direction of its edges; the trihedron is assigned to the cells that
+//! intersect that cap. Degenerated trihedrons are not included (the
+//! search falls back to the brute force one for them).
+void XC::TrihedronGrid::setup(const std::vector<Triedro3d> &tdros)
+  {
+    clear();
+    const size_t sz= tdros.size();
+    if(sz==0)
+      return;
+    const Pos3d &c= tdros.begin()->Cuspide();
+    org[0]= c.x(); org[1]= c.y(); org[2]= c.z();
+    nPolar= std::max(size_t(4),size_t(ceil(sqrt(sz/2.0))));
+    nAzimuth= 2*nPolar;
+
+    std::vector<std::vector<size_t> > trihedronCells;
+    trihedronCells.reserve(sz);
+    trihedrons.reserve(sz);
+    for(std::vector<Triedro3d>::const_iterator t= tdros.begin();t!=tdros.end();t++)
+      {
+        double v[3][3]; //Vertices.
+        double e[3][3]; //Edges (from the cusp).
+        double u[3][3]; //Unit edges.
+        bool degenerated= false;
+        for(size_t k= 0;k<3;k++)
+          {
+            const Pos3d p= t->Vertice(k+1);
+            v[k][0]= p.x(); v[k][1]= p.y(); v[k][2]= p.z();
+            for(size_t l= 0;l<3;l++)
+              e[k][l]= v[k][l]-org[l];
+            const double r= norm(e[k]);
+            if(r<=0.0)
+              { degenerated= true; break; }
+            for(size_t l= 0;l<3;l++)
+              u[k][l]= e[k][l]/r;
+          }
+        if(degenerated)
+          continue;
+        TrihedronData data;
+        data.ptr= &(*t);
+        // Lateral faces.
+        double bc[3];
+        cross(u[1],u[2],bc);
+        const double det= dot(u[0],bc);
+        if(fabs(det)<1e-12)
+          continue; //Degenerated.
+        const double sgn= (det>0.0 ? 1.0 : -1.0);
+        for(size_t k= 0;k<3;k++)
+          {
+            double *f= data.faces+3*k;
+            cross(u[k],u[(k+1)%3],f);
+            const double r= norm(f);
+            for(size_t l= 0;l<3;l++)
+              f[l]*= sgn/r;
+          }
+        // Base plane.
+        double a[3], b[3];
+        for(size_t l= 0;l<3;l++)
+          {
+            a[l]= v[1][l]-v[0][l];
+            b[l]= v[2][l]-v[0][l];
+          }
+        cross(a,b,data.n);
+        data.d= dot(data.n,v[0]);
+        // Bounding cap.
+        double center[3]= {u[0][0]+u[1][0]+u[2][0],u[0][1]+u[1][1]+u[2][1],u[0][2]+u[1][2]+u[2][2]};
+        const double r= norm(center);
+        double radius= M_PI;
+        if(r>1e-6)
+          {
+            for(size_t l= 0;l<3;l++)
+              center[l]/= r;
+            radius= 0.0;
+            for(size_t k= 0;k<3;k++)
+              radius= std::max(radius,acos(std::max(-1.0,std::min(1.0,dot(center,u[k])))));
+            radius+= 1e-6;
+          }
+        const size_t index= trihedrons.size();
+        trihedrons.push_back(data);
+        if(radius>=M_PI/2.0) //Cap is not convex.
+          {
+            allCells.push_back(index);
+            trihedronCells.push_back(std::vector<size_t>());
+          }
+        else
+          trihedronCells.push_back(get_cells(center,radius));
+      }
+    // Compressed storage of the cell contents.
+    const size_t nCells= getNumCells();
+    cellBegin.assign(nCells+1,0);
+    for(std::vector<std::vector<size_t> >::const_iterator i= trihedronCells.begin();i!=trihedronCells.end();i++)
+      for(std::vector<size_t>::const_iterator j= i->begin();j!=i->end();j++)
+        cellBegin[*j+1]++;
+    for(size_t i= 0;i<nCells;i++)
+      cellBegin[i+1]+= cellBegin[i];
+    cellItems.resize(cellBegin[nCells]);
+    std::vector<size_t> pos(cellBegin.begin(),cellBegin.end()-1);
+    for(size_t i= 0;i<trihedronCells.size();i++)
+      for(std::vector<size_t>::const_iterator j= trihedronCells[i].begin();j!=trihedronCells[i].end();j++)
+        cellItems[pos[*j]++]= i;
+  }
+
+//! @brief Returns the data of the trihedron that contains the point
+//! being passed as parameter (nullptr if not found).
+const XC::TrihedronGrid::TrihedronData *XC::TrihedronGrid::findData(const double &x,const double &y,const double &z) const
+  {
+    const TrihedronData *retval= nullptr;
+    if(!trihedrons.empty())
+      {
+        const double q[3]= {x-org[0],y-org[1],z-org[2]};
+        const double tol= -faceTol*norm(q);
+        const size_t cell= get_cell(q[0],q[1],q[2]);
+        for(size_t k= cellBegin[cell];k<cellBegin[cell+1];k++)
+          {
+            const TrihedronData &t= trihedrons[cellItems[k]];
+            if((dot(t.faces,q)>=tol) && (dot(t.faces+3,q)>=tol) && (dot(t.faces+6,q)>=tol))
+              return &t;
+          }
+        for(std::vector<size_t>::const_iterator k= allCells.begin();k!=allCells.end();k++)
+          {
+            const TrihedronData &t= trihedrons[*k];
+            if((dot(t.faces,q)>=tol) && (dot(t.faces+3,q)>=tol) && (dot(t.faces+6,q)>=tol))
+              return &t;
+          }
+      }
+    return retval;
+  }
+
+//! @brief Returns the trihedron that contains the point being passed
+//! as parameter, checked with Triedro3d::In (nullptr if not found).
+const Triedro3d *XC::TrihedronGrid::find(const Pos3d &p,const double &tol) const
+  {
+    const Triedro3d *retval= nullptr;
+    if(!trihedrons.empty())
+      {
+        const size_t cell= get_cell(p.x()-org[0],p.y()-org[1],p.z()-org[2]);
+        for(size_t k= cellBegin[cell];k<cellBegin[cell+1];k++)
+          {
+            const Triedro3d *t= trihedrons[cellItems[k]].ptr;
+            if(t->In(p,tol))
+              return t;
+          }
+        for(std::vector<size_t>::const_iterator k= allCells.begin();k!=allCells.end();k++)
+          {
+            const Triedro3d *t= trihedrons[*k].ptr;
+            if(t->In(p,tol))
+              return t;
+          }
+      }
+    return retval;
+  }
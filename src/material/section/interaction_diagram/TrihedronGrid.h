@@ -0,0 +1,83 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//TrihedronGrid.h
+
+#ifndef TRIHEDRONGRID_H
+#define TRIHEDRONGRID_H
+
+#include <vector>
+#include <cstddef>
+
+class Triedro3d;
+class Pos3d;
+
+namespace XC {
+
+//! \@ingroup MATSCCDiagInt
+//
+//! @brief Angular grid over the directions from the cusp of
+//! the trihedrons of a closed triangle mesh.
+//!
+//! The unit sphere is divided in cells of constant polar and
+//! azimuthal angle increments; each cell stores the trihedrons
+//! whose solid angle can contain directions of the cell, so the
+//! trihedron that contains a point is searched only between a
+//! few candidates.
+class TrihedronGrid
+  {
+  public:
+    //! @brief Data used to test if a point is inside a trihedron
+    //! and to intersect the ray from the origin with its base.
+    struct TrihedronData
+      {
+        const Triedro3d *ptr; //!< Trihedron.
+        double faces[9]; //!< Unit inward normals of the lateral faces.
+        double n[3]; //!< Normal of the base plane.
+        double d; //!< Base plane: n·x= d.
+      };
+  private:
+    double org[3]; //!< Cusp of the trihedrons.
+    size_t nPolar; //!< Number of divisions of the polar angle.
+    size_t nAzimuth; //!< Number of divisions of the azimuth.
+    std::vector<TrihedronData> trihedrons; //!< Trihedron data.
+    std::vector<size_t> cellBegin; //!< First item of each cell.
+    std::vector<size_t> cellItems; //!< Trihedrons of each cell.
+    std::vector<size_t> allCells; //!< Trihedrons included in every cell.
+
+    size_t get_cell(const double &,const double &,const double &) const;
+    std::vector<size_t> get_cells(const double *,const double &) const;
+  public:
+    TrihedronGrid(void);
+    void clear(void);
+    void setup(const std::vector<Triedro3d> &);
+    inline bool empty(void) const
+      { return trihedrons.empty(); }
+    inline size_t getNumCells(void) const
+      { return nPolar*nAzimuth; }
+
+    const TrihedronData *findData(const double &,const double &,const double &) const;
+    const Triedro3d *find(const Pos3d &,const double &) const;
+  };
+
+} // end of XC namespace
+
+#endif
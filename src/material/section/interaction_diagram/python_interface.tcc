@@ -65,18 +65,35 @@ class_<XC::ClosedTriangleMesh, bases<GeomObj3d>, boost::noncopyable >("ClosedTri
   ;
 
 double (XC::InteractionDiagram::*getFactorCapacidad)(const Pos3d &esf_d) const= &XC::InteractionDiagram::FactorCapacidad;
+XC::Vector (XC::InteractionDiagram::*getFactoresCapacidad)(const XC::Vector &,const XC::Vector &,const XC::Vector &) const= &XC::InteractionDiagram::FactorCapacidad;
 class_<XC::InteractionDiagram, bases<XC::ClosedTriangleMesh>, boost::noncopyable >("InteractionDiagram", no_init)
   .def("centroid",&XC::InteractionDiagram::Cdg)
   .def("getLength",&XC::InteractionDiagram::Longitud)
   .def("getIntersection",&XC::InteractionDiagram::getIntersection,"Returns the intersection of the ray O->point(N,My,Mz) with the interaction diagram.")
   .def("getCapacityFactor",getFactorCapacidad)
+  .def("getCapacityFactors",getFactoresCapacidad,"getCapacityFactors(N,My,Mz): return the capacity factors of the internal forces triplets whose components are stored in the vectors N, My and Mz.")
   .def("writeTo",&XC::InteractionDiagram::writeTo)
   .def("readFrom",&XC::InteractionDiagram::readFrom)
   ;
 
 double (XC::InteractionDiagram2d::*getFactorCapacidad2d)(const Pos2d &esf_d) const= &XC::InteractionDiagram2d::FactorCapacidad;
+XC::Vector (XC::InteractionDiagram2d::*getFactoresCapacidad2d)(const XC::Vector &,const XC::Vector &) const= &XC::InteractionDiagram2d::FactorCapacidad;
 class_<XC::InteractionDiagram2d, bases<Poligono2d>, boost::noncopyable >("InteractionDiagram2d", no_init)
   .def("getIntersection",&XC::InteractionDiagram2d::getIntersection,"Returns the intersection of the ray O->point(N,My,Mz) with the interaction diagram.")
   .def("getCapacityFactor",getFactorCapacidad2d)
+  .def("getCapacityFactors",getFactoresCapacidad2d,"getCapacityFactors(N,M): return the capacity factors of the internal forces pairs whose components are stored in the vectors N and M.")
   .def("simplify",&XC::InteractionDiagram2d::Simplify)
   ;
+
+class_<XC::InteractionDiagramBuilder, bases<EntCmd>, boost::noncopyable >("InteractionDiagramBuilder", no_init)
+  .add_property("numThreads",&XC::InteractionDiagramBuilder::getNumThreads,&XC::InteractionDiagramBuilder::setNumThreads,"Number of threads used to compute the diagram points.")
+  .add_property("cacheDirectory",make_function(&XC::InteractionDiagramBuilder::getCacheDirectory,return_value_policy<copy_const_reference>()),&XC::InteractionDiagramBuilder::setCacheDirectory,"Directory of the persistent cache of diagrams (must exist, no persistent cache if empty).")
+  .add_property("numComputed",&XC::InteractionDiagramBuilder::getNumComputed,"Number of diagrams computed.")
+  .add_property("numCacheHits",&XC::InteractionDiagramBuilder::getNumCacheHits,"Number of diagrams retrieved from the cache.")
+  .def("resetCounters",&XC::InteractionDiagramBuilder::resetCounters,"Reset the number of diagrams computed and retrieved from the cache.")
+  .def("clearCache",&XC::InteractionDiagramBuilder::clearCache,"Remove the diagrams stored in memory (the persistent cache is kept).")
+  .def("getKey",&XC::InteractionDiagramBuilder::getKey,"getKey(section,diagParameters): return the cache key of the interaction diagram of the section.")
+  .staticmethod("getKey")
+  .def("getPlaneKey",&XC::InteractionDiagramBuilder::getPlaneKey,"getPlaneKey(section,diagParameters,theta): return the cache key of the interaction diagram of the section on the plane defined by theta.")
+  .staticmethod("getPlaneKey")
+  ;
@@ -63,8 +63,8 @@
 const double XC::MembranePlateFiberSection::root56 = sqrt(5.0/6.0); //shear correction
 
 //static vector and matrices
-XC::Vector  XC::MembranePlateFiberSection::stressResultant(8);
-XC::Matrix  XC::MembranePlateFiberSection::tangent(8,8);
+thread_local XC::Vector  XC::MembranePlateFiberSection::stressResultant(8);
+thread_local XC::Matrix  XC::MembranePlateFiberSection::tangent(8,8);
 
 
 const double  XC::MembranePlateFiberSection::sg[] = { -1, 
@@ -216,7 +216,7 @@ int XC::MembranePlateFiberSection::setTrialSectionDeformation( const XC::Vector
   {
     this->strainResultant = strainResultant_from_element;
 
-    static XC::Vector strain(5);
+    static thread_local XC::Vector strain(5);
 
     int success= 0;
     double z;
@@ -243,7 +243,7 @@ const XC::Vector& XC::MembranePlateFiberSection::getSectionDeformation(void) con
 //send back the stressResultant 
 const XC::Vector&  XC::MembranePlateFiberSection::getStressResultant(void) const
   {
-    static XC::Vector stress(5);
+    static thread_local XC::Vector stress(5);
     int i;
     double z, weight;
     stressResultant.Zero( );
@@ -275,9 +275,9 @@ const XC::Vector&  XC::MembranePlateFiberSection::getStressResultant(void) const
 //! @brief Return the tangent stiffness matrix.
 const XC::Matrix&  XC::MembranePlateFiberSection::getSectionTangent(void) const
   {
-    static XC::Matrix dd(5,5);
-    static XC::Matrix Aeps(5,8);
-    static XC::Matrix Asig(8,5);
+    static thread_local XC::Matrix dd(5,5);
+    static thread_local XC::Matrix Aeps(5,8);
+    static thread_local XC::Matrix Asig(8,5);
 
     double z, weight;
     tangent.Zero( );
@@ -53,8 +53,8 @@ class CrossSectionProperties2d: public EntCmd, public MovableObject
   {
   private:
     double e, g, a, i, alpha;
-    static Matrix ks2;
-    static Matrix ks3;
+    static thread_local Matrix ks2;
+    static thread_local Matrix ks3;
   protected:
     virtual DbTagData &getDbTagData(void) const;
     int sendData(CommParameters &);
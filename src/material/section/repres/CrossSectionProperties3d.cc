@@ -37,8 +37,8 @@
 #include "domain/component/Parameter.h"
 #include "material/section/SectionForceDeformation.h"
 
-XC::Matrix XC::CrossSectionProperties3d::ks4(4,4);
-XC::Matrix XC::CrossSectionProperties3d::ks6(6,6);
+thread_local XC::Matrix XC::CrossSectionProperties3d::ks4(4,4);
+thread_local XC::Matrix XC::CrossSectionProperties3d::ks6(6,6);
 
 bool XC::CrossSectionProperties3d::check_values(void)
   {
@@ -196,7 +196,7 @@ XC::CrossSectionProperties3d XC::SectionMassProperties::getCrossSectionPropertie
 
 XC::CrossSectionProperties2d XC::SectionMassProperties::getCrossSectionProperties2d(const CrossSectionProperties2d &base) const
   {
-    static CrossSectionProperties2d retval;
+    static thread_local CrossSectionProperties2d retval;
     retval= base; //Asignamos E, G y alpha.
     retval.A()= getAreaHomogenizedSection(base.E()); 
     retval.I()= getIzHomogenizedSection(base.E());
@@ -68,7 +68,7 @@ XC::RgSccPoligono XC::RegionSecc::Intersection(const Semiplano2d &sp) const
 const XC::Vector &XC::RegionSecc::Cdg(void) const
   {
     const Pos2d p= getPolygon().Cdg();
-    static Vector retval(2);
+    static thread_local Vector retval(2);
     retval[0]= p.x();
     retval[1]= p.y();
     return retval;
@@ -107,7 +107,7 @@ double XC::RegionSecc::Theta_p(void) const
 const XC::Vector &XC::RegionSecc::DirEjeI_a(void) const
   {
     const Dir2d p= getPolygon().DirEjeI_a();
-    static Vector retval(2);
+    static thread_local Vector retval(2);
     retval[0]= p.dx();
     retval[1]= p.dy();
     return retval;
@@ -119,7 +119,7 @@ const XC::Vector &XC::RegionSecc::DirEjeI_a(void) const
 const XC::Vector &XC::RegionSecc::DirEjeI_b(void) const
   {
     const Dir2d p= getPolygon().DirEjeI_b();
-    static Vector retval(2);
+    static thread_local Vector retval(2);
     retval[0]= p.dx();
     retval[1]= p.dy();
     return retval;
@@ -168,7 +168,7 @@ double XC::RegionSecc::getIO(const Pos2d &o)
 //! @brief Returns the tensor of inertia computed with respect to the object centroid.
 XC::Matrix &XC::RegionSecc::getI(void) const
   {
-    static Matrix i(2,2);
+    static thread_local Matrix i(2,2);
     const Poligono2d &pol= getPolygon();
     i(0,0)= pol.Ix(); i(0,1)= -pol.Pxy();
     i(1,0)= i(0,1);   i(1,1)= pol.Iy();
@@ -179,7 +179,7 @@ XC::Matrix &XC::RegionSecc::getI(void) const
 XC::Matrix &XC::RegionSecc::getI(const Pos2d &o) const
   {
     matriz_FT tmp= getPolygon().I(o);
-    static Matrix i(2,2);
+    static thread_local Matrix i(2,2);
     i(0,0)= tmp(1,1); i(0,1)= tmp(1,2);
     i(1,0)= tmp(1,2); i(1,1)= tmp(2,2);
     return i;
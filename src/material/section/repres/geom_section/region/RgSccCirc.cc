@@ -93,7 +93,7 @@ void XC::RgSccCirc::getAngles(double &initialAngle, double &finalAngle) const
 
 const XC::Matrix &XC::RgSccCirc::getVertCoords(void) const
   {
-    static Matrix vertCoord(4,2);
+    static thread_local Matrix vertCoord(4,2);
     const double cosI= cos(initAng);
     const double cosF= cos(finalAng);
     const double sinI= sin(initAng);
@@ -139,7 +139,7 @@ Poligono2d XC::RgSccCirc::getPolygon(void) const
 
 SectorAnilloCircular2d &XC::RgSccCirc::getSector(void) const
   {
-    static SectorAnilloCircular2d retval;
+    static thread_local SectorAnilloCircular2d retval;
     Pos2d O(centerPosit(0),centerPosit(1));
     Circulo2d c(O,extRad);
     SectorCircular2d sc(c,initAng,finalAng);
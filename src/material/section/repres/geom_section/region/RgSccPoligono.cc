@@ -60,7 +60,7 @@ Poligono2d XC::RgSccPoligono::getPolygon(void) const
 const Rejilla2d &XC::RgSccPoligono::getMesh(void) const
   {
     std::cerr << "RgSccPoligono::getMesh not implemented." << std::endl;
-    static Rejilla2d retval;
+    static thread_local Rejilla2d retval;
     return retval;
   }
 
@@ -125,7 +125,7 @@ double XC::ReinfBar::Theta_p(void) const
 //! (we don't know yet if it's the major one or the minor one).
 const XC::Vector &XC::ReinfBar::DirEjeI_a(void) const
   {
-    static Vector retval(2);
+    static thread_local Vector retval(2);
     retval[0]= 1.0;
     retval[1]= 0.0;
     return retval;
@@ -136,7 +136,7 @@ const XC::Vector &XC::ReinfBar::DirEjeI_a(void) const
 //! one or the minor one).
 const XC::Vector &XC::ReinfBar::DirEjeI_b(void) const
   {
-    static Vector retval(2);
+    static thread_local Vector retval(2);
     retval[0]= 0.0;
     retval[1]= 1.0;
     return retval;
@@ -198,7 +198,7 @@ double XC::ReinfBar::getIO(const Pos2d &o) const
 //! @brief Returns the inertia tensor computed with respect to the object centroid.
 XC::Matrix &XC::ReinfBar::getI(void) const
   {
-    static Matrix i(2,2);
+    static thread_local Matrix i(2,2);
     i(0,0)= Iy(); i(0,1)= -Pyz();
     i(1,0)= i(0,1);   i(1,1)= Iz();
     return i;
@@ -207,7 +207,7 @@ XC::Matrix &XC::ReinfBar::getI(void) const
 //! @brief Returns the inertia tensor respector al punto o.
 XC::Matrix &XC::ReinfBar::getI(const Pos2d &o) const
   {
-    static Matrix retval(2,2);
+    static thread_local Matrix retval(2,2);
     Matrix Ig= getI();
     Vector O(2); O[0]= o.x(); O[1]= o.y();
     Vector og= getPosition() - O;
@@ -58,7 +58,7 @@ size_t XC::FiberData::put_cells(const size_t &offset,const VectorCells &cells,Ma
   {
     const size_t numCells= cells.size();
     size_t k= offset;
-    static Vector fiberPosition(2); //!< Position of the fiber.
+    static thread_local Vector fiberPosition(2); //!< Position of the fiber.
 
     for(size_t j= 0;j<numCells;j++)
       {
@@ -79,7 +79,7 @@ size_t XC::FiberData::put_reinf_bars(const size_t &offset,const VectorReinfBar &
   {
     int k= offset;
     const size_t sz= bars.size();
-    static Vector fiberPosition(2); //Position of the bars.
+    static thread_local Vector fiberPosition(2); //Position of the bars.
 
     for(size_t j= 0;j<sz;j++)
       {
@@ -175,7 +175,7 @@ void XC::FiberData::get3DFibers(fiber_list &retval) const
     UniaxialMaterial *material= nullptr;
     Material *tmp_material= nullptr;
     UniaxialFiber3d *tmp_fiber= nullptr;
-    static Vector fiberPosition(2);
+    static thread_local Vector fiberPosition(2);
     const int sz= size();
     for(int k= 0;k<sz;k++)
       {
@@ -61,7 +61,7 @@ const int TZmaxIterations = 20;
 const double TZtolerance = 1.0e-12;
 
 int XC::TzLiq1::loadStage = 0;
-XC::Vector XC::TzLiq1::stressV3(3);
+thread_local XC::Vector XC::TzLiq1::stressV3(3);
 
 /////////////////////////////////////////////////////////////////////
 //        Constructor with data
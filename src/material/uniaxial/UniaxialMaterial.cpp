@@ -104,7 +104,7 @@ double XC::UniaxialMaterial::getStrainRate(void) const
 //! @brief Return the generalized stress.
 const XC::Vector &XC::UniaxialMaterial::getGeneralizedStress(void) const
   {
-    static Vector retval(1);
+    static thread_local Vector retval(1);
     retval(0)= getStress();
     return retval;
   }
@@ -112,14 +112,14 @@ const XC::Vector &XC::UniaxialMaterial::getGeneralizedStress(void) const
 //! @brief Return the generalized strain.
 const XC::Vector &XC::UniaxialMaterial::getGeneralizedStrain(void) const
   {
-    static Vector retval(1);
+    static thread_local Vector retval(1);
     retval(0)= getStrain();
     return retval;
   }
 
 const XC::Vector &XC::UniaxialMaterial::getInitialGeneralizedStrain(void) const
   {
-    static Vector retval(1);
+    static thread_local Vector retval(1);
     retval(0)= getInitialStrain();
     return retval;
   }
@@ -222,7 +222,7 @@ XC::Response *XC::UniaxialMaterial::setResponse(const std::vector<std::string> &
 
 int XC::UniaxialMaterial::getResponse(int responseID, Information &matInfo)
   {
-    static XC::Vector stressStrain(2);
+    static thread_local XC::Vector stressStrain(2);
     // each subclass must implement its own stuff    
     switch(responseID)
       {
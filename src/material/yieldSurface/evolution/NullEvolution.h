@@ -54,9 +54,9 @@ namespace XC {
 class NullEvolution: public YS_Evolution
   {
   private:
-    static Vector vec_dim_1;
-    static Vector vec_dim_2;  
-    static Vector vec_dim_3;
+    static thread_local Vector vec_dim_1;
+    static thread_local Vector vec_dim_2;  
+    static thread_local Vector vec_dim_3;
   public: 
 
     NullEvolution(int tag, double isox);
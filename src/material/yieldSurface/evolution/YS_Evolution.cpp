@@ -30,9 +30,9 @@
 
 #include "material/yieldSurface/evolution/YS_Evolution.h"
 
-XC::Vector XC::YS_Evolution::crd1(1);
-XC::Vector XC::YS_Evolution::crd2(2);
-XC::Vector XC::YS_Evolution::crd3(3);
+thread_local XC::Vector XC::YS_Evolution::crd1(1);
+thread_local XC::Vector XC::YS_Evolution::crd2(2);
+thread_local XC::Vector XC::YS_Evolution::crd3(3);
 
 //////////////////////////////////////////////////////////////////////
 // Construction/Destruction
@@ -248,13 +248,13 @@ void XC::YS_Evolution::Print(std::ostream &s, int flag)
 
 const XC::Vector &XC::YS_Evolution::getGeneralizedStress(void) const
   {
-    static Vector retval(1);
+    static thread_local Vector retval(1);
     std::cerr << "YS_Evolution::getGeneralizedStress not implemented." << std::endl;
     return retval;
   }
 const XC::Vector &XC::YS_Evolution::getGeneralizedStrain(void) const
   {
-    static Vector retval(1);
+    static thread_local Vector retval(1);
     std::cerr << "YS_Evolution::getGeneralizedStrain not implemented." << std::endl;
     return retval;
   }
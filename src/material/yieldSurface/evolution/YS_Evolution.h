@@ -60,7 +60,7 @@ class YS_Evolution: public TaggedObject, public MovableObject
     double isotropicRatio_orig,  isotropicRatio, isotropicRatio_shrink;
     double kinematicRatio_orig,  kinematicRatio, kinematicRatio_shrink;
     int    dimension;
-    static Vector crd1, crd2, crd3;
+    static thread_local Vector crd1, crd2, crd3;
   public:
     YS_Evolution(int tag, int classTag, double iso_ratio, double kin_ratio,
     			 int _dimension, double shr_iso=0.5, double shr_kin=0.5);
@@ -89,7 +89,7 @@ int XC::PlasticHardeningMaterial::revertToStart (void)
 //! @brief Returns the generalized stress value.
 const XC::Vector &XC::PlasticHardeningMaterial::getGeneralizedStress(void) const
   {
-    static Vector retval;
+    static thread_local Vector retval;
     std::cerr << "PlasticHardeningMaterial::getGeneralizedStress not implemented." << std::endl;
     return retval;
   }
@@ -97,7 +97,7 @@ const XC::Vector &XC::PlasticHardeningMaterial::getGeneralizedStress(void) const
 //! @brief Returns the generalized strain value.
 const XC::Vector &XC::PlasticHardeningMaterial::getGeneralizedStrain(void) const
   {
-    static Vector retval;
+    static thread_local Vector retval;
     std::cerr << getClassName() << "::" << __FUNCTION__
               << "; not implemented." << std::endl;
     return retval;
@@ -112,7 +112,7 @@ void XC::PlasticHardeningMaterial::setInitialGeneralizedStrain(const Vector &)
 //! @brief Adds to the initial strain.
 const XC::Vector &XC::PlasticHardeningMaterial::getInitialGeneralizedStrain(void) const
   {
-    static Vector retval;
+    static thread_local Vector retval;
     std::cerr << "PlasticHardeningMaterial::getInitialGeneralizedStrain not implemented." << std::endl;
     return retval;
   }
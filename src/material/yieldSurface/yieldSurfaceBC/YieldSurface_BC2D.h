@@ -61,13 +61,13 @@ class YieldSurface_BC2D: public YieldSurface_BC
     double fx_hist, fy_hist, gx_hist, gy_hist;
     double fx_trial, fy_trial, gx_trial, gy_trial;
 
-    static Vector v6;
+    static thread_local Vector v6;
     static double  error;
-    static Vector v2;
-    static Vector g2;
-    static Vector v4;
-    static Vector T2;
-    static Vector F2;
+    static thread_local Vector v2;
+    static thread_local Vector g2;
+    static thread_local Vector v4;
+    static thread_local Vector T2;
+    static thread_local Vector F2;
   public:
     YieldSurface_BC2D(int tag, int classTag, double xmax, double ymax,YS_Evolution &);
 
@@ -0,0 +1,65 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//CrackControlCheckKernel.cc
+
+#include "CrackControlCheckKernel.h"
+
+//! @brief Constructor.
+//!
+//! @param lbl: check identifier.
+XC::CrackControlCheckKernel::CrackControlCheckKernel(const std::string &lbl)
+  : LimitStateCheckKernel(lbl), negativeFace(false) {}
+
+//! @brief Assigns the crack control parameters of the section.
+//!
+//! @param sectionName: name of the section.
+//! @param b: section width.
+//! @param h: section depth.
+//! @param r: cover of the positive face rebars.
+//! @param rp: cover of the negative face rebars.
+//! @param As: area of the positive face rebars.
+//! @param Asp: area of the negative face rebars.
+//! @param Ec: elastic modulus of concrete.
+//! @param Es: elastic modulus of steel.
+//! @param limitStress: limit value of the rebar stress.
+void XC::CrackControlCheckKernel::setSectionParameters(const std::string &sectionName,const double &b,const double &h,const double &r,const double &rp,const double &As,const double &Asp,const double &Ec,const double &Es,const double &limitStress)
+  { parameters.set(sectionName,Parameters(RCRectangularSectionStresses(b,h,r,rp,As,Asp,Ec,Es),limitStress)); }
+
+//! @brief Returns the names of the auxiliary values.
+std::vector<std::string> XC::CrackControlCheckKernel::getAuxNames(void) const
+  { return std::vector<std::string>(1,"steelStress"); }
+
+//! @brief Makes the parameters reachable by section index.
+int XC::CrackControlCheckKernel::bind(const std::vector<std::string> &sectionNames)
+  { return parameters.bind(sectionNames,label); }
+
+//! @brief Returns the ratio between the rebar stress and its limit
+//! value and writes the rebar stress in aux.
+double XC::CrackControlCheckKernel::check(const size_t &iSection,const SectionInternalForces &f,const SectionInternalForces *,double *aux) const
+  {
+    const Parameters &p= parameters[iSection];
+    RCRectangularSectionStresses s(p.section);
+    s.solve(f.N,f.My);
+    const double sg= (negativeFace ? s.getSteelStressNeg() : s.getSteelStressPos());
+    aux[0]= sg;
+    return sg/p.limitStress;
+  }
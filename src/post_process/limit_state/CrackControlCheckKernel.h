@@ -0,0 +1,70 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//CrackControlCheckKernel.h
+
+#ifndef CrackControlCheckKernel_h
+#define CrackControlCheckKernel_h
+
+#include "LimitStateCheckKernel.h"
+#include "RCRectangularSectionStresses.h"
+
+namespace XC {
+
+//! @ingroup POST_PROCESS
+//
+//! @brief Crack control by limitation of the rebar stresses (SIA 262,
+//! same procedure as the CrackControlSIA262PlanB Python class).
+//!
+//! Each kernel checks one of the faces of the section, so the
+//! worst case of each face is obtained using two kernels.
+class CrackControlCheckKernel: public LimitStateCheckKernel
+  {
+  public:
+    //! @brief Crack control parameters of a section.
+    struct Parameters
+      {
+        RCRectangularSectionStresses section; //!< Section geometry and materials.
+        double limitStress; //!< Limit value of the rebar stress.
+        Parameters(const RCRectangularSectionStresses &s= RCRectangularSectionStresses(),const double &sg= 0.0)
+          : section(s), limitStress(sg) {}
+      };
+  private:
+    SectionParametersTable<Parameters> parameters; //!< Parameters for each section.
+    bool negativeFace; //!< If true check the negative face rebars.
+  public:
+    CrackControlCheckKernel(const std::string &);
+
+    void setSectionParameters(const std::string &,const double &,const double &,const double &,const double &,const double &,const double &,const double &,const double &,const double &);
+    //! @brief Returns true if the kernel checks the negative face rebars.
+    inline bool getNegativeFace(void) const
+      { return negativeFace; }
+    //! @brief Set the face whose rebars are checked.
+    inline void setNegativeFace(const bool &b)
+      { negativeFace= b; }
+    std::vector<std::string> getAuxNames(void) const;
+    int bind(const std::vector<std::string> &);
+    double check(const size_t &,const SectionInternalForces &,const SectionInternalForces *,double *) const;
+  };
+
+} // end of XC namespace
+
+#endif
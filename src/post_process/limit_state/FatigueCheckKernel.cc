@@ -0,0 +1,83 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//FatigueCheckKernel.cc
+
+#include "FatigueCheckKernel.h"
+#include <cmath>
+#include <algorithm>
+
+//! @brief Constructor.
+//!
+//! @param lbl: check identifier.
+XC::FatigueCheckKernel::FatigueCheckKernel(const std::string &lbl)
+  : LimitStateCheckKernel(lbl) {}
+
+//! @brief Assigns the fatigue parameters of the section.
+//!
+//! @param sectionName: name of the section.
+//! @param b: section width.
+//! @param h: section depth.
+//! @param r: cover of the positive face rebars.
+//! @param rp: cover of the negative face rebars.
+//! @param As: area of the positive face rebars.
+//! @param Asp: area of the negative face rebars.
+//! @param Ec: elastic modulus of concrete.
+//! @param Es: elastic modulus of steel.
+//! @param limitStressRange: limit value of the rebar stress range.
+void XC::FatigueCheckKernel::setSectionParameters(const std::string &sectionName,const double &b,const double &h,const double &r,const double &rp,const double &As,const double &Asp,const double &Ec,const double &Es,const double &limitStressRange)
+  { parameters.set(sectionName,Parameters(RCRectangularSectionStresses(b,h,r,rp,As,Asp,Ec,Es),limitStressRange)); }
+
+//! @brief Returns the name of the reference combination.
+std::string XC::FatigueCheckKernel::getReferenceCombination(void) const
+  { return referenceCombination; }
+
+//! @brief Returns the names of the auxiliary values.
+std::vector<std::string> XC::FatigueCheckKernel::getAuxNames(void) const
+  {
+    std::vector<std::string> retval(6);
+    retval[0]= "posSteelStress0"; retval[1]= "posSteelStress";
+    retval[2]= "negSteelStress0"; retval[3]= "negSteelStress";
+    retval[4]= "concreteStress0"; retval[5]= "concreteStress";
+    return retval;
+  }
+
+//! @brief Makes the parameters reachable by section index.
+int XC::FatigueCheckKernel::bind(const std::vector<std::string> &sectionNames)
+  { return parameters.bind(sectionNames,label); }
+
+//! @brief Returns the ratio between the maximum rebar stress range and
+//! its limit value and writes the stresses under the reference
+//! combination and under the checked one in aux.
+double XC::FatigueCheckKernel::check(const size_t &iSection,const SectionInternalForces &f,const SectionInternalForces *ref,double *aux) const
+  {
+    const Parameters &p= parameters[iSection];
+    RCRectangularSectionStresses s0(p.section);
+    if(ref)
+      s0.solve(ref->N,ref->My);
+    RCRectangularSectionStresses s1(p.section);
+    s1.solve(f.N,f.My);
+    aux[0]= s0.getSteelStressPos(); aux[1]= s1.getSteelStressPos();
+    aux[2]= s0.getSteelStressNeg(); aux[3]= s1.getSteelStressNeg();
+    aux[4]= s0.getConcreteStress(); aux[5]= s1.getConcreteStress();
+    const double dsg= std::max(std::abs(aux[1]-aux[0]),std::abs(aux[3]-aux[2]));
+    return dsg/p.limitStressRange;
+  }
@@ -0,0 +1,67 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//FatigueCheckKernel.h
+
+#ifndef FatigueCheckKernel_h
+#define FatigueCheckKernel_h
+
+#include "LimitStateCheckKernel.h"
+#include "RCRectangularSectionStresses.h"
+
+namespace XC {
+
+//! @ingroup POST_PROCESS
+//
+//! @brief Fatigue check of the rebars: ratio between the stress range
+//! (difference between the stresses under each combination and the
+//! ones under the reference combination, i.e. permanent loads) and
+//! its limit value.
+class FatigueCheckKernel: public LimitStateCheckKernel
+  {
+  public:
+    //! @brief Fatigue parameters of a section.
+    struct Parameters
+      {
+        RCRectangularSectionStresses section; //!< Section geometry and materials.
+        double limitStressRange; //!< Limit value of the rebar stress range.
+        Parameters(const RCRectangularSectionStresses &s= RCRectangularSectionStresses(),const double &dsg= 0.0)
+          : section(s), limitStressRange(dsg) {}
+      };
+  private:
+    SectionParametersTable<Parameters> parameters; //!< Parameters for each section.
+    std::string referenceCombination; //!< Name of the reference combination.
+  public:
+    FatigueCheckKernel(const std::string &);
+
+    void setSectionParameters(const std::string &,const double &,const double &,const double &,const double &,const double &,const double &,const double &,const double &,const double &);
+    std::string getReferenceCombination(void) const;
+    //! @brief Set the name of the reference combination.
+    inline void setReferenceCombination(const std::string &s)
+      { referenceCombination= s; }
+    std::vector<std::string> getAuxNames(void) const;
+    int bind(const std::vector<std::string> &);
+    double check(const size_t &,const SectionInternalForces &,const SectionInternalForces *,double *) const;
+  };
+
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,71 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//LimitStateCheckKernel.cc
+
+#include "LimitStateCheckKernel.h"
+
+//! @brief Returns the index of the component (0:N, 1:Vy, 2:Vz, 3:T,
+//! 4:My, 5:Mz) or -1 if the name is unknown.
+int XC::SectionInternalForces::getComponentIndex(const std::string &name)
+  {
+    int retval= -1;
+    if(name=="N")
+      retval= 0;
+    else if(name=="Vy")
+      retval= 1;
+    else if(name=="Vz")
+      retval= 2;
+    else if(name=="T")
+      retval= 3;
+    else if(name=="My")
+      retval= 4;
+    else if(name=="Mz")
+      retval= 5;
+    return retval;
+  }
+
+//! @brief Constructor.
+//!
+//! @param lbl: check identifier.
+XC::LimitStateCheckKernel::LimitStateCheckKernel(const std::string &lbl)
+  : EntCmd(), label(lbl) {}
+
+//! @brief Returns the names of the auxiliary values computed by the
+//! check (i.e. the ultimate shear force), stored along with the
+//! worst case.
+std::vector<std::string> XC::LimitStateCheckKernel::getAuxNames(void) const
+  { return std::vector<std::string>(); }
+
+//! @brief Returns the names of the auxiliary values.
+boost::python::list XC::LimitStateCheckKernel::getAuxNamesPy(void) const
+  {
+    boost::python::list retval;
+    const std::vector<std::string> names= getAuxNames();
+    for(std::vector<std::string>::const_iterator i= names.begin();i!=names.end();i++)
+      retval.append(*i);
+    return retval;
+  }
+
+//! @brief Returns the name of the combination whose internal forces
+//! are needed by the check (empty if none).
+std::string XC::LimitStateCheckKernel::getReferenceCombination(void) const
+  { return std::string(); }
@@ -0,0 +1,148 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//LimitStateCheckKernel.h
+
+#ifndef LimitStateCheckKernel_h
+#define LimitStateCheckKernel_h
+
+#include "xc_utils/src/nucleo/EntCmd.h"
+#include <boost/python/list.hpp>
+#include <map>
+#include <vector>
+#include <string>
+#include <iostream>
+
+namespace XC {
+
+//! @ingroup POST_PROCESS
+//
+//! @brief Internal forces on a cross section.
+struct SectionInternalForces
+  {
+    double N; //!< Axial force.
+    double Vy; //!< Shear force parallel to the y axis.
+    double Vz; //!< Shear force parallel to the z axis.
+    double T; //!< Torque.
+    double My; //!< Bending moment about the y axis.
+    double Mz; //!< Bending moment about the z axis.
+    SectionInternalForces(void)
+      : N(0.0), Vy(0.0), Vz(0.0), T(0.0), My(0.0), Mz(0.0) {}
+    static int getComponentIndex(const std::string &);
+    //! @brief Returns the i-th component (N,Vy,Vz,T,My,Mz).
+    inline const double &operator[](const size_t &i) const
+      { return (&N)[i]; }
+    //! @brief Returns the i-th component (N,Vy,Vz,T,My,Mz).
+    inline double &operator[](const size_t &i)
+      { return (&N)[i]; }
+  };
+
+//! @ingroup POST_PROCESS
+//
+//! @brief Parameters of a check for each section name.
+//!
+//! The parameters are assigned by section name and then bound to
+//! the section indexes used by the checker, so the kernels can
+//! reach them without any search while checking.
+template <class P>
+class SectionParametersTable
+  {
+    std::map<std::string,P> parameters; //!< Parameters for each section name.
+    std::vector<const P *> bound; //!< Parameters for each section index.
+  public:
+    //! @brief Assigns the parameters of the section.
+    inline void set(const std::string &sectionName,const P &p)
+      { parameters[sectionName]= p; }
+    //! @brief Returns true if the section has parameters.
+    inline bool exists(const std::string &sectionName) const
+      { return (parameters.find(sectionName)!=parameters.end()); }
+    //! @brief Returns the parameters of the section with the index
+    //! being passed as parameter.
+    inline const P &operator[](const size_t &iSection) const
+      { return *bound[iSection]; }
+    int bind(const std::vector<std::string> &,const std::string &);
+  };
+
+//! @brief Makes the parameters reachable by section index, returns the
+//! number of sections without parameters.
+//!
+//! @param sectionNames: section names ordered by index.
+//! @param label: label of the check (for the error messages).
+template <class P>
+int SectionParametersTable<P>::bind(const std::vector<std::string> &sectionNames,const std::string &label)
+  {
+    int retval= 0;
+    const size_t sz= sectionNames.size();
+    bound.assign(sz,nullptr);
+    for(size_t i= 0;i<sz;i++)
+      {
+        typename std::map<std::string,P>::const_iterator j= parameters.find(sectionNames[i]);
+        if(j!=parameters.end())
+          bound[i]= &(j->second);
+        else
+          {
+            std::cerr << "SectionParametersTable::" << __FUNCTION__
+                      << "; check: '" << label
+                      << "' has no parameters for section: '"
+                      << sectionNames[i] << "'." << std::endl;
+            retval++;
+          }
+      }
+    return retval;
+  }
+
+//! @ingroup POST_PROCESS
+//
+//! @brief Base class for the limit state check kernels.
+//!
+//! A kernel computes the capacity factor of a section from its
+//! internal forces (and, optionally, from the internal forces under
+//! a reference combination). It must not modify its state while
+//! checking, since it's called from several threads at once.
+class LimitStateCheckKernel: public EntCmd
+  {
+  protected:
+    std::string label; //!< Check identifier (i.e. "ULS_normalStressesResistance").
+  public:
+    LimitStateCheckKernel(const std::string &);
+    //! @brief Returns the check identifier.
+    inline const std::string &getLabel(void) const
+      { return label; }
+    virtual std::vector<std::string> getAuxNames(void) const;
+    boost::python::list getAuxNamesPy(void) const;
+    virtual std::string getReferenceCombination(void) const;
+    //! @brief Makes the section parameters reachable by the index
+    //! of the section, returns the number of sections without them.
+    virtual int bind(const std::vector<std::string> &)= 0;
+    //! @brief Returns the capacity factor of the section and
+    //! writes the auxiliary values (see getAuxNames) in aux.
+    //!
+    //! @param iSection: index of the section.
+    //! @param f: internal forces.
+    //! @param ref: internal forces under the reference combination
+    //!             (nullptr if the check doesn't use it).
+    //! @param aux: auxiliary values.
+    virtual double check(const size_t &iSection,const SectionInternalForces &f,const SectionInternalForces *ref,double *aux) const= 0;
+  };
+
+} // end of XC namespace
+
+#endif
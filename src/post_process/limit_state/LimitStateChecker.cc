@@ -0,0 +1,570 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//LimitStateChecker.cc
+
+#include "LimitStateChecker.h"
+#include "NormalStressesCheckKernel.h"
+#include "ShearCheckKernel.h"
+#include "CrackControlCheckKernel.h"
+#include "FatigueCheckKernel.h"
+#include "utility/recorder/ColumnarResultsReader.h"
+#include "utility/matrix/ID.h"
+#include "utility/matrix/Vector.h"
+#include "utility/run_blocks.h"
+#include <thread>
+#include <limits>
+
+//! @brief Resizes the containers (the capacity factors are initialized
+//! to -1).
+//!
+//! @param sz: number of element sections.
+//! @param nAux: number of auxiliary values of the check.
+void XC::LimitStateChecker::Results::resize(const size_t &sz,const size_t &nAux)
+  {
+    numAux= nAux;
+    CF.assign(sz,-1.0);
+    combs.assign(sz,-1);
+    forces.assign(sz,SectionInternalForces());
+    aux.assign(sz*nAux,0.0);
+  }
+
+//! @brief Constructor.
+//!
+//! @param nt: number of threads (if zero, the number of concurrent
+//! threads supported by the hardware).
+XC::LimitStateChecker::LimitStateChecker(const size_t &nt)
+  : EntCmd(), numUnassignedRows(0), nThreads(1), ready(false)
+  { setNumThreads(nt); }
+
+//! @brief Destructor.
+XC::LimitStateChecker::~LimitStateChecker(void)
+  { free_mem(); }
+
+//! @brief Deletes the kernels.
+void XC::LimitStateChecker::free_mem(void)
+  {
+    for(std::deque<LimitStateCheckKernel *>::iterator i= kernels.begin();i!=kernels.end();i++)
+      delete *i;
+    kernels.clear();
+  }
+
+//! @brief Set the number of threads used to check (if zero, the
+//! number of concurrent threads supported by the hardware).
+void XC::LimitStateChecker::setNumThreads(const size_t &nt)
+  {
+    nThreads= nt;
+    if(nThreads==0)
+      nThreads= std::max(1U,std::thread::hardware_concurrency());
+  }
+
+//! @brief Returns the index of the section (creating it if needed).
+size_t XC::LimitStateChecker::get_section_index(const std::string &sectionName)
+  {
+    std::map<std::string,size_t>::const_iterator i= sectionIndexes.find(sectionName);
+    if(i!=sectionIndexes.end())
+      return i->second;
+    const size_t retval= sectionNames.size();
+    sectionNames.push_back(sectionName);
+    sectionIndexes[sectionName]= retval;
+    return retval;
+  }
+
+//! @brief Assigns a section to an element.
+//!
+//! @param tag: element identifier.
+//! @param iSection: index of the section in the element (0: first
+//!                  section, 1: second section,...).
+//! @param sectionName: name of the section.
+void XC::LimitStateChecker::setElementSection(const int &tag,const int &iSection,const std::string &sectionName)
+  {
+    sectionTable[element_section(tag,iSection)]= get_section_index(sectionName);
+    clearResults();
+  }
+
+//! @brief Assigns a section to the elements.
+//!
+//! @param tags: element identifiers.
+//! @param iSection: index of the section in the elements.
+//! @param sectionName: name of the section.
+void XC::LimitStateChecker::setElementSections(const ID &tags,const int &iSection,const std::string &sectionName)
+  {
+    const size_t iSec= get_section_index(sectionName);
+    const int sz= tags.Size();
+    for(int i= 0;i<sz;i++)
+      sectionTable[element_section(tags(i),iSection)]= iSec;
+    clearResults();
+  }
+
+//! @brief Returns the number of different sections.
+size_t XC::LimitStateChecker::getNumSections(void) const
+  { return sectionNames.size(); }
+
+//! @brief Returns the index of the kernel with the label being passed
+//! as parameter (-1 if not found).
+int XC::LimitStateChecker::get_kernel_index(const std::string &label) const
+  {
+    const size_t sz= kernels.size();
+    for(size_t i= 0;i<sz;i++)
+      if(kernels[i]->getLabel()==label)
+        return i;
+    return -1;
+  }
+
+//! @brief Defines a new check.
+//!
+//! @param type: type of the check (normal_stresses, shear_sia262,
+//!              crack_control or fatigue_stress_range).
+//! @param label: check identifier (i.e. "ULS_normalStressesResistance").
+XC::LimitStateCheckKernel &XC::LimitStateChecker::newCheck(const std::string &type,const std::string &label)
+  {
+    const int i= get_kernel_index(label);
+    if(i>=0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; check: '" << label
+                  << "' already exists." << std::endl;
+        return *kernels[i];
+      }
+    LimitStateCheckKernel *retval= nullptr;
+    if(type=="normal_stresses")
+      retval= new NormalStressesCheckKernel(label);
+    else if(type=="shear_sia262")
+      retval= new ShearCheckKernel(label);
+    else if(type=="crack_control")
+      retval= new CrackControlCheckKernel(label);
+    else if(type=="fatigue_stress_range")
+      retval= new FatigueCheckKernel(label);
+    else
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; check type: '" << type
+                  << "' unknown, using normal_stresses." << std::endl;
+        retval= new NormalStressesCheckKernel(label);
+      }
+    kernels.push_back(retval);
+    clearResults();
+    return *retval;
+  }
+
+//! @brief Returns the check with the label being passed as parameter.
+XC::LimitStateCheckKernel &XC::LimitStateChecker::getCheck(const std::string &label)
+  {
+    const int i= get_kernel_index(label);
+    if(i<0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; check: '" << label
+                  << "' not found." << std::endl;
+        exit(-1);
+      }
+    return *kernels[i];
+  }
+
+//! @brief Returns the labels of the checks.
+boost::python::list XC::LimitStateChecker::getCheckLabels(void) const
+  {
+    boost::python::list retval;
+    for(std::deque<LimitStateCheckKernel *>::const_iterator i= kernels.begin();i!=kernels.end();i++)
+      retval.append((*i)->getLabel());
+    return retval;
+  }
+
+//! @brief Removes the results, the next check will rebuild
+//! the tables (and bind the section parameters of the checks).
+void XC::LimitStateChecker::clearResults(void)
+  {
+    ready= false;
+    slots.clear();
+    slotSections.clear();
+    results.clear();
+    referenceForces.clear();
+    combinationNames.clear();
+    numUnassignedRows= 0;
+  }
+
+//! @brief Sets up the tables used to check.
+int XC::LimitStateChecker::setup(void)
+  {
+    if(ready)
+      return 0;
+    int retval= 0;
+    slots.clear();
+    slotSections.clear();
+    slots.reserve(sectionTable.size());
+    slotSections.reserve(sectionTable.size());
+    for(std::map<element_section,size_t>::const_iterator i= sectionTable.begin();i!=sectionTable.end();i++)
+      {
+        slots.push_back(i->first);
+        slotSections.push_back(i->second);
+      }
+    const size_t nk= kernels.size();
+    results.resize(nk);
+    for(size_t k= 0;k<nk;k++)
+      {
+        if(kernels[k]->bind(sectionNames)!=0)
+          retval= -1;
+        results[k].resize(slots.size(),kernels[k]->getAuxNames().size());
+      }
+    if(retval==0)
+      ready= true;
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; parameters missing, can't check." << std::endl;
+    return retval;
+  }
+
+//! @brief Returns the index of the combination (adding it if needed).
+int XC::LimitStateChecker::get_combination_index(const std::string &comb)
+  {
+    const size_t sz= combinationNames.size();
+    for(size_t i= 0;i<sz;i++)
+      if(combinationNames[i]==comb)
+        return i;
+    combinationNames.push_back(comb);
+    return sz;
+  }
+
+//! @brief Checks the internal forces obtained for a combination and
+//! updates the worst cases.
+//!
+//! @param comb: name of the combination.
+//! @param tags: element identifiers.
+//! @param sects: section indexes.
+//! @param cols: internal forces columns (N, Vy, Vz, T, My, Mz).
+//! @param n: number of rows.
+int XC::LimitStateChecker::check(const std::string &comb,const int32_t *tags,const int32_t *sects,const double *const *cols,const size_t &n)
+  {
+    if(setup()!=0)
+      return -1;
+    const size_t npos= std::numeric_limits<size_t>::max();
+    const int iComb= get_combination_index(comb);
+
+    // Element section of each row.
+    std::vector<size_t> rowSlots(n,npos);
+    std::map<element_section,size_t> slotIndexes;
+    for(size_t i= 0;i<slots.size();i++)
+      slotIndexes[slots[i]]= i;
+    auto find_slots= [&](const size_t &begin,const size_t &end)
+      {
+        for(size_t i= begin;i<end;i++)
+          {
+            std::map<element_section,size_t>::const_iterator j= slotIndexes.find(element_section(tags[i],sects[i]));
+            if(j!=slotIndexes.end())
+              rowSlots[i]= j->second;
+          }
+      };
+    run_blocks(find_slots,n,nThreads);
+    for(size_t i= 0;i<n;i++)
+      if(rowSlots[i]==npos)
+        numUnassignedRows++;
+
+    // Store the internal forces of the reference combinations.
+    const size_t nk= kernels.size();
+    std::vector<const forces_vector *> refs(nk,nullptr);
+    std::vector<bool> skip(nk,false);
+    for(size_t k= 0;k<nk;k++)
+      {
+        const std::string refComb= kernels[k]->getReferenceCombination();
+        if(refComb.empty())
+          continue;
+        if(refComb==comb)
+          {
+            forces_vector &ref= referenceForces[comb];
+            ref.resize(slots.size());
+            for(size_t i= 0;i<n;i++)
+              if(rowSlots[i]!=npos)
+                for(size_t c= 0;c<6;c++)
+                  ref[rowSlots[i]][c]= cols[c][i];
+          }
+        std::map<std::string,forces_vector>::const_iterator j= referenceForces.find(refComb);
+        if(j!=referenceForces.end())
+          refs[k]= &(j->second);
+        else
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; reference combination: '" << refComb
+                      << "' of check: '" << kernels[k]->getLabel()
+                      << "' not checked yet, combination: '"
+                      << comb << "' ignored." << std::endl;
+            skip[k]= true;
+          }
+      }
+
+    // Capacity factors.
+    std::vector<std::vector<double> > cf(nk);
+    std::vector<std::vector<double> > aux(nk);
+    for(size_t k= 0;k<nk;k++)
+      {
+        cf[k].assign(n,-1.0);
+        aux[k].assign(n*results[k].numAux,0.0);
+      }
+    auto check_rows= [&](const size_t &begin,const size_t &end)
+      {
+        SectionInternalForces f;
+        for(size_t i= begin;i<end;i++)
+          {
+            const size_t slot= rowSlots[i];
+            if(slot==npos)
+              continue;
+            for(size_t c= 0;c<6;c++)
+              f[c]= cols[c][i];
+            const size_t iSection= slotSections[slot];
+            for(size_t k= 0;k<nk;k++)
+              if(!skip[k])
+                {
+                  const SectionInternalForces *ref= (refs[k] ? &(*refs[k])[slot] : nullptr);
+                  cf[k][i]= kernels[k]->check(iSection,f,ref,&aux[k][i*results[k].numAux]);
+                }
+          }
+      };
+    run_blocks(check_rows,n,nThreads);
+
+    // Worst cases.
+    for(size_t k= 0;k<nk;k++)
+      {
+        Results &r= results[k];
+        for(size_t i= 0;i<n;i++)
+          {
+            const size_t slot= rowSlots[i];
+            if((slot!=npos) && (cf[k][i]>r.CF[slot]))
+              {
+                r.CF[slot]= cf[k][i];
+                r.combs[slot]= iComb;
+                for(size_t c= 0;c<6;c++)
+                  r.forces[slot][c]= cols[c][i];
+                std::copy(aux[k].begin()+i*r.numAux,aux[k].begin()+(i+1)*r.numAux,r.aux.begin()+slot*r.numAux);
+              }
+          }
+      }
+    return 0;
+  }
+
+//! @brief Checks the internal forces obtained for a combination.
+//!
+//! @param comb: name of the combination.
+//! @param tags: element identifiers.
+//! @param sects: section indexes.
+//! @param N: axial forces.
+//! @param Vy: shear forces parallel to the y axis.
+//! @param Vz: shear forces parallel to the z axis.
+//! @param T: torques.
+//! @param My: bending moments about the y axis.
+//! @param Mz: bending moments about the z axis.
+int XC::LimitStateChecker::checkInternalForces(const std::string &comb,const ID &tags,const ID &sects,const Vector &N,const Vector &Vy,const Vector &Vz,const Vector &T,const Vector &My,const Vector &Mz)
+  {
+    const int n= tags.Size();
+    if((sects.Size()!=n) || (N.Size()!=n) || (Vy.Size()!=n) || (Vz.Size()!=n) || (T.Size()!=n) || (My.Size()!=n) || (Mz.Size()!=n))
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; sizes don't match." << std::endl;
+        return -1;
+      }
+    const std::vector<int32_t> t(tags.begin(),tags.end());
+    const std::vector<int32_t> s(sects.begin(),sects.end());
+    const double *cols[6]= {N.getDataPtr(),Vy.getDataPtr(),Vz.getDataPtr(),T.getDataPtr(),My.getDataPtr(),Mz.getDataPtr()};
+    return check(comb,t.data(),s.data(),cols,n);
+  }
+
+//! @brief Checks the internal forces stored in a columnar results file
+//! (see ElementForcesColumnarRecorder). The reference combinations
+//! are processed first.
+int XC::LimitStateChecker::checkFile(const std::string &fileName)
+  {
+    ColumnarResultsReader reader(fileName);
+    if(!reader.isOpen())
+      return -1;
+    std::vector<std::string> chunks= reader.getChunkNames();
+    std::deque<std::string> ordered;
+    for(std::vector<std::string>::const_iterator i= chunks.begin();i!=chunks.end();i++)
+      {
+        bool isReference= false;
+        for(std::deque<LimitStateCheckKernel *>::const_iterator k= kernels.begin();k!=kernels.end();k++)
+          if((*k)->getReferenceCombination()==*i)
+            isReference= true;
+        if(isReference)
+          ordered.push_front(*i);
+        else
+          ordered.push_back(*i);
+      }
+    static const char *colNames[6]= {"N","Vy","Vz","T","My","Mz"};
+    int retval= 0;
+    for(std::deque<std::string>::const_iterator i= ordered.begin();i!=ordered.end();i++)
+      {
+        const int32_t *tags= reader.getIntColumnPtr(*i,"Elem");
+        const int32_t *sects= reader.getIntColumnPtr(*i,"Sect");
+        const double *cols[6];
+        bool ok= (tags && sects);
+        for(size_t c= 0;c<6;c++)
+          {
+            cols[c]= reader.getDoubleColumnPtr(*i,colNames[c]);
+            ok= ok && cols[c];
+          }
+        if(!ok)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; file: '" << fileName
+                      << "' doesn't contain internal forces." << std::endl;
+            return -1;
+          }
+        retval= check(*i,tags,sects,cols,reader.getNumRows(*i));
+        if(retval!=0)
+          break;
+      }
+    return retval;
+  }
+
+//! @brief Returns the tags of the checked elements (an item for each
+//! element section).
+XC::ID XC::LimitStateChecker::getElementTags(void) const
+  {
+    const size_t sz= sectionTable.size();
+    ID retval(sz);
+    size_t j= 0;
+    for(std::map<element_section,size_t>::const_iterator i= sectionTable.begin();i!=sectionTable.end();i++,j++)
+      retval[j]= i->first.first;
+    return retval;
+  }
+
+//! @brief Returns the indexes of the checked element sections.
+XC::ID XC::LimitStateChecker::getSectionIndexes(void) const
+  {
+    const size_t sz= sectionTable.size();
+    ID retval(sz);
+    size_t j= 0;
+    for(std::map<element_section,size_t>::const_iterator i= sectionTable.begin();i!=sectionTable.end();i++,j++)
+      retval[j]= i->first.second;
+    return retval;
+  }
+
+//! @brief Returns the names of the sections assigned to the checked
+//! element sections.
+boost::python::list XC::LimitStateChecker::getSectionNames(void) const
+  {
+    boost::python::list retval;
+    for(std::map<element_section,size_t>::const_iterator i= sectionTable.begin();i!=sectionTable.end();i++)
+      retval.append(sectionNames[i->second]);
+    return retval;
+  }
+
+//! @brief Returns the results of the check (nullptr if there are no
+//! results yet).
+const XC::LimitStateChecker::Results *XC::LimitStateChecker::get_results(const std::string &label) const
+  {
+    const int k= get_kernel_index(label);
+    if(k<0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; check: '" << label
+                  << "' not found." << std::endl;
+        return nullptr;
+      }
+    if(!ready)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; nothing checked yet." << std::endl;
+        return nullptr;
+      }
+    return &results[k];
+  }
+
+//! @brief Returns the worst capacity factors of the check for each
+//! element section (-1 if not checked).
+XC::Vector XC::LimitStateChecker::getCapacityFactors(const std::string &label) const
+  {
+    Vector retval;
+    const Results *r= get_results(label);
+    if(r)
+      {
+        const size_t sz= r->CF.size();
+        retval.resize(sz);
+        for(size_t i= 0;i<sz;i++)
+          retval[i]= r->CF[i];
+      }
+    return retval;
+  }
+
+//! @brief Returns the governing combinations of the check for each
+//! element section ("nil" if not checked).
+boost::python::list XC::LimitStateChecker::getGoverningCombinations(const std::string &label) const
+  {
+    boost::python::list retval;
+    const Results *r= get_results(label);
+    if(r)
+      for(std::vector<int>::const_iterator i= r->combs.begin();i!=r->combs.end();i++)
+        {
+          if(*i>=0)
+            retval.append(combinationNames[*i]);
+          else
+            retval.append(std::string("nil"));
+        }
+    return retval;
+  }
+
+//! @brief Returns a component (N, Vy, Vz, T, My or Mz) of the internal
+//! forces under the governing combinations.
+XC::Vector XC::LimitStateChecker::getInternalForces(const std::string &label,const std::string &component) const
+  {
+    Vector retval;
+    const int c= SectionInternalForces::getComponentIndex(component);
+    if(c<0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; unknown component: '" << component
+                  << "'." << std::endl;
+        return retval;
+      }
+    const Results *r= get_results(label);
+    if(r)
+      {
+        const size_t sz= r->forces.size();
+        retval.resize(sz);
+        for(size_t i= 0;i<sz;i++)
+          retval[i]= r->forces[i][c];
+      }
+    return retval;
+  }
+
+//! @brief Returns an auxiliary value of the check (i.e. Vu for the shear
+//! check) under the governing combinations.
+XC::Vector XC::LimitStateChecker::getAuxValues(const std::string &label,const std::string &name) const
+  {
+    Vector retval;
+    const Results *r= get_results(label);
+    if(r)
+      {
+        const std::vector<std::string> names= kernels[get_kernel_index(label)]->getAuxNames();
+        const std::vector<std::string>::const_iterator j= std::find(names.begin(),names.end(),name);
+        if(j==names.end())
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; check: '" << label
+                      << "' has no value: '" << name << "'." << std::endl;
+            return retval;
+          }
+        const size_t ia= j-names.begin();
+        const size_t sz= r->CF.size();
+        retval.resize(sz);
+        for(size_t i= 0;i<sz;i++)
+          retval[i]= r->aux[i*r->numAux+ia];
+      }
+    return retval;
+  }
@@ -0,0 +1,123 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//LimitStateChecker.h
+
+#ifndef LimitStateChecker_h
+#define LimitStateChecker_h
+
+#include "xc_utils/src/nucleo/EntCmd.h"
+#include "LimitStateCheckKernel.h"
+#include <boost/python/list.hpp>
+#include <deque>
+
+namespace XC {
+class ID;
+class Vector;
+
+//! @ingroup POST_PROCESS
+//
+//! @brief Checks the limit states of the element sections from the
+//! internal forces obtained for each combination, keeping the worst
+//! case (and the governing combination) of each check.
+//!
+//! The sections are assigned to the elements through a table (element
+//! tag, section index) -> section name and the checks are done by
+//! the kernels defined with newCheck. The internal forces are
+//! processed in bulk (a combination at a time) using several
+//! threads, so no phantom model is needed.
+class LimitStateChecker: public EntCmd
+  {
+  public:
+    typedef std::pair<int,int> element_section; //!< (element tag, section index).
+  private:
+    //! @brief Worst case of a check for each element section.
+    struct Results
+      {
+        std::vector<double> CF; //!< Capacity factors.
+        std::vector<int> combs; //!< Index of the governing combinations.
+        std::vector<SectionInternalForces> forces; //!< Internal forces under the governing combinations.
+        std::vector<double> aux; //!< Auxiliary values (numAux per section).
+        size_t numAux; //!< Number of auxiliary values.
+        void resize(const size_t &,const size_t &);
+      };
+    typedef std::vector<SectionInternalForces> forces_vector;
+
+    std::vector<std::string> sectionNames; //!< Names of the sections.
+    std::map<std::string,size_t> sectionIndexes; //!< Section name -> index.
+    std::map<element_section,size_t> sectionTable; //!< Section assigned to each element section.
+    std::deque<LimitStateCheckKernel *> kernels; //!< Checks.
+    std::vector<std::string> combinationNames; //!< Names of the processed combinations.
+
+    std::vector<element_section> slots; //!< Checked element sections.
+    std::vector<size_t> slotSections; //!< Section index of each slot.
+    std::vector<Results> results; //!< Worst case for each kernel.
+    std::map<std::string,forces_vector> referenceForces; //!< Internal forces under the reference combinations.
+    size_t numUnassignedRows; //!< Number of rows without assigned section.
+    size_t nThreads; //!< Number of threads.
+    bool ready; //!< True if the tables are set up.
+
+    void free_mem(void);
+    size_t get_section_index(const std::string &);
+    int get_combination_index(const std::string &);
+    int setup(void);
+    int get_kernel_index(const std::string &) const;
+    const Results *get_results(const std::string &) const;
+    LimitStateChecker(const LimitStateChecker &);
+    LimitStateChecker &operator=(const LimitStateChecker &);
+  public:
+    LimitStateChecker(const size_t &nThreads= 0);
+    ~LimitStateChecker(void);
+
+    //! @brief Returns the number of threads used to check.
+    inline size_t getNumThreads(void) const
+      { return nThreads; }
+    void setNumThreads(const size_t &);
+
+    void setElementSection(const int &,const int &,const std::string &);
+    void setElementSections(const ID &,const int &,const std::string &);
+    size_t getNumSections(void) const;
+
+    LimitStateCheckKernel &newCheck(const std::string &,const std::string &);
+    LimitStateCheckKernel &getCheck(const std::string &);
+    boost::python::list getCheckLabels(void) const;
+
+    void clearResults(void);
+    int check(const std::string &,const int32_t *,const int32_t *,const double *const *,const size_t &);
+    int checkInternalForces(const std::string &,const ID &,const ID &,const Vector &,const Vector &,const Vector &,const Vector &,const Vector &,const Vector &);
+    int checkFile(const std::string &);
+    //! @brief Returns the number of rows whose element section
+    //! has no assigned section.
+    inline size_t getNumUnassignedRows(void) const
+      { return numUnassignedRows; }
+
+    ID getElementTags(void) const;
+    ID getSectionIndexes(void) const;
+    boost::python::list getSectionNames(void) const;
+    Vector getCapacityFactors(const std::string &) const;
+    boost::python::list getGoverningCombinations(const std::string &) const;
+    Vector getInternalForces(const std::string &,const std::string &) const;
+    Vector getAuxValues(const std::string &,const std::string &) const;
+  };
+
+} // end of XC namespace
+
+#endif
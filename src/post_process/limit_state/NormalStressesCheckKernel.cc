@@ -0,0 +1,64 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//NormalStressesCheckKernel.cc
+
+#include "NormalStressesCheckKernel.h"
+
+//! @brief Constructor.
+//!
+//! @param lbl: check identifier.
+XC::NormalStressesCheckKernel::NormalStressesCheckKernel(const std::string &lbl)
+  : LimitStateCheckKernel(lbl) {}
+
+//! @brief Assigns the (biaxial bending) interaction diagram of the section.
+void XC::NormalStressesCheckKernel::setInteractionDiagram(const std::string &sectionName,const InteractionDiagram &diag)
+  {
+    Diagrams d;
+    d.biaxial= true;
+    d.diag3d= diag;
+    diagrams.set(sectionName,d);
+  }
+
+//! @brief Assigns the (uniaxial bending) interaction diagram of the section.
+void XC::NormalStressesCheckKernel::setInteractionDiagram2d(const std::string &sectionName,const InteractionDiagram2d &diag)
+  {
+    Diagrams d;
+    d.diag2d= diag;
+    d.index2d= DiagramEdgeIndex(diag);
+    diagrams.set(sectionName,d);
+  }
+
+//! @brief Makes the diagrams reachable by section index.
+int XC::NormalStressesCheckKernel::bind(const std::vector<std::string> &sectionNames)
+  { return diagrams.bind(sectionNames,label); }
+
+//! @brief Returns the capacity factor of the internal forces.
+double XC::NormalStressesCheckKernel::check(const size_t &iSection,const SectionInternalForces &f,const SectionInternalForces *,double *) const
+  {
+    const Diagrams &d= diagrams[iSection];
+    double retval= -1.0;
+    if(d.biaxial)
+      retval= d.diag3d.get_capacity_factor(f.N,f.My,f.Mz);
+    else
+      retval= d.diag2d.get_capacity_factor(d.index2d,f.N,f.My);
+    return retval;
+  }
@@ -0,0 +1,68 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//NormalStressesCheckKernel.h
+
+#ifndef NormalStressesCheckKernel_h
+#define NormalStressesCheckKernel_h
+
+#include "LimitStateCheckKernel.h"
+#include "material/section/interaction_diagram/InteractionDiagram.h"
+#include "material/section/interaction_diagram/InteractionDiagram2d.h"
+
+namespace XC {
+
+//! @ingroup POST_PROCESS
+//
+//! @brief Normal stresses check: capacity factor of the point (N,My,Mz)
+//! (biaxial bending) or (N,My) (uniaxial bending) with respect to the
+//! interaction diagram of the section.
+//!
+//! The kernel stores a copy of the diagrams (the objects passed from
+//! Python can be destroyed before the check runs) and computes the
+//! capacity factors with their fast paths (angular grid of the
+//! trihedrons for the biaxial diagrams, angular edge index for the
+//! uniaxial ones).
+class NormalStressesCheckKernel: public LimitStateCheckKernel
+  {
+    //! @brief Interaction diagram of a section.
+    struct Diagrams
+      {
+        bool biaxial; //!< True if the section uses the biaxial bending diagram.
+        InteractionDiagram diag3d; //!< Biaxial bending diagram.
+        InteractionDiagram2d diag2d; //!< Uniaxial bending diagram.
+        DiagramEdgeIndex index2d; //!< Edge index of the uniaxial bending diagram.
+        Diagrams(void)
+          : biaxial(false) {}
+      };
+    SectionParametersTable<Diagrams> diagrams; //!< Interaction diagram for each section.
+  public:
+    NormalStressesCheckKernel(const std::string &);
+
+    void setInteractionDiagram(const std::string &,const InteractionDiagram &);
+    void setInteractionDiagram2d(const std::string &,const InteractionDiagram2d &);
+    int bind(const std::vector<std::string> &);
+    double check(const size_t &,const SectionInternalForces &,const SectionInternalForces *,double *) const;
+  };
+
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,222 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//RCRectangularSectionStresses.cc
+
+#include "RCRectangularSectionStresses.h"
+#include <cmath>
+#include <algorithm>
+
+//! @brief Constructor.
+//!
+//! @param _b: section width.
+//! @param _h: section depth.
+//! @param _r: cover of the positive face rebars.
+//! @param _rp: cover of the negative face rebars.
+//! @param _As: area of the positive face rebars.
+//! @param _Asp: area of the negative face rebars.
+//! @param _Ec: elastic modulus of concrete.
+//! @param _Es: elastic modulus of steel.
+XC::RCRectangularSectionStresses::RCRectangularSectionStresses(const double &_b,const double &_h,const double &_r,const double &_rp,const double &_As,const double &_Asp,const double &_Ec,const double &_Es)
+  : b(_b), h(_h), r(_r), rp(_rp), As(_As), Asp(_Asp), Ec(_Ec), Es(_Es),
+    N(0.0), M(0.0), sgc(0.0), sgc0(0.0), xx(0.0), sgs(0.0), sgsp(0.0) {}
+
+//! @brief Interchanges the positive and negative faces.
+void XC::RCRectangularSectionStresses::swap(void)
+  {
+    std::swap(As,Asp);
+    std::swap(r,rp);
+    std::swap(sgs,sgsp);
+    M= -M;
+  }
+
+//! @brief Returns the moment of inertia of the rebars with respect
+//! to the middle axis.
+double XC::RCRectangularSectionStresses::totIs(void) const
+  {
+    const double ys= h/2.0-r;
+    const double ysp= h/2.0-rp;
+    return As*ys*ys+Asp*ysp*ysp;
+  }
+
+//! @brief Returns the position of the centroid of the rebars.
+double XC::RCRectangularSectionStresses::getYCentroidAs(void) const
+  { return (As*getYs()+Asp*getYsp())/(As+Asp); }
+
+//! @brief Returns the area of the homogenized section.
+double XC::RCRectangularSectionStresses::getAh(void) const
+  { return totAs()*Es/Ec+Ac(); }
+
+//! @brief Returns the position of the centroid of the homogenized section.
+double XC::RCRectangularSectionStresses::getYCentroidAh(void) const
+  {
+    const double n= Es/Ec;
+    return n*(As*getYs()+Asp*getYsp())/(n*(As+Asp)+Ac());
+  }
+
+//! @brief Returns the moment of inertia of the homogenized section.
+double XC::RCRectangularSectionStresses::getIh(void) const
+  {
+    const double n= Es/Ec;
+    const double y= getYCentroidAs();
+    return totIs()*n+totAs()*y*y+Ic();
+  }
+
+//! @brief Returns the depth of the neutral axis of the homogenized
+//! section.
+double XC::RCRectangularSectionStresses::xElasticNeutralAxis(void) const
+  {
+    if(M==0.0) //No bending, the neutral axis is "at infinity".
+      return 10.0*h;
+    const double y= -N*getIh()/(M*getAh());
+    return h/2.0+y;
+  }
+
+//! @brief Returns the stress in the positive face rebars (homogenized
+//! section).
+double XC::RCRectangularSectionStresses::elasticStressAs(void) const
+  { return Es/Ec*(N/getAh()+M/getIh()*(getYs()-getYCentroidAh())); }
+
+//! @brief Returns the stress in the negative face rebars (homogenized
+//! section).
+double XC::RCRectangularSectionStresses::elasticStressAsp(void) const
+  { return Es/Ec*(N/getAh()+M/getIh()*(getYsp()-getYCentroidAh())); }
+
+//! @brief Returns the stress in the concrete fiber of the negative
+//! face (homogenized section).
+double XC::RCRectangularSectionStresses::elasticStressAc(void) const
+  { return N/getAh()+M/getIh()*(getYCentroidAh()-h/2.0); }
+
+//! @brief Returns the stress in the concrete fiber of the positive
+//! face (homogenized section).
+double XC::RCRectangularSectionStresses::elasticStressAc0(void) const
+  { return N/getAh()+M/getIh()*(h/2.0-getYCentroidAh()); }
+
+//! @brief Returns true if both rebar rows are tensioned.
+bool XC::RCRectangularSectionStresses::inTraction(void) const
+  { return ((elasticStressAs()>0.0) && (elasticStressAsp()>0.0)); }
+
+//! @brief Returns true if both rebar rows are compressed.
+bool XC::RCRectangularSectionStresses::inCompression(void) const
+  { return ((elasticStressAs()<0.0) && (elasticStressAsp()<0.0)); }
+
+//! @brief Average of the elastic (uncracked) solution and the simple
+//! bending approximation (positive bending moment).
+void XC::RCRectangularSectionStresses::cracked_bending(void)
+  {
+    const double xx1= xElasticNeutralAxis();
+    const double sgc1= elasticStressAc();
+    const double sgs1= elasticStressAs();
+    const double sgsp1= elasticStressAsp();
+    const double d= h-r;
+    const double xx2= 0.6*d;
+    const double sgs2= (As>0.0 ? M/(0.8*As*d) : 0.0);
+    const double Ns2= As*sgs2;
+    const double sgc2= -2*Ec*Ns2*xx2/(b*Ec*xx2*xx2+2*Asp*Es*xx2-2*Asp*Es*rp);
+    const double sgsp2= sgc2*Es*(xx2-rp)/(Ec*xx2);
+    xx= (xx1+xx2)/2.0;
+    sgc= (sgc1+sgc2)/2.0;
+    sgs= (sgs1+sgs2)/2.0;
+    sgsp= (sgsp1+sgsp2)/2.0;
+  }
+
+//! @brief Computes the stresses for the internal forces being passed
+//! as parameters.
+//!
+//! @param _N: axial force.
+//! @param _M: bending moment.
+void XC::RCRectangularSectionStresses::solve(const double &_N,const double &_M)
+  {
+    N= _N;
+    M= _M;
+    sgc0= 0.0;
+    if(inTraction())
+      {
+        if(totAs()!=0.0)
+          {
+            const double ys= getYs();
+            const double ysp= getYsp();
+            if(Asp!=0.0)
+              {
+                sgsp= (M-N*ys)/(ysp-ys)/Asp;
+                sgs= (As!=0.0 ? (N-sgsp*Asp)/As : 0.0);
+              }
+            else
+              {
+                sgsp= 0.0;
+                sgs= N/As;
+              }
+            sgc= 0.0;
+          }
+      }
+    else if(inCompression())
+      {
+        xx= 10*h;
+        sgs= elasticStressAs();
+        sgsp= elasticStressAsp();
+        sgc= elasticStressAc();
+        sgc0= elasticStressAc0();
+      }
+    else if(std::abs(N)<1e-3) //Simple bending.
+      {
+        if(M>0)
+          {
+            const double d= h-r;
+            xx= 0.6*d;
+            sgs= (As>0.0 ? M/(0.8*As*d) : 0.0);
+            const double Ns= As*sgs;
+            sgc= -2*Ec*Ns*xx/(b*Ec*xx*xx+2*Asp*Es*xx-2*Asp*Es*rp);
+            sgsp= sgc*Es*(xx-rp)/(Ec*xx);
+          }
+        else
+          {
+            const double d= h-rp;
+            const double ds= h-r;
+            xx= 0.6*d;
+            sgsp= (Asp>0.0 ? -M/(0.8*Asp*0.9*h) : 0.0);
+            const double Nsp= Asp*sgsp;
+            sgc= -2*Ec*Nsp*xx/(b*Ec*xx*xx+2*As*Es*xx-2*As*Es*r);
+            sgs= sgc*Es*(ds-xx)/(Ec*xx);
+          }
+      }
+    else //Combined bending.
+      {
+        const double sg1= N/Ac()+M/Ic()*h/2;
+        const double sg2= N/Ac()-M/Ic()*h/2;
+        const double mx= std::max(std::abs(sg1),std::abs(sg2));
+        if(mx<=1e6)
+          {
+            sgc= elasticStressAc();
+            sgc0= elasticStressAc0();
+            sgs= elasticStressAs();
+            sgsp= elasticStressAsp();
+            xx= xElasticNeutralAxis();
+          }
+        else if(M>=0)
+          cracked_bending();
+        else
+          {
+            swap();
+            cracked_bending();
+            swap();
+          }
+      }
+  }
@@ -0,0 +1,109 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//RCRectangularSectionStresses.h
+
+#ifndef RCRectangularSectionStresses_h
+#define RCRectangularSectionStresses_h
+
+namespace XC {
+
+//! @ingroup POST_PROCESS
+//
+//! @brief Approximate stresses in a rectangular reinforced concrete
+//! section with a row of rebars on each face, under axial force and
+//! uniaxial bending (C++ version of the StressCalc Python class
+//! used by the crack control and fatigue checks).
+//!
+//! The object holds the results of the last call to solve, so each
+//! thread must use its own copy.
+class RCRectangularSectionStresses
+  {
+    double b; //!< Section width.
+    double h; //!< Section depth.
+    double r; //!< Cover of the positive face rebars.
+    double rp; //!< Cover of the negative face rebars.
+    double As; //!< Area of the positive face rebars.
+    double Asp; //!< Area of the negative face rebars.
+    double Ec; //!< Elastic modulus of concrete.
+    double Es; //!< Elastic modulus of steel.
+
+    double N; //!< Axial force.
+    double M; //!< Bending moment.
+    double sgc; //!< Stress in the most compressed concrete fiber.
+    double sgc0; //!< Stress in the opposite concrete fiber.
+    double xx; //!< Neutral axis depth.
+    double sgs; //!< Stress in the positive face rebars.
+    double sgsp; //!< Stress in the negative face rebars.
+
+    void swap(void);
+    void cracked_bending(void);
+  public:
+    RCRectangularSectionStresses(const double &b= 0.0,const double &h= 0.0,const double &r= 0.0,const double &rp= 0.0,const double &As= 0.0,const double &Asp= 0.0,const double &Ec= 0.0,const double &Es= 0.0);
+
+    //! @brief Returns the concrete area.
+    inline double Ac(void) const
+      { return b*h; }
+    //! @brief Returns the moment of inertia of the concrete section.
+    inline double Ic(void) const
+      { return b*h*h*h/12.0; }
+    //! @brief Returns the total area of the rebars.
+    inline double totAs(void) const
+      { return As+Asp; }
+    double totIs(void) const;
+    //! @brief Returns the position of the positive face rebars.
+    inline double getYs(void) const
+      { return h/2.0-r; }
+    //! @brief Returns the position of the negative face rebars.
+    inline double getYsp(void) const
+      { return rp-h/2.0; }
+    double getYCentroidAs(void) const;
+    double getAh(void) const;
+    double getYCentroidAh(void) const;
+    double getIh(void) const;
+    double xElasticNeutralAxis(void) const;
+
+    double elasticStressAs(void) const;
+    double elasticStressAsp(void) const;
+    double elasticStressAc(void) const;
+    double elasticStressAc0(void) const;
+    bool inTraction(void) const;
+    bool inCompression(void) const;
+
+    void solve(const double &,const double &);
+
+    //! @brief Returns the stress in the positive face rebars.
+    inline const double &getSteelStressPos(void) const
+      { return sgs; }
+    //! @brief Returns the stress in the negative face rebars.
+    inline const double &getSteelStressNeg(void) const
+      { return sgsp; }
+    //! @brief Returns the stress in the most compressed concrete fiber.
+    inline const double &getConcreteStress(void) const
+      { return sgc; }
+    //! @brief Returns the neutral axis depth.
+    inline const double &getNeutralAxisDepth(void) const
+      { return xx; }
+  };
+
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,119 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ShearCheckKernel.cc
+
+#include "ShearCheckKernel.h"
+#include <cmath>
+
+//! @brief Default constructor.
+XC::ShearCheckKernel::Parameters::Parameters(void)
+  : taucd(0.0), b(0.0), d(0.0), Asw(0.0), fyd(0.0), z(0.0),
+    alpha(M_PI/6.0), VuRough(0.0), MuFict(0.0) {}
+
+//! @brief Shear strength of the section without shear reinforcement
+//! (see VuNoShearRebarsSIA262 in SIA262_limit_state_checking.py).
+//!
+//! @param Nd: axial force.
+//! @param Md: bending moment.
+//! @param Mu: ultimate bending moment.
+double XC::ShearCheckKernel::Parameters::getVcu(const double &Nd,const double &Md,const double &Mu) const
+  {
+    const double h= d/0.9;
+    double mDd= 0.0;
+    if(Nd<=0)
+      mDd= -Nd*(h/2-d/3);
+    else
+      mDd= -Nd*(h/2-(h-d));
+    const double kv= 2.2*(Md-mDd)/(Mu-mDd);
+    const double kd= 1/(1+kv*d);
+    return kd*taucd*b*d;
+  }
+
+//! @brief Shear strength of the shear reinforcement.
+double XC::ShearCheckKernel::Parameters::getVsu(void) const
+  { return Asw*z*fyd/tan(alpha); }
+
+//! @brief Constructor.
+//!
+//! @param lbl: check identifier.
+XC::ShearCheckKernel::ShearCheckKernel(const std::string &lbl)
+  : LimitStateCheckKernel(lbl) {}
+
+//! @brief Assigns the shear parameters of the section.
+//!
+//! @param sectionName: name of the section.
+//! @param taucd: design value of the concrete shear stress.
+//! @param b: section width.
+//! @param d: effective depth.
+//! @param Asw: area of shear reinforcement per unit length.
+//! @param fyd: design yield stress of the shear reinforcement.
+//! @param z: lever arm.
+//! @param alpha: angle of the concrete struts.
+//! @param VuRough: rough estimation of the shear strength.
+//! @param MuFict: fictitious ultimate moment.
+//! @param diag: interaction diagram of the section (copied).
+void XC::ShearCheckKernel::setSectionParameters(const std::string &sectionName,const double &taucd,const double &b,const double &d,const double &Asw,const double &fyd,const double &z,const double &alpha,const double &VuRough,const double &MuFict,const InteractionDiagram &diag)
+  {
+    Parameters p;
+    p.taucd= taucd; p.b= b; p.d= d; p.Asw= Asw; p.fyd= fyd; p.z= z;
+    p.alpha= alpha; p.VuRough= VuRough; p.MuFict= MuFict; p.diag= diag;
+    parameters.set(sectionName,p);
+  }
+
+//! @brief Returns the names of the auxiliary values.
+std::vector<std::string> XC::ShearCheckKernel::getAuxNames(void) const
+  {
+    std::vector<std::string> retval(4);
+    retval[0]= "Mu"; retval[1]= "Vcu"; retval[2]= "Vsu"; retval[3]= "Vu";
+    return retval;
+  }
+
+//! @brief Makes the parameters reachable by section index.
+int XC::ShearCheckKernel::bind(const std::vector<std::string> &sectionNames)
+  { return parameters.bind(sectionNames,label); }
+
+//! @brief Returns the capacity factor |Vy|/Vu and writes Mu, Vcu, Vsu
+//! and Vu in aux.
+double XC::ShearCheckKernel::check(const size_t &iSection,const SectionInternalForces &f,const SectionInternalForces *,double *aux) const
+  {
+    const Parameters &p= parameters[iSection];
+    double Vu= p.VuRough;
+    const double momentThreshold= Vu/1000.0;
+    const double My= (std::abs(f.My)<momentThreshold ? momentThreshold : f.My);
+    const double Mz= (std::abs(f.Mz)<momentThreshold ? momentThreshold : f.Mz);
+    double Mu= p.MuFict;
+    double Vcu= 0.0;
+    double Vsu= 0.0;
+    if(std::abs(f.Vy)>Vu/5.0) //Small shear forces are not checked.
+      {
+        const double fc= p.diag.get_capacity_factor(f.N,My,Mz);
+        Mu= (fc>0.0 ? Mz/fc : 0.0); //Mz of the intersection with the diagram.
+        Vcu= p.getVcu(f.N,std::abs(Mz),std::abs(Mu));
+        Vsu= p.getVsu();
+        Vu= Vcu+Vsu;
+      }
+    aux[0]= Mu; aux[1]= Vcu; aux[2]= Vsu; aux[3]= Vu;
+    double retval= 10.0;
+    if(Vu!=0.0)
+      retval= std::abs(f.Vy)/Vu;
+    return retval;
+  }
@@ -0,0 +1,73 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ShearCheckKernel.h
+
+#ifndef ShearCheckKernel_h
+#define ShearCheckKernel_h
+
+#include "LimitStateCheckKernel.h"
+#include "material/section/interaction_diagram/InteractionDiagram.h"
+
+namespace XC {
+
+//! @ingroup POST_PROCESS
+//
+//! @brief Shear check according to SIA 262 (simplified method, same
+//! procedure as the ShearController Python class).
+//!
+//! The ultimate bending moment needed to compute the concrete
+//! contribution is obtained from the interaction diagram of the
+//! section (the kernel stores a copy of it).
+class ShearCheckKernel: public LimitStateCheckKernel
+  {
+  public:
+    //! @brief Shear parameters of a section.
+    struct Parameters
+      {
+        double taucd; //!< Design value of the concrete shear stress.
+        double b; //!< Section width.
+        double d; //!< Effective depth.
+        double Asw; //!< Area of shear reinforcement per unit length.
+        double fyd; //!< Design yield stress of the shear reinforcement.
+        double z; //!< Lever arm.
+        double alpha; //!< Angle of the concrete struts.
+        double VuRough; //!< Rough estimation of the shear strength (small shear forces are not checked).
+        double MuFict; //!< Fictitious ultimate moment (used when the shear force is not checked).
+        InteractionDiagram diag; //!< Interaction diagram.
+        Parameters(void);
+        double getVcu(const double &,const double &,const double &) const;
+        double getVsu(void) const;
+      };
+  private:
+    SectionParametersTable<Parameters> parameters; //!< Parameters for each section.
+  public:
+    ShearCheckKernel(const std::string &);
+
+    void setSectionParameters(const std::string &,const double &,const double &,const double &,const double &,const double &,const double &,const double &,const double &,const double &,const InteractionDiagram &);
+    std::vector<std::string> getAuxNames(void) const;
+    int bind(const std::vector<std::string> &);
+    double check(const size_t &,const SectionInternalForces &,const SectionInternalForces *,double *) const;
+  };
+
+} // end of XC namespace
+
+#endif
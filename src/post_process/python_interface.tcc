@@ -47,3 +47,51 @@ class_<XC::MapFields, bases<EntCmd,dq_fields> >("MapFields")
   .def("newField",make_function( &XC::MapFields::newField, return_internal_reference<>() ),"Defines a new field.")
   ;
 
+
+class_<XC::LimitStateCheckKernel, bases<EntCmd>, boost::noncopyable >("LimitStateCheckKernel", no_init)
+  .add_property("label",make_function(&XC::LimitStateCheckKernel::getLabel,return_value_policy<copy_const_reference>()),"Returns the check identifier.")
+  .add_property("referenceCombination",&XC::LimitStateCheckKernel::getReferenceCombination,"Returns the name of the reference combination (if any).")
+  .def("getAuxNames",&XC::LimitStateCheckKernel::getAuxNamesPy,"Returns the names of the auxiliary values computed by the check.")
+  ;
+
+class_<XC::NormalStressesCheckKernel, bases<XC::LimitStateCheckKernel>, boost::noncopyable >("NormalStressesCheckKernel", no_init)
+  .def("setInteractionDiagram",&XC::NormalStressesCheckKernel::setInteractionDiagram,"setInteractionDiagram(sectionName,diag) assigns the (N,My,Mz) interaction diagram of the section.")
+  .def("setInteractionDiagram2d",&XC::NormalStressesCheckKernel::setInteractionDiagram2d,"setInteractionDiagram2d(sectionName,diag) assigns the (N,My) interaction diagram of the section.")
+  ;
+
+class_<XC::ShearCheckKernel, bases<XC::LimitStateCheckKernel>, boost::noncopyable >("ShearCheckKernel", no_init)
+  .def("setSectionParameters",&XC::ShearCheckKernel::setSectionParameters,"setSectionParameters(sectionName,taucd,b,d,Asw,fyd,z,alpha,VuRough,MuFict,diag) assigns the shear parameters of the section.")
+  ;
+
+class_<XC::CrackControlCheckKernel, bases<XC::LimitStateCheckKernel>, boost::noncopyable >("CrackControlCheckKernel", no_init)
+  .def("setSectionParameters",&XC::CrackControlCheckKernel::setSectionParameters,"setSectionParameters(sectionName,b,h,r,rp,As,Asp,Ec,Es,limitStress) assigns the crack control parameters of the section.")
+  .add_property("negativeFace",&XC::CrackControlCheckKernel::getNegativeFace,&XC::CrackControlCheckKernel::setNegativeFace,"If true the negative face rebars are checked.")
+  ;
+
+class_<XC::FatigueCheckKernel, bases<XC::LimitStateCheckKernel>, boost::noncopyable >("FatigueCheckKernel", no_init)
+  .def("setSectionParameters",&XC::FatigueCheckKernel::setSectionParameters,"setSectionParameters(sectionName,b,h,r,rp,As,Asp,Ec,Es,limitStressRange) assigns the fatigue parameters of the section.")
+  .add_property("referenceCombination",&XC::FatigueCheckKernel::getReferenceCombination,&XC::FatigueCheckKernel::setReferenceCombination,"Name of the reference combination (i.e. permanent loads).")
+  ;
+
+void (XC::LimitStateChecker::*setNumThreadsLSC)(const size_t &)= &XC::LimitStateChecker::setNumThreads;
+class_<XC::LimitStateChecker, bases<EntCmd>, boost::noncopyable >("LimitStateChecker")
+  .def(init<size_t>())
+  .add_property("numThreads",&XC::LimitStateChecker::getNumThreads,setNumThreadsLSC,"Number of threads used to check.")
+  .def("setElementSection",&XC::LimitStateChecker::setElementSection,"setElementSection(tag,iSection,sectionName) assigns a section to an element.")
+  .def("setElementSections",&XC::LimitStateChecker::setElementSections,"setElementSections(tags,iSection,sectionName) assigns a section to the elements.")
+  .add_property("numSections",&XC::LimitStateChecker::getNumSections,"Returns the number of different sections.")
+  .def("newCheck",&XC::LimitStateChecker::newCheck,return_internal_reference<>(),"newCheck(type,label) defines a new check; type: normal_stresses, shear_sia262, crack_control or fatigue_stress_range.")
+  .def("getCheck",&XC::LimitStateChecker::getCheck,return_internal_reference<>(),"getCheck(label) returns the check.")
+  .def("getCheckLabels",&XC::LimitStateChecker::getCheckLabels,"Returns the labels of the checks.")
+  .def("clearResults",&XC::LimitStateChecker::clearResults,"Removes the results.")
+  .def("checkInternalForces",&XC::LimitStateChecker::checkInternalForces,"checkInternalForces(combName,tags,sections,N,Vy,Vz,T,My,Mz) checks the internal forces obtained for a combination.")
+  .def("checkFile",&XC::LimitStateChecker::checkFile,"checkFile(fileName) checks the internal forces stored in a columnar results file.")
+  .add_property("numUnassignedRows",&XC::LimitStateChecker::getNumUnassignedRows,"Returns the number of internal forces ignored because their element section has no assigned section.")
+  .def("getElementTags",&XC::LimitStateChecker::getElementTags,"Returns the tags of the checked elements (an item for each element section).")
+  .def("getSectionIndexes",&XC::LimitStateChecker::getSectionIndexes,"Returns the indexes of the checked element sections.")
+  .def("getSectionNames",&XC::LimitStateChecker::getSectionNames,"Returns the names of the sections assigned to the checked element sections.")
+  .def("getCapacityFactors",&XC::LimitStateChecker::getCapacityFactors,"getCapacityFactors(label) returns the worst capacity factors of the check.")
+  .def("getGoverningCombinations",&XC::LimitStateChecker::getGoverningCombinations,"getGoverningCombinations(label) returns the combinations that correspond to the worst cases of the check.")
+  .def("getInternalForces",&XC::LimitStateChecker::getInternalForces,"getInternalForces(label,component) returns the component (N, Vy, Vz, T, My or Mz) of the internal forces of the worst cases of the check.")
+  .def("getAuxValues",&XC::LimitStateChecker::getAuxValues,"getAuxValues(label,name) returns the auxiliary values (see LimitStateCheckKernel.getAuxNames) of the worst cases of the check.")
+  ;
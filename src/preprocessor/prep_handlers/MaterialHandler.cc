@@ -137,6 +137,7 @@
 #include "material/section/repres/geom_section/GeomSection.h"
 #include "material/section/interaction_diagram/InteractionDiagram.h"
 #include "material/section/interaction_diagram/InteractionDiagram2d.h"
+#include "xc_utils/src/nucleo/python_utils.h"
 
 //Plate section.
 #include "material/section/plate_section/ElasticPlateSection.h"
@@ -546,103 +547,114 @@ XC::InteractionDiagram2d *XC::MaterialHandler::new2DInteractionDiagram(const std
     return retval;
   }
 
-//! @brief New interaction diagram
-XC::InteractionDiagram *XC::MaterialHandler::calcInteractionDiagram(const std::string &cod_scc,const InteractionDiagramData &diag_data)
+//! @brief Returns a pointer to the fiber section named \p cod_scc
+//! (nullptr if not found).
+const XC::FiberSectionBase *XC::MaterialHandler::find_fiber_section(const std::string &cod_scc) const
   {
-    iterator mat= materials.find(cod_scc);
-    InteractionDiagram *diagI= nullptr;
+    const FiberSectionBase *retval= nullptr;
+    const_iterator mat= materials.find(cod_scc);
     if(mat!=materials.end())
       {
-        const FiberSectionBase *tmp= dynamic_cast<const FiberSectionBase *>(mat->second);
-        if(tmp)
-          {
-            const std::string cod_diag= "diagInt"+cod_scc;
-            if(interaction_diagrams.find(cod_diag)!=interaction_diagrams.end()) //Diagram exists.
-              {
-	        std::clog << "MaterialHandler::calcInteractionDiagram; ¡ojo! se redefine el interaction diagram de nombre: '"
-                          << cod_diag << "'." << std::endl;
-                delete interaction_diagrams[cod_diag];
-              }
-            else
-              {
-                diagI= new InteractionDiagram(calc_interaction_diagram(*tmp,diag_data));
-                interaction_diagrams[cod_diag]= diagI;
-              }
-          }
-        else
+        retval= dynamic_cast<const FiberSectionBase *>(mat->second);
+        if(!retval)
           std::cerr << "Material: '" << cod_scc
                     << "' is not a fiber section material." << std::endl;
       }
     else
       std::cerr << "Material: '"
                       << cod_scc << "' not found. Ignored.\n";
+    return retval;
+  }
+
+//! @brief Stores the interaction diagram (replacing the previous one
+//! if any).
+XC::InteractionDiagram *XC::MaterialHandler::store_interaction_diagram(const std::string &cod_diag,const InteractionDiagram &diag)
+  {
+    diag_interacc_iterator i= interaction_diagrams.find(cod_diag);
+    if(i!=interaction_diagrams.end()) //Diagram exists.
+      {
+        std::clog << getClassName() << "::" << __FUNCTION__
+                  << "; ¡warning! interaction diagram: '"
+                  << cod_diag << "' redefined." << std::endl;
+        delete i->second;
+      }
+    InteractionDiagram *retval= new InteractionDiagram(diag);
+    interaction_diagrams[cod_diag]= retval;
+    return retval;
+  }
+
+//! @brief Stores the 2D interaction diagram (replacing the previous one
+//! if any).
+XC::InteractionDiagram2d *XC::MaterialHandler::store_interaction_diagram2d(const std::string &cod_diag,const InteractionDiagram2d &diag)
+  {
+    diag_interacc2d_iterator i= interaction_diagrams2D.find(cod_diag);
+    if(i!=interaction_diagrams2D.end()) //Diagram exists.
+      {
+        std::clog << getClassName() << "::" << __FUNCTION__
+                  << "; ¡warning! interaction diagram: '"
+                  << cod_diag << "' redefined." << std::endl;
+        delete i->second;
+      }
+    InteractionDiagram2d *retval= new InteractionDiagram2d(diag);
+    interaction_diagrams2D[cod_diag]= retval;
+    return retval;
+  }
+
+//! @brief New interaction diagram
+XC::InteractionDiagram *XC::MaterialHandler::calcInteractionDiagram(const std::string &cod_scc,const InteractionDiagramData &diag_data)
+  {
+    InteractionDiagram *diagI= nullptr;
+    const FiberSectionBase *tmp= find_fiber_section(cod_scc);
+    if(tmp)
+      diagI= store_interaction_diagram("diagInt"+cod_scc,diagramBuilder.getInteractionDiagram(*tmp,diag_data));
     return diagI;     
   }
 
-//! @brief New 2D interaction diagram (N-My)
-XC::InteractionDiagram2d *XC::MaterialHandler::calcInteractionDiagramNMy(const std::string &cod_scc,const InteractionDiagramData &diag_data)
+//! @brief Computes (in parallel) the interaction diagrams of the
+//! sections whose names are being passed as parameter. Returns
+//! the number of diagrams computed.
+int XC::MaterialHandler::calcInteractionDiagrams(const std::vector<std::string> &cod_sccs,const InteractionDiagramData &diag_data)
   {
-    iterator mat= materials.find(cod_scc);
-    InteractionDiagram2d *diagI= nullptr;
-    if(mat!=materials.end())
+    std::vector<std::string> names;
+    InteractionDiagramBuilder::section_ptrs sections;
+    for(std::vector<std::string>::const_iterator i= cod_sccs.begin();i!=cod_sccs.end();i++)
       {
-        const FiberSectionBase *tmp= dynamic_cast<const FiberSectionBase *>(mat->second);
+        const FiberSectionBase *tmp= find_fiber_section(*i);
         if(tmp)
           {
-            const std::string cod_diag= "diagIntNMy"+cod_scc;
-            if(interaction_diagrams2D.find(cod_diag)!=interaction_diagrams2D.end()) //Diagram exists.
-              {
-	        std::clog << getClassName() << "::" << __FUNCTION__
-		          << "; ¡warning! interaction diagram: '"
-                          << cod_diag << "' redefined." << std::endl;
-                delete interaction_diagrams2D[cod_diag];
-              }
-            else
-              {
-                diagI= new InteractionDiagram2d(calcNMyInteractionDiagram(*tmp,diag_data));
-                interaction_diagrams2D[cod_diag]= diagI;
-              }
+            names.push_back(*i);
+            sections.push_back(tmp);
           }
-        else
-          std::cerr << "Material: '" << cod_scc
-                    << "' is not a fiber section material." << std::endl;
       }
-    else
-      std::cerr << "Material : '"
-                      << cod_scc << "' not found. Ignored.\n";
+    const std::vector<InteractionDiagram> diagrams= diagramBuilder.getInteractionDiagrams(sections,diag_data);
+    for(size_t i= 0;i<diagrams.size();i++)
+      store_interaction_diagram("diagInt"+names[i],diagrams[i]);
+    return diagrams.size();
+  }
+
+//! @brief Computes (in parallel) the interaction diagrams of the
+//! sections whose names are being passed as parameter. Returns
+//! the number of diagrams computed.
+int XC::MaterialHandler::calcInteractionDiagramsPy(const boost::python::list &cod_sccs,const InteractionDiagramData &diag_data)
+  { return calcInteractionDiagrams(vector_string_from_py_list(cod_sccs),diag_data); }
+
+//! @brief New 2D interaction diagram (N-My)
+XC::InteractionDiagram2d *XC::MaterialHandler::calcInteractionDiagramNMy(const std::string &cod_scc,const InteractionDiagramData &diag_data)
+  {
+    InteractionDiagram2d *diagI= nullptr;
+    const FiberSectionBase *tmp= find_fiber_section(cod_scc);
+    if(tmp)
+      diagI= store_interaction_diagram2d("diagIntNMy"+cod_scc,diagramBuilder.getNMyInteractionDiagram(*tmp,diag_data));
     return diagI;     
   }
 
 //! @brief New 2D interaction diagram (N-Mz)
 XC::InteractionDiagram2d *XC::MaterialHandler::calcInteractionDiagramNMz(const std::string &cod_scc,const InteractionDiagramData &diag_data)
   {
-    iterator mat= materials.find(cod_scc);
     InteractionDiagram2d *diagI= nullptr;
-    if(mat!=materials.end())
-      {
-        const FiberSectionBase *tmp= dynamic_cast<const FiberSectionBase *>(mat->second);
-        if(tmp)
-          {
-            const std::string cod_diag= "diagIntNMz"+cod_scc;
-            if(interaction_diagrams2D.find(cod_diag)!=interaction_diagrams2D.end()) //Diagram exists.
-              {
-	        std::clog << "MaterialHandler::calcInteractionDiagramNMz; ¡ojo! se redefine el interaction diagram de nombre: '"
-                          << cod_diag << "'." << std::endl;
-                delete interaction_diagrams2D[cod_diag];
-              }
-            else
-              {
-                diagI= new InteractionDiagram2d(calcNMzInteractionDiagram(*tmp,diag_data));
-                interaction_diagrams2D[cod_diag]= diagI;
-              }
-          }
-        else
-          std::cerr << "Material: '" << cod_scc
-                    << "' is not a fiber section material." << std::endl;
-      }
-    else
-      std::cerr << "Material : '"
-                      << cod_scc << "' not found. Ignored.\n";
+    const FiberSectionBase *tmp= find_fiber_section(cod_scc);
+    if(tmp)
+      diagI= store_interaction_diagram2d("diagIntNMz"+cod_scc,diagramBuilder.getNMzInteractionDiagram(*tmp,diag_data));
     return diagI;     
   }
 
@@ -654,6 +666,7 @@ void XC::MaterialHandler::clearAll(void)
     for(geom_secc_iterator i= sections_geometry.begin();i!= sections_geometry.end();i++)
       delete (*i).second;
     sections_geometry.erase(sections_geometry.begin(),sections_geometry.end());
+    diagramBuilder.clearCache();
     tag_mat= 0;
   }
 
@@ -30,6 +30,7 @@
 #define MATERIALLOADER_H
 
 #include "PrepHandler.h"
+#include "material/section/interaction_diagram/InteractionDiagramBuilder.h"
 #include <map>
 
 namespace XC {
@@ -38,6 +39,7 @@ class GeomSection;
 class InteractionDiagram;
 class InteractionDiagram2d;
 class InteractionDiagramData;
+class FiberSectionBase;
 
 //!  \ingroup Ldrs
 //! 
@@ -66,8 +68,12 @@ class MaterialHandler: public PrepHandler
     map_geom_secc sections_geometry; //!< Section geometries.
     map_interaction_diagram interaction_diagrams; //!< 3D interaction diagrams.
     map_interaction_diagram2d interaction_diagrams2D; //!< 2D interaction diagrams.
+    InteractionDiagramBuilder diagramBuilder; //!< Computes (and caches) the interaction diagrams.
   protected:
     friend class ElementHandler;
+    const FiberSectionBase *find_fiber_section(const std::string &) const;
+    InteractionDiagram *store_interaction_diagram(const std::string &,const InteractionDiagram &);
+    InteractionDiagram2d *store_interaction_diagram2d(const std::string &,const InteractionDiagram2d &);
   public:
     MaterialHandler(Preprocessor *owr);
     const map_materials &Map(void) const;
@@ -98,11 +104,15 @@ class MaterialHandler: public PrepHandler
     GeomSection &getGeomSection(const std::string &);
     InteractionDiagram *newInteractionDiagram(const std::string &);
     InteractionDiagram *calcInteractionDiagram(const std::string &,const InteractionDiagramData &diag_data);
+    int calcInteractionDiagrams(const std::vector<std::string> &,const InteractionDiagramData &diag_data);
+    int calcInteractionDiagramsPy(const boost::python::list &,const InteractionDiagramData &diag_data);
     InteractionDiagram &getInteractionDiagram(const std::string &);
     InteractionDiagram2d *new2DInteractionDiagram(const std::string &);
     InteractionDiagram2d *calcInteractionDiagramNMy(const std::string &,const InteractionDiagramData &diag_data);
     InteractionDiagram2d *calcInteractionDiagramNMz(const std::string &,const InteractionDiagramData &diag_data);
     InteractionDiagram2d &getNMzInteractionDiagram(const std::string &);
+    inline InteractionDiagramBuilder &getInteractionDiagramBuilder(void)
+      { return diagramBuilder; }
     ~MaterialHandler(void);
     void clearAll(void);
 
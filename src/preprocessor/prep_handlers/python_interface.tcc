@@ -53,6 +53,9 @@ class_<XC::MaterialHandler, bases<XC::PrepHandler>, boost::noncopyable >("Materi
   .def("interactionDiagExists",&XC::MaterialHandler::InteractionDiagramExists,"True if intecractions diagram is already defined.")
   .def("newInteractionDiagram", &XC::MaterialHandler::newInteractionDiagram,return_internal_reference<>())
   .def("calcInteractionDiagram", &XC::MaterialHandler::calcInteractionDiagram,return_internal_reference<>())
+  .def("getInteractionDiagram", &XC::MaterialHandler::getInteractionDiagram,return_internal_reference<>(),"Returns the interaction diagram whose name is given.")
+  .def("calcInteractionDiagrams", &XC::MaterialHandler::calcInteractionDiagramsPy,"calcInteractionDiagrams(sectionNames,diagParameters): computes in parallel the interaction diagrams of the sections; returns the number of diagrams.")
+  .add_property("getInteractionDiagramBuilder", make_function(&XC::MaterialHandler::getInteractionDiagramBuilder, return_internal_reference<>()),"Return the object that computes (and caches) the interaction diagrams.")
   .def("interactionDiag2dExists",&XC::MaterialHandler::InteractionDiagramExists2d,"True if intecractions diagram is already defined.")
   .def("new2DInteractionDiagram", &XC::MaterialHandler::new2DInteractionDiagram,return_internal_reference<>())
   .def("calcInteractionDiagramNMy", &XC::MaterialHandler::calcInteractionDiagramNMy,return_internal_reference<>())
@@ -239,7 +239,7 @@ bool DqPtrs<T>::push_front(T *t)
 template <class T>
 const ID &DqPtrs<T>::getTags(void) const
   {
-    static ID retval;
+    static thread_local ID retval;
     const int sz= size();
     if(sz>0)
       {
@@ -275,7 +275,7 @@ int DqPtrs<T>::sendTags(int posSz,int posDbTag,DbTagData &dt,CommParameters &cp)
 template <class T>
 const ID &DqPtrs<T>::receiveTags(int posSz,int posDbTag,DbTagData &dt,const CommParameters &cp)
   {
-    static ID retval;
+    static thread_local ID retval;
     int sz= 0;
     int res= cp.receiveInt(sz,dt,CommMetaData(posSz));
     if(sz>0)
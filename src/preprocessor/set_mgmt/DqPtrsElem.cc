@@ -52,11 +52,15 @@ XC::DqPtrsElem::DqPtrsElem(const std::set<const Element *> &st)
   : DqPtrsKDTree<Element,KDTreeElements>(st)
   {}
 
+//! @brief Constructor from the result of a spatial query.
+XC::DqPtrsElem::DqPtrsElem(const std::vector<const Element *> &v)
+  : DqPtrsKDTree<Element,KDTreeElements>(v)
+  {}
+
 //! @brief Assignment operator.
 XC::DqPtrsElem &XC::DqPtrsElem::operator=(const DqPtrsElem &otro)
   {
     DqPtrsKDTree<Element,KDTreeElements>::operator=(otro);
-    kdtreeElements= otro.kdtreeElements;
     return *this;
   }
 
@@ -214,17 +218,52 @@ std::deque<Polilinea3d> XC::DqPtrsElem::getContours(const double &factor) const
 //! @param geomObj: geometric object that must contain the elements.
 //! @param tol: tolerance for "In" function.
 XC::DqPtrsElem XC::DqPtrsElem::pickElemsInside(const GeomObj3d &geomObj, const double &tol)
-  {
-    DqPtrsElem retval;
-    for(iterator i= begin();i!=end();i++)
-      {
-        Element *e= (*i);
-        assert(e);
-	if(e->In(geomObj,tol))
-	  retval.push_back(e);
-      }
-    return retval;    
-  }
+  { return DqPtrsElem(getKDTree().getInside(geomObj,tol)); }
+
+//! @brief Return a container with the elements whose nodes lie
+//! inside the box.
+//!
+//! @param pMin: box corner with the minimum coordinates.
+//! @param pMax: box corner with the maximum coordinates.
+XC::DqPtrsElem XC::DqPtrsElem::pickElemsInsideBox(const Pos3d &pMin, const Pos3d &pMax)
+  { return DqPtrsElem(getKDTree().getInsideBox(pMin,pMax)); }
+
+//! @brief Return a container with the elements whose nodes lie
+//! in the half space bounded by the plane that passes through org
+//! with outward normal n.
+//!
+//! @param org: point of the boundary plane.
+//! @param n: outward normal of the boundary plane.
+//! @param tol: tolerance.
+XC::DqPtrsElem XC::DqPtrsElem::pickElemsInsideHalfSpace(const Pos3d &org, const Vector3d &n, const double &tol)
+  { return DqPtrsElem(getKDTree().getInsideHalfSpace(org,n,tol)); }
+
+//! @brief Return a container with the elements whose nodes lie
+//! inside the prism obtained by extruding the 2D object (defined
+//! on the XY plane) between zMin and zMax.
+//!
+//! @param geomObj: prism base (polygon, circle,...).
+//! @param zMin: minimum z of the prism.
+//! @param zMax: maximum z of the prism.
+//! @param tol: tolerance for "In" function.
+XC::DqPtrsElem XC::DqPtrsElem::pickElemsInsidePrism(const GeomObj2d &geomObj, const double &zMin, const double &zMax, const double &tol)
+  { return DqPtrsElem(getKDTree().getInsidePrism(geomObj,zMin,zMax,tol)); }
+
+//! @brief Return a container with the elements whose centroid
+//! is at a distance not greater than r from the point.
+//!
+//! @param p: center of the sphere.
+//! @param r: radius of the sphere.
+XC::DqPtrsElem XC::DqPtrsElem::pickElemsWithinRadius(const Pos3d &p, const double &r)
+  { return DqPtrsElem(getKDTree().getWithinRadius(p,r)); }
+
+//! @brief Return a container with the k elements whose centroids
+//! are closest to the point (sorted by increasing distance).
+//!
+//! @param p: target point.
+//! @param k: number of elements.
+XC::DqPtrsElem XC::DqPtrsElem::getNearestElements(const Pos3d &p, const size_t &k)
+  { return DqPtrsElem(getKDTree().getKNearest(p,k)); }
 
 //! @brief Return the names of the materials.
 std::set<std::string> XC::DqPtrsElem::getMaterialNames(void) const
@@ -35,6 +35,9 @@
 
 class Polilinea3d;
 class GeomObj3d;
+class GeomObj2d;
+class Pos3d;
+class Vector3d;
 
 namespace XC {
 class TrfGeom;
@@ -45,12 +48,12 @@ class TrfGeom;
 //! 
 class DqPtrsElem: public DqPtrsKDTree<Element,KDTreeElements>
   {
-    KDTreeElements kdtreeElements; //!< space-partitioning data structure for organizing elements (element centroids).
   public:
     DqPtrsElem(EntCmd *owr= nullptr);
     DqPtrsElem(const DqPtrsElem &otro);
     explicit DqPtrsElem(const std::deque<Element *> &ts);
     explicit DqPtrsElem(const std::set<const Element *> &ts);
+    explicit DqPtrsElem(const std::vector<const Element *> &);
     DqPtrsElem &operator=(const DqPtrsElem &);
 
     size_t getNumLiveElements(void) const;
@@ -66,6 +69,11 @@ class DqPtrsElem: public DqPtrsKDTree<Element,KDTreeElements>
     const Element *findElement(const int &) const;
     std::deque<Polilinea3d> getContours(const double &factor= 0.0) const;
     DqPtrsElem pickElemsInside(const GeomObj3d &, const double &tol= 0.0);
+    DqPtrsElem pickElemsInsideBox(const Pos3d &, const Pos3d &);
+    DqPtrsElem pickElemsInsideHalfSpace(const Pos3d &, const Vector3d &, const double &tol= 0.0);
+    DqPtrsElem pickElemsInsidePrism(const GeomObj2d &, const double &, const double &, const double &tol= 0.0);
+    DqPtrsElem pickElemsWithinRadius(const Pos3d &, const double &);
+    DqPtrsElem getNearestElements(const Pos3d &, const size_t &);
     std::set<std::string> getMaterialNames(void) const;
     boost::python::list getMaterialNamesPy(void) const;
     std::set<std::string> getTypes(void) const;
@@ -82,6 +82,11 @@ T *DqPtrsEntities<T>::searchName(const std::string &nmb)
   }
 
 //! @brief Returns the object closest to the position being passed as parameter.
+//!
+//! Linear scan: unlike the node and element containers (DqPtrsKDTree)
+//! the entity containers have no spatial index. Their contents change
+//! through several paths (DqPtrs interface, set operators, moves of the
+//! entity vertices) that don't share a hook to keep an index up to date.
 template <class T>
 T *DqPtrsEntities<T>::getNearest(const Pos3d &p)
   {
@@ -134,6 +139,9 @@ const T *DqPtrsEntities<T>::getNearest(const Pos3d &p) const
 //!
 //! @param geomObj: geometric object that must contain the nodes.
 //! @param tol: tolerance for "In" function.
+//!
+//! Linear scan, see getNearest. The In test of the entities checks
+//! their vertices, so there is no cheaper bounding box prefilter.
 template <class T>
 DqPtrsEntities<T> DqPtrsEntities<T>::pickEntitiesInside(const GeomObj3d &geomObj, const double &tol) const
   {
@@ -32,6 +32,7 @@
 
 #include "DqPtrs.h"
 #include <set>
+#include <vector>
 
 class Pos3d;
 class Vector3d;
@@ -43,12 +44,16 @@ class TrfGeom;
 //! 
 //!  @brief Container with a KDTree.
 //!
+//!  The tree (see SpatialIndex3d) is kept up to date by push_back,
+//!  push_front, clear and clearAll; if the container has been
+//!  modified by other means it is rebuilt on the next query.
 template <class T,class KDTree>
 class DqPtrsKDTree: public DqPtrs<T>
   {
     KDTree kdtree; //!< space-partitioning data structure for organizing objects.
   protected:
     void create_tree(void);
+    const KDTree &getKDTree(void) const;
   public:
     typedef typename DqPtrs<T>::const_iterator const_iterator;
     typedef typename DqPtrs<T>::iterator iterator;
@@ -60,12 +65,14 @@ class DqPtrsKDTree: public DqPtrs<T>
     DqPtrsKDTree(const DqPtrsKDTree &);
     explicit DqPtrsKDTree(const std::deque<T *> &);
     explicit DqPtrsKDTree(const std::set<const T *> &);
+    explicit DqPtrsKDTree(const std::vector<const T *> &);
     DqPtrsKDTree &operator=(const DqPtrsKDTree &);
     DqPtrsKDTree &operator+=(const DqPtrsKDTree &);
     void extend(const DqPtrsKDTree &otro);
     //void extend_cond(const DqPtrsKDTree &otro,const std::string &cond);
     bool push_back(T *);
     bool push_front(T *);
+    void clear(void);
     void clearAll(void);
 
     T *getNearest(const Pos3d &p);
@@ -75,14 +82,19 @@ class DqPtrsKDTree: public DqPtrs<T>
 //! @brief Creates the KD tree.
 template <class T,class KDTree>
 void DqPtrsKDTree<T,KDTree>::create_tree(void)
+  { kdtree.build(this->begin(),this->end()); }
+
+//! @brief Returns the KD tree (rebuilding it if the container
+//! has been modified through the base class interface).
+template <class T,class KDTree>
+const KDTree &DqPtrsKDTree<T,KDTree>::getKDTree(void) const
   {
-    kdtree.clear();
-    for(iterator i= this->begin();i!=this->end();i++)
+    if(kdtree.size()!=this->size())
       {
-        T *tPtr= *i;
-        assert(tPtr);
-        kdtree.insert(*tPtr);
+        DqPtrsKDTree<T,KDTree> *this_no_const= const_cast<DqPtrsKDTree *>(this);
+        this_no_const->create_tree();
       }
+    return kdtree;
   }
 
 //! @brief Constructor.
@@ -113,6 +125,17 @@ DqPtrsKDTree<T,KDTree>::DqPtrsKDTree(const std::set<const T *> &st)
       push_back(const_cast<T *>(*k));
   }
 
+//! @brief Constructor from the result of a query on a KDTree (the
+//! pointers are supposed to be unique).
+template <class T,class KDTree>
+DqPtrsKDTree<T,KDTree>::DqPtrsKDTree(const std::vector<const T *> &v)
+  : DqPtrs<T>()
+  {
+    for(typename std::vector<const T *>::const_iterator k= v.begin();k!=v.end();k++)
+      DqPtrs<T>::lst_ptr::push_back(const_cast<T *>(*k));
+    create_tree();
+  }
+
 //! @brief Assignment operator.
 template <class T,class KDTree>
 DqPtrsKDTree<T,KDTree> &DqPtrsKDTree<T,KDTree>::operator=(const DqPtrsKDTree &otro)
@@ -154,10 +177,18 @@ bool XC::DqPtrsKDTree<T,KDTree>::push_front(T *t)
   {
     bool retval= DqPtrs<T>::push_front(t);
     if(retval)
-      kdtree.insert(*t);
+      kdtree.insertFront(*t);
     return retval;
 }
 
+//! @brief Clears out the list of pointers.
+template <class T,class KDTree>
+void DqPtrsKDTree<T,KDTree>::clear(void)
+  {
+    DqPtrs<T>::clear();
+    kdtree.clear();
+  }
+
 //! @brief Clears out the list of pointers and erases the properties of the object (if any).
 template <class T,class KDTree>
 void DqPtrsKDTree<T,KDTree>::clearAll(void)
@@ -165,11 +196,12 @@ void DqPtrsKDTree<T,KDTree>::clearAll(void)
     DqPtrs<T>::clear();
     kdtree.clear();
   }
+
 //! @brief Returns the object closest to the point being passed as parameter.
 template <class T,class KDTree>
 T *DqPtrsKDTree<T,KDTree>::getNearest(const Pos3d &p)
   {
-    T *retval= const_cast<T *>(kdtree.getNearest(p));
+    T *retval= const_cast<T *>(getKDTree().getNearest(p));
     return retval;
   }
 
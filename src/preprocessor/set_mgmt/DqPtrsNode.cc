@@ -51,6 +51,11 @@ XC::DqPtrsNode::DqPtrsNode(const std::set<const Node *> &st)
   : DqPtrsKDTree<Node,KDTreeNodes>(st)
   {}
 
+//! @brief Constructor from the result of a spatial query.
+XC::DqPtrsNode::DqPtrsNode(const std::vector<const Node *> &v)
+  : DqPtrsKDTree<Node,KDTreeNodes>(v)
+  {}
+
 //! @brief Assignment operator.
 XC::DqPtrsNode &XC::DqPtrsNode::operator=(const DqPtrsNode &otro)
   {
@@ -197,17 +202,51 @@ std::set<int> XC::DqPtrsNode::getTags(void) const
 //! @param geomObj: geometric object that must contain the nodes.
 //! @param tol: tolerance for "In" function.
 XC::DqPtrsNode XC::DqPtrsNode::pickNodesInside(const GeomObj3d &geomObj, const double &tol)
-  {
-    DqPtrsNode retval;
-    for(iterator i= begin();i!=end();i++)
-      {
-        Node *n= (*i);
-        assert(n);
-	if(n->In(geomObj,tol))
-	  retval.push_back(n);
-      }
-    return retval;    
-  }
+  { return DqPtrsNode(getKDTree().getInside(geomObj,tol)); }
+
+//! @brief Return a container with the nodes that lie inside the box.
+//!
+//! @param pMin: box corner with the minimum coordinates.
+//! @param pMax: box corner with the maximum coordinates.
+XC::DqPtrsNode XC::DqPtrsNode::pickNodesInsideBox(const Pos3d &pMin, const Pos3d &pMax)
+  { return DqPtrsNode(getKDTree().getInsideBox(pMin,pMax)); }
+
+//! @brief Return a container with the nodes that lie in the half
+//! space bounded by the plane that passes through org with
+//! outward normal n.
+//!
+//! @param org: point of the boundary plane.
+//! @param n: outward normal of the boundary plane.
+//! @param tol: tolerance.
+XC::DqPtrsNode XC::DqPtrsNode::pickNodesInsideHalfSpace(const Pos3d &org, const Vector3d &n, const double &tol)
+  { return DqPtrsNode(getKDTree().getInsideHalfSpace(org,n,tol)); }
+
+//! @brief Return a container with the nodes that lie inside the
+//! prism obtained by extruding the 2D object (defined on the XY
+//! plane) between zMin and zMax.
+//!
+//! @param geomObj: prism base (polygon, circle,...).
+//! @param zMin: minimum z of the prism.
+//! @param zMax: maximum z of the prism.
+//! @param tol: tolerance for "In" function.
+XC::DqPtrsNode XC::DqPtrsNode::pickNodesInsidePrism(const GeomObj2d &geomObj, const double &zMin, const double &zMax, const double &tol)
+  { return DqPtrsNode(getKDTree().getInsidePrism(geomObj,zMin,zMax,tol)); }
+
+//! @brief Return a container with the nodes at a distance not
+//! greater than r from the point.
+//!
+//! @param p: center of the sphere.
+//! @param r: radius of the sphere.
+XC::DqPtrsNode XC::DqPtrsNode::pickNodesWithinRadius(const Pos3d &p, const double &r)
+  { return DqPtrsNode(getKDTree().getWithinRadius(p,r)); }
+
+//! @brief Return a container with the k nodes closest to the
+//! point (sorted by increasing distance).
+//!
+//! @param p: target point.
+//! @param k: number of nodes.
+XC::DqPtrsNode XC::DqPtrsNode::getNearestNodes(const Pos3d &p, const size_t &k)
+  { return DqPtrsNode(getKDTree().getKNearest(p,k)); }
 
 //! @brief Return the nodes current position boundary.
 //!
@@ -37,6 +37,7 @@
 class Vector3d;
 class ExprAlgebra;
 class GeomObj3d;
+class GeomObj2d;
 class BND3d;
 
 namespace XC {
@@ -53,6 +54,7 @@ class DqPtrsNode: public DqPtrsKDTree<Node,KDTreeNodes>
     DqPtrsNode(const DqPtrsNode &);
     explicit DqPtrsNode(const std::deque<Node *> &);
     explicit DqPtrsNode(const std::set<const Node *> &);
+    explicit DqPtrsNode(const std::vector<const Node *> &);
     DqPtrsNode &operator=(const DqPtrsNode &);
     DqPtrsNode &operator+=(const DqPtrsNode &);
     void mueve(const Vector3d &);
@@ -65,6 +67,11 @@ class DqPtrsNode: public DqPtrsKDTree<Node,KDTreeNodes>
     bool InNodeTags(const ID &) const;
     std::set<int> getTags(void) const;
     DqPtrsNode pickNodesInside(const GeomObj3d &, const double &tol= 0.0);
+    DqPtrsNode pickNodesInsideBox(const Pos3d &, const Pos3d &);
+    DqPtrsNode pickNodesInsideHalfSpace(const Pos3d &, const Vector3d &, const double &tol= 0.0);
+    DqPtrsNode pickNodesInsidePrism(const GeomObj2d &, const double &, const double &, const double &tol= 0.0);
+    DqPtrsNode pickNodesWithinRadius(const Pos3d &, const double &);
+    DqPtrsNode getNearestNodes(const Pos3d &, const size_t &);
     BND3d Bnd(const double &) const;
 
     Node *findNode(const int &tag);
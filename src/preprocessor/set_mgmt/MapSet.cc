@@ -37,7 +37,7 @@
 #include "domain/mesh/element/Element.h"
 #include "domain/mesh/node/Node.h"
 
-XC::ID XC::MapSet::setsDbTags;
+thread_local XC::ID XC::MapSet::setsDbTags;
 std::deque<std::string> XC::MapSet::setsClassNames;
 
 //! @brief Return true if the sets already exists.
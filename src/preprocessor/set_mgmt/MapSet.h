@@ -55,7 +55,7 @@ class UniformGrid;
 //!  
 class MapSet: public PreprocessorContainer, public MovableObject
   {
-    static ID setsDbTags;//! dbTags para the sets.
+    static thread_local ID setsDbTags;//! dbTags para the sets.
     static std::deque<std::string> setsClassNames; //! sets class names.
   public:
     typedef std::map<std::string,SetBase *> map_sets;
@@ -40,6 +40,11 @@ class_<XC::DqPtrsNode, bases<dq_ptrs_node> >("DqPtrsNode",no_init)
   .add_property("getNumDeadNodes", &XC::DqPtrsNode::getNumDeadNodes)
   .def("getNearestNode",make_function(getNearestNodeDqPtrs, return_internal_reference<>() ),"Returns nearest node.")
   .def("pickNodesInside",&XC::DqPtrsNode::pickNodesInside,"pickNodesInside(geomObj,tol) return the nodes inside the geometric object.")
+  .def("pickNodesInsideBox",&XC::DqPtrsNode::pickNodesInsideBox,"pickNodesInsideBox(pMin,pMax) return the nodes inside the box defined by its corners.")
+  .def("pickNodesInsideHalfSpace",&XC::DqPtrsNode::pickNodesInsideHalfSpace,"pickNodesInsideHalfSpace(org,n,tol) return the nodes in the half space bounded by the plane through org with outward normal n.")
+  .def("pickNodesInsidePrism",&XC::DqPtrsNode::pickNodesInsidePrism,"pickNodesInsidePrism(geomObj2d,zMin,zMax,tol) return the nodes inside the prism obtained by extruding the 2D object between zMin and zMax.")
+  .def("pickNodesWithinRadius",&XC::DqPtrsNode::pickNodesWithinRadius,"pickNodesWithinRadius(p,r) return the nodes at a distance not greater than r from p.")
+  .def("getNearestNodes",&XC::DqPtrsNode::getNearestNodes,"getNearestNodes(p,k) return the k nodes closest to p.")
   .def("getBnd", &XC::DqPtrsNode::Bnd, "Returns nodes boundary.")
   .def(self += self)
   .def(self + self)
@@ -67,6 +72,11 @@ class_<XC::DqPtrsElem, bases<dq_ptrs_element> >("DqPtrsElem",no_init)
   .def("getNearestElement",make_function(getNearestElementDqPtrs, return_internal_reference<>() ),"Returns nearest element.")
   .def("getContours",&XC::DqPtrsElem::getContours,"Returns contour(s) from the element set in the form of closed 3D polylines.")
   .def("pickElemsInside",&XC::DqPtrsElem::pickElemsInside,"pickElemsInside(geomObj,tol) return the elements inside the geometric object.") 
+  .def("pickElemsInsideBox",&XC::DqPtrsElem::pickElemsInsideBox,"pickElemsInsideBox(pMin,pMax) return the elements inside the box defined by its corners.")
+  .def("pickElemsInsideHalfSpace",&XC::DqPtrsElem::pickElemsInsideHalfSpace,"pickElemsInsideHalfSpace(org,n,tol) return the elements in the half space bounded by the plane through org with outward normal n.")
+  .def("pickElemsInsidePrism",&XC::DqPtrsElem::pickElemsInsidePrism,"pickElemsInsidePrism(geomObj2d,zMin,zMax,tol) return the elements inside the prism obtained by extruding the 2D object between zMin and zMax.")
+  .def("pickElemsWithinRadius",&XC::DqPtrsElem::pickElemsWithinRadius,"pickElemsWithinRadius(p,r) return the elements whose centroid is at a distance not greater than r from p.")
+  .def("getNearestElements",&XC::DqPtrsElem::getNearestElements,"getNearestElements(p,k) return the k elements whose centroids are closest to p.")
   .def("pickElemsOfType",&XC::DqPtrsElem::pickElemsOfType,"pickElemsOfType(typeName) return the elements whose type containts the string.")
   .def("pickElemsOfDimension",&XC::DqPtrsElem::pickElemsOfDimension,"pickElemsOfDimension(dim) return the elements whose dimension equals the argument.")
   .def("getTypes",&XC::DqPtrsElem::getTypesPy,"getElementTypes() return a list with the element types in the container.")
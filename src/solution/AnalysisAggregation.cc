@@ -307,6 +307,8 @@ bool XC::AnalysisAggregation::alloc_system_of_equations(const std::string &nmb,A
       theSOE=new SymBandEigenSOE(this);
     else if(nmb=="full_gen_eigen_soe")
       theSOE=new FullGenEigenSOE(this);
+    else if(nmb=="sparse_gen_col_eigen_soe")
+      theSOE=new SparseGenColEigenSOE(this);
     else if(nmb=="band_gen_lin_soe")
       theSOE=new BandGenLinSOE(this);
     else if(nmb=="distributed_band_gen_lin_soe")
@@ -337,6 +339,8 @@ bool XC::AnalysisAggregation::alloc_system_of_equations(const std::string &nmb,A
       theSOE=new DistributedSparseGenRowLinSOE(this);
     else if(nmb=="sym_sparse_lin_soe")
       theSOE =new SymSparseLinSOE(this);
+    else if(nmb=="supernodal_spd_lin_soe")
+      theSOE =new SupernodalSPDLinSOE(this);
 //     else if(nmb=="umfpack_gen_lin_soe")
 //       theSOE =new UmfpackGenLinSOE();
     else
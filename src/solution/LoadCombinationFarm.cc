@@ -0,0 +1,454 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//LoadCombinationFarm.cc
+
+#include "LoadCombinationFarm.h"
+#include "ProcSolu.h"
+#include "FEProblem.h"
+#include "preprocessor/Preprocessor.h"
+#include <solution/analysis/analysis/StaticAnalysis.h>
+#include "domain/domain/Domain.h"
+#include "domain/load/pattern/LoadCombination.h"
+#include "domain/load/pattern/LoadCombinationGroup.h"
+#include "utility/recorder/PropEnvelopeRecorder.h"
+#include "utility/database/MemoryDatastore.h"
+#include <set>
+#include <algorithm>
+#include <sstream>
+#include <cstdio>
+#include <cerrno>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+namespace XC {
+//! @brief Header of the results sent by the workers.
+static const int farm_results_magic= 0x58434c46;
+
+//! @brief Writes the value in binary form.
+template <class T>
+inline void farm_write(std::ostream &os,const T &value)
+  { os.write(reinterpret_cast<const char *>(&value),sizeof(T)); }
+
+//! @brief Reads the value in binary form.
+template <class T>
+inline void farm_read(std::istream &is,T &value)
+  { is.read(reinterpret_cast<char *>(&value),sizeof(T)); }
+
+//! @brief Writes the whole buffer to the file descriptor.
+static bool write_all(int fd,const std::string &buffer)
+  {
+    const char *ptr= buffer.data();
+    size_t remaining= buffer.size();
+    while(remaining>0)
+      {
+        const ssize_t n= write(fd,ptr,remaining);
+        if(n<0)
+          {
+            if(errno==EINTR)
+              continue;
+            return false;
+          }
+        ptr+= n;
+        remaining-= n;
+      }
+    return true;
+  }
+
+//! @brief Reads from the file descriptor until end of file.
+static std::string read_all(int fd)
+  {
+    std::string retval;
+    char buffer[65536];
+    while(true)
+      {
+        const ssize_t n= read(fd,buffer,sizeof(buffer));
+        if(n<0)
+          {
+            if(errno==EINTR)
+              continue;
+            break;
+          }
+        if(n==0)
+          break;
+        retval.append(buffer,n);
+      }
+    return retval;
+  }
+} // end of XC namespace
+
+//! @brief Constructor.
+XC::LoadCombinationFarm::LoadCombinationFarm(ProcSolu *owr)
+  : EntCmd(owr), numWorkers(1), numSteps(1) {}
+
+//! @brief Return the number of worker processes.
+size_t XC::LoadCombinationFarm::getNumWorkers(void) const
+  { return numWorkers; }
+
+//! @brief Set the number of worker processes.
+void XC::LoadCombinationFarm::setNumWorkers(const size_t &n)
+  { numWorkers= std::max(n,size_t(1)); }
+
+//! @brief Return the number of steps used to analyze each combination.
+int XC::LoadCombinationFarm::getNumSteps(void) const
+  { return numSteps; }
+
+//! @brief Set the number of steps used to analyze each combination.
+void XC::LoadCombinationFarm::setNumSteps(const int &n)
+  { numSteps= std::max(n,1); }
+
+//! @brief Return the names of the combinations whose analysis failed
+//! in the last call to analyze.
+boost::python::list XC::LoadCombinationFarm::getFailedCombinations(void) const
+  {
+    boost::python::list retval;
+    for(std::deque<std::string>::const_iterator i= failedCombinations.begin();i!=failedCombinations.end();i++)
+      retval.append(*i);
+    return retval;
+  }
+
+//! @brief Return a pointer to the solution procedure.
+XC::ProcSolu *XC::LoadCombinationFarm::getProcSolu(void)
+  { return dynamic_cast<ProcSolu *>(Owner()); }
+
+//! @brief Return a pointer to the finite element problem.
+XC::FEProblem *XC::LoadCombinationFarm::getFEProblem(void)
+  {
+    FEProblem *retval= nullptr;
+    ProcSolu *ps= getProcSolu();
+    if(ps)
+      retval= ps->getFEProblem();
+    return retval;
+  }
+
+//! @brief Return a pointer to the (static) analysis defined in
+//! the solution procedure.
+XC::StaticAnalysis *XC::LoadCombinationFarm::getStaticAnalysis(void)
+  {
+    StaticAnalysis *retval= nullptr;
+    ProcSolu *ps= getProcSolu();
+    if(ps)
+      retval= dynamic_cast<StaticAnalysis *>(ps->getAnalysisPtr());
+    return retval;
+  }
+
+//! @brief Return the combination that defines the starting state
+//! of each combination of the group (see LoadCombination::getPtrCombPrevia).
+//!
+//! If the predecessors form a cycle it's broken, so all the
+//! chains of predecessors end in a combination analyzed from
+//! the initial state.
+XC::LoadCombinationFarm::predecessor_map XC::LoadCombinationFarm::getPredecessors(LoadCombinationGroup &group) const
+  {
+    predecessor_map retval;
+    predecessor_map ptrs; //Const to non-const pointers.
+    for(LoadCombinationGroup::iterator i= group.begin();i!=group.end();i++)
+      ptrs[i->second]= i->second;
+    for(LoadCombinationGroup::iterator i= group.begin();i!=group.end();i++)
+      {
+        const LoadCombination *previa= group.getPtrCombPrevia(*(i->second));
+        predecessor_map::const_iterator j= ptrs.find(previa);
+        if(j!=ptrs.end())
+          retval[i->second]= j->second;
+      }
+    for(LoadCombinationGroup::iterator i= group.begin();i!=group.end();i++)
+      {
+        std::set<const LoadCombination *> visited;
+        visited.insert(i->second);
+        predecessor_map::iterator j= retval.find(i->second);
+        while(j!=retval.end())
+          {
+            if(visited.find(j->second)!=visited.end())
+              {
+                std::clog << getClassName() << "::" << __FUNCTION__
+                          << "; cycle in the starting states of the combinations,"
+                          << " combination: '" << j->first->getNombre()
+                          << "' will be analyzed from the initial state."
+                          << std::endl;
+                retval.erase(j);
+                break;
+              }
+            visited.insert(j->second);
+            j= retval.find(j->second);
+          }
+      }
+    return retval;
+  }
+
+//! @brief Distributes the combinations of the group between the workers.
+//!
+//! The combinations linked by their starting states form a tree
+//! that is assigned as a whole to a worker (the biggest trees first,
+//! each one to the least loaded worker). The combinations of each
+//! tree are sorted by its depth, so each combination is analyzed after
+//! its predecessor.
+std::vector<XC::LoadCombinationFarm::combination_sequence> XC::LoadCombinationFarm::schedule(LoadCombinationGroup &group,const predecessor_map &preds) const
+  {
+    typedef std::pair<size_t,LoadCombination *> depth_comb;
+    std::vector<std::vector<depth_comb> > trees;
+    std::map<const LoadCombination *,size_t> treeIndexes; //Root to tree index.
+    for(LoadCombinationGroup::iterator i= group.begin();i!=group.end();i++)
+      {
+        const LoadCombination *root= i->second;
+        size_t depth= 0;
+        predecessor_map::const_iterator j= preds.find(root);
+        while(j!=preds.end())
+          {
+            root= j->second;
+            depth++;
+            j= preds.find(root);
+          }
+        std::map<const LoadCombination *,size_t>::const_iterator k= treeIndexes.find(root);
+        size_t iTree= trees.size();
+        if(k!=treeIndexes.end())
+          iTree= k->second;
+        else
+          {
+            treeIndexes[root]= iTree;
+            trees.push_back(std::vector<depth_comb>());
+          }
+        trees[iTree].push_back(depth_comb(depth,i->second));
+      }
+    const size_t numTrees= trees.size();
+    std::vector<size_t> order(numTrees);
+    for(size_t i= 0;i<numTrees;i++)
+      {
+        order[i]= i;
+        std::stable_sort(trees[i].begin(),trees[i].end(),[](const depth_comb &a,const depth_comb &b){ return a.first<b.first; });
+      }
+    std::stable_sort(order.begin(),order.end(),[&trees](const size_t &a,const size_t &b){ return trees[a].size()>trees[b].size(); });
+
+    const size_t nw= std::min(numWorkers,numTrees);
+    std::vector<combination_sequence> retval(nw);
+    std::vector<size_t> loads(nw,0);
+    for(std::vector<size_t>::const_iterator i= order.begin();i!=order.end();i++)
+      {
+        const size_t iWorker= std::min_element(loads.begin(),loads.end())-loads.begin();
+        const std::vector<depth_comb> &tree= trees[*i];
+        for(std::vector<depth_comb>::const_iterator j= tree.begin();j!=tree.end();j++)
+          retval[iWorker].push_back(j->second);
+        loads[iWorker]+= tree.size();
+      }
+    return retval;
+  }
+
+//! @brief Analyzes the combinations (code executed by the worker
+//! process) and writes the results to the stream.
+int XC::LoadCombinationFarm::run_worker(const combination_sequence &combs,const predecessor_map &preds,std::ostream &os)
+  {
+    Preprocessor &preprocessor= getFEProblem()->getPreprocessor();
+    Domain *dom= preprocessor.getDomain();
+    StaticAnalysis *analysis= getStaticAnalysis();
+
+    std::set<const LoadCombination *> predecessors;
+    for(predecessor_map::const_iterator i= preds.begin();i!=preds.end();i++)
+      predecessors.insert(i->second);
+    MemoryDatastore *db= nullptr;
+    if(!predecessors.empty())
+      {
+        std::ostringstream name;
+        name << "load_combination_farm_" << getpid();
+        db= new MemoryDatastore(name.str(),preprocessor,FEProblem::getBroker());
+      }
+
+    std::set<const LoadCombination *> saved; //Combinations whose state is saved.
+    std::deque<std::string> failed;
+    for(combination_sequence::const_iterator i= combs.begin();i!=combs.end();i++)
+      {
+        LoadCombination *comb= *i;
+        bool ok= true;
+        preprocessor.resetLoadCase();
+        predecessor_map::const_iterator j= preds.find(comb);
+        if(j!=preds.end()) //Start from the state of the predecessor.
+          ok= ((saved.find(j->second)!=saved.end()) && (db->restore(j->second->getTag())>=0));
+        if(ok)
+          {
+            dom->addLoadCombination(comb);
+            ok= (analysis->analyze(numSteps)==0);
+            dom->removeLoadCombination(comb);
+            if(ok && (predecessors.find(comb)!=predecessors.end()))
+              {
+                if(db->save(comb->getTag())>=0)
+                  saved.insert(comb);
+              }
+          }
+        if(!ok)
+          failed.push_back(comb->getNombre());
+      }
+    if(db)
+      delete db;
+
+    farm_write(os,farm_results_magic);
+    const size_t nf= failed.size();
+    farm_write(os,nf);
+    for(std::deque<std::string>::const_iterator i= failed.begin();i!=failed.end();i++)
+      {
+        const size_t len= i->size();
+        farm_write(os,len);
+        os.write(i->data(),len);
+      }
+    int retval= 0;
+    for(Domain::recorder_iterator i= dom->recorder_begin();i!=dom->recorder_end();i++)
+      {
+        const PropEnvelopeRecorder *rec= dynamic_cast<const PropEnvelopeRecorder *>(*i);
+        if(rec)
+          retval+= rec->write_envelopes(os);
+      }
+    return retval;
+  }
+
+//! @brief Reads the results of a worker and merges its envelopes
+//! with the ones of the recorders of this process.
+int XC::LoadCombinationFarm::merge_results(std::istream &is)
+  {
+    int magic= 0;
+    farm_read(is,magic);
+    if(!is.good() || (magic!=farm_results_magic))
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; wrong results header." << std::endl;
+        return -1;
+      }
+    size_t nf= 0;
+    farm_read(is,nf);
+    std::deque<std::string> failed;
+    for(size_t i= 0;(i<nf) && is.good();i++)
+      {
+        size_t len= 0;
+        farm_read(is,len);
+        std::string name(len,' ');
+        if(len>0)
+          is.read(&name[0],len);
+        failed.push_back(name);
+      }
+    int retval= (is.good() ? 0 : -1);
+    Domain *dom= getFEProblem()->getDomain();
+    for(Domain::recorder_iterator i= dom->recorder_begin();i!=dom->recorder_end();i++)
+      {
+        PropEnvelopeRecorder *rec= dynamic_cast<PropEnvelopeRecorder *>(*i);
+        if(rec && (retval==0))
+          retval= rec->merge_envelopes(is);
+      }
+    if(retval==0)
+      failedCombinations.insert(failedCombinations.end(),failed.begin(),failed.end());
+    return retval;
+  }
+
+//! @brief Analyzes the combinations of the group in the worker processes
+//! and merges the envelopes they compute with the ones of the
+//! envelope recorders of the domain.
+//!
+//! Returns 0 if all the combinations were successfully analyzed.
+int XC::LoadCombinationFarm::analyze(LoadCombinationGroup &group)
+  {
+    failedCombinations.clear();
+    if(!getFEProblem() || !getStaticAnalysis())
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; a static analysis must be defined"
+                  << " in the solution procedure." << std::endl;
+        return -1;
+      }
+    const predecessor_map preds= getPredecessors(group);
+    const std::vector<combination_sequence> shares= schedule(group,preds);
+    const size_t nw= shares.size();
+
+    //Don't duplicate the buffered output in the workers.
+    std::cout.flush();
+    std::clog.flush();
+    std::cerr.flush();
+    fflush(nullptr);
+
+    std::vector<pid_t> pids;
+    std::vector<int> fds;
+    for(size_t k= 0;k<nw;k++)
+      {
+        int fd[2];
+        if(pipe(fd)!=0)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; can't create pipe for worker: " << k << std::endl;
+            break;
+          }
+        const pid_t pid= fork();
+        if(pid<0)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; can't start worker: " << k << std::endl;
+            close(fd[0]);
+            close(fd[1]);
+            break;
+          }
+        else if(pid==0) //Worker process.
+          {
+            //The thread pools inherited from this process run
+            //serially in the worker (see WorkerPool).
+            close(fd[0]);
+            std::ostringstream os;
+            int status= run_worker(shares[k],preds,os);
+            std::cout.flush();
+            std::clog.flush();
+            std::cerr.flush();
+            fflush(nullptr);
+            if(!write_all(fd[1],os.str()))
+              status= -1;
+            close(fd[1]);
+            _exit((status==0) ? 0 : 1);
+          }
+        close(fd[1]);
+        pids.push_back(pid);
+        fds.push_back(fd[0]);
+      }
+
+    int retval= 0;
+    for(size_t k= 0;k<nw;k++)
+      {
+        bool ok= false;
+        if(k<pids.size())
+          {
+            //Reading each pipe until EOF before waiting for the
+            //worker avoids blocking it when the pipe is full.
+            const std::string buffer= read_all(fds[k]);
+            close(fds[k]);
+            int status= 0;
+            while((waitpid(pids[k],&status,0)<0) && (errno==EINTR));
+            ok= (WIFEXITED(status) && (WEXITSTATUS(status)==0));
+            if(ok)
+              {
+                std::istringstream is(buffer);
+                ok= (merge_results(is)==0);
+              }
+          }
+        if(!ok)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; worker: " << k
+                      << " failed, its combinations are not analyzed."
+                      << std::endl;
+            for(combination_sequence::const_iterator i= shares[k].begin();i!=shares[k].end();i++)
+              failedCombinations.push_back((*i)->getNombre());
+          }
+      }
+    if(!failedCombinations.empty())
+      retval= -1;
+    return retval;
+  }
@@ -0,0 +1,89 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//LoadCombinationFarm.h
+
+#ifndef LOADCOMBINATIONFARM_H
+#define LOADCOMBINATIONFARM_H
+
+#include "xc_utils/src/nucleo/EntCmd.h"
+#include <deque>
+#include <vector>
+#include <map>
+#include <iostream>
+
+namespace XC {
+
+class ProcSolu;
+class FEProblem;
+class StaticAnalysis;
+class LoadCombination;
+class LoadCombinationGroup;
+
+//!  \ingroup Solu
+//! 
+//! @brief Analysis of the load combinations of a group in
+//! several worker processes.
+//!
+//! The worker processes are forked from the current one, so
+//! they share (copy on write) the model already built. Each
+//! worker analyzes its share of the combinations with the
+//! analysis defined in the solution procedure and, when it
+//! finishes, sends the envelopes computed by its
+//! PropEnvelopeRecorder objects to this process where they
+//! are merged with the envelopes of the same recorders. The
+//! combinations that start from the state of other combination
+//! (see LoadCombination::getPtrCombPrevia) are analyzed by
+//! the same worker that analyzes that combination.
+//!
+//! The state of the model in this process is not modified.
+class LoadCombinationFarm: public EntCmd
+  {
+  public:
+    typedef std::deque<LoadCombination *> combination_sequence;
+    typedef std::map<const LoadCombination *,LoadCombination *> predecessor_map;
+  private:
+    size_t numWorkers; //!< number of worker processes.
+    int numSteps; //!< number of steps for each combination.
+    std::deque<std::string> failedCombinations; //!< combinations whose analysis failed.
+
+    ProcSolu *getProcSolu(void);
+    FEProblem *getFEProblem(void);
+    StaticAnalysis *getStaticAnalysis(void);
+    predecessor_map getPredecessors(LoadCombinationGroup &) const;
+    std::vector<combination_sequence> schedule(LoadCombinationGroup &,const predecessor_map &) const;
+    int run_worker(const combination_sequence &,const predecessor_map &,std::ostream &);
+    int merge_results(std::istream &);
+  public:
+    LoadCombinationFarm(ProcSolu *owr);
+
+    size_t getNumWorkers(void) const;
+    void setNumWorkers(const size_t &);
+    int getNumSteps(void) const;
+    void setNumSteps(const int &);
+    boost::python::list getFailedCombinations(void) const;
+
+    int analyze(LoadCombinationGroup &);
+  };
+
+} // end of XC namespace
+
+#endif
@@ -121,6 +121,11 @@ XC::Analysis &XC::ProcSolu::newAnalysis(const std::string &nmb,const std::string
     return *theAnalysis;
   }
 
+//! @brief Return a reference to the object that analyzes load
+//! combinations in worker processes.
+XC::LoadCombinationFarm &XC::ProcSolu::getCombinationFarm(void)
+  { return combination_farm; }
+
 void XC::ProcSolu::free_mem(void)
   {
     free_analysis();
@@ -128,12 +133,15 @@ void XC::ProcSolu::free_mem(void)
 
 //! @brief Default constructor.
 XC::ProcSolu::ProcSolu(FEProblem *owr)
-  : EntCmd(owr), solu_control(this), theAnalysis(nullptr) {}
+  : EntCmd(owr), solu_control(this), theAnalysis(nullptr), combination_farm(this) {}
 
 //! @brief Copy constructor.
 XC::ProcSolu::ProcSolu(const ProcSolu &otro)
-  : EntCmd(otro), solu_control(otro.solu_control), theAnalysis(nullptr)
-  { copia_analysis(otro.theAnalysis); }
+  : EntCmd(otro), solu_control(otro.solu_control), theAnalysis(nullptr), combination_farm(otro.combination_farm)
+  {
+    copia_analysis(otro.theAnalysis);
+    combination_farm.set_owner(this);
+  }
 
 //! @brief Assignment operator.
 XC::ProcSolu &XC::ProcSolu::operator=(const ProcSolu &otro)
@@ -141,6 +149,8 @@ XC::ProcSolu &XC::ProcSolu::operator=(const ProcSolu &otro)
     EntCmd::operator=(otro);
     solu_control= otro.solu_control;
     copia_analysis(otro.theAnalysis);
+    combination_farm= otro.combination_farm;
+    combination_farm.set_owner(this);
     return *this;
   }
 
@@ -31,6 +31,7 @@
 
 #include "xc_utils/src/nucleo/EntCmd.h"
 #include "ProcSoluControl.h"
+#include "LoadCombinationFarm.h"
 
 
 namespace XC {
@@ -58,8 +59,10 @@ class ProcSolu: public EntCmd
   private:
     ProcSoluControl solu_control;//!< Control of the solution procedure.
     Analysis *theAnalysis; //! Analysis type (static, dynamic, eigenvalues,...).
+    LoadCombinationFarm combination_farm; //!< Analysis of load combinations in worker processes.
   protected:
     friend class FEProblem;
+    friend class LoadCombinationFarm;
 
     void free_analysis(void);
     bool alloc_analysis(const std::string &,const std::string &,const std::string &);
@@ -92,6 +95,7 @@ class ProcSolu: public EntCmd
     const Analysis *getAnalysisPtr(void) const;
     Analysis &getAnalysis(void);
     Analysis &newAnalysis(const std::string &,const std::string &,const std::string &);
+    LoadCombinationFarm &getCombinationFarm(void);
 
     DataOutputHandler::map_output_handlers *getOutputHandlers(void) const;
   };
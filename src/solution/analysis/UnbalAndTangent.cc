@@ -29,10 +29,12 @@
 #include "UnbalAndTangent.h"
 
 
+//! @brief Frees the vector and the matrix owned by this object (if any).
+//! Returns true if they are not taken from the storage.
 bool XC::UnbalAndTangent::free_mem(void)
   {
     // delete tangent and residual if created specially
-    if(nDOF>=unbalAndTangentArray.size())
+    if(nDOF>=unbalAndTangentArray().size())
       {
         if(theTangent) delete theTangent;
         theTangent= nullptr;
@@ -59,11 +61,6 @@ void XC::UnbalAndTangent::alloc(void)
             exit(-1);
           }
       }
-    else
-      {
-        theResidual= unbalAndTangentArray.setUnbalance(nDOF);
-        theTangent= unbalAndTangentArray.setTangent(nDOF);
-      }             
   }
 
 void XC::UnbalAndTangent::copia(const UnbalAndTangent &otro)
@@ -81,15 +78,10 @@ void XC::UnbalAndTangent::copia(const UnbalAndTangent &otro)
             exit(-1);
           }
       }
-    else
-      {
-        theResidual= otro.theResidual;
-        theTangent= otro.theTangent;
-      }             
   }
 
 //! @brief Constructor.
-XC::UnbalAndTangent::UnbalAndTangent(const size_t &n,UnbalAndTangentStorage &a)
+XC::UnbalAndTangent::UnbalAndTangent(const size_t &n,StoragePtr a)
   :nDOF(n), theResidual(nullptr), theTangent(nullptr), unbalAndTangentArray(a) 
   { alloc(); }
 
@@ -119,27 +111,35 @@ XC::UnbalAndTangent::~UnbalAndTangent(void)
 //! @brief Return the tangent stiffness matrix.
 const XC::Matrix &XC::UnbalAndTangent::getTangent(void) const
   {
-    assert(theTangent);
-    return *theTangent;
+    if(theTangent)
+      return *theTangent;
+    else
+      return *unbalAndTangentArray().setTangent(nDOF);
   }
 
 //! @brief Return the tangent stiffness matrix.
 XC::Matrix &XC::UnbalAndTangent::getTangent(void)
   {
-    assert(theTangent);
-    return *theTangent;
+    if(theTangent)
+      return *theTangent;
+    else
+      return *unbalAndTangentArray().setTangent(nDOF);
   }
 
 //! @brief Returns the residual vector.
 const XC::Vector &XC::UnbalAndTangent::getResidual(void) const
   {
-    assert(theResidual);
-    return *theResidual;
+    if(theResidual)
+      return *theResidual;
+    else
+      return *unbalAndTangentArray().setUnbalance(nDOF);
   }
 
 //! @brief Return the residual vector.
 XC::Vector &XC::UnbalAndTangent::getResidual(void)
   {
-    assert(theResidual);
-    return *theResidual;
+    if(theResidual)
+      return *theResidual;
+    else
+      return *unbalAndTangentArray().setUnbalance(nDOF);
   }
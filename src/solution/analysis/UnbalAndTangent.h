@@ -37,19 +37,27 @@ namespace XC {
 //! @ingroup Analysis
 //
 //! @brief Unbalanced force vector and y tangent stiffness matrix.
+//!
+//! If the number of DOFs is smaller than the size of the storage
+//! the vector and the matrix are taken from the storage of the
+//! calling thread, otherwise they are owned by this object.
 class UnbalAndTangent
   {
+  public:
+    //! @brief Pointer to the function that returns the storage
+    //! corresponding to the calling thread.
+    typedef UnbalAndTangentStorage &(*StoragePtr)(void);
   private:
     size_t nDOF;
-    Vector *theResidual;
-    Matrix *theTangent;
-    UnbalAndTangentStorage &unbalAndTangentArray; //!< Reference to array of class wide vectors and matrices
+    Vector *theResidual; //!< residual vector (if not taken from the storage).
+    Matrix *theTangent; //!< tangent matrix (if not taken from the storage).
+    StoragePtr unbalAndTangentArray; //!< Returns the array of class wide vectors and matrices (one for each thread)
     bool free_mem(void);
     void alloc(void);
     void copia(const UnbalAndTangent &otro);
 
   public:
-    UnbalAndTangent(const size_t &,UnbalAndTangentStorage &);
+    UnbalAndTangent(const size_t &,StoragePtr);
     UnbalAndTangent(const UnbalAndTangent &otro);
     UnbalAndTangent &operator=(const UnbalAndTangent &otro);
     virtual ~UnbalAndTangent(void);
@@ -73,7 +73,7 @@
 
 //! @brief Constructor
 XC::Linear::Linear(AnalysisAggregation *owr)
-  :EquiSolnAlgo(owr,EquiALGORITHM_TAGS_Linear) {}
+  :EquiSolnAlgo(owr,EquiALGORITHM_TAGS_Linear), factorOnce(false), tangentFormed(false) {}
 
 XC::SolutionAlgorithm *XC::Linear::getCopy(void) const
   { return new Linear(*this); }
@@ -93,12 +93,16 @@ int XC::Linear::resuelve(void)
         return -5;
       }
 
-    if(theIncIntegrator->formTangent()<0) //Builds tangent stiffness matrix.
+    if(!(factorOnce && tangentFormed)) //Otherwise reuse the factorization.
       {
-        std::cerr << getClassName() << "::" << __FUNCTION__
-                  << "; WARNING the XC::Integrator"
-                  << " failed in formTangent().\n";
-        return -1;
+        if(theIncIntegrator->formTangent()<0) //Builds tangent stiffness matrix.
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; WARNING the XC::Integrator"
+                      << " failed in formTangent().\n";
+            return -1;
+          }
+        tangentFormed= true;
       }
 
     if(theIncIntegrator->formUnbalance()<0) //Builds load vector.
@@ -153,6 +157,27 @@ int XC::Linear::solveCurrentStep(void)
     return resuelve();
   }
 
+//! @brief Sets the value of the factorOnce flag.
+//!
+//! If true the tangent stiffness matrix is formed and factored in the
+//! first step and the factorization is reused in the next steps until
+//! the model changes (the loads can change). Use it only when the
+//! tangent doesn't depend on the state of the model (i.e. linear
+//! elastic materials and linear coordinate transformations).
+void XC::Linear::setFactorOnce(const bool &b)
+  {
+    factorOnce= b;
+    tangentFormed= false;
+  }
+
+//! @brief Notifies the algorithm that the model has changed so
+//! the tangent must be formed again.
+int XC::Linear::domainChanged(void)
+  {
+    tangentFormed= false;
+    return EquiSolnAlgo::domainChanged();
+  }
+
 //! @brief Sets the convergence test to use in the analysis.
 int XC::Linear::setConvergenceTest(ConvergenceTest *theNewTest)
   { return 0; }
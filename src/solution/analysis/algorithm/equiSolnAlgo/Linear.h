@@ -95,6 +95,8 @@ namespace XC {
 //! response quantities are chosen as approximate solution quantities.
 class Linear: public EquiSolnAlgo
   {
+    bool factorOnce; //!< If true the tangent is formed (and factored) only once, until the domain changes.
+    bool tangentFormed; //!< True if the tangent has been formed since the last domain change.
     int resuelve();
   protected:
     friend class AnalysisAggregation;
@@ -105,6 +107,12 @@ class Linear: public EquiSolnAlgo
 
     int solveCurrentStep(void);
     int setConvergenceTest(ConvergenceTest *theNewTest);
+    int domainChanged(void);
+
+    //! @brief Returns true if the tangent is formed only once.
+    inline bool getFactorOnce(void) const
+      { return factorOnce; }
+    void setFactorOnce(const bool &);
     
     virtual int sendSelf(CommParameters &);
     virtual int recvSelf(const CommParameters &);
@@ -152,12 +152,14 @@ int XC::ModifiedNewton::solveCurrentStep(void)
       }
 
     // repeat until convergence is obtained or reach max num iterations
+    startForcingTerm();
     int result = -1;
     int count = 0;
     do
       {
         //Timer timer2;
         //timer2.start();
+        setForcingTerm(theSOE);
         if(theSOE->solve() < 0)
           {
             std::cerr << getClassName() << "::" << __FUNCTION__
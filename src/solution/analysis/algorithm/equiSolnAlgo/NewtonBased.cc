@@ -27,10 +27,50 @@
 //NewtonBased.cpp
 
 #include <solution/analysis/algorithm/equiSolnAlgo/NewtonBased.h>
+#include <solution/system_of_eqn/linearSOE/LinearSOE.h>
+#include <solution/system_of_eqn/linearSOE/LinearSOESolver.h>
+#include <cmath>
 
 //! @brief Constructor
 XC::NewtonBased::NewtonBased(AnalysisAggregation *owr,int classTag,int theTangentToUse)
-  :EquiSolnAlgo(owr,classTag), tangent(theTangentToUse) {}
+  :EquiSolnAlgo(owr,classTag), tangent(theTangentToUse),
+   maxForcingTerm(0.0), forcingTerm(0.0), lastNormR(0.0) {}
+
+//! @brief Initializes the forcing term at the beginning of the step.
+void XC::NewtonBased::startForcingTerm(void)
+  {
+    forcingTerm= maxForcingTerm;
+    lastNormR= 0.0;
+  }
+
+//! @brief Computes the forcing term for the next linear solution
+//! and passes it to the solver (only if it's iterative).
+//!
+//! $\eta_k= \gamma (\|r_k\|/\|r_{k-1}\|)^2$, with
+//! $\gamma= 0.9$, safeguarded to avoid its fast decrease
+//! ($\eta_k \geq \gamma \eta_{k-1}^2$ if
+//! $\gamma \eta_{k-1}^2 > 0.1$) and bounded by the maximum forcing term.
+void XC::NewtonBased::setForcingTerm(LinearSOE *theSOE)
+  {
+    if(maxForcingTerm<=0.0)
+      return;
+    LinearSOESolver *theSolver= theSOE->getSolver();
+    if(!theSolver || !theSolver->isIterative())
+      return;
+    const double gamma= 0.9;
+    const double normR= theSOE->getB().Norm();
+    if(lastNormR>0.0)
+      {
+        const double ratio= normR/lastNormR;
+        double eta= gamma*ratio*ratio;
+        const double safeguard= gamma*forcingTerm*forcingTerm;
+        if(safeguard>0.1)
+          eta= std::max(eta,safeguard);
+        forcingTerm= std::min(eta,maxForcingTerm);
+      }
+    lastNormR= normR;
+    theSolver->setForcingTerm(forcingTerm);
+  }
 
 //! @brief Send object members through the channel being passed as parameter.
 int XC::NewtonBased::sendData(CommParameters &cp)
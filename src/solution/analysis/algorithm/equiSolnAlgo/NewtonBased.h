@@ -33,20 +33,39 @@
 
 namespace XC {
 class ConvergenceTest;
+class LinearSOE;
 
 //! @ingroup EQSolAlgo
 //
 //! @brief Uses the tangent stiffness matrix on each
 //! iteration (with or without updating) until convergence is achieved.
+//!
+//! If the linear solver is iterative and the maximum forcing term
+//! is greater than zero, the linear systems are solved inexactly
+//! (inexact Newton method): the relative tolerance of each linear
+//! solution (forcing term) is computed from the reduction of
+//! the residual norm (Eisenstat-Walker, choice 2).
 class NewtonBased: public EquiSolnAlgo
   {
   protected:
     int tangent;
+    double maxForcingTerm; //!< maximum forcing term (zero: exact Newton).
+    double forcingTerm; //!< forcing term of the last iteration.
+    double lastNormR; //!< norm of the residual in the last iteration.
     int sendData(CommParameters &);
     int recvData(const CommParameters &);
 
+    void startForcingTerm(void);
+    void setForcingTerm(LinearSOE *);
+
     NewtonBased(AnalysisAggregation *,int classTag,int tangent = CURRENT_TANGENT);
   public:
+    //! @brief Return the maximum forcing term.
+    inline double getMaxForcingTerm(void) const
+      { return maxForcingTerm; }
+    //! @brief Set the maximum forcing term (zero: exact Newton).
+    inline void setMaxForcingTerm(const double &d)
+      { maxForcingTerm= d; }
     virtual int sendSelf(CommParameters &);
     virtual int recvSelf(const CommParameters &);
   };
@@ -139,6 +139,7 @@ int XC::NewtonRaphson::solveCurrentStep(void)
         return -3;
       }
 
+    startForcingTerm();
     int result = -1;
     int count = 0;
     do
@@ -174,6 +175,7 @@ int XC::NewtonRaphson::solveCurrentStep(void)
                 return -1;
               }
           }
+        setForcingTerm(theSOE);
         if(theSOE->solve() < 0)
           {
             std::cerr << getClassName() << "::" << __FUNCTION__
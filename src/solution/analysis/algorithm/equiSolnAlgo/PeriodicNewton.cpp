@@ -113,11 +113,13 @@ int XC::PeriodicNewton::solveCurrentStep(void)
       }
 
     // repeat until convergence is obtained or reach max num iterations
+    startForcingTerm();
     int result = -1;
     int count = 0;
     int iter = 0;
     do
       {
+        setForcingTerm(theSOE);
         if(theSOE->solve() < 0)
           {
             std::cerr << "WARNING XC::PeriodicNewton::solveCurrentStep() -";
@@ -33,9 +33,13 @@ class_<XC::Broyden, bases<XC::BFBRoydenBase>, boost::noncopyable >("Broyden", no
 
 class_<XC::KrylovNewton, bases<XC::EquiSolnAlgo>, boost::noncopyable >("KrylovNewton", no_init);
 
-class_<XC::Linear, bases<XC::EquiSolnAlgo>, boost::noncopyable >("Linear", no_init);
+class_<XC::Linear, bases<XC::EquiSolnAlgo>, boost::noncopyable >("Linear", no_init)
+  .add_property("factorOnce",&XC::Linear::getFactorOnce,&XC::Linear::setFactorOnce,"If true, the tangent stiffness is formed and factored only once and reused until the model changes (use it only with linear models).")
+  ;
 
-class_<XC::NewtonBased, bases<XC::EquiSolnAlgo>, boost::noncopyable >("NewtonBased", no_init);
+class_<XC::NewtonBased, bases<XC::EquiSolnAlgo>, boost::noncopyable >("NewtonBased", no_init)
+  .add_property("maxForcingTerm",&XC::NewtonBased::getMaxForcingTerm,&XC::NewtonBased::setMaxForcingTerm,"assign/retrieve the maximum forcing term (maximum relative tolerance of the iterative linear solvers in the inexact Newton method; zero means exact Newton).")
+  ;
 
 class_<XC::ModifiedNewton, bases<XC::NewtonBased>, boost::noncopyable >("ModifiedNewton", no_init);
 
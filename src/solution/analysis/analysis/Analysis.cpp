@@ -128,6 +128,18 @@ XC::AnalysisModel *XC::Analysis::getAnalysisModelPtr(void) const
       return nullptr;
   }
 
+//! @brief Applies the loads of the domain at the pseudo-time being
+//! passed as parameter (AnalysisModel::applyLoadDomain).
+void XC::Analysis::applyLoadDomain(const double &pseudoTime)
+  {
+    AnalysisModel *am= getAnalysisModelPtr();
+    if(am)
+      am->applyLoadDomain(pseudoTime);
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; analysis model not defined.\n";
+  }
+
 //! @brief Returns a pointer to the linear system of equations.
 XC::LinearSOE *XC::Analysis::getLinearSOEPtr(void) const
   {
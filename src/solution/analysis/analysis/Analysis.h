@@ -119,6 +119,7 @@ class Analysis: public EntCmd
     AnalysisAggregation *solution_method; //!< Solution method.
 
     int newStepDomain(AnalysisModel *theModel,const double &dT =0.0);
+    void applyLoadDomain(const double &);
     ProcSolu *getProcSolu(void);
     const ProcSolu *getProcSolu(void) const;    
 
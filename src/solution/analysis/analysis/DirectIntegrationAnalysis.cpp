@@ -70,6 +70,7 @@
 #include <solution/analysis/convergenceTest/ConvergenceTest.h>
 #include <solution/analysis/integrator/TransientIntegrator.h>
 #include <domain/domain/Domain.h>
+#include "utility/Profiler.h"
 
 // AddingSensitivity:BEGIN //////////////////////////////////
 #ifdef _RELIABILITY
@@ -265,7 +266,7 @@ int XC::DirectIntegrationAnalysis::analyze(int numSteps, double dT)
 //! - It then invokes domainChanged() on \p theIntegrator and
 //!   theAlgorithm to inform these objects that changes have occurred
 //!   in the model.
-//! - It invokes {\em setSize(theModel.getDOFGraph())} on {\em
+//! - It invokes {\em setSize(theModel.getCSR\_DOFGraph())} on {\em
 //!   theSOE} which causes the system of equation to determine its size
 //!   based on the connectivity of the dofs in the analysis model. 
 //! - Finally it invokes domainChanged() on \p theIntegrator and theAlgorithm. 
@@ -286,20 +287,28 @@ int XC::DirectIntegrationAnalysis::domainChanged(void)
     // causes the creation of XC::FE_Element and XC::DOF_Group objects
     // and their addition to the XC::AnalysisModel.
 
-    solution_method->getModelWrapperPtr()->getConstraintHandlerPtr()->handle();
+    {
+      ProfilerScope scope("ConstraintHandler::handle");
+      solution_method->getModelWrapperPtr()->getConstraintHandlerPtr()->handle();
+    }
     // we now invoke number() on the numberer which causes
     // equation numbers to be assigned to all the DOFs in the
     // AnalysisModel.
 
 
-    solution_method->getModelWrapperPtr()->getDOF_NumbererPtr()->numberDOF();
+    {
+      ProfilerScope scope("DOF_Numberer::numberDOF");
+      DOF_Numberer *theNumberer= solution_method->getModelWrapperPtr()->getDOF_NumbererPtr();
+      theNumberer->setStorageScheme(solution_method->getLinearSOEPtr());
+      theNumberer->numberDOF();
+    }
 
     solution_method->getModelWrapperPtr()->getConstraintHandlerPtr()->doneNumberingDOF();
 
     // we invoke setGraph() on the XC::LinearSOE which
     // causes that object to determine its size
 
-    solution_method->getLinearSOEPtr()->setSize(solution_method->getModelWrapperPtr()->getAnalysisModelPtr()->getDOFGraph());
+    solution_method->getLinearSOEPtr()->setSize(solution_method->getModelWrapperPtr()->getAnalysisModelPtr()->getCSR_DOFGraph());
 
     // we invoke domainChange() on the integrator and algorithm
     solution_method->getTransientIntegratorPtr()->domainChanged();
@@ -464,7 +473,7 @@ int XC::DirectIntegrationAnalysis::setLinearSOE(LinearSOE &theNewSOE)
       }
     else
       {
-        Graph &theGraph = solution_method->getModelWrapperPtr()->getAnalysisModelPtr()->getDOFGraph();
+        const CSRGraph &theGraph= solution_method->getModelWrapperPtr()->getAnalysisModelPtr()->getCSR_DOFGraph();
         if(solution_method->getLinearSOEPtr()->setSize(theGraph) < 0)
           {
 	    std::cerr << getClassName() << "::" << __FUNCTION__
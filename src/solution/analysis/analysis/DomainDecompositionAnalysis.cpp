@@ -238,7 +238,7 @@ int XC::DomainDecompositionAnalysis::domainChanged(void)
     // we invoke setSize() on the XC::LinearSOE which
     // causes that object to determine its size    
     
-    getLinearSOEPtr()->setSize(getAnalysisModelPtr()->getDOFGraph());    
+    getLinearSOEPtr()->setSize(getAnalysisModelPtr()->getCSR_DOFGraph());    
     numEqn= getLinearSOEPtr()->getNumEqn();
 
     // we invoke domainChange() on the integrator and algorithm
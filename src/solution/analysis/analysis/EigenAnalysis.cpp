@@ -77,6 +77,7 @@
 
 
 #include "utility/matrix/Matrix.h"
+#include "utility/Profiler.h"
 
 //! @brief Constructor.
 XC::EigenAnalysis::EigenAnalysis(AnalysisAggregation *analysis_aggregation)
@@ -142,7 +143,11 @@ int XC::EigenAnalysis::domainChanged(void)
   {
     getAnalysisModelPtr()->clearAll();    
     getConstraintHandlerPtr()->clearAll();      
-    int result= getConstraintHandlerPtr()->handle();
+    int result= 0;
+    {
+      ProfilerScope scope("ConstraintHandler::handle");
+      result= getConstraintHandlerPtr()->handle();
+    }
     if(result < 0)
       {
         std::cerr << getClassName() << "::" << __FUNCTION__ 
@@ -151,7 +156,11 @@ int XC::EigenAnalysis::domainChanged(void)
       }
 
     //Asignamos números de ecuación.
-    result= getDOF_NumbererPtr()->numberDOF();
+    {
+      ProfilerScope scope("DOF_Numberer::numberDOF");
+      getDOF_NumbererPtr()->setStorageScheme(getEigenSOEPtr());
+      result= getDOF_NumbererPtr()->numberDOF();
+    }
     if(result < 0)
       {
         std::cerr << getClassName() << "::" << __FUNCTION__
@@ -32,7 +32,7 @@
 #include "solution/analysis/algorithm/eigenAlgo/LinearBucklingAlgo.h"
 #include "solution/analysis/model/AnalysisModel.h"
 #include "solution/system_of_eqn/linearSOE/LinearSOE.h"
-#include "solution/system_of_eqn/eigenSOE/ArpackSOE.h"
+#include "solution/system_of_eqn/eigenSOE/EigenSOE.h"
 #include "solution/system_of_eqn/eigenSOE/BandArpackppSOE.h"
 #include "solution/analysis/numberer/DOF_Numberer.h"
 #include "solution/analysis/handler/ConstraintHandler.h"
@@ -110,7 +110,7 @@ int XC::LinearBucklingAnalysis::setLinearBucklingIntegrator(LinearBucklingIntegr
   { return linearBucklingEigenAnalysis.setIntegrator(theLinearBucklingIntegrator); }
 
 //! @brief Sets the linear system of equations to use in the analysis de eigenvalues.
-int XC::LinearBucklingAnalysis::setArpackSOE(ArpackSOE &theEigenSOE)
+int XC::LinearBucklingAnalysis::setEigenSOE(EigenSOE &theEigenSOE)
   { return linearBucklingEigenAnalysis.setEigenSOE(theEigenSOE); }
 
 
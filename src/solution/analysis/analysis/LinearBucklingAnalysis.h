@@ -45,7 +45,7 @@ class EigenAnalysis;
 class LinearBucklingAlgo;
 class LinearBucklingIntegrator;
 class Vector;
-class ArpackSOE;
+class EigenSOE;
 class ArpackSolver;
 
 //! @ingroup AnalysisType
@@ -75,7 +75,7 @@ class LinearBucklingAnalysis: public StaticAnalysis
 
     int setLinearBucklingAlgorithm(LinearBucklingAlgo &);
     int setLinearBucklingIntegrator(LinearBucklingIntegrator &);
-    int setArpackSOE(ArpackSOE &theSOE);
+    int setEigenSOE(EigenSOE &theSOE);
     virtual const Vector &getEigenvector(int mode);
     virtual const double &getEigenvalue(int mode) const;
   };
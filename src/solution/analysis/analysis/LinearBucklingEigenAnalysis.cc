@@ -30,7 +30,7 @@
 #include <solution/analysis/analysis/LinearBucklingEigenAnalysis.h>
 #include <solution/analysis/algorithm/eigenAlgo/LinearBucklingAlgo.h>
 #include <solution/analysis/model/AnalysisModel.h>
-#include <solution/system_of_eqn/eigenSOE/ArpackSOE.h>
+#include <solution/system_of_eqn/eigenSOE/EigenSOE.h>
 #include <solution/analysis/numberer/DOF_Numberer.h>
 #include <solution/analysis/handler/ConstraintHandler.h>
 #include <solution/analysis/integrator/eigen/LinearBucklingIntegrator.h>
@@ -74,7 +74,7 @@ int XC::LinearBucklingEigenAnalysis::setIntegrator(LinearBucklingIntegrator &the
   { return EigenAnalysis::setIntegrator(theIntegrator); }
 
 //! @brief Sets the sistema de eigenvalues to use in the analysis.
-int XC::LinearBucklingEigenAnalysis::setEigenSOE(ArpackSOE &theSOE)
+int XC::LinearBucklingEigenAnalysis::setEigenSOE(EigenSOE &theSOE)
   { return EigenAnalysis::setEigenSOE(theSOE); }
 
 //! @brief Returns the eigenvalue que corresponde al modo being passed as parameter.
@@ -35,7 +35,6 @@
 namespace XC {
   class Vector;
   class LinearBucklingAlgo;
-  class ArpackSOE;
 
 //! @ingroup AnalysisType
 //
@@ -54,7 +53,7 @@ class LinearBucklingEigenAnalysis: public EigenAnalysis
      
     virtual int setAlgorithm(LinearBucklingAlgo &theAlgo);
     virtual int setIntegrator(LinearBucklingIntegrator &theIntegrator);
-    virtual int setEigenSOE(ArpackSOE &theSOE);
+    virtual int setEigenSOE(EigenSOE &theSOE);
     virtual const double &getEigenvalue(int mode) const;
 
   };
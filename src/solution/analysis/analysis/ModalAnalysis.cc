@@ -36,7 +36,7 @@
 
 //! @brief Constructor.
 XC::ModalAnalysis::ModalAnalysis(AnalysisAggregation *analysis_aggregation)
-  :EigenAnalysis(analysis_aggregation), espectro() {}
+  :EigenAnalysis(analysis_aggregation), espectro(), modalCombination(this) {}
 
 //! @brief Returns the acceleration that corresponds to the period
 //! being passed as parameter.
@@ -31,6 +31,7 @@
 #define ModalAnalysis_h
 
 #include "EigenAnalysis.h"
+#include "ModalCombination.h"
 #include "xc_utils/src/geom/d1/func_por_puntos/FuncPorPuntosR_R.h"
 
 namespace XC {
@@ -43,6 +44,7 @@ class ModalAnalysis : public EigenAnalysis
   {
   protected:
     FuncPorPuntosR_R espectro;
+    ModalCombination modalCombination; //!< combination of the modal responses.
 
     friend class ProcSolu;
     ModalAnalysis(AnalysisAggregation *analysis_aggregation);
@@ -59,6 +61,10 @@ class ModalAnalysis : public EigenAnalysis
 
     //Equivalent static load.
     Vector getEquivalentStaticLoad(int mode) const;
+
+    //Combination of modal responses.
+    inline ModalCombination &getModalCombination(void)
+      { return modalCombination; }
   };
 
 } // end of XC namespace
@@ -0,0 +1,690 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ModalCombination.cc
+
+#include "ModalCombination.h"
+#include "ModalAnalysis.h"
+#include "domain/domain/Domain.h"
+#include "domain/mesh/node/Node.h"
+#include "domain/mesh/node/NodeIter.h"
+#include "domain/mesh/element/Element.h"
+#include "domain/mesh/element/ElementIter.h"
+#include "domain/mesh/element/utils/NodePtrsWithIDs.h"
+#include "domain/mesh/element/utils/Information.h"
+#include "utility/recorder/response/Response.h"
+#include "preprocessor/set_mgmt/SetBase.h"
+#include "utility/matrix/Matrix.h"
+#include <cmath>
+
+//! @brief Constructor.
+XC::ModalCombination::ModalCombination(ModalAnalysis *owr)
+  : EntCmd(owr), rule(CQC), dampings(1,0.05), elementResponse("force") {}
+
+//! @brief Returns the modal analysis that owns this object.
+const XC::ModalAnalysis *XC::ModalCombination::getModalAnalysis(void) const
+  { return dynamic_cast<const ModalAnalysis *>(Owner()); }
+
+//! @brief Returns the domain of the modal analysis.
+XC::Domain *XC::ModalCombination::getDomain(void)
+  {
+    Domain *retval= nullptr;
+    ModalAnalysis *analysis= dynamic_cast<ModalAnalysis *>(Owner());
+    if(analysis)
+      retval= analysis->getDomainPtr();
+    return retval;
+  }
+
+//! @brief Returns the name of the combination rule
+//! ("CQC", "SRSS" or "10%").
+std::string XC::ModalCombination::getRule(void) const
+  {
+    std::string retval= "CQC";
+    if(rule==SRSS)
+      retval= "SRSS";
+    else if(rule==TEN_PERCENT)
+      retval= "10%";
+    return retval;
+  }
+
+//! @brief Sets the combination rule ("CQC", "SRSS" or "10%").
+void XC::ModalCombination::setRule(const std::string &str)
+  {
+    if(str=="CQC" || str=="cqc")
+      rule= CQC;
+    else if(str=="SRSS" || str=="srss")
+      rule= SRSS;
+    else if(str=="10%" || str=="ten_percent")
+      rule= TEN_PERCENT;
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; unknown combination rule: '" << str
+                << "'. Available rules: 'CQC', 'SRSS' and '10%'."
+                << std::endl;
+  }
+
+//! @brief Returns the damping ratios of the modes (used in the
+//! CQC rule).
+const XC::Vector &XC::ModalCombination::getDampings(void) const
+  { return dampings; }
+
+//! @brief Sets the damping ratios of the modes (used in the
+//! CQC rule). If only one value is given, it is used for all the modes.
+void XC::ModalCombination::setDampings(const Vector &v)
+  {
+    if(v.Size()>0)
+      dampings= v;
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; empty damping vector, ignored." << std::endl;
+  }
+
+//! @brief Returns the damping ratio for each of the modes.
+XC::Vector XC::ModalCombination::get_dampings(const int &nModes) const
+  {
+    Vector retval(nModes);
+    const int sz= dampings.Size();
+    for(int i= 0;i<nModes;i++)
+      retval[i]= dampings[std::min(i,sz-1)];
+    if((sz>1) && (sz<nModes))
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; only " << sz << " damping ratios for "
+                << nModes << " modes. The last one will be used"
+                << " for the remaining modes." << std::endl;
+    return retval;
+  }
+
+//! @brief Returns the name of the element response to combine.
+const std::string &XC::ModalCombination::getElementResponseName(void) const
+  { return elementResponse; }
+
+//! @brief Sets the name of the element response to combine
+//! (see the setResponse method of the elements).
+void XC::ModalCombination::setElementResponseName(const std::string &str)
+  { elementResponse= str; }
+
+//! @brief Computes the modal participation factors for the
+//! excitation in the direction of the DOF being passed as parameter
+//! (\f$\Gamma_i= \phi_i^T M r/\phi_i^T M \phi_i\f$). The mass matrix
+//! includes both the nodal masses and the element masses.
+XC::Vector XC::ModalCombination::compute_participation_factors(Domain &dom,const int &dof) const
+  {
+    const int nModes= getModalAnalysis()->getNumModes();
+    Vector num(nModes), den(nModes);
+    // nodal masses.
+    NodeIter &theNodes= dom.getNodes();
+    Node *nodePtr= nullptr;
+    while((nodePtr= theNodes())!=nullptr)
+      {
+        if(nodePtr->getNumModes()<nModes)
+          continue;
+        const Matrix M= nodePtr->getMass();
+        const int ndf= M.noRows();
+        if((ndf==0) || (dof>=ndf))
+          continue;
+        for(int i= 0;i<nModes;i++)
+          {
+            const Vector phi= nodePtr->getEigenvector(i+1);
+            if(phi.Size()!=ndf)
+              continue;
+            const Vector Mphi= M*phi;
+            num[i]+= Mphi[dof];
+            den[i]+= dot(phi,Mphi);
+          }
+      }
+    // element masses.
+    ElementIter &theElements= dom.getElements();
+    Element *elemPtr= nullptr;
+    while((elemPtr= theElements())!=nullptr)
+      {
+        const Matrix M= elemPtr->getMass();
+        const int nDOF= M.noRows();
+        if(nDOF==0)
+          continue;
+        const NodePtrsWithIDs &elemNodes= elemPtr->getNodePtrs();
+        const size_t nn= elemNodes.size();
+        Vector r(nDOF);
+        int offset= 0;
+        bool ok= true;
+        for(size_t k= 0;k<nn;k++)
+          {
+            const Node *n= elemNodes[k];
+            const int ndf= n->getNumberDOF();
+            if((n->getNumModes()<nModes) || (offset+ndf>nDOF))
+              { ok= false; break; }
+            if(dof<ndf)
+              r[offset+dof]= 1.0;
+            offset+= ndf;
+          }
+        if(!ok || (offset!=nDOF) || (M.Norm()==0.0))
+          continue;
+        const Vector Mr= M*r;
+        Vector phi(nDOF);
+        for(int i= 0;i<nModes;i++)
+          {
+            offset= 0;
+            for(size_t k= 0;k<nn;k++)
+              {
+                const Vector phiNode= elemNodes[k]->getEigenvector(i+1);
+                const int ndf= phiNode.Size();
+                for(int j= 0;j<ndf;j++)
+                  phi[offset+j]= phiNode[j];
+                offset+= ndf;
+              }
+            num[i]+= dot(phi,Mr);
+            den[i]+= dot(phi,M*phi);
+          }
+      }
+    Vector retval(nModes);
+    for(int i= 0;i<nModes;i++)
+      if(den[i]!=0.0)
+        retval[i]= num[i]/den[i];
+    return retval;
+  }
+
+//! @brief Returns the correlation coefficients between modes for
+//! the CQC and SRSS rules.
+XC::Matrix XC::ModalCombination::get_correlation_coefficients(const Vector &omega) const
+  {
+    const int nModes= omega.Size();
+    Matrix retval(nModes,nModes);
+    if(rule==CQC)
+      retval= getModalAnalysis()->getCQCModalCrossCorrelationCoefficients(get_dampings(nModes));
+    else
+      for(int i= 0;i<nModes;i++)
+        retval(i,i)= 1.0;
+    return retval;
+  }
+
+//! @brief Combines the modal responses (\p nModes values for each row).
+//!
+//! The sign of the combined response is the one of the response
+//! of the dominant mode (the one with the greatest absolute value).
+void XC::ModalCombination::combine(const std::vector<double> &modal,const int &nModes,const Vector &omega,DirectionResults &res) const
+  {
+    const size_t nRows= modal.size()/nModes;
+    res.combined.assign(nRows,0.0);
+    res.sign.assign(nRows,1.0);
+    // coefficients of the quadratic form.
+    std::vector<double> rho(nModes*nModes,0.0);
+    if(rule==TEN_PERCENT)
+      {
+        // closely spaced modes (frequencies within 10%) are
+        // combined by absolute sum.
+        for(int i= 0;i<nModes;i++)
+          for(int j= i+1;j<nModes;j++)
+            {
+              const double wi= std::min(omega[i],omega[j]);
+              const double wj= std::max(omega[i],omega[j]);
+              if((wj-wi)<=0.1*wi)
+                rho[i*nModes+j]= 2.0;
+            }
+      }
+    else
+      {
+        const Matrix r= get_correlation_coefficients(omega);
+        for(int i= 0;i<nModes;i++)
+          for(int j= 0;j<nModes;j++)
+            rho[i*nModes+j]= r(i,j);
+      }
+    for(size_t row= 0;row<nRows;row++)
+      {
+        const double *r= &modal[row*nModes];
+        double s= 0.0;
+        double rMax= 0.0;
+        int iMax= 0;
+        for(int i= 0;i<nModes;i++)
+          {
+            const double ri= r[i];
+            if(std::fabs(ri)>rMax)
+              { rMax= std::fabs(ri); iMax= i; }
+            const double *rho_i= &rho[i*nModes];
+            if(rule==TEN_PERCENT)
+              {
+                s+= ri*ri;
+                for(int j= i+1;j<nModes;j++)
+                  s+= rho_i[j]*std::fabs(ri*r[j]);
+              }
+            else
+              {
+                double t= 0.0;
+                for(int j= 0;j<nModes;j++)
+                  t+= rho_i[j]*r[j];
+                s+= ri*t;
+              }
+          }
+        res.combined[row]= sqrt(std::max(s,0.0));
+        if(r[iMax]<0.0)
+          res.sign[row]= -1.0;
+      }
+  }
+
+//! @brief Stores the tags of the nodes and the rows
+//! that correspond to each of them. Returns the number of rows.
+size_t XC::ModalCombination::setup_nodes(Domain &dom,const ID &tags)
+  {
+    const int sz= tags.Size();
+    std::vector<int> found;
+    found.reserve(sz);
+    nodeOffsets.clear();
+    nodeOffsets.reserve(sz+1);
+    size_t row= 0;
+    for(int i= 0;i<sz;i++)
+      {
+        const Node *n= dom.getNode(tags(i));
+        if(n)
+          {
+            nodeLocations[tags(i)]= found.size();
+            found.push_back(tags(i));
+            nodeOffsets.push_back(row);
+            row+= n->getNumberDOF();
+          }
+      }
+    nodeOffsets.push_back(row);
+    nodeTags= ID(found);
+    return row;
+  }
+
+//! @brief Computes the responses of the elements to each mode (per
+//! unit modal factor) and appends them (starting at row \p firstRow)
+//! to the modal values.
+//!
+//! The displacements imposed for the i-th mode are the eigenvector
+//! scaled by \p scales[i] (the same order of magnitude as the modal
+//! displacements), the response obtained is divided by that scale.
+//!
+//! @param dom: domain.
+//! @param tags: identifiers of the elements.
+//! @param scales: scale factors for the eigenvectors.
+//! @param firstRow: first row for the element values.
+//! @param modal: modal values.
+int XC::ModalCombination::compute_element_responses(Domain &dom,const ID &tags,const Vector &scales,const size_t &firstRow,std::vector<double> &modal)
+  {
+    const int nModes= scales.Size();
+    const int sz= tags.Size();
+    std::vector<Element *> elements;
+    std::vector<Response *> responses;
+    std::vector<Vector> baseline;
+    std::vector<int> found;
+    elements.reserve(sz);
+    responses.reserve(sz);
+    baseline.reserve(sz);
+    elementOffsets.clear();
+    elementOffsets.reserve(sz+1);
+    const std::vector<std::string> args(1,elementResponse);
+    std::map<Node *,Vector> trialDisps; // current state of the nodes.
+    size_t row= firstRow;
+    for(int i= 0;i<sz;i++)
+      {
+        Element *e= dom.getElement(tags(i));
+        if(!e)
+          continue;
+        Information eleInfo(1.0);
+        Response *resp= e->setResponse(args,eleInfo);
+        elementOffsets.push_back(row);
+        elementLocations[tags(i)]= found.size();
+        found.push_back(tags(i));
+        elements.push_back(e);
+        responses.push_back(resp);
+        if(resp && (resp->getResponse()>=0))
+          {
+            baseline.push_back(resp->getInformation().getData());
+            row+= baseline.back().Size();
+            NodePtrsWithIDs &theNodes= e->getNodePtrs();
+            for(NodePtrs::iterator j= theNodes.begin();j!=theNodes.end();j++)
+              if(trialDisps.find(*j)==trialDisps.end())
+                trialDisps[*j]= (*j)->getTrialDisp();
+          }
+        else
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; element: " << tags(i)
+                      << " has no response: '" << elementResponse
+                      << "'." << std::endl;
+            baseline.push_back(Vector());
+          }
+      }
+    elementOffsets.push_back(row);
+    elementTags= ID(found);
+    modal.resize(row*nModes,0.0);
+
+    const size_t ne= elements.size();
+    for(int i= 0;i<nModes;i++)
+      {
+        const double scale= scales[i];
+        if(scale==0.0) // mode not excited.
+          continue;
+        // impose the modal displacements.
+        for(std::map<Node *,Vector>::iterator j= trialDisps.begin();j!=trialDisps.end();j++)
+          {
+            Node *n= j->first;
+            Vector disp= j->second;
+            if(n->getNumModes()>i)
+              disp.addVector(1.0,n->getEigenvector(i+1),scale);
+            n->setTrialDisp(disp);
+          }
+        // element responses.
+        for(size_t k= 0;k<ne;k++)
+          {
+            Response *resp= responses[k];
+            if(!resp)
+              continue;
+            elements[k]->update();
+            resp->getResponse();
+            const Vector &data= resp->getInformation().getData();
+            const Vector &base= baseline[k];
+            const int nc= std::min(data.Size(),base.Size());
+            const size_t offset= elementOffsets[k];
+            for(int c= 0;c<nc;c++)
+              modal[(offset+c)*nModes+i]= (data[c]-base[c])/scale;
+          }
+      }
+    // restore the state of the nodes and the elements.
+    for(std::map<Node *,Vector>::iterator j= trialDisps.begin();j!=trialDisps.end();j++)
+      j->first->setTrialDisp(j->second);
+    for(size_t k= 0;k<ne;k++)
+      {
+        if(responses[k])
+          elements[k]->update();
+        delete responses[k];
+      }
+    return 0;
+  }
+
+//! @brief Computes the combined responses for the nodes and the
+//! elements of the set and the excitation directions being passed
+//! as parameters.
+//!
+//! @param s: set with the nodes and elements whose response will be
+//!           combined.
+//! @param directions: excitation directions (i.e. 0: X, 1: Y, 2: Z).
+int XC::ModalCombination::compute(const SetBase &s,const ID &directions)
+  {
+    clear();
+    const ModalAnalysis *analysis= getModalAnalysis();
+    Domain *dom= getDomain();
+    if(!analysis || !dom)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; modal analysis or domain not set." << std::endl;
+        return -1;
+      }
+    const int nModes= analysis->getNumModes();
+    if(nModes<1)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; no modes computed yet." << std::endl;
+        return -1;
+      }
+    const Vector omega= analysis->getAngularFrequencies();
+    Vector accel(nModes);
+    for(int i= 0;i<nModes;i++)
+      accel[i]= analysis->getAcceleration(analysis->getPeriodo(i+1));
+
+    const size_t nNodeRows= setup_nodes(*dom,s.getIdNodeTags());
+    const int nd= directions.Size();
+    // factors to obtain the maximum modal displacements for
+    // each direction.
+    std::vector<Vector> factors(nd,Vector(nModes));
+    Vector scales(nModes);
+    for(int d= 0;d<nd;d++)
+      {
+        DirectionResults &res= results[directions(d)];
+        res.participationFactors= compute_participation_factors(*dom,directions(d));
+        for(int i= 0;i<nModes;i++)
+          {
+            factors[d][i]= res.participationFactors[i]*accel[i]/(omega[i]*omega[i]);
+            scales[i]= std::max(scales[i],std::fabs(factors[d][i]));
+          }
+      }
+
+    // responses to each mode (per unit modal factor).
+    std::vector<double> unit(nNodeRows*nModes,0.0);
+    const size_t nn= nodeTags.Size();
+    for(size_t k= 0;k<nn;k++)
+      {
+        const Node *n= dom->getNode(nodeTags(k));
+        const size_t offset= nodeOffsets[k];
+        const int nm= std::min(nModes,n->getNumModes());
+        for(int i= 0;i<nm;i++)
+          {
+            const Vector phi= n->getEigenvector(i+1);
+            const int ndf= std::min(size_t(phi.Size()),nodeOffsets[k+1]-offset);
+            for(int c= 0;c<ndf;c++)
+              unit[(offset+c)*nModes+i]= phi[c];
+          }
+      }
+    compute_element_responses(*dom,s.getIdElementTags(),scales,nNodeRows,unit);
+
+    // scale and combine.
+    const size_t sz= unit.size();
+    std::vector<double> modal(sz);
+    for(int d= 0;d<nd;d++)
+      {
+        const Vector &f= factors[d];
+        for(size_t j= 0;j<sz;j++)
+          modal[j]= f[j%nModes]*unit[j];
+        combine(modal,nModes,omega,results[directions(d)]);
+      }
+    return 0;
+  }
+
+//! @brief Removes the results.
+void XC::ModalCombination::clear(void)
+  {
+    nodeTags= ID();
+    nodeLocations.clear();
+    nodeOffsets.clear();
+    elementTags= ID();
+    elementLocations.clear();
+    elementOffsets.clear();
+    results.clear();
+  }
+
+//! @brief Returns the tags of the nodes whose displacements have
+//! been combined.
+const XC::ID &XC::ModalCombination::getNodeTags(void) const
+  { return nodeTags; }
+
+//! @brief Returns the tags of the elements whose responses have
+//! been combined.
+const XC::ID &XC::ModalCombination::getElementTags(void) const
+  { return elementTags; }
+
+//! @brief Returns the excitation directions already computed.
+XC::ID XC::ModalCombination::getDirections(void) const
+  {
+    ID retval(results.size());
+    int k= 0;
+    for(direction_results::const_iterator i= results.begin();i!=results.end();i++,k++)
+      retval(k)= i->first;
+    return retval;
+  }
+
+//! @brief Returns the results for the direction being passed as parameter.
+const XC::ModalCombination::DirectionResults *XC::ModalCombination::get_results(const int &dof) const
+  {
+    const DirectionResults *retval= nullptr;
+    direction_results::const_iterator i= results.find(dof);
+    if(i!=results.end())
+      retval= &(i->second);
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; results for direction: " << dof
+                << " not computed." << std::endl;
+    return retval;
+  }
+
+//! @brief Returns the modal participation factors for the
+//! excitation direction being passed as parameter.
+XC::Vector XC::ModalCombination::getModalParticipationFactors(const int &dof) const
+  {
+    Vector retval;
+    const DirectionResults *res= get_results(dof);
+    if(res)
+      retval= res->participationFactors;
+    return retval;
+  }
+
+//! @brief Returns the values of the object whose tag is being passed
+//! as parameter.
+XC::Vector XC::ModalCombination::get_values(const DirectionResults &res,const location_map &locations,const std::vector<size_t> &offsets,const int &tag,bool withSign) const
+  {
+    Vector retval;
+    const location_map::const_iterator i= locations.find(tag);
+    if(i!=locations.end())
+      {
+        const size_t k= i->second;
+        const size_t first= offsets[k];
+        const size_t sz= offsets[k+1]-first;
+        retval.resize(sz);
+        for(size_t c= 0;c<sz;c++)
+          {
+            retval[c]= res.combined[first+c];
+            if(withSign)
+              retval[c]*= res.sign[first+c];
+          }
+      }
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; object: " << tag
+                << " not found." << std::endl;
+    return retval;
+  }
+
+//! @brief Returns the values of all the objects (one row for each
+//! object, in the order of the tag list). The number of columns is
+//! the maximum number of values of an object (the remaining columns
+//! of the rows with less values are zero).
+XC::Matrix XC::ModalCombination::get_matrix(const DirectionResults &res,const std::vector<size_t> &offsets,bool withSign) const
+  {
+    const size_t nObjects= (offsets.empty() ? 0 : offsets.size()-1);
+    size_t nCols= 0;
+    for(size_t k= 0;k<nObjects;k++)
+      nCols= std::max(nCols,offsets[k+1]-offsets[k]);
+    Matrix retval(nObjects,nCols);
+    for(size_t k= 0;k<nObjects;k++)
+      {
+        const size_t first= offsets[k];
+        const size_t sz= offsets[k+1]-first;
+        for(size_t c= 0;c<sz;c++)
+          {
+            retval(k,c)= res.combined[first+c];
+            if(withSign)
+              retval(k,c)*= res.sign[first+c];
+          }
+      }
+    return retval;
+  }
+
+//! @brief Returns the combined displacement (envelope: [-u,u]) of
+//! the node for the excitation direction being passed as parameter.
+XC::Vector XC::ModalCombination::getNodeDisplacement(const int &tag,const int &dof) const
+  {
+    Vector retval;
+    const DirectionResults *res= get_results(dof);
+    if(res)
+      retval= get_values(*res,nodeLocations,nodeOffsets,tag,false);
+    return retval;
+  }
+
+//! @brief Returns the combined displacement of the node with the sign
+//! of the dominant mode for the excitation direction being passed
+//! as parameter.
+XC::Vector XC::ModalCombination::getNodeSignedDisplacement(const int &tag,const int &dof) const
+  {
+    Vector retval;
+    const DirectionResults *res= get_results(dof);
+    if(res)
+      retval= get_values(*res,nodeLocations,nodeOffsets,tag,true);
+    return retval;
+  }
+
+//! @brief Returns the combined response (envelope: [-r,r]) of
+//! the element for the excitation direction being passed as parameter.
+XC::Vector XC::ModalCombination::getElementResponse(const int &tag,const int &dof) const
+  {
+    Vector retval;
+    const DirectionResults *res= get_results(dof);
+    if(res)
+      retval= get_values(*res,elementLocations,elementOffsets,tag,false);
+    return retval;
+  }
+
+//! @brief Returns the combined response of the element with the sign
+//! of the dominant mode for the excitation direction being passed
+//! as parameter.
+XC::Vector XC::ModalCombination::getElementSignedResponse(const int &tag,const int &dof) const
+  {
+    Vector retval;
+    const DirectionResults *res= get_results(dof);
+    if(res)
+      retval= get_values(*res,elementLocations,elementOffsets,tag,true);
+    return retval;
+  }
+
+//! @brief Returns the combined displacements (envelope: [-u,u]) of
+//! the nodes for the excitation direction being passed as parameter
+//! (one row for each node, in the order of getNodeTags).
+XC::Matrix XC::ModalCombination::getNodeDisplacements(const int &dof) const
+  {
+    Matrix retval;
+    const DirectionResults *res= get_results(dof);
+    if(res)
+      retval= get_matrix(*res,nodeOffsets,false);
+    return retval;
+  }
+
+//! @brief Returns the combined displacements of the nodes with the
+//! sign of the dominant mode for the excitation direction being passed
+//! as parameter (one row for each node, in the order of getNodeTags).
+XC::Matrix XC::ModalCombination::getNodeSignedDisplacements(const int &dof) const
+  {
+    Matrix retval;
+    const DirectionResults *res= get_results(dof);
+    if(res)
+      retval= get_matrix(*res,nodeOffsets,true);
+    return retval;
+  }
+
+//! @brief Returns the combined responses (envelope: [-r,r]) of
+//! the elements for the excitation direction being passed as parameter
+//! (one row for each element, in the order of getElementTags).
+XC::Matrix XC::ModalCombination::getElementResponses(const int &dof) const
+  {
+    Matrix retval;
+    const DirectionResults *res= get_results(dof);
+    if(res)
+      retval= get_matrix(*res,elementOffsets,false);
+    return retval;
+  }
+
+//! @brief Returns the combined responses of the elements with the
+//! sign of the dominant mode for the excitation direction being passed
+//! as parameter (one row for each element, in the order of getElementTags).
+XC::Matrix XC::ModalCombination::getElementSignedResponses(const int &dof) const
+  {
+    Matrix retval;
+    const DirectionResults *res= get_results(dof);
+    if(res)
+      retval= get_matrix(*res,elementOffsets,true);
+    return retval;
+  }
@@ -0,0 +1,129 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ModalCombination.h
+
+#ifndef ModalCombination_h
+#define ModalCombination_h
+
+#include "xc_utils/src/nucleo/EntCmd.h"
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/ID.h"
+#include <vector>
+#include <map>
+#include <unordered_map>
+
+namespace XC {
+class ModalAnalysis;
+class Domain;
+class Matrix;
+class SetBase;
+
+//! @ingroup AnalysisType
+//
+//! @brief Combination of the modal responses obtained from
+//! a response spectrum analysis (CQC, SRSS or 10% rules).
+//!
+//! The maximum modal displacements of the nodes are obtained from the
+//! eigenvectors stored in the nodes, the spectral acceleration of each
+//! mode and the modal participation factors for the excitation
+//! direction (computed with the mass matrices of the nodes and the
+//! elements). The element responses are obtained imposing those modal
+//! displacements on the nodes (without solving any new system of
+//! equations) and subtracting the response in the current state, so
+//! the element loads and the current state don't contaminate the
+//! modal responses.
+//!
+//! The results are stored by rows (one row for each component of the
+//! node displacements or element responses) so the combination is
+//! computed in a single pass for all the components of the set. The
+//! element responses to each mode are computed only once and then
+//! scaled for each excitation direction. The results for the whole set
+//! can be retrieved in a single call (one row for each node or element).
+class ModalCombination: public EntCmd
+  {
+  public:
+    enum combination_rule {CQC, SRSS, TEN_PERCENT};
+  private:
+    //! @brief Combined responses for an excitation direction.
+    struct DirectionResults
+      {
+        std::vector<double> combined; //!< combined response (non negative).
+        std::vector<double> sign; //!< sign of the dominant mode response.
+        Vector participationFactors; //!< modal participation factors for the direction.
+      };
+    typedef std::map<int,DirectionResults> direction_results;
+    typedef std::unordered_map<int,size_t> location_map; //!< tag -> position in the tag list.
+
+    combination_rule rule; //!< modal combination rule.
+    Vector dampings; //!< damping ratios (one value: same damping for all modes).
+    std::string elementResponse; //!< element response to combine.
+
+    ID nodeTags; //!< nodes of the set.
+    location_map nodeLocations; //!< position of each node in nodeTags.
+    std::vector<size_t> nodeOffsets; //!< first row of each node.
+    ID elementTags; //!< elements of the set.
+    location_map elementLocations; //!< position of each element in elementTags.
+    std::vector<size_t> elementOffsets; //!< first row of each element.
+    direction_results results; //!< results for each excitation direction.
+
+    const ModalAnalysis *getModalAnalysis(void) const;
+    Domain *getDomain(void);
+    Vector get_dampings(const int &) const;
+    Vector compute_participation_factors(Domain &,const int &) const;
+    Matrix get_correlation_coefficients(const Vector &) const;
+    void combine(const std::vector<double> &,const int &,const Vector &,DirectionResults &) const;
+    size_t setup_nodes(Domain &,const ID &);
+    int compute_element_responses(Domain &,const ID &,const Vector &,const size_t &,std::vector<double> &);
+    Vector get_values(const DirectionResults &,const location_map &,const std::vector<size_t> &,const int &,bool) const;
+    Matrix get_matrix(const DirectionResults &,const std::vector<size_t> &,bool) const;
+    const DirectionResults *get_results(const int &) const;
+  public:
+    ModalCombination(ModalAnalysis *);
+
+    std::string getRule(void) const;
+    void setRule(const std::string &);
+    const Vector &getDampings(void) const;
+    void setDampings(const Vector &);
+    const std::string &getElementResponseName(void) const;
+    void setElementResponseName(const std::string &);
+
+    int compute(const SetBase &,const ID &);
+    void clear(void);
+
+    const ID &getNodeTags(void) const;
+    const ID &getElementTags(void) const;
+    ID getDirections(void) const;
+    Vector getModalParticipationFactors(const int &) const;
+
+    Vector getNodeDisplacement(const int &,const int &) const;
+    Vector getNodeSignedDisplacement(const int &,const int &) const;
+    Vector getElementResponse(const int &,const int &) const;
+    Vector getElementSignedResponse(const int &,const int &) const;
+
+    Matrix getNodeDisplacements(const int &) const;
+    Matrix getNodeSignedDisplacements(const int &) const;
+    Matrix getElementResponses(const int &) const;
+    Matrix getElementSignedResponses(const int &) const;
+  };
+} // end of XC namespace
+
+#endif
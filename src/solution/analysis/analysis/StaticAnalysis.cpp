@@ -63,8 +63,17 @@
 #include <solution/analysis/handler/ConstraintHandler.h>
 #include <solution/analysis/convergenceTest/ConvergenceTest.h>
 #include <solution/analysis/integrator/StaticIntegrator.h>
+#include <solution/analysis/integrator/static/LoadControl.h>
 #include <domain/domain/Domain.h>
 #include "solution/AnalysisAggregation.h"
+#include "domain/constraints/ConstrContainer.h"
+#include "domain/load/pattern/LoadPattern.h"
+#include "domain/load/pattern/LoadCombination.h"
+#include "domain/load/pattern/LoadCombinationGroup.h"
+#include "utility/matrix/Matrix.h"
+#include "utility/matrix/Vector.h"
+#include "utility/Profiler.h"
+#include <map>
 
 // AddingSensitivity:BEGIN //////////////////////////////////
 #ifdef _RELIABILITY
@@ -76,7 +85,7 @@ const std::string stepNumberMessage= "In a static analysis, a number of steps gr
 
 //! @brief Constructor.
 XC::StaticAnalysis::StaticAnalysis(AnalysisAggregation *analysis_aggregation)
-  :Analysis(analysis_aggregation), domainStamp(0)
+  :Analysis(analysis_aggregation), domainStamp(0), loadStamp(0)
   {
     // AddingSensitivity:BEGIN ////////////////////////////////////
 #ifdef _RELIABILITY
@@ -155,6 +164,34 @@ int XC::StaticAnalysis::check_domain_change(int num_step,int numSteps)
             return -1;
           }
       }
+    else if(getDomainPtr()->getLoadChangeStamp()!=loadStamp)
+      {
+        result= loadsChanged();
+        if(result < 0)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; loadsChanged failed"
+		      << " at step " << num_step << " of "
+		      << numSteps << std::endl;
+            return -1;
+          }
+      }
+    return result;
+  }
+
+//! @brief Method invoked during the analysis when only the loads of
+//! the domain have changed (see Domain::loadChange).
+//!
+//! The equation numbering, the DOF graph and the system of equations
+//! (and its factorization) remain valid so only the integrator
+//! is notified (some of them store a reference load vector).
+int XC::StaticAnalysis::loadsChanged(void)
+  {
+    loadStamp= getDomainPtr()->getLoadChangeStamp();
+    const int result= getStaticIntegratorPtr()->domainChanged();
+    if(result < 0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; Integrator::domainChanged() failed." << std::endl;
     return result;
   }
 
@@ -306,6 +343,204 @@ int XC::StaticAnalysis::analyze(int numSteps)
     return result;
   }
 
+//! @brief Computes the right hand sides that correspond to each
+//! one of the load patterns being passed as parameter.
+//!
+//! The last column of the matrix contains the unbalance without
+//! loads (it's not zero if the committed state is not the initial one)
+//! that is removed from the other columns.
+int XC::StaticAnalysis::form_load_patterns_rhs(const std::vector<LoadPattern *> &patterns,Matrix &XB)
+  {
+    StaticIntegrator *integ= getStaticIntegratorPtr();
+    const LinearSOE *soe= getLinearSOEPtr();
+    const double lambda= getDomainPtr()->getTimeTracker().getCurrentTime();
+    const size_t np= patterns.size();
+    const int n= XB.noRows();
+    for(size_t j= 0;j<=np;j++) // column np: no loads.
+      {
+        for(size_t k= 0;k<np;k++)
+          patterns[k]->GammaF()= ((k==j) ? 1.0 : 0.0);
+        applyLoadDomain(lambda);
+        if(integ->formUnbalance()<0)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; the integrator failed in formUnbalance()."
+                      << std::endl;
+            return -1;
+          }
+        const Vector &b= soe->getB();
+        for(int i= 0;i<n;i++)
+          XB(i,j)= b(i);
+      }
+    for(size_t j= 0;j<np;j++)
+      for(int i= 0;i<n;i++)
+        XB(i,j)-= XB(i,np);
+    return 0;
+  }
+
+//! @brief Applies the load combination and updates the domain
+//! with the displacement increment being passed as parameter
+//! (then commits the state so the recorders are called).
+int XC::StaticAnalysis::solve_load_combination(LoadCombination *comb,const Vector &deltaU)
+  {
+    Domain *dom= getDomainPtr();
+    dom->addLoadCombination(comb);
+    // applies the nodal and elemental loads of the combination.
+    applyLoadDomain(dom->getTimeTracker().getCurrentTime());
+    int result= getStaticIntegratorPtr()->update(deltaU);
+    if(result < 0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; the integrator failed to update the domain"
+                << " for combination: " << comb->getNombre()
+                << std::endl;
+    else
+      result= commit_step(0);
+    dom->removeLoadCombination(comb);
+    return result;
+  }
+
+//! @brief Performs the linear analysis of the load combinations
+//! being passed as parameter factoring the stiffness matrix only once.
+//!
+//! The stiffness matrix is formed and factored once. The right hand
+//! sides that correspond to each of the load patterns involved in the
+//! combinations are solved in one call to the solver (see
+//! LinearSOE::solve(Matrix &)) and the displacements of each combination
+//! are obtained by superposition. Then, for each combination, the
+//! combination is added to the domain, the displacements are
+//! updated (so the element forces are computed) and the state
+//! is committed (so the recorders are called).
+//!
+//! The method is intended for linear models; the load patterns must not
+//! contain single freedom constraints (imposed displacements) and
+//! the domain must not have any load pattern active. The integrator
+//! must be a LoadControl one.
+int XC::StaticAnalysis::analyzeLoadCombinations(const std::vector<LoadCombination *> &combs)
+  {
+    if(combs.empty())
+      return 0;
+    assert(solution_method);
+    Domain *dom= getDomainPtr();
+    if(!dynamic_cast<LoadControl *>(getStaticIntegratorPtr()))
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; a load control integrator is needed."
+                  << std::endl;
+        return -1;
+      }
+    if(dom->getConstraints().getNumLoadPatterns()>0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; there are load patterns in the domain ("
+                  << dom->getConstraints().getLoadPatternsNames()
+                  << "), remove them first." << std::endl;
+        return -1;
+      }
+
+    // Load patterns involved in the combinations.
+    std::vector<LoadPattern *> patterns;
+    std::map<const LoadPattern *,size_t> columns;
+    for(std::vector<LoadCombination *>::const_iterator ic= combs.begin();ic!=combs.end();ic++)
+      for(LoadCombination::iterator i= (*ic)->begin();i!=(*ic)->end();i++)
+        {
+          LoadPattern *lp= i->Caso();
+          if(lp && (columns.find(lp)==columns.end()))
+            {
+              if(lp->getNumSPs()>0)
+                {
+                  std::cerr << getClassName() << "::" << __FUNCTION__
+                            << "; load pattern: " << lp->getTag()
+                            << " has imposed displacements;"
+                            << " analyze the combinations one by one."
+                            << std::endl;
+                  return -1;
+                }
+              columns[lp]= patterns.size();
+              patterns.push_back(lp);
+            }
+        }
+    const size_t np= patterns.size();
+    const size_t nc= combs.size();
+    Matrix factors(np,nc);
+    for(size_t ic= 0;ic<nc;ic++)
+      for(LoadCombination::iterator i= combs[ic]->begin();i!=combs[ic]->end();i++)
+        if(i->Caso())
+          factors(columns[i->Caso()],ic)= i->Factor();
+
+    EntCmd *old= solution_method->Owner();
+    solution_method->set_owner(this);
+
+    for(std::vector<LoadPattern *>::iterator i= patterns.begin();i!=patterns.end();i++)
+      dom->addLoadPattern(*i);
+    int result= new_domain_step(0);
+    if(result>=0)
+      result= check_domain_change(0,1);
+    if(result>=0)
+      result= new_integrator_step(0);
+    if(result>=0)
+      if(getStaticIntegratorPtr()->formTangent()<0) //Builds tangent stiffness matrix.
+        {
+          std::cerr << getClassName() << "::" << __FUNCTION__
+                    << "; the integrator failed in formTangent()."
+                    << std::endl;
+          result= -1;
+        }
+    LinearSOE *soe= getLinearSOEPtr();
+    const int n= soe->getNumEqn();
+    Matrix XB(n,np+1);
+    if(result>=0)
+      result= form_load_patterns_rhs(patterns,XB);
+    if(result>=0)
+      if(soe->solve(XB)<0) //Factors the matrix and solves for all the columns.
+        {
+          std::cerr << getClassName() << "::" << __FUNCTION__
+                    << "; the " << soe->getClassName()
+                    << " failed in solve()." << std::endl;
+          result= -3;
+        }
+    // The combinations add its load patterns again.
+    for(std::vector<LoadPattern *>::iterator i= patterns.begin();i!=patterns.end();i++)
+      dom->removeLoadPattern(*i);
+
+    if(result>=0)
+      {
+        // Each combination starts from the state committed by the
+        // previous one so only the difference of the factors is used.
+        Vector deltaU(n);
+        Vector lastFactors(np);
+        for(size_t ic= 0;ic<nc;ic++)
+          {
+            for(int i= 0;i<n;i++)
+              deltaU(i)= ((ic==0) ? XB(i,np) : 0.0);
+            for(size_t j= 0;j<np;j++)
+              {
+                const double df= factors(j,ic)-lastFactors(j);
+                if(df!=0.0)
+                  for(int i= 0;i<n;i++)
+                    deltaU(i)+= df*XB(i,j);
+                lastFactors(j)= factors(j,ic);
+              }
+            result= solve_load_combination(combs[ic],deltaU);
+            if(result<0)
+              break;
+          }
+      }
+    solution_method->set_owner(old);
+    return result;
+  }
+
+//! @brief Performs the linear analysis of all the load combinations
+//! of the group (see analyzeLoadCombinations(const std::vector<LoadCombination *> &)).
+int XC::StaticAnalysis::analyzeLoadCombinations(LoadCombinationGroup &group)
+  {
+    std::vector<LoadCombination *> combs;
+    combs.reserve(group.size());
+    for(LoadCombinationGroup::iterator i= group.begin();i!=group.end();i++)
+      if(i->second)
+        combs.push_back(i->second);
+    return analyzeLoadCombinations(combs);
+  }
+
 int XC::StaticAnalysis::initialize(void)
   {
     Domain *the_Domain= this->getDomainPtr();
@@ -349,7 +584,7 @@ int XC::StaticAnalysis::initialize(void)
 //! dof's. Once the equation numbers have been set the numberer then
 //! invokes setID() on all the FE\_Elements in the model. Finally
 //! the numberer invokes setNumEqn() on the model.
-//! - It invokes {\em setSize(theModel.getDOFGraph())} on {\em
+//! - It invokes {\em setSize(theModel.getCSR\_DOFGraph())} on {\em
 //! theSOE} which causes the system of equation to determine its size
 //! based on the connectivity of the dofs in the analysis model. 
 //! - Finally domainChanged() is invoked on both \p theIntegrator and 
@@ -361,6 +596,7 @@ int XC::StaticAnalysis::domainChanged(void)
   {
     Domain *the_Domain= this->getDomainPtr();
     domainStamp= the_Domain->hasDomainChanged();
+    loadStamp= the_Domain->getLoadChangeStamp();
 
     getAnalysisModelPtr()->clearAll();
     getConstraintHandlerPtr()->clearAll();
@@ -369,7 +605,11 @@ int XC::StaticAnalysis::domainChanged(void)
     // causes the creation of FE_Element and DOF_Group objects
     // and their addition to the AnalysisModel.
 
-    int result= getConstraintHandlerPtr()->handle();
+    int result= 0;
+    {
+      ProfilerScope scope("ConstraintHandler::handle");
+      result= getConstraintHandlerPtr()->handle();
+    }
     if(result < 0)
       {
         std::cerr << getClassName() << "::" << __FUNCTION__
@@ -381,7 +621,11 @@ int XC::StaticAnalysis::domainChanged(void)
     // equation numbers to be assigned to all the DOFs in the
     // AnalysisModel.
 
-    result= getDOF_NumbererPtr()->numberDOF();
+    {
+      ProfilerScope scope("DOF_Numberer::numberDOF");
+      getDOF_NumbererPtr()->setStorageScheme(getLinearSOEPtr());
+      result= getDOF_NumbererPtr()->numberDOF();
+    }
     if(result < 0)
       {
         std::cerr << getClassName() << "::" << __FUNCTION__
@@ -400,7 +644,7 @@ int XC::StaticAnalysis::domainChanged(void)
 
     // we invoke setSize() on the LinearSOE which
     // causes that object to determine its size
-    Graph &theGraph= getAnalysisModelPtr()->getDOFGraph();
+    const CSRGraph &theGraph= getAnalysisModelPtr()->getCSR_DOFGraph();
 
     result= getLinearSOEPtr()->setSize(theGraph);
     if(result < 0)
@@ -62,9 +62,15 @@
 // What: "@(#) StaticAnalysis.h, revA"
 
 #include <solution/analysis/analysis/Analysis.h>
+#include <vector>
 
 namespace XC {
 class ConvergenceTest;
+class LoadCombination;
+class LoadCombinationGroup;
+class LoadPattern;
+class Matrix;
+class Vector;
 
 // AddingSensitivity:BEGIN ///////////////////////////////
 #ifdef _RELIABILITY
@@ -79,6 +85,7 @@ class StaticAnalysis: public Analysis
   {
   protected:
     int domainStamp;
+    int loadStamp; //!< Load stamp of the domain when the integrator was last notified.
 
 // AddingSensitivity:BEGIN ///////////////////////////////
 #ifdef _RELIABILITY
@@ -88,11 +95,14 @@ class StaticAnalysis: public Analysis
 
     int new_domain_step(int num_step);
     int check_domain_change(int num_step,int numSteps);
+    int loadsChanged(void);
     int new_integrator_step(int num_step);
     int solve_current_step(int num_step);
     int compute_sensitivities_step(int num_step);
     int commit_step(int num_step);
     int run_analysis_step(int num_step,int numSteps);
+    int form_load_patterns_rhs(const std::vector<LoadPattern *> &,Matrix &);
+    int solve_load_combination(LoadCombination *,const Vector &);
 
     friend class ProcSolu;
     StaticAnalysis(AnalysisAggregation *analysis_aggregation);
@@ -104,6 +114,8 @@ class StaticAnalysis: public Analysis
     void clearAll(void);	    
     
     virtual int analyze(int numSteps);
+    int analyzeLoadCombinations(const std::vector<LoadCombination *> &);
+    int analyzeLoadCombinations(LoadCombinationGroup &);
     int initialize(void);
     int domainChanged(void);
 
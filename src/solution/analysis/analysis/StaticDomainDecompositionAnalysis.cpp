@@ -249,7 +249,7 @@ int XC::StaticDomainDecompositionAnalysis::domainChanged(void)
 
   // we invoke setSize() on the XC::LinearSOE which
   // causes that object to determine its size
-  Graph &theGraph = getAnalysisModelPtr()->getDOFGraph();
+  const CSRGraph &theGraph= getAnalysisModelPtr()->getCSR_DOFGraph();
   result = getLinearSOEPtr()->setSize(theGraph);
   if (result < 0) {
     std::cerr << "XC::StaticDomainDecompositionAnalysis::handle() - ";
@@ -25,9 +25,11 @@ class_<XC::Analysis, bases<EntCmd>, boost::noncopyable >("Analysis", no_init)
   .add_property("getAnalysisResult", &XC::Analysis::getAnalysisResult)
   ;
 
+int (XC::StaticAnalysis::*analyzeLoadCombinationGroup)(XC::LoadCombinationGroup &)= &XC::StaticAnalysis::analyzeLoadCombinations;
 class_<XC::StaticAnalysis, bases<XC::Analysis>, boost::noncopyable >("StaticAnalysis", no_init)
   .def("analyze", &XC::StaticAnalysis::analyze,"Performs the analysis. A number of steps greater than 1 is useless if the loads are constant.")
   .def("initialize", &XC::StaticAnalysis::initialize,"Initialize analysis.")
+  .def("analyzeLoadCombinations", analyzeLoadCombinationGroup,"Performs the linear analysis of all the combinations of the group factoring the stiffness matrix only once (the recorders are called after each combination).")
     ;
 
 class_<XC::EigenAnalysis , bases<XC::Analysis>, boost::noncopyable >("EigenAnalysis", no_init)
@@ -73,9 +75,30 @@ class_<XC::LinearBucklingEigenAnalysis, bases<XC::EigenAnalysis>, boost::noncopy
   .def("getEigenvalue", make_function(&XC::LinearBucklingEigenAnalysis::getEigenvalue, return_value_policy<copy_const_reference>()) )
   ;
 
+class_<XC::ModalCombination, bases<EntCmd>, boost::noncopyable >("ModalCombination", no_init)
+  .add_property("rule", &XC::ModalCombination::getRule, &XC::ModalCombination::setRule,"Modal combination rule: 'CQC', 'SRSS' or '10%'.")
+  .add_property("dampings", make_function(&XC::ModalCombination::getDampings,return_internal_reference<>()), &XC::ModalCombination::setDampings,"Damping ratios of the modes for the CQC rule (if only one value is given it is used for all the modes).")
+  .add_property("elementResponse", make_function(&XC::ModalCombination::getElementResponseName,return_value_policy<copy_const_reference>()), &XC::ModalCombination::setElementResponseName,"Name of the element response to combine (i.e. 'force').")
+  .def("compute",&XC::ModalCombination::compute,"compute(set,directions) computes the combined responses of the nodes and elements of the set for each of the excitation directions (i.e. xc.ID([0,1])).")
+  .def("clear",&XC::ModalCombination::clear,"Removes the results.")
+  .add_property("nodeTags", make_function(&XC::ModalCombination::getNodeTags,return_internal_reference<>()),"Tags of the nodes.")
+  .add_property("elementTags", make_function(&XC::ModalCombination::getElementTags,return_internal_reference<>()),"Tags of the elements.")
+  .add_property("directions", &XC::ModalCombination::getDirections,"Excitation directions computed.")
+  .def("getModalParticipationFactors",&XC::ModalCombination::getModalParticipationFactors,"getModalParticipationFactors(direction) returns the modal participation factors for the excitation direction.")
+  .def("getNodeDisplacement",&XC::ModalCombination::getNodeDisplacement,"getNodeDisplacement(nodeTag,direction) returns the combined displacement of the node (envelope [-u,u]).")
+  .def("getNodeSignedDisplacement",&XC::ModalCombination::getNodeSignedDisplacement,"getNodeSignedDisplacement(nodeTag,direction) returns the combined displacement of the node with the sign of the dominant mode.")
+  .def("getElementResponse",&XC::ModalCombination::getElementResponse,"getElementResponse(elementTag,direction) returns the combined response of the element (envelope [-r,r]).")
+  .def("getElementSignedResponse",&XC::ModalCombination::getElementSignedResponse,"getElementSignedResponse(elementTag,direction) returns the combined response of the element with the sign of the dominant mode.")
+  .def("getNodeDisplacements",&XC::ModalCombination::getNodeDisplacements,"getNodeDisplacements(direction) returns a matrix with the combined displacements of the nodes (one row for each node, in the order of nodeTags).")
+  .def("getNodeSignedDisplacements",&XC::ModalCombination::getNodeSignedDisplacements,"getNodeSignedDisplacements(direction) returns a matrix with the combined displacements of the nodes with the sign of the dominant mode (one row for each node, in the order of nodeTags).")
+  .def("getElementResponses",&XC::ModalCombination::getElementResponses,"getElementResponses(direction) returns a matrix with the combined responses of the elements (one row for each element, in the order of elementTags).")
+  .def("getElementSignedResponses",&XC::ModalCombination::getElementSignedResponses,"getElementSignedResponses(direction) returns a matrix with the combined responses of the elements with the sign of the dominant mode (one row for each element, in the order of elementTags).")
+  ;
+
 class_<XC::ModalAnalysis , bases<XC::EigenAnalysis>, boost::noncopyable >("ModalAnalysis", no_init)
   .add_property("spectrum", make_function(&XC::ModalAnalysis::getSpectrum,return_internal_reference<>()),&XC::ModalAnalysis::setSpectrum,"Response spectrum,") 
   .def("getCQCModalCrossCorrelationCoefficients",&XC::ModalAnalysis::getCQCModalCrossCorrelationCoefficients,"Returns CQC correlation coefficients.")
+  .add_property("getModalCombination", make_function(&XC::ModalAnalysis::getModalCombination,return_internal_reference<>()),"Returns the object that combines the modal responses (CQC, SRSS, 10%).")
   ;
 
 
@@ -0,0 +1,132 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ElementContributions.cc
+
+#include "ElementContributions.h"
+#include <functional>
+#include <solution/analysis/model/fe_ele/FE_Element.h>
+#include <solution/analysis/model/AnalysisModel.h>
+#include <solution/analysis/model/FE_EleIter.h>
+#include <solution/system_of_eqn/linearSOE/LinearSOE.h>
+
+namespace XC {
+
+//! @brief Computes the tangent matrices of the elements in the
+//! range [begin,end).
+void form_tangents(Integrator *integ,const std::vector<FE_Element *> &eles,std::vector<Matrix> &tangs,const size_t &begin,const size_t &end)
+  {
+    for(size_t i= begin;i<end;i++)
+      tangs[i]= eles[i]->getTangent(integ);
+  }
+
+//! @brief Computes the residual vectors of the elements in the
+//! range [begin,end).
+void form_residuals(Integrator *integ,const std::vector<FE_Element *> &eles,std::vector<Vector> &resids,const size_t &begin,const size_t &end)
+  {
+    for(size_t i= begin;i<end;i++)
+      resids[i]= eles[i]->getResidual(integ);
+  }
+
+} // end of XC namespace
+
+//! @brief Constructor.
+XC::ElementContributions::ElementContributions(void)
+  {}
+
+//! @brief Updates the list of the model FE_Elements.
+void XC::ElementContributions::fill_elements(AnalysisModel &mdl)
+  {
+    elements.clear();
+    FE_Element *elePtr= nullptr;
+    FE_EleIter &theEles= mdl.getFEs();
+    while((elePtr= theEles()) != nullptr)
+      elements.push_back(elePtr);
+  }
+
+//! @brief Set the number of threads used to compute the element
+//! contributions. The threads are kept alive between calls.
+void XC::ElementContributions::setNumThreads(const size_t &n)
+  { workers.setNumThreads(n); }
+
+//! @brief Computes the tangent matrices of the elements using
+//! the worker threads.
+int XC::ElementContributions::formTangents(AnalysisModel &mdl,Integrator *integ)
+  {
+    fill_elements(mdl);
+    const size_t sz= elements.size();
+    tangents.resize(sz);
+    workers.run_blocks(std::bind(form_tangents,integ,std::cref(elements),std::ref(tangents),std::placeholders::_1,std::placeholders::_2),sz);
+    return 0;
+  }
+
+//! @brief Adds the element tangent matrices to the system of equations
+//! (in the same order that the serial algorithm uses).
+int XC::ElementContributions::addTangents(LinearSOE &theSOE) const
+  {
+    int retval= 0;
+    const size_t sz= elements.size();
+    for(size_t i= 0;i<sz;i++)
+      if(elements[i]->addA(theSOE,tangents[i]) < 0)
+        {
+	  std::cerr << "ElementContributions::" << __FUNCTION__
+		    << "; WARNING failed in addA for ID "
+		    << elements[i]->getID();
+	  retval= -3;
+	}
+    return retval;
+  }
+
+//! @brief Computes the residual vectors of the elements using
+//! the worker threads.
+int XC::ElementContributions::formResiduals(AnalysisModel &mdl,Integrator *integ)
+  {
+    fill_elements(mdl);
+    const size_t sz= elements.size();
+    residuals.resize(sz);
+    workers.run_blocks(std::bind(form_residuals,integ,std::cref(elements),std::ref(residuals),std::placeholders::_1,std::placeholders::_2),sz);
+    return 0;
+  }
+
+//! @brief Adds the element residual vectors to the system of equations
+//! (in the same order that the serial algorithm uses).
+int XC::ElementContributions::addResiduals(LinearSOE &theSOE) const
+  {
+    int retval= 0;
+    const size_t sz= elements.size();
+    for(size_t i= 0;i<sz;i++)
+      if(theSOE.addB(residuals[i],elements[i]->getID()) < 0)
+        {
+	  std::cerr << "ElementContributions::" << __FUNCTION__
+		    << "; WARNING failed in addB for ID: "
+		    << elements[i]->getID();
+	  retval= -2;
+	}
+    return retval;
+  }
+
+//! @brief Frees the memory used by the buffers.
+void XC::ElementContributions::clear(void)
+  {
+    elements.clear();
+    tangents.clear();
+    residuals.clear();
+  }
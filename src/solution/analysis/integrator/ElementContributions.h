@@ -0,0 +1,78 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ElementContributions.h
+
+#ifndef ElementContributions_h
+#define ElementContributions_h
+
+#include <vector>
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/Matrix.h"
+#include "utility/WorkerPool.h"
+
+namespace XC {
+class FE_Element;
+class AnalysisModel;
+class Integrator;
+class LinearSOE;
+
+//! @ingroup AnalysisIntegrator
+//
+//! @brief Buffers for the tangent matrices and residual vectors of
+//! the FE_Elements of the analysis model.
+//!
+//! The element contributions are computed in parallel (each thread
+//! takes a contiguous block of elements and stores the results in
+//! the buffer reserved for each element) and then they are added to
+//! the system of equations sequentially, in the same order used by
+//! the serial algorithm. This way there are no write conflicts in the
+//! system of equations and the results are bit-for-bit identical
+//! whatever the number of threads.
+//!
+//! The element state determination (getTangentStiff, getResistingForce,...)
+//! runs concurrently, so the element classes must not share
+//! work buffers between threads.
+class ElementContributions
+  {
+  private:
+    std::vector<FE_Element *> elements; //!< FE_Elements in iteration order.
+    std::vector<Matrix> tangents; //!< element tangent matrices.
+    std::vector<Vector> residuals; //!< element residual vectors.
+    WorkerPool workers; //!< threads that compute the contributions.
+
+    void fill_elements(AnalysisModel &);
+  public:
+    ElementContributions(void);
+
+    //! @brief Return the number of threads.
+    inline size_t getNumThreads(void) const
+      { return workers.getNumThreads(); }
+    void setNumThreads(const size_t &);
+    int formTangents(AnalysisModel &,Integrator *);
+    int addTangents(LinearSOE &) const;
+    int formResiduals(AnalysisModel &,Integrator *);
+    int addResiduals(LinearSOE &) const;
+    void clear(void);
+  };
+} // end of XC namespace
+
+#endif
@@ -65,15 +65,109 @@
 #include <solution/analysis/model/dof_grp/DOF_Group.h>
 #include <solution/analysis/model/FE_EleIter.h>
 #include <solution/analysis/model/DOF_GrpIter.h>
+#include <solution/analysis/model/FE_EleConstIter.h>
+#include <solution/analysis/model/DOF_GrpConstIter.h>
+#include "utility/Profiler.h"
+#include <algorithm>
 
 
 //! @brief Constructor.
 //!
 //! @param owr: set of objects used to perform the analysis.
 XC::IncrementalIntegrator::IncrementalIntegrator(AnalysisAggregation *owr,int clasTag)
-  : Integrator(owr,clasTag), statusFlag(CURRENT_TANGENT) {}
+  : Integrator(owr,clasTag), statusFlag(CURRENT_TANGENT), numThreads(1) {}
+
+//! @brief Set the number of threads used to form the element
+//! tangents and residuals.
+//!
+//! If the number of threads is greater than one, the element
+//! contributions are computed concurrently and then added to the
+//! system of equations in the same order as in the serial
+//! case (see ElementContributions). The worker threads are created
+//! here and reused in each call to formTangent and formUnbalance.
+void XC::IncrementalIntegrator::setNumThreads(const size_t &n)
+  {
+    numThreads= std::max(size_t(1),n);
+    eleContributions.setNumThreads(numThreads);
+    if(numThreads==1)
+      eleContributions.clear();
+  }
+
+//! @brief Adds the element tangents to the system of equations.
+//!
+//! If numThreads is greater than one the element tangents are
+//! computed in parallel.
+int XC::IncrementalIntegrator::formElementTangent(void)
+  {
+    int result= 0;
+    AnalysisModel *mdl= getAnalysisModelPtr();
+    LinearSOE *theSOE= getLinearSOEPtr();
+    if(numThreads>1)
+      {
+        eleContributions.formTangents(*mdl,this);
+        result= eleContributions.addTangents(*theSOE);
+      }
+    else
+      {
+        FE_Element *elePtr;
+        FE_EleIter &theEles2= mdl->getFEs();    
+        while((elePtr = theEles2()) != 0)     
+          if(elePtr->addA(*theSOE,elePtr->getTangent(this)) < 0)
+            {
+	      std::cerr << getClassName() << "::" << __FUNCTION__
+		        << "; WARNING failed in addA for ID "
+		        << elePtr->getID();	    
+	      result = -3;
+	    }
+      }
+    return result;
+  }
 
 
+//! @brief Returns the number of bytes assembled in the system of
+//! equations by the FE_Elements and DOF_Groups of the model (used
+//! by the profiler).
+//!
+//! The sizes only change with the graph of the system, so they
+//! are computed again only when its graph stamp changes.
+//! @param matrix: if true return the bytes of the tangent matrices
+//! otherwise the bytes of the residual vectors.
+//! @param dofGroups: if true include the contributions of the DOF_Groups.
+size_t XC::IncrementalIntegrator::assembled_bytes(const bool &matrix,const bool &dofGroups)
+  {
+    const LinearSOE *theSOE= getLinearSOEPtr();
+    const size_t stamp= (theSOE ? theSOE->getGraphStamp() : 0);
+    if((stamp==0) || (stamp!=assembledSizes.graphStamp))
+      {
+        assembledSizes= AssembledSizes();
+        const AnalysisModel *mdl= getAnalysisModelPtr();
+        if(mdl)
+          {
+            const FE_Element *elePtr= nullptr;
+            FE_EleConstIter &theEles= mdl->getConstFEs();
+            while((elePtr= theEles()) != nullptr)
+              {
+                const size_t n= elePtr->getID().Size();
+                assembledSizes.eleMatrix+= n*n;
+                assembledSizes.eleVector+= n;
+              }
+            const DOF_Group *dofGroupPtr= nullptr;
+            DOF_GrpConstIter &theDOFGroups= mdl->getConstDOFs();
+            while((dofGroupPtr= theDOFGroups()) != nullptr)
+              {
+                const size_t n= dofGroupPtr->getID().Size();
+                assembledSizes.dofMatrix+= n*n;
+                assembledSizes.dofVector+= n;
+              }
+          }
+        assembledSizes.graphStamp= stamp;
+      }
+    size_t retval= (matrix ? assembledSizes.eleMatrix : assembledSizes.eleVector);
+    if(dofGroups)
+      retval+= (matrix ? assembledSizes.dofMatrix : assembledSizes.dofVector);
+    return retval*sizeof(double);
+  }
+
 //! @brief Builds tangent stiffness matrix.
 //!
 //! Invoked to form the structure tangent matrix. The method first loops
@@ -96,6 +190,7 @@ XC::IncrementalIntegrator::IncrementalIntegrator(AnalysisAggregation *owr,int cl
 //! parallel programming. THIS MAY CHANGE TO REDUCE MEMORY DEMANDS.  
 int XC::IncrementalIntegrator::formTangent(int statFlag)
   {
+    ProfilerScope scope("IncrementalIntegrator::formTangent");
     int result = 0;
     statusFlag = statFlag;
     AnalysisModel *mdl= getAnalysisModelPtr();
@@ -114,16 +209,9 @@ int XC::IncrementalIntegrator::formTangent(int statFlag)
     // efficiency when performing parallel computations - CHANGE
 
     // loop through the FE_Elements adding their contributions to the tangent
-    FE_Element *elePtr;
-    FE_EleIter &theEles2= mdl->getFEs();    
-    while((elePtr = theEles2()) != 0)     
-      if(theSOE->addA(elePtr->getTangent(this),elePtr->getID()) < 0)
-        {
-	  std::cerr << getClassName() << "::" << __FUNCTION__
-		    << "; WARNING failed in addA for ID "
-		    << elePtr->getID();	    
-	  result = -3;
-	}
+    result= formElementTangent();
+    if(scope.isActive())
+      scope.addBytes(assembled_bytes(true,false));
     return result;
   }
 
@@ -144,6 +232,7 @@ int XC::IncrementalIntegrator::formTangent(int statFlag)
 //! negative number is returned. Returns \f$0\f$ if successful. 
 int XC::IncrementalIntegrator::formUnbalance(void)
   {
+    ProfilerScope scope("IncrementalIntegrator::formUnbalance");
     AnalysisModel *mdl= getAnalysisModelPtr();
     LinearSOE *theSOE= getLinearSOEPtr();
     if((!mdl) || (!theSOE))
@@ -168,6 +257,8 @@ int XC::IncrementalIntegrator::formUnbalance(void)
 		  << "; WARNING: this->formNodalUnbalance failed\n";
 	return -2;
       }
+    if(scope.isActive())
+      scope.addBytes(assembled_bytes(false,true));
     return 0;
   }
   
@@ -343,16 +434,24 @@ int XC::IncrementalIntegrator::formElementResidual(void)
 
     LinearSOE *theSOE= getLinearSOEPtr();
     AnalysisModel *mdl= getAnalysisModelPtr();
-    FE_EleIter &theEles2 = mdl->getFEs();
-    while((elePtr= theEles2()) != nullptr)
+    if(numThreads>1)
       {
-	if(theSOE->addB(elePtr->getResidual(this),elePtr->getID()) <0)
+        eleContributions.formResiduals(*mdl,this);
+        res= eleContributions.addResiduals(*theSOE);
+      }
+    else
+      {
+        FE_EleIter &theEles2 = mdl->getFEs();
+        while((elePtr= theEles2()) != nullptr)
           {
-	    std::cerr << getClassName() << "::" << __FUNCTION__
-		      << "; WARNING failed in addB for ID: "
-		      << elePtr->getID();
-	    res = -2;
-	  }
+	    if(theSOE->addB(elePtr->getResidual(this),elePtr->getID()) <0)
+              {
+	        std::cerr << getClassName() << "::" << __FUNCTION__
+		          << "; WARNING failed in addB for ID: "
+		          << elePtr->getID();
+	        res = -2;
+	      }
+          }
       }
     return res;	    
   }
@@ -66,6 +66,7 @@
 // What: "@(#) IncrementalIntegrator.h, revA"
 
 #include <solution/analysis/integrator/Integrator.h>
+#include <solution/analysis/integrator/ElementContributions.h>
 
 namespace XC {
 class LinearSOE;
@@ -102,7 +103,25 @@ class IncrementalIntegrator : public Integrator
     friend class IntegratorVectors;
     virtual int formNodalUnbalance(void);        
     virtual int formElementResidual(void);
+    int formElementTangent(void);
+    //! @brief Number of coefficients assembled by the FE_Elements
+    //! and DOF_Groups (computed again when the graph stamp of the
+    //! system of equations changes, see assembled_bytes).
+    struct AssembledSizes
+      {
+        size_t graphStamp; //!< graph stamp of the system when computed.
+        size_t eleMatrix; //!< coefficients of the element tangents.
+        size_t eleVector; //!< coefficients of the element residuals.
+        size_t dofMatrix; //!< coefficients of the DOF group tangents.
+        size_t dofVector; //!< coefficients of the DOF group residuals.
+        AssembledSizes(void)
+          : graphStamp(0), eleMatrix(0), eleVector(0), dofMatrix(0), dofVector(0) {}
+      };
+    AssembledSizes assembledSizes;
+    size_t assembled_bytes(const bool &,const bool &);
     int statusFlag;
+    size_t numThreads; //!< number of threads used to form the element contributions.
+    ElementContributions eleContributions; //!< element tangents and residuals (multithreaded assembly).
 
     IncrementalIntegrator(AnalysisAggregation *,int classTag);
   public:
@@ -110,6 +129,12 @@ class IncrementalIntegrator : public Integrator
     virtual int formTangent(int statusFlag = CURRENT_TANGENT);    
     virtual int formUnbalance(void);
 
+    //! @brief Return the number of threads used to form the element
+    //! tangents and residuals.
+    inline size_t getNumThreads(void) const
+      { return numThreads; }
+    void setNumThreads(const size_t &);
+
     // pure virtual methods to define the FE_ELe and DOF_Group contributions
     //! @brief To inform the FE\_Element how to build its tangent matrix for
     //! addition to the system of equations.
@@ -24,7 +24,9 @@ class_<XC::Integrator, bases<XC::MovableObject,EntCmd>, boost::noncopyable >("In
 
 class_<XC::EigenIntegrator, bases<XC::Integrator>, boost::noncopyable >("EigenIntegrator", no_init);
 
-class_<XC::IncrementalIntegrator, bases<XC::Integrator>, boost::noncopyable >("IncrementalIntegrator", no_init);
+class_<XC::IncrementalIntegrator, bases<XC::Integrator>, boost::noncopyable >("IncrementalIntegrator", no_init)
+  .add_property("numThreads",&XC::IncrementalIntegrator::getNumThreads,&XC::IncrementalIntegrator::setNumThreads,"assign/retrieve the number of threads used to form the element tangents and residuals (1: serial assembly).")
+  ;
 
 class_<XC::StaticIntegrator, bases<XC::IncrementalIntegrator>, boost::noncopyable >("StaticIntegrator", no_init);
 
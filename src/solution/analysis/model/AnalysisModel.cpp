@@ -100,7 +100,8 @@ XC::AnalysisModel::AnalysisModel(ModelWrapper *owr)
    numFE_Ele(0), numDOF_Grp(0), numEqn(0),
    theFEs(this,256,"FEs"), theDOFGroups(this,256,"DOFs"), theFEiter(&theFEs), theDOFGroupiter(&theDOFGroups),
    theFEconst_iter(&theFEs), theDOFGroupconst_iter(&theDOFGroups),
-   myDOFGraph(*this), myGroupGraph(*this), updateGraphs(false) {}
+   myDOFGraph(*this), myGroupGraph(*this), updateDOFGraph(false), updateGroupGraph(false),
+   updateCSR_DOFGraph(true), updateCSR_GroupGraph(true) {}
 
 //! @brief Constructor.
 //!
@@ -112,7 +113,8 @@ XC::AnalysisModel::AnalysisModel(int theClassTag,EntCmd *owr)
    numFE_Ele(0), numDOF_Grp(0), numEqn(0),
    theFEs(this,1024,"FEs"), theDOFGroups(this,1024,"DOFs"),theFEiter(&theFEs), theDOFGroupiter(&theDOFGroups),
    theFEconst_iter(&theFEs), theDOFGroupconst_iter(&theDOFGroups),
-   myDOFGraph(*this), myGroupGraph(*this), updateGraphs(false) {}
+   myDOFGraph(*this), myGroupGraph(*this), updateDOFGraph(false), updateGroupGraph(false),
+   updateCSR_DOFGraph(true), updateCSR_GroupGraph(true) {}
 
 //! @brief Copy constructor.
 XC::AnalysisModel::AnalysisModel(const AnalysisModel &otro)
@@ -120,7 +122,8 @@ XC::AnalysisModel::AnalysisModel(const AnalysisModel &otro)
    numFE_Ele(otro.numFE_Ele), numDOF_Grp(otro.numDOF_Grp), numEqn(otro.numEqn),
    theFEs(otro.theFEs), theDOFGroups(otro.theDOFGroups),theFEiter(&theFEs), theDOFGroupiter(&theDOFGroups),
    theFEconst_iter(&theFEs), theDOFGroupconst_iter(&theDOFGroups),
-   myDOFGraph(*this), myGroupGraph(*this), updateGraphs(false) {}
+   myDOFGraph(*this), myGroupGraph(*this), updateDOFGraph(false), updateGroupGraph(false),
+   updateCSR_DOFGraph(true), updateCSR_GroupGraph(true) {}
 
 //! @brief Assignment operator.
 XC::AnalysisModel &XC::AnalysisModel::operator=(const AnalysisModel &otro)
@@ -134,7 +137,10 @@ XC::AnalysisModel &XC::AnalysisModel::operator=(const AnalysisModel &otro)
     theDOFGroups= otro.theDOFGroups;
     myDOFGraph= DOF_Graph(*this);
     myGroupGraph= DOF_GroupGraph(*this);
-    updateGraphs= false; //Los acabamos de actualizar
+    updateDOFGraph= false; //Los acabamos de actualizar
+    updateGroupGraph= false;
+    updateCSR_DOFGraph= true;
+    updateCSR_GroupGraph= true;
     return *this;
   }
 
@@ -191,7 +197,7 @@ bool XC::AnalysisModel::addFE_Element(FE_Element *theElement)
 	      {
 		theElement->setAnalysisModel(*this);
 		numFE_Ele++;
-		updateGraphs= true;
+		graphsChanged();
 	      }
 	  }
       }
@@ -384,7 +390,7 @@ bool XC::AnalysisModel::addDOF_Group(DOF_Group *theGroup)
     if(result == true)
       {
         numDOF_Grp++;
-        updateGraphs= true;
+        graphsChanged();
         return true;  // o.k.
       }
     else
@@ -518,7 +524,7 @@ void XC::AnalysisModel::clearAll(void)
     numFE_Ele=0;
     numDOF_Grp= 0;
     numEqn= 0;    
-    updateGraphs= true;
+    graphsChanged();
   }
 
 
@@ -542,7 +548,7 @@ XC::DOF_Group *XC::AnalysisModel::getDOF_GroupPtr(int tag)
     TaggedObject *other= theDOFGroups.getComponentPtr(tag);
     if(other)
       result= dynamic_cast<DOF_Group *>(other);
-    updateGraphs= true;
+    graphsChanged();
     return result;
   }
 
@@ -561,7 +567,7 @@ const XC::DOF_Group *XC::AnalysisModel::getDOF_GroupPtr(int tag) const
 XC::FE_EleIter &XC::AnalysisModel::getFEs()
   {
     theFEiter.reset();
-    updateGraphs= true;
+    graphsChanged();
     return theFEiter;
   }
 
@@ -575,7 +581,7 @@ XC::FE_EleConstIter &XC::AnalysisModel::getConstFEs() const
 XC::DOF_GrpIter &XC::AnalysisModel::getDOFGroups()
   {
     theDOFGroupiter.reset();
-    updateGraphs= true;
+    graphsChanged();
     return theDOFGroupiter;
   }
 
@@ -600,12 +606,21 @@ int XC::AnalysisModel::getNumEqn(void) const
   { return numEqn; }
 
 
+//! @brief Marks the graphs of the model as outdated.
+void XC::AnalysisModel::graphsChanged(void) const
+  {
+    updateDOFGraph= true;
+    updateGroupGraph= true;
+    updateCSR_DOFGraph= true;
+    updateCSR_GroupGraph= true;
+  }
+
 XC::Graph &XC::AnalysisModel::getDOFGraph(void)
   {
-    if(updateGraphs)
+    if(updateDOFGraph)
       {
         myDOFGraph= DOF_Graph(*this);
-        updateGraphs= false;
+        updateDOFGraph= false;
       }
     return myDOFGraph;
   }
@@ -619,10 +634,10 @@ XC::Graph &XC::AnalysisModel::getDOFGraph(void)
 //! returns a pointer to this graph. AGAIN WILL CHANGE.
 XC::Graph &XC::AnalysisModel::getDOFGroupGraph(void)
   {
-    if(updateGraphs)
+    if(updateGroupGraph)
       {
         myGroupGraph= DOF_GroupGraph(*this);
-        updateGraphs= false;
+        updateGroupGraph= false;
       }
     return myGroupGraph;
   }
@@ -635,24 +650,54 @@ XC::Graph &XC::AnalysisModel::getDOFGroupGraph(void)
 //! DOF\_Graph CLASS - will go through and construct the Graph.
 const XC::Graph &XC::AnalysisModel::getDOFGraph(void) const
   {
-    if(updateGraphs)
+    if(updateDOFGraph)
       {
         myDOFGraph= DOF_Graph(*this);    
-        updateGraphs= false;
+        updateDOFGraph= false;
       }
     return myDOFGraph;
   }
 
 const XC::Graph &XC::AnalysisModel::getDOFGroupGraph(void) const
   {
-    if(updateGraphs)
+    if(updateGroupGraph)
       {
         myGroupGraph= DOF_GroupGraph(*this);
-        updateGraphs= false;
+        updateGroupGraph= false;
       }
     return myGroupGraph;
   }
 
+//! @brief Returns the DOF connectivity graph in compressed sparse row
+//! format.
+//!
+//! Same graph than getDOFGraph() (one vertex for each equation) but
+//! stored in two arrays and built in a single pass over the FE\_Elements.
+//! This is the graph used by the LinearSOE objects to determine their size.
+const XC::CSRGraph &XC::AnalysisModel::getCSR_DOFGraph(void) const
+  {
+    if(updateCSR_DOFGraph)
+      {
+        myCSR_DOFGraph.setDOF_Graph(*this);
+        updateCSR_DOFGraph= false;
+      }
+    return myCSR_DOFGraph;
+  }
+
+//! @brief Returns the connectivity of the DOF\_Group objects in
+//! compressed sparse row format (same graph than getDOFGroupGraph()).
+//! This graph is used by the DOF\_Numberer to assign equation numbers to
+//! the dofs.
+const XC::CSRGraph &XC::AnalysisModel::getCSR_DOFGroupGraph(void) const
+  {
+    if(updateCSR_GroupGraph)
+      {
+        myCSR_GroupGraph.setDOF_GroupGraph(*this);
+        updateCSR_GroupGraph= false;
+      }
+    return myCSR_GroupGraph;
+  }
+
 //! @brief Sets the values of the displacement, velocity and acceleration of
 //! the nodes.
 //! 
@@ -69,6 +69,7 @@
 #include "xc_utils/src/nucleo/EntCmd.h"
 #include "solution/graph/graph/DOF_Graph.h"
 #include "solution/graph/graph/DOF_GroupGraph.h"
+#include "solution/graph/graph/CSRGraph.h"
 #include "utility/tagged/storage/ArrayOfTaggedObjects.h"
 #include "solution/analysis/model/FE_EleIter.h"
 #include "solution/analysis/model/FE_EleConstIter.h"
@@ -146,7 +147,14 @@ class AnalysisModel: public MovableObject, public EntCmd
 
     mutable DOF_Graph myDOFGraph;
     mutable DOF_GroupGraph myGroupGraph;
-    mutable bool updateGraphs;
+    mutable bool updateDOFGraph; //!< true if myDOFGraph must be rebuilt.
+    mutable bool updateGroupGraph; //!< true if myGroupGraph must be rebuilt.
+    mutable CSRGraph myCSR_DOFGraph; //!< compressed DOF graph.
+    mutable CSRGraph myCSR_GroupGraph; //!< compressed DOF group graph.
+    mutable bool updateCSR_DOFGraph; //!< true if myCSR_DOFGraph must be rebuilt.
+    mutable bool updateCSR_GroupGraph; //!< true if myCSR_GroupGraph must be rebuilt.
+
+    void graphsChanged(void) const;
 
     ModelWrapper *getModelWrapper(void);
     const ModelWrapper *getModelWrapper(void) const;
@@ -212,6 +220,8 @@ class AnalysisModel: public MovableObject, public EntCmd
     virtual Graph &getDOFGroupGraph(void);
     virtual const Graph &getDOFGraph(void) const;
     virtual const Graph &getDOFGroupGraph(void) const;
+    virtual const CSRGraph &getCSR_DOFGraph(void) const;
+    virtual const CSRGraph &getCSR_DOFGroupGraph(void) const;
 
     // methods to update the response quantities at the DOF_Groups,
     // which in turn set the new_ nodal trial response quantities.
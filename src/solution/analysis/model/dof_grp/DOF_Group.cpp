@@ -73,9 +73,15 @@ const int MAX_NUM_DOF= 256;
 
 
 // static variables initialisation
-XC::Matrix XC::DOF_Group::errMatrix(1,1);
-XC::Vector XC::DOF_Group::errVect(1);
-XC::UnbalAndTangentStorage XC::DOF_Group::unbalAndTangentArray(MAX_NUM_DOF+1);
+thread_local XC::Matrix XC::DOF_Group::errMatrix(1,1);
+thread_local XC::Vector XC::DOF_Group::errVect(1);
+//! @brief Return the array of class wide vectors and matrices
+//! that corresponds to the calling thread.
+XC::UnbalAndTangentStorage &XC::DOF_Group::getUnbalAndTangentArray(void)
+  {
+    static thread_local UnbalAndTangentStorage retval(MAX_NUM_DOF+1);
+    return retval;
+  }
 int XC::DOF_Group::numDOF_Groups(0); // number of objects
 
 
@@ -113,7 +119,7 @@ void XC::DOF_Group::inicID(void)
 //! @param node: node associated to the DOF group.
 XC::DOF_Group::DOF_Group(int tag, Node *node)
   :TaggedObject(tag), myID(node->getNumberDOF()),
-   unbalAndTangent(node->getNumberDOF(),unbalAndTangentArray), myNode(node)
+   unbalAndTangent(node->getNumberDOF(),getUnbalAndTangentArray), myNode(node)
    
   {
     inicID();
@@ -132,7 +138,7 @@ XC::DOF_Group::DOF_Group(int tag, Node *node)
 //! warning message is orinted and \p numDOF set to \f$0\f$.
 XC::DOF_Group::DOF_Group(int tag, int ndof)
   :TaggedObject(tag), myID(ndof),
-   unbalAndTangent(ndof,unbalAndTangentArray), myNode(nullptr)
+   unbalAndTangent(ndof,getUnbalAndTangentArray), myNode(nullptr)
   {
     inicID();
     numDOF_Groups++;
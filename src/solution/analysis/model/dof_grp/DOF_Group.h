@@ -110,9 +110,9 @@ class DOF_Group: public TaggedObject
     ID 	myID;
 
     // static variables - single copy for all objects of the class	    
-    static Matrix errMatrix;
-    static Vector errVect;
-    static UnbalAndTangentStorage unbalAndTangentArray; //!< array of class wide vectors and matrices
+    static thread_local Matrix errMatrix;
+    static thread_local Vector errVect;
+    static UnbalAndTangentStorage &getUnbalAndTangentArray(void); //!< array of class wide vectors and matrices (one for each thread).
     static int numDOF_Groups; //!< number of objects of this class
 
     void inicID(void);
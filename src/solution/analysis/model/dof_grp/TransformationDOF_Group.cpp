@@ -74,7 +74,13 @@
 const int MAX_NUM_DOF= 16;
 
 // static variables initialisation
-XC::UnbalAndTangentStorage XC::TransformationDOF_Group::unbalAndTangentArrayMod(MAX_NUM_DOF+1);
+//! @brief Return the array of class wide vectors and matrices
+//! that corresponds to the calling thread.
+XC::UnbalAndTangentStorage &XC::TransformationDOF_Group::getUnbalAndTangentArrayMod(void)
+  {
+    static thread_local UnbalAndTangentStorage retval(MAX_NUM_DOF+1);
+    return retval;
+  }
 int XC::TransformationDOF_Group::numTransDOFs(0);     // number of objects
 XC::TransformationConstraintHandler *XC::TransformationDOF_Group::theHandler= nullptr;     // number of objects
 
@@ -91,7 +97,7 @@ std::vector<XC::SFreedom_Constraint *> XC::TransformationDOF_Group::getSFreedomC
 void XC::TransformationDOF_Group::arrays_setup(int numNodalDOF, int numConstrainedNodeRetainedDOF, int numRetainedNodeDOF)  
   {
     modNumDOF= numConstrainedNodeRetainedDOF + numRetainedNodeDOF;
-    unbalAndTangentMod= UnbalAndTangent(modNumDOF,unbalAndTangentArrayMod);
+    unbalAndTangentMod= UnbalAndTangent(modNumDOF,getUnbalAndTangentArrayMod);
 
     // create ID and transformation matrix
     modID= ID(modNumDOF);
@@ -150,7 +156,7 @@ void XC::TransformationDOF_Group::initialize(TransformationConstraintHandler *th
   }
 
 XC::TransformationDOF_Group::TransformationDOF_Group(int tag, Node *node, MFreedom_ConstraintBase *m, TransformationConstraintHandler *theTHandler)  
-  :DOF_Group(tag,node), mfc(m), unbalAndTangentMod(0,unbalAndTangentArrayMod), theSPs()
+  :DOF_Group(tag,node), mfc(m), unbalAndTangentMod(0,getUnbalAndTangentArrayMod), theSPs()
   { initialize(theHandler); }
 
 void XC::TransformationDOF_Group::setID(int dof, int value)
@@ -164,7 +170,7 @@ void XC::TransformationDOF_Group::setID(int dof, int value)
 
 XC::TransformationDOF_Group::TransformationDOF_Group(int tag, Node *node, TransformationConstraintHandler *theTHandler)
   :DOF_Group(tag,node), mfc(nullptr), modNumDOF(node->getNumberDOF()),
-   unbalAndTangentMod(node->getNumberDOF(),unbalAndTangentArrayMod),theSPs() 
+   unbalAndTangentMod(node->getNumberDOF(),getUnbalAndTangentArrayMod),theSPs() 
   {
     // create space for the SFreedom_Constraint array
     theSPs= std::vector<SFreedom_Constraint *>(modNumDOF,static_cast<SFreedom_Constraint *>(nullptr));
@@ -96,7 +96,7 @@ class TransformationDOF_Group: public DOF_Group
     std::vector<SFreedom_Constraint *> theSPs; //!< Pointers to single-freedom constraints.
     
     // static variables - single copy for all objects of the class	    
-    static UnbalAndTangentStorage unbalAndTangentArrayMod; //!< array of class wide vectors and matrices
+    static UnbalAndTangentStorage &getUnbalAndTangentArrayMod(void); //!< array of class wide vectors and matrices (one for each thread).
     static int numTransDOFs; //!< number of objects        
     static TransformationConstraintHandler *theHandler; //!< Transformation constraint handler.
 
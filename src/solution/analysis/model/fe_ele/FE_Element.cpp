@@ -69,13 +69,20 @@
 #include <solution/analysis/model/AnalysisModel.h>
 #include <utility/matrix/Matrix.h>
 #include <utility/matrix/Vector.h>
+#include <solution/system_of_eqn/linearSOE/LinearSOE.h>
 
 const int MAX_NUM_DOF= 64;
 
 // static variables initialisation
-XC::Matrix XC::FE_Element::errMatrix(1,1);
-XC::Vector XC::FE_Element::errVector(1);
-XC::UnbalAndTangentStorage XC::FE_Element::unbalAndTangentArray(MAX_NUM_DOF+1);
+thread_local XC::Matrix XC::FE_Element::errMatrix(1,1);
+thread_local XC::Vector XC::FE_Element::errVector(1);
+//! @brief Return the array of class wide vectors and matrices
+//! that corresponds to the calling thread.
+XC::UnbalAndTangentStorage &XC::FE_Element::getUnbalAndTangentArray(void)
+  {
+    static thread_local UnbalAndTangentStorage retval(MAX_NUM_DOF+1);
+    return retval;
+  }
 int XC::FE_Element::numFEs(0);           // number of objects
 
 
@@ -84,7 +91,7 @@ void XC::FE_Element::set_pointers(void)
   {
     if(myEle->isSubdomain() == false)
       {
-        unbalAndTangent= UnbalAndTangent(numDOF,unbalAndTangentArray);
+        unbalAndTangent= UnbalAndTangent(numDOF,getUnbalAndTangentArray);
       }
     else
       {
@@ -115,7 +122,7 @@ void XC::FE_Element::set_pointers(void)
 //! object, or there is not enough memory for the Vectors and Matrices
 //! required.
 XC::FE_Element::FE_Element(int tag, Element *ele)
-  :TaggedObject(tag),numDOF(ele->getNumDOF()),unbalAndTangent(0,unbalAndTangentArray),
+  :TaggedObject(tag),numDOF(ele->getNumDOF()),unbalAndTangent(0,getUnbalAndTangentArray),
    theModel(nullptr), myEle(ele), theIntegrator(nullptr),
    myDOF_Groups((ele->getNodePtrs().getExternalNodes()).Size()), myID(ele->getNumDOF())
   {
@@ -181,7 +188,7 @@ XC::FE_Element::FE_Element(int tag, Element *ele)
 //! tangent and residual matrix and vector, this is the responsibility of
 //! the subclass.
 XC::FE_Element::FE_Element(int tag, int numDOF_Group, int ndof)
-  :TaggedObject(tag),numDOF(ndof),unbalAndTangent(ndof,unbalAndTangentArray),
+  :TaggedObject(tag),numDOF(ndof),unbalAndTangent(ndof,getUnbalAndTangentArray),
     theModel(nullptr), myEle(nullptr), theIntegrator(nullptr),
     myDOF_Groups(numDOF_Group), myID(ndof)
   {
@@ -363,6 +370,16 @@ const XC::Vector &XC::FE_Element::getResidual(Integrator *theNewIntegrator)
       }
   }
 
+//! @brief Assembles fact times the matrix (normally the tangent)
+//! into the matrix of the system of equations at the locations
+//! given by getID().
+//!
+//! The positions of the coefficients in the system matrix are kept
+//! between calls and computed again only when the sparsity pattern
+//! of the system changes (see ScatterMap).
+int XC::FE_Element::addA(LinearSOE &theSOE,const Matrix &m,const double &fact)
+  { return scatterMap.addA(theSOE,m,getID(),fact); }
+
 
 //! @brief Zeros the tangent matrix.
 //!
@@ -65,6 +65,7 @@
 #include <utility/tagged/TaggedObject.h>
 #include "utility/matrix/ID.h"
 #include "solution/analysis/UnbalAndTangent.h"
+#include "solution/system_of_eqn/linearSOE/ScatterMap.h"
 
 namespace XC {
 class TransientIntegrator;
@@ -73,6 +74,7 @@ class Vector;
 class Matrix;
 class Integrator;
 class AnalysisModel;
+class LinearSOE;
 
 //! @ingroup AnalysisModel
 //
@@ -112,11 +114,12 @@ class FE_Element: public TaggedObject
     AnalysisModel *theModel;
     Element *myEle; //!< Domain element associated with this object.
     Integrator *theIntegrator; //!< need for Subdomain
+    ScatterMap scatterMap; //!< positions of the tangent coefficients in the system matrix.
 
     // static variables - single copy for all objects of the class	
-    static Matrix errMatrix;
-    static Vector errVector;
-    static UnbalAndTangentStorage unbalAndTangentArray; //!< array of class wide vectors and matrices
+    static thread_local Matrix errMatrix;
+    static thread_local Vector errVector;
+    static UnbalAndTangentStorage &getUnbalAndTangentArray(void); //!< array of class wide vectors and matrices (one for each thread).
     static int numFEs; //!< number of objects
     void set_pointers(void);
 
@@ -146,6 +149,7 @@ class FE_Element: public TaggedObject
     // methods to form and obtain the tangent and residual
     virtual const Matrix &getTangent(Integrator *theIntegrator);
     virtual const Vector &getResidual(Integrator *theIntegrator);
+    int addA(LinearSOE &,const Matrix &,const double &fact= 1.0);
 
     // methods to allow integrator to build tangent
     virtual void  zeroTangent(void);
@@ -73,21 +73,27 @@
 const int MAX_NUM_DOF= 64;
 
 // static variables initialisation
-XC::UnbalAndTangentStorage XC::TransformationFE::unbalAndTangentArrayMod(MAX_NUM_DOF+1);
-std::vector<XC::Matrix *> XC::TransformationFE::theTransformations; 
+//! @brief Return the array of class wide vectors and matrices
+//! that corresponds to the calling thread.
+XC::UnbalAndTangentStorage &XC::TransformationFE::getUnbalAndTangentArrayMod(void)
+  {
+    static thread_local UnbalAndTangentStorage retval(MAX_NUM_DOF+1);
+    return retval;
+  }
+thread_local std::vector<XC::Matrix *> XC::TransformationFE::theTransformations; 
 int XC::TransformationFE::numTransFE(0);           
 int XC::TransformationFE::transCounter(0);           
 int XC::TransformationFE::sizeTransformations(0);          
-XC::Vector XC::TransformationFE::dataBuffer(MAX_NUM_DOF*MAX_NUM_DOF);
-XC::Vector XC::TransformationFE::localKbuffer(MAX_NUM_DOF*MAX_NUM_DOF);          
-XC::ID XC::TransformationFE::dofData(MAX_NUM_DOF);          
+thread_local XC::Vector XC::TransformationFE::dataBuffer(MAX_NUM_DOF*MAX_NUM_DOF);
+thread_local XC::Vector XC::TransformationFE::localKbuffer(MAX_NUM_DOF*MAX_NUM_DOF);          
+thread_local XC::ID XC::TransformationFE::dofData(MAX_NUM_DOF);          
 int XC::TransformationFE::sizeBuffer(MAX_NUM_DOF*MAX_NUM_DOF);
 
 //  TransformationFE(Element *, Integrator *theIntegrator);
 //        construictor that take the corresponding model element.
 XC::TransformationFE::TransformationFE(int tag, Element *ele)
   :FE_Element(tag, ele), theDOFs(), /* numSPs(0), theSPs(),*/  
-  numGroups(0), numTransformedDOF(0),unbalAndTangentMod(numTransformedDOF,unbalAndTangentArrayMod)
+  numGroups(0), numTransformedDOF(0),unbalAndTangentMod(numTransformedDOF,getUnbalAndTangentArrayMod)
   {
   // set number of original dof at ele
     numOriginalDOF = ele->getNumDOF();
@@ -193,7 +199,7 @@ int XC::TransformationFE::setID(void)
                 return -3;
               }                
       }
-    unbalAndTangentMod= UnbalAndTangent(numTransformedDOF,unbalAndTangentArrayMod);
+    unbalAndTangentMod= UnbalAndTangent(numTransformedDOF,getUnbalAndTangentArrayMod);
     return 0;
   }
 
@@ -201,7 +207,7 @@ const XC::Matrix &XC::TransformationFE::getTangent(Integrator *theNewIntegrator)
   {
     const Matrix &theTangent = this->FE_Element::getTangent(theNewIntegrator);
 
-    static IntPtrWrapper numDOFs(dofData.getDataPtr(), 1);
+    static thread_local IntPtrWrapper numDOFs(dofData.getDataPtr(), 1);
     numDOFs.setData(dofData.getDataPtr(), numGroups);
     
     // DO THE SP STUFF TO THE TANGENT 
@@ -209,6 +215,8 @@ const XC::Matrix &XC::TransformationFE::getTangent(Integrator *theNewIntegrator)
     // get the transformation matrix from each dof group & number of local dof
     // for original node.
     int numNode = numGroups;
+    if(theTransformations.size()<size_t(numNode)) // each thread has its own copy.
+      theTransformations.resize(numNode,nullptr);
     for(int a= 0;a<numNode;a++)
       {
         Matrix *theT = theDOFs[a]->getT();
@@ -226,7 +234,7 @@ const XC::Matrix &XC::TransformationFE::getTangent(Integrator *theNewIntegrator)
     int noRowsTransformed = 0;
     int noRowsOriginal = 0;
 
-    static XC::Matrix localK;
+    static thread_local XC::Matrix localK;
 
     // foreach block row, for each block col do
     for(int i=0; i<numNode; i++) {
@@ -251,7 +259,7 @@ const XC::Matrix &XC::TransformationFE::getTangent(Integrator *theNewIntegrator)
             // now perform the matrix computation T(i)^T localK T(j)
             // note: if T == 0 then the Identity is assumed
             int noColsTransformed = 0;
-            static Matrix localTtKT;
+            static thread_local Matrix localTtKT;
             
             if(Ti != 0 && Tj != 0) {
                 noRowsTransformed = Ti->noCols();
@@ -364,7 +372,7 @@ const XC::Vector &XC::TransformationFE::getK_Force(const XC::Vector &accel, doub
   this->FE_Element::addKtToTang();    
   const Matrix &theTangent = this->XC::FE_Element::getTangent(0);
 
-  static IntPtrWrapper numDOFs(dofData.getDataPtr(), 1);
+  static thread_local IntPtrWrapper numDOFs(dofData.getDataPtr(), 1);
   numDOFs.setData(dofData.getDataPtr(), numGroups);
     
   // DO THE SP STUFF TO THE TANGENT 
@@ -372,6 +380,8 @@ const XC::Vector &XC::TransformationFE::getK_Force(const XC::Vector &accel, doub
   // get the transformation matrix from each dof group & number of local dof
   // for original node.
   int numNode = numGroups;
+  if(theTransformations.size()<size_t(numNode)) // each thread has its own copy.
+    theTransformations.resize(numNode,nullptr);
   for(int a = 0; a<numNode; a++)
     {
       Matrix *theT = theDOFs[a]->getT();
@@ -389,7 +399,7 @@ const XC::Vector &XC::TransformationFE::getK_Force(const XC::Vector &accel, doub
   int noRowsTransformed = 0;
   int noRowsOriginal = 0;
   
-  static XC::Matrix localK;
+  static thread_local XC::Matrix localK;
   
   // foreach block row, for each block col do
   for(int i=0; i<numNode; i++) {
@@ -414,7 +424,7 @@ const XC::Vector &XC::TransformationFE::getK_Force(const XC::Vector &accel, doub
       // now perform the matrix computation T(i)^T localK T(j)
       // note: if T == 0 then the Identity is assumed
       int noColsTransformed = 0;
-      static XC::Matrix localTtKT;
+      static thread_local XC::Matrix localTtKT;
       
       if(Ti != 0 && Tj != 0) {
         noRowsTransformed = Ti->noCols();
@@ -476,7 +486,7 @@ const XC::Vector &XC::TransformationFE::getM_Force(const Vector &accel, double f
     this->FE_Element::addMtoTang();    
     const Matrix &theTangent = this->FE_Element::getTangent(0);
 
-    static IntPtrWrapper numDOFs(dofData.getDataPtr(), 1);
+    static thread_local IntPtrWrapper numDOFs(dofData.getDataPtr(), 1);
     numDOFs.setData(dofData.getDataPtr(), numGroups);
     
     // DO THE SP STUFF TO THE TANGENT 
@@ -484,6 +494,8 @@ const XC::Vector &XC::TransformationFE::getM_Force(const Vector &accel, double f
     // get the transformation matrix from each dof group & number of local dof
     // for original node.
     int numNode = numGroups;
+    if(theTransformations.size()<size_t(numNode)) // each thread has its own copy.
+      theTransformations.resize(numNode,nullptr);
     for(int a = 0; a<numNode; a++)
       {
         Matrix *theT = theDOFs[a]->getT();
@@ -501,7 +513,7 @@ const XC::Vector &XC::TransformationFE::getM_Force(const Vector &accel, double f
     int noRowsTransformed = 0;
     int noRowsOriginal = 0;
   
-    static Matrix localK;
+    static thread_local Matrix localK;
   
     // foreach block row, for each block col do
     for(int i=0; i<numNode; i++)
@@ -527,7 +539,7 @@ const XC::Vector &XC::TransformationFE::getM_Force(const Vector &accel, double f
             // now perform the matrix computation T(i)^T localK T(j)
             // note: if T == 0 then the Identity is assumed
             int noColsTransformed = 0;
-            static Matrix localTtKT;
+            static thread_local Matrix localTtKT;
       
       if(Ti != 0 && Tj != 0) {
         noRowsTransformed = Ti->noCols();
@@ -589,7 +601,7 @@ const XC::Vector &XC::TransformationFE::getC_Force(const XC::Vector &accel, doub
   this->FE_Element::addCtoTang();    
   const Matrix &theTangent = this->XC::FE_Element::getTangent(0);
 
-  static IntPtrWrapper numDOFs(dofData.getDataPtr(), 1);
+  static thread_local IntPtrWrapper numDOFs(dofData.getDataPtr(), 1);
   numDOFs.setData(dofData.getDataPtr(), numGroups);
     
   // DO THE SP STUFF TO THE TANGENT 
@@ -597,6 +609,8 @@ const XC::Vector &XC::TransformationFE::getC_Force(const XC::Vector &accel, doub
   // get the transformation matrix from each dof group & number of local dof
   // for original node.
   int numNode = numGroups;
+  if(theTransformations.size()<size_t(numNode)) // each thread has its own copy.
+    theTransformations.resize(numNode,nullptr);
   for(int a = 0; a<numNode; a++)
     {
       Matrix *theT = theDOFs[a]->getT();
@@ -614,7 +628,7 @@ const XC::Vector &XC::TransformationFE::getC_Force(const XC::Vector &accel, doub
   int noRowsTransformed = 0;
   int noRowsOriginal = 0;
   
-  static XC::Matrix localK;
+  static thread_local XC::Matrix localK;
   
   // foreach block row, for each block col do
   for(int i=0; i<numNode; i++) {
@@ -639,7 +653,7 @@ const XC::Vector &XC::TransformationFE::getC_Force(const XC::Vector &accel, doub
       // now perform the matrix computation T(i)^T localK T(j)
       // note: if T == 0 then the Identity is assumed
       int noColsTransformed = 0;
-      static XC::Matrix localTtKT;
+      static thread_local XC::Matrix localTtKT;
       
       if(Ti != 0 && Tj != 0) {
         noRowsTransformed = Ti->noCols();
@@ -701,7 +715,7 @@ void XC::TransformationFE::addD_Force(const XC::Vector &disp,  double fact)
     if(fact == 0.0)
       return;
 
-    static Vector response;
+    static thread_local Vector response;
     response.setData(dataBuffer.getDataPtr(), numOriginalDOF);
                     
     for(int i=0; i<numTransformedDOF; i++) {
@@ -720,7 +734,7 @@ void XC::TransformationFE::addM_Force(const XC::Vector &disp,  double fact)
     if(fact == 0.0)
         return;
 
-    static Vector response;
+    static thread_local Vector response;
     response.setData(dataBuffer.getDataPtr(), numOriginalDOF);
                     
     for(int i=0; i<numTransformedDOF; i++) {
@@ -803,7 +817,7 @@ void XC::TransformationFE::addD_ForceSensitivity(int gradNumber, const XC::Vecto
     if(fact == 0.0)
         return;
 
-    static Vector response;
+    static thread_local Vector response;
     response.setData(dataBuffer.getDataPtr(), numOriginalDOF);
                     
     for(int i=0; i<numTransformedDOF; i++) {
@@ -822,7 +836,7 @@ void XC::TransformationFE::addM_ForceSensitivity(int gradNumber, const XC::Vecto
     if(fact == 0.0)
         return;
 
-    static Vector response;
+    static thread_local Vector response;
     response.setData(dataBuffer.getDataPtr(), numOriginalDOF);
                     
     for(int i=0; i<numTransformedDOF; i++) {
@@ -97,14 +97,14 @@ class TransformationFE: public FE_Element
     UnbalAndTangent unbalAndTangentMod;
     
     // static variables - single copy for all objects of the class	
-    static UnbalAndTangentStorage unbalAndTangentArrayMod; //!< array of class wide vectors and matrices
-    static std::vector<Matrix *> theTransformations; //!< for holding pointers to the T matrices
+    static UnbalAndTangentStorage &getUnbalAndTangentArrayMod(void); //!< array of class wide vectors and matrices (one for each thread).
+    static thread_local std::vector<Matrix *> theTransformations; //!< for holding pointers to the T matrices
     static int numTransFE;     //!< number of objects    
     static int transCounter;   //!< a counter used to indicate when to do something
     static int sizeTransformations; //!< size of theTransformations array
-    static Vector dataBuffer;
-    static Vector localKbuffer;
-    static ID dofData;
+    static thread_local Vector dataBuffer;
+    static thread_local Vector localKbuffer;
+    static thread_local ID dofData;
     static int sizeBuffer;
   protected:
     int transformResponse(const Vector &modResponse, Vector &unmodResponse);
@@ -65,12 +65,27 @@
 #include "solution/graph/numberer/GraphNumberer.h"
 #include "solution/graph/numberer/RCM.h"
 #include "solution/graph/numberer/SimpleNumberer.h"
+#include "solution/graph/numberer/AMD.h"
+#include "solution/graph/numberer/NestedDissectionNumberer.h"
+#include "solution/system_of_eqn/linearSOE/bandGEN/BandGenLinSOE.h"
+#include "solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinSOE.h"
+#include "solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinSOE.h"
+#include "solution/system_of_eqn/linearSOE/fullGEN/FullGenLinSOE.h"
+#include "solution/system_of_eqn/linearSOE/diagonal/DiagonalSOE.h"
+#include "solution/system_of_eqn/eigenSOE/BandArpackSOE.h"
+#include "solution/system_of_eqn/eigenSOE/BandArpackppSOE.h"
+#include "solution/system_of_eqn/eigenSOE/SymBandEigenSOE.h"
+#include "solution/system_of_eqn/eigenSOE/FullGenEigenSOE.h"
 #include <utility/matrix/ID.h>
 #include <solution/analysis/model/dof_grp/DOF_Group.h>
 #include <solution/analysis/model/fe_ele/FE_Element.h>
 #include <solution/analysis/model/FE_EleIter.h>
 
 #include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/CSRGraph.h"
+#include "solution/graph/graph/Vertex.h"
+#include "solution/graph/graph/VertexIter.h"
+#include <algorithm>
 
 #include <domain/domain/Domain.h>
 #include <domain/constraints/MFreedom_Constraint.h>
@@ -80,18 +95,43 @@
 #include <domain/constraints/MRMFreedom_ConstraintIter.h>
 #include <solution/analysis/model/DOF_GrpIter.h>
 
+//! @brief Return a new graph numberer of the type being passed
+//! as parameter (nullptr if the type is unknown).
+XC::GraphNumberer *XC::DOF_Numberer::newGraphNumberer(const std::string &str)
+  {
+    GraphNumberer *retval= nullptr;
+    if(str=="rcm")
+      retval= new RCM(); //Reverse Cuthill-Macgee.
+    else if(str=="simple")
+      retval= new SimpleNumberer();
+    else if(str=="amd")
+      retval= new AMD(); //Approximate minimum degree.
+    else if(str=="nested_dissection")
+      retval= new NestedDissectionNumberer();
+    return retval;
+  }
+
 //! @brief Create the graph numberer (
 void XC::DOF_Numberer::alloc(const std::string &str)
   {
     free_mem();
-    if(str=="rcm")
-      theGraphNumberer=new RCM(); //Reverse Cuthill-Macgee.
-    else if(str=="simple")
-      theGraphNumberer=new SimpleNumberer();
+    autoSelect= (str=="auto");
+    if(autoSelect)
+      {
+        // Reverse Cuthill-Macgee until the estimates are computed.
+        theGraphNumberer= newGraphNumberer("rcm");
+        algorithm= "rcm";
+      }
     else
-      std::cerr << getClassName() << "::" << __FUNCTION__
-	        << "; numerator type: '" << str
-                << "' unknown." << std::endl;
+      {
+        theGraphNumberer= newGraphNumberer(str);
+        if(theGraphNumberer)
+          algorithm= str;
+        else
+          std::cerr << getClassName() << "::" << __FUNCTION__
+                    << "; numerator type: '" << str
+                    << "' unknown." << std::endl;
+      }
   }
 
 //! @brief Copia el numerador de grafos.
@@ -114,11 +154,15 @@ void XC::DOF_Numberer::free_mem(void)
 //! @param owr: pointer to the ModelWrapper that ows this object.
 //! @param clsTag: class indentifier. 
 XC::DOF_Numberer::DOF_Numberer(ModelWrapper *owr, int clsTag) 
-  :MovableObject(clsTag), EntCmd(owr), theGraphNumberer(nullptr) {}
+  :MovableObject(clsTag), EntCmd(owr), theGraphNumberer(nullptr),
+   autoSelect(false), storageScheme("sparse") {}
 
 //! @brief Copy constructor.
 XC::DOF_Numberer::DOF_Numberer(const DOF_Numberer &otro)
-  : MovableObject(otro), EntCmd(otro), theGraphNumberer(nullptr)
+  : MovableObject(otro), EntCmd(otro), theGraphNumberer(nullptr),
+    algorithm(otro.algorithm), autoSelect(otro.autoSelect),
+    storageScheme(otro.storageScheme),
+    orderingEstimates(otro.orderingEstimates)
   {
     if(otro.theGraphNumberer)
       copia(*otro.theGraphNumberer);
@@ -131,14 +175,198 @@ XC::DOF_Numberer &XC::DOF_Numberer::operator=(const DOF_Numberer &otro)
     EntCmd::operator=(otro);
     if(otro.theGraphNumberer)
       copia(*otro.theGraphNumberer);
+    algorithm= otro.algorithm;
+    autoSelect= otro.autoSelect;
+    storageScheme= otro.storageScheme;
+    orderingEstimates= otro.orderingEstimates;
     return *this;
   }
 
-//! @brief Sets the algorithm to be used for numerating the graph
-//! «Reverse Cuthill-Macgee» o simple.
+//! @brief Sets the algorithm to be used for numerating the graph:
+//! "rcm" (reverse Cuthill-Macgee), "simple", "amd" (approximate minimum
+//! degree), "nested_dissection" or "auto" (the one with the smallest
+//! factorization cost for the storage scheme of the system of equations).
 void XC::DOF_Numberer::useAlgorithm(const std::string &nmb)
   { alloc(nmb); }
 
+//! @brief Sets the storage scheme used to estimate the factorization
+//! cost of the orderings from the type of the system of equations.
+void XC::DOF_Numberer::setStorageScheme(const SystemOfEqn *soe)
+  {
+    storageScheme= "sparse";
+    if(dynamic_cast<const BandGenLinSOE *>(soe) || dynamic_cast<const BandSPDLinSOE *>(soe) || dynamic_cast<const BandArpackSOE *>(soe) || dynamic_cast<const BandArpackppSOE *>(soe) || dynamic_cast<const SymBandEigenSOE *>(soe))
+      storageScheme= "band";
+    else if(dynamic_cast<const ProfileSPDLinSOE *>(soe))
+      storageScheme= "profile";
+    else if(dynamic_cast<const FullGenLinSOE *>(soe) || dynamic_cast<const FullGenEigenSOE *>(soe) || dynamic_cast<const DiagonalSOE *>(soe))
+      storageScheme= "full";
+  }
+
+//! @brief Compute the estimates of the fill, profile, bandwidth and
+//! factorization operations of each candidate ordering of the
+//! DOF group graph of the analysis model. Returns the number of
+//! candidates or a negative number if the model is not available.
+int XC::DOF_Numberer::estimateOrderings(void)
+  {
+    orderingEstimates.clear();
+    AnalysisModel *am= getAnalysisModelPtr();
+    if(!am)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+	          << "; WARNING - analysis model not set.\n";
+        return -1;
+      }
+    const CSRGraph &theGraph= am->getCSR_DOFGroupGraph();
+    const int numVertex= theGraph.getNumVertex();
+    // number of equations of each vertex.
+    std::vector<int> weights(numVertex,0);
+    for(int i= 0;i<numVertex;i++)
+      {
+        const DOF_Group *dofGroupPtr= am->getDOF_GroupPtr(theGraph.getTag(i));
+        if(dofGroupPtr)
+          {
+            const ID &theID= dofGroupPtr->getID();
+            for(int j= 0;j<theID.Size();j++)
+              if((theID(j)==-2) || (theID(j)==-3))
+                weights[i]++;
+          }
+      }
+    static const char *candidates[]= {"rcm","amd","nested_dissection","simple"};
+    for(size_t i= 0;i<sizeof(candidates)/sizeof(candidates[0]);i++)
+      {
+        GraphNumberer *gn= newGraphNumberer(candidates[i]);
+        const ID &orderedRefs= gn->number(theGraph);
+        orderingEstimates[candidates[i]].compute(theGraph,orderedRefs,weights);
+        delete gn;
+      }
+    return orderingEstimates.size();
+  }
+
+//! @brief Select the graph numbering algorithm with the smallest
+//! factorization cost estimate for the storage scheme.
+void XC::DOF_Numberer::selectAlgorithm(void)
+  {
+    if(estimateOrderings()>0)
+      {
+        std::string best= algorithm;
+        double minCost= -1.0;
+        estimates_map::const_iterator current= orderingEstimates.find(algorithm);
+        if(current!=orderingEstimates.end()) // keep it if no one is cheaper.
+          minCost= current->second.getFlops(storageScheme);
+        for(estimates_map::const_iterator i= orderingEstimates.begin();i!=orderingEstimates.end();i++)
+          {
+            const double cost= i->second.getFlops(storageScheme);
+            if((minCost<0.0) || (cost<minCost))
+              {
+                minCost= cost;
+                best= i->first;
+              }
+          }
+        if(best!=algorithm)
+          {
+            free_mem();
+            theGraphNumberer= newGraphNumberer(best);
+            algorithm= best;
+          }
+      }
+  }
+
+//! @brief Return a Python dictionary with the estimates of each
+//! candidate algorithm.
+boost::python::dict XC::DOF_Numberer::getOrderingEstimatesPy(void) const
+  {
+    boost::python::dict retval;
+    for(estimates_map::const_iterator i= orderingEstimates.begin();i!=orderingEstimates.end();i++)
+      {
+        boost::python::dict d= i->second.getPyDict();
+        d["fill"]= i->second.getFill(storageScheme);
+        d["cost"]= i->second.getFlops(storageScheme);
+        retval[i->first]= d;
+      }
+    return retval;
+  }
+
+//! @brief Return the DOF group references in the order assigned by
+//! the graph numbering algorithm to the compressed DOF group graph
+//! of the analysis model (compressed= true) or to the Graph object
+//! (compressed= false). The equation numbers are not modified.
+XC::ID XC::DOF_Numberer::getGraphOrdering(bool compressed)
+  {
+    ID retval;
+    AnalysisModel *am= getAnalysisModelPtr();
+    if(am && theGraphNumberer)
+      {
+        if(compressed)
+          retval= theGraphNumberer->number(am->getCSR_DOFGroupGraph());
+        else
+          retval= theGraphNumberer->number(am->getDOFGroupGraph());
+      }
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+	        << "; WARNING - analysis model or graph numberer not set.\n";
+    return retval;
+  }
+
+//! @brief Return a Python dictionary with the values used by the
+//! systems of equations to determine their size, computed from the
+//! compressed DOF graph of the analysis model (compressed= true) or
+//! from the Graph object (compressed= false): number of equations,
+//! number of edges, number of subdiagonals and superdiagonals,
+//! half bandwidth and profile size.
+boost::python::dict XC::DOF_Numberer::getDOFGraphSizesPy(bool compressed) const
+  {
+    boost::python::dict retval;
+    const AnalysisModel *am= getAnalysisModelPtr();
+    if(!am)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+	          << "; WARNING - analysis model not set.\n";
+        return retval;
+      }
+    int numVertex= 0, numEdge= 0, numSubD= 0, numSuperD= 0, halfBand= 0;
+    int profile= 0;
+    if(compressed)
+      {
+        const CSRGraph &theGraph= am->getCSR_DOFGraph();
+        numVertex= theGraph.getNumVertex();
+        numEdge= theGraph.getNumEdge();
+        theGraph.getBand(numSubD,numSuperD);
+        halfBand= theGraph.getVertexDiffMaxima();
+        for(int v= 0;v<numVertex;v++)
+          {
+            profile++; // diagonal.
+            if(theGraph.getDegree(v)>0)
+              profile+= std::max(0,theGraph.getTag(v)-theGraph.getTag(*theGraph.adjacencyBegin(v)));
+          }
+      }
+    else
+      {
+        const Graph &theGraph= am->getDOFGraph();
+        numVertex= theGraph.getNumVertex();
+        numEdge= theGraph.getNumEdge();
+        theGraph.getBand(numSubD,numSuperD);
+        halfBand= theGraph.getVertexDiffMaxima();
+        const Vertex *vertexPtr= nullptr;
+        VertexIter &theVertices= const_cast<Graph &>(theGraph).getVertices();
+        while((vertexPtr= theVertices()) != 0)
+          {
+            const int vertexNum= vertexPtr->getTag();
+            const std::set<int> &theAdjacency= vertexPtr->getAdjacency();
+            int height= 0;
+            for(std::set<int>::const_iterator i= theAdjacency.begin(); i!= theAdjacency.end(); i++)
+              height= std::max(height,vertexNum-*i);
+            profile+= height+1;
+          }
+      }
+    retval["numEquations"]= numVertex;
+    retval["numEdges"]= numEdge;
+    retval["numSubD"]= numSubD;
+    retval["numSuperD"]= numSuperD;
+    retval["halfBand"]= halfBand;
+    retval["profile"]= profile;
+    return retval;
+  }
+
 //! @brief Destructor
 XC::DOF_Numberer::~DOF_Numberer(void) 
   { free_mem(); }
@@ -161,7 +389,7 @@ XC::DOF_Numberer *XC::DOF_Numberer::getCopy(void) const
 //
 //! This base class performs the ordering by getting an ID containing the
 //! ordered DOF\_Group tags, obtained by invoking {\em
-//! number(theModel-\f$>\f$getDOFGroupGraph(), lastDOF\_Group)} on the
+//! number(theModel-\f$>\f$getCSR\_DOFGroupGraph(), lastDOF\_Group)} on the
 //! GraphNumberer, \p theGraphNumberer, passed in the constructor. The
 //! base class then makes two passes through the DOF\_Group objects in the
 //! AnalysisModel by looping through this ID; in the first pass assigning the
@@ -204,8 +432,11 @@ int XC::DOF_Numberer::numberDOF(int lastDOF_Group)
     if(am->getNumDOF_Groups() == 0)
       return 0;
 
+    if(autoSelect)
+      selectAlgorithm();
+
     // we first number the dofs using the dof group graph
-    const ID &orderedRefs= theGraphNumberer->number(am->getDOFGroupGraph(), lastDOF_Group);
+    const ID &orderedRefs= theGraphNumberer->number(am->getCSR_DOFGroupGraph(), lastDOF_Group);
 
     // we now iterate through the DOFs first time setting -2 values  
     if(orderedRefs.Size() != am->getNumDOF_Groups())
@@ -344,7 +575,7 @@ int XC::DOF_Numberer::numberDOF(int lastDOF_Group)
 //! This method in the base class is almost identical to the one just
 //! described. The only difference is that the ID identifying the order of
 //! the DOF\_Groups is obtained by invoking {\em
-//! number(theModel-\f$>\f$getDOFGroupGraph(), lastDOF\_Groups)} on the
+//! number(theModel-\f$>\f$getCSR\_DOFGroupGraph(), lastDOF\_Groups)} on the
 //! GraphNumberer.
 int XC::DOF_Numberer::numberDOF(ID &lastDOFs) 
   {
@@ -372,9 +603,12 @@ int XC::DOF_Numberer::numberDOF(ID &lastDOFs)
     if(am->getNumDOF_Groups() == 0)
       return 0;
 
+    if(autoSelect)
+      selectAlgorithm();
+
     // we first number the dofs using the dof group graph
         
-    const ID &orderedRefs= theGraphNumberer->number(am->getDOFGroupGraph(), lastDOFs);     
+    const ID &orderedRefs= theGraphNumberer->number(am->getCSR_DOFGroupGraph(), lastDOFs);     
 
     // we now iterate through the DOFs first time setting -2 values
 
@@ -66,10 +66,13 @@
 
 #include <utility/actor/actor/MovableObject.h>
 #include "xc_utils/src/nucleo/EntCmd.h"
+#include "solution/graph/numberer/OrderingEstimate.h"
+#include <map>
 
 namespace XC {
 class AnalysisModel;
 class GraphNumberer;
+class SystemOfEqn;
 class FEM_ObjectBroker;
 class ID;
 class ModelWrapper;
@@ -90,13 +93,26 @@ class ModelWrapper;
 //! assigns the equation numbers to the individual degrees-of-freedom. Subtypes
 //! may wish to implement the numbering in a more efficient manner by using
 //! the FE\_Element and DOF\_Group objects directly.
+//!
+//! In "auto" mode the fill, profile, bandwidth and factorization
+//! operations of each candidate ordering are estimated for the storage
+//! scheme of the system of equations and the cheapest one is used.
 class DOF_Numberer: public MovableObject, public EntCmd
   {
+  public:
+    typedef std::map<std::string,OrderingEstimate> estimates_map;
   private:
     ModelWrapper *getModelWrapper(void);
     const ModelWrapper *getModelWrapper(void) const;
 
     GraphNumberer *theGraphNumberer; //!< Graph (DOF) numberer.
+    std::string algorithm; //!< name of the graph numbering algorithm.
+    bool autoSelect; //!< if true select the algorithm with the smallest cost.
+    std::string storageScheme; //!< storage scheme of the system of equations (band, profile, sparse or full).
+    estimates_map orderingEstimates; //!< estimates for each candidate algorithm.
+
+    static GraphNumberer *newGraphNumberer(const std::string &);
+    void selectAlgorithm(void);
   protected:
     AnalysisModel *getAnalysisModelPtr(void);
     GraphNumberer *getGraphNumbererPtr(void);
@@ -123,6 +139,24 @@ class DOF_Numberer: public MovableObject, public EntCmd
     virtual int numberDOF(ID &lastDOF_Groups);
 
     void useAlgorithm(const std::string &);
+    //! @brief Return the name of the graph numbering algorithm.
+    inline const std::string &getAlgorithm(void) const
+      { return algorithm; }
+    //! @brief Return true if the algorithm is selected automatically.
+    inline bool isAutomatic(void) const
+      { return autoSelect; }
+    void setStorageScheme(const SystemOfEqn *);
+    //! @brief Return the storage scheme used to estimate the cost
+    //! of the orderings.
+    inline const std::string &getStorageScheme(void) const
+      { return storageScheme; }
+    int estimateOrderings(void);
+    //! @brief Return the estimates for each candidate algorithm.
+    inline const estimates_map &getOrderingEstimates(void) const
+      { return orderingEstimates; }
+    boost::python::dict getOrderingEstimatesPy(void) const;
+    ID getGraphOrdering(bool compressed);
+    boost::python::dict getDOFGraphSizesPy(bool compressed) const;
 
     virtual int sendSelf(CommParameters &);
     virtual int recvSelf(const CommParameters &);
@@ -22,7 +22,14 @@
 //python_interface.tcc
 
 class_<XC::DOF_Numberer, bases<XC::MovableObject,EntCmd>, boost::noncopyable >("DOFNumberer", "A DOF numberer is responsible for assigning the equation numbers to the individual DOFs in each of the DOF groups in the analysis model.",no_init)
-    .def("useAlgorithm", &XC::DOF_Numberer::useAlgorithm,return_internal_reference<>(),"\n""useAlgorithm(nmb)""Set the algorithm to be used for numerating the graph \n" "Parameters: \n""nmb: name of the algorithm, 'rcm' for Reverse Cuthill-Macgee or 'simple' for simple algorithm.")
+    .def("useAlgorithm", &XC::DOF_Numberer::useAlgorithm,return_internal_reference<>(),"\n""useAlgorithm(nmb)""Set the algorithm to be used for numerating the graph \n" "Parameters: \n""nmb: name of the algorithm, 'rcm' for Reverse Cuthill-Macgee, 'simple' for simple algorithm, 'amd' for approximate minimum degree, 'nested_dissection' for nested dissection or 'auto' to use the one with the smallest factorization cost estimate.")
+    .add_property("algorithm", make_function(&XC::DOF_Numberer::getAlgorithm, return_value_policy<copy_const_reference>()),"Name of the graph numbering algorithm (the selected one in 'auto' mode).")
+    .add_property("isAutomatic", &XC::DOF_Numberer::isAutomatic,"True if the algorithm is selected automatically.")
+    .add_property("storageScheme", make_function(&XC::DOF_Numberer::getStorageScheme, return_value_policy<copy_const_reference>()),"Storage scheme of the system of equations used to estimate the factorization cost (band, profile, sparse or full).")
+    .def("estimateOrderings", &XC::DOF_Numberer::estimateOrderings,"Compute the estimates of fill, profile, bandwidth and factorization operations of each candidate ordering.")
+    .def("getOrderingEstimates", &XC::DOF_Numberer::getOrderingEstimatesPy,"Return a dictionary with the estimates of each candidate ordering (computed when numbering the DOFs in 'auto' mode or by estimateOrderings).")
+    .def("getGraphOrdering", &XC::DOF_Numberer::getGraphOrdering,"getGraphOrdering(compressed): return the DOF group tags in the order given by the graph numbering algorithm to the compressed DOF group graph (compressed= True) or to the Graph object (compressed= False).")
+    .def("getDOFGraphSizes", &XC::DOF_Numberer::getDOFGraphSizesPy,"getDOFGraphSizes(compressed): return a dictionary with the values used to determine the size of the systems of equations (number of equations and edges, subdiagonals, superdiagonals, half bandwidth and profile), computed from the compressed DOF graph (compressed= True) or from the Graph object (compressed= False).")
     ;
 
 // class_<XC::ParallelNumberer, bases<XC::DOF_Numberer>, boost::noncopyable >("ParallelNumberer", no_init);
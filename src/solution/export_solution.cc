@@ -37,7 +37,7 @@ class_<XC::ConvergenceTest, bases<XC::MovableObject,EntCmd>, boost::noncopyable
  class_<XC::AnalysisAggregation, bases<EntCmd>, boost::noncopyable >("AnalysisAggregation", "Solution methods container",no_init)
     .def("newSolutionAlgorithm", &XC::AnalysisAggregation::newSolutionAlgorithm,return_internal_reference<>(),"\n""newSolutionAlgorithm(tipo) \n""Define the solution algorithm to be used.\n" "Parameters: \n""tipo: type of solution algorithm. Available types: 'bfgs_soln_algo', 'broyden_soln_algo','krylov_newton_soln_algo','linear_soln_algo','modified_newton_soln_algo','newton_raphson_soln_algo','newton_line_search_soln_algo','periodic_newton_soln_algo','frequency_soln_algo','standard_eigen_soln_algo','linear_buckling_soln_algo' \n")
     .def("newIntegrator", &XC::AnalysisAggregation::newIntegrator,return_internal_reference<>()," \n""newIntegrator(tipo,params) \n""Define the integrator to be used. \n""Parameters: \n""tipo: type of integrator. Available types:  'arc_length_integrator', 'arc_length1_integrator', 'displacement_control_integrator', 'distributed_displacement_control_integrator', 'HS_constraint_integrator', 'load_control_integrator', 'load_path_integrator', 'min_unbal_disp_norm_integrator', 'eigen_integrator', 'linear_buckling_integrator', 'alpha_os_integrator', 'alpha_os_generalized_integrator', 'central_difference_integrator', 'central_difference_alternative_integrator', 'central_difference_no_damping_integrator', 'collocation_integrator', 'collocation_hybrid_simulation_integrator', 'HHT_integrator', 'HHT1_integrator', 'HHT_explicit_integrator', 'HHT_generalized_integrator', 'HHT_generalized_explicit_integrator', 'HHT_hybrid_simulation_integrator', 'newmark_integrator', 'newmark1_integrator', 'newmark_explicit_integrator' 'newmark_hybrid_simulation_integrator', 'wilson_theta_integrator'. \n""params: parameters depending upon the integrator type. \n")
-    .def("newSystemOfEqn", &XC::AnalysisAggregation::newSystemOfEqn,return_internal_reference<>()," \n""newSystemOfEqn(tipo) \n""Define the system of equations to be used. \n""Parameters: \n""tipo: type of system of equations. Available types: 'band_arpack_soe', 'band_arpackpp_soe', 'sym_arpack_soe', 'sym_band_eigen_soe', 'full_gen_eigen_soe', 'band_gen_lin_soe', 'distributed_band_gen_lin_soe', 'band_spd_lin_soe', 'distributed_band_spd_lin_soe', 'diagonal_soe', 'distributed_diagonal_soe', 'full_gen_lin_soe', 'profile_spd_lin_soe', 'distributed_profile_spd_lin_soe', 'sparse_gen_col_lin_soe', 'distributed_sparse_gen_col_lin_soe', 'sparse_gen_row_lin_soe', 'distributed_sparse_gen_row_lin_soe', 'sym_sparse_lin_soe'.  \n")
+    .def("newSystemOfEqn", &XC::AnalysisAggregation::newSystemOfEqn,return_internal_reference<>()," \n""newSystemOfEqn(tipo) \n""Define the system of equations to be used. \n""Parameters: \n""tipo: type of system of equations. Available types: 'band_arpack_soe', 'band_arpackpp_soe', 'sym_arpack_soe', 'sym_band_eigen_soe', 'full_gen_eigen_soe', 'band_gen_lin_soe', 'distributed_band_gen_lin_soe', 'band_spd_lin_soe', 'distributed_band_spd_lin_soe', 'diagonal_soe', 'distributed_diagonal_soe', 'full_gen_lin_soe', 'profile_spd_lin_soe', 'distributed_profile_spd_lin_soe', 'sparse_gen_col_lin_soe', 'distributed_sparse_gen_col_lin_soe', 'sparse_gen_row_lin_soe', 'distributed_sparse_gen_row_lin_soe', 'sym_sparse_lin_soe', 'supernodal_spd_lin_soe'.  \n")
     .def("newConvergenceTest", &XC::AnalysisAggregation::newConvergenceTest,return_internal_reference<>()," \n""newConvergenceTest(cmd) \n""Define the convergence test to be used. \n""Parameters: \n""cmd: type of convergente test. Available types: 'energy_inc_conv_test', 'fixed_num_iter_conv_test', 'norm_disp_incr_conv_test', 'norm_unbalance_conv_test', 'relative_energy_incr_conv_test', 'relative_norm_disp_incr_conv_test', 'relative_norm_unbalance_conv_test', 'relative_total_norm_disp_incr_conv_test'. \n")
     ;
 
@@ -53,10 +53,18 @@ class_<XC::ProcSoluControl, bases<EntCmd>, boost::noncopyable >("SoluControl", "
     .add_property("getAnalysisAggregationContainer",  make_function(&XC::ProcSoluControl::getAnalysisAggregationContainer, return_internal_reference<>()) ," \n""Return a reference to the solution procedures container. \n")
     ;
 
+class_<XC::LoadCombinationFarm, bases<EntCmd>, boost::noncopyable >("LoadCombinationFarm", "Analysis of the load combinations of a group in several worker processes (forked from this one).", no_init)
+  .add_property("numWorkers", &XC::LoadCombinationFarm::getNumWorkers, &XC::LoadCombinationFarm::setNumWorkers,"Number of worker processes.")
+  .add_property("numSteps", &XC::LoadCombinationFarm::getNumSteps, &XC::LoadCombinationFarm::setNumSteps,"Number of analysis steps for each combination.")
+  .def("getFailedCombinations", &XC::LoadCombinationFarm::getFailedCombinations,"Return the names of the combinations whose analysis failed.")
+  .def("analyze", &XC::LoadCombinationFarm::analyze," \n""analyze(combinations) \n""Analyze the combinations of the group with the static analysis of the solution procedure and merge the envelopes computed by the workers with the ones of the domain envelope recorders. Return 0 if all the combinations were analyzed.\n")
+  ;
+
 XC::ProcSoluControl &(XC::ProcSolu::*getSoluControlRef)(void)= &XC::ProcSolu::getSoluControl;
  class_<XC::ProcSolu, bases<EntCmd>, boost::noncopyable >("ProcSolu","Definition of the analysis by its type and the parameters that control the solution procedure.",no_init)
    .add_property("getSoluControl", make_function( getSoluControlRef, return_internal_reference<>() )," \n"" Return a reference to the objects  that control the solution procedure.\n")
    .add_property("getAnalysis", make_function( &XC::ProcSolu::getAnalysis, return_internal_reference<>() )," \n"" Return a reference to the analysis object. \n")
+   .add_property("getCombinationFarm", make_function( &XC::ProcSolu::getCombinationFarm, return_internal_reference<>() )," \n"" Return a reference to the object that analyzes load combinations in worker processes. \n")
     .def("newAnalysis", &XC::ProcSolu::newAnalysis,return_internal_reference<>()," \n""newAnalysis(nmb,analysis_aggregation_code,cod_solu_eigenM) \n""Definition of a new analysis.""Parameters: \n""nmb: name of the type of analysis. Available types: 'direct_integration_analysis', 'eigen_analysis', 'modal_analysis','linear_buckling_analysis', 'linear_buckling_eigen_analysis', 'static_analysis', 'variable_time_step_direct_integration_analysis' \n""analysis_aggregation_code: name of the solution method container \n""cod_solu_eigenM: name of the solution method (only when linear buckling analysis defined).\n")
     ;
 
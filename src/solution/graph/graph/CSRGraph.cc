@@ -0,0 +1,333 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//CSRGraph.cc
+
+#include "CSRGraph.h"
+#include <algorithm>
+#include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/Vertex.h"
+#include "solution/graph/graph/VertexIter.h"
+#include "solution/analysis/model/AnalysisModel.h"
+#include "solution/analysis/model/dof_grp/DOF_Group.h"
+#include "solution/analysis/model/DOF_GrpIter.h"
+#include "solution/analysis/model/fe_ele/FE_Element.h"
+#include "solution/analysis/model/FE_EleIter.h"
+#include "utility/matrix/ID.h"
+
+//! @brief Constructor.
+XC::CSRGraph::CSRGraph(void)
+  : xadj(1,0), consecutiveTags(true) {}
+
+//! @brief Constructs the compressed version of the graph being passed
+//! as parameter.
+XC::CSRGraph::CSRGraph(const Graph &theGraph)
+  : xadj(1,0), consecutiveTags(true)
+  {
+    Graph &g= const_cast<Graph &>(theGraph);
+    const int numVertex= g.getNumVertex();
+    std::vector<const Vertex *> vertices;
+    vertices.reserve(numVertex);
+    std::vector<int> vertexTags;
+    vertexTags.reserve(numVertex);
+    Vertex *vertexPtr= nullptr;
+    VertexIter &theVertices= g.getVertices();
+    while((vertexPtr= theVertices()) != nullptr)
+      {
+        vertices.push_back(vertexPtr);
+        vertexTags.push_back(vertexPtr->getTag());
+      }
+    setVertices(vertexTags);
+    std::vector<int> count(tags.size()+1,0);
+    for(std::vector<const Vertex *>::const_iterator i= vertices.begin();i!=vertices.end();i++)
+      {
+        const int iv= getIndex((*i)->getTag());
+        refs[iv]= (*i)->getRef();
+        colors[iv]= (*i)->getColor();
+        count[iv+1]= (*i)->getDegree();
+      }
+    for(size_t i= 0;i<tags.size();i++)
+      count[i+1]+= count[i];
+    xadj= count;
+    adjncy.resize(xadj.back());
+    for(std::vector<const Vertex *>::const_iterator i= vertices.begin();i!=vertices.end();i++)
+      {
+        const int iv= getIndex((*i)->getTag());
+        int pos= xadj[iv];
+        const std::set<int> &adjacency= (*i)->getAdjacency();
+        for(std::set<int>::const_iterator j= adjacency.begin();j!=adjacency.end();j++)
+          adjncy[pos++]= getIndex(*j);
+        std::sort(adjncy.begin()+xadj[iv],adjncy.begin()+pos);
+      }
+  }
+
+//! @brief Removes all the vertices and edges.
+void XC::CSRGraph::clear(void)
+  {
+    xadj.assign(1,0);
+    adjncy.clear();
+    tags.clear();
+    refs.clear();
+    colors.clear();
+    consecutiveTags= true;
+  }
+
+//! @brief Defines the vertices from its tags (no edges).
+void XC::CSRGraph::setVertices(const std::vector<int> &vertexTags)
+  {
+    clear();
+    tags= vertexTags;
+    std::sort(tags.begin(),tags.end());
+    tags.erase(std::unique(tags.begin(),tags.end()),tags.end());
+    const size_t numVertex= tags.size();
+    refs.assign(tags.begin(),tags.end());
+    colors.assign(numVertex,0);
+    xadj.assign(numVertex+1,0);
+    consecutiveTags= (tags.empty() || ((tags.back()-tags.front())==int(numVertex)-1));
+  }
+
+//! @brief Return the index of the vertex whose tag is being passed
+//! as parameter (-1 if there is no such vertex).
+int XC::CSRGraph::getIndex(const int &tag) const
+  {
+    int retval= -1;
+    if(!tags.empty())
+      {
+        if(consecutiveTags)
+          {
+            const int i= tag-tags.front();
+            if((i>=0) && (i<getNumVertex()))
+              retval= i;
+          }
+        else
+          {
+            std::vector<int>::const_iterator i= std::lower_bound(tags.begin(),tags.end(),tag);
+            if((i!=tags.end()) && (*i==tag))
+              retval= i-tags.begin();
+          }
+      }
+    return retval;
+  }
+
+//! @brief Computes the adjacencies of the vertices from the list of
+//! vertices connected by each element (single pass over the elements).
+//!
+//! @param elemStart: position in elemVertices of the first vertex of each element (size: numElements+1).
+//! @param elemVertices: indexes of the vertices connected by each element.
+void XC::CSRGraph::build(const std::vector<int> &elemStart,const std::vector<int> &elemVertices)
+  {
+    const int numVertex= getNumVertex();
+    const int numElem= elemStart.size()-1;
+    // elements connected to each vertex (transpose).
+    std::vector<int> vtxStart(numVertex+1,0);
+    for(std::vector<int>::const_iterator i= elemVertices.begin();i!=elemVertices.end();i++)
+      vtxStart[*i+1]++;
+    for(int v= 0;v<numVertex;v++)
+      vtxStart[v+1]+= vtxStart[v];
+    std::vector<int> vtxElements(elemVertices.size());
+    std::vector<int> next(vtxStart.begin(),vtxStart.end()-1);
+    for(int e= 0;e<numElem;e++)
+      for(int k= elemStart[e];k<elemStart[e+1];k++)
+        vtxElements[next[elemVertices[k]]++]= e;
+    next.clear();
+
+    // neighbours of each vertex.
+    xadj.assign(numVertex+1,0);
+    adjncy.clear();
+    adjncy.reserve(elemVertices.size());
+    std::vector<int> marker(numVertex,-1);
+    for(int v= 0;v<numVertex;v++)
+      {
+        marker[v]= v; // no self loops.
+        const size_t rowStart= adjncy.size();
+        for(int k= vtxStart[v];k<vtxStart[v+1];k++)
+          {
+            const int e= vtxElements[k];
+            for(int l= elemStart[e];l<elemStart[e+1];l++)
+              {
+                const int w= elemVertices[l];
+                if(marker[w]!=v)
+                  {
+                    marker[w]= v;
+                    adjncy.push_back(w);
+                  }
+              }
+          }
+        std::sort(adjncy.begin()+rowStart,adjncy.end());
+        xadj[v+1]= adjncy.size();
+      }
+  }
+
+//! @brief Builds the graph of the equations of the model: a vertex
+//! for each equation number and an edge for each pair of equations
+//! coupled by an FE_Element (replaces DOF_Graph).
+void XC::CSRGraph::setDOF_Graph(const AnalysisModel &theModel)
+  {
+    // vertices: equation numbers of the DOF groups.
+    std::vector<int> eqns;
+    eqns.reserve(theModel.getNumEqn());
+    const DOF_Group *dofPtr= nullptr;
+    DOF_GrpConstIter &theDOFs= theModel.getConstDOFs();
+    while((dofPtr= theDOFs()) != nullptr)
+      {
+        const ID &id= dofPtr->getID();
+        const int size= id.Size();
+        for(int i=0; i<size; i++)
+          if(id(i)>=0)
+            eqns.push_back(id(i));
+      }
+    setVertices(eqns);
+
+    // edges: single pass over the elements.
+    std::vector<int> elemStart(1,0);
+    std::vector<int> elemVertices;
+    const FE_Element *elePtr= nullptr;
+    FE_EleConstIter &eleIter= theModel.getConstFEs();
+    while((elePtr= eleIter()) != nullptr)
+      {
+        const ID &id= elePtr->getID();
+        const int size= id.Size();
+        for(int i=0; i<size; i++)
+          {
+            const int iv= (id(i)>=0 ? getIndex(id(i)) : -1);
+            if(iv>=0)
+              elemVertices.push_back(iv);
+          }
+        elemStart.push_back(elemVertices.size());
+      }
+    build(elemStart,elemVertices);
+  }
+
+//! @brief Builds the graph of the DOF groups of the model: a vertex for
+//! each DOF_Group (reference: node tag, color: number of free DOFs) and
+//! an edge for each pair of groups connected by an FE_Element (replaces
+//! DOF_GroupGraph).
+void XC::CSRGraph::setDOF_GroupGraph(const AnalysisModel &theModel)
+  {
+    const int numDOF_Groups= theModel.getNumDOF_Groups();
+    std::vector<int> groupTags;
+    groupTags.reserve(numDOF_Groups);
+    std::vector<const DOF_Group *> groups;
+    groups.reserve(numDOF_Groups);
+    const DOF_Group *dofGroupPtr= nullptr;
+    DOF_GrpConstIter &dofIter= theModel.getConstDOFs();
+    while((dofGroupPtr= dofIter()) != nullptr)
+      {
+        groupTags.push_back(dofGroupPtr->getTag());
+        groups.push_back(dofGroupPtr);
+      }
+    setVertices(groupTags);
+    for(std::vector<const DOF_Group *>::const_iterator i= groups.begin();i!=groups.end();i++)
+      {
+        const int iv= getIndex((*i)->getTag());
+        refs[iv]= (*i)->getNodeTag();
+        colors[iv]= (*i)->getNumFreeDOF();
+      }
+
+    // edges: single pass over the elements.
+    std::vector<int> elemStart(1,0);
+    std::vector<int> elemVertices;
+    const FE_Element *elePtr= nullptr;
+    FE_EleConstIter &eleIter= theModel.getConstFEs();
+    while((elePtr= eleIter()) != nullptr)
+      {
+        const ID &id= elePtr->getDOFtags();
+        const int size= id.Size();
+        for(int i=0; i<size; i++)
+          {
+            const int iv= getIndex(id(i));
+            if(iv>=0)
+              elemVertices.push_back(iv);
+          }
+        elemStart.push_back(elemVertices.size());
+      }
+    build(elemStart,elemVertices);
+  }
+
+//! @brief Computes the number of subdiagonals and superdiagonals
+//! of the matrix whose sparsity pattern corresponds to the graph
+//! (see Graph::getBand).
+void XC::CSRGraph::getBand(int &numSubD,int &numSuperD) const
+  {
+    numSubD= 0;
+    numSuperD= 0;
+    const int numVertex= getNumVertex();
+    for(int v= 0;v<numVertex;v++)
+      if(getDegree(v)>0)
+        {
+          const int vertexNum= tags[v];
+          // adjacency is sorted so we only need the extremes.
+          const int diffSuper= vertexNum-tags[*adjacencyBegin(v)];
+          const int diffSub= vertexNum-tags[*(adjacencyEnd(v)-1)];
+          if(diffSuper>numSuperD)
+            numSuperD= diffSuper;
+          if(diffSub<-numSubD)
+            numSubD= -diffSub;
+        }
+  }
+
+//! @brief Returns the maximum (positive) of the difference between vertices tags.
+int XC::CSRGraph::getVertexDiffMaxima(void) const
+  {
+    int retval= 0;
+    const int numVertex= getNumVertex();
+    for(int v= 0;v<numVertex;v++)
+      if(getDegree(v)>0)
+        {
+          const int diff= tags[v]-tags[*adjacencyBegin(v)];
+          if(retval<diff)
+            retval= diff;
+        }
+    return retval;
+  }
+
+//! @brief Returns the extreme (positive or negative) of the difference between vertices tags.
+int XC::CSRGraph::getVertexDiffExtrema(void) const
+  {
+    int retval= getVertexDiffMaxima();
+    const int numVertex= getNumVertex();
+    for(int v= 0;v<numVertex;v++)
+      if(getDegree(v)>0)
+        {
+          const int diff= tags[*(adjacencyEnd(v)-1)]-tags[v];
+          if(retval<diff)
+            retval= diff;
+        }
+    return retval;
+  }
+
+//! @brief Copies this graph into the Graph object being passed
+//! as parameter (used by the objects that don't deal with
+//! compressed graphs yet).
+void XC::CSRGraph::getGraph(Graph &theGraph) const
+  {
+    const int numVertex= getNumVertex();
+    theGraph= Graph(numVertex);
+    for(int v= 0;v<numVertex;v++)
+      {
+        Vertex vrt(tags[v],refs[v],0,colors[v]);
+        theGraph.addVertex(vrt,false);
+      }
+    for(int v= 0;v<numVertex;v++)
+      for(const int *i= adjacencyBegin(v);i!=adjacencyEnd(v);i++)
+        if(*i>v)
+          theGraph.addEdge(tags[v],tags[*i]);
+  }
@@ -0,0 +1,107 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//CSRGraph.h
+
+#ifndef CSRGraph_h
+#define CSRGraph_h
+
+#include <vector>
+
+namespace XC {
+class Graph;
+class AnalysisModel;
+
+//! @ingroup Graph
+//
+//! @brief Graph stored in compressed sparse row format.
+//!
+//! Compact alternative to the Graph/Vertex classes: the adjacency of
+//! the vertex with index i is stored (sorted in ascending order and
+//! without self loops) in adjncy[xadj[i]] ... adjncy[xadj[i+1]-1]. The
+//! vertex indexes range from 0 to numVertex-1 and are assigned in
+//! ascending order of the vertex tags, so when the tags are consecutive
+//! and start at 0 (DOF graph) the index and the tag are the same.
+//! The graphs of the model are built in a single pass over
+//! the FE_Element objects.
+class CSRGraph
+  {
+  private:
+    std::vector<int> xadj; //!< position in adjncy of the adjacency of each vertex (size: numVertex+1).
+    std::vector<int> adjncy; //!< vertex adjacencies (vertex indexes).
+    std::vector<int> tags; //!< vertex tags (ascending order).
+    std::vector<int> refs; //!< vertex references.
+    std::vector<int> colors; //!< vertex colors.
+    bool consecutiveTags; //!< true if tags[i]==tags[0]+i.
+
+    void setVertices(const std::vector<int> &);
+    void build(const std::vector<int> &,const std::vector<int> &);
+  public:
+    CSRGraph(void);
+    explicit CSRGraph(const Graph &);
+
+    void clear(void);
+    void setDOF_Graph(const AnalysisModel &);
+    void setDOF_GroupGraph(const AnalysisModel &);
+
+    //! @brief Return the number of vertices.
+    inline int getNumVertex(void) const
+      { return tags.size(); }
+    //! @brief Return the number of edges.
+    inline int getNumEdge(void) const
+      { return adjncy.size()/2; }
+    //! @brief Return the degree of the i-th vertex.
+    inline int getDegree(const int &i) const
+      { return xadj[i+1]-xadj[i]; }
+    //! @brief Return a pointer to the first neighbour of the i-th vertex.
+    inline const int *adjacencyBegin(const int &i) const
+      { return adjncy.data()+xadj[i]; }
+    //! @brief Return a pointer past the last neighbour of the i-th vertex.
+    inline const int *adjacencyEnd(const int &i) const
+      { return adjncy.data()+xadj[i+1]; }
+    //! @brief Return the adjacency pointers (METIS xadj array).
+    inline const std::vector<int> &getXAdj(void) const
+      { return xadj; }
+    //! @brief Return the adjacency array (METIS adjncy array).
+    inline const std::vector<int> &getAdjncy(void) const
+      { return adjncy; }
+    //! @brief Return the tag of the i-th vertex.
+    inline const int &getTag(const int &i) const
+      { return tags[i]; }
+    //! @brief Return the reference of the i-th vertex.
+    inline const int &getRef(const int &i) const
+      { return refs[i]; }
+    //! @brief Return the color of the i-th vertex.
+    inline const int &getColor(const int &i) const
+      { return colors[i]; }
+    //! @brief Return true if the vertex tags are 0,1,...,numVertex-1.
+    inline bool hasIndexTags(void) const
+      { return (tags.empty() || (consecutiveTags && (tags[0]==0))); }
+    int getIndex(const int &) const;
+
+    void getBand(int &,int &) const;
+    int getVertexDiffMaxima(void) const;
+    int getVertexDiffExtrema(void) const;
+    void getGraph(Graph &) const;
+  };
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,260 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//AMD.cc
+
+#include "AMD.h"
+#include <solution/graph/graph/Graph.h>
+#include <solution/graph/graph/CSRGraph.h>
+#include <solution/graph/graph/Vertex.h>
+#include <utility/matrix/ID.h>
+#include <algorithm>
+
+namespace {
+
+//! @brief Status of the vertices of the quotient graph.
+enum QuotientStatus {VARIABLE, ELEMENT, ABSORBED};
+
+//! @brief Doubly linked lists of the variables with the same degree.
+struct DegreeLists
+  {
+    std::vector<int> head; //!< first variable of each degree.
+    std::vector<int> next; //!< next variable with the same degree.
+    std::vector<int> prev; //!< previous variable with the same degree.
+
+    DegreeLists(const int &n)
+      : head(n+1,-1), next(n,-1), prev(n,-1) {}
+    void insert(const int &i,const int &d)
+      {
+        next[i]= head[d];
+        prev[i]= -1;
+        if(head[d]>=0)
+          prev[head[d]]= i;
+        head[d]= i;
+      }
+    void remove(const int &i,const int &d)
+      {
+        if(prev[i]>=0)
+          next[prev[i]]= next[i];
+        else
+          head[d]= next[i];
+        if(next[i]>=0)
+          prev[next[i]]= prev[i];
+      }
+  };
+
+} // end of anonymous namespace
+
+//! @brief Constructor.
+XC::AMD::AMD(void)
+  :BaseNumberer(GraphNUMBERER_TAG_AMD) {}
+
+//! @brief Virtual constructor.
+XC::GraphNumberer *XC::AMD::getCopy(void) const
+  { return new AMD(*this); }
+
+//! @brief Return the approximate minimum degree ordering of the graph.
+//!
+//! @param xadj: adjacency pointers (size: number of vertices+1).
+//! @param adjncy: adjacency array (symmetric).
+//! @return permutation: perm[k] is the vertex that occupies the
+//! k-th position in the new ordering.
+std::vector<int> XC::AMD::minimumDegree(const std::vector<int> &xadj,const std::vector<int> &adjncy)
+  {
+    const int n= (xadj.empty() ? 0 : xadj.size()-1);
+    std::vector<int> perm;
+    perm.reserve(n);
+    std::vector<std::vector<int> > A(n); // adjacent variables.
+    std::vector<std::vector<int> > E(n); // adjacent elements.
+    std::vector<std::vector<int> > L(n); // variables of each element.
+    std::vector<char> status(n,VARIABLE);
+    std::vector<int> degree(n,0);
+    DegreeLists lists(n);
+    for(int i= 0;i<n;i++)
+      {
+        for(int j= xadj[i];j<xadj[i+1];j++)
+          if(adjncy[j]!=i)
+            A[i].push_back(adjncy[j]);
+        degree[i]= std::min<int>(A[i].size(),n-1);
+        lists.insert(i,degree[i]);
+      }
+    std::vector<int> mark(n,-1); // mark[i]==p: i belongs to Lp.
+    std::vector<int> w(n,0); // |Le\Lp|.
+    std::vector<int> wmark(n,-1);
+    int minDeg= 0;
+    for(int k= 0;k<n;k++)
+      {
+        // select the pivot.
+        while(lists.head[minDeg]<0)
+          minDeg++;
+        const int p= lists.head[minDeg];
+        lists.remove(p,degree[p]);
+        perm.push_back(p);
+
+        // p becomes an element: Lp= (Ap U Le for e in Ep) \ {p}.
+        status[p]= ELEMENT;
+        mark[p]= p;
+        std::vector<int> Lp;
+        for(std::vector<int>::const_iterator j= A[p].begin();j!=A[p].end();j++)
+          if((status[*j]==VARIABLE) && (mark[*j]!=p))
+            {
+              mark[*j]= p;
+              Lp.push_back(*j);
+            }
+        for(std::vector<int>::const_iterator e= E[p].begin();e!=E[p].end();e++)
+          if(status[*e]==ELEMENT)
+            {
+              for(std::vector<int>::const_iterator j= L[*e].begin();j!=L[*e].end();j++)
+                if((status[*j]==VARIABLE) && (mark[*j]!=p))
+                  {
+                    mark[*j]= p;
+                    Lp.push_back(*j);
+                  }
+              status[*e]= ABSORBED; // element absorbed by p.
+              std::vector<int>().swap(L[*e]);
+            }
+        std::vector<int>().swap(A[p]);
+        std::vector<int>().swap(E[p]);
+
+        // prune the lists of the variables in Lp (the edges between
+        // them are represented by the new element).
+        for(std::vector<int>::const_iterator i= Lp.begin();i!=Lp.end();i++)
+          {
+            lists.remove(*i,degree[*i]);
+            std::vector<int> &Ai= A[*i];
+            std::vector<int>::iterator last= Ai.begin();
+            for(std::vector<int>::const_iterator j= Ai.begin();j!=Ai.end();j++)
+              if((status[*j]==VARIABLE) && (mark[*j]!=p))
+                *last++= *j;
+            Ai.erase(last,Ai.end());
+            std::vector<int> &Ei= E[*i];
+            last= Ei.begin();
+            for(std::vector<int>::const_iterator e= Ei.begin();e!=Ei.end();e++)
+              if(status[*e]==ELEMENT)
+                *last++= *e;
+            Ei.erase(last,Ei.end());
+            Ei.push_back(p);
+          }
+
+        // compute |Le\Lp| for the elements adjacent to the variables in Lp.
+        for(std::vector<int>::const_iterator i= Lp.begin();i!=Lp.end();i++)
+          for(std::vector<int>::const_iterator e= E[*i].begin();e!=E[*i].end();e++)
+            if(*e!=p)
+              {
+                if(wmark[*e]!=p)
+                  {
+                    wmark[*e]= p;
+                    w[*e]= L[*e].size();
+                  }
+                w[*e]--;
+              }
+
+        // approximate external degrees.
+        const int lpSize= Lp.size();
+        const int numRemaining= n-k-1;
+        for(std::vector<int>::const_iterator i= Lp.begin();i!=Lp.end();i++)
+          {
+            int d= A[*i].size()+lpSize-1;
+            for(std::vector<int>::const_iterator e= E[*i].begin();e!=E[*i].end();e++)
+              if((*e!=p) && (status[*e]==ELEMENT))
+                {
+                  if(w[*e]==0) // Le contained in Lp (aggressive absorption).
+                    {
+                      status[*e]= ABSORBED;
+                      std::vector<int>().swap(L[*e]);
+                    }
+                  else
+                    d+= w[*e];
+                }
+            d= std::min(d,degree[*i]+lpSize-1);
+            d= std::max(std::min(d,numRemaining-1),0);
+            degree[*i]= d;
+            lists.insert(*i,d);
+            minDeg= std::min(minDeg,d);
+          }
+        L[p].swap(Lp);
+      }
+    return perm;
+  }
+
+//! @brief Approximate minimum degree numbering of the compressed graph.
+//!
+//! The vertex whose tag is \p lastVertex (if any) is numbered last.
+const XC::ID &XC::AMD::number(const CSRGraph &theGraph, int lastVertex)
+  {
+    ID lastVertices;
+    if(lastVertex!=-1)
+      {
+        lastVertices.resize(1);
+        lastVertices(0)= lastVertex;
+      }
+    return number(theGraph,lastVertices);
+  }
+
+//! @brief Approximate minimum degree numbering of the compressed graph.
+//!
+//! The vertices whose tags are in \p lastVertices are numbered last.
+const XC::ID &XC::AMD::number(const CSRGraph &theGraph, const ID &lastVertices)
+  {
+    // see if we can do quick return
+    if(!checkSize(theGraph)) 
+      return theRefResult;
+    const std::vector<int> perm= minimumDegree(theGraph.getXAdj(),theGraph.getAdjncy());
+    setResult(theGraph,perm,lastVertices);
+    return theRefResult;
+  }
+
+//! @brief Approximate minimum degree numbering of the graph.
+//!
+//! Numbers the compressed version of the graph. As a side effect
+//! the \p Tmp variable of each vertex is set to the number assigned
+//! to it and the result contains the vertex references.
+const XC::ID &XC::AMD::number(Graph &theGraph, const ID &lastVertices)
+  {
+    const CSRGraph csr(theGraph);
+    number(csr,lastVertices);
+    const int numVertex= getNumVertex();
+    for(int i= 0;i<numVertex;i++)
+      {
+        Vertex *vertexPtr= theGraph.getVertexPtr(theRefResult(i));
+        vertexPtr->setTmp(i+1);
+        theRefResult(i)= vertexPtr->getRef();
+      }
+    return theRefResult;
+  }
+
+//! @brief Approximate minimum degree numbering of the graph.
+const XC::ID &XC::AMD::number(Graph &theGraph, int lastVertex)
+  {
+    ID lastVertices;
+    if(lastVertex!=-1)
+      {
+        lastVertices.resize(1);
+        lastVertices(0)= lastVertex;
+      }
+    return number(theGraph,lastVertices);
+  }
+
+int XC::AMD::sendSelf(CommParameters &cp)
+  { return 0; }
+
+int XC::AMD::recvSelf(const CommParameters &cp)
+  { return 0; }
@@ -0,0 +1,61 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//AMD.h
+
+#ifndef AMD_h
+#define AMD_h
+
+#include "BaseNumberer.h"
+#include <vector>
+
+namespace XC {
+//! @ingroup Graph
+//
+//! @brief Approximate minimum degree fill reducing numbering of the
+//! vertices of a graph.
+//!
+//! The elimination is simulated on a quotient graph (the eliminated
+//! vertices become "elements" that represent the cliques created by
+//! its elimination) and, at each step, the vertex with the smallest
+//! approximate external degree is eliminated (Amestoy, Davis and
+//! Duff, 1996). Elements covered by a newer element are absorbed.
+class AMD: public BaseNumberer
+  {
+  private:
+    static std::vector<int> minimumDegree(const std::vector<int> &,const std::vector<int> &);
+  protected:
+    friend class FEM_ObjectBroker;
+    friend class DOF_Numberer;
+    AMD(void);
+    GraphNumberer *getCopy(void) const;
+  public:
+    const ID &number(Graph &theGraph, int lastVertex = -1);
+    const ID &number(Graph &theGraph, const ID &lastVertices);
+    const ID &number(const CSRGraph &theGraph, int lastVertex = -1);
+    const ID &number(const CSRGraph &theGraph, const ID &lastVertices);
+
+    int sendSelf(CommParameters &);
+    int recvSelf(const CommParameters &);
+  };
+} // end of XC namespace
+
+#endif
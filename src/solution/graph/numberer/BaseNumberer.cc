@@ -62,6 +62,7 @@
 
 #include <solution/graph/numberer/BaseNumberer.h>
 #include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/CSRGraph.h"
 #include <solution/graph/graph/Vertex.h>
 #include <solution/graph/graph/VertexIter.h>
 #include <utility/matrix/ID.h>
@@ -83,3 +84,51 @@ bool XC::BaseNumberer::checkSize(const Graph &theGraph)
     return (nvg!=0);
   }
 
+//! @brief Allocates space enough for the theRefResult vector.
+//! Returns true if the number of vertices is not zero.
+bool XC::BaseNumberer::checkSize(const CSRGraph &theGraph)
+  {
+    const int numVertex= theRefResult.Size();
+    const int nvg= theGraph.getNumVertex();
+    if(numVertex != nvg)
+      theRefResult.resize(nvg);
+    return (nvg!=0);
+  }
+
+//! @brief Store in theRefResult the tags of the vertices in the
+//! order given by the permutation, placing the vertices whose tags
+//! are in \p lastVertices at the end (in the same order).
+//!
+//! @param theGraph: numbered graph.
+//! @param perm: perm[k] is the index of the vertex that occupies
+//! the k-th position.
+//! @param lastVertices: tags of the vertices to number last.
+void XC::BaseNumberer::setResult(const CSRGraph &theGraph,const std::vector<int> &perm,const ID &lastVertices)
+  {
+    const int numVertex= getNumVertex();
+    std::vector<bool> last(numVertex,false);
+    const int numLast= lastVertices.Size();
+    for(int i= 0;i<numLast;i++)
+      {
+        const int v= theGraph.getIndex(lastVertices(i));
+        if(v>=0)
+          last[v]= true;
+        else if(lastVertices(i)!=-1)
+          std::cerr << getClassName() << "::" << __FUNCTION__
+                    << "; WARNING - no vertex with tag " << lastVertices(i)
+                    << " exists - ignored.\n";
+      }
+    int count= 0;
+    for(int k= 0;k<numVertex;k++)
+      if(!last[perm[k]])
+        theRefResult(count++)= theGraph.getTag(perm[k]);
+    for(int i= 0;i<numLast;i++)
+      {
+        const int v= theGraph.getIndex(lastVertices(i));
+        if((v>=0) && last[v])
+          {
+            theRefResult(count++)= theGraph.getTag(v);
+            last[v]= false; //Repeated tags.
+          }
+      }
+  }
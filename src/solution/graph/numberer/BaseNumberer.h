@@ -30,6 +30,8 @@
 #define BaseNumberer_h
 
 #include "solution/graph/numberer/GraphNumberer.h"
+#include "utility/matrix/ID.h"
+#include <vector>
 
 namespace XC {
 //! @ingroup Graph
@@ -44,6 +46,8 @@ class BaseNumberer: public GraphNumberer
     inline int getNumVertex(void) const
       { return theRefResult.Size(); }
     bool checkSize(const Graph &);
+    bool checkSize(const CSRGraph &);
+    void setResult(const CSRGraph &,const std::vector<int> &,const ID &);
   };
 } // end of XC namespace
 
@@ -59,6 +59,8 @@
 
 
 #include "GraphNumberer.h"
+#include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/CSRGraph.h"
 
 //! @brief Constructor.
 //!
@@ -68,6 +70,29 @@ XC::GraphNumberer::GraphNumberer(int classTag)
   :MovableObject(classTag)
   {}
 
+//! @brief Graph numbering (compressed graph).
+//!
+//! Returns an ordered ID containing the tags of the vertices in the
+//! order of the numbering (see number(Graph &,int)). This default
+//! implementation copies the graph into a Graph object; the
+//! numberers that can work with the compressed graph directly
+//! must redefine it.
+const XC::ID &XC::GraphNumberer::number(const CSRGraph &theGraph, int lastVertex)
+  {
+    Graph tmp(theGraph.getNumVertex());
+    theGraph.getGraph(tmp);
+    return this->number(tmp,lastVertex);
+  }
+
+//! @brief Graph numbering (compressed graph) with the vertices in
+//! \p lastVertices numbered last (see number(Graph &,const ID &)).
+const XC::ID &XC::GraphNumberer::number(const CSRGraph &theGraph, const ID &lastVertices)
+  {
+    Graph tmp(theGraph.getNumVertex());
+    theGraph.getGraph(tmp);
+    return this->number(tmp,lastVertices);
+  }
+
 
 
 
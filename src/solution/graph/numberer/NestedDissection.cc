@@ -0,0 +1,260 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//NestedDissection.cc
+
+#include "NestedDissection.h"
+#include <algorithm>
+
+namespace {
+
+//! @brief Work arrays for the level structures.
+struct LevelStructure
+  {
+    const std::vector<int> &xadj; //!< adjacency pointers.
+    const std::vector<int> &adjncy; //!< adjacency array.
+    std::vector<int> &region; //!< part that contains each vertex (-1: already numbered).
+    std::vector<int> level; //!< level of each vertex (-1: not in the structure).
+    std::vector<int> ls; //!< vertices by levels.
+    std::vector<int> xls; //!< start of each level in ls.
+
+    LevelStructure(const std::vector<int> &xa,const std::vector<int> &adj,std::vector<int> &rg)
+      : xadj(xa), adjncy(adj), region(rg), level(rg.size(),-1) {}
+    inline int degree(const int &v) const
+      { return xadj[v+1]-xadj[v]; }
+    inline int getNumLevels(void) const
+      { return xls.size()-1; }
+    //! @brief Remove the level marks of the vertices in the structure.
+    void clear(void)
+      {
+        for(std::vector<int>::const_iterator i= ls.begin();i!=ls.end();i++)
+          level[*i]= -1;
+        ls.clear();
+        xls.clear();
+      }
+    //! @brief Build the rooted level structure of the vertex root
+    //! inside the part id. Return the number of levels.
+    int build(const int &root,const int &id)
+      {
+        clear();
+        ls.push_back(root);
+        level[root]= 0;
+        xls.push_back(0);
+        size_t begin= 0;
+        int lvl= 0;
+        while(begin<ls.size())
+          {
+            const size_t end= ls.size();
+            xls.push_back(end);
+            lvl++;
+            for(size_t i= begin;i<end;i++)
+              {
+                const int v= ls[i];
+                for(int k= xadj[v];k<xadj[v+1];k++)
+                  {
+                    const int w= adjncy[k];
+                    if((region[w]==id) && (level[w]<0))
+                      {
+                        level[w]= lvl;
+                        ls.push_back(w);
+                      }
+                  }
+              }
+            begin= end;
+          }
+        return getNumLevels();
+      }
+    //! @brief Find a pseudo-peripheral vertex of the component
+    //! of root (George and Liu). On exit the structure contains
+    //! the level structure of that vertex.
+    int pseudo_peripheral_vertex(int root,const int &id)
+      {
+        int nlvl= build(root,id);
+        while(true)
+          {
+            // vertex of minimum degree in the last level.
+            int candidate= ls[xls[nlvl-1]];
+            for(int i= xls[nlvl-1]+1;i<xls[nlvl];i++)
+              if(degree(ls[i])<degree(candidate))
+                candidate= ls[i];
+            const int nl= build(candidate,id);
+            if(nl>nlvl)
+              {
+                root= candidate;
+                nlvl= nl;
+              }
+            else
+              {
+                build(root,id);
+                break;
+              }
+          }
+        return root;
+      }
+    //! @brief Number the vertices of the part id (which may have several
+    //! components) in the positions perm[begin], perm[begin+1],... using
+    //! the reverse Cuthill-McKee algorithm.
+    void rcm(const std::vector<int> &verts,const int &id,std::vector<int> &perm,int begin)
+      {
+        for(std::vector<int>::const_iterator i= verts.begin();i!=verts.end();i++)
+          if(region[*i]==id)
+            {
+              const int root= pseudo_peripheral_vertex(*i,id);
+              clear();
+              const int compBegin= begin;
+              perm[begin++]= root;
+              region[root]= -1;
+              std::vector<int> nbrs;
+              for(int q= compBegin;q<begin;q++)
+                {
+                  const int v= perm[q];
+                  nbrs.clear();
+                  for(int k= xadj[v];k<xadj[v+1];k++)
+                    {
+                      const int w= adjncy[k];
+                      if(region[w]==id)
+                        {
+                          nbrs.push_back(w);
+                          region[w]= -1;
+                        }
+                    }
+                  std::stable_sort(nbrs.begin(),nbrs.end(),[this](const int &a,const int &b){ return degree(a)<degree(b); });
+                  for(std::vector<int>::const_iterator j= nbrs.begin();j!=nbrs.end();j++)
+                    perm[begin++]= *j;
+                }
+              std::reverse(perm.begin()+compBegin,perm.begin()+begin);
+            }
+      }
+  };
+
+//! @brief Part of the graph pending to be numbered.
+struct Part
+  {
+    std::vector<int> verts; //!< vertices of the part.
+    int begin; //!< position of its first vertex in the permutation.
+    int id; //!< part identifier.
+  };
+
+} // end of anonymous namespace
+
+//! @brief Constructor.
+//!
+//! @param sz: size of the parts that are not further dissected.
+XC::NestedDissection::NestedDissection(const int &sz)
+  : minSize(std::max(sz,1)) {}
+
+//! @brief Return the nested dissection ordering of the graph.
+//!
+//! @param xadj: adjacency pointers (size: number of vertices+1).
+//! @param adjncy: adjacency array (symmetric, without self loops).
+//! @return permutation: perm[k] is the vertex that occupies the
+//! k-th position in the new ordering.
+std::vector<int> XC::NestedDissection::getPermutation(const std::vector<int> &xadj,const std::vector<int> &adjncy) const
+  {
+    const int n= (xadj.empty() ? 0 : xadj.size()-1);
+    std::vector<int> perm(n,-1);
+    if(n==0)
+      return perm;
+    std::vector<int> region(n,0);
+    LevelStructure lvls(xadj,adjncy,region);
+    int nextId= 1;
+    std::vector<Part> pending(1);
+    pending[0].begin= 0;
+    pending[0].id= 0;
+    pending[0].verts.resize(n);
+    for(int i= 0;i<n;i++)
+      pending[0].verts[i]= i;
+    while(!pending.empty())
+      {
+        Part p;
+        p.verts.swap(pending.back().verts);
+        p.begin= pending.back().begin;
+        p.id= pending.back().id;
+        pending.pop_back();
+        const int sz= p.verts.size();
+        if(sz<=minSize)
+          {
+            lvls.rcm(p.verts,p.id,perm,p.begin);
+            continue;
+          }
+        lvls.pseudo_peripheral_vertex(p.verts[0],p.id);
+        if(int(lvls.ls.size())<sz) // more than one component.
+          {
+            lvls.clear();
+            int begin= p.begin;
+            for(std::vector<int>::const_iterator i= p.verts.begin();i!=p.verts.end();i++)
+              if(region[*i]==p.id)
+                {
+                  lvls.build(*i,p.id);
+                  Part c;
+                  c.verts= lvls.ls;
+                  c.begin= begin;
+                  c.id= nextId++;
+                  for(std::vector<int>::const_iterator j= c.verts.begin();j!=c.verts.end();j++)
+                    region[*j]= c.id;
+                  begin+= c.verts.size();
+                  pending.push_back(c);
+                }
+            lvls.clear();
+            continue;
+          }
+        const int nlvl= lvls.getNumLevels();
+        if(nlvl<3) // almost complete graph.
+          {
+            lvls.clear();
+            lvls.rcm(p.verts,p.id,perm,p.begin);
+            continue;
+          }
+        // separator: vertices of the middle level adjacent
+        // to the next one.
+        const int mid= nlvl/2;
+        std::vector<int> separator;
+        for(int i= lvls.xls[mid];i<lvls.xls[mid+1];i++)
+          {
+            const int v= lvls.ls[i];
+            for(int k= xadj[v];k<xadj[v+1];k++)
+              if(lvls.level[adjncy[k]]==mid+1)
+                {
+                  separator.push_back(v);
+                  break;
+                }
+          }
+        lvls.clear();
+        int pos= p.begin+sz-separator.size();
+        for(std::vector<int>::const_iterator i= separator.begin();i!=separator.end();i++)
+          {
+            perm[pos++]= *i;
+            region[*i]= -1;
+          }
+        Part rest;
+        rest.begin= p.begin;
+        rest.id= nextId++;
+        rest.verts.reserve(sz-separator.size());
+        for(std::vector<int>::const_iterator i= p.verts.begin();i!=p.verts.end();i++)
+          if(region[*i]==p.id)
+            {
+              region[*i]= rest.id;
+              rest.verts.push_back(*i);
+            }
+        pending.push_back(rest);
+      }
+    return perm;
+  }
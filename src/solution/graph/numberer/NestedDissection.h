@@ -0,0 +1,61 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//NestedDissection.h
+
+#ifndef NestedDissection_h
+#define NestedDissection_h
+
+#include <vector>
+
+namespace XC {
+
+//! @ingroup Graph
+//
+//! @brief Nested dissection fill reducing ordering of a graph stored in
+//! compressed sparse row format (see CSRGraph).
+//!
+//! The graph is recursively split by vertex separators obtained from
+//! the middle level of the rooted level structure of a pseudo-peripheral
+//! vertex (George and Liu). The vertices of each separator are numbered
+//! after the vertices of the parts it separates. The parts with less
+//! than minSize vertices are numbered with the reverse Cuthill-McKee
+//! algorithm.
+class NestedDissection
+  {
+  private:
+    int minSize; //!< size of the parts that are not further dissected.
+  public:
+    NestedDissection(const int &minSize= 32);
+
+    //! @brief Return the size of the parts that are not further dissected.
+    inline const int &getMinSize(void) const
+      { return minSize; }
+    //! @brief Set the size of the parts that are not further dissected.
+    inline void setMinSize(const int &sz)
+      { minSize= sz; }
+
+    std::vector<int> getPermutation(const std::vector<int> &,const std::vector<int> &) const;
+  };
+
+} // end of XC namespace
+
+#endif
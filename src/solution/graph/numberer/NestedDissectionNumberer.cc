@@ -0,0 +1,102 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//NestedDissectionNumberer.cc
+
+#include "NestedDissectionNumberer.h"
+#include <solution/graph/graph/Graph.h>
+#include <solution/graph/graph/CSRGraph.h>
+#include <solution/graph/graph/Vertex.h>
+#include <utility/matrix/ID.h>
+
+//! @brief Constructor.
+//!
+//! @param minSize: size of the parts that are not further dissected.
+XC::NestedDissectionNumberer::NestedDissectionNumberer(const int &minSize)
+  :BaseNumberer(GraphNUMBERER_TAG_NestedDissection), nd(minSize) {}
+
+//! @brief Virtual constructor.
+XC::GraphNumberer *XC::NestedDissectionNumberer::getCopy(void) const
+  { return new NestedDissectionNumberer(*this); }
+
+//! @brief Nested dissection numbering of the compressed graph.
+//!
+//! The vertex whose tag is \p lastVertex (if any) is numbered last.
+const XC::ID &XC::NestedDissectionNumberer::number(const CSRGraph &theGraph, int lastVertex)
+  {
+    ID lastVertices;
+    if(lastVertex!=-1)
+      {
+        lastVertices.resize(1);
+        lastVertices(0)= lastVertex;
+      }
+    return number(theGraph,lastVertices);
+  }
+
+//! @brief Nested dissection numbering of the compressed graph.
+//!
+//! The vertices whose tags are in \p lastVertices are numbered last.
+const XC::ID &XC::NestedDissectionNumberer::number(const CSRGraph &theGraph, const ID &lastVertices)
+  {
+    // see if we can do quick return
+    if(!checkSize(theGraph)) 
+      return theRefResult;
+    const std::vector<int> perm= nd.getPermutation(theGraph.getXAdj(),theGraph.getAdjncy());
+    setResult(theGraph,perm,lastVertices);
+    return theRefResult;
+  }
+
+//! @brief Nested dissection numbering of the graph.
+//!
+//! Numbers the compressed version of the graph. As a side effect
+//! the \p Tmp variable of each vertex is set to the number assigned
+//! to it and the result contains the vertex references.
+const XC::ID &XC::NestedDissectionNumberer::number(Graph &theGraph, const ID &lastVertices)
+  {
+    const CSRGraph csr(theGraph);
+    number(csr,lastVertices);
+    const int numVertex= getNumVertex();
+    for(int i= 0;i<numVertex;i++)
+      {
+        Vertex *vertexPtr= theGraph.getVertexPtr(theRefResult(i));
+        vertexPtr->setTmp(i+1);
+        theRefResult(i)= vertexPtr->getRef();
+      }
+    return theRefResult;
+  }
+
+//! @brief Nested dissection numbering of the graph.
+const XC::ID &XC::NestedDissectionNumberer::number(Graph &theGraph, int lastVertex)
+  {
+    ID lastVertices;
+    if(lastVertex!=-1)
+      {
+        lastVertices.resize(1);
+        lastVertices(0)= lastVertex;
+      }
+    return number(theGraph,lastVertices);
+  }
+
+int XC::NestedDissectionNumberer::sendSelf(CommParameters &cp)
+  { return 0; }
+
+int XC::NestedDissectionNumberer::recvSelf(const CommParameters &cp)
+  { return 0; }
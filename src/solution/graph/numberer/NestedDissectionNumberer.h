@@ -0,0 +1,62 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//NestedDissectionNumberer.h
+
+#ifndef NestedDissectionNumberer_h
+#define NestedDissectionNumberer_h
+
+#include "BaseNumberer.h"
+#include "NestedDissection.h"
+
+namespace XC {
+//! @ingroup Graph
+//
+//! @brief Nested dissection fill reducing numbering of the
+//! vertices of a graph (see NestedDissection).
+class NestedDissectionNumberer: public BaseNumberer
+  {
+  private:
+    NestedDissection nd; //!< nested dissection algorithm.
+  protected:
+    friend class FEM_ObjectBroker;
+    friend class DOF_Numberer;
+    NestedDissectionNumberer(const int &minSize= 32);
+    GraphNumberer *getCopy(void) const;
+  public:
+    //! @brief Return the size of the parts that are not further dissected.
+    inline const int &getMinSize(void) const
+      { return nd.getMinSize(); }
+    //! @brief Set the size of the parts that are not further dissected.
+    inline void setMinSize(const int &sz)
+      { nd.setMinSize(sz); }
+
+    const ID &number(Graph &theGraph, int lastVertex = -1);
+    const ID &number(Graph &theGraph, const ID &lastVertices);
+    const ID &number(const CSRGraph &theGraph, int lastVertex = -1);
+    const ID &number(const CSRGraph &theGraph, const ID &lastVertices);
+
+    int sendSelf(CommParameters &);
+    int recvSelf(const CommParameters &);
+  };
+} // end of XC namespace
+
+#endif
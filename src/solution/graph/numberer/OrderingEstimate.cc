@@ -0,0 +1,209 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//OrderingEstimate.cc
+
+#include "OrderingEstimate.h"
+#include <solution/graph/graph/CSRGraph.h>
+#include <utility/matrix/ID.h>
+#include <iostream>
+#include <algorithm>
+
+//! @brief Constructor.
+XC::OrderingEstimate::OrderingEstimate(void)
+  : numEquations(0), bandwidth(0), profile(0.0), factorNonZeros(0.0),
+    bandFlops(0.0), profileFlops(0.0), sparseFlops(0.0), fullFlops(0.0) {}
+
+namespace {
+//! @brief Operations of the Cholesky factorization of a column with
+//! c entries below the diagonal (square root, divisions and update
+//! of the trailing matrix).
+inline double column_flops(const double &c)
+  { return (c+1.0)*(c+1.0); }
+} // end of anonymous namespace
+
+//! @brief Compute the estimates.
+//!
+//! @param theGraph: DOF group graph.
+//! @param orderedTags: tags of the vertices in the order of the numbering.
+//! @param weights: number of equations of each vertex (indexed as
+//! the vertices of the graph).
+void XC::OrderingEstimate::compute(const CSRGraph &theGraph,const ID &orderedTags,const std::vector<int> &weights)
+  {
+    const int n= theGraph.getNumVertex();
+    std::vector<int> perm(n,-1); // vertex at each position.
+    std::vector<int> iperm(n,-1); // position of each vertex.
+    for(int k= 0;k<n;k++)
+      {
+        const int v= theGraph.getIndex(orderedTags(k));
+        perm[k]= v;
+        iperm[v]= k;
+      }
+    std::vector<int> offset(n+1,0); // first equation of each position.
+    for(int k= 0;k<n;k++)
+      offset[k+1]= offset[k]+weights[perm[k]];
+    numEquations= offset[n];
+
+    // envelope: first equation of each row.
+    std::vector<double> colCount(numEquations+1,0.0);
+    bandwidth= 0;
+    profile= 0.0;
+    for(int k= 0;k<n;k++)
+      {
+        const int v= perm[k];
+        int first= k;
+        for(const int *j= theGraph.adjacencyBegin(v);j!=theGraph.adjacencyEnd(v);j++)
+          if(weights[*j]>0)
+            first= std::min(first,iperm[*j]);
+        for(int r= offset[k];r<offset[k+1];r++)
+          {
+            const int h= r-offset[first]; // entries left to the diagonal.
+            bandwidth= std::max(bandwidth,h);
+            profile+= h+1;
+            colCount[offset[first]]+= 1.0; // columns first..r-1 receive
+            colCount[r]-= 1.0;             // an entry of this row.
+          }
+      }
+    profileFlops= 0.0;
+    double c= 0.0;
+    for(int j= 0;j<numEquations;j++)
+      {
+        c+= colCount[j];
+        profileFlops+= column_flops(c);
+      }
+    bandFlops= 0.0;
+    fullFlops= 0.0;
+    for(int j= 0;j<numEquations;j++)
+      {
+        bandFlops+= column_flops(std::min(bandwidth,numEquations-1-j));
+        fullFlops+= column_flops(numEquations-1-j);
+      }
+
+    // elimination tree of the permuted graph (the vertices without
+    // equations are ignored).
+    std::vector<int> parent(n,-1);
+    std::vector<int> ancestor(n,-1);
+    for(int i= 0;i<n;i++)
+      {
+        const int v= perm[i];
+        if(weights[v]==0)
+          continue;
+        for(const int *j= theGraph.adjacencyBegin(v);j!=theGraph.adjacencyEnd(v);j++)
+          if(weights[*j]>0)
+            {
+              int k= iperm[*j];
+              while((k!=-1) && (k<i))
+                {
+                  const int next= ancestor[k];
+                  ancestor[k]= i;
+                  if(next==-1)
+                    parent[k]= i;
+                  k= next;
+                }
+            }
+      }
+    // weight of the rows of each column of the factor (row subtrees).
+    std::vector<double> rowWeights(n,0.0);
+    std::vector<int> mark(n,-1);
+    for(int i= 0;i<n;i++)
+      {
+        mark[i]= i;
+        const int v= perm[i];
+        const double wi= weights[v];
+        if(wi==0)
+          continue;
+        for(const int *j= theGraph.adjacencyBegin(v);j!=theGraph.adjacencyEnd(v);j++)
+          {
+            int k= iperm[*j];
+            if((k<i) && (weights[*j]>0))
+              while(mark[k]!=i)
+                {
+                  mark[k]= i;
+                  rowWeights[k]+= wi;
+                  k= parent[k];
+                }
+          }
+      }
+    factorNonZeros= 0.0;
+    sparseFlops= 0.0;
+    for(int k= 0;k<n;k++)
+      {
+        const int wk= weights[perm[k]];
+        for(int t= 0;t<wk;t++)
+          {
+            const double c= rowWeights[k]+(wk-1-t);
+            factorNonZeros+= c+1.0;
+            sparseFlops+= column_flops(c);
+          }
+      }
+  }
+
+//! @brief Return the number of entries of the factor for the storage
+//! scheme being passed as parameter ("band", "profile", "sparse" or "full").
+double XC::OrderingEstimate::getFill(const std::string &storageScheme) const
+  {
+    double retval= factorNonZeros;
+    if(storageScheme=="band")
+      retval= double(numEquations)*(bandwidth+1);
+    else if(storageScheme=="profile")
+      retval= profile;
+    else if(storageScheme=="full")
+      retval= double(numEquations)*(numEquations+1)/2.0;
+    else if(storageScheme!="sparse")
+      std::cerr << "OrderingEstimate::" << __FUNCTION__
+                << "; unknown storage scheme: '" << storageScheme
+                << "', sparse storage assumed." << std::endl;
+    return retval;
+  }
+
+//! @brief Return the number of operations of the factorization for the
+//! storage scheme being passed as parameter ("band", "profile",
+//! "sparse" or "full").
+double XC::OrderingEstimate::getFlops(const std::string &storageScheme) const
+  {
+    double retval= sparseFlops;
+    if(storageScheme=="band")
+      retval= bandFlops;
+    else if(storageScheme=="profile")
+      retval= profileFlops;
+    else if(storageScheme=="full")
+      retval= fullFlops;
+    else if(storageScheme!="sparse")
+      std::cerr << "OrderingEstimate::" << __FUNCTION__
+                << "; unknown storage scheme: '" << storageScheme
+                << "', sparse storage assumed." << std::endl;
+    return retval;
+  }
+
+//! @brief Return a Python dictionary with the estimates.
+boost::python::dict XC::OrderingEstimate::getPyDict(void) const
+  {
+    boost::python::dict retval;
+    retval["numEquations"]= numEquations;
+    retval["bandwidth"]= bandwidth;
+    retval["profile"]= profile;
+    retval["factorNonZeros"]= factorNonZeros;
+    retval["bandFlops"]= bandFlops;
+    retval["profileFlops"]= profileFlops;
+    retval["sparseFlops"]= sparseFlops;
+    retval["fullFlops"]= fullFlops;
+    return retval;
+  }
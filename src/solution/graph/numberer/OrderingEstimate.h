@@ -0,0 +1,83 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//OrderingEstimate.h
+
+#ifndef OrderingEstimate_h
+#define OrderingEstimate_h
+
+#include <vector>
+#include <string>
+#include <boost/python/dict.hpp>
+
+namespace XC {
+class CSRGraph;
+class ID;
+
+//! @ingroup Graph
+//
+//! @brief Estimates of the cost of the factorization of a system of
+//! equations whose graph is numbered with a given ordering.
+//!
+//! The estimates are computed from the DOF group graph, each vertex
+//! having as many equations as free DOFs has its DOF group. The
+//! band and profile figures come from the positions of the neighbours
+//! of each vertex, the sparse ones from the column counts of the
+//! Cholesky factor (obtained from the elimination tree). The numbers
+//! of floating point operations are those of a Cholesky
+//! factorization; a LU factorization without pivoting doubles them
+//! whatever the ordering so the comparison between orderings
+//! remains valid.
+class OrderingEstimate
+  {
+  private:
+    int numEquations; //!< number of equations.
+    int bandwidth; //!< half bandwidth.
+    double profile; //!< entries of the envelope (lower triangle, diagonal included).
+    double factorNonZeros; //!< entries of the sparse Cholesky factor (diagonal included).
+    double bandFlops; //!< operations of the band factorization.
+    double profileFlops; //!< operations of the profile (skyline) factorization.
+    double sparseFlops; //!< operations of the sparse factorization.
+    double fullFlops; //!< operations of the dense factorization.
+  public:
+    OrderingEstimate(void);
+    void compute(const CSRGraph &,const ID &,const std::vector<int> &);
+
+    //! @brief Return the number of equations.
+    inline int getNumEquations(void) const
+      { return numEquations; }
+    //! @brief Return the half bandwidth.
+    inline int getBandwidth(void) const
+      { return bandwidth; }
+    //! @brief Return the number of entries of the envelope.
+    inline double getProfile(void) const
+      { return profile; }
+    //! @brief Return the number of entries of the sparse factor.
+    inline double getFactorNonZeros(void) const
+      { return factorNonZeros; }
+    double getFill(const std::string &) const;
+    double getFlops(const std::string &) const;
+
+    boost::python::dict getPyDict(void) const;
+  };
+} // end of XC namespace
+
+#endif
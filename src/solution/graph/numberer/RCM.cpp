@@ -61,6 +61,7 @@
 
 #include <solution/graph/numberer/RCM.h>
 #include <solution/graph/graph/Graph.h>
+#include <solution/graph/graph/CSRGraph.h>
 #include <solution/graph/graph/Vertex.h>
 #include <solution/graph/graph/VertexIter.h>
 #include <utility/matrix/ID.h>
@@ -284,6 +285,151 @@ const XC::ID &XC::RCM::number(Graph &theGraph, int startVertex)
   }
 
 
+//! @brief Reverse Cuthill-McKee ordering of the compressed graph
+//! starting with the vertex whose index is \p start. On return
+//! \p order contains the vertex indexes (the start vertex is placed
+//! at the end) and \p startLastLevelSet the position in \p order
+//! of the last level set. Returns the profile of the numbering.
+//!
+//! @param theGraph: graph to number.
+//! @param start: index of the starting vertex.
+//! @param order: vertex indexes in the order of the numbering.
+//! @param mark: work array (position of each vertex in order).
+//! @param startLastLevelSet: start of the last level set in order.
+int XC::RCM::cuthillMcKee(const CSRGraph &theGraph,const int &start,std::vector<int> &order,std::vector<int> &mark,int &startLastLevelSet)
+  {
+    const int numVertex= theGraph.getNumVertex();
+    order.assign(numVertex,-1);
+    mark.assign(numVertex,-1);
+    int profile= 0;
+    int currentMark= numVertex-1;  // marks current vertex visiting.
+    int nextMark= currentMark-1;  // marks where to put next vertex.
+    startLastLevelSet= nextMark;
+    int nextUnmarked= 0; // first candidate for a disconnected graph.
+    order[currentMark]= start;
+    mark[start]= currentMark;
+    while(nextMark >= 0)
+      {
+        // go through the vertex adjacency and add the vertices
+        // that have not yet been marked.
+        const int v= order[currentMark];
+        for(const int *i= theGraph.adjacencyBegin(v);i!=theGraph.adjacencyEnd(v);i++)
+          if(mark[*i] == -1)
+            {
+              mark[*i]= nextMark;
+              profile+= (currentMark-nextMark);
+              order[nextMark--]= *i;
+            }
+
+        // go to the next vertex
+        //  we decrement because we are doing reverse Cuthill-McKee
+        currentMark--;
+        if(startLastLevelSet == currentMark)
+          startLastLevelSet= nextMark;
+
+        // check to see if graph is disconneted
+        if((currentMark == nextMark) && (currentMark >= 0))
+          {
+            while(mark[nextUnmarked] != -1)
+              nextUnmarked++;
+            nextMark--;
+            startLastLevelSet= nextMark;
+            mark[nextUnmarked]= currentMark;
+            order[currentMark]= nextUnmarked;
+          }
+      }
+    return profile;
+  }
+
+//! @brief Reverse Cuthill-McKee numbering of the compressed graph.
+//!
+//! Same algorithm as number(Graph &,int) (same results) working
+//! directly on the arrays of the compressed graph.
+const XC::ID &XC::RCM::number(const CSRGraph &theGraph, int startVertex)
+  {
+    // see if we can do quick return
+    if(!checkSize(theGraph)) 
+      return theRefResult;
+
+    int start= -1;
+    if(startVertex != -1)
+      {
+        start= theGraph.getIndex(startVertex);
+        if(start < 0)
+          std::cerr << getClassName() << "::" << __FUNCTION__
+                    << "; WARNING - no vertex with tag " << startVertex
+                    << " exists - using the first one.\n";
+      }
+
+    std::vector<int> order;
+    std::vector<int> mark;
+    int startLastLevelSet= 0;
+    if(start < 0)
+      {
+        start= 0;
+        // if GPS true use gibbs-poole-stodlmyer determine the last 
+        // level set assuming a starting vertex and then use one of the 
+        // nodes in this set to base the numbering on        
+        if(GPS)
+          {
+            cuthillMcKee(theGraph,start,order,mark,startLastLevelSet);
+            if(startLastLevelSet > 0)
+              {
+                ID lastLevelSet(startLastLevelSet);
+                for(int i=0; i<startLastLevelSet; i++)
+                  lastLevelSet(i)= theGraph.getTag(order[i]);
+                return this->number(theGraph,lastLevelSet);
+              }
+          }
+      }
+    cuthillMcKee(theGraph,start,order,mark,startLastLevelSet);
+    const int numVertex= getNumVertex();
+    for(int i=0; i<numVertex; i++)
+      theRefResult(i)= theGraph.getTag(order[i]);
+    return theRefResult;
+  }
+
+//! @brief Determine the best starting vertex (compressed graph).
+//! 
+//! Performs a RCM numbering using each of the vertices in
+//! \p startVertices as starting vertex and keeps the one with
+//! the smallest profile (see number(Graph &,const ID &)).
+const XC::ID &XC::RCM::number(const CSRGraph &theGraph, const ID &startVertices)
+  {
+    // see if we can do quick return
+    if(!checkSize(theGraph)) 
+      return theRefResult;
+
+    std::vector<int> order;
+    std::vector<int> bestOrder;
+    std::vector<int> mark;
+    int minProfile= 0;
+    int startLastLevelSet= 0;
+    const int startVerticesSize= startVertices.Size();
+    for(int i=0; i<startVerticesSize; i++)
+      {
+        const int start= theGraph.getIndex(startVertices(i));
+        if(start < 0)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; WARNING - no vertex with tag " << startVertices(i)
+                      << " exists - ignored.\n";
+            continue;
+          }
+        const int profile= cuthillMcKee(theGraph,start,order,mark,startLastLevelSet);
+        if(bestOrder.empty() || (minProfile > profile))
+          {
+            bestOrder.swap(order);
+            minProfile= profile;
+          }
+      }
+    if(bestOrder.empty()) // no valid starting vertex.
+      cuthillMcKee(theGraph,0,bestOrder,mark,startLastLevelSet);
+    const int numVertex= getNumVertex();
+    for(int i=0; i<numVertex; i++)
+      theRefResult(i)= theGraph.getTag(bestOrder[i]);
+    return theRefResult;
+  }
 
 int XC::RCM::sendSelf(CommParameters &cp)
   { return 0; }
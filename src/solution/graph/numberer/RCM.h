@@ -69,6 +69,7 @@
 #define RCM_h
 
 #include "BaseNumberer.h"
+#include <vector>
 
 namespace XC {
 //! @ingroup Graph
@@ -80,6 +81,7 @@ class RCM: public BaseNumberer
   {
   private:
     bool GPS; // flag for gibbs-poole-stodlymer
+    static int cuthillMcKee(const CSRGraph &,const int &,std::vector<int> &,std::vector<int> &,int &);
   protected:
     friend class FEM_ObjectBroker;
     friend class DOF_Numberer;
@@ -89,6 +91,8 @@ class RCM: public BaseNumberer
 
     const ID &number(Graph &theGraph, int lastVertex = -1);
     const ID &number(Graph &theGraph, const ID &lastVertices);
+    const ID &number(const CSRGraph &theGraph, int lastVertex = -1);
+    const ID &number(const CSRGraph &theGraph, const ID &lastVertices);
 
     int sendSelf(CommParameters &);
     int recvSelf(const CommParameters &);
@@ -62,6 +62,7 @@
 
 #include <solution/graph/numberer/SimpleNumberer.h>
 #include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/CSRGraph.h"
 #include <solution/graph/graph/Vertex.h>
 #include <solution/graph/graph/VertexIter.h>
 #include <utility/matrix/ID.h>
@@ -110,3 +111,25 @@ int XC::SimpleNumberer::recvSelf(const CommParameters &cp)
 
 const XC::ID &XC::SimpleNumberer::number(Graph &theGraph, const XC::ID &startVertices)
   { return this->number(theGraph); }
+
+//! @brief Numbers the vertices of the compressed graph in ascending
+//! order of their tags.
+const XC::ID &XC::SimpleNumberer::number(const CSRGraph &theGraph, int lastVertex)
+  {
+    // see if we can do quick return
+    if(!checkSize(theGraph))
+      return theRefResult;
+
+    if(lastVertex != -1)
+      {
+        std::cerr << "WARNING:  SimpleNumberer::number -";
+        std::cerr << " - does not deal with lastVertex";
+      }
+    const int numVertex= getNumVertex();
+    for(int i= 0;i<numVertex;i++)
+      theRefResult(i)= theGraph.getTag(i);
+    return theRefResult;
+  }
+
+const XC::ID &XC::SimpleNumberer::number(const CSRGraph &theGraph, const XC::ID &startVertices)
+  { return this->number(theGraph); }
@@ -82,6 +82,8 @@ class SimpleNumberer: public BaseNumberer
     
     const ID &number(Graph &theGraph, int lastVertex = -1);
     const ID &number(Graph &theGraph, const ID &startVertices);
+    const ID &number(const CSRGraph &theGraph, int lastVertex = -1);
+    const ID &number(const CSRGraph &theGraph, const ID &startVertices);
     
     virtual int sendSelf(CommParameters &);
     virtual int recvSelf(const CommParameters &);    
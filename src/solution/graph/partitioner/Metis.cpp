@@ -65,6 +65,7 @@
 
 #include <solution/graph/partitioner/Metis.h>
 #include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/CSRGraph.h"
 #include <solution/graph/graph/Vertex.h>
 #include <solution/graph/graph/VertexIter.h>
 
@@ -517,6 +518,56 @@ const XC::ID &XC::Metis::number(Graph &theGraph, int lastVertex)
 const XC::ID &XC::Metis::number(Graph &theGraph, const ID &lastVertices)
   { return this->number(theGraph); }
 
+//! @brief Numbers the vertices of the compressed graph so that the
+//! vertices in partition i have lower numbers than those in partition i+1.
+//! The graph arrays are passed directly to the METIS library.
+const XC::ID &XC::Metis::number(const CSRGraph &theGraph, int lastVertex)
+  {
+    int numVertex= theGraph.getNumVertex();
+    theRefResult.resize(numVertex);
+
+    if(checkOptions() == false)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "ERROR: chek options failed\n";
+        return theRefResult;
+      }
+
+    std::vector<int> options(5,0);
+    std::vector<int> partition(numVertex+1,0);
+    int *vwgts= nullptr;
+    int *ewgts= nullptr;
+    int numbering= 0;
+    int weightflag= 0; // no weights on our graphs yet
+    int edgecut;
+    if(defaultOptions == false)
+      {
+	options[0]= 1;
+	options[1]= myCoarsenTo;
+	options[2]= myMtype;
+	options[3]= myIPtype;
+	options[4]= myRtype;
+      }
+    // METIS doesn't modify the graph arrays.
+    int *xadj= const_cast<int *>(theGraph.getXAdj().data());
+    int *adjncy= const_cast<int *>(theGraph.getAdjncy().data());
+    if(myPtype == 1) 
+      METIS_PartGraphRecursive(&numVertex, xadj, adjncy, vwgts, ewgts, &weightflag,&numbering, &numPartitions, &options[0], &edgecut, &partition[0]);
+    else		
+      METIS_PartGraphKway(&numVertex, xadj, adjncy, vwgts, ewgts, &weightflag, &numbering, &numPartitions, &options[0], &edgecut, &partition[0]);
+
+    // we assign numbers now based on the partitions returned.
+    int count= 0;
+    for(int i=0; i<numPartitions; i++)
+      for(int vert=0; vert<numVertex; vert++)
+	if(partition[vert] == i)
+          theRefResult(count++)= theGraph.getRef(vert);
+    return theRefResult;
+  }
+
+const XC::ID &XC::Metis::number(const CSRGraph &theGraph, const ID &lastVertices)
+  { return this->number(theGraph); }
+
 int XC::Metis::sendSelf(CommParameters &cp)
   { return 0; }
 
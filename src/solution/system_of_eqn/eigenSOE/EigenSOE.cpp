@@ -50,6 +50,7 @@
 #include <solution/system_of_eqn/eigenSOE/SymArpackSolver.h>
 #include <solution/system_of_eqn/eigenSOE/SymBandEigenSolver.h>
 #include <solution/system_of_eqn/eigenSOE/FullGenEigenSolver.h>
+#include <solution/system_of_eqn/eigenSOE/ShiftInvertLanczosSolver.h>
 
 
 
@@ -123,6 +124,8 @@ XC::EigenSolver &XC::EigenSOE::newSolver(const std::string &tipo)
       setSolver(new FullGenEigenSolver());
     else if(tipo=="sym_arpack_solver")
       setSolver(new SymArpackSolver());
+    else if(tipo=="shift_invert_lanczos_solver")
+      setSolver(new ShiftInvertLanczosSolver());
     else
       std::cerr << "Solver of type: '"
                 << tipo << "' unknown." << std::endl;
@@ -0,0 +1,751 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ShiftInvertLanczosSolver.cc
+
+#include <solution/system_of_eqn/eigenSOE/ShiftInvertLanczosSolver.h>
+#include <solution/system_of_eqn/eigenSOE/SparseGenColEigenSOE.h>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+extern "C" int dsygv_(int *itype, char *jobz, char *uplo, int *n,
+                      double *a, int *lda, double *b, int *ldb,
+                      double *w, double *work, int *lwork, int *info);
+
+namespace XC {
+//! @brief Dot product of two vectors of size n.
+inline double dot_prod(const double *a,const double *b,const int &n)
+  {
+    double retval= 0.0;
+    for(int i= 0;i<n;i++)
+      retval+= a[i]*b[i];
+    return retval;
+  }
+
+//! @brief Orthonormalizes the \p nW columns of W with respect to the
+//! \p nV columns of V and to each other (modified Gram-Schmidt with
+//! reorthogonalization). The columns that are (numerically) linearly
+//! dependent are dropped; returns the number of columns kept (stored
+//! at the beginning of W).
+int orthonormalize(const std::vector<double> &V,const int &n,const int &nV,std::vector<double> &W,const int &nW)
+  {
+    int kept= 0;
+    for(int j= 0;j<nW;j++)
+      {
+        double *w= &W[j*n];
+        const double norm0= sqrt(dot_prod(w,w,n));
+        if(norm0==0.0)
+          continue;
+        for(int pass= 0;pass<2;pass++)
+          {
+            for(int i= 0;i<nV;i++)
+              {
+                const double *v= &V[i*n];
+                const double d= dot_prod(v,w,n);
+                for(int k= 0;k<n;k++)
+                  w[k]-= d*v[k];
+              }
+            for(int i= 0;i<kept;i++)
+              {
+                const double *v= &W[i*n];
+                const double d= dot_prod(v,w,n);
+                for(int k= 0;k<n;k++)
+                  w[k]-= d*v[k];
+              }
+          }
+        const double nrm= sqrt(dot_prod(w,w,n));
+        if(nrm>1e-10*norm0)
+          {
+            double *dest= &W[kept*n];
+            for(int k= 0;k<n;k++)
+              dest[k]= w[k]/nrm;
+            kept++;
+          }
+      }
+    return kept;
+  }
+} // end of XC namespace
+
+//! @brief Constructor.
+XC::ShiftInvertLanczosSolver::ShiftedFactorization::ShiftedFactorization(const double &s,const int &n)
+  : shift(s), perm_r(n)
+  {
+    L.ncol= 0;
+    U.ncol= 0;
+  }
+
+//! @brief Destructor.
+XC::ShiftInvertLanczosSolver::ShiftedFactorization::~ShiftedFactorization(void)
+  {
+    if(L.ncol!=0)
+      Destroy_SuperNode_Matrix(&L);
+    if(U.ncol!=0)
+      Destroy_CompCol_Matrix(&U);
+  }
+
+//! @brief Constructor.
+XC::ShiftInvertLanczosSolver::ShiftInvertLanczosSolver(void)
+  :EigenSolver(EigenSOLVER_TAGS_ShiftInvertLanczosSolver), theSOE(nullptr),
+   blockSize(0), maxNumIter(100), tol(1e-8), numIter(0)
+  {
+    options.Fact= DOFACT;
+    options.Equil= NO;
+    options.ColPerm= MMD_AT_PLUS_A;
+    options.DiagPivotThresh= 0.01;
+    options.Trans= NOTRANS;
+    options.IterRefine= NOREFINE;
+    options.SymmetricMode= YES;
+    options.PivotGrowth= NO;
+    options.ConditionNumber= NO;
+    options.PrintStat= NO;
+  }
+
+//! @brief Copy constructor (the factorizations are not copied).
+XC::ShiftInvertLanczosSolver::ShiftInvertLanczosSolver(const ShiftInvertLanczosSolver &otro)
+  :EigenSolver(otro), theSOE(otro.theSOE), blockSize(otro.blockSize),
+   maxNumIter(otro.maxNumIter), tol(otro.tol), numIter(0),
+   options(otro.options), eigenvalue(otro.eigenvalue),
+   eigenvector(otro.eigenvector), eigenV(otro.eigenV)
+  {}
+
+//! @brief Assignment operator (the factorizations are not copied).
+XC::ShiftInvertLanczosSolver &XC::ShiftInvertLanczosSolver::operator=(const ShiftInvertLanczosSolver &otro)
+  {
+    EigenSolver::operator=(otro);
+    free_factorizations();
+    theSOE= otro.theSOE;
+    blockSize= otro.blockSize;
+    maxNumIter= otro.maxNumIter;
+    tol= otro.tol;
+    numIter= 0;
+    options= otro.options;
+    eigenvalue= otro.eigenvalue;
+    eigenvector= otro.eigenvector;
+    eigenV= otro.eigenV;
+    return *this;
+  }
+
+//! @brief Destructor.
+XC::ShiftInvertLanczosSolver::~ShiftInvertLanczosSolver(void)
+  { free_factorizations(); }
+
+//! @brief Releases the memory used by the factorizations and the
+//! fill reducing ordering.
+void XC::ShiftInvertLanczosSolver::free_factorizations(void)
+  {
+    for(factorization_vector::iterator i= factorizations.begin();i!=factorizations.end();i++)
+      delete *i;
+    factorizations.clear();
+  }
+
+//! @brief Releases the factorizations whose shift is not
+//! in the vector being passed as parameter.
+void XC::ShiftInvertLanczosSolver::free_unused_factorizations(const Vector &shifts)
+  {
+    factorization_vector tmp;
+    const int ns= shifts.Size();
+    for(factorization_vector::iterator i= factorizations.begin();i!=factorizations.end();i++)
+      {
+        bool used= false;
+        for(int j= 0;j<ns;j++)
+          if(shifts(j)==(*i)->shift)
+            { used= true; break; }
+        if(used)
+          tmp.push_back(*i);
+        else
+          delete *i;
+      }
+    factorizations.swap(tmp);
+  }
+
+//! @brief Returns true if the values of K or M differ from the ones
+//! used to compute the stored factorizations.
+bool XC::ShiftInvertLanczosSolver::matrices_changed(void) const
+  {
+    bool retval= true;
+    if((factoredK.Size()==theSOE->A.Size()) && (factoredM.Size()==theSOE->M.Size()))
+      {
+        const double *k0= factoredK.getDataPtr();
+        const double *m0= factoredM.getDataPtr();
+        const double *k= theSOE->A.getDataPtr();
+        const double *m= theSOE->M.getDataPtr();
+        retval= !std::equal(k0,k0+factoredK.Size(),k) || !std::equal(m0,m0+factoredM.Size(),m);
+      }
+    return retval;
+  }
+
+//! @brief Returns the factorization of the matrix \f$K-\sigma M\f$,
+//! computing it if needed (nullptr if the factorization fails).
+const XC::ShiftInvertLanczosSolver::ShiftedFactorization *XC::ShiftInvertLanczosSolver::get_factorization(const double &sigma)
+  {
+    for(factorization_vector::const_iterator i= factorizations.begin();i!=factorizations.end();i++)
+      if((*i)->shift==sigma)
+        return *i;
+
+    const int n= theSOE->size;
+    const int nnz= theSOE->nnz;
+    // values of the shifted matrix.
+    std::vector<double> values(nnz);
+    const double *a= theSOE->A.getDataPtr();
+    const double *m= theSOE->M.getDataPtr();
+    for(int k= 0;k<nnz;k++)
+      values[k]= a[k]-sigma*m[k];
+    SuperMatrix Ks;
+    dCreate_CompCol_Matrix(&Ks, n, n, nnz, &values[0], theSOE->rowA.getDataPtr(), theSOE->colStartA.getDataPtr(), SLU_NC, SLU_D, SLU_GE);
+
+    // the fill reducing ordering depends only on the sparsity pattern.
+    if(perm_c.Size()!=n)
+      {
+        perm_c.resize(n);
+        etree.resize(n);
+        get_perm_c(2, &Ks, perm_c.getDataPtr()); // minimum degree on A^T+A.
+      }
+    SuperMatrix AC;
+    options.Fact= DOFACT;
+    sp_preorder(&options, &Ks, perm_c.getDataPtr(), etree.getDataPtr(), &AC);
+
+    ShiftedFactorization *retval= new ShiftedFactorization(sigma,n);
+    int info= 0;
+    SuperLUStat_t slu_stat;
+    StatInit(&slu_stat);
+    const int panelSize= sp_ienv(1);
+    const int relax= sp_ienv(2);
+    dgstrf(&options, &AC, relax, panelSize, etree.getDataPtr(), nullptr, 0, perm_c.getDataPtr(), retval->perm_r.getDataPtr(), &retval->L, &retval->U, &slu_stat, &info);
+    StatFree(&slu_stat);
+
+    NCPformat *ACstore= static_cast<NCPformat *>(AC.Store);
+    SUPERLU_FREE(ACstore->colbeg);
+    SUPERLU_FREE(ACstore->colend);
+    SUPERLU_FREE(ACstore);
+    Destroy_SuperMatrix_Store(&Ks);
+
+    if(info!=0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; error " << info
+                  << " returned by dgstrf() when factorizing K-shift*M"
+                  << " (shift: " << sigma
+                  << "). The shift may be an eigenvalue." << std::endl;
+        if(info>n) // memory allocation failure.
+          { retval->L.ncol= 0; retval->U.ncol= 0; }
+        delete retval;
+        retval= nullptr;
+      }
+    else
+      factorizations.push_back(retval);
+    return retval;
+  }
+
+//! @brief Computes the product of the matrix whose non-zero values
+//! are being passed as parameter (K or M) by the \p nc vectors of x.
+void XC::ShiftInvertLanczosSolver::prod(const Vector &values,const double *x,double *y,const int &nc) const
+  {
+    const int n= theSOE->size;
+    const double *v= values.getDataPtr();
+    const int *row= theSOE->rowA.getDataPtr();
+    const int *colStart= theSOE->colStartA.getDataPtr();
+    for(int c= 0;c<nc;c++)
+      {
+        const double *xc= x+c*n;
+        double *yc= y+c*n;
+        std::fill(yc,yc+n,0.0);
+        for(int j= 0;j<n;j++)
+          {
+            const double xj= xc[j];
+            if(xj!=0.0)
+              for(int k= colStart[j];k<colStart[j+1];k++)
+                yc[row[k]]+= v[k]*xj;
+          }
+      }
+  }
+
+//! @brief Applies the operator \f$(K-\sigma M)^{-1} M\f$ to the
+//! \p nc vectors of x.
+int XC::ShiftInvertLanczosSolver::apply_operator(const ShiftedFactorization &f,const double *x,double *y,const int &nc) const
+  {
+    const int n= theSOE->size;
+    prod(theSOE->M,x,y,nc);
+    SuperMatrix B;
+    dCreate_Dense_Matrix(&B, n, nc, y, n, SLU_DN, SLU_D, SLU_GE);
+    SuperLUStat_t slu_stat;
+    StatInit(&slu_stat);
+    int info= 0;
+    ShiftedFactorization &ff= const_cast<ShiftedFactorization &>(f);
+    dgstrs(NOTRANS, &ff.L, &ff.U, const_cast<int *>(perm_c.getDataPtr()), ff.perm_r.getDataPtr(), &B, &slu_stat, &info);
+    StatFree(&slu_stat);
+    Destroy_SuperMatrix_Store(&B);
+    if(info!=0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; error " << info
+                << " returned by dgstrs()." << std::endl;
+    return info;
+  }
+
+//! @brief Solves the projected eigenproblem \f$K_r y= \lambda M_r y\f$
+//! (matrices of order \p m stored by columns). If \f$M_r\f$ is not
+//! positive definite (i.e. the mass matrix is singular) the problem
+//! \f$M_r y= \nu (K_r-\sigma M_r) y\f$ is solved instead and
+//! \f$\lambda= \sigma+1/\nu\f$.
+int XC::ShiftInvertLanczosSolver::solve_projected(const int &m,const std::vector<double> &Kr,const std::vector<double> &Mr,const double &sigma,std::vector<double> &lambda,std::vector<double> &Y) const
+  {
+    int itype= 1;
+    char jobz[]= "V";
+    char uplo[]= "U";
+    int order= m;
+    int lwork= std::max(1,3*m*m);
+    std::vector<double> work(lwork);
+    std::vector<double> b(Mr);
+    Y= Kr;
+    lambda.resize(m);
+    int info= 0;
+    dsygv_(&itype, jobz, uplo, &order, &Y[0], &order, &b[0], &order, &lambda[0], &work[0], &lwork, &info);
+    if(info>m) // M_r is not positive definite.
+      {
+        Y= Mr;
+        b= Kr;
+        for(int k= 0;k<m*m;k++)
+          b[k]-= sigma*Mr[k];
+        std::vector<double> nu(m);
+        info= 0;
+        dsygv_(&itype, jobz, uplo, &order, &Y[0], &order, &b[0], &order, &nu[0], &work[0], &lwork, &info);
+        if(info==0)
+          {
+            double numax= 0.0;
+            for(int i= 0;i<m;i++)
+              numax= std::max(numax,std::fabs(nu[i]));
+            for(int i= 0;i<m;i++)
+              {
+                if(std::fabs(nu[i])>1e-12*numax)
+                  lambda[i]= sigma+1.0/nu[i];
+                else // infinite eigenvalue (massless mode).
+                  lambda[i]= std::numeric_limits<double>::max();
+              }
+          }
+      }
+    if(info!=0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; LAPACK dsygv returned error code " << info
+                << std::endl;
+    return info;
+  }
+
+//! @brief Computes the \p nev eigenpairs closest to the shift
+//! \f$\sigma\f$. The eigenvalues are returned ordered by its distance
+//! to the shift and the eigenvectors are normalized with respect to
+//! the mass matrix (when its norm is not zero).
+int XC::ShiftInvertLanczosSolver::solve_shift(const double &sigma,const int &nev,std::vector<double> &values,std::vector<double> &vectors)
+  {
+    values.clear();
+    vectors.clear();
+    const ShiftedFactorization *f= get_factorization(sigma);
+    if(!f)
+      return -1;
+
+    const int n= theSOE->size;
+    const int k= std::min(n,nev+std::max(2,nev/4)); // retained vectors.
+    const int m= std::min(n,std::max(2*k,k+20)); // subspace dimension.
+    const int p= (blockSize>0) ? std::min(blockSize,k) : std::min(k,std::max(nev,1));
+
+    // starting block (deterministic pseudo-random vectors).
+    std::vector<double> X(n*p);
+    unsigned long seed= 12345;
+    for(int i= 0;i<n*p;i++)
+      {
+        seed= (seed*1103515245+12345) % 2147483648UL;
+        X[i]= double(seed)/2147483648.0-0.5;
+      }
+    std::vector<double> block(n*p);
+    int info= apply_operator(*f,&X[0],&block[0],p);
+    int nb= p;
+
+    std::vector<double> V(n*m), KV(n*m), MV(n*m), W;
+    std::vector<double> Kr, Mr, lambda, Y;
+    std::vector<int> order;
+    bool converged= false;
+    for(int iter= 0;(info==0) && (iter<maxNumIter);iter++)
+      {
+        numIter++;
+        // block Krylov subspace.
+        int nV= 0;
+        while(nb>0)
+          {
+            nb= orthonormalize(V,n,nV,block,nb);
+            nb= std::min(nb,m-nV);
+            std::copy(block.begin(),block.begin()+n*nb,V.begin()+n*nV);
+            const int lastStart= nV;
+            nV+= nb;
+            if((nV<m) && (nb>0))
+              {
+                W.resize(n*nb);
+                info= apply_operator(*f,&V[n*lastStart],&W[0],nb);
+                if(info!=0)
+                  break;
+                block.swap(W);
+              }
+            else
+              break;
+          }
+        if((info!=0) || (nV==0))
+          break;
+
+        // Rayleigh-Ritz projection.
+        prod(theSOE->A,&V[0],&KV[0],nV);
+        prod(theSOE->M,&V[0],&MV[0],nV);
+        Kr.resize(nV*nV);
+        Mr.resize(nV*nV);
+        for(int j= 0;j<nV;j++)
+          for(int i= 0;i<=j;i++)
+            {
+              Kr[i+j*nV]= Kr[j+i*nV]= 0.5*(dot_prod(&V[i*n],&KV[j*n],n)+dot_prod(&V[j*n],&KV[i*n],n));
+              Mr[i+j*nV]= Mr[j+i*nV]= 0.5*(dot_prod(&V[i*n],&MV[j*n],n)+dot_prod(&V[j*n],&MV[i*n],n));
+            }
+        info= solve_projected(nV,Kr,Mr,sigma,lambda,Y);
+        if(info!=0)
+          break;
+
+        // Ritz values ordered by its distance to the shift.
+        order.resize(nV);
+        for(int i= 0;i<nV;i++)
+          order[i]= i;
+        std::stable_sort(order.begin(),order.end(),[&lambda,&sigma](const int &a,const int &b){ return std::fabs(lambda[a]-sigma)<std::fabs(lambda[b]-sigma); });
+
+        // residuals of the wanted eigenpairs.
+        const int nConv= std::min(nev,nV);
+        std::vector<double> Kx(n), Mx(n);
+        converged= true;
+        for(int c= 0;(c<nConv) && converged;c++)
+          {
+            const double *y= &Y[order[c]*nV];
+            const double l= lambda[order[c]];
+            std::fill(Kx.begin(),Kx.end(),0.0);
+            std::fill(Mx.begin(),Mx.end(),0.0);
+            for(int j= 0;j<nV;j++)
+              for(int i= 0;i<n;i++)
+                {
+                  Kx[i]+= KV[i+j*n]*y[j];
+                  Mx[i]+= MV[i+j*n]*y[j];
+                }
+            double r2= 0.0;
+            for(int i= 0;i<n;i++)
+              {
+                const double r= Kx[i]-l*Mx[i];
+                r2+= r*r;
+              }
+            const double den= sqrt(dot_prod(&Kx[0],&Kx[0],n))+std::fabs(l)*sqrt(dot_prod(&Mx[0],&Mx[0],n));
+            if((den>0.0) && (sqrt(r2)>tol*den))
+              converged= false;
+          }
+        const bool lastIter= (iter==maxNumIter-1);
+        if(converged || (nV==n) || lastIter)
+          {
+            if(!converged && (nV<n))
+              std::cerr << getClassName() << "::" << __FUNCTION__
+                        << "; WARNING eigenpairs not converged after "
+                        << maxNumIter << " iterations (shift: "
+                        << sigma << ").\n";
+            values.resize(nConv);
+            vectors.resize(n*nConv);
+            for(int c= 0;c<nConv;c++)
+              {
+                const double *y= &Y[order[c]*nV];
+                values[c]= lambda[order[c]];
+                double *x= &vectors[c*n];
+                for(int j= 0;j<nV;j++)
+                  for(int i= 0;i<n;i++)
+                    x[i]+= V[i+j*n]*y[j];
+                // normalization (mass matrix if possible).
+                double ymy= 0.0;
+                for(int j= 0;j<nV;j++)
+                  for(int i= 0;i<nV;i++)
+                    ymy+= y[i]*Mr[i+j*nV]*y[j];
+                const double nrm= (ymy>0.0) ? sqrt(ymy) : sqrt(dot_prod(x,x,n));
+                if(nrm>0.0)
+                  for(int i= 0;i<n;i++)
+                    x[i]/= nrm;
+              }
+            converged= true;
+            break;
+          }
+        // restart with the best Ritz vectors.
+        nb= std::min(k,nV);
+        block.assign(n*nb,0.0);
+        for(int c= 0;c<nb;c++)
+          {
+            const double *y= &Y[order[c]*nV];
+            double *x= &block[c*n];
+            for(int j= 0;j<nV;j++)
+              for(int i= 0;i<n;i++)
+                x[i]+= V[i+j*n]*y[j];
+          }
+      }
+    if(info==0 && !converged)
+      info= -1;
+    return info;
+  }
+
+//! @brief Computes all the eigenpairs of the system.
+int XC::ShiftInvertLanczosSolver::solve(void)
+  { return solve(theSOE->size); }
+
+//! @brief Computes \p nModes eigenpairs.
+//!
+//! With only one shift the solver computes the \p nModes eigenvalues
+//! closest to it. With several shifts, each one computes the
+//! eigenvalues of the interval between the mid-points with its
+//! neighbours (spectrum slicing); the results are merged and the
+//! \p nModes lowest eigenvalues are returned. The number of eigenvalues
+//! computed for each shift is increased until they cover its interval
+//! (the shifts must be sorted in increasing order and the first one
+//! must be close to the lowest eigenvalue, since the interval of the
+//! first shift has no lower limit).
+int XC::ShiftInvertLanczosSolver::solve(int nModes)
+  {
+    if(!theSOE)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; no EigenSOE has been set yet\n";
+        return -1;
+      }
+    numModes= nModes;
+    const int n= theSOE->size;
+    numIter= 0;
+    if(numModes<1)
+      {
+        numModes= 0;
+        return 0;
+      }
+    if(numModes>n)
+      numModes= n;
+
+    // K or M have been assembled again, check if its values
+    // have changed since the last solution.
+    if(!theSOE->factored && matrices_changed())
+      {
+        free_factorizations();
+        factoredK= theSOE->A;
+        factoredM= theSOE->M;
+      }
+    const Vector &shifts= theSOE->getShifts();
+    free_unused_factorizations(shifts);
+
+    const int ns= shifts.Size();
+    std::vector<double> values, vectors;
+    std::vector<std::pair<double,int> > found; // eigenvalue and position in vectors.
+    std::vector<double> allVectors;
+    int retval= 0;
+    if(ns==1)
+      {
+        retval= solve_shift(shifts(0),numModes,values,vectors);
+        for(size_t i= 0;i<values.size();i++)
+          found.push_back(std::make_pair(values[i],int(i)));
+        allVectors.swap(vectors);
+      }
+    else
+      {
+        const int nevSlice= std::min(n,(numModes+ns-1)/ns+2);
+        for(int s= 0;(s<ns) && (retval==0);s++)
+          {
+            const double sigma= shifts(s);
+            const double lower= (s==0) ? -std::numeric_limits<double>::max() : 0.5*(shifts(s-1)+sigma);
+            const double upper= (s==ns-1) ? std::numeric_limits<double>::max() : 0.5*(sigma+shifts(s+1));
+            int nev= nevSlice;
+            bool covered= false;
+            while(!covered)
+              {
+                retval= solve_shift(sigma,nev,values,vectors);
+                if(retval!=0)
+                  break;
+                covered= (nev>=n); // all the eigenvalues computed.
+                if(!covered)
+                  {
+                    // the eigenvalues are the closest ones to the shift,
+                    // so the interval is covered if the farthest one
+                    // lies beyond both mid-points.
+                    double farthest= 0.0;
+                    int inSlice= 0;
+                    for(size_t i= 0;i<values.size();i++)
+                      {
+                        farthest= std::max(farthest,std::fabs(values[i]-sigma));
+                        if(values[i]>=lower)
+                          inSlice++;
+                      }
+                    covered= ((s==0) || (farthest>sigma-lower)) && ((s==ns-1) || (farthest>upper-sigma));
+                    // the last slice must complete the requested modes.
+                    if(covered && (s==ns-1))
+                      covered= (int(found.size())+inSlice>=numModes);
+                  }
+                if(!covered)
+                  nev= std::min(n,2*nev);
+              }
+            for(size_t i= 0;(retval==0) && (i<values.size());i++)
+              if((values[i]>=lower) && (values[i]<upper))
+                {
+                  found.push_back(std::make_pair(values[i],int(allVectors.size()/n)));
+                  allVectors.insert(allVectors.end(),vectors.begin()+i*n,vectors.begin()+(i+1)*n);
+                }
+          }
+        std::stable_sort(found.begin(),found.end());
+      }
+    if(retval!=0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; eigenvalue computation failed.\n";
+        numModes= 0;
+        return retval;
+      }
+    if(int(found.size())<numModes)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; WARNING only " << found.size()
+                  << " eigenvalues computed, " << numModes
+                  << " were requested.\n";
+        numModes= found.size();
+      }
+    eigenvalue.resize(numModes);
+    eigenvector.resize(n*numModes);
+    for(int i= 0;i<numModes;i++)
+      {
+        eigenvalue(i)= found[i].first;
+        const int pos= found[i].second;
+        std::copy(allVectors.begin()+pos*n,allVectors.begin()+(pos+1)*n,eigenvector.begin()+i*n);
+      }
+    theSOE->factored= true;
+    return 0;
+  }
+
+//! @brief Sets the eigenproblem to solve.
+bool XC::ShiftInvertLanczosSolver::setEigenSOE(EigenSOE *soe)
+  {
+    bool retval= false;
+    SparseGenColEigenSOE *tmp= dynamic_cast<SparseGenColEigenSOE *>(soe);
+    if(tmp)
+      {
+        theSOE= tmp;
+        retval= true;
+      }
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; the system of equations is not a"
+                << " SparseGenColEigenSOE." << std::endl;
+    return retval;
+  }
+
+//! @brief Returns the eigenvector that corresponds to the mode
+//! being passed as parameter.
+const XC::Vector &XC::ShiftInvertLanczosSolver::getEigenvector(int mode) const
+  {
+    const int size= theSOE->size;
+    eigenV.resize(size);
+    if(mode < 1 || mode > numModes)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; mode " << mode << " is out of range (1 - "
+                  << numModes << ")\n";
+        eigenV.Zero();
+      }
+    else
+      {
+        const int index= (mode-1)*size;
+        for(int i= 0;i<size;i++)
+          eigenV(i)= eigenvector[index+i];
+      }
+    return eigenV;
+  }
+
+//! @brief Returns the eigenvalue that corresponds to the mode
+//! being passed as parameter.
+const double &XC::ShiftInvertLanczosSolver::getEigenvalue(int mode) const
+  {
+    static double retval= 0.0;
+    if(mode < 1 || mode > numModes)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; mode " << mode << " is out of range (1 - "
+                  << numModes << ")\n";
+        retval= 0.0;
+      }
+    else
+      retval= eigenvalue(mode-1);
+    return retval;
+  }
+
+//! @brief Sets the size of the problem (the sparsity pattern has
+//! changed so the factorizations and the ordering are no longer valid).
+int XC::ShiftInvertLanczosSolver::setSize(void)
+  {
+    free_factorizations();
+    factoredK.resize(0);
+    factoredM.resize(0);
+    perm_c.resize(0);
+    etree.resize(0);
+    const int size= theSOE->size;
+    if(eigenV.Size()!=size)
+      eigenV.resize(size);
+    return 0;
+  }
+
+//! @brief Return the eigenvectors dimension.
+const int &XC::ShiftInvertLanczosSolver::getSize(void) const
+  { return theSOE->size; }
+
+//! @brief Returns the number of vectors of the starting block
+//! (0: same as the number of modes to compute).
+int XC::ShiftInvertLanczosSolver::getBlockSize(void) const
+  { return blockSize; }
+
+//! @brief Sets the number of vectors of the starting block
+//! (0: same as the number of modes to compute).
+void XC::ShiftInvertLanczosSolver::setBlockSize(const int &bs)
+  { blockSize= std::max(0,bs); }
+
+//! @brief Returns the maximum number of restarts for each shift.
+int XC::ShiftInvertLanczosSolver::getMaxNumIter(void) const
+  { return maxNumIter; }
+
+//! @brief Sets the maximum number of restarts for each shift.
+void XC::ShiftInvertLanczosSolver::setMaxNumIter(const int &n)
+  { maxNumIter= std::max(1,n); }
+
+//! @brief Returns the tolerance for the relative residual
+//! of the eigenpairs.
+double XC::ShiftInvertLanczosSolver::getTol(void) const
+  { return tol; }
+
+//! @brief Sets the tolerance for the relative residual
+//! of the eigenpairs.
+void XC::ShiftInvertLanczosSolver::setTol(const double &t)
+  { tol= t; }
+
+//! @brief Returns the number of iterations (for all the shifts)
+//! in the last solution.
+int XC::ShiftInvertLanczosSolver::getNumIter(void) const
+  { return numIter; }
+
+//! @brief Returns the number of factorizations currently stored.
+size_t XC::ShiftInvertLanczosSolver::getNumFactorizations(void) const
+  { return factorizations.size(); }
+
+int XC::ShiftInvertLanczosSolver::sendSelf(CommParameters &cp)
+  { return 0; }
+
+int XC::ShiftInvertLanczosSolver::recvSelf(const CommParameters &cp)
+  { return 0; }
@@ -0,0 +1,130 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ShiftInvertLanczosSolver.h
+
+#ifndef ShiftInvertLanczosSolver_h
+#define ShiftInvertLanczosSolver_h
+
+#include <solution/system_of_eqn/eigenSOE/EigenSolver.h>
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/ID.h"
+#include "superlu/slu_ddefs.h"
+#include "superlu/supermatrix.h"
+#include <vector>
+
+namespace XC {
+class SparseGenColEigenSOE;
+
+//! @ingroup EigenSolver
+//
+//! @brief Block Lanczos eigensolver in shift-invert mode for
+//! SparseGenColEigenSOE systems.
+//!
+//! For each shift \f$\sigma\f$ the matrix \f$K-\sigma M\f$ is
+//! factorized (sparse LU with SuperLU) and the operator
+//! \f$(K-\sigma M)^{-1} M\f$ is used to build a block Krylov
+//! subspace (with full reorthogonalization). The eigenpairs are
+//! obtained from the Rayleigh-Ritz projection of \f$K\f$ and \f$M\f$ on
+//! that subspace; the subspace is restarted with the Ritz vectors until
+//! the residuals of the wanted eigenpairs are small enough.
+//!
+//! The factorizations are kept while the matrices don't change (even if
+//! they are assembled again), so new solutions (i.e. with more modes)
+//! reuse them. All the
+//! factorizations share the same fill reducing ordering, which is
+//! computed only once for each sparsity pattern.
+class ShiftInvertLanczosSolver : public EigenSolver
+  {
+  private:
+    //! @brief LU factorization of the shifted matrix K-shift*M.
+    struct ShiftedFactorization
+      {
+        double shift; //!< shift of the factorized matrix.
+        SuperMatrix L; //!< lower triangular factor.
+        SuperMatrix U; //!< upper triangular factor.
+        ID perm_r; //!< row permutation.
+        ShiftedFactorization(const double &,const int &);
+        ~ShiftedFactorization(void);
+      };
+    typedef std::vector<ShiftedFactorization *> factorization_vector;
+
+    SparseGenColEigenSOE *theSOE;
+    int blockSize; //!< number of vectors of the starting block (0: automatic).
+    int maxNumIter; //!< maximum number of restarts for each shift.
+    double tol; //!< tolerance for the relative residual of the eigenpairs.
+    int numIter; //!< number of restarts in the last solution.
+
+    ID perm_c; //!< column permutation (shared by all the factorizations).
+    ID etree; //!< elimination tree (shared by all the factorizations).
+    superlu_options_t options; //!< SuperLU options.
+    factorization_vector factorizations; //!< factorizations of the shifted matrices.
+    Vector factoredK; //!< values of K when the factorizations were computed.
+    Vector factoredM; //!< values of M when the factorizations were computed.
+
+    Vector eigenvalue; //!< computed eigenvalues.
+    std::vector<double> eigenvector; //!< computed eigenvectors (one after another).
+    mutable Vector eigenV;
+
+    void free_factorizations(void);
+    void free_unused_factorizations(const Vector &);
+    bool matrices_changed(void) const;
+    const ShiftedFactorization *get_factorization(const double &);
+    void prod(const Vector &,const double *,double *,const int &) const;
+    int apply_operator(const ShiftedFactorization &,const double *,double *,const int &) const;
+    int solve_projected(const int &,const std::vector<double> &,const std::vector<double> &,const double &,std::vector<double> &,std::vector<double> &) const;
+    int solve_shift(const double &,const int &,std::vector<double> &,std::vector<double> &);
+
+    friend class EigenSOE;
+    ShiftInvertLanczosSolver(void);
+    ShiftInvertLanczosSolver(const ShiftInvertLanczosSolver &);
+    ShiftInvertLanczosSolver &operator=(const ShiftInvertLanczosSolver &);
+    virtual EigenSolver *getCopy(void) const;
+    bool setEigenSOE(EigenSOE *theSOE);
+  public:
+    ~ShiftInvertLanczosSolver(void);
+
+    virtual int solve(void);
+    virtual int solve(int nModes);
+    virtual int setSize(void);
+    const int &getSize(void) const;
+
+    int getBlockSize(void) const;
+    void setBlockSize(const int &);
+    int getMaxNumIter(void) const;
+    void setMaxNumIter(const int &);
+    double getTol(void) const;
+    void setTol(const double &);
+    int getNumIter(void) const;
+    size_t getNumFactorizations(void) const;
+
+    virtual const Vector &getEigenvector(int mode) const;
+    virtual const double &getEigenvalue(int mode) const;
+
+    int sendSelf(CommParameters &);
+    int recvSelf(const CommParameters &);
+  };
+
+inline EigenSolver *ShiftInvertLanczosSolver::getCopy(void) const
+   { return new ShiftInvertLanczosSolver(*this); }
+} // end of XC namespace
+
+#endif
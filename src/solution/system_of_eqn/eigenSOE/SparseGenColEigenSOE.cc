@@ -0,0 +1,245 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SparseGenColEigenSOE.cc
+
+#include <solution/system_of_eqn/eigenSOE/SparseGenColEigenSOE.h>
+#include <solution/system_of_eqn/eigenSOE/ShiftInvertLanczosSolver.h>
+#include <utility/matrix/Matrix.h>
+#include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/CSRGraph.h"
+#include <algorithm>
+
+//! @brief Constructor.
+XC::SparseGenColEigenSOE::SparseGenColEigenSOE(AnalysisAggregation *owr)
+  :EigenSOE(owr,EigenSOE_TAGS_SparseGenColEigenSOE), nnz(0), shifts(1) {}
+
+//! @brief Sets the solver to use.
+bool XC::SparseGenColEigenSOE::setSolver(EigenSolver *newSolver)
+  {
+    bool retval= false;
+    ShiftInvertLanczosSolver *tmp= dynamic_cast<ShiftInvertLanczosSolver *>(newSolver);
+    if(tmp)
+      retval= EigenSOE::setSolver(tmp);
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; solver type incompatible with this system of equations."
+                << std::endl;
+    return retval;
+  }
+
+//! @brief Sets the size of the system from the model graph.
+int XC::SparseGenColEigenSOE::setSize(Graph &theGraph)
+  {
+    const CSRGraph csrGraph(theGraph);
+    size= checkSize(csrGraph);
+    if(!csrGraph.hasIndexTags())
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; WARNING: vertex tags must range from 0 to "
+                  << size-1 << " - size set to 0.\n";
+        size= 0;
+        return -1;
+      }
+
+    // the adjacency array gives the off-diagonal entries.
+    nnz= csrGraph.getAdjncy().size()+size;
+    A.resize(nnz);
+    A.Zero();
+    M.resize(nnz);
+    M.Zero();
+    rowA.resize(nnz);
+    colStartA.resize(size+1);
+    factored= false;
+
+    // fill in colStartA and rowA (the rows of each column are sorted).
+    if(size != 0)
+      {
+        colStartA(0)= 0;
+        int lastLoc= 0;
+        for(int a=0; a<size; a++)
+          {
+            const int *i= csrGraph.adjacencyBegin(a);
+            const int *end= csrGraph.adjacencyEnd(a);
+            for(;(i!=end) && (*i<a);i++)
+              rowA(lastLoc++)= *i;
+            rowA(lastLoc++)= a;
+            for(;i!=end;i++)
+              rowA(lastLoc++)= *i;
+            colStartA(a+1)= lastLoc;
+          }
+      }
+    resize_mass_matrix_if_needed(size);
+
+    // invoke setSize() on the Solver
+    int result= 0;
+    EigenSolver *theSolvr= getSolver();
+    if(theSolvr)
+      {
+        result= theSolvr->setSize();
+        if(result < 0)
+          std::cerr << getClassName() << "::" << __FUNCTION__
+                    << "; solver failed in setSize()\n";
+      }
+    return result;
+  }
+
+//! @brief Returns the position of the (row,col) entry in the
+//! arrays of non-zero values (-1 if it's not in the pattern).
+int XC::SparseGenColEigenSOE::getPosition(const int &row,const int &col) const
+  {
+    int retval= -1;
+    const int *begin= rowA.getDataPtr()+colStartA(col);
+    const int *end= rowA.getDataPtr()+colStartA(col+1);
+    const int *i= std::lower_bound(begin,end,row);
+    if((i!=end) && (*i==row))
+      retval= i-rowA.getDataPtr();
+    return retval;
+  }
+
+//! @brief Assembles fact*m on the non-zero values being passed as parameter.
+int XC::SparseGenColEigenSOE::addToMatrix(Vector &values,const Matrix &m,const ID &id,const double &fact)
+  {
+    const int idSize= id.Size();
+    if(idSize != m.noRows() && idSize != m.noCols())
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; matrix and ID not of similar sizes.\n";
+        return -1;
+      }
+    for(int i= 0;i<idSize;i++)
+      {
+        const int col= id(i);
+        if(col < size && col >= 0)
+          {
+            for(int j= 0;j<idSize;j++)
+              {
+                const int row= id(j);
+                if(row < size && row >= 0)
+                  {
+                    const int k= getPosition(row,col);
+                    if(k>=0)
+                      values[k]+= fact*m(j,i);
+                  }
+              }
+          }
+      }
+    return 0;
+  }
+
+//! @brief Assembles fact*m on the K matrix.
+int XC::SparseGenColEigenSOE::addA(const Matrix &m, const ID &id, double fact)
+  {
+    int retval= 0;
+    if(fact != 0.0)
+      retval= addToMatrix(A,m,id,fact);
+    return retval;
+  }
+
+//! @brief Assembles fact*m on the M matrix.
+int XC::SparseGenColEigenSOE::addM(const Matrix &m, const ID &id, double fact)
+  {
+    int retval= 0;
+    if(fact != 0.0)
+      {
+        retval= addToMatrix(M,m,id,fact);
+        if(retval==0)
+          {
+            resize_mass_matrix_if_needed(size);
+            const int idSize= id.Size();
+            for(int i= 0;i<idSize;i++)
+              {
+                const int col= id(i);
+                if(col < size && col >= 0)
+                  for(int j= 0;j<idSize;j++)
+                    {
+                      const int row= id(j);
+                      if(row < size && row >= 0 && m(j,i)!=0.0)
+                        massMatrix(row,col)+= fact*m(j,i);
+                    }
+              }
+          }
+      }
+    return retval;
+  }
+
+//! @brief Zeroes the K matrix.
+void XC::SparseGenColEigenSOE::zeroA(void)
+  {
+    A.Zero();
+    factored= false;
+  }
+
+//! @brief Zeroes the M matrix.
+void XC::SparseGenColEigenSOE::zeroM(void)
+  {
+    EigenSOE::zeroM();
+    M.Zero();
+    factored= false;
+  }
+
+//! @brief Makes M the identity matrix.
+void XC::SparseGenColEigenSOE::identityM(void)
+  {
+    EigenSOE::identityM();
+    M.Zero();
+    for(int col= 0;col<size;col++)
+      {
+        const int k= getPosition(col,col);
+        if(k>=0)
+          M(k)= 1.0;
+      }
+    factored= false;
+  }
+
+//! @brief Returns the shifts that define the part of the spectrum to compute.
+const XC::Vector &XC::SparseGenColEigenSOE::getShifts(void) const
+  { return shifts; }
+
+//! @brief Sets the shifts that define the part of the spectrum to compute.
+void XC::SparseGenColEigenSOE::setShifts(const Vector &v)
+  {
+    if(v.Size()<1)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; at least one shift is needed." << std::endl;
+    else
+      {
+        shifts= v;
+        std::sort(shifts.getDataPtr(),shifts.getDataPtr()+shifts.Size());
+      }
+  }
+
+//! @brief Returns the first shift.
+double XC::SparseGenColEigenSOE::getShift(void) const
+  { return shifts(0); }
+
+//! @brief Sets a single shift.
+void XC::SparseGenColEigenSOE::setShift(const double &s)
+  {
+    shifts.resize(1);
+    shifts(0)= s;
+  }
+
+int XC::SparseGenColEigenSOE::sendSelf(CommParameters &cp)
+  { return 0; }
+    
+int XC::SparseGenColEigenSOE::recvSelf(const CommParameters &cp)
+  { return 0; }
@@ -0,0 +1,89 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SparseGenColEigenSOE.h
+
+#ifndef SparseGenColEigenSOE_h
+#define SparseGenColEigenSOE_h
+
+#include <solution/system_of_eqn/eigenSOE/EigenSOE.h>
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/ID.h"
+
+namespace XC {
+class ShiftInvertLanczosSolver;
+
+//! @ingroup EigenSOE
+//
+//! @brief Sparse (column compacted storage) generalized eigenvalue
+//! problem \f$K x= \lambda M x\f$.
+//!
+//! Both the \f$K\f$ (A) and the \f$M\f$ matrices share the same
+//! sparsity pattern (the one of the model graph) so the shifted matrix
+//! \f$K-\sigma M\f$ can be formed without building a new pattern.
+//! The shifts \f$\sigma\f$ define the part of the spectrum to compute:
+//! with one shift the solver computes the eigenvalues closest to it
+//! and, with several shifts, each one is used to compute the eigenvalues
+//! of its own slice of the spectrum.
+class SparseGenColEigenSOE : public EigenSOE
+  {
+  private:
+    int nnz; //!< number of non-zeros in A and M.
+    Vector A; //!< non-zero values of the K matrix.
+    Vector M; //!< non-zero values of the M matrix.
+    ID rowA; //!< row index of each non-zero value.
+    ID colStartA; //!< position of the first non-zero value of each column.
+    Vector shifts; //!< shifts that define the part of the spectrum to compute.
+
+    int getPosition(const int &,const int &) const;
+    int addToMatrix(Vector &,const Matrix &,const ID &,const double &);
+  protected:
+    bool setSolver(EigenSolver *);
+
+    friend class AnalysisAggregation;
+    friend class FEM_ObjectBroker;
+    SparseGenColEigenSOE(AnalysisAggregation *);
+    SystemOfEqn *getCopy(void) const;
+  public:
+    virtual int setSize(Graph &theGraph);
+    
+    virtual int addA(const Matrix &, const ID &, double fact = 1.0);
+    virtual int addM(const Matrix &, const ID &, double fact = 1.0);    
+   
+    virtual void zeroA(void);
+    virtual void zeroM(void);
+    virtual void identityM(void);
+
+    const Vector &getShifts(void) const;
+    void setShifts(const Vector &);
+    double getShift(void) const;
+    void setShift(const double &);
+
+    int sendSelf(CommParameters &);
+    int recvSelf(const CommParameters &);    
+
+    friend class ShiftInvertLanczosSolver;
+  };
+inline SystemOfEqn *SparseGenColEigenSOE::getCopy(void) const
+  { return new SparseGenColEigenSOE(*this); }
+} // end of XC namespace
+
+#endif
@@ -22,7 +22,7 @@
 //python_interface.tcc
 
 class_<XC::EigenSOE, bases<XC::SystemOfEqn>, boost::noncopyable >("EigenSOE", "Base class for eigenproblem systems of equations.", no_init)
-.def("newSolver", &XC::EigenSOE::newSolver,return_internal_reference<>()," \n""newSolver(tipo)""Define the solver to be used.""Parameters: \n""tipo: type of solver. Available types: 'band_arpack_solver', 'band_arpackpp_solver', 'sym_band_eigen_solver', 'full_gen_eigen_solver', 'sym_arpack_solver'")
+.def("newSolver", &XC::EigenSOE::newSolver,return_internal_reference<>()," \n""newSolver(tipo)""Define the solver to be used.""Parameters: \n""tipo: type of solver. Available types: 'band_arpack_solver', 'band_arpackpp_solver', 'sym_band_eigen_solver', 'full_gen_eigen_solver', 'sym_arpack_solver', 'shift_invert_lanczos_solver'")
   ;
 
 class_<XC::ArpackSOE, bases<XC::EigenSOE>, boost::noncopyable >("ArpackSOE", no_init)
@@ -44,6 +44,11 @@ class_<XC::FullGenEigenSOE, bases<XC::EigenSOE>, boost::noncopyable >("FullGenEi
 class_<XC::SymBandEigenSOE, bases<XC::EigenSOE>, boost::noncopyable >("SymBandEigenSOE", no_init)
   ;
 
+class_<XC::SparseGenColEigenSOE, bases<XC::EigenSOE>, boost::noncopyable >("SparseGenColEigenSOE", no_init)
+  .add_property("shift", &XC::SparseGenColEigenSOE::getShift, &XC::SparseGenColEigenSOE::setShift,"Shift (only one) of the eigenvalues to compute.")
+  .add_property("shifts", make_function(&XC::SparseGenColEigenSOE::getShifts, return_value_policy<copy_const_reference>() ),&XC::SparseGenColEigenSOE::setShifts,"Shifts that define the slices of the spectrum to compute.")
+  ;
+
 class_<XC::EigenSolver, bases<XC::Solver>, boost::noncopyable >("EigenSolver", no_init);
 
 class_<XC::BandArpackppSolver, bases<XC::EigenSolver>, boost::noncopyable >("BandArpackppSolver", no_init)
@@ -60,3 +65,11 @@ class_<XC::FullGenEigenSolver, bases<XC::EigenSolver>, boost::noncopyable >("Ful
 
 class_<XC::SymBandEigenSolver, bases<XC::EigenSolver>, boost::noncopyable >("SymBandEigenSolver", no_init)
   ;
+
+class_<XC::ShiftInvertLanczosSolver, bases<XC::EigenSolver>, boost::noncopyable >("ShiftInvertLanczosSolver", no_init)
+  .add_property("blockSize", &XC::ShiftInvertLanczosSolver::getBlockSize, &XC::ShiftInvertLanczosSolver::setBlockSize,"Number of vectors of the starting block (0: number of modes to compute).")
+  .add_property("maxNumIter", &XC::ShiftInvertLanczosSolver::getMaxNumIter, &XC::ShiftInvertLanczosSolver::setMaxNumIter,"Maximum number of restarts for each shift.")
+  .add_property("tol", &XC::ShiftInvertLanczosSolver::getTol, &XC::ShiftInvertLanczosSolver::setTol,"Tolerance for the relative residual of the eigenpairs.")
+  .add_property("numIter", &XC::ShiftInvertLanczosSolver::getNumIter,"Number of iterations in the last solution.")
+  .add_property("numFactorizations", &XC::ShiftInvertLanczosSolver::getNumFactorizations,"Number of factorizations of the shifted matrix currently stored.")
+  ;
@@ -95,17 +95,89 @@
 #include <solution/system_of_eqn/linearSOE/sparseGEN/SuperLU.h>
 
 #include <solution/system_of_eqn/linearSOE/sparseSYM/SymSparseLinSolver.h>
+#include <solution/system_of_eqn/linearSOE/supernodalSPD/SupernodalSPDLinSolver.h>
+#include <solution/system_of_eqn/linearSOE/krylov/KrylovSparseSolver.h>
 
 #include "utility/matrix/Vector.h"
+#include "utility/matrix/Matrix.h"
+#include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/CSRGraph.h"
+#include "utility/Profiler.h"
 
 //#include <solution/system_of_eqn/linearSOE/umfGEN/UmfpackGenLinSolver.h>
 
+size_t XC::LinearSOE::graphStampCounter= 0;
+
 //! @brief Constructor.
 //!
 //! @param owr: analysis aggregation that owns this object.
 //! @param classTag: identifier of the class.
 XC::LinearSOE::LinearSOE(AnalysisAggregation *owr,int classTag)
-  :SystemOfEqn(owr,classTag), theSolver(nullptr) {}
+  :SystemOfEqn(owr,classTag), theSolver(nullptr), graphStamp(0), scatterMaps(true) {}
+
+//! @brief Copy constructor.
+//!
+//! The graph stamp is not copied, the storage of the copy is not
+//! the same so the scatter maps computed for the original object
+//! can't be used with it.
+XC::LinearSOE::LinearSOE(const LinearSOE &other)
+  :SystemOfEqn(other), theSolver(other.theSolver), graphStamp(0), scatterMaps(other.scatterMaps) {}
+
+//! @brief Assignment operator (see copy constructor).
+XC::LinearSOE &XC::LinearSOE::operator=(const LinearSOE &other)
+  {
+    SystemOfEqn::operator=(other);
+    theSolver= other.theSolver;
+    graphStamp= 0;
+    scatterMaps= other.scatterMaps;
+    return *this;
+  }
+
+//! @brief Assigns a new graph stamp to the system. Must be called each
+//! time the storage of the matrix $A$ is rebuilt so the scatter maps
+//! that point to the old storage are computed again.
+void XC::LinearSOE::newGraphStamp(void)
+  {
+    graphStampCounter++;
+    graphStamp= graphStampCounter;
+  }
+
+//! @brief Computes the addresses in the storage of $A$ of the
+//! coefficients of a matrix assembled at the locations \p loc
+//! (nullptr for the coefficients that are not assembled), the
+//! addresses are stored in column-major order. Returns false
+//! if the system doesn't support scatter maps (default).
+//!
+//! @param loc: equation numbers of the element degrees of freedom.
+//! @param destinations: addresses of the coefficients in $A$.
+bool XC::LinearSOE::fillScatterMap(const ID &loc, std::vector<double *> &destinations)
+  { return false; }
+
+//! @brief Enables or disables the assembly of the element matrices
+//! through scatter maps. The graph stamp changes so the maps already
+//! computed are updated on the next assembly.
+void XC::LinearSOE::setUseScatterMaps(const bool &b)
+  {
+    if(b!=scatterMaps)
+      {
+        scatterMaps= b;
+        if(graphStamp>0)
+          newGraphStamp();
+      }
+  }
+
+//! @brief Determines and sets the size of the system from the graph
+//! in compressed sparse row format.
+//!
+//! This default implementation copies the graph into a Graph object
+//! and calls setSize(Graph &). The systems that can work with
+//! the compressed graph directly must redefine it.
+int XC::LinearSOE::setSize(const CSRGraph &theGraph)
+  {
+    Graph tmp(theGraph.getNumVertex());
+    theGraph.getGraph(tmp);
+    return this->setSize(tmp);
+  }
 
 //! @brief Frees memory.
 void XC::LinearSOE::free_memory(void)
@@ -148,6 +220,7 @@ bool XC::LinearSOE::setSolver(LinearSOESolver *newSolver)
         free_memory();
         theSolver= newSolver;
         theSolver->setLinearSOE(this);
+        newGraphStamp(); // the solver may rebuild the storage.
         const int solverOK= theSolver->setSize();
         if(solverOK < 0)
           {
@@ -194,6 +267,10 @@ XC::LinearSOESolver &XC::LinearSOE::newSolver(const std::string &tipo)
       setSolver(new SuperLU());
     else if(tipo=="sym_sparse_lin_solver")
       setSolver(new SymSparseLinSolver());
+    else if(tipo=="supernodal_spd_lin_solver")
+      setSolver(new SupernodalSPDLinSolver());
+    else if(tipo=="krylov_sparse_solver")
+      setSolver(new KrylovSparseSolver());
 //     else if(tipo=="umfpack_gen_lin_solver")
 //       setSolver(new UmfpackGenLinSolver());
     else
@@ -215,7 +292,64 @@ XC::LinearSOE::~LinearSOE(void)
 //! LinearSOESolver. To solve a linear system of equations means to find
 //! $x$ such that the equation $Ax=b$ is satisfied. 
 int XC::LinearSOE::solve(void)
-  { return (getSolver()->solve()); }
+  {
+    ProfilerScope scope("LinearSOE::solve");
+    return (getSolver()->solve());
+  }
+
+//! @brief Computes the solution of the system of equations for
+//! several right hand sides.
+//!
+//! On entry each column of \p XB contains a right hand side, on exit
+//! it contains the corresponding solution. If the solver can't solve
+//! the system for several right hand sides at once (see
+//! LinearSOESolver::canSolveMultipleRHS) the columns are solved one
+//! by one (the factored solvers don't factor the matrix again).
+//! Vector $b$ remains unchanged.
+int XC::LinearSOE::solve(Matrix &XB)
+  {
+    ProfilerScope scope("LinearSOE::solve");
+    int retval= 0;
+    LinearSOESolver *solver= getSolver();
+    const int n= getNumEqn();
+    if(!solver)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; null pointer to solver." << std::endl;
+        retval= -1;
+      }
+    else if(XB.noRows()!=n)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; the number of rows of the matrix: " << XB.noRows()
+                  << " doesn't match the number of equations: "
+                  << n << std::endl;
+        retval= -2;
+      }
+    else if(solver->canSolveMultipleRHS())
+      retval= solver->solve(XB);
+    else
+      {
+        const Vector bOld(getB());
+        const int nc= XB.noCols();
+        Vector b(n);
+        for(int j= 0;(j<nc) && (retval>=0);j++)
+          {
+            for(int i= 0;i<n;i++)
+              b(i)= XB(i,j);
+            setB(b);
+            retval= solver->solve();
+            if(retval>=0)
+              {
+                const Vector &x= getX();
+                for(int i= 0;i<n;i++)
+                  XB(i,j)= x(i);
+              }
+          }
+        setB(bOld);
+      }
+    return retval;
+  }
 
 //! @brief Returns the determinant of the system matrix.
 double XC::LinearSOE::getDeterminant(void)
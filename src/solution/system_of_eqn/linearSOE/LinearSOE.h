@@ -62,6 +62,7 @@
 // What: "@(#) LinearSOE.h, revA"
 
 #include <solution/system_of_eqn/SystemOfEqn.h>
+#include <vector>
 
 namespace XC {
 class LinearSOESolver;
@@ -92,18 +93,25 @@ class LinearSOE : public SystemOfEqn
   {
   private:
     LinearSOESolver *theSolver;
+    size_t graphStamp; //!< identifies the current sparsity pattern (0: not defined yet).
+    static size_t graphStampCounter; //!< last graph stamp assigned.
+    bool scatterMaps; //!< if true, the element matrices are assembled through scatter maps (when supported).
     void free_memory(void);
     void copy(const LinearSOESolver *);
   protected:
     friend class FEM_ObjectBroker;
     virtual bool setSolver(LinearSOESolver *);
     int setSolverSize(void);
+    void newGraphStamp(void);
 
     LinearSOE(AnalysisAggregation *,int classTag);
+    LinearSOE(const LinearSOE &);
+    LinearSOE &operator=(const LinearSOE &);
   public:
     virtual ~LinearSOE(void);
 
     virtual int solve(void);    
+    virtual int solve(Matrix &);
 
     //! @brief Determines and sets the size of the system.
     //!
@@ -113,6 +121,7 @@ class LinearSOE : public SystemOfEqn
     //! the connectivity between the vertices in the Graph object \p theGraph.
     //! To return $0$ if sucessfull, a negative number if not.
     virtual int setSize(Graph &theGraph) =0;
+    virtual int setSize(const CSRGraph &theGraph);
     //! @brief Returns the number of equations in the system.
     virtual int getNumEqn(void) const =0;
     
@@ -126,6 +135,18 @@ class LinearSOE : public SystemOfEqn
     //! negative number if not.
     virtual int addA(const Matrix &M, const ID &loc, double fact = 1.0) =0;
 
+    //! @brief Return the stamp that identifies the current sparsity
+    //! pattern (and storage) of the matrix $A$. It changes each
+    //! time the storage is rebuilt (see ScatterMap).
+    inline const size_t &getGraphStamp(void) const
+      { return graphStamp; }
+    virtual bool fillScatterMap(const ID &loc, std::vector<double *> &);
+    //! @brief Return true if the element matrices are assembled through
+    //! scatter maps (when the system supports them).
+    inline bool getUseScatterMaps(void) const
+      { return scatterMaps; }
+    void setUseScatterMaps(const bool &);
+
     //! The LinearSOE object assembles \p fact times the Vector \p V into
     //! the vector $b$. The Vector is assembled into $b$ at the locations
     //! given by the ID object {\em loc}, i.e. $b_{loc(i)} += V(i)$. If a
@@ -71,6 +71,18 @@
 XC::LinearSOESolver::LinearSOESolver(int classTag)
  : Solver(classTag) {}
 
+//! @brief Solves the system for each of the columns of the matrix
+//! being passed as parameter (right hand sides) storing the solution
+//! in the same matrix. The default implementation does nothing
+//! and returns -1 (see canSolveMultipleRHS).
+int XC::LinearSOESolver::solve(Matrix &XB)
+  {
+    std::cerr << getClassName() << "::" << __FUNCTION__
+              << "; multiple right hand sides not implemented."
+              << std::endl;
+    return -1;
+  }
+
 
 
 
@@ -71,6 +71,7 @@
 
 namespace XC {
 class LinearSOE;
+class Matrix;
 
 //!  \ingroup Solver
 //! 
@@ -105,6 +106,24 @@ class LinearSOESolver : public Solver
     virtual int setSize(void) = 0;
     //! @brief Returns the determinant of the system matrix.
     virtual double getDeterminant(void) {return 1.0;};
+    //! @brief Returns true if the solver can solve several right
+    //! hand sides in one sweep (see solve(Matrix &)).
+    virtual bool canSolveMultipleRHS(void) const
+      { return false; }
+    virtual int solve(Matrix &);
+    using Solver::solve;
+    //! @brief Returns true if the solver is iterative (the accuracy
+    //! of the solution can be controlled with setForcingTerm).
+    virtual bool isIterative(void) const
+      { return false; }
+    //! @brief Sets the relative tolerance for the next solution
+    //! only (inexact Newton methods). Ignored by the direct solvers.
+    virtual void setForcingTerm(const double &)
+      {}
+    //! @brief Returns the number of iterations of the last solution
+    //! (zero for the direct solvers).
+    virtual int getNumIterations(void) const
+      { return 0; }
   };
 } // end of XC namespace
 
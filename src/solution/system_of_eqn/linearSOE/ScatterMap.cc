@@ -0,0 +1,95 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ScatterMap.cc
+
+#include "ScatterMap.h"
+#include "solution/system_of_eqn/linearSOE/LinearSOE.h"
+#include "utility/matrix/Matrix.h"
+#include "utility/matrix/ID.h"
+
+//! @brief Constructor.
+XC::ScatterMap::ScatterMap(void)
+  : graphStamp(0), supported(false) {}
+
+//! @brief Computes the map again if the sparsity pattern of the system
+//! has changed since the last call. Returns true if the map can be used.
+//!
+//! @param theSOE: system of equations.
+//! @param loc: equation numbers of the element degrees of freedom.
+bool XC::ScatterMap::update(LinearSOE &theSOE,const ID &loc)
+  {
+    const size_t &stamp= theSOE.getGraphStamp();
+    const size_t sz= loc.Size()*loc.Size();
+    if((stamp!=graphStamp) || (destinations.size()!=sz))
+      {
+        graphStamp= stamp;
+        supported= false;
+        if((stamp>0) && theSOE.getUseScatterMaps()) // graph already defined.
+          supported= theSOE.fillScatterMap(loc,destinations);
+        if(!supported)
+          destinations.clear();
+      }
+    return supported;
+  }
+
+//! @brief Assembles fact times the matrix into the system matrix.
+//!
+//! If the system of equations doesn't support scatter maps the matrix
+//! is assembled by calling LinearSOE::addA.
+//! @param theSOE: system of equations.
+//! @param m: element matrix.
+//! @param loc: equation numbers of the element degrees of freedom.
+//! @param fact: factor that multiplies the matrix.
+int XC::ScatterMap::addA(LinearSOE &theSOE,const Matrix &m,const ID &loc,const double &fact)
+  {
+    int retval= 0;
+    if(fact == 0.0) // quick return
+      return retval;
+    if(update(theSOE,loc) && (size_t(m.getDataSize())==destinations.size()))
+      {
+        const double *mData= m.getDataPtr();
+        const size_t sz= destinations.size();
+        if(fact == 1.0) // do not need to multiply
+          {
+            for(size_t k= 0;k<sz;k++)
+              if(destinations[k])
+                *destinations[k]+= mData[k];
+          }
+        else
+          {
+            for(size_t k= 0;k<sz;k++)
+              if(destinations[k])
+                *destinations[k]+= fact*mData[k];
+          }
+      }
+    else
+      retval= theSOE.addA(m,loc,fact);
+    return retval;
+  }
+
+//! @brief Forgets the computed positions.
+void XC::ScatterMap::clear(void)
+  {
+    graphStamp= 0;
+    supported= false;
+    destinations.clear();
+  }
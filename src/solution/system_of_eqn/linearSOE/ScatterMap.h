@@ -0,0 +1,61 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ScatterMap.h
+
+#ifndef ScatterMap_h
+#define ScatterMap_h
+
+#include <vector>
+#include <cstddef>
+
+namespace XC {
+class LinearSOE;
+class Matrix;
+class ID;
+
+//! @ingroup LinearSOE
+//
+//! @brief Positions of the coefficients of an element matrix in the
+//! storage of the system matrix.
+//!
+//! Sparse systems of equations must search the position of each
+//! coefficient of the element matrix in its compressed storage. This
+//! object keeps those positions so the assembly becomes a straight
+//! gather-add. The positions are computed again when the sparsity
+//! pattern of the system changes (see LinearSOE::getGraphStamp).
+class ScatterMap
+  {
+  private:
+    size_t graphStamp; //!< graph stamp of the system when the map was computed.
+    bool supported; //!< false if the system of equations can't compute the map.
+    std::vector<double *> destinations; //!< address in A for each coefficient of the element matrix (column-major), nullptr if it is not assembled.
+
+    bool update(LinearSOE &,const ID &);
+  public:
+    ScatterMap(void);
+
+    int addA(LinearSOE &,const Matrix &,const ID &,const double &fact= 1.0);
+    void clear(void);
+  };
+} // end of XC namespace
+
+#endif
@@ -63,6 +63,7 @@
 
 #include <solution/system_of_eqn/linearSOE/bandGEN/BandGenLinLapackSolver.h>
 #include <solution/system_of_eqn/linearSOE/bandGEN/BandGenLinSOE.h>
+#include "utility/Profiler.h"
 
 
 //! A unique class tag defined in classTags.h is passed to the
@@ -127,7 +128,10 @@ int XC::BandGenLinLapackSolver::solve(void)
 
     {
       if(theSOE->factored == false) // factor and solve 	
-        dgbsv_(&n,&kl,&ku,&nrhs,Aptr,&ldA,iPIV,Xptr,&ldB,&info);
+        {
+          ProfilerScope scope("LinearSOESolver::factor");
+          dgbsv_(&n,&kl,&ku,&nrhs,Aptr,&ldA,iPIV,Xptr,&ldB,&info);
+        }
       else // solve only using factored matrix
         {
           char ene[]= "N";
@@ -59,6 +59,7 @@
 #include <utility/matrix/Matrix.h>
 #include <utility/matrix/Vector.h>
 #include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/CSRGraph.h"
 #include <solution/graph/graph/Vertex.h>
 #include <solution/graph/graph/VertexIter.h>
 
@@ -146,7 +147,7 @@ bool XC::BandGenLinSOE::setSolver(LinearSOESolver *newSolver)
 //! are zeroed and \f$A\f$ is marked as being unfactored. If the system size
 //! has increased, new Vector objects for \f$x\f$ and \f$b\f$ using the {\em (do//! uble*,int)} Vector constructor are created. Finally, the result of
 //! invoking setSize() on the associated Solver object is returned.
-int XC::BandGenLinSOE::setSize(Graph &theGraph)
+int XC::BandGenLinSOE::setSize(const CSRGraph &theGraph)
   {
     int result = 0;
     size= checkSize(theGraph);
@@ -184,6 +185,11 @@ int XC::BandGenLinSOE::setSize(Graph &theGraph)
     return result;
   }
 
+//! @brief Determines the size of the system from the graph
+//! (see setSize(const CSRGraph &)).
+int XC::BandGenLinSOE::setSize(Graph &theGraph)
+  { return BandGenLinSOE::setSize(CSRGraph(theGraph)); }
+
 //! @brief Assembles fact times the matrix m into the matrix A.
 //! 
 //! First tests that \p loc and \p M are of compatible sizes; if not
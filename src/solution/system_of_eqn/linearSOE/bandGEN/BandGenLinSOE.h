@@ -122,6 +122,7 @@ class BandGenLinSOE : public FactoredSOEBase
     SystemOfEqn *getCopy(void) const;
   public:
     virtual int setSize(Graph &theGraph);
+    virtual int setSize(const CSRGraph &theGraph);
     
     virtual int addA(const Matrix &, const ID &, double fact = 1.0);
 
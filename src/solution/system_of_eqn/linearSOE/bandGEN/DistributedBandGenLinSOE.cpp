@@ -58,6 +58,7 @@
 #include <utility/matrix/Matrix.h>
 #include <utility/matrix/Vector.h>
 #include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/CSRGraph.h"
 #include <solution/graph/graph/Vertex.h>
 #include <solution/graph/graph/VertexIter.h>
 #include <utility/actor/channel/Channel.h>
@@ -75,6 +76,11 @@ void XC::DistributedBandGenLinSOE::calcBand(Graph &theGraph)
     theGraph.getBand(numSubD,numSuperD);
   }
 
+//! @brief The distributed systems need the Graph object to exchange
+//! the graphs between processes (see setSize(Graph &)).
+int XC::DistributedBandGenLinSOE::setSize(const CSRGraph &theGraph)
+  { return LinearSOE::setSize(theGraph); }
+
 int XC::DistributedBandGenLinSOE::setSize(Graph &theGraph)
   {
     int result = 0;
@@ -61,6 +61,8 @@
 
 #include <solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinLapackSolver.h>
 #include <solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinSOE.h>
+#include "utility/matrix/Matrix.h"
+#include "utility/Profiler.h"
 
 //! @brief Constructor.
 XC::BandSPDLinLapackSolver::BandSPDLinLapackSolver(void)
@@ -115,7 +117,10 @@ int XC::BandSPDLinLapackSolver::solve(void)
     char strU[]= "U";
     // now solve AX = Y
     { if (theSOE->factored == false)          
-	dpbsv_(strU,&n,&kd,&nrhs,Aptr,&ldA,Xptr,&ldB,&info);
+	{
+	  ProfilerScope scope("LinearSOESolver::factor");
+	  dpbsv_(strU,&n,&kd,&nrhs,Aptr,&ldA,Xptr,&ldB,&info);
+	}
       else
 	dpbtrs_(strU,&n,&kd,&nrhs,Aptr,&ldA,Xptr,&ldB,&info);
     }
@@ -134,6 +139,54 @@ int XC::BandSPDLinLapackSolver::solve(void)
   }
     
 
+//! @brief Compute the solution for several right hand sides.
+//! 
+//! Each column of \p XB contains a right hand side on entry and the
+//! corresponding solution on exit. The matrix is factored (if not
+//! already factored) and all the columns are solved in one call
+//! to the LAPACK routines (dpbsv() or dpbtrs()).
+int XC::BandSPDLinLapackSolver::solve(Matrix &XB)
+  {
+    if(!theSOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+	          << "; no LinearSOE object has been set\n";
+	return -1;
+      }
+
+    int n = theSOE->size;
+    int kd = theSOE->half_band -1;
+    int ldA = kd +1;
+    int nrhs = XB.noCols();
+    int ldB = n;
+    int info= 0;
+    double *Aptr = theSOE->A.getDataPtr();
+    double *Xptr = XB.getDataPtr();
+
+    if((n==0) || (nrhs==0))
+      return 0;
+
+    char strU[]= "U";
+    if(theSOE->factored == false)          
+      {
+        ProfilerScope scope("LinearSOESolver::factor");
+        dpbsv_(strU,&n,&kd,&nrhs,Aptr,&ldA,Xptr,&ldB,&info);
+      }
+    else
+      dpbtrs_(strU,&n,&kd,&nrhs,Aptr,&ldA,Xptr,&ldB,&info);
+
+    // check if successfull
+    if(info != 0)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING - the LAPACK"
+		  << " routines returned " << info << std::endl;
+	return -info;
+      }
+    theSOE->factored = true;
+    return 0;
+  }
+
 //! @brief Does nothing but return \f$0\f$.
 int XC::BandSPDLinLapackSolver::setSize()
   {
@@ -85,6 +85,10 @@ class BandSPDLinLapackSolver : public BandSPDLinSolver
   public:
 
     int solve(void);
+    //! @brief The solver can solve several right hand sides at once.
+    bool canSolveMultipleRHS(void) const
+      { return true; }
+    int solve(Matrix &);
     int setSize(void);
     
     int sendSelf(CommParameters &);
@@ -63,6 +63,7 @@
 #include <utility/matrix/Matrix.h>
 #include <utility/matrix/Vector.h>
 #include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/CSRGraph.h"
 #include <solution/graph/graph/Vertex.h>
 #include <solution/graph/graph/VertexIter.h>
 
@@ -161,7 +162,7 @@ bool XC::BandSPDLinSOE::setSolver(LinearSOESolver *newSolver)
 //! *,int)} Vector constructor are created. Finally, the result of
 //! invoking setSize() on the associated Solver object is
 //! returned. 
-int XC::BandSPDLinSOE::setSize(Graph &theGraph)
+int XC::BandSPDLinSOE::setSize(const CSRGraph &theGraph)
   {
     int result = 0;
     size= checkSize(theGraph);
@@ -193,6 +194,11 @@ int XC::BandSPDLinSOE::setSize(Graph &theGraph)
     return result;
   }
 
+//! @brief Determines the size of the system from the graph
+//! (see setSize(const CSRGraph &)).
+int XC::BandSPDLinSOE::setSize(Graph &theGraph)
+  { return BandSPDLinSOE::setSize(CSRGraph(theGraph)); }
+
 //! First tests that \p loc and \p M are of compatible sizes; if not
 //! a warning message is printed and a \f$-1\f$ is returned. The LinearSOE
 //! object then assembles \p fact times the Matrix {\em 
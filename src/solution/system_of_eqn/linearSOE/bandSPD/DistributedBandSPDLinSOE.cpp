@@ -59,6 +59,7 @@
 #include <utility/matrix/Matrix.h>
 #include <utility/matrix/Vector.h>
 #include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/CSRGraph.h"
 #include <solution/graph/graph/Vertex.h>
 #include <solution/graph/graph/VertexIter.h>
 #include <utility/actor/channel/Channel.h>
@@ -79,6 +80,11 @@ void XC::DistributedBandSPDLinSOE::calcBand(Graph &theGraph)
     half_band += 1; // include the diagonal
   }
 
+//! @brief The distributed systems need the Graph object to exchange
+//! the graphs between processes (see setSize(Graph &)).
+int XC::DistributedBandSPDLinSOE::setSize(const CSRGraph &theGraph)
+  { return LinearSOE::setSize(theGraph); }
+
 int XC::DistributedBandSPDLinSOE::setSize(Graph &theGraph)
   {
     int result = 0;
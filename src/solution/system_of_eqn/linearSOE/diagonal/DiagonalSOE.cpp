@@ -60,6 +60,7 @@
 #include <utility/matrix/Matrix.h>
 #include <utility/matrix/Vector.h>
 #include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/CSRGraph.h"
 #include <solution/graph/graph/Vertex.h>
 #include <solution/graph/graph/VertexIter.h>
 
@@ -88,7 +89,7 @@ bool XC::DiagonalSOE::setSolver(LinearSOESolver *newSolver)
     return retval;
   }
     
-int XC::DiagonalSOE::setSize(Graph &theGraph)
+int XC::DiagonalSOE::setSize(const CSRGraph &theGraph)
   {
     const int oldSize = size;
     int result = 0;
@@ -119,6 +120,11 @@ int XC::DiagonalSOE::setSize(Graph &theGraph)
     return result;
   }
 
+//! @brief Determines the size of the system from the graph
+//! (see setSize(const CSRGraph &)).
+int XC::DiagonalSOE::setSize(Graph &theGraph)
+  { return DiagonalSOE::setSize(CSRGraph(theGraph)); }
+
 int XC::DiagonalSOE::addA(const Matrix &m, const ID &id, double fact)
   {
     // check for a quick return 
@@ -63,6 +63,7 @@
 
 #include <solution/system_of_eqn/linearSOE/fullGEN/FullGenLinLapackSolver.h>
 #include <solution/system_of_eqn/linearSOE/fullGEN/FullGenLinSOE.h>
+#include "utility/Profiler.h"
 
 //! @brief Constructor.
 //!
@@ -130,7 +131,10 @@ int XC::FullGenLinLapackSolver::solve(void)
 
     char strN[]= "N";
     {if (theSOE->factored == false)      
-	dgesv_(&n,&nrhs,Aptr,&ldA,iPIV,Xptr,&ldB,&info);
+	{
+	  ProfilerScope scope("LinearSOESolver::factor");
+	  dgesv_(&n,&nrhs,Aptr,&ldA,iPIV,Xptr,&ldB,&info);
+	}
      else
 	dgetrs_(strN, &n,&nrhs,Aptr,&ldA,iPIV,Xptr,&ldB,&info);
     }
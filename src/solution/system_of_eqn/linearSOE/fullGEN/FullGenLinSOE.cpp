@@ -62,6 +62,7 @@
 #include <solution/system_of_eqn/linearSOE/fullGEN/FullGenLinSolver.h>
 #include <utility/matrix/Matrix.h>
 #include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/CSRGraph.h"
 #include <solution/graph/graph/Vertex.h>
 #include <solution/graph/graph/VertexIter.h>
 
@@ -119,7 +120,7 @@ bool XC::FullGenLinSOE::setSolver(LinearSOESolver *newSolver)
 //! increased, new Vector objects for \f$x\f$ and \f$b\f$ using the {\em (double
 //! *,int)} Vector constructor are created. Finally, the result of
 //! invoking setSize() on the associated Solver object is returned.
-int XC::FullGenLinSOE::setSize(Graph &theGraph)
+int XC::FullGenLinSOE::setSize(const CSRGraph &theGraph)
   {
     int result = 0;
     size= checkSize(theGraph);
@@ -145,6 +146,11 @@ int XC::FullGenLinSOE::setSize(Graph &theGraph)
     return result;
   }
 
+//! @brief Determines the size of the system from the graph
+//! (see setSize(const CSRGraph &)).
+int XC::FullGenLinSOE::setSize(Graph &theGraph)
+  { return FullGenLinSOE::setSize(CSRGraph(theGraph)); }
+
 //! @brief Assembles the product of the matrix and the factor on the
 //! system matrix.
 //!
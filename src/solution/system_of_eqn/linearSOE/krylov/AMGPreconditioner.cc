@@ -0,0 +1,407 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//AMGPreconditioner.cc
+
+#include "AMGPreconditioner.h"
+#include <cmath>
+#include <iostream>
+#include <algorithm>
+
+extern "C" int dgetrf_(int *M, int *N, double *A, int *LDA, int *iPiv, int *INFO);
+
+extern "C" int dgetrs_(char *TRANS, int *N, int *NRHS, double *A, int *LDA, 
+		       int *iPiv, double *B, int *LDB, int *INFO);
+
+//! @brief Maximum size of the coarsest system solved with a dense
+//! factorization (if the hierarchy stops before, the coarsest
+//! system is smoothed).
+static const int maxDenseSize= 4000;
+
+//! @brief Constructor.
+XC::AMGPreconditioner::AMGPreconditioner(void)
+  : KrylovPreconditioner(), strengthThreshold(0.08), blockSize(1),
+    maxCoarseSize(300), maxNumLevels(10), numSweeps(1) {}
+
+//! @brief Virtual constructor.
+XC::KrylovPreconditioner *XC::AMGPreconditioner::getCopy(void) const
+  { return new AMGPreconditioner(*this); }
+
+//! @brief Return the inverse of the diagonal of the matrix (zero
+//! diagonal terms are replaced by one).
+static std::vector<double> get_inverse_diagonal(const XC::SparseRowMatrix &A)
+  {
+    std::vector<double> retval= A.getDiagonal();
+    for(std::vector<double>::iterator i= retval.begin();i!=retval.end();i++)
+      *i= ((*i!=0.0) ? 1.0/(*i) : 1.0);
+    return retval;
+  }
+
+//! @brief Estimates the spectral radius of \f$D^{-1}A\f$ (power
+//! iteration bounded by the Gershgorin estimate).
+static double spectral_radius(const XC::SparseRowMatrix &A,const std::vector<double> &invDiag,XC::WorkerPool *workers)
+  {
+    const int n= A.getNumRows();
+    double gershgorin= 0.0;
+    for(int i= 0;i<n;i++)
+      {
+        double s= 0.0;
+        for(int k= A.rowBegin(i);k<A.rowEnd(i);k++)
+          s+= std::fabs(A.getVal(k));
+        gershgorin= std::max(gershgorin,s*std::fabs(invDiag[i]));
+      }
+    std::vector<double> x(n), y(n);
+    for(int i= 0;i<n;i++)
+      x[i]= 1.0+double(i%7)/7.0;
+    double rho= 0.0;
+    for(int it= 0;(it<15) && (n>0);it++)
+      {
+        double xx= 0.0;
+        for(int i= 0;i<n;i++)
+          xx+= x[i]*x[i];
+        A.product(&x[0],&y[0],workers);
+        double yy= 0.0;
+        for(int i= 0;i<n;i++)
+          {
+            y[i]*= invDiag[i];
+            yy+= y[i]*y[i];
+          }
+        if((xx==0.0) || (yy==0.0))
+          break;
+        rho= std::sqrt(yy/xx);
+        const double f= 1.0/std::sqrt(yy);
+        for(int i= 0;i<n;i++)
+          x[i]= y[i]*f;
+      }
+    if(rho==0.0)
+      rho= gershgorin;
+    return std::min(1.1*rho,gershgorin);
+  }
+
+//! @brief Groups the nodes in aggregates.
+//!
+//! First the nodes whose strongly connected neighbours are not
+//! aggregated yet form an aggregate with them; then the remaining nodes
+//! join the aggregate of its strongest neighbour and, finally, the
+//! nodes that are still left form new aggregates with its
+//! non aggregated neighbours.
+//! @param A: matrix of the level.
+//! @param b: block size.
+//! @param agg: aggregate of each node (output).
+//! @return number of aggregates.
+int XC::AMGPreconditioner::aggregate(const SparseRowMatrix &A,const int &b,std::vector<int> &agg) const
+  {
+    const int numNodes= A.getNumRows()/b;
+    // norms of the node blocks.
+    std::vector<int> strongStart(numNodes+1,0);
+    std::vector<int> strong;
+    std::vector<double> strongValue;
+    std::vector<double> diagNorm(numNodes,0.0);
+    std::vector<double> blockNorm(numNodes,0.0);
+    std::vector<int> marker(numNodes,-1);
+    std::vector<int> neighbours;
+    std::vector<std::vector<std::pair<int,double> > > couplings(numNodes);
+    for(int I= 0;I<numNodes;I++)
+      {
+        neighbours.clear();
+        for(int i= I*b;i<(I+1)*b;i++)
+          for(int k= A.rowBegin(i);k<A.rowEnd(i);k++)
+            {
+              const int J= A.getCol(k)/b;
+              const double a2= A.getVal(k)*A.getVal(k);
+              if(J==I)
+                diagNorm[I]+= a2;
+              else
+                {
+                  if(marker[J]!=I)
+                    {
+                      marker[J]= I;
+                      blockNorm[J]= 0.0;
+                      neighbours.push_back(J);
+                    }
+                  blockNorm[J]+= a2;
+                }
+            }
+        for(std::vector<int>::const_iterator J= neighbours.begin();J!=neighbours.end();J++)
+          couplings[I].push_back(std::make_pair(*J,std::sqrt(blockNorm[*J])));
+      }
+    const double theta2= strengthThreshold*strengthThreshold;
+    for(int I= 0;I<numNodes;I++)
+      {
+        for(std::vector<std::pair<int,double> >::const_iterator c= couplings[I].begin();c!=couplings[I].end();c++)
+          if(c->second*c->second>=theta2*std::sqrt(diagNorm[I]*diagNorm[c->first]))
+            {
+              strong.push_back(c->first);
+              strongValue.push_back(c->second);
+            }
+        std::vector<std::pair<int,double> >().swap(couplings[I]);
+        strongStart[I+1]= strong.size();
+      }
+
+    agg.assign(numNodes,-1);
+    int numAgg= 0;
+    // phase 1: root nodes with all its neighbours free.
+    for(int I= 0;I<numNodes;I++)
+      {
+        if((agg[I]!=-1) || (strongStart[I]==strongStart[I+1]))
+          continue;
+        bool free= true;
+        for(int k= strongStart[I];(k<strongStart[I+1]) && free;k++)
+          free= (agg[strong[k]]==-1);
+        if(free)
+          {
+            agg[I]= numAgg;
+            for(int k= strongStart[I];k<strongStart[I+1];k++)
+              agg[strong[k]]= numAgg;
+            numAgg++;
+          }
+      }
+    // phase 2: join the aggregate of the strongest neighbour.
+    const std::vector<int> agg1(agg);
+    for(int I= 0;I<numNodes;I++)
+      if(agg[I]==-1)
+        {
+          double maxValue= -1.0;
+          for(int k= strongStart[I];k<strongStart[I+1];k++)
+            if((agg1[strong[k]]!=-1) && (strongValue[k]>maxValue))
+              {
+                maxValue= strongValue[k];
+                agg[I]= agg1[strong[k]];
+              }
+        }
+    // phase 3: new aggregates with the remaining nodes.
+    for(int I= 0;I<numNodes;I++)
+      if(agg[I]==-1)
+        {
+          agg[I]= numAgg;
+          for(int k= strongStart[I];k<strongStart[I+1];k++)
+            if(agg[strong[k]]==-1)
+              agg[strong[k]]= numAgg;
+          numAgg++;
+        }
+    return numAgg;
+  }
+
+//! @brief Computes the smoothed prolongator
+//! \f$P= (I-\omega D^{-1} A) T\f$ where \f$T\f$ is the tentative
+//! prolongator.
+//!
+//! @param L: level.
+//! @param b: block size.
+//! @param agg: aggregate of each node.
+//! @param numAgg: number of aggregates.
+XC::SparseRowMatrix XC::AMGPreconditioner::get_prolongator(const Level &L,const int &b,const std::vector<int> &agg,const int &numAgg) const
+  {
+    const SparseRowMatrix &A= L.A;
+    const int n= A.getNumRows();
+    // tentative prolongator (orthonormal columns).
+    std::vector<int> aggSize(numAgg,0);
+    for(std::vector<int>::const_iterator i= agg.begin();i!=agg.end();i++)
+      aggSize[*i]++;
+    std::vector<int> rs(n+1), c(n);
+    std::vector<double> v(n);
+    for(int i= 0;i<n;i++)
+      {
+        rs[i]= i;
+        const int a= agg[i/b];
+        c[i]= a*b+i%b;
+        v[i]= 1.0/std::sqrt(double(aggSize[a]));
+      }
+    rs[n]= n;
+    SparseRowMatrix T;
+    T.setData(n,numAgg*b,rs,c,v);
+
+    // smoother S= I-omega*D^-1*A.
+    const double omega= L.omega; // same factor as the Jacobi smoother.
+    rs.assign(n+1,0);
+    c.clear();
+    v.clear();
+    for(int i= 0;i<n;i++)
+      {
+        const double f= -omega*L.invDiag[i];
+        bool diag= false;
+        for(int k= A.rowBegin(i);k<A.rowEnd(i);k++)
+          {
+            const int j= A.getCol(k);
+            if(!diag && (j>=i))
+              {
+                diag= true;
+                if(j>i)
+                  {
+                    c.push_back(i);
+                    v.push_back(1.0);
+                  }
+              }
+            c.push_back(j);
+            v.push_back((j==i ? 1.0 : 0.0)+f*A.getVal(k));
+          }
+        if(!diag)
+          {
+            c.push_back(i);
+            v.push_back(1.0);
+          }
+        rs[i+1]= c.size();
+      }
+    SparseRowMatrix S;
+    S.setData(n,n,rs,c,v);
+    return S*T;
+  }
+
+//! @brief Builds the multigrid hierarchy.
+int XC::AMGPreconditioner::setup(const SparseRowMatrix &A,const size_t &)
+  {
+    levels.clear();
+    levels.reserve(maxNumLevels);
+    levels.push_back(Level());
+    levels.back().A= A;
+    int b= blockSize;
+    if(A.getNumRows()%b!=0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; the number of equations: " << A.getNumRows()
+                  << " is not a multiple of the block size: "
+                  << b << "; block size set to 1.\n";
+        b= 1;
+      }
+    while(true)
+      {
+        Level &L= levels.back();
+        const int n= L.A.getNumRows();
+        L.invDiag= get_inverse_diagonal(L.A);
+        L.omega= 4.0/3.0/spectral_radius(L.A,L.invDiag,workers);
+        L.b.resize(n);
+        L.x.resize(n);
+        L.r.resize(n);
+        if((n<=maxCoarseSize) || (int(levels.size())>=maxNumLevels))
+          break;
+        std::vector<int> agg;
+        const int numAgg= aggregate(L.A,b,agg);
+        if(numAgg*b>=0.9*n) // coarsening too slow.
+          break;
+        L.P= get_prolongator(L,b,agg,numAgg);
+        L.R= L.P.getTranspose();
+        const SparseRowMatrix AP= L.A*L.P;
+        SparseRowMatrix Ac= L.R*AP;
+        levels.push_back(Level());
+        levels.back().A= Ac;
+      }
+    // dense factorization of the coarsest matrix.
+    coarseLU.clear();
+    const SparseRowMatrix &Ac= levels.back().A;
+    int nc= Ac.getNumRows();
+    if((nc>0) && (nc<=maxDenseSize))
+      {
+        coarseLU.assign(size_t(nc)*nc,0.0);
+        for(int i= 0;i<nc;i++)
+          for(int k= Ac.rowBegin(i);k<Ac.rowEnd(i);k++)
+            coarseLU[size_t(Ac.getCol(k))*nc+i]= Ac.getVal(k);
+        coarsePiv.resize(nc);
+        int info= 0;
+        dgetrf_(&nc,&nc,&coarseLU[0],&nc,&coarsePiv[0],&info);
+        if(info!=0)
+          {
+            std::clog << getClassName() << "::" << __FUNCTION__
+                      << "; coarsest matrix is singular;"
+                      << " it will be smoothed instead of solved.\n";
+            coarseLU.clear();
+          }
+      }
+    return 0;
+  }
+
+//! @brief Return the operator complexity of the hierarchy (number
+//! of coefficients of all the levels divided by the number
+//! of coefficients of the system matrix).
+double XC::AMGPreconditioner::getOperatorComplexity(void) const
+  {
+    double retval= 0.0;
+    if(!levels.empty() && (levels[0].A.getNumNonZeros()>0))
+      {
+        for(std::vector<Level>::const_iterator i= levels.begin();i!=levels.end();i++)
+          retval+= i->A.getNumNonZeros();
+        retval/= levels[0].A.getNumNonZeros();
+      }
+    return retval;
+  }
+
+//! @brief Damped Jacobi sweep: \f$x= x+\omega D^{-1}(b-Ax)\f$.
+void XC::AMGPreconditioner::smooth(const Level &L,const double *b,double *x) const
+  {
+    const int n= L.A.getNumRows();
+    L.A.residual(b,x,&L.r[0],workers);
+    for(int i= 0;i<n;i++)
+      x[i]+= L.omega*L.invDiag[i]*L.r[i];
+  }
+
+//! @brief Solves the coarsest system.
+void XC::AMGPreconditioner::coarse_solve(const double *b,double *x) const
+  {
+    const Level &L= levels.back();
+    int n= L.A.getNumRows();
+    if(!coarseLU.empty())
+      {
+        std::copy(b,b+n,x);
+        char trans[]= "N";
+        int nrhs= 1, info= 0;
+        dgetrs_(trans,&n,&nrhs,const_cast<double *>(&coarseLU[0]),&n,&coarsePiv[0],x,&n,&info);
+      }
+    else
+      {
+        std::fill(x,x+n,0.0);
+        for(int s= 0;s<10*numSweeps;s++)
+          smooth(L,b,x);
+      }
+  }
+
+//! @brief V-cycle starting at the level being passed as parameter.
+void XC::AMGPreconditioner::cycle(const size_t &l,const double *b,double *x) const
+  {
+    if(l+1==levels.size())
+      {
+        coarse_solve(b,x);
+        return;
+      }
+    const Level &L= levels[l];
+    const Level &next= levels[l+1];
+    const int n= L.A.getNumRows();
+    // pre-smoothing (from x= 0).
+    for(int i= 0;i<n;i++)
+      x[i]= L.omega*L.invDiag[i]*b[i];
+    for(int s= 1;s<numSweeps;s++)
+      smooth(L,b,x);
+    // coarse grid correction.
+    L.A.residual(b,x,&L.r[0],workers);
+    L.R.product(&L.r[0],&next.b[0],workers);
+    cycle(l+1,&next.b[0],&next.x[0]);
+    L.P.product(&next.x[0],&L.r[0],workers);
+    for(int i= 0;i<n;i++)
+      x[i]+= L.r[i];
+    // post-smoothing.
+    for(int s= 0;s<numSweeps;s++)
+      smooth(L,b,x);
+  }
+
+//! @brief Computes \f$z= M^{-1} r\f$ (one V-cycle).
+void XC::AMGPreconditioner::apply(const double *r,double *z) const
+  {
+    if(!levels.empty())
+      cycle(0,r,z);
+  }
@@ -0,0 +1,123 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//AMGPreconditioner.h
+
+#ifndef AMGPreconditioner_h
+#define AMGPreconditioner_h
+
+#include "KrylovPreconditioner.h"
+#include "SparseRowMatrix.h"
+#include <vector>
+#include <algorithm>
+
+namespace XC {
+
+//! @ingroup LinearSolver
+//
+//! @brief Smoothed aggregation algebraic multigrid preconditioner
+//! (one V-cycle).
+//!
+//! The nodes (groups of blockSize consecutive equations) are
+//! grouped in aggregates using the strong couplings of the matrix;
+//! the tentative prolongator interpolates the constant vectors of each
+//! degree of freedom (translations) and it's smoothed with a damped
+//! Jacobi step. The coarse matrices are computed with the Galerkin
+//! product \f$A_c= P^T A P\f$. Damped Jacobi is used as smoother
+//! (same number of pre and post smoothing sweeps, so the
+//! preconditioner is symmetric for symmetric matrices) and the
+//! coarsest system is solved with a dense LU factorization.
+class AMGPreconditioner: public KrylovPreconditioner
+  {
+  private:
+    //! @brief Data of a level of the multigrid hierarchy.
+    struct Level
+      {
+        SparseRowMatrix A; //!< matrix of the level.
+        SparseRowMatrix P; //!< prolongator to this level from the next one.
+        SparseRowMatrix R; //!< restriction (transpose of P).
+        std::vector<double> invDiag; //!< inverse of the diagonal of A.
+        double omega; //!< damping factor of the Jacobi smoother.
+        mutable std::vector<double> b; //!< right hand side (work array).
+        mutable std::vector<double> x; //!< solution (work array).
+        mutable std::vector<double> r; //!< residual (work array).
+      };
+    double strengthThreshold; //!< threshold of the strong couplings.
+    int blockSize; //!< number of equations of each node.
+    int maxCoarseSize; //!< maximum size of the coarsest system.
+    int maxNumLevels; //!< maximum number of levels.
+    int numSweeps; //!< number of pre and post smoothing sweeps.
+    std::vector<Level> levels;
+    std::vector<double> coarseLU; //!< LU factorization of the coarsest matrix.
+    mutable std::vector<int> coarsePiv; //!< pivots of the LU factorization.
+
+    int aggregate(const SparseRowMatrix &,const int &,std::vector<int> &) const;
+    SparseRowMatrix get_prolongator(const Level &,const int &,const std::vector<int> &,const int &) const;
+    void smooth(const Level &,const double *,double *) const;
+    void coarse_solve(const double *,double *) const;
+    void cycle(const size_t &,const double *,double *) const;
+  public:
+    AMGPreconditioner(void);
+    KrylovPreconditioner *getCopy(void) const;
+
+    //! @brief Return the threshold of the strong couplings.
+    inline double getStrengthThreshold(void) const
+      { return strengthThreshold; }
+    //! @brief Set the threshold of the strong couplings.
+    inline void setStrengthThreshold(const double &d)
+      { strengthThreshold= d; }
+    //! @brief Return the number of equations of each node.
+    inline int getBlockSize(void) const
+      { return blockSize; }
+    //! @brief Set the number of equations of each node (the equations
+    //! of each node must be numbered consecutively).
+    inline void setBlockSize(const int &i)
+      { blockSize= std::max(1,i); }
+    //! @brief Return the maximum size of the coarsest system.
+    inline int getMaxCoarseSize(void) const
+      { return maxCoarseSize; }
+    //! @brief Set the maximum size of the coarsest system.
+    inline void setMaxCoarseSize(const int &i)
+      { maxCoarseSize= i; }
+    //! @brief Return the maximum number of levels.
+    inline int getMaxNumLevels(void) const
+      { return maxNumLevels; }
+    //! @brief Set the maximum number of levels.
+    inline void setMaxNumLevels(const int &i)
+      { maxNumLevels= std::max(1,i); }
+    //! @brief Return the number of smoothing sweeps.
+    inline int getNumSweeps(void) const
+      { return numSweeps; }
+    //! @brief Set the number of smoothing sweeps.
+    inline void setNumSweeps(const int &i)
+      { numSweeps= std::max(1,i); }
+    //! @brief Return the number of levels of the hierarchy.
+    inline int getNumLevels(void) const
+      { return levels.size(); }
+    double getOperatorComplexity(void) const;
+
+    int setup(const SparseRowMatrix &,const size_t &);
+    void apply(const double *,double *) const;
+  };
+
+} // end of XC namespace
+
+#endif
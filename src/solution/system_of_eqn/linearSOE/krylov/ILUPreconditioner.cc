@@ -0,0 +1,184 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ILUPreconditioner.cc
+
+#include "ILUPreconditioner.h"
+#include "SparseRowMatrix.h"
+#include <cmath>
+#include <algorithm>
+#include <iostream>
+
+//! @brief Constructor.
+//!
+//! @param k: level of fill.
+XC::ILUPreconditioner::ILUPreconditioner(const int &k)
+  : KrylovPreconditioner(), level(k), symbolicStamp(0), numModifiedPivots(0) {}
+
+//! @brief Virtual constructor.
+XC::KrylovPreconditioner *XC::ILUPreconditioner::getCopy(void) const
+  { return new ILUPreconditioner(*this); }
+
+//! @brief Computes the sparsity pattern of the factors.
+//!
+//! The fill-in \f$(i,j)\f$ produced when eliminating \f$k\f$ has the
+//! level \f$lev(i,k)+lev(k,j)+1\f$ (the coefficients of A have level 0)
+//! and it's kept if its level doesn't exceed the level of fill.
+void XC::ILUPreconditioner::symbolic(const SparseRowMatrix &A)
+  {
+    const int n= A.getNumRows();
+    rowStart.assign(n+1,0);
+    col.clear();
+    diagPos.assign(n,0);
+    std::vector<int> levels; //levels of the stored coefficients.
+    std::vector<int> lev(n,0);
+    std::vector<int> next(n,n); // sorted linked list of the row columns (n: end).
+    std::vector<int> marker(n,-1);
+    std::vector<int> rowCols;
+    for(int i= 0;i<n;i++)
+      {
+        // pattern of A (with the diagonal).
+        rowCols.clear();
+        for(int q= A.rowBegin(i);q<A.rowEnd(i);q++)
+          rowCols.push_back(A.getCol(q));
+        std::vector<int>::iterator d= std::lower_bound(rowCols.begin(),rowCols.end(),i);
+        if((d==rowCols.end()) || (*d!=i))
+          rowCols.insert(d,i);
+        const int head= rowCols.front();
+        for(size_t q= 0;q<rowCols.size();q++)
+          {
+            const int j= rowCols[q];
+            marker[j]= i;
+            lev[j]= 0;
+            next[j]= ((q+1<rowCols.size()) ? rowCols[q+1] : n);
+          }
+        // fill-in from the rows above.
+        for(int k= head;k<i;k= next[k])
+          {
+            const int lik= lev[k];
+            for(int q= diagPos[k]+1;q<rowStart[k+1];q++)
+              {
+                const int newLev= lik+levels[q]+1;
+                if(newLev>level)
+                  continue;
+                const int j= col[q];
+                if(marker[j]==i)
+                  lev[j]= std::min(lev[j],newLev);
+                else
+                  {
+                    marker[j]= i;
+                    lev[j]= newLev;
+                    int p= k;
+                    while(next[p]<j)
+                      p= next[p];
+                    next[j]= next[p];
+                    next[p]= j;
+                  }
+              }
+          }
+        for(int j= head;j<n;j= next[j])
+          {
+            if(j==i)
+              diagPos[i]= col.size();
+            col.push_back(j);
+            levels.push_back(lev[j]);
+          }
+        rowStart[i+1]= col.size();
+      }
+    LU.resize(col.size());
+  }
+
+//! @brief Computes the incomplete factorization of the matrix.
+//!
+//! Small pivots are replaced by a small fraction of the norm of the
+//! row to keep the preconditioner defined.
+int XC::ILUPreconditioner::setup(const SparseRowMatrix &A,const size_t &stamp)
+  {
+    const int n= A.getNumRows();
+    if((symbolicStamp==0) || (symbolicStamp!=stamp) || (int(diagPos.size())!=n))
+      {
+        symbolic(A);
+        symbolicStamp= stamp;
+      }
+    numModifiedPivots= 0;
+    std::vector<int> pos(n,-1);
+    for(int i= 0;i<n;i++)
+      {
+        for(int k= rowStart[i];k<rowStart[i+1];k++)
+          {
+            pos[col[k]]= k;
+            LU[k]= 0.0;
+          }
+        double rowNorm= 0.0;
+        for(int q= A.rowBegin(i);q<A.rowEnd(i);q++)
+          {
+            LU[pos[A.getCol(q)]]+= A.getVal(q);
+            rowNorm= std::max(rowNorm,std::fabs(A.getVal(q)));
+          }
+        for(int kk= rowStart[i];kk<diagPos[i];kk++)
+          {
+            const int k= col[kk];
+            const double m= LU[kk]/LU[diagPos[k]];
+            LU[kk]= m;
+            for(int q= diagPos[k]+1;q<rowStart[k+1];q++)
+              {
+                const int p= pos[col[q]];
+                if(p>=0)
+                  LU[p]-= m*LU[q];
+              }
+          }
+        double &pivot= LU[diagPos[i]];
+        if(std::fabs(pivot)<=1e-12*rowNorm || (rowNorm==0.0))
+          {
+            const double small= (rowNorm>0.0 ? 1e-8*rowNorm : 1.0);
+            pivot= (pivot<0.0 ? -small : small);
+            numModifiedPivots++;
+          }
+        for(int k= rowStart[i];k<rowStart[i+1];k++)
+          pos[col[k]]= -1;
+      }
+    if(numModifiedPivots>0)
+      std::clog << getClassName() << "::" << __FUNCTION__
+                << "; " << numModifiedPivots
+                << " small pivots replaced." << std::endl;
+    return 0;
+  }
+
+//! @brief Computes \f$z= U^{-1}L^{-1}r\f$ (forward and backward
+//! substitution).
+void XC::ILUPreconditioner::apply(const double *r,double *z) const
+  {
+    const int n= diagPos.size();
+    for(int i= 0;i<n;i++)
+      {
+        double s= r[i];
+        for(int k= rowStart[i];k<diagPos[i];k++)
+          s-= LU[k]*z[col[k]];
+        z[i]= s;
+      }
+    for(int i= n-1;i>=0;i--)
+      {
+        double s= z[i];
+        for(int k= diagPos[i]+1;k<rowStart[i+1];k++)
+          s-= LU[k]*z[col[k]];
+        z[i]= s/LU[diagPos[i]];
+      }
+  }
@@ -0,0 +1,77 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ILUPreconditioner.h
+
+#ifndef ILUPreconditioner_h
+#define ILUPreconditioner_h
+
+#include "KrylovPreconditioner.h"
+#include <vector>
+
+namespace XC {
+
+//! @ingroup LinearSolver
+//
+//! @brief Incomplete LU factorization with level of fill k: ILU(k).
+//!
+//! The sparsity pattern of the factors (symbolic phase) is computed
+//! from the levels of fill and reused while the graph of the system
+//! doesn't change. For symmetric matrices the factors are
+//! \f$L\f$ and \f$U= D L^T\f$, so the preconditioner
+//! \f$L D L^T\f$ is the incomplete Cholesky factorization IC(k)
+//! and it's symmetric (it can be used with the CG and MINRES methods).
+class ILUPreconditioner: public KrylovPreconditioner
+  {
+  private:
+    int level; //!< level of fill.
+    size_t symbolicStamp; //!< graph stamp of the symbolic phase (0: none).
+    int numModifiedPivots; //!< number of small pivots replaced in the last factorization.
+    std::vector<int> rowStart; //!< start of the rows of the factors.
+    std::vector<int> col; //!< column indexes of the factors.
+    std::vector<int> diagPos; //!< position of the diagonal of each row.
+    std::vector<double> LU; //!< coefficients of L (unit diagonal not stored) and U.
+    void symbolic(const SparseRowMatrix &);
+  public:
+    ILUPreconditioner(const int &k= 0);
+    KrylovPreconditioner *getCopy(void) const;
+
+    //! @brief Return the level of fill.
+    inline int getLevel(void) const
+      { return level; }
+    //! @brief Set the level of fill.
+    inline void setLevel(const int &k)
+      { level= k; symbolicStamp= 0; }
+    //! @brief Return the number of coefficients of the factors.
+    inline size_t getNumNonZeros(void) const
+      { return col.size(); }
+    //! @brief Return the number of small pivots replaced in
+    //! the last factorization.
+    inline int getNumModifiedPivots(void) const
+      { return numModifiedPivots; }
+
+    int setup(const SparseRowMatrix &,const size_t &);
+    void apply(const double *,double *) const;
+  };
+
+} // end of XC namespace
+
+#endif
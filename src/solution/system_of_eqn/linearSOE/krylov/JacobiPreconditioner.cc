@@ -0,0 +1,56 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//JacobiPreconditioner.cc
+
+#include "JacobiPreconditioner.h"
+#include "SparseRowMatrix.h"
+#include "utility/WorkerPool.h"
+
+//! @brief Virtual constructor.
+XC::KrylovPreconditioner *XC::JacobiPreconditioner::getCopy(void) const
+  { return new JacobiPreconditioner(*this); }
+
+//! @brief Computes the inverse of the diagonal (zero diagonal
+//! terms are replaced by one).
+int XC::JacobiPreconditioner::setup(const SparseRowMatrix &A,const size_t &)
+  {
+    invDiag= A.getDiagonal();
+    for(std::vector<double>::iterator i= invDiag.begin();i!=invDiag.end();i++)
+      *i= ((*i!=0.0) ? 1.0/(*i) : 1.0);
+    return 0;
+  }
+
+//! @brief Computes \f$z_i= r_i/a_{ii}\f$.
+void XC::JacobiPreconditioner::apply(const double *r,double *z) const
+  {
+    const double *d= (invDiag.empty() ? nullptr : &invDiag[0]);
+    const size_t sz= invDiag.size();
+    if(workers)
+      workers->run_blocks([&](const size_t &begin,const size_t &end)
+                            {
+                              for(size_t i= begin;i<end;i++)
+                                z[i]= d[i]*r[i];
+                            },sz);
+    else
+      for(size_t i= 0;i<sz;i++)
+        z[i]= d[i]*r[i];
+  }
@@ -0,0 +1,47 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//JacobiPreconditioner.h
+
+#ifndef JacobiPreconditioner_h
+#define JacobiPreconditioner_h
+
+#include "KrylovPreconditioner.h"
+#include <vector>
+
+namespace XC {
+
+//! @ingroup LinearSolver
+//
+//! @brief Diagonal (Jacobi) preconditioner: \f$M= diag(A)\f$.
+class JacobiPreconditioner: public KrylovPreconditioner
+  {
+  private:
+    std::vector<double> invDiag; //!< inverse of the diagonal of the matrix.
+  public:
+    KrylovPreconditioner *getCopy(void) const;
+    int setup(const SparseRowMatrix &,const size_t &);
+    void apply(const double *,double *) const;
+  };
+
+} // end of XC namespace
+
+#endif
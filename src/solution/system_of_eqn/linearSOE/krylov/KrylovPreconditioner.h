@@ -0,0 +1,63 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//KrylovPreconditioner.h
+
+#ifndef KrylovPreconditioner_h
+#define KrylovPreconditioner_h
+
+#include "xc_utils/src/nucleo/EntCmd.h"
+#include <cstddef>
+
+namespace XC {
+class SparseRowMatrix;
+class WorkerPool;
+
+//! @ingroup LinearSolver
+//
+//! @brief Base class for the preconditioners of the Krylov
+//! solvers (see KrylovSparseSolver).
+class KrylovPreconditioner: public EntCmd
+  {
+  protected:
+    WorkerPool *workers; //!< threads of the solver (nullptr: run in the calling thread).
+  public:
+    KrylovPreconditioner(void);
+    //! @brief Virtual constructor.
+    virtual KrylovPreconditioner *getCopy(void) const= 0;
+
+    //! @brief Set the threads used to apply the preconditioner.
+    inline void setWorkers(WorkerPool *w)
+      { workers= w; }
+    //! @brief Computes the preconditioner for the matrix being passed
+    //! as parameter.
+    //!
+    //! @param A: system matrix.
+    //! @param stamp: graph stamp of the system; the data that depends
+    //! only on the sparsity pattern can be reused while it doesn't change.
+    virtual int setup(const SparseRowMatrix &A,const size_t &stamp)= 0;
+    //! @brief Computes \f$z= M^{-1} r\f$.
+    virtual void apply(const double *r,double *z) const= 0;
+  };
+
+} // end of XC namespace
+
+#endif
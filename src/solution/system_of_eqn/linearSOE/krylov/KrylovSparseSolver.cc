@@ -0,0 +1,448 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//KrylovSparseSolver.cc
+
+#include "KrylovSparseSolver.h"
+#include "KrylovPreconditioner.h"
+#include "JacobiPreconditioner.h"
+#include "ILUPreconditioner.h"
+#include "AMGPreconditioner.h"
+#include <solution/system_of_eqn/linearSOE/sparseGEN/SparseGenRowLinSOE.h>
+#include "utility/Profiler.h"
+#include <cmath>
+
+//! @brief Dot product of two vectors.
+static double dot_product(const std::vector<double> &a,const std::vector<double> &b)
+  {
+    double retval= 0.0;
+    const size_t n= a.size();
+    for(size_t i= 0;i<n;i++)
+      retval+= a[i]*b[i];
+    return retval;
+  }
+
+//! @brief Euclidean norm of a vector.
+static double vector_norm(const std::vector<double> &a)
+  { return std::sqrt(dot_product(a,a)); }
+
+//! @brief Euclidean norm of the array being passed as parameter.
+static double vector_norm(const double *a,const int &n)
+  {
+    double retval= 0.0;
+    for(int i= 0;i<n;i++)
+      retval+= a[i]*a[i];
+    return std::sqrt(retval);
+  }
+
+//! @brief Computes y+= alpha*x.
+static void axpy(const double &alpha,const std::vector<double> &x,std::vector<double> &y)
+  {
+    const size_t n= x.size();
+    for(size_t i= 0;i<n;i++)
+      y[i]+= alpha*x[i];
+  }
+
+//! @brief Constructor.
+XC::KrylovSparseSolver::KrylovSparseSolver(void)
+  : SparseGenRowLinSolver(SOLVER_TAGS_KrylovSparseSolver), method("cg"),
+    tolerance(1e-8), forcingTerm(0.0), maxNumIter(1000), restart(50),
+    workers(1), numIterations(0), residualNorm(0.0),
+    preconditioner(new JacobiPreconditioner())
+  { preconditioner->setWorkers(&workers); }
+
+//! @brief Copy constructor.
+XC::KrylovSparseSolver::KrylovSparseSolver(const KrylovSparseSolver &other)
+  : SparseGenRowLinSolver(other), method(other.method),
+    tolerance(other.tolerance), forcingTerm(other.forcingTerm),
+    maxNumIter(other.maxNumIter), restart(other.restart),
+    workers(other.workers), numIterations(other.numIterations),
+    residualNorm(other.residualNorm), preconditioner(nullptr)
+  { copy(other.preconditioner); }
+
+//! @brief Assignment operator.
+XC::KrylovSparseSolver &XC::KrylovSparseSolver::operator=(const KrylovSparseSolver &other)
+  {
+    SparseGenRowLinSolver::operator=(other);
+    method= other.method;
+    tolerance= other.tolerance;
+    forcingTerm= other.forcingTerm;
+    maxNumIter= other.maxNumIter;
+    restart= other.restart;
+    workers= other.workers;
+    numIterations= other.numIterations;
+    residualNorm= other.residualNorm;
+    copy(other.preconditioner);
+    return *this;
+  }
+
+//! @brief Destructor.
+XC::KrylovSparseSolver::~KrylovSparseSolver(void)
+  { free_mem(); }
+
+//! @brief Virtual constructor.
+XC::LinearSOESolver *XC::KrylovSparseSolver::getCopy(void) const
+  { return new KrylovSparseSolver(*this); }
+
+//! @brief Deletes the preconditioner.
+void XC::KrylovSparseSolver::free_mem(void)
+  {
+    if(preconditioner)
+      {
+        delete preconditioner;
+        preconditioner= nullptr;
+      }
+  }
+
+//! @brief Copies the preconditioner being passed as parameter
+//! (the copy uses the threads of this solver).
+void XC::KrylovSparseSolver::copy(const KrylovPreconditioner *p)
+  {
+    free_mem();
+    if(p)
+      {
+        preconditioner= p->getCopy();
+        preconditioner->setWorkers(&workers);
+      }
+  }
+
+//! @brief Set the Krylov method (cg, minres or gmres).
+void XC::KrylovSparseSolver::setMethod(const std::string &m)
+  {
+    if((m=="cg") || (m=="minres") || (m=="gmres"))
+      method= m;
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; unknown method: '" << m
+                << "'. Available methods: 'cg', 'minres' and 'gmres'."
+                << std::endl;
+  }
+
+//! @brief Set the number of threads.
+void XC::KrylovSparseSolver::setNumThreads(const size_t &n)
+  {
+    workers.setNumThreads(n);
+  }
+
+//! @brief Set the preconditioner.
+//!
+//! @param nmb: preconditioner type ('none', 'jacobi', 'ilu' or 'amg').
+XC::KrylovPreconditioner *XC::KrylovSparseSolver::setPreconditioner(const std::string &nmb)
+  {
+    KrylovPreconditioner *tmp= nullptr;
+    if(nmb=="jacobi")
+      tmp= new JacobiPreconditioner();
+    else if((nmb=="ilu") || (nmb=="ic"))
+      tmp= new ILUPreconditioner();
+    else if(nmb=="amg")
+      tmp= new AMGPreconditioner();
+    else if(nmb!="none")
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; preconditioner: '" << nmb << "' unknown."
+                  << " Available preconditioners: 'none', 'jacobi',"
+                  << " 'ilu' and 'amg'." << std::endl;
+        return preconditioner;
+      }
+    free_mem();
+    preconditioner= tmp;
+    if(preconditioner)
+      preconditioner->setWorkers(&workers);
+    if(theSOE)
+      theSOE->factored= false; // preconditioner must be computed.
+    return preconditioner;
+  }
+
+//! @brief Computes \f$z= M^{-1} r\f$.
+void XC::KrylovSparseSolver::precondition(const double *r,double *z) const
+  {
+    if(preconditioner)
+      preconditioner->apply(r,z);
+    else
+      std::copy(r,r+A.getNumRows(),z);
+  }
+
+//! @brief Preconditioned conjugate gradient method.
+//!
+//! @param b: right hand side.
+//! @param x: solution (zero on entry).
+//! @param tol: relative tolerance.
+int XC::KrylovSparseSolver::cg(const double *b,double *x,const double &tol)
+  {
+    const int n= A.getNumRows();
+    std::vector<double> r(b,b+n), z(n), p(n), q(n);
+    const double bNorm= vector_norm(r);
+    precondition(&r[0],&z[0]);
+    p= z;
+    double rz= dot_product(r,z);
+    for(numIterations= 1;numIterations<=maxNumIter;numIterations++)
+      {
+        A.product(&p[0],&q[0],&workers);
+        const double pq= dot_product(p,q);
+        if(pq<=0.0)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; the matrix (or the preconditioner) is not"
+                      << " positive definite.\n";
+            return -2;
+          }
+        const double alpha= rz/pq;
+        for(int i= 0;i<n;i++)
+          {
+            x[i]+= alpha*p[i];
+            r[i]-= alpha*q[i];
+          }
+        if(vector_norm(r)<=tol*bNorm)
+          return 0;
+        precondition(&r[0],&z[0]);
+        const double rzNew= dot_product(r,z);
+        const double beta= rzNew/rz;
+        rz= rzNew;
+        for(int i= 0;i<n;i++)
+          p[i]= z[i]+beta*p[i];
+      }
+    numIterations= maxNumIter;
+    return -3;
+  }
+
+//! @brief Preconditioned minimum residual method (symmetric
+//! matrices, symmetric positive definite preconditioner).
+//!
+//! The convergence is checked using the norm of the preconditioned
+//! residual \f$\|r\|_{M^{-1}}\f$.
+//! @param b: right hand side.
+//! @param x: solution (zero on entry).
+//! @param tol: relative tolerance.
+int XC::KrylovSparseSolver::minres(const double *b,double *x,const double &tol)
+  {
+    const int n= A.getNumRows();
+    std::vector<double> r1(b,b+n), r2(b,b+n), y(n), v(n), w(n,0.0), w1(n), w2(n,0.0);
+    precondition(&r1[0],&y[0]);
+    const double beta1sq= dot_product(r1,y);
+    if(beta1sq<0.0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; the preconditioner is not positive definite.\n";
+        return -2;
+      }
+    const double beta1= std::sqrt(beta1sq);
+    double beta= beta1, oldb= 0.0;
+    double dbar= 0.0, epsln= 0.0, phibar= beta1;
+    double cs= -1.0, sn= 0.0;
+    for(numIterations= 1;numIterations<=maxNumIter;numIterations++)
+      {
+        // Lanczos step.
+        const double s= 1.0/beta;
+        for(int i= 0;i<n;i++)
+          v[i]= s*y[i];
+        A.product(&v[0],&y[0],&workers);
+        if(numIterations>=2)
+          axpy(-beta/oldb,r1,y);
+        const double alfa= dot_product(v,y);
+        axpy(-alfa/beta,r2,y);
+        r1.swap(r2);
+        r2= y;
+        precondition(&r2[0],&y[0]);
+        oldb= beta;
+        const double betaSq= dot_product(r2,y);
+        if(betaSq<0.0)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; the preconditioner is not positive definite.\n";
+            return -2;
+          }
+        beta= std::sqrt(betaSq);
+        // QR factorization of the tridiagonal matrix.
+        const double oldeps= epsln;
+        const double delta= cs*dbar+sn*alfa;
+        const double gbar= sn*dbar-cs*alfa;
+        epsln= sn*beta;
+        dbar= -cs*beta;
+        const double gamma= std::max(std::sqrt(gbar*gbar+beta*beta),1e-300);
+        cs= gbar/gamma;
+        sn= beta/gamma;
+        const double phi= cs*phibar;
+        phibar= sn*phibar;
+        // update of the solution.
+        const double denom= 1.0/gamma;
+        w1.swap(w2);
+        w2.swap(w);
+        for(int i= 0;i<n;i++)
+          {
+            w[i]= (v[i]-oldeps*w1[i]-delta*w2[i])*denom;
+            x[i]+= phi*w[i];
+          }
+        if((phibar<=tol*beta1) || (beta==0.0))
+          return 0;
+      }
+    numIterations= maxNumIter;
+    return -3;
+  }
+
+//! @brief Restarted GMRES method with right preconditioning.
+//!
+//! @param b: right hand side.
+//! @param x: solution (zero on entry).
+//! @param tol: relative tolerance.
+int XC::KrylovSparseSolver::gmres(const double *b,double *x,const double &tol)
+  {
+    const int n= A.getNumRows();
+    const int m= restart;
+    std::vector<std::vector<double> > V(m+1,std::vector<double>(n));
+    std::vector<double> H(size_t(m+1)*m,0.0), cs(m), sn(m), g(m+1), y(m);
+    std::vector<double> z(n), w(n);
+    const double bNorm= vector_norm(b,n);
+    numIterations= 0;
+    while(true)
+      {
+        A.residual(b,x,&V[0][0],&workers);
+        const double beta= vector_norm(V[0]);
+        if(beta<=tol*bNorm)
+          return 0;
+        if(numIterations>=maxNumIter)
+          return -3;
+        for(int i= 0;i<n;i++)
+          V[0][i]/= beta;
+        std::fill(g.begin(),g.end(),0.0);
+        g[0]= beta;
+        int j= 0;
+        while((j<m) && (numIterations<maxNumIter))
+          {
+            numIterations++;
+            // Arnoldi step (modified Gram-Schmidt).
+            precondition(&V[j][0],&z[0]);
+            A.product(&z[0],&w[0],&workers);
+            double *h= &H[size_t(j)*(m+1)];
+            for(int i= 0;i<=j;i++)
+              {
+                h[i]= dot_product(w,V[i]);
+                axpy(-h[i],V[i],w);
+              }
+            h[j+1]= vector_norm(w);
+            if(h[j+1]>0.0)
+              for(int i= 0;i<n;i++)
+                V[j+1][i]= w[i]/h[j+1];
+            // Givens rotations.
+            for(int i= 0;i<j;i++)
+              {
+                const double tmp= cs[i]*h[i]+sn[i]*h[i+1];
+                h[i+1]= -sn[i]*h[i]+cs[i]*h[i+1];
+                h[i]= tmp;
+              }
+            const double t= std::sqrt(h[j]*h[j]+h[j+1]*h[j+1]);
+            cs[j]= (t>0.0 ? h[j]/t : 1.0);
+            sn[j]= (t>0.0 ? h[j+1]/t : 0.0);
+            const bool breakdown= (h[j+1]==0.0);
+            h[j]= t;
+            h[j+1]= 0.0;
+            g[j+1]= -sn[j]*g[j];
+            g[j]*= cs[j];
+            j++;
+            if((std::fabs(g[j])<=tol*bNorm) || breakdown)
+              break;
+          }
+        // solution of the least squares problem.
+        for(int i= j-1;i>=0;i--)
+          {
+            double s= g[i];
+            for(int k= i+1;k<j;k++)
+              s-= H[size_t(k)*(m+1)+i]*y[k];
+            y[i]= s/H[size_t(i)*(m+1)+i];
+          }
+        std::fill(w.begin(),w.end(),0.0);
+        for(int k= 0;k<j;k++)
+          axpy(y[k],V[k],w);
+        precondition(&w[0],&z[0]);
+        for(int i= 0;i<n;i++)
+          x[i]+= z[i];
+      }
+  }
+
+//! @brief Computes the solution of the system.
+//!
+//! If the matrix has changed since the last solution the
+//! preconditioner is computed again. Returns a negative number
+//! if the method fails or doesn't converge in the maximum number of
+//! iterations.
+int XC::KrylovSparseSolver::solve(void)
+  {
+    if(!theSOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+	          << "; no LinearSOE object has been set\n";
+	return -1;
+      }
+    const int n= theSOE->size;
+    numIterations= 0;
+    residualNorm= 0.0;
+    if(n==0)
+      return 0;
+    A.setView(n,theSOE->rowStartA.getDataPtr(),theSOE->colA.getDataPtr(),theSOE->A.getDataPtr());
+    if(!theSOE->factored)
+      {
+        ProfilerScope scope("LinearSOESolver::factor");
+        if(preconditioner)
+          {
+            const int result= preconditioner->setup(A,theSOE->getGraphStamp());
+            if(result<0)
+              return result;
+          }
+        theSOE->factored= true;
+      }
+    const double tol= std::max(tolerance,forcingTerm);
+    forcingTerm= 0.0; // only for this solution.
+    const double *b= theSOE->B.getDataPtr();
+    double *x= theSOE->X.getDataPtr();
+    std::fill(x,x+n,0.0);
+    const double bNorm= vector_norm(b,n);
+    if(bNorm==0.0)
+      return 0;
+    int retval= 0;
+    if(method=="minres")
+      retval= minres(b,x,tol);
+    else if(method=="gmres")
+      retval= gmres(b,x,tol);
+    else
+      retval= cg(b,x,tol);
+    // true residual.
+    std::vector<double> r(n);
+    A.residual(b,x,&r[0],&workers);
+    residualNorm= vector_norm(r)/bNorm;
+    if(retval==-3)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; method: " << method << " didn't converge in "
+                << maxNumIter << " iterations (relative residual: "
+                << residualNorm << ").\n";
+    return retval;
+  }
+
+//! @brief Nothing to do (the work arrays are allocated
+//! in each solution).
+int XC::KrylovSparseSolver::setSize(void)
+  { return 0; }
+
+//! @brief Does nothing but return \f$0\f$.
+int XC::KrylovSparseSolver::sendSelf(CommParameters &cp)
+  { return 0; }
+
+//! @brief Does nothing but return \f$0\f$.
+int XC::KrylovSparseSolver::recvSelf(const CommParameters &cp)
+  { return 0; }
@@ -0,0 +1,143 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//KrylovSparseSolver.h
+
+#ifndef KrylovSparseSolver_h
+#define KrylovSparseSolver_h
+
+#include <solution/system_of_eqn/linearSOE/sparseGEN/SparseGenRowLinSolver.h>
+#include "SparseRowMatrix.h"
+#include "utility/WorkerPool.h"
+#include <string>
+#include <vector>
+#include <algorithm>
+
+namespace XC {
+class KrylovPreconditioner;
+
+//! @ingroup LinearSolver
+//
+//! @brief Preconditioned Krylov solver for SparseGenRowLinSOE
+//! (compressed row storage) systems.
+//!
+//! Available methods:
+//! <ul>
+//! <li> cg: conjugate gradient (symmetric positive definite matrices).</li>
+//! <li> minres: minimum residual method (symmetric matrices).</li>
+//! <li> gmres: restarted GMRES with right preconditioning (general matrices).</li>
+//! </ul>
+//! Available preconditioners: none, jacobi, ilu (ILU(k), equivalent to
+//! the incomplete Cholesky factorization for symmetric matrices) and amg
+//! (smoothed aggregation algebraic multigrid). The preconditioner
+//! is computed again only when the matrix has changed. The matrix-vector
+//! products are split between the threads of a pool owned by the solver,
+//! which are started once and reused on each iteration.
+//!
+//! The solution is accepted when the relative residual
+//! \f$\|b-Ax\|/\|b\|\f$ doesn't exceed the tolerance or, if
+//! it's greater, the forcing term given by the Newton algorithm for
+//! the next solution (inexact Newton methods, see NewtonBased).
+class KrylovSparseSolver: public SparseGenRowLinSolver
+  {
+  private:
+    std::string method; //!< Krylov method (cg, minres or gmres).
+    double tolerance; //!< relative tolerance.
+    double forcingTerm; //!< relative tolerance for the next solution (0: not set).
+    int maxNumIter; //!< maximum number of iterations.
+    int restart; //!< number of iterations between GMRES restarts.
+    WorkerPool workers; //!< threads for the matrix-vector products and the preconditioner.
+    int numIterations; //!< iterations of the last solution.
+    double residualNorm; //!< relative residual of the last solution.
+    KrylovPreconditioner *preconditioner; //!< preconditioner (nullptr: none).
+    SparseRowMatrix A; //!< system matrix (view of the system arrays).
+
+    void free_mem(void);
+    void copy(const KrylovPreconditioner *);
+    void precondition(const double *,double *) const;
+    int cg(const double *,double *,const double &);
+    int minres(const double *,double *,const double &);
+    int gmres(const double *,double *,const double &);
+  protected:
+    friend class LinearSOE;
+    friend class FEM_ObjectBroker;
+    KrylovSparseSolver(void);
+    virtual LinearSOESolver *getCopy(void) const;
+  public:
+    KrylovSparseSolver(const KrylovSparseSolver &);
+    KrylovSparseSolver &operator=(const KrylovSparseSolver &);
+    ~KrylovSparseSolver(void);
+
+    int solve(void);
+    int setSize(void);
+
+    //! @brief Krylov solvers are iterative.
+    bool isIterative(void) const
+      { return true; }
+    //! @brief Set the relative tolerance for the next solution.
+    void setForcingTerm(const double &eta)
+      { forcingTerm= eta; }
+    //! @brief Return the number of iterations of the last solution.
+    int getNumIterations(void) const
+      { return numIterations; }
+    //! @brief Return the relative residual of the last solution.
+    inline double getResidualNorm(void) const
+      { return residualNorm; }
+
+    //! @brief Return the Krylov method.
+    inline const std::string &getMethod(void) const
+      { return method; }
+    void setMethod(const std::string &);
+    //! @brief Return the relative tolerance.
+    inline double getTolerance(void) const
+      { return tolerance; }
+    //! @brief Set the relative tolerance.
+    inline void setTolerance(const double &d)
+      { tolerance= d; }
+    //! @brief Return the maximum number of iterations.
+    inline int getMaxNumIter(void) const
+      { return maxNumIter; }
+    //! @brief Set the maximum number of iterations.
+    inline void setMaxNumIter(const int &i)
+      { maxNumIter= i; }
+    //! @brief Return the number of iterations between GMRES restarts.
+    inline int getRestart(void) const
+      { return restart; }
+    //! @brief Set the number of iterations between GMRES restarts.
+    inline void setRestart(const int &i)
+      { restart= std::max(1,i); }
+    //! @brief Return the number of threads.
+    inline size_t getNumThreads(void) const
+      { return workers.getNumThreads(); }
+    void setNumThreads(const size_t &);
+
+    KrylovPreconditioner *setPreconditioner(const std::string &);
+    //! @brief Return the preconditioner (nullptr if none).
+    inline KrylovPreconditioner *getPreconditioner(void)
+      { return preconditioner; }
+
+    int sendSelf(CommParameters &);
+    int recvSelf(const CommParameters &);
+  };
+
+} // end of XC namespace
+
+#endif
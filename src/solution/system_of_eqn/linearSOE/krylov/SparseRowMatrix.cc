@@ -0,0 +1,226 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SparseRowMatrix.cc
+
+#include "SparseRowMatrix.h"
+#include "utility/WorkerPool.h"
+#include <algorithm>
+
+//! @brief Minimum number of rows to split the products between threads.
+static const int minRowsByThread= 2000;
+
+//! @brief Default constructor.
+XC::SparseRowMatrix::SparseRowMatrix(void)
+  : numRows(0), numCols(0), rowPtr(nullptr), colPtr(nullptr), valPtr(nullptr) {}
+
+//! @brief Copy constructor.
+XC::SparseRowMatrix::SparseRowMatrix(const SparseRowMatrix &other)
+  : numRows(other.numRows), numCols(other.numCols),
+    rowPtr(other.rowPtr), colPtr(other.colPtr), valPtr(other.valPtr),
+    rowStart(other.rowStart), col(other.col), val(other.val)
+  { update_pointers(); }
+
+//! @brief Assignment operator.
+XC::SparseRowMatrix &XC::SparseRowMatrix::operator=(const SparseRowMatrix &other)
+  {
+    numRows= other.numRows;
+    numCols= other.numCols;
+    rowPtr= other.rowPtr;
+    colPtr= other.colPtr;
+    valPtr= other.valPtr;
+    rowStart= other.rowStart;
+    col= other.col;
+    val= other.val;
+    update_pointers();
+    return *this;
+  }
+
+//! @brief Make the pointers point to the owned data (if any).
+void XC::SparseRowMatrix::update_pointers(void)
+  {
+    if(!rowStart.empty())
+      {
+        rowPtr= &rowStart[0];
+        colPtr= (col.empty() ? nullptr : &col[0]);
+        valPtr= (val.empty() ? nullptr : &val[0]);
+      }
+  }
+
+//! @brief Make the matrix refer to the arrays being passed as
+//! parameter (square matrix, the data is not copied).
+//!
+//! @param n: number of rows.
+//! @param rs: start of each row (size n+1).
+//! @param c: column indexes.
+//! @param v: coefficients.
+void XC::SparseRowMatrix::setView(const int &n,const int *rs,const int *c,const double *v)
+  {
+    rowStart.clear();
+    col.clear();
+    val.clear();
+    numRows= n;
+    numCols= n;
+    rowPtr= rs;
+    colPtr= c;
+    valPtr= v;
+  }
+
+//! @brief Take the data from the vectors being passed as parameters
+//! (the vectors are emptied).
+void XC::SparseRowMatrix::setData(const int &nRows,const int &nCols,std::vector<int> &rs,std::vector<int> &c,std::vector<double> &v)
+  {
+    numRows= nRows;
+    numCols= nCols;
+    rowStart.swap(rs);
+    col.swap(c);
+    val.swap(v);
+    update_pointers();
+  }
+
+//! @brief Return the diagonal of the matrix.
+std::vector<double> XC::SparseRowMatrix::getDiagonal(void) const
+  {
+    std::vector<double> retval(numRows,0.0);
+    for(int i= 0;i<numRows;i++)
+      for(int k= rowPtr[i];k<rowPtr[i+1];k++)
+        if(colPtr[k]==i)
+          {
+            retval[i]= valPtr[k];
+            break;
+          }
+    return retval;
+  }
+
+//! @brief Runs f over the rows of the matrix, splitting them in
+//! blocks between the threads of the pool (if any) so each thread
+//! takes at least minRowsByThread rows.
+void XC::SparseRowMatrix::for_each_row_block(const std::function<void(const size_t &,const size_t &)> &f,WorkerPool *workers) const
+  {
+    const size_t nt= (workers ? std::min(workers->getNumThreads(),size_t(numRows/minRowsByThread+1)) : 1);
+    if(nt<2)
+      f(0,numRows);
+    else
+      {
+        const size_t blockSize= numRows/nt;
+        workers->run_blocks([&](const size_t &begin,const size_t &end)
+                              {
+                                for(size_t t= begin;t<end;t++)
+                                  f(t*blockSize,((t+1)<nt) ? (t+1)*blockSize : size_t(numRows));
+                              },nt);
+      }
+  }
+
+//! @brief Computes y= A*x splitting the rows between the threads.
+void XC::SparseRowMatrix::product(const double *x,double *y,WorkerPool *workers) const
+  {
+    for_each_row_block([&](const size_t &begin,const size_t &end)
+                 {
+                   for(size_t i= begin;i<end;i++)
+                     {
+                       double s= 0.0;
+                       for(int k= rowPtr[i];k<rowPtr[i+1];k++)
+                         s+= valPtr[k]*x[colPtr[k]];
+                       y[i]= s;
+                     }
+                 },workers);
+  }
+
+//! @brief Computes r= b-A*x splitting the rows between the threads.
+void XC::SparseRowMatrix::residual(const double *b,const double *x,double *r,WorkerPool *workers) const
+  {
+    for_each_row_block([&](const size_t &begin,const size_t &end)
+                 {
+                   for(size_t i= begin;i<end;i++)
+                     {
+                       double s= b[i];
+                       for(int k= rowPtr[i];k<rowPtr[i+1];k++)
+                         s-= valPtr[k]*x[colPtr[k]];
+                       r[i]= s;
+                     }
+                 },workers);
+  }
+
+//! @brief Return the transpose of the matrix.
+XC::SparseRowMatrix XC::SparseRowMatrix::getTranspose(void) const
+  {
+    std::vector<int> rs(numCols+1,0);
+    const size_t nnz= getNumNonZeros();
+    for(size_t k= 0;k<nnz;k++)
+      rs[colPtr[k]+1]++;
+    for(int j= 0;j<numCols;j++)
+      rs[j+1]+= rs[j];
+    std::vector<int> c(nnz);
+    std::vector<double> v(nnz);
+    std::vector<int> next(rs.begin(),rs.end()-1);
+    for(int i= 0;i<numRows;i++) // rows in ascending order: sorted columns.
+      for(int k= rowPtr[i];k<rowPtr[i+1];k++)
+        {
+          const int pos= next[colPtr[k]]++;
+          c[pos]= i;
+          v[pos]= valPtr[k];
+        }
+    SparseRowMatrix retval;
+    retval.setData(numCols,numRows,rs,c,v);
+    return retval;
+  }
+
+//! @brief Return the product of this matrix by the argument.
+XC::SparseRowMatrix XC::SparseRowMatrix::operator*(const SparseRowMatrix &b) const
+  {
+    const int nc= b.numCols;
+    std::vector<int> rs(numRows+1,0);
+    std::vector<int> c;
+    std::vector<double> v;
+    std::vector<int> marker(nc,-1);
+    std::vector<double> acc(nc,0.0);
+    std::vector<int> rowCols;
+    for(int i= 0;i<numRows;i++)
+      {
+        rowCols.clear();
+        for(int k= rowPtr[i];k<rowPtr[i+1];k++)
+          {
+            const int j= colPtr[k];
+            const double a= valPtr[k];
+            for(int q= b.rowPtr[j];q<b.rowPtr[j+1];q++)
+              {
+                const int jj= b.colPtr[q];
+                if(marker[jj]!=i)
+                  {
+                    marker[jj]= i;
+                    acc[jj]= 0.0;
+                    rowCols.push_back(jj);
+                  }
+                acc[jj]+= a*b.valPtr[q];
+              }
+          }
+        std::sort(rowCols.begin(),rowCols.end());
+        for(std::vector<int>::const_iterator q= rowCols.begin();q!=rowCols.end();q++)
+          {
+            c.push_back(*q);
+            v.push_back(acc[*q]);
+          }
+        rs[i+1]= c.size();
+      }
+    SparseRowMatrix retval;
+    retval.setData(numRows,nc,rs,c,v);
+    return retval;
+  }
@@ -0,0 +1,96 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SparseRowMatrix.h
+
+#ifndef SparseRowMatrix_h
+#define SparseRowMatrix_h
+
+#include <vector>
+#include <cstddef>
+#include <functional>
+
+namespace XC {
+class WorkerPool;
+
+//! @ingroup LinearSolver
+//
+//! @brief Sparse matrix in compressed row storage used by the
+//! Krylov solvers and its preconditioners.
+//!
+//! The matrix can own its data (coarse levels of the multigrid
+//! preconditioner, products, transposes,...) or refer to the arrays
+//! of a system of equations (see setView) to avoid copying the
+//! coefficients of big systems. The column indexes of each row
+//! must be sorted.
+class SparseRowMatrix
+  {
+  private:
+    int numRows;
+    int numCols;
+    const int *rowPtr; //!< start of each row (size numRows+1).
+    const int *colPtr; //!< column indexes.
+    const double *valPtr; //!< coefficients.
+    std::vector<int> rowStart; //!< row starts (owned data).
+    std::vector<int> col; //!< column indexes (owned data).
+    std::vector<double> val; //!< coefficients (owned data).
+    void update_pointers(void);
+  public:
+    SparseRowMatrix(void);
+    SparseRowMatrix(const SparseRowMatrix &);
+    SparseRowMatrix &operator=(const SparseRowMatrix &);
+
+    void setView(const int &,const int *,const int *,const double *);
+    void setData(const int &,const int &,std::vector<int> &,std::vector<int> &,std::vector<double> &);
+
+    //! @brief Return the number of rows.
+    inline int getNumRows(void) const
+      { return numRows; }
+    //! @brief Return the number of columns.
+    inline int getNumCols(void) const
+      { return numCols; }
+    //! @brief Return the number of stored coefficients.
+    inline size_t getNumNonZeros(void) const
+      { return (numRows>0 ? rowPtr[numRows] : 0); }
+    //! @brief Return the start of the i-th row.
+    inline const int &rowBegin(const int &i) const
+      { return rowPtr[i]; }
+    //! @brief Return the end of the i-th row.
+    inline const int &rowEnd(const int &i) const
+      { return rowPtr[i+1]; }
+    //! @brief Return the column index of the k-th coefficient.
+    inline const int &getCol(const int &k) const
+      { return colPtr[k]; }
+    //! @brief Return the k-th coefficient.
+    inline const double &getVal(const int &k) const
+      { return valPtr[k]; }
+
+    std::vector<double> getDiagonal(void) const;
+    void for_each_row_block(const std::function<void(const size_t &,const size_t &)> &,WorkerPool *) const;
+    void product(const double *,double *,WorkerPool *workers= nullptr) const;
+    void residual(const double *,const double *,double *,WorkerPool *workers= nullptr) const;
+    SparseRowMatrix getTranspose(void) const;
+    SparseRowMatrix operator*(const SparseRowMatrix &) const;
+  };
+
+} // end of XC namespace
+
+#endif
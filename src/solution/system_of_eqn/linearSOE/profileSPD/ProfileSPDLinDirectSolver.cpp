@@ -61,7 +61,9 @@
 
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectSolver.h>
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinSOE.h>
+#include "utility/matrix/Matrix.h"
 #include <cmath>
+#include "utility/Profiler.h"
 
 //! @brief Constructor. A unique class tag defined in classTags.h
 //! is passed to the base class constructor.
@@ -153,6 +155,7 @@ int XC::ProfileSPDLinDirectSolver::solve(void)
     
     if(theSOE->factored == false)
       {
+	ProfilerScope scope("LinearSOESolver::factor");
 
 	// FACTOR & SOLVE
 	double *ajiPtr, *akjPtr, *akiPtr, *bjPtr;    
@@ -311,6 +314,75 @@ int XC::ProfileSPDLinDirectSolver::solve(void)
     return 0;
   }
 
+//! @brief Compute the solution for several right hand sides.
+//!
+//! Each column of \p XB contains a right hand side on entry and the
+//! corresponding solution on exit. The matrix is factored (if not
+//! already factored) and then the forward and back substitutions are
+//! performed for all the columns in the same sweep over the factors.
+int XC::ProfileSPDLinDirectSolver::solve(Matrix &XB)
+  {
+    if(!theSOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; no system of equations has been assigned\n";
+	return -1;
+      }
+    
+    const int theSize= theSOE->size;
+    const int nrhs= XB.noCols();
+    if((theSize == 0) || (nrhs == 0))
+      return 0;
+
+    if(theSOE->factored == false)
+      {
+        const int ok= factor(theSize);
+        if(ok<0)
+          return ok;
+      }
+
+    double *X= XB.getDataPtr(); // column major storage.
+
+    // do forward substitution 
+    for(int i=1; i<theSize; i++)
+      {
+        const int rowitop = RowTop[i];	    
+        for(int c= 0;c<nrhs;c++)
+          {
+            double *Xc= X+c*theSize;
+            const double *ajiPtr = topRowPtr[i];
+            const double *bjPtr  = &Xc[rowitop];  
+            double tmp = 0;	    
+            for(int j=rowitop; j<i; j++) 
+              tmp -= *ajiPtr++ * *bjPtr++; 
+            Xc[i] += tmp;
+          }
+      }
+
+    // divide by diag term 
+    for(int c= 0;c<nrhs;c++)
+      {
+        double *Xc= X+c*theSize;
+        for(int j=0; j<theSize; j++) 
+          Xc[j]*= invD[j];
+      }
+
+    // now do the back substitution storing result in X
+    for(int k=(theSize-1); k>0; k--)
+      {
+        const int rowktop = RowTop[k];
+        for(int c= 0;c<nrhs;c++)
+          {
+            double *Xc= X+c*theSize;
+            const double bk = Xc[k];
+            const double *ajiPtr = topRowPtr[k]; 		
+            for(int j=rowktop; j<k; j++) 
+              Xc[j] -= *ajiPtr++ * bk;
+          }
+      }
+    return 0;
+  }
+
 //! @brief Returns the determinant.
 double XC::ProfileSPDLinDirectSolver::getDeterminant(void) 
   {
@@ -364,6 +436,7 @@ int XC::ProfileSPDLinDirectSolver::factor(int n)
     // set some pointers
     if(theSOE->factored == false)
       {
+	ProfilerScope scope("LinearSOESolver::factor");
 	// FACTOR & SOLVE
 	double *ajiPtr, *akjPtr, *akiPtr;    
 	
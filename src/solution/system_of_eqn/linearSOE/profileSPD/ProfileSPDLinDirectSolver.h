@@ -89,6 +89,10 @@ class ProfileSPDLinDirectSolver : public ProfileSPDLinDirectBase
     virtual LinearSOESolver *getCopy(void) const;
   public:
     virtual int solve(void);        
+    //! @brief The solver can solve several right hand sides at once.
+    bool canSolveMultipleRHS(void) const
+      { return true; }
+    virtual int solve(Matrix &);
     virtual int setSize(void);    
     double getDeterminant(void);
 
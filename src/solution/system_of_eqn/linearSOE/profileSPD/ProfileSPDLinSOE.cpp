@@ -58,6 +58,7 @@
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinSOE.h>
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinSolver.h>
 #include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/CSRGraph.h"
 #include <solution/graph/graph/Vertex.h>
 #include <solution/graph/graph/VertexIter.h>
 #include <utility/matrix/Vector.h>
@@ -158,7 +159,7 @@ bool XC::ProfileSPDLinSOE::setSolver(LinearSOESolver *newSolver)
 //! (double *,int)} Vector constructor are created. Finally, the result of 
 //! invoking setSize() on the associated Solver object is
 //! returned. 
-int XC::ProfileSPDLinSOE::setSize(Graph &theGraph)
+int XC::ProfileSPDLinSOE::setSize(const CSRGraph &theGraph)
   {
     int result = 0;
     size= checkSize(theGraph);
@@ -174,30 +175,18 @@ int XC::ProfileSPDLinSOE::setSize(Graph &theGraph)
     // now we go through the vertices to find the height of each col and
     // width of each row from the connectivity information.
     
-    Vertex *vertexPtr;
-    VertexIter &theVertices = theGraph.getVertices();
-
-    while ((vertexPtr = theVertices()) != 0)
-      {
-        int vertexNum = vertexPtr->getTag();
-        const std::set<int> &theAdjacency = vertexPtr->getAdjacency();
-        int iiDiagLoc = iDiagLoc(vertexNum);
-        int *iiDiagLocPtr = &(iDiagLoc(vertexNum));
-
-        for(std::set<int>::const_iterator i=theAdjacency.begin(); i!=theAdjacency.end(); i++)
-          {
-            const int otherNum= *i;
-            const int diff= vertexNum-otherNum;
-            if(diff > 0)
-              {
-                if(iiDiagLoc < diff)
-                  {
-                    iiDiagLoc = diff;
-                    *iiDiagLocPtr = diff;
-                  }
-              } 
-          }
-      }
+    // the adjacency of each vertex is sorted, so the column
+    // height is given by the first vertex of the adjacency.
+    const int numVertex= theGraph.getNumVertex();
+    for(int v= 0;v<numVertex;v++)
+      if(theGraph.getDegree(v)>0)
+        {
+          const int vertexNum= theGraph.getTag(v);
+          const int otherNum= theGraph.getTag(*theGraph.adjacencyBegin(v));
+          const int diff= vertexNum-otherNum;
+          if(diff > iDiagLoc(vertexNum))
+            iDiagLoc(vertexNum)= diff;
+        }
 
 
     // now go through iDiagLoc, adding 1 for the diagonal element
@@ -236,6 +225,11 @@ int XC::ProfileSPDLinSOE::setSize(Graph &theGraph)
     return result;
   }
 
+//! @brief Determines the size of the system from the graph
+//! (see setSize(const CSRGraph &)).
+int XC::ProfileSPDLinSOE::setSize(Graph &theGraph)
+  { return ProfileSPDLinSOE::setSize(CSRGraph(theGraph)); }
+
 //! @brief Assembles the product of m by fact into A.
 //! 
 //! First tests that \p loc and \p M are of compatable sizes; if not
@@ -22,7 +22,9 @@
 //python_interface.tcc
 
 class_<XC::LinearSOE, bases<XC::SystemOfEqn>, boost::noncopyable >("LinearSOE", no_init)
-.def("newSolver", &XC::LinearSOE::newSolver,return_internal_reference<>()," \n""newSolver(tipo)""Define the solver to be used.""Parameters: \n""tipo: type of solver. Available types: 'band_gen_lin_lapack_solver', 'band_spd_lin_lapack_solver', 'diagonal_direct_solver', 'distributed_diagonal_solver', 'full_gen_lin_lapack_solver', 'profile_spd_lin_direct_solver', 'profile_spd_lin_direct_block_solver', 'super_lu_solver', 'sym_sparse_lin_solver'" )
+.def("newSolver", &XC::LinearSOE::newSolver,return_internal_reference<>()," \n""newSolver(tipo)""Define the solver to be used.""Parameters: \n""tipo: type of solver. Available types: 'band_gen_lin_lapack_solver', 'band_spd_lin_lapack_solver', 'diagonal_direct_solver', 'distributed_diagonal_solver', 'full_gen_lin_lapack_solver', 'profile_spd_lin_direct_solver', 'profile_spd_lin_direct_block_solver', 'super_lu_solver', 'sym_sparse_lin_solver', 'supernodal_spd_lin_solver', 'krylov_sparse_solver'" )
+  .add_property("useScatterMaps", &XC::LinearSOE::getUseScatterMaps, &XC::LinearSOE::setUseScatterMaps,"If true (default) the element matrices are assembled through scatter maps (sparse systems only).")
+  .add_property("graphStamp", make_function(&XC::LinearSOE::getGraphStamp, return_value_policy<copy_const_reference>()),"Identifier of the current sparsity pattern of the system matrix (changes each time its storage is rebuilt).")
   ;
 
 class_<XC::LinearSOEData, bases<XC::LinearSOE>, boost::noncopyable >("LinearSOEData", no_init);
@@ -98,6 +100,9 @@ class_<XC::SparseGenRowLinSOE, bases<XC::SparseGenSOEBase>, boost::noncopyable >
 class_<XC::SymSparseLinSOE, bases<XC::SparseSOEBase>, boost::noncopyable >("SymSparseLinSOE", no_init)
     ;
 
+class_<XC::SupernodalSPDLinSOE, bases<XC::SparseSOEBase>, boost::noncopyable >("SupernodalSPDLinSOE", no_init)
+    ;
+
 // class_<XC::UmfpackGenLinSOE, bases<XC::FactoredSOEBase>, boost::noncopyable >("UmfpackGenLinSOE", no_init)
 //     ;
 
@@ -151,6 +156,46 @@ class_<XC::SparseGenRowLinSolver, bases<XC::LinearSOESolver>, boost::noncopyable
 
 class_<XC::SymSparseLinSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("SymSparseLinSolver", no_init);
 
+class_<XC::SupernodalSPDLinSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("SupernodalSPDLinSolver", no_init)
+  .add_property("numThreads",&XC::SupernodalSPDLinSolver::getNumThreads,&XC::SupernodalSPDLinSolver::setNumThreads,"assign/retrieve the number of threads used in the numeric factorization.")
+  .add_property("orderingMinSize",&XC::SupernodalSPDLinSolver::getOrderingMinSize,&XC::SupernodalSPDLinSolver::setOrderingMinSize,"assign/retrieve the size of the graph parts that are not dissected by the nested dissection ordering.")
+  .add_property("numSymbolicFactorizations",&XC::SupernodalSPDLinSolver::getNumSymbolicFactorizations,"return the number of symbolic analyses computed so far.")
+  .add_property("numSupernodes",&XC::SupernodalSPDLinSolver::getNumSupernodes,"return the number of supernodes of the factor.")
+  .add_property("factorSize",&XC::SupernodalSPDLinSolver::getFactorSize,"return the number of coefficients of the factor.")
+  ;
+
+class_<XC::KrylovPreconditioner, bases<EntCmd>, boost::noncopyable >("KrylovPreconditioner", no_init);
+
+class_<XC::JacobiPreconditioner, bases<XC::KrylovPreconditioner>, boost::noncopyable >("JacobiPreconditioner", no_init);
+
+class_<XC::ILUPreconditioner, bases<XC::KrylovPreconditioner>, boost::noncopyable >("ILUPreconditioner", no_init)
+  .add_property("level",&XC::ILUPreconditioner::getLevel,&XC::ILUPreconditioner::setLevel,"assign/retrieve the level of fill of the incomplete factorization.")
+  .add_property("numNonZeros",&XC::ILUPreconditioner::getNumNonZeros,"return the number of coefficients of the incomplete factors.")
+  .add_property("numModifiedPivots",&XC::ILUPreconditioner::getNumModifiedPivots,"return the number of small pivots replaced in the last factorization.")
+  ;
+
+class_<XC::AMGPreconditioner, bases<XC::KrylovPreconditioner>, boost::noncopyable >("AMGPreconditioner", no_init)
+  .add_property("strengthThreshold",&XC::AMGPreconditioner::getStrengthThreshold,&XC::AMGPreconditioner::setStrengthThreshold,"assign/retrieve the threshold of the strong couplings used to form the aggregates.")
+  .add_property("blockSize",&XC::AMGPreconditioner::getBlockSize,&XC::AMGPreconditioner::setBlockSize,"assign/retrieve the number of equations of each node (they must be numbered consecutively).")
+  .add_property("maxCoarseSize",&XC::AMGPreconditioner::getMaxCoarseSize,&XC::AMGPreconditioner::setMaxCoarseSize,"assign/retrieve the maximum size of the coarsest system.")
+  .add_property("maxNumLevels",&XC::AMGPreconditioner::getMaxNumLevels,&XC::AMGPreconditioner::setMaxNumLevels,"assign/retrieve the maximum number of levels.")
+  .add_property("numSweeps",&XC::AMGPreconditioner::getNumSweeps,&XC::AMGPreconditioner::setNumSweeps,"assign/retrieve the number of pre and post smoothing sweeps.")
+  .add_property("numLevels",&XC::AMGPreconditioner::getNumLevels,"return the number of levels of the multigrid hierarchy.")
+  .add_property("operatorComplexity",&XC::AMGPreconditioner::getOperatorComplexity,"return the number of coefficients of all the levels divided by the number of coefficients of the system matrix.")
+  ;
+
+class_<XC::KrylovSparseSolver, bases<XC::SparseGenRowLinSolver>, boost::noncopyable >("KrylovSparseSolver", no_init)
+  .add_property("method",make_function(&XC::KrylovSparseSolver::getMethod, return_value_policy<copy_const_reference>()),&XC::KrylovSparseSolver::setMethod,"assign/retrieve the Krylov method: 'cg', 'minres' or 'gmres'.")
+  .add_property("tolerance",&XC::KrylovSparseSolver::getTolerance,&XC::KrylovSparseSolver::setTolerance,"assign/retrieve the relative tolerance (||b-Ax||/||b||).")
+  .add_property("maxNumIter",&XC::KrylovSparseSolver::getMaxNumIter,&XC::KrylovSparseSolver::setMaxNumIter,"assign/retrieve the maximum number of iterations.")
+  .add_property("restart",&XC::KrylovSparseSolver::getRestart,&XC::KrylovSparseSolver::setRestart,"assign/retrieve the number of iterations between GMRES restarts.")
+  .add_property("numThreads",&XC::KrylovSparseSolver::getNumThreads,&XC::KrylovSparseSolver::setNumThreads,"assign/retrieve the number of threads used in the matrix-vector products.")
+  .add_property("numIterations",&XC::KrylovSparseSolver::getNumIterations,"return the number of iterations of the last solution.")
+  .add_property("residualNorm",&XC::KrylovSparseSolver::getResidualNorm,"return the relative residual of the last solution.")
+  .def("setPreconditioner",&XC::KrylovSparseSolver::setPreconditioner,return_internal_reference<>(),"setPreconditioner(name): set the preconditioner: 'none', 'jacobi', 'ilu' or 'amg'.")
+  .def("getPreconditioner",&XC::KrylovSparseSolver::getPreconditioner,return_internal_reference<>(),"return the preconditioner.")
+  ;
+
 // class_<XC::UmfpackGenLinSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("UmfpackGenLinSolver", no_init);
 
 
@@ -59,6 +59,7 @@
 #include <utility/matrix/Matrix.h>
 #include <utility/matrix/Vector.h>
 #include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/CSRGraph.h"
 #include <solution/graph/graph/Vertex.h>
 #include <solution/graph/graph/VertexIter.h>
 #include <utility/actor/channel/Channel.h>
@@ -83,10 +84,16 @@ void XC::DistributedSparseGenColLinSOE::calcNonZeros(Graph &theGraph)
       }
   }
 
+//! @brief The distributed systems need the Graph object to exchange
+//! the graphs between processes (see setSize(Graph &)).
+int XC::DistributedSparseGenColLinSOE::setSize(const CSRGraph &theGraph)
+  { return LinearSOE::setSize(theGraph); }
+
 int XC::DistributedSparseGenColLinSOE::setSize(Graph &theGraph)
   {
     int result = 0;
     int oldSize = size;
+    newGraphStamp(); // storage of A will be rebuilt.
     //int maxNumSubVertex = 0;
     static ID data(2);
 
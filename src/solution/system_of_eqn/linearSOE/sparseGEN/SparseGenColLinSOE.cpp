@@ -60,6 +60,7 @@
 #include <utility/matrix/Matrix.h>
 #include <utility/matrix/Vector.h>
 #include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/CSRGraph.h"
 #include <solution/graph/graph/Vertex.h>
 #include <solution/graph/graph/VertexIter.h>
 #include <cmath>
@@ -119,20 +120,23 @@ bool XC::SparseGenColLinSOE::setSolver(LinearSOESolver *newSolver)
 //! placing the contents of \f$i\f$ and the adjacency list into \f$rowA\f$ in
 //! ascending order. Finally, the result of invoking setSize() on
 //! the associated Solver object is returned.
-int XC::SparseGenColLinSOE::setSize(Graph &theGraph)
+int XC::SparseGenColLinSOE::setSize(const CSRGraph &theGraph)
   {
     int result = 0;
     size= checkSize(theGraph);
+    newGraphStamp(); // storage of A will be rebuilt.
 
-    // fist iterate through the vertices of the graph to get nnz
-    Vertex *theVertex;
-    int newNNZ = 0;
-    VertexIter &theVertices = theGraph.getVertices();
-    while((theVertex = theVertices()) != 0)
+    if(!theGraph.hasIndexTags())
       {
-	const std::set<int> &theAdjacency = theVertex->getAdjacency();
-	newNNZ += theAdjacency.size() +1; // the +1 is for the diag entry
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; WARNING: vertex tags must range from 0 to "
+                  << size-1 << " - size set to 0.\n";
+        size= 0;
+        return -1;
       }
+
+    // the adjacency array gives the off-diagonal entries.
+    const int newNNZ= theGraph.getAdjncy().size()+size; // +size for the diag entries
     nnz = newNNZ;
 
     if(newNNZ > A.Size())
@@ -155,46 +159,19 @@ int XC::SparseGenColLinSOE::setSize(Graph &theGraph)
     if(size != 0)
       {
         colStartA(0)= 0;
-        int startLoc = 0;
-        int lastLoc = 0;
-        for(int a=0;a<size;a++)
+        int lastLoc= 0;
+        for(int a=0; a<size; a++)
           {
-            theVertex = theGraph.getVertexPtr(a);
-	    if(theVertex == 0)
-              {
-	        std::cerr << getClassName() << "::" << __FUNCTION__
-			  << "; WARNING :"
-			  << " vertex " << a
-			  << " not in graph! - size set to 0.\n";
-	        size = 0;
-	        return -1;
-	      }
-            rowA(lastLoc++) = theVertex->getTag(); // place diag in first
-	    const std::set<int> &theAdjacency = theVertex->getAdjacency();
-	
-	    // now we have to place the entries in the ID into order in rowA
-            for(std::set<int>::const_iterator i=theAdjacency.begin(); i!=theAdjacency.end(); i++)
-              {
-                int row = *i;
-	        bool foundPlace = false;
-	        // find a place in rowA for current col
-	        for(int j=startLoc; j<lastLoc; j++)
-	          if(rowA(j) > row)
-                    { 
-	              // move the entries already there one further on
-	              // and place col in current location
-	              for(int k=lastLoc; k>j; k--)
-			rowA(k) = rowA(k-1);
-	              rowA(j) = row;
-	              foundPlace = true;
-	              j = lastLoc;
-	            }
-	        if(!foundPlace) // put in at the end
-	          rowA(lastLoc)= row;
-                lastLoc++;
-	      }
-	    colStartA(a+1)= lastLoc;;	    
-	    startLoc = lastLoc;
+            // the adjacency is sorted, so we only need to
+            // place the diagonal entry in its position.
+            const int *i= theGraph.adjacencyBegin(a);
+            const int *end= theGraph.adjacencyEnd(a);
+            for(;(i!=end) && (*i<a);i++)
+              rowA(lastLoc++)= *i;
+            rowA(lastLoc++)= a;
+            for(;i!=end;i++)
+              rowA(lastLoc++)= *i;
+            colStartA(a+1)= lastLoc;
           }
       }
     // invoke setSize() on the Solver    
@@ -210,6 +187,11 @@ int XC::SparseGenColLinSOE::setSize(Graph &theGraph)
     return result;
   }
 
+//! @brief Determines the size of the system from the graph
+//! (see setSize(const CSRGraph &)).
+int XC::SparseGenColLinSOE::setSize(Graph &theGraph)
+  { return SparseGenColLinSOE::setSize(CSRGraph(theGraph)); }
+
 //! @brief Assemblies the product fact*m into the system matrix.
 //!
 //! First tests that \p loc and \p M are of compatable sizes; if not
@@ -278,7 +260,38 @@ int XC::SparseGenColLinSOE::addA(const Matrix &m, const ID &id, double fact)
     return 0;
   }
 
-    
+//! @brief Computes the addresses in A of the coefficients of a matrix
+//! assembled at the locations \p id (see LinearSOE::fillScatterMap).
+bool XC::SparseGenColLinSOE::fillScatterMap(const ID &id, std::vector<double *> &destinations)
+  {
+    const int idSize= id.Size();
+    destinations.assign(idSize*idSize,nullptr);
+    for(int i=0; i<idSize; i++)
+      {
+	const int col= id(i);
+	if(col < size && col >= 0)
+          {
+	    const int startColLoc= colStartA(col);
+	    const int endColLoc= colStartA(col+1);
+	    for(int j=0; j<idSize; j++)
+              {
+	        const int row= id(j);
+	        if(row <size && row >= 0)
+                  {
+	            // find place in A using rowA
+	            for(int k=startColLoc; k<endColLoc; k++)
+		      if(rowA(k) == row)
+                        {
+		          destinations[i*idSize+j]= &A[k]; // m(j,i)
+		          break;
+		        }
+	          }
+	      }
+	  }
+      }
+    return true;
+  }
+
 int XC::SparseGenColLinSOE::sendSelf(CommParameters &cp)
   { return 0; }
 
@@ -145,7 +145,9 @@ class SparseGenColLinSOE : public SparseGenSOEBase
     SystemOfEqn *getCopy(void) const;
   public:
     virtual int setSize(Graph &theGraph);
+    virtual int setSize(const CSRGraph &theGraph);
     virtual int addA(const Matrix &, const ID &, double fact = 1.0);
+    virtual bool fillScatterMap(const ID &, std::vector<double *> &);
     
     virtual int sendSelf(CommParameters &);
     virtual int recvSelf(const CommParameters &);
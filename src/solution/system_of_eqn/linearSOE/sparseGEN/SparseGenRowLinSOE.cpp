@@ -58,6 +58,7 @@
 #include <utility/matrix/Matrix.h>
 #include <utility/matrix/Vector.h>
 #include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/CSRGraph.h"
 #include <solution/graph/graph/Vertex.h>
 #include <solution/graph/graph/VertexIter.h>
 #include <cmath>
@@ -80,20 +81,23 @@ bool XC::SparseGenRowLinSOE::setSolver(LinearSOESolver *newSolver)
   }
 
 //! @brief Sets the size of the system from the number of vertices in the graph.
-int XC::SparseGenRowLinSOE::setSize(Graph &theGraph)
+int XC::SparseGenRowLinSOE::setSize(const CSRGraph &theGraph)
   {
     int result = 0;
     size= checkSize(theGraph);
+    newGraphStamp(); // storage of A will be rebuilt.
 
-    // fist iterate through the vertices of the graph to get nnz
-    Vertex *theVertex;
-    int newNNZ = 0;
-    VertexIter &theVertices = theGraph.getVertices();
-    while ((theVertex = theVertices()) != 0)
+    if(!theGraph.hasIndexTags())
       {
-	const std::set<int> &theAdjacency = theVertex->getAdjacency();
-	newNNZ += theAdjacency.size() +1; // the +1 is for the diag entry
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; WARNING: vertex tags must range from 0 to "
+                  << size-1 << " - size set to 0.\n";
+        size= 0;
+        return -1;
       }
+
+    // the adjacency array gives the off-diagonal entries.
+    const int newNNZ= theGraph.getAdjncy().size()+size; // +size for the diag entries
     nnz = newNNZ;
 
     if(newNNZ > A.Size())
@@ -114,48 +118,21 @@ int XC::SparseGenRowLinSOE::setSize(Graph &theGraph)
     // fill in rowStartA and colA
     if(size != 0)
       {
-        rowStartA(0) = 0;
-        int startLoc = 0;
-        int lastLoc = 0;
+        rowStartA(0)= 0;
+        int lastLoc= 0;
         for(int a=0; a<size; a++)
           {
-            theVertex = theGraph.getVertexPtr(a);
-	if (theVertex == 0) {
-	  std::cerr << "WARNING:XC::SparseGenRowLinSOE::setSize :";
-	  std::cerr << " vertex " << a << " not in graph! - size set to 0\n";
-	  size = 0;
-	  return -1;
-	}
-
-	colA(lastLoc++) = theVertex->getTag(); // place diag in first
-	const std::set<int> &theAdjacency = theVertex->getAdjacency();
-	
-	// now we have to place the entries in the XC::ID into order in colA
-        for(std::set<int>::const_iterator i=theAdjacency.begin(); i!=theAdjacency.end(); i++)
-	  {
-
-	  int row = *i;
-	  bool foundPlace = false;
-	  // find a place in colA for current col
-	  for (int j=startLoc; j<lastLoc; j++)
-	    if (colA(j) > row) { 
-	      // move the entries already there one further on
-	      // and place col in current location
-	      for (int k=lastLoc; k>j; k--)
-		
-		colA(k) = colA(k-1);
-	      colA(j) = row;
-	      foundPlace = true;
-	      j = lastLoc;
-	    }
-	  if(foundPlace == false) // put in at the end
-	    colA(lastLoc) = row;
-
-	  lastLoc++;
-	}
-	rowStartA(a+1)= lastLoc;;	    
-	startLoc = lastLoc;
-      }
+            // the adjacency is sorted, so we only need to
+            // place the diagonal entry in its position.
+            const int *i= theGraph.adjacencyBegin(a);
+            const int *end= theGraph.adjacencyEnd(a);
+            for(;(i!=end) && (*i<a);i++)
+              colA(lastLoc++)= *i;
+            colA(lastLoc++)= a;
+            for(;i!=end;i++)
+              colA(lastLoc++)= *i;
+            rowStartA(a+1)= lastLoc;
+          }
     }
     
     // invoke setSize() on the XC::Solver   
@@ -169,6 +146,11 @@ int XC::SparseGenRowLinSOE::setSize(Graph &theGraph)
     return result;
 }
 
+//! @brief Determines the size of the system from the graph
+//! (see setSize(const CSRGraph &)).
+int XC::SparseGenRowLinSOE::setSize(Graph &theGraph)
+  { return SparseGenRowLinSOE::setSize(CSRGraph(theGraph)); }
+
 int 
 XC::SparseGenRowLinSOE::addA(const XC::Matrix &m, const XC::ID &id, double fact)
 {
@@ -227,7 +209,38 @@ XC::SparseGenRowLinSOE::addA(const XC::Matrix &m, const XC::ID &id, double fact)
     return 0;
 }
 
-    
+//! @brief Computes the addresses in A of the coefficients of a matrix
+//! assembled at the locations \p id (see LinearSOE::fillScatterMap).
+bool XC::SparseGenRowLinSOE::fillScatterMap(const ID &id, std::vector<double *> &destinations)
+  {
+    const int idSize= id.Size();
+    destinations.assign(idSize*idSize,nullptr);
+    for(int i=0; i<idSize; i++)
+      {
+        const int row= id(i);
+        if(row < size && row >= 0)
+          {
+            const int startRowLoc= rowStartA(row);
+            const int endRowLoc= rowStartA(row+1);
+            for(int j=0; j<idSize; j++)
+              {
+                const int col= id(j);
+                if(col <size && col >= 0)
+                  {
+                    // find place in A using colA
+                    for(int k=startRowLoc; k<endRowLoc; k++)
+                      if(colA(k) == col)
+                        {
+                          destinations[j*idSize+i]= &A[k]; // m(i,j)
+                          break;
+                        }
+                  }
+              }
+          }
+      }
+    return true;
+  }
+
 int XC::SparseGenRowLinSOE::sendSelf(CommParameters &cp)
   { return 0; }
 
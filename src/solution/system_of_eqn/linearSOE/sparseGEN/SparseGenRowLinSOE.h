@@ -83,11 +83,14 @@ class SparseGenRowLinSOE : public SparseGenSOEBase
     SystemOfEqn *getCopy(void) const;
   public:
     int setSize(Graph &theGraph);
+    int setSize(const CSRGraph &theGraph);
     int addA(const Matrix &, const ID &, double fact = 1.0);
+    bool fillScatterMap(const ID &, std::vector<double *> &);
     
     int sendSelf(CommParameters &);
     int recvSelf(const CommParameters &);
     friend class PetscSparseSeqSolver;    
+    friend class KrylovSparseSolver;
   };
 inline SystemOfEqn *SparseGenRowLinSOE::getCopy(void) const
   { return new SparseGenRowLinSOE(*this); }
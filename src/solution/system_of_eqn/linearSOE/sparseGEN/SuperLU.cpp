@@ -60,7 +60,9 @@
 
 #include <solution/system_of_eqn/linearSOE/sparseGEN/SuperLU.h>
 #include <solution/system_of_eqn/linearSOE/sparseGEN/SparseGenColLinSOE.h>
+#include "utility/matrix/Matrix.h"
 #include <cmath>
+#include "utility/Profiler.h"
 
 
 void XC::SuperLU::free_matricesLU(void)
@@ -236,6 +238,7 @@ int XC::SuperLU::factoriza(void)
     int retval= 0;
     if(theSOE->factored == false)
       {
+        ProfilerScope scope("LinearSOESolver::factor");
         // factor the matrix
         free_matricesLU();
         int info= 0;
@@ -333,6 +336,64 @@ int XC::SuperLU::solve(void)
     return retval;
   }
 
+//! @brief Compute the solution for several right hand sides.
+//!
+//! Each column of \p XB contains a right hand side on entry and the
+//! corresponding solution on exit. The matrix is factored (if not
+//! already factored) and the substitutions for all the columns are
+//! performed in one call to dgstrs().
+int XC::SuperLU::solve(Matrix &XB)
+  {
+    int retval= 0;
+    if(!theSOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING - no LinearSOE object has been set\n";
+        retval= -1;
+      }
+    else
+      {
+        const size_t n = theSOE->size;
+        const int nrhs= XB.noCols();
+        if((n>0) && (nrhs>0))
+          {
+            const size_t sizePerm= perm_r.Size();
+            if(sizePerm != n)
+              {
+	        std::cerr << getClassName() << "::" << __FUNCTION__
+			  << "; WARNING - size for row and col permutations"
+		          << " are 0 - has setSize() been called?\n";
+	        retval= -1;
+              }
+            else
+              {
+                const int ok= factoriza();
+                if(ok==0)
+                  {
+                    SuperMatrix XBMatrix;
+                    dCreate_Dense_Matrix(&XBMatrix, n, nrhs, XB.getDataPtr(), n, SLU_DN, SLU_D, SLU_GE);
+                    trans_t trans= NOTRANS;
+                    int info= 0;
+                    SuperLUStat_t slu_stat;
+                    StatInit(&slu_stat);
+                    dgstrs(trans, &L, &U, perm_c.getDataPtr(), perm_r.getDataPtr(), &XBMatrix, &slu_stat, &info);    
+                    StatFree(&slu_stat);
+                    Destroy_SuperMatrix_Store(&XBMatrix);
+                    if(info != 0)
+                      {        
+                        std::cerr << getClassName() << "::" << __FUNCTION__
+				  << "; WARNING - "
+				  << " error " << info << " returned in substitution dgstrs()\n";
+                        retval= -info;
+                      }
+                  }
+                else
+                  retval= ok;
+              }
+          }
+      }
+    return retval;
+  }
 
 //! @brief Set the system size.
 //! 
@@ -121,6 +121,10 @@ class SuperLU : public SparseGenColLinSolver
     ~SuperLU(void);
 
     int solve(void);
+    //! @brief The solver can solve several right hand sides at once.
+    bool canSolveMultipleRHS(void) const
+      { return true; }
+    int solve(Matrix &);
     int setSize(void);
 
     int sendSelf(CommParameters &);
@@ -49,9 +49,11 @@
 #include <utility/matrix/Matrix.h>
 #include <utility/matrix/Vector.h>
 #include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/CSRGraph.h"
 #include <solution/graph/graph/Vertex.h>
 #include <solution/graph/graph/VertexIter.h>
 #include <cmath>
+#include <algorithm>
 
 
 XC::SymSparseLinSOE::SymSparseLinSOE(AnalysisAggregation *owr,int lSparse)
@@ -129,20 +131,23 @@ XC::SymSparseLinSOE::~SymSparseLinSOE(void)
  * It is the same as the pair (ADJNCY, XADJ).
  * Then perform the symbolic factorization by calling symFactorization().
  */
-int XC::SymSparseLinSOE::setSize(Graph &theGraph)
+int XC::SymSparseLinSOE::setSize(const CSRGraph &theGraph)
   {
     int result = 0;
     size= checkSize(theGraph);
+    newGraphStamp(); // storage of A will be rebuilt.
 
-    // first iterarte through the vertices of the graph to get nnz
-    Vertex *theVertex;
-    int newNNZ = 0;
-    VertexIter &theVertices = theGraph.getVertices();
-    while((theVertex = theVertices()) != 0)
+    if(!theGraph.hasIndexTags())
       {
-        const std::set<int> &theAdjacency = theVertex->getAdjacency();
-	newNNZ += theAdjacency.size(); 
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; WARNING: vertex tags must range from 0 to "
+                  << size-1 << " - size set to 0.\n";
+        size= 0;
+        return -1;
       }
+
+    // the adjacency array gives the off-diagonal entries.
+    const int newNNZ= theGraph.getAdjncy().size();
     nnz = newNNZ;
  
     colA= ID(newNNZ);	
@@ -166,47 +171,15 @@ int XC::SymSparseLinSOE::setSize(Graph &theGraph)
     // fill in rowStartA and colA
     if(size != 0)
       {
-        rowStartA(0) = 0;
-        int startLoc = 0;
-	int lastLoc = 0;
-
-	for (int a=0; a<size; a++) {
-	   theVertex = theGraph.getVertexPtr(a);
-	   if(theVertex == 0) {
-	        std::cerr << "WARNING:XC::SymSparseLinSOE::setSize :";
-	        std::cerr << " vertex " << a << " not in graph! - size set to 0\n";
-	        size = 0;
-	        return -1;
-	   }
-
-	   const std::set<int> &theAdjacency = theVertex->getAdjacency();
-	
-	// now we have to place the entries in the ID into order in colA
-           for(std::set<int>::const_iterator i=theAdjacency.begin(); i!=theAdjacency.end(); i++)
-  	     {
-	      const int row= *i;
-	      bool foundPlace = false;
-	 
-	      for (int j=startLoc; j<lastLoc; j++)
-		if(colA(j) > row) { 
-	      // move the entries already there one further on
-	      // and place col in current location
-	              for (int k=lastLoc; k>j; k--)
-			colA(k)= colA(k-1);
-                      colA(j) = row;
-		      foundPlace = true;
-    	              j = lastLoc;
-		  }
-		  
-	      if(foundPlace == false) // put in at the end
-		colA(lastLoc) = row;
-
-	      lastLoc++;
-	   }
-	   rowStartA(a+1)= lastLoc;	    
-	   startLoc = lastLoc;
-	}
-    }
+        // the compressed graph is already sorted
+        // (without the diagonal entries).
+        const std::vector<int> &xadj= theGraph.getXAdj();
+        const std::vector<int> &adjncy= theGraph.getAdjncy();
+        for(int a=0; a<=size; a++)
+          rowStartA(a)= xadj[a];
+        for(int k=0; k<newNNZ; k++)
+          colA(k)= adjncy[k];
+      }
     
     // call "C" function to form elimination tree and to do the symbolic factorization.
     nblks = symFactorization(rowStartA.getDataPtr(), colA.getDataPtr(), size, this->LSPARSE,
@@ -215,6 +188,11 @@ int XC::SymSparseLinSOE::setSize(Graph &theGraph)
     return result;
 }
 
+//! @brief Determines the size of the system from the graph
+//! (see setSize(const CSRGraph &)).
+int XC::SymSparseLinSOE::setSize(Graph &theGraph)
+  { return SymSparseLinSOE::setSize(CSRGraph(theGraph)); }
+
 
 /* Perform the element stiffness assembly here.
  */
@@ -364,6 +342,69 @@ int XC::SymSparseLinSOE::addA(const XC::Matrix &in_m, const XC::ID &in_id, doubl
     return 0;
   }
 
+//! @brief Computes the addresses in the profile (diag, penv and the
+//! off-diagonal blocks) of the coefficients of a matrix assembled at the
+//! locations \p in_id (see LinearSOE::fillScatterMap). As in addA
+//! only the upper triangle of the matrix is assembled.
+bool XC::SymSparseLinSOE::fillScatterMap(const ID &in_id, std::vector<double *> &destinations)
+  {
+    const int n= in_id.Size();
+    destinations.assign(n*n,nullptr);
+
+    // positions of the non-negative id values.
+    std::vector<int> orig;
+    orig.reserve(n);
+    for(int ii= 0; ii < n; ii++)
+      if(in_id(ii) >= 0 && in_id(ii) < size)
+        orig.push_back(ii);
+    const int lnee= orig.size();
+    if(lnee == 0)
+      return true;
+
+    // equation numbers after reordering (invp) and
+    // sorting of the positions by those numbers.
+    std::vector<int> newID(lnee);
+    std::vector<int> isort(lnee);
+    for(int kk= 0; kk<lnee; kk++)
+      {
+        newID[kk]= invp[in_id(orig[kk])];
+        isort[kk]= kk;
+      }
+    std::stable_sort(isort.begin(),isort.end(),[&newID](const int &a,const int &b){ return newID[a]<newID[b]; });
+
+    int k= rowblks[newID[isort[0]]];
+    OFFDBLK *saveblk= begblk[k];
+    for(int i= 0; i<lnee; i++)
+      { 
+        const int ipos= isort[i];
+        const int i_eq= newID[ipos];
+        const int iblk= rowblks[i_eq];
+        double *iloc= penv[i_eq +1] - i_eq;
+        if(k < iblk)
+          while(saveblk->row != i_eq) saveblk= saveblk->bnext;
+	 
+        OFFDBLK *ptr= saveblk;
+        for(int j= 0; j< i; j++)
+          {   
+            const int jpos= isort[j];
+            const int j_eq= newID[jpos];
+            const int it= std::min(ipos,jpos);
+            const int jt= std::max(ipos,jpos);
+            double *loc= nullptr;
+            if(j_eq >= xblk[iblk]) // diagonal block (profile)
+              loc= iloc + j_eq;
+            else // row segment
+              { 
+                while((j_eq >= (ptr->next)->beg) && ((ptr->next)->row == i_eq))
+                  ptr= ptr->next;
+                loc= ptr->nz + (j_eq - ptr->beg);
+              }
+            destinations[orig[jt]*n+orig[it]]= loc; // in_m(orig[it],orig[jt])
+          }
+        destinations[orig[ipos]*n+orig[ipos]]= diag+i_eq; // diagonal element
+      }
+    return true;
+  }
     
 /* assemble the force vector B (A*X = B).
  */
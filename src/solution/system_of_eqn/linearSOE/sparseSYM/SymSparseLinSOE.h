@@ -79,7 +79,9 @@ class SymSparseLinSOE : public SparseSOEBase
     ~SymSparseLinSOE(void);
 
     int setSize(Graph &theGraph);
+    int setSize(const CSRGraph &theGraph);
     int addA(const Matrix &, const ID &, double fact = 1.0);
+    bool fillScatterMap(const ID &, std::vector<double *> &);
     int addB(const Vector &, const ID &,const double &fact= 1.0);    
     
     void zeroA(void);
@@ -0,0 +1,205 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SupernodalSPDLinSOE.cc
+
+#include "SupernodalSPDLinSOE.h"
+#include "SupernodalSPDLinSolver.h"
+#include <utility/matrix/Matrix.h>
+#include <utility/matrix/Vector.h>
+#include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/CSRGraph.h"
+#include <algorithm>
+
+//! @brief Constructor.
+//!
+//! @param owr: analysis aggregation that owns this object.
+XC::SupernodalSPDLinSOE::SupernodalSPDLinSOE(AnalysisAggregation *owr)
+  :SparseSOEBase(owr,LinSOE_TAGS_SupernodalSPDLinSOE) {}
+
+//! @brief Set the solver to use (must be a SupernodalSPDLinSolver).
+bool XC::SupernodalSPDLinSOE::setSolver(LinearSOESolver *newSolver)
+  {
+    bool retval= false;
+    SupernodalSPDLinSolver *tmp= dynamic_cast<SupernodalSPDLinSolver *>(newSolver);
+    if(tmp)
+      retval= SparseSOEBase::setSolver(tmp);
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; solver type incompatible with this system of equations."
+		<< std::endl;
+    return retval;
+  }
+
+//! @brief Sets the size of the system from the graph.
+//!
+//! The graph vertices must be labelled from \f$0\f$ to
+//! \f$size-1\f$. If the sparsity pattern is the same that the one of
+//! the previous call, the storage is kept (only zeroed) so the
+//! symbolic factorization computed by the solver remains valid. Otherwise
+//! the storage for the lower triangle of \f$A\f$ is rebuilt.
+int XC::SupernodalSPDLinSOE::setSize(const CSRGraph &theGraph)
+  {
+    const int newSize= checkSize(theGraph);
+    if(!theGraph.hasIndexTags())
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; WARNING: vertex tags must range from 0 to "
+                  << newSize-1 << " - size set to 0.\n";
+        size= 0;
+        return -1;
+      }
+    const bool samePattern= (newSize==size) && (B.Size()==size) && (theGraph.getXAdj()==xadj) && (theGraph.getAdjncy()==adjncy);
+    if(!samePattern)
+      {
+        size= newSize;
+        newGraphStamp(); // storage of A will be rebuilt.
+        xadj= theGraph.getXAdj();
+        adjncy= theGraph.getAdjncy();
+        nnz= adjncy.size()/2+size; // lower triangle and diagonal.
+        A.resize(nnz);
+        rowA.resize(nnz);
+        colStartA.resize(size+1);
+        inic(size);
+        // fill in colStartA and rowA (the adjacency is sorted).
+        int lastLoc= 0;
+        for(int j= 0;j<size;j++)
+          {
+            colStartA(j)= lastLoc;
+            rowA(lastLoc++)= j;
+            for(const int *i= theGraph.adjacencyBegin(j);i!=theGraph.adjacencyEnd(j);i++)
+              if(*i>j)
+                rowA(lastLoc++)= *i;
+          }
+        colStartA(size)= lastLoc;
+      }
+    A.Zero();
+    zeroB();
+    zeroX();
+    factored= false;
+
+    // invoke setSize() on the Solver
+    LinearSOESolver *the_Solver= getSolver();
+    if(the_Solver)
+      {
+        const int solverOK= the_Solver->setSize();
+        if(solverOK < 0)
+          {
+	    std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; WARNING: solver failed setSize()\n";
+	    return solverOK;
+          }
+      }
+    return 0;
+  }
+
+//! @brief Determines the size of the system from the graph
+//! (see setSize(const CSRGraph &)).
+int XC::SupernodalSPDLinSOE::setSize(Graph &theGraph)
+  { return SupernodalSPDLinSOE::setSize(CSRGraph(theGraph)); }
+
+//! @brief Return the position in A of the coefficient (row,col)
+//! of the lower triangle (-1 if it's not stored).
+int XC::SupernodalSPDLinSOE::findLoc(const int &row,const int &col) const
+  {
+    const int *begin= &rowA(0)+colStartA(col);
+    const int *end= &rowA(0)+colStartA(col+1);
+    const int *i= std::lower_bound(begin,end,row);
+    if((i!=end) && (*i==row))
+      return i-&rowA(0);
+    return -1;
+  }
+
+//! @brief Assemblies the product fact*m into the system matrix.
+//!
+//! Only the coefficients of the lower triangle are assembled
+//! (the matrix \p m is supposed to be symmetric).
+int XC::SupernodalSPDLinSOE::addA(const Matrix &m, const ID &id, double fact)
+  {
+    if(fact == 0.0)  
+      return 0;
+    const int idSize= id.Size();
+    if(idSize != m.noRows() && idSize != m.noCols())
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; Matrix and ID not of similar sizes\n";
+	return -1;
+      }
+    for(int i= 0; i<idSize; i++)
+      {
+	const int col= id(i);
+	if(col < size && col >= 0)
+          {
+	    for(int j= 0; j<idSize; j++)
+              {
+	        const int row= id(j);
+	        if(row < size && row >= col)
+                  {
+                    const int k= findLoc(row,col);
+                    if(k>=0)
+                      A[k]+= fact*m(j,i);
+                  }
+              }
+          }
+      }
+    factored= false;
+    return 0;
+  }
+
+//! @brief Computes the addresses in A of the coefficients of a matrix
+//! assembled at the locations \p id (see LinearSOE::fillScatterMap).
+//! As in addA only the lower triangle is assembled.
+bool XC::SupernodalSPDLinSOE::fillScatterMap(const ID &id, std::vector<double *> &destinations)
+  {
+    const int idSize= id.Size();
+    destinations.assign(idSize*idSize,nullptr);
+    for(int i= 0; i<idSize; i++)
+      {
+	const int col= id(i);
+	if(col < size && col >= 0)
+          {
+	    for(int j= 0; j<idSize; j++)
+              {
+	        const int row= id(j);
+	        if(row < size && row >= col)
+                  {
+                    const int k= findLoc(row,col);
+                    if(k>=0)
+                      destinations[i*idSize+j]= &A[k]; // m(j,i)
+                  }
+              }
+          }
+      }
+    return true;
+  }
+
+//! @brief Zeroes the matrix and marks the system as not factored.
+void XC::SupernodalSPDLinSOE::zeroA(void)
+  {
+    A.Zero();
+    factored= false;
+  }
+
+int XC::SupernodalSPDLinSOE::sendSelf(CommParameters &cp)
+  { return 0; }
+
+int XC::SupernodalSPDLinSOE::recvSelf(const CommParameters &cp)  
+  { return 0; }
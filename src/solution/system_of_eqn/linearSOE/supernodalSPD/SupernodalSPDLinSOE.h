@@ -0,0 +1,81 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SupernodalSPDLinSOE.h
+
+#ifndef SupernodalSPDLinSOE_h
+#define SupernodalSPDLinSOE_h
+
+#include <solution/system_of_eqn/linearSOE/SparseSOEBase.h>
+#include "utility/matrix/ID.h"
+#include <vector>
+
+namespace XC {
+class SupernodalSPDLinSolver;
+
+//! @ingroup SOE
+//
+//! @brief Sparse symmetric positive definite system of equations
+//! solved by supernodal Cholesky factorization.
+//!
+//! The lower triangle of \f$A\f$ (diagonal included) is stored by
+//! columns in the original equation numbering: the coefficients of
+//! column \f$j\f$ are in A[colStartA(j)] ... A[colStartA(j+1)-1] and their
+//! row indexes (in ascending order, so the diagonal comes first) in
+//! rowA. The adjacency of the graph used to size the system is kept,
+//! so the solver can compute the fill reducing ordering and the
+//! symbolic factorization from it. If the system is sized again with
+//! a graph that has the same sparsity pattern, the storage (and the
+//! graph stamp) are kept and the solver reuses its symbolic analysis.
+class SupernodalSPDLinSOE : public SparseSOEBase
+  {
+  private:
+    Vector A; //!< lower triangle coefficients of the matrix.
+    ID colStartA; //!< start of each column in A (size: size+1).
+    ID rowA; //!< row index of each coefficient in A.
+    std::vector<int> xadj; //!< adjacency pointers of the graph.
+    std::vector<int> adjncy; //!< adjacency of the graph.
+
+    int findLoc(const int &,const int &) const;
+  protected:
+    virtual bool setSolver(LinearSOESolver *);
+
+    friend class AnalysisAggregation;
+    friend class FEM_ObjectBroker;
+    SupernodalSPDLinSOE(AnalysisAggregation *);
+    SystemOfEqn *getCopy(void) const;
+  public:
+    int setSize(Graph &theGraph);
+    int setSize(const CSRGraph &theGraph);
+    int addA(const Matrix &, const ID &, double fact = 1.0);
+    bool fillScatterMap(const ID &, std::vector<double *> &);
+    void zeroA(void);
+
+    int sendSelf(CommParameters &);
+    int recvSelf(const CommParameters &);
+
+    friend class SupernodalSPDLinSolver;
+  };
+inline SystemOfEqn *SupernodalSPDLinSOE::getCopy(void) const
+  { return new SupernodalSPDLinSOE(*this); }
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,702 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SupernodalSPDLinSolver.cc
+
+#include "SupernodalSPDLinSolver.h"
+#include "SupernodalSPDLinSOE.h"
+#include "solution/graph/numberer/NestedDissection.h"
+#include "utility/matrix/Matrix.h"
+#include "utility/Profiler.h"
+#include <algorithm>
+#include <thread>
+#include <cmath>
+
+extern "C" int dpotrf_(char *UPLO, int *N, double *A, int *LDA, int *INFO);
+
+extern "C" void dtrsm_(char *SIDE, char *UPLO, char *TRANSA, char *DIAG,
+		       int *M, int *N, double *ALPHA, double *A, int *LDA,
+		       double *B, int *LDB);
+
+extern "C" void dsyrk_(char *UPLO, char *TRANS, int *N, int *K,
+		       double *ALPHA, double *A, int *LDA, double *BETA,
+		       double *C, int *LDC);
+
+extern "C" void dgemm_(char *TRANSA, char *TRANSB, int *M, int *N, int *K,
+		       double *ALPHA, double *A, int *LDA, double *B, int *LDB,
+		       double *BETA, double *C, int *LDC);
+
+//! @brief Minimum number of floating point operations of a dense
+//! update to split it between the threads.
+static const double minParallelWork= 2e6;
+
+//! @brief Constructor.
+XC::SupernodalSPDLinSolver::SupernodalSPDLinSolver(void)
+  :LinearSOESolver(SOLVER_TAGS_SupernodalSPDLinSolver), theSOE(nullptr),
+   workers(std::max(1U,std::thread::hardware_concurrency())), ndMinSize(32),
+   symbolicStamp(0), numSymbolic(0) {}
+
+//! @brief Virtual constructor.
+XC::LinearSOESolver *XC::SupernodalSPDLinSolver::getCopy(void) const
+   { return new SupernodalSPDLinSolver(*this); }
+
+//! @brief Sets the system of equations to solve.
+bool XC::SupernodalSPDLinSolver::setLinearSOE(LinearSOE *soe)
+  {
+    bool retval= false;
+    SupernodalSPDLinSOE *tmp= dynamic_cast<SupernodalSPDLinSOE *>(soe);
+    if(tmp)
+      {
+        theSOE= tmp;
+        symbolicStamp= 0;
+        retval= true;
+      }
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; system of equations of wrong type." << std::endl;
+    return retval;
+  }
+
+//! @brief Set the number of threads used in the numeric factorization.
+void XC::SupernodalSPDLinSolver::setNumThreads(const size_t &n)
+  {
+    workers.setNumThreads(n);
+    if(getNumSupernodes()>0)
+      schedule();
+  }
+
+//! @brief Return the number of coefficients of the factor (lower
+//! triangle of the supernode blocks).
+size_t XC::SupernodalSPDLinSolver::getFactorSize(void) const
+  {
+    size_t retval= 0;
+    const int nsuper= getNumSupernodes();
+    for(int s= 0;s<nsuper;s++)
+      {
+        const size_t w= getSupernodeWidth(s);
+        retval+= w*getSupernodeHeight(s)-w*(w-1)/2;
+      }
+    return retval;
+  }
+
+//! @brief Estimated number of floating point operations to factor
+//! the frontal matrix of the supernode.
+double XC::SupernodalSPDLinSolver::getWork(const int &s) const
+  {
+    const double w= getSupernodeWidth(s);
+    const double mu= getSupernodeHeight(s)-w;
+    return w*w*w/3.0+w*w*mu+w*mu*mu;
+  }
+
+//! @brief Distributes the supernodal elimination tree between
+//! the threads.
+//!
+//! The heaviest subtree is replaced by its children (its root goes
+//! to the top part of the tree, factored after the subtrees) until
+//! the work of the heaviest subtree doesn't exceed the average work by
+//! thread. The subtrees are then assigned to the threads starting
+//! with the heaviest one.
+void XC::SupernodalSPDLinSolver::schedule(void)
+  {
+    const int nsuper= getNumSupernodes();
+    subtrees.clear();
+    topSupernodes.clear();
+    const size_t numThreads= getNumThreads();
+    if(numThreads<2)
+      {
+        subtrees.resize(1);
+        for(int s= 0;s<nsuper;s++)
+          subtrees[0].push_back(s);
+        return;
+      }
+    // supernodes are numbered in postorder: the descendants of s
+    // are firstDescendant[s]..s-1.
+    std::vector<double> subtreeWork(nsuper,0.0);
+    std::vector<int> firstDescendant(nsuper);
+    for(int s= 0;s<nsuper;s++)
+      {
+        subtreeWork[s]+= getWork(s);
+        firstDescendant[s]= s;
+        for(int k= childStart[s];k<childStart[s+1];k++)
+          firstDescendant[s]= std::min(firstDescendant[s],firstDescendant[children[k]]);
+        const int p= superParent[s];
+        if(p>=0)
+          subtreeWork[p]+= subtreeWork[s];
+      }
+    std::vector<int> pool;
+    for(int s= 0;s<nsuper;s++)
+      if(superParent[s]<0)
+        pool.push_back(s);
+    std::vector<bool> isTop(nsuper,false);
+    while(!pool.empty())
+      {
+        double total= 0.0;
+        size_t h= 0;
+        for(size_t i= 0;i<pool.size();i++)
+          {
+            total+= subtreeWork[pool[i]];
+            if(subtreeWork[pool[i]]>subtreeWork[pool[h]])
+              h= i;
+          }
+        const int root= pool[h];
+        if(childStart[root]==childStart[root+1])
+          break;
+        if((pool.size()>=numThreads) && (subtreeWork[root]*numThreads<=total))
+          break;
+        isTop[root]= true;
+        pool.erase(pool.begin()+h);
+        for(int k= childStart[root];k<childStart[root+1];k++)
+          pool.push_back(children[k]);
+      }
+    std::sort(pool.begin(),pool.end(),[&subtreeWork](const int &a,const int &b){ return subtreeWork[a]>subtreeWork[b]; });
+    const size_t nt= std::min(numThreads,pool.size());
+    subtrees.resize(nt);
+    std::vector<double> load(nt,0.0);
+    for(std::vector<int>::const_iterator i= pool.begin();i!=pool.end();i++)
+      {
+        const size_t t= std::min_element(load.begin(),load.end())-load.begin();
+        load[t]+= subtreeWork[*i];
+        for(int s= firstDescendant[*i];s<=*i;s++)
+          subtrees[t].push_back(s);
+      }
+    for(int s= 0;s<nsuper;s++)
+      if(isTop[s])
+        topSupernodes.push_back(s);
+  }
+
+//! @brief Symbolic analysis of the system.
+//!
+//! Computes the nested dissection ordering, the elimination tree
+//! and its postordering, the structure of the columns of the factor,
+//! the fundamental supernodes, the storage of the factor and the
+//! positions where the coefficients of A are assembled.
+int XC::SupernodalSPDLinSolver::symbolic(void)
+  {
+    const int n= theSOE->size;
+    const std::vector<int> &xadj= theSOE->xadj;
+    const std::vector<int> &adjncy= theSOE->adjncy;
+
+    // fill reducing ordering.
+    NestedDissection nd(ndMinSize);
+    const std::vector<int> p0= nd.getPermutation(xadj,adjncy);
+    std::vector<int> invp0(n);
+    for(int k= 0;k<n;k++)
+      invp0[p0[k]]= k;
+
+    // elimination tree (with path compression).
+    std::vector<int> parent0(n,-1);
+    std::vector<int> ancestor(n,-1);
+    for(int k= 0;k<n;k++)
+      {
+        const int o= p0[k];
+        for(int q= xadj[o];q<xadj[o+1];q++)
+          {
+            int r= invp0[adjncy[q]];
+            if(r>=k)
+              continue;
+            while((ancestor[r]!=-1) && (ancestor[r]!=k))
+              {
+                const int next= ancestor[r];
+                ancestor[r]= k;
+                r= next;
+              }
+            if(ancestor[r]==-1)
+              {
+                ancestor[r]= k;
+                parent0[r]= k;
+              }
+          }
+      }
+
+    // postordering of the elimination tree.
+    std::vector<int> head(n,-1), next(n,-1);
+    for(int v= n-1;v>=0;v--)
+      if(parent0[v]>=0)
+        {
+          next[v]= head[parent0[v]];
+          head[parent0[v]]= v;
+        }
+    std::vector<int> post;
+    post.reserve(n);
+    std::vector<int> stack;
+    for(int r= 0;r<n;r++)
+      if(parent0[r]<0)
+        {
+          stack.push_back(r);
+          while(!stack.empty())
+            {
+              const int v= stack.back();
+              const int c= head[v];
+              if(c==-1)
+                {
+                  stack.pop_back();
+                  post.push_back(v);
+                }
+              else
+                {
+                  head[v]= next[c];
+                  stack.push_back(c);
+                }
+            }
+        }
+    std::vector<int> ipost(n);
+    for(int k= 0;k<n;k++)
+      ipost[post[k]]= k;
+    perm.resize(n);
+    std::vector<int> invp(n);
+    std::vector<int> parent(n);
+    for(int k= 0;k<n;k++)
+      {
+        perm[k]= p0[post[k]];
+        invp[perm[k]]= k;
+        const int p= parent0[post[k]];
+        parent[k]= (p<0 ? -1 : ipost[p]);
+      }
+
+    // column structures and fundamental supernodes.
+    std::vector<int> numChildren(n,0);
+    std::fill(head.begin(),head.end(),-1);
+    for(int v= n-1;v>=0;v--)
+      if(parent[v]>=0)
+        {
+          numChildren[parent[v]]++;
+          next[v]= head[parent[v]];
+          head[parent[v]]= v;
+        }
+    std::vector<std::vector<int> > colStruct(n);
+    std::vector<int> colCount(n,0);
+    std::vector<bool> isFirst(n,false);
+    std::vector<int> mark(n,-1);
+    superStart.clear();
+    for(int j= 0;j<n;j++)
+      {
+        std::vector<int> &st= colStruct[j];
+        mark[j]= j;
+        const int o= perm[j];
+        for(int q= xadj[o];q<xadj[o+1];q++)
+          {
+            const int i= invp[adjncy[q]];
+            if((i>j) && (mark[i]!=j))
+              {
+                mark[i]= j;
+                st.push_back(i);
+              }
+          }
+        for(int c= head[j];c!=-1;c= next[c])
+          {
+            for(std::vector<int>::const_iterator i= colStruct[c].begin();i!=colStruct[c].end();i++)
+              if((*i>j) && (mark[*i]!=j))
+                {
+                  mark[*i]= j;
+                  st.push_back(*i);
+                }
+            if(!isFirst[c])
+              std::vector<int>().swap(colStruct[c]);
+          }
+        std::sort(st.begin(),st.end());
+        colCount[j]= st.size()+1;
+        const bool sameSupernode= (j>0) && (parent[j-1]==j) && (numChildren[j]==1) && (colCount[j]==colCount[j-1]-1);
+        if(!sameSupernode)
+          {
+            isFirst[j]= true;
+            superStart.push_back(j);
+          }
+      }
+    superStart.push_back(n);
+    const int nsuper= getNumSupernodes();
+
+    // supernode rows, tree and storage.
+    std::vector<int> colSuper(n);
+    rowStart.assign(nsuper+1,0);
+    rowInd.clear();
+    lStart.assign(nsuper+1,0);
+    for(int s= 0;s<nsuper;s++)
+      {
+        const int f= superStart[s];
+        for(int j= f;j<superStart[s+1];j++)
+          colSuper[j]= s;
+        rowStart[s]= rowInd.size();
+        rowInd.push_back(f);
+        rowInd.insert(rowInd.end(),colStruct[f].begin(),colStruct[f].end());
+        std::vector<int>().swap(colStruct[f]);
+        rowStart[s+1]= rowInd.size();
+        lStart[s+1]= lStart[s]+size_t(getSupernodeWidth(s))*getSupernodeHeight(s);
+      }
+    superParent.assign(nsuper,-1);
+    childStart.assign(nsuper+1,0);
+    for(int s= 0;s<nsuper;s++)
+      {
+        const int p= parent[superStart[s+1]-1];
+        if(p>=0)
+          {
+            superParent[s]= colSuper[p];
+            childStart[superParent[s]+1]++;
+          }
+      }
+    for(int s= 0;s<nsuper;s++)
+      childStart[s+1]+= childStart[s];
+    children.resize(childStart[nsuper]);
+    std::vector<int> fill(childStart.begin(),childStart.end()-1);
+    for(int s= 0;s<nsuper;s++)
+      if(superParent[s]>=0)
+        children[fill[superParent[s]]++]= s;
+
+    // positions of the coefficients of A in the factor.
+    const ID &colStartA= theSOE->colStartA;
+    const ID &rowA= theSOE->rowA;
+    assemblyStart.assign(nsuper+1,0);
+    for(int jo= 0;jo<n;jo++)
+      for(int k= colStartA(jo);k<colStartA(jo+1);k++)
+        {
+          const int c= std::min(invp[rowA(k)],invp[jo]);
+          assemblyStart[colSuper[c]+1]++;
+        }
+    for(int s= 0;s<nsuper;s++)
+      assemblyStart[s+1]+= assemblyStart[s];
+    assemblyEntry.resize(assemblyStart[nsuper]);
+    assemblyPos.resize(assemblyStart[nsuper]);
+    fill.assign(assemblyStart.begin(),assemblyStart.end()-1);
+    for(int jo= 0;jo<n;jo++)
+      for(int k= colStartA(jo);k<colStartA(jo+1);k++)
+        {
+          const int in= invp[rowA(k)];
+          const int jn= invp[jo];
+          const int c= std::min(in,jn);
+          const int r= std::max(in,jn);
+          const int s= colSuper[c];
+          const int *rowsBegin= &rowInd[rowStart[s]];
+          const int *rowsEnd= &rowInd[0]+rowStart[s+1];
+          const int lrow= std::lower_bound(rowsBegin,rowsEnd,r)-rowsBegin;
+          const int pos= fill[s]++;
+          assemblyEntry[pos]= k;
+          assemblyPos[pos]= lStart[s]+size_t(c-superStart[s])*getSupernodeHeight(s)+lrow;
+        }
+    schedule();
+    Lx.clear();
+    updates.clear();
+    symbolicStamp= theSOE->getGraphStamp();
+    numSymbolic++;
+    return 0;
+  }
+
+//! @brief Factors the frontal matrix of the supernode \p s: assembles
+//! the coefficients of A and the update matrices of its children, computes
+//! the Cholesky factor of the supernode columns and the update
+//! matrix for its parent.
+//!
+//! @param s: supernode to factor.
+//! @param relPos: work array (size: number of equations).
+//! @param nThreads: number of threads used in the dense updates (if
+//! greater than one, the threads of the solver; the subtrees factored
+//! concurrently use one).
+//! @return 0 if ok, otherwise the position (one based) of the non
+//! positive pivot.
+int XC::SupernodalSPDLinSolver::factor_supernode(const int &s,std::vector<int> &relPos,const size_t &nThreads)
+  {
+    int w= getSupernodeWidth(s);
+    int m= getSupernodeHeight(s);
+    int mu= m-w;
+    const int *rows= &rowInd[rowStart[s]];
+    double *L= &Lx[lStart[s]];
+    std::fill(L,L+size_t(m)*w,0.0);
+    std::vector<double> &U= updates[s];
+    U.assign(size_t(mu)*mu,0.0);
+
+    // coefficients of A.
+    const double *A= theSOE->A.getDataPtr();
+    for(int k= assemblyStart[s];k<assemblyStart[s+1];k++)
+      Lx[assemblyPos[k]]+= A[assemblyEntry[k]];
+
+    // update matrices of the children (extend-add).
+    for(int p= 0;p<m;p++)
+      relPos[rows[p]]= p;
+    for(int k= childStart[s];k<childStart[s+1];k++)
+      {
+        const int c= children[k];
+        const int wc= getSupernodeWidth(c);
+        const int muc= getSupernodeHeight(c)-wc;
+        const int *crows= &rowInd[rowStart[c]+wc];
+        const std::vector<double> &Uc= updates[c];
+        for(int jj= 0;jj<muc;jj++)
+          {
+            const int pj= relPos[crows[jj]];
+            const double *ucol= &Uc[size_t(jj)*muc];
+            if(pj<w)
+              {
+                double *lcol= L+size_t(pj)*m;
+                for(int ii= jj;ii<muc;ii++)
+                  lcol[relPos[crows[ii]]]+= ucol[ii];
+              }
+            else
+              {
+                double *col= &U[size_t(pj-w)*mu]-w;
+                for(int ii= jj;ii<muc;ii++)
+                  col[relPos[crows[ii]]]+= ucol[ii];
+              }
+          }
+        std::vector<double>().swap(updates[c]);
+      }
+
+    // dense factorization of the frontal matrix.
+    char lo[]= "L", no[]= "N", tr[]= "T", ri[]= "R";
+    double one= 1.0, minusOne= -1.0;
+    int info= 0;
+    dpotrf_(lo,&w,L,&m,&info);
+    if(info!=0)
+      return superStart[s]+info;
+    if(mu>0)
+      {
+        double *L21= L+w;
+        const bool parallel= (nThreads>1) && (double(w)*w*mu>minParallelWork);
+        // L21= L21*L11^-T (the rows are independent).
+        if(parallel)
+          workers.run_blocks([&](const size_t &begin,const size_t &end)
+                       {
+                         int mr= end-begin;
+                         if(mr>0)
+                           dtrsm_(ri,lo,tr,no,&mr,&w,&one,L,&m,L21+begin,&m);
+                       },mu);
+        else
+          dtrsm_(ri,lo,tr,no,&mu,&w,&one,L,&m,L21,&m);
+        // U-= L21*L21^T (lower triangle).
+        if(parallel && (double(w)*mu*mu>minParallelWork))
+          {
+            // column blocks with similar number of coefficients.
+            std::vector<int> bounds(nThreads+1,mu);
+            for(size_t t= 0;t<nThreads;t++)
+              bounds[t]= int(mu*(1.0-std::sqrt(1.0-double(t)/nThreads)));
+            workers.run_blocks([&](const size_t &begin,const size_t &end)
+                         {
+                           for(size_t t= begin;t<end;t++)
+                             {
+                               const int c0= bounds[t];
+                               int nc= bounds[t+1]-c0;
+                               if(nc<=0)
+                                 continue;
+                               double *Ud= &U[size_t(c0)*mu+c0];
+                               dsyrk_(lo,no,&nc,&w,&minusOne,L21+c0,&m,&one,Ud,&mu);
+                               int nr= mu-bounds[t+1];
+                               if(nr>0)
+                                 dgemm_(no,tr,&nr,&nc,&w,&minusOne,L21+bounds[t+1],&m,L21+c0,&m,&one,Ud+nc,&mu);
+                             }
+                         },nThreads);
+          }
+        else
+          dsyrk_(lo,no,&mu,&w,&minusOne,L21,&m,&one,&U[0],&mu);
+      }
+    return 0;
+  }
+
+//! @brief Numeric factorization of the system matrix.
+//!
+//! The symbolic analysis is computed again only if the sparsity
+//! pattern of the system has changed.
+int XC::SupernodalSPDLinSolver::factor(void)
+  {
+    ProfilerScope scope("LinearSOESolver::factor");
+    if((symbolicStamp==0) || (symbolicStamp!=theSOE->getGraphStamp()))
+      symbolic();
+    const int nsuper= getNumSupernodes();
+    const int n= theSOE->size;
+    Lx.resize(lStart[nsuper]);
+    updates.clear();
+    updates.resize(nsuper);
+
+    const size_t nSub= subtrees.size();
+    std::vector<int> errors(std::max(nSub,size_t(1)),0);
+    if(nSub>1)
+      workers.run_blocks([&](const size_t &begin,const size_t &end)
+                   {
+                     std::vector<int> relPos(n);
+                     for(size_t t= begin;t<end;t++)
+                       for(std::vector<int>::const_iterator i= subtrees[t].begin();i!=subtrees[t].end();i++)
+                         {
+                           errors[t]= factor_supernode(*i,relPos,1);
+                           if(errors[t])
+                             return;
+                         }
+                   },nSub);
+    std::vector<int> relPos(n);
+    int info= *std::max_element(errors.begin(),errors.end());
+    if((info==0) && (nSub==1))
+      for(std::vector<int>::const_iterator i= subtrees[0].begin();(i!=subtrees[0].end()) && (info==0);i++)
+        info= factor_supernode(*i,relPos,getNumThreads());
+    for(std::vector<int>::const_iterator i= topSupernodes.begin();(i!=topSupernodes.end()) && (info==0);i++)
+      info= factor_supernode(*i,relPos,getNumThreads());
+    updates.clear();
+    if(info!=0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; the matrix is not positive definite (non positive"
+                  << " pivot at equation: " << perm[info-1] << ").\n";
+        return -info;
+      }
+    theSOE->factored= true;
+    return 0;
+  }
+
+//! @brief Forward and backward substitution.
+//!
+//! @param Y: right hand sides (in the factor ordering) on entry,
+//! solutions on exit.
+//! @param nrhs: number of right hand sides.
+//! @param ldy: leading dimension of Y.
+void XC::SupernodalSPDLinSolver::triangular_solves(double *Y,const int &nrhs,const int &ldy) const
+  {
+    char lo[]= "L", no[]= "N", tr[]= "T";
+    double one= 1.0, zero= 0.0, minusOne= -1.0;
+    int nr= nrhs, ld= ldy;
+    std::vector<double> tmp;
+    const int nsuper= getNumSupernodes();
+    // forward substitution: L y= b.
+    for(int s= 0;s<nsuper;s++)
+      {
+        int w= getSupernodeWidth(s);
+        int m= getSupernodeHeight(s);
+        int mu= m-w;
+        double *L= const_cast<double *>(&Lx[lStart[s]]);
+        double *Ys= Y+superStart[s];
+        dtrsm_(lo,lo,no,no,&w,&nr,&one,L,&m,Ys,&ld);
+        if(mu>0)
+          {
+            const int *rows= &rowInd[rowStart[s]+w];
+            tmp.resize(size_t(mu)*nr);
+            dgemm_(no,no,&mu,&nr,&w,&one,L+w,&m,Ys,&ld,&zero,&tmp[0],&mu);
+            for(int r= 0;r<nr;r++)
+              for(int i= 0;i<mu;i++)
+                Y[size_t(r)*ld+rows[i]]-= tmp[size_t(r)*mu+i];
+          }
+      }
+    // backward substitution: L^T x= y.
+    for(int s= nsuper-1;s>=0;s--)
+      {
+        int w= getSupernodeWidth(s);
+        int m= getSupernodeHeight(s);
+        int mu= m-w;
+        double *L= const_cast<double *>(&Lx[lStart[s]]);
+        double *Ys= Y+superStart[s];
+        if(mu>0)
+          {
+            const int *rows= &rowInd[rowStart[s]+w];
+            tmp.resize(size_t(mu)*nr);
+            for(int r= 0;r<nr;r++)
+              for(int i= 0;i<mu;i++)
+                tmp[size_t(r)*mu+i]= Y[size_t(r)*ld+rows[i]];
+            dgemm_(tr,no,&w,&nr,&mu,&minusOne,L+w,&m,&tmp[0],&mu,&one,Ys,&ld);
+          }
+        dtrsm_(lo,lo,tr,no,&w,&nr,&one,L,&m,Ys,&ld);
+      }
+  }
+
+//! @brief Computes the solution of the system.
+//!
+//! If the system is not marked as factored, the matrix is factored
+//! (computing the symbolic analysis if the sparsity pattern has
+//! changed). Then the forward and backward substitutions are performed.
+int XC::SupernodalSPDLinSolver::solve(void)
+  {
+    if(!theSOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+	          << "; no LinearSOE object has been set\n";
+	return -1;
+      }
+    const int n= theSOE->size;
+    if(n==0)
+      return 0;
+    if(!theSOE->factored)
+      {
+        const int result= factor();
+        if(result<0)
+          return result;
+      }
+    std::vector<double> Y(n);
+    for(int k= 0;k<n;k++)
+      Y[k]= theSOE->getB(perm[k]);
+    triangular_solves(&Y[0],1,n);
+    for(int k= 0;k<n;k++)
+      theSOE->getX(perm[k])= Y[k];
+    return 0;
+  }
+
+//! @brief Compute the solution for several right hand sides.
+//! 
+//! Each column of \p XB contains a right hand side on entry and the
+//! corresponding solution on exit.
+int XC::SupernodalSPDLinSolver::solve(Matrix &XB)
+  {
+    if(!theSOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+	          << "; no LinearSOE object has been set\n";
+	return -1;
+      }
+    const int n= theSOE->size;
+    const int nrhs= XB.noCols();
+    if((n==0) || (nrhs==0))
+      return 0;
+    if(!theSOE->factored)
+      {
+        const int result= factor();
+        if(result<0)
+          return result;
+      }
+    std::vector<double> Y(size_t(n)*nrhs);
+    for(int r= 0;r<nrhs;r++)
+      for(int k= 0;k<n;k++)
+        Y[size_t(r)*n+k]= XB(perm[k],r);
+    triangular_solves(&Y[0],nrhs,n);
+    for(int r= 0;r<nrhs;r++)
+      for(int k= 0;k<n;k++)
+        XB(perm[k],r)= Y[size_t(r)*n+k];
+    return 0;
+  }
+
+//! @brief Returns the determinant of the (factored) system matrix.
+double XC::SupernodalSPDLinSolver::getDeterminant(void)
+  {
+    double retval= 1.0;
+    if(theSOE && theSOE->factored)
+      {
+        const int nsuper= getNumSupernodes();
+        for(int s= 0;s<nsuper;s++)
+          {
+            const int w= getSupernodeWidth(s);
+            const int m= getSupernodeHeight(s);
+            const double *L= &Lx[lStart[s]];
+            for(int j= 0;j<w;j++)
+              retval*= L[size_t(j)*m+j]*L[size_t(j)*m+j];
+          }
+      }
+    return retval;
+  }
+
+//! @brief The symbolic analysis is computed when needed (see factor).
+int XC::SupernodalSPDLinSolver::setSize(void)
+  { return 0; }
+
+//! @brief Does nothing but return \f$0\f$.
+int XC::SupernodalSPDLinSolver::sendSelf(CommParameters &cp)
+  { return 0; }
+
+//! @brief Does nothing but return \f$0\f$.
+int XC::SupernodalSPDLinSolver::recvSelf(const CommParameters &cp)
+  { return 0; }
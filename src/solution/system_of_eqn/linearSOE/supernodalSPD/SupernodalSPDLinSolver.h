@@ -0,0 +1,131 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SupernodalSPDLinSolver.h
+
+#ifndef SupernodalSPDLinSolver_h
+#define SupernodalSPDLinSolver_h
+
+#include <solution/system_of_eqn/linearSOE/LinearSOESolver.h>
+#include <vector>
+#include "utility/WorkerPool.h"
+
+namespace XC {
+class SupernodalSPDLinSOE;
+
+//! @ingroup LinearSolver
+//
+//! @brief Multithreaded supernodal sparse Cholesky solver for
+//! SupernodalSPDLinSOE systems.
+//!
+//! The solution is obtained in three phases:
+//! <ul>
+//! <li> Symbolic analysis: nested dissection ordering of the graph
+//! of the system (see NestedDissection), elimination tree, postordering,
+//! column counts and fundamental supernodes. This phase is
+//! only repeated when the sparsity pattern of the system changes
+//! (its graph stamp), so it's reused across Newton iterations.</li>
+//! <li> Numeric factorization (multifrontal): the frontal matrix of each
+//! supernode is factored with dense BLAS-3/LAPACK kernels (dpotrf, dtrsm
+//! and dsyrk). Independent subtrees of the supernodal elimination tree
+//! are factored in parallel; the big frontal matrices near the root
+//! (separators) split their dense updates between the threads.</li>
+//! <li> Forward and backward substitution (one or several
+//! right hand sides).</li>
+//! </ul>
+class SupernodalSPDLinSolver : public LinearSOESolver
+  {
+  private:
+    SupernodalSPDLinSOE *theSOE;
+    WorkerPool workers; //!< threads for the numeric factorization.
+    int ndMinSize; //!< size of the graph parts not dissected by the ordering.
+
+    // Symbolic analysis.
+    size_t symbolicStamp; //!< graph stamp of the symbolic analysis (0: none).
+    size_t numSymbolic; //!< number of symbolic analyses computed.
+    std::vector<int> perm; //!< perm[k]: equation in the k-th position.
+    std::vector<int> superStart; //!< first column of each supernode.
+    std::vector<int> superParent; //!< parent supernode (-1 for the roots).
+    std::vector<int> childStart; //!< start of the children of each supernode in children.
+    std::vector<int> children; //!< children of the supernodes.
+    std::vector<int> rowStart; //!< start of the rows of each supernode in rowInd.
+    std::vector<int> rowInd; //!< rows of the supernodes (its own columns first).
+    std::vector<size_t> lStart; //!< start of the dense block of each supernode in Lx.
+    std::vector<int> assemblyStart; //!< start of the coefficients of A assembled in each supernode.
+    std::vector<int> assemblyEntry; //!< position in A of the coefficient.
+    std::vector<size_t> assemblyPos; //!< position in Lx of the coefficient.
+    std::vector<std::vector<int> > subtrees; //!< supernodes (postorder) factored by each thread.
+    std::vector<int> topSupernodes; //!< supernodes factored after the subtrees.
+
+    // Numeric factorization.
+    std::vector<double> Lx; //!< dense blocks (column major) of the supernodes.
+    std::vector<std::vector<double> > updates; //!< update matrices pending of assembly in the parent.
+
+    inline int getSupernodeWidth(const int &s) const
+      { return superStart[s+1]-superStart[s]; }
+    inline int getSupernodeHeight(const int &s) const
+      { return rowStart[s+1]-rowStart[s]; }
+    double getWork(const int &) const;
+    void schedule(void);
+    int symbolic(void);
+    int factor_supernode(const int &,std::vector<int> &,const size_t &);
+    int factor(void);
+    void triangular_solves(double *,const int &,const int &) const;
+  protected:
+    friend class LinearSOE;
+    friend class FEM_ObjectBroker;
+    SupernodalSPDLinSolver(void);
+    virtual LinearSOESolver *getCopy(void) const;
+    virtual bool setLinearSOE(LinearSOE *);
+  public:
+    int solve(void);
+    //! @brief The solver can solve several right hand sides at once.
+    bool canSolveMultipleRHS(void) const
+      { return true; }
+    int solve(Matrix &);
+    int setSize(void);
+    double getDeterminant(void);
+
+    //! @brief Return the number of threads used in the factorization.
+    inline size_t getNumThreads(void) const
+      { return workers.getNumThreads(); }
+    void setNumThreads(const size_t &);
+    //! @brief Return the size of the graph parts that are not dissected.
+    inline int getOrderingMinSize(void) const
+      { return ndMinSize; }
+    //! @brief Set the size of the graph parts that are not dissected.
+    inline void setOrderingMinSize(const int &sz)
+      { ndMinSize= sz; symbolicStamp= 0; }
+    //! @brief Return the number of symbolic analyses computed.
+    inline size_t getNumSymbolicFactorizations(void) const
+      { return numSymbolic; }
+    //! @brief Return the number of supernodes.
+    inline int getNumSupernodes(void) const
+      { return superStart.empty() ? 0 : superStart.size()-1; }
+    size_t getFactorSize(void) const;
+
+    int sendSelf(CommParameters &);
+    int recvSelf(const CommParameters &);
+  };
+
+} // end of XC namespace
+
+#endif
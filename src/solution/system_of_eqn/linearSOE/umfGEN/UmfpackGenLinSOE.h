@@ -91,7 +91,9 @@ class UmfpackGenLinSOE : public FactoredSOEBase
     SystemOfEqn *getCopy(void) const;
   public:
     int setSize(Graph &theGraph);
+    int setSize(const CSRGraph &theGraph);
     int addA(const Matrix &, const ID &, double fact = 1.0);
+    bool fillScatterMap(const ID &, std::vector<double *> &);
     
     void zeroA(void);
 
@@ -76,6 +76,7 @@
 #include <solution/system_of_eqn/eigenSOE/SymArpackSOE.h>
 #include <solution/system_of_eqn/eigenSOE/SymBandEigenSOE.h>
 #include <solution/system_of_eqn/eigenSOE/FullGenEigenSOE.h>
+#include <solution/system_of_eqn/eigenSOE/SparseGenColEigenSOE.h>
 
 #include <solution/system_of_eqn/eigenSOE/EigenSolver.h>
 #include <solution/system_of_eqn/eigenSOE/BandArpackppSolver.h>
@@ -83,6 +84,7 @@
 #include <solution/system_of_eqn/eigenSOE/BandArpackSolver.h>
 #include <solution/system_of_eqn/eigenSOE/FullGenEigenSolver.h>
 #include <solution/system_of_eqn/eigenSOE/SymBandEigenSolver.h>
+#include <solution/system_of_eqn/eigenSOE/ShiftInvertLanczosSolver.h>
 
 
 
@@ -108,6 +110,12 @@
 #endif
 #include <solution/system_of_eqn/linearSOE/sparseSYM/SymSparseLinSOE.h>
 #include <solution/system_of_eqn/linearSOE/sparseSYM/SymSparseLinSolver.h>
+#include <solution/system_of_eqn/linearSOE/supernodalSPD/SupernodalSPDLinSOE.h>
+#include <solution/system_of_eqn/linearSOE/supernodalSPD/SupernodalSPDLinSolver.h>
+#include <solution/system_of_eqn/linearSOE/krylov/KrylovSparseSolver.h>
+#include <solution/system_of_eqn/linearSOE/krylov/JacobiPreconditioner.h>
+#include <solution/system_of_eqn/linearSOE/krylov/ILUPreconditioner.h>
+#include <solution/system_of_eqn/linearSOE/krylov/AMGPreconditioner.h>
 
 //#include <solution/system_of_eqn/linearSOE/umfGEN/UmfpackGenLinSOE.h>
 #ifdef _PARALLEL_PROCESSING
@@ -0,0 +1,155 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//Profiler.cc
+
+#include "Profiler.h"
+#include <thread>
+#include <fstream>
+#include <iomanip>
+
+std::atomic<bool> XC::Profiler::enabled(false);
+
+//! @brief Constructor.
+XC::Profiler::Profiler(void)
+  : traceEnabled(false), maxTraceEvents(1000000), origin(clock_type::now()) {}
+
+//! @brief Returns the profiler of the process.
+XC::Profiler &XC::Profiler::get(void)
+  {
+    static Profiler retval;
+    return retval;
+  }
+
+//! @brief Starts/stops the data collection.
+void XC::Profiler::setEnabled(const bool &b)
+  { enabled= b; }
+
+//! @brief Discards the collected data and resets the trace time origin.
+void XC::Profiler::reset(void)
+  {
+    std::lock_guard<std::mutex> lock(mtx);
+    phases.clear();
+    events.clear();
+    origin= clock_type::now();
+  }
+
+//! @brief Adds a call to a phase.
+//!
+//! @param name: name of the phase.
+//! @param t0: start time.
+//! @param t1: end time.
+//! @param cpu: CPU time (seconds).
+//! @param bytes: bytes assembled.
+void XC::Profiler::record(const char *name,const clock_type::time_point &t0,const clock_type::time_point &t1,const double &cpu,const size_t &bytes)
+  {
+    const double wall= std::chrono::duration<double>(t1-t0).count();
+    std::lock_guard<std::mutex> lock(mtx);
+    PhaseData &d= phases[name];
+    d.numCalls++;
+    d.wallTime+= wall;
+    d.cpuTime+= cpu;
+    d.bytes+= bytes;
+    if(traceEnabled && (events.size()<maxTraceEvents))
+      {
+        TraceEvent e;
+        e.name= name;
+        e.start= std::chrono::duration<double,std::micro>(t0-origin).count();
+        e.duration= wall*1e6;
+        e.threadId= std::hash<std::thread::id>()(std::this_thread::get_id());
+        events.push_back(e);
+      }
+  }
+
+//! @brief Returns a copy of the data for each phase.
+XC::Profiler::phase_map XC::Profiler::getPhases(void) const
+  {
+    std::lock_guard<std::mutex> lock(mtx);
+    return phases;
+  }
+
+//! @brief Returns the number of stored trace events.
+size_t XC::Profiler::getNumTraceEvents(void) const
+  {
+    std::lock_guard<std::mutex> lock(mtx);
+    return events.size();
+  }
+
+//! @brief Returns a Python dictionary with an entry for each phase:
+//! {phaseName: {'calls':..., 'wall':..., 'cpu':..., 'bytes':...}}.
+boost::python::dict XC::Profiler::getPyDict(void) const
+  {
+    boost::python::dict retval;
+    const phase_map tmp= getPhases();
+    for(phase_map::const_iterator i= tmp.begin();i!=tmp.end();i++)
+      {
+        boost::python::dict d;
+        d["calls"]= i->second.numCalls;
+        d["wall"]= i->second.wallTime;
+        d["cpu"]= i->second.cpuTime;
+        d["bytes"]= i->second.bytes;
+        retval[i->first]= d;
+      }
+    return retval;
+  }
+
+//! @brief Writes the trace events in the Chrome trace event
+//! format (JSON object with a "traceEvents" array of complete events).
+void XC::Profiler::writeChromeTrace(std::ostream &os) const
+  {
+    std::lock_guard<std::mutex> lock(mtx);
+    os << "{\"traceEvents\":[";
+    os << std::fixed << std::setprecision(3);
+    for(std::vector<TraceEvent>::const_iterator i= events.begin();i!=events.end();i++)
+      {
+        if(i!=events.begin())
+          os << ",";
+        os << "\n{\"name\":\"" << i->name << "\",\"cat\":\"xc\",\"ph\":\"X\""
+           << ",\"ts\":" << i->start << ",\"dur\":" << i->duration
+           << ",\"pid\":0,\"tid\":" << (i->threadId%100000) << "}";
+      }
+    os << "\n],\"displayTimeUnit\":\"ms\"}\n";
+  }
+
+//! @brief Writes the trace events in the file being passed as parameter.
+int XC::Profiler::exportChromeTrace(const std::string &fileName) const
+  {
+    std::ofstream out(fileName.c_str());
+    if(!out)
+      {
+        std::cerr << "Profiler::" << __FUNCTION__
+                  << "; can't open file: '" << fileName << "'.\n";
+        return -1;
+      }
+    writeChromeTrace(out);
+    return 0;
+  }
+
+//! @brief Prints the accumulated data for each phase.
+void XC::Profiler::Print(std::ostream &os) const
+  {
+    const phase_map tmp= getPhases();
+    for(phase_map::const_iterator i= tmp.begin();i!=tmp.end();i++)
+      os << i->first << ": calls= " << i->second.numCalls
+         << " wall= " << i->second.wallTime << " s"
+         << " cpu= " << i->second.cpuTime << " s"
+         << " bytes= " << i->second.bytes << std::endl;
+  }
@@ -0,0 +1,161 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//Profiler.h
+
+#ifndef Profiler_h
+#define Profiler_h
+
+#include <string>
+#include <map>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <iostream>
+#include <boost/python/dict.hpp>
+
+namespace XC {
+
+//! @ingroup Utils
+//! @brief Accumulates the time spent in the different phases
+//! of the analysis (element tangent and residual assembly,
+//! factorization, solution, domain update and commit, numbering,
+//! recording,...).
+//!
+//! The instrumented code creates a ProfilerScope object at the
+//! beginning of each phase; when the profiler is disabled (default)
+//! the only cost is checking a boolean. For each phase the profiler
+//! stores the number of calls, the wall and CPU time and the bytes
+//! assembled. If tracing is active each call is also stored as an
+//! event that can be written in the Chrome trace format
+//! (chrome://tracing or https://ui.perfetto.dev).
+class Profiler
+  {
+  public:
+    typedef std::chrono::steady_clock clock_type;
+    //! @brief Accumulated data for a phase.
+    struct PhaseData
+      {
+        size_t numCalls; //!< number of calls.
+        double wallTime; //!< wall clock time (seconds).
+        double cpuTime; //!< CPU time (seconds).
+        size_t bytes; //!< bytes assembled.
+        PhaseData(void)
+          : numCalls(0), wallTime(0.0), cpuTime(0.0), bytes(0) {}
+      };
+    //! @brief Call to a phase (for the trace).
+    struct TraceEvent
+      {
+        const char *name; //!< phase name.
+        double start; //!< start time (microseconds since reset).
+        double duration; //!< duration (microseconds).
+        size_t threadId; //!< thread identifier.
+      };
+    typedef std::map<std::string,PhaseData> phase_map;
+  private:
+    static std::atomic<bool> enabled; //!< if true, collect data (read by all the threads).
+    bool traceEnabled; //!< if true, store trace events.
+    size_t maxTraceEvents; //!< maximum number of trace events stored.
+    phase_map phases; //!< data for each phase.
+    std::vector<TraceEvent> events; //!< trace events.
+    clock_type::time_point origin; //!< time origin for the trace.
+    mutable std::mutex mtx;
+
+    Profiler(void);
+    Profiler(const Profiler &);
+    Profiler &operator=(const Profiler &);
+  public:
+    static Profiler &get(void);
+
+    //! @brief Returns true if the profiler is collecting data.
+    static inline bool isEnabled(void)
+      { return enabled.load(std::memory_order_relaxed); }
+    void setEnabled(const bool &);
+    inline bool getEnabled(void) const
+      { return isEnabled(); }
+    inline bool getTraceEnabled(void) const
+      { return traceEnabled; }
+    inline void setTraceEnabled(const bool &b)
+      { traceEnabled= b; }
+    inline size_t getMaxTraceEvents(void) const
+      { return maxTraceEvents; }
+    inline void setMaxTraceEvents(const size_t &n)
+      { maxTraceEvents= n; }
+
+    void reset(void);
+    void record(const char *,const clock_type::time_point &,const clock_type::time_point &,const double &,const size_t &);
+
+    phase_map getPhases(void) const;
+    size_t getNumTraceEvents(void) const;
+    boost::python::dict getPyDict(void) const;
+    void writeChromeTrace(std::ostream &) const;
+    int exportChromeTrace(const std::string &) const;
+    void Print(std::ostream &) const;
+  };
+
+//! @ingroup Utils
+//! @brief Measures the phase of the analysis that lasts
+//! while the object exists.
+class ProfilerScope
+  {
+  private:
+    const char *name; //!< phase name.
+    bool active; //!< true if the profiler was enabled on construction.
+    size_t bytes; //!< bytes assembled.
+    Profiler::clock_type::time_point wall0;
+    std::clock_t cpu0;
+
+    ProfilerScope(const ProfilerScope &);
+    ProfilerScope &operator=(const ProfilerScope &);
+  public:
+    //! @brief Constructor.
+    //! @param nmb: name of the phase (must be a string literal).
+    explicit ProfilerScope(const char *nmb)
+      : name(nmb), active(Profiler::isEnabled()), bytes(0)
+      {
+        if(active)
+          {
+            wall0= Profiler::clock_type::now();
+            cpu0= std::clock();
+          }
+      }
+    //! @brief Returns true if the phase is being measured.
+    inline bool isActive(void) const
+      { return active; }
+    //! @brief Adds the bytes assembled in this phase.
+    inline void addBytes(const size_t &b)
+      { bytes+= b; }
+    //! @brief Destructor (stores the measures in the profiler).
+    ~ProfilerScope(void)
+      {
+        if(active)
+          {
+            const double cpu= double(std::clock()-cpu0)/CLOCKS_PER_SEC;
+            Profiler::get().record(name,wall0,Profiler::clock_type::now(),cpu,bytes);
+          }
+      }
+  };
+
+} // end of XC namespace
+
+#endif
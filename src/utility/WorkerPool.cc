@@ -0,0 +1,157 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//WorkerPool.cc
+
+#include "WorkerPool.h"
+#include <algorithm>
+
+//! @brief Constructor.
+//!
+//! @param nThreads: number of threads (including the calling one).
+XC::WorkerPool::WorkerPool(const size_t &nThreads)
+  : task(nullptr), generation(0), pending(0), stopping(false), ownerPid(getpid())
+  { start(nThreads); }
+
+//! @brief Copy constructor (the copy gets its own threads).
+XC::WorkerPool::WorkerPool(const WorkerPool &other)
+  : task(nullptr), generation(0), pending(0), stopping(false), ownerPid(getpid())
+  { start(other.getNumThreads()); }
+
+//! @brief Assignment operator (only the number of threads is copied).
+XC::WorkerPool &XC::WorkerPool::operator=(const WorkerPool &other)
+  {
+    if(this!=&other)
+      setNumThreads(other.getNumThreads());
+    return *this;
+  }
+
+//! @brief Destructor.
+XC::WorkerPool::~WorkerPool(void)
+  { stop(); }
+
+//! @brief Launch the worker threads (none in a forked process).
+void XC::WorkerPool::start(const size_t &nThreads)
+  {
+    if(!isOwner())
+      return;
+    const size_t nw= std::max(size_t(1),nThreads)-1;
+    stopping= false;
+    workers.reserve(nw);
+    for(size_t i= 0;i<nw;i++)
+      workers.push_back(std::thread(&WorkerPool::worker_loop,this,i));
+  }
+
+//! @brief Make the worker threads exit and wait for them.
+//!
+//! In a forked process the threads don't exist, so their handles
+//! are released without notifying or joining them.
+void XC::WorkerPool::stop(void)
+  {
+    if(!isOwner())
+      {
+        for(std::vector<std::thread>::iterator i= workers.begin();i!=workers.end();i++)
+          (*i).detach();
+        workers.clear();
+        return;
+      }
+    {
+      std::lock_guard<std::mutex> lock(mtx);
+      stopping= true;
+    }
+    workReady.notify_all();
+    for(std::vector<std::thread>::iterator i= workers.begin();i!=workers.end();i++)
+      (*i).join();
+    workers.clear();
+    generation= 0;
+  }
+
+//! @brief Set the number of threads (including the calling one).
+//!
+//! The threads are only restarted if the number changes.
+void XC::WorkerPool::setNumThreads(const size_t &nThreads)
+  {
+    if(std::max(size_t(1),nThreads)!=getNumThreads())
+      {
+        stop();
+        start(nThreads);
+      }
+  }
+
+//! @brief Loop of the i-th worker: wait for a task, run its block
+//! and notify the caller.
+void XC::WorkerPool::worker_loop(const size_t &i)
+  {
+    size_t lastGeneration= 0;
+    while(true)
+      {
+        const task_type *t= nullptr;
+        size_t begin= 0, end= 0;
+        {
+          std::unique_lock<std::mutex> lock(mtx);
+          workReady.wait(lock,[&]{ return stopping || (generation!=lastGeneration); });
+          if(stopping)
+            return;
+          lastGeneration= generation;
+          t= task;
+          if(i+1<blockLimits.size())
+            {
+              begin= blockLimits[i];
+              end= blockLimits[i+1];
+            }
+        }
+        if(begin<end)
+          (*t)(begin,end);
+        {
+          std::lock_guard<std::mutex> lock(mtx);
+          pending--;
+        }
+        workDone.notify_one();
+      }
+  }
+
+//! @brief Runs f over the range [0,sz) splitting it in contiguous
+//! blocks, one for each thread. Returns when all the blocks are done.
+void XC::WorkerPool::run_blocks(const task_type &f,const size_t &sz)
+  {
+    const size_t nt= std::max(size_t(1),std::min(getNumThreads(),sz));
+    if(nt==1)
+      {
+        f(0,sz);
+        return;
+      }
+    const size_t blockSize= sz/nt;
+    {
+      std::lock_guard<std::mutex> lock(mtx);
+      task= &f;
+      // The workers beyond nt-1 get an empty block.
+      blockLimits.resize(nt);
+      for(size_t i= 0;i<nt;i++)
+        blockLimits[i]= i*blockSize;
+      pending= workers.size();
+      generation++;
+    }
+    workReady.notify_all();
+    f((nt-1)*blockSize,sz);
+    std::unique_lock<std::mutex> lock(mtx);
+    workDone.wait(lock,[&]{ return pending==0; });
+    task= nullptr;
+  }
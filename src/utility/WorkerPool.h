@@ -0,0 +1,88 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//WorkerPool.h
+
+#ifndef WorkerPool_h
+#define WorkerPool_h
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <vector>
+#include <unistd.h>
+
+namespace XC {
+
+//! @ingroup Utils
+//! @brief Persistent set of worker threads.
+//!
+//! The threads are created once (when the number of threads is set)
+//! and wait for work between calls, so the objects that call the
+//! pool repeatedly (i.e. once per Newton iteration) don't pay the
+//! thread start-up cost each time and the thread_local work buffers
+//! of the elements and materials survive from one call to the next.
+//! The range is split in the same contiguous blocks that run_blocks
+//! uses; the calling thread takes the last one.
+//!
+//! The worker threads don't survive a fork (see LoadCombinationFarm),
+//! and the copied mutex and condition variables may be left in an
+//! unusable state. In the child process the pool runs the tasks
+//! serially in the calling thread and never touches them.
+class WorkerPool
+  {
+  public:
+    typedef std::function<void(const size_t &,const size_t &)> task_type;
+  private:
+    std::vector<std::thread> workers; //!< worker threads.
+    std::mutex mtx; //!< protects the members below.
+    std::condition_variable workReady; //!< signals a new task to the workers.
+    std::condition_variable workDone; //!< signals the end of a block to the caller.
+    const task_type *task; //!< task being run.
+    std::vector<size_t> blockLimits; //!< block limits for the current task.
+    size_t generation; //!< incremented on each new task.
+    size_t pending; //!< blocks not finished yet.
+    bool stopping; //!< if true, the workers must exit.
+    pid_t ownerPid; //!< process that created the worker threads.
+
+    //! @brief Return true if called from the process that owns the threads.
+    inline bool isOwner(void) const
+      { return (ownerPid==getpid()); }
+    void worker_loop(const size_t &);
+    void start(const size_t &);
+    void stop(void);
+  public:
+    explicit WorkerPool(const size_t &nThreads= 1);
+    WorkerPool(const WorkerPool &);
+    WorkerPool &operator=(const WorkerPool &);
+    ~WorkerPool(void);
+
+    //! @brief Return the number of threads (including the calling one).
+    inline size_t getNumThreads(void) const
+      { return (isOwner() ? workers.size()+1 : 1); }
+    void setNumThreads(const size_t &);
+    void run_blocks(const task_type &,const size_t &);
+  };
+
+} // end of XC namespace
+
+#endif
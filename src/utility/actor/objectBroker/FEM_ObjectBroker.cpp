@@ -1485,6 +1485,9 @@ XC::EigenSOE *XC::FEM_ObjectBroker::getNewEigenSOE(int classTagSOE)
         case EigenSOE_TAGS_FullGenEigenSOE:
           theSOE = new BandArpackppSOE(nullptr);
           break;
+        case EigenSOE_TAGS_SparseGenColEigenSOE:
+          theSOE = new SparseGenColEigenSOE(nullptr);
+          break;
         default:
           std::cerr << "FEM_ObjectBrokerAllClasses::getNewEigenSOE - ";
           std::cerr << " - no EigenSOE type exists for class tag ";
@@ -109,6 +109,7 @@
 #include "material/section/interaction_diagram/InteractionDiagramData.h"
 #include "material/section/interaction_diagram/InteractionDiagram.h"
 #include "material/section/interaction_diagram/InteractionDiagram2d.h"
+#include "material/section/interaction_diagram/InteractionDiagramBuilder.h"
 #include "material/section/interaction_diagram/ComputePivots.h"
 
 // NDMaterials
@@ -248,6 +249,12 @@
 #include "utility/recorder/PropRecorder.h"
 #include "utility/recorder/NodePropRecorder.h"
 #include "utility/recorder/ElementPropRecorder.h"
+#include "utility/recorder/PropEnvelopeRecorder.h"
+#include "utility/recorder/NodePropEnvelopeRecorder.h"
+#include "utility/recorder/ElementPropEnvelopeRecorder.h"
+#include "utility/recorder/ColumnarResultsReader.h"
+#include "utility/recorder/NodeDispColumnarRecorder.h"
+#include "utility/recorder/ElementForcesColumnarRecorder.h"
 #include "utility/recorder/EnvelopeNodeRecorder.h"
 #include "utility/recorder/EnvelopeElementRecorder.h"
 #include "utility/recorder/response/Response.h"
@@ -439,10 +446,17 @@
 #include "utility/matrix/ID.h"
 #include "utility/xc_python_utils.h"
 #include "utility/database/SQLiteDatastore.h"
+#include "utility/database/MemoryDatastore.h"
 #include "utility/database/OracleDatastore.h"
 #include "utility/database/BerkeleyDbDatastore.h"
 #include "utility/database/NEESData.h"
 #include "utility/database/MySqlDatastore.h"
 #include "utility/database/FileDatastore.h"
 
+#include "post_process/limit_state/LimitStateChecker.h"
+#include "post_process/limit_state/NormalStressesCheckKernel.h"
+#include "post_process/limit_state/ShearCheckKernel.h"
+#include "post_process/limit_state/CrackControlCheckKernel.h"
+#include "post_process/limit_state/FatigueCheckKernel.h"
+
 #endif
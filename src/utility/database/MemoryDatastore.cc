@@ -0,0 +1,401 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MemoryDatastore.cc
+
+#include "MemoryDatastore.h"
+#include "utility/matrix/Matrix.h"
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/ID.h"
+#include <fstream>
+#include <sstream>
+#include <cstring>
+#include <cstdio>
+
+//! @brief Constructor.
+XC::MemoryDatastore::RecordKey::RecordKey(const int &tag,const int &sz,const RecordType &t)
+  : dbTag(tag), size(sz), type(t) {}
+
+//! @brief Hash function for record keys.
+size_t XC::MemoryDatastore::RecordKeyHash::operator()(const RecordKey &k) const
+  {
+    size_t retval= static_cast<size_t>(k.dbTag);
+    retval= retval*31+static_cast<size_t>(k.size);
+    retval= retval*3+static_cast<size_t>(k.type);
+    return retval;
+  }
+
+//! @brief Constructor.
+XC::MemoryDatastore::Snapshot::Snapshot(void)
+  : numBytes(0) {}
+
+//! @brief Stores the data of a record.
+//!
+//! @param key: record identifier.
+//! @param data: pointer to the data.
+//! @param sz: size of the data in bytes.
+void XC::MemoryDatastore::Snapshot::put(const RecordKey &key,const void *data,const size_t &sz)
+  {
+    offset_map::const_iterator i= offsets.find(key);
+    size_t offset= 0;
+    if(i!=offsets.end()) //Overwrite (same key means same size).
+      offset= i->second;
+    else
+      {
+        offset= buffer.size();
+        buffer.resize(offset+sz);
+        offsets[key]= offset;
+        numBytes= buffer.size();
+      }
+    if(sz>0)
+      memcpy(&buffer[offset],data,sz);
+  }
+
+//! @brief Retrieves the data of a record. Returns false if the
+//! record doesn't exists.
+//!
+//! @param key: record identifier.
+//! @param data: pointer to the data.
+//! @param sz: size of the data in bytes.
+bool XC::MemoryDatastore::Snapshot::get(const RecordKey &key,void *data,const size_t &sz) const
+  {
+    offset_map::const_iterator i= offsets.find(key);
+    if(i==offsets.end())
+      return false;
+    if(sz>0)
+      memcpy(data,&buffer[i->second],sz);
+    return true;
+  }
+
+//! @brief Writes the buffer in the file and frees the memory.
+int XC::MemoryDatastore::Snapshot::spill(const std::string &fileName)
+  {
+    if(!inMemory())
+      return 0;
+    std::ofstream out(fileName.c_str(),std::ios::binary|std::ios::trunc);
+    if(numBytes>0)
+      out.write(buffer.data(),numBytes);
+    if(!out)
+      {
+        std::cerr << "MemoryDatastore::Snapshot::" << __FUNCTION__
+                  << "; can't write file: '" << fileName << "'\n";
+        return -1;
+      }
+    out.close();
+    std::vector<char> tmp;
+    buffer.swap(tmp); //Free memory.
+    spillFileName= fileName;
+    return 0;
+  }
+
+//! @brief Reads the buffer from the file (if it's not in memory).
+int XC::MemoryDatastore::Snapshot::load(void)
+  {
+    if(inMemory())
+      return 0;
+    std::ifstream in(spillFileName.c_str(),std::ios::binary);
+    buffer.resize(numBytes);
+    if(numBytes>0)
+      in.read(buffer.data(),numBytes);
+    if(!in)
+      {
+        std::cerr << "MemoryDatastore::Snapshot::" << __FUNCTION__
+                  << "; can't read file: '" << spillFileName << "'\n";
+        std::vector<char> tmp;
+        buffer.swap(tmp); //Discard the data read.
+        return -1;
+      }
+    in.close();
+    remove(spillFileName.c_str());
+    spillFileName.clear();
+    return 0;
+  }
+
+//! @brief Removes the stored data.
+void XC::MemoryDatastore::Snapshot::clear(void)
+  {
+    std::vector<char> tmp;
+    buffer.swap(tmp); //Free memory.
+    offsets.clear();
+    if(!inMemory())
+      {
+        remove(spillFileName.c_str());
+        spillFileName.clear();
+      }
+    numBytes= 0;
+  }
+
+//! @brief Constructor.
+//!
+//! @param projectName: prefix for the names of the files used to
+//!                     spill to disk the least recently used states.
+//! @param preprocessor: preprocessor of the finite element problem.
+//! @param theObjectBroker: object broker.
+XC::MemoryDatastore::MemoryDatastore(const std::string &projectName, Preprocessor &preprocessor,FEM_ObjectBroker &theObjectBroker)
+  :DBDatastore(preprocessor, theObjectBroker), memoryBudget(512*1024*1024),
+   project(projectName), lastCommitTag(0), lastSnapshot(nullptr) {}
+
+//! @brief Destructor (removes the spill files).
+XC::MemoryDatastore::~MemoryDatastore(void)
+  { clearAll(); }
+
+//! @brief Returns a new database tag.
+int XC::MemoryDatastore::getDbTag(void) const
+  {
+    dbTAG++;
+    return dbTAG;
+  }
+
+//! @brief Returns the name of the file used to spill the snapshot.
+std::string XC::MemoryDatastore::getSpillFileName(const int &commitTag) const
+  {
+    std::ostringstream os;
+    os << project << "_" << commitTag << ".snp";
+    return os.str();
+  }
+
+//! @brief Marks the snapshot as the most recently used.
+void XC::MemoryDatastore::touch(const int &commitTag)
+  {
+    if(lru.empty() || (lru.front()!=commitTag))
+      {
+        lru.remove(commitTag);
+        lru.push_front(commitTag);
+      }
+  }
+
+//! @brief Returns the snapshot corresponding to the commit tag
+//! (loading it from disk if needed). If the snapshot can't be read
+//! from disk it's removed and a null pointer is returned.
+//!
+//! @param commitTag: identifier of the snapshot.
+//! @param create: if true create the snapshot if it doesn't exists.
+XC::MemoryDatastore::Snapshot *XC::MemoryDatastore::getSnapshot(const int &commitTag,const bool &create)
+  {
+    if(lastSnapshot && (commitTag==lastCommitTag))
+      return lastSnapshot;
+    Snapshot *retval= nullptr;
+    snapshot_map::iterator i= snapshots.find(commitTag);
+    if(i!=snapshots.end())
+      retval= &(i->second);
+    else if(create)
+      retval= &(snapshots[commitTag]);
+    if(retval)
+      {
+        if(retval->load()!=0)
+          {
+            retval->clear(); //Data lost.
+            snapshots.erase(commitTag);
+            lru.remove(commitTag);
+            return nullptr;
+          }
+        touch(commitTag);
+        lastCommitTag= commitTag;
+        lastSnapshot= retval;
+      }
+    return retval;
+  }
+
+//! @brief Stores a record.
+int XC::MemoryDatastore::send(const int &dbTag,const int &commitTag,const RecordKey &key,const void *data,const size_t &sz)
+  {
+    checkDbTag(dbTag); //Warns about repeated tags.
+    Snapshot *snp= getSnapshot(commitTag,true);
+    if(!snp)
+      return -2;
+    snp->put(key,data,sz);
+    return 0;
+  }
+
+//! @brief Retrieves a record.
+int XC::MemoryDatastore::receive(const int &dbTag,const int &commitTag,const RecordKey &key,void *data,const size_t &sz)
+  {
+    Snapshot *snp= getSnapshot(commitTag,false);
+    if(!snp || !snp->get(key,data,sz))
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; data with database tag: " << dbTag
+                  << " not found for commit tag: " << commitTag << std::endl;
+        return -2;
+      }
+    return 0;
+  }
+
+//! @brief Stores the current state of the problem.
+//!
+//! The data previously saved with the same commit tag
+//! is discarded (if it was written to disk the file is
+//! removed without reading it).
+int XC::MemoryDatastore::commitState(int commitTag)
+  {
+    Snapshot &snp= snapshots[commitTag];
+    snp.clear();
+    touch(commitTag);
+    lastCommitTag= commitTag;
+    lastSnapshot= &snp;
+    const int retval= DBDatastore::commitState(commitTag);
+    enforceMemoryBudget();
+    return retval;
+  }
+
+//! @brief Restores the state of the problem. Returns an error
+//! if the state can't be read from disk (the state is removed).
+int XC::MemoryDatastore::restoreState(int commitTag)
+  {
+    if(isSaved(commitTag) && !getSnapshot(commitTag,false))
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; can't read the state for commit tag: "
+                  << commitTag << std::endl;
+        return -1;
+      }
+    const int retval= DBDatastore::restoreState(commitTag);
+    enforceMemoryBudget();
+    return retval;
+  }
+
+//! @brief Returns the maximum number of bytes to keep in memory.
+size_t XC::MemoryDatastore::getMemoryBudget(void) const
+  { return memoryBudget; }
+
+//! @brief Sets the maximum number of bytes to keep in memory.
+void XC::MemoryDatastore::setMemoryBudget(const size_t &sz)
+  {
+    memoryBudget= sz;
+    enforceMemoryBudget();
+  }
+
+//! @brief Returns the number of bytes used by the snapshots
+//! kept in memory.
+size_t XC::MemoryDatastore::getMemoryInUse(void) const
+  {
+    size_t retval= 0;
+    for(snapshot_map::const_iterator i= snapshots.begin();i!=snapshots.end();i++)
+      if(i->second.inMemory())
+        retval+= i->second.getNumBytes();
+    return retval;
+  }
+
+//! @brief Returns the number of stored states.
+size_t XC::MemoryDatastore::getNumSnapshots(void) const
+  { return snapshots.size(); }
+
+//! @brief Returns the number of stored states that have been written to disk.
+size_t XC::MemoryDatastore::getNumSpilledSnapshots(void) const
+  {
+    size_t retval= 0;
+    for(snapshot_map::const_iterator i= snapshots.begin();i!=snapshots.end();i++)
+      if(!i->second.inMemory())
+        retval++;
+    return retval;
+  }
+
+//! @brief Writes to disk the least recently used snapshots until
+//! the memory in use is lower than the budget (the most recently
+//! used snapshot is always kept in memory).
+void XC::MemoryDatastore::enforceMemoryBudget(void)
+  {
+    size_t inUse= getMemoryInUse();
+    if(inUse>memoryBudget)
+      {
+        std::list<int>::const_reverse_iterator i= lru.rbegin();
+        for(;(i!=lru.rend()) && (inUse>memoryBudget);i++)
+          {
+            const int commitTag= *i;
+            if(commitTag==lru.front())
+              break; //Keep the most recently used.
+            Snapshot &snp= snapshots[commitTag];
+            if(snp.inMemory())
+              {
+                const size_t sz= snp.getNumBytes();
+                if(snp.spill(getSpillFileName(commitTag))==0)
+                  inUse-= sz;
+              }
+          }
+      }
+  }
+
+//! @brief Removes all the stored states.
+void XC::MemoryDatastore::clearAll(void)
+  {
+    for(snapshot_map::iterator i= snapshots.begin();i!=snapshots.end();i++)
+      i->second.clear();
+    snapshots.clear();
+    lru.clear();
+    lastCommitTag= 0;
+    lastSnapshot= nullptr;
+  }
+
+int XC::MemoryDatastore::sendMsg(int dbTag, int commitTag, const Message &, ChannelAddress *theAddress)
+  {
+    std::cerr << getClassName() << "::" << __FUNCTION__
+              << "; not yet implemented\n";
+    return -1;
+  }		       
+
+int XC::MemoryDatastore::recvMsg(int dbTag, int commitTag, Message &, ChannelAddress *theAddress)
+  {
+    std::cerr << getClassName() << "::" << __FUNCTION__
+              << "; not yet implemented\n";
+    return -1;
+  }		       
+
+//! @brief Stores the matrix.
+int XC::MemoryDatastore::sendMatrix(int dbTag, int commitTag, const Matrix &theMatrix, ChannelAddress *theAddress)
+  {
+    const int sz= theMatrix.getDataSize();
+    return send(dbTag,commitTag,RecordKey(dbTag,sz,MATRIX_RECORD),theMatrix.getDataPtr(),sz*sz_dbl);
+  }
+
+//! @brief Retrieves the matrix.
+int XC::MemoryDatastore::recvMatrix(int dbTag, int commitTag, Matrix &theMatrix, ChannelAddress *theAddress)
+  {
+    const int sz= theMatrix.getDataSize();
+    return receive(dbTag,commitTag,RecordKey(dbTag,sz,MATRIX_RECORD),theMatrix.getDataPtr(),sz*sz_dbl);
+  }
+
+//! @brief Stores the vector.
+int XC::MemoryDatastore::sendVector(int dbTag, int commitTag, const Vector &theVector, ChannelAddress *theAddress)
+  {
+    const int sz= theVector.Size();
+    return send(dbTag,commitTag,RecordKey(dbTag,sz,VECTOR_RECORD),theVector.getDataPtr(),sz*sz_dbl);
+  }
+
+//! @brief Retrieves the vector.
+int XC::MemoryDatastore::recvVector(int dbTag, int commitTag, Vector &theVector, ChannelAddress *theAddress)
+  {
+    const int sz= theVector.Size();
+    return receive(dbTag,commitTag,RecordKey(dbTag,sz,VECTOR_RECORD),theVector.getDataPtr(),sz*sz_dbl);
+  }
+
+//! @brief Stores the ID.
+int XC::MemoryDatastore::sendID(int dbTag, int commitTag, const ID &theID, ChannelAddress *theAddress)
+  {
+    const int sz= theID.Size();
+    return send(dbTag,commitTag,RecordKey(dbTag,sz,ID_RECORD),theID.getDataPtr(),sz*sz_int);
+  }
+
+//! @brief Retrieves the ID.
+int XC::MemoryDatastore::recvID(int dbTag, int commitTag, ID &theID,ChannelAddress *theAddress)
+  {
+    const int sz= theID.Size();
+    return receive(dbTag,commitTag,RecordKey(dbTag,sz,ID_RECORD),theID.getDataPtr(),sz*sz_int);
+  }
@@ -0,0 +1,133 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MemoryDatastore.h
+
+#ifndef MemoryDatastore_h
+#define MemoryDatastore_h
+
+#include <utility/database/DBDatastore.h>
+#include <vector>
+#include <list>
+#include <map>
+#include <unordered_map>
+
+namespace XC {
+//! @ingroup Database
+//
+//! @brief Datastore that keeps the saved states in memory.
+//!
+//! The data sent for each commit tag (a "snapshot") is stored
+//! as a binary buffer along with an index that gives the position
+//! of each matrix, vector or ID in that buffer, so the restore
+//! process only needs to copy the raw data back into the objects.
+//! When the memory used by the snapshots exceeds the memory budget
+//! the least recently used snapshots are written to disk (and
+//! read again when needed).
+class MemoryDatastore: public DBDatastore
+  {
+  public:
+    //! @brief Type of the stored object.
+    enum RecordType {MATRIX_RECORD, VECTOR_RECORD, ID_RECORD};
+    //! @brief Key of a stored object.
+    struct RecordKey
+      {
+        int dbTag; //!< database tag of the object.
+        int size; //!< number of components.
+        RecordType type; //!< object type.
+        RecordKey(const int &,const int &,const RecordType &);
+        inline bool operator==(const RecordKey &other) const
+          { return (dbTag==other.dbTag) && (size==other.size) && (type==other.type); }
+      };
+    //! @brief Hash function for record keys.
+    struct RecordKeyHash
+      {
+        size_t operator()(const RecordKey &) const;
+      };
+    //! @brief Data saved for a commit tag.
+    class Snapshot
+      {
+        typedef std::unordered_map<RecordKey,size_t,RecordKeyHash> offset_map;
+        std::vector<char> buffer; //!< raw data of the records.
+        offset_map offsets; //!< position of each record in the buffer.
+        std::string spillFileName; //!< file containing the data (if not in memory).
+        size_t numBytes; //!< size of the buffer (in memory or on disk).
+      public:
+        Snapshot(void);
+        inline bool inMemory(void) const
+          { return spillFileName.empty(); }
+        inline size_t getNumBytes(void) const
+          { return numBytes; }
+        void put(const RecordKey &,const void *,const size_t &);
+        bool get(const RecordKey &,void *,const size_t &) const;
+        int spill(const std::string &);
+        int load(void);
+        void clear(void);
+      };
+  private:
+    typedef std::map<int,Snapshot> snapshot_map;
+    snapshot_map snapshots; //!< saved states.
+    std::list<int> lru; //!< commit tags sorted from most recently to least recently used.
+    size_t memoryBudget; //!< maximum number of bytes kept in memory.
+    std::string project; //!< prefix for the spill files names.
+    int lastCommitTag; //!< commit tag of the last accessed snapshot.
+    Snapshot *lastSnapshot; //!< last accessed snapshot.
+    static const size_t sz_dbl= sizeof(double);
+    static const size_t sz_int= sizeof(int);
+
+    Snapshot *getSnapshot(const int &,const bool &);
+    void touch(const int &);
+    std::string getSpillFileName(const int &) const;
+    int send(const int &,const int &,const RecordKey &,const void *,const size_t &);
+    int receive(const int &,const int &,const RecordKey &,void *,const size_t &);
+  public:
+    MemoryDatastore(const std::string &projectName, Preprocessor &preprocessor, FEM_ObjectBroker &theBroker);
+    ~MemoryDatastore(void);
+
+    int getDbTag(void) const;
+
+    int commitState(int commitTag);
+    int restoreState(int commitTag);
+
+    size_t getMemoryBudget(void) const;
+    void setMemoryBudget(const size_t &);
+    size_t getMemoryInUse(void) const;
+    size_t getNumSnapshots(void) const;
+    size_t getNumSpilledSnapshots(void) const;
+    void enforceMemoryBudget(void);
+    void clearAll(void);
+  
+    // methods for sending and recieving matrices, vectors and id's
+    int sendMsg(int dbTag, int commitTag, const Message &, ChannelAddress *theAddress= nullptr);    
+    int recvMsg(int dbTag, int commitTag, Message &, ChannelAddress *theAddress= nullptr);        
+
+    int sendMatrix(int dbTag, int commitTag, const Matrix &theMatrix, ChannelAddress *theAddress= nullptr);
+    int recvMatrix(int dbTag, int commitTag, Matrix &theMatrix, ChannelAddress *theAddress= nullptr);
+  
+    int sendVector(int dbTag, int commitTag, const Vector &,ChannelAddress *theAddress= nullptr);
+    int recvVector(int dbTag, int commitTag, Vector &,ChannelAddress *theAddress= nullptr);
+  
+    int sendID(int dbTag, int commitTag, const ID &,ChannelAddress *theAddress= nullptr);
+    int recvID(int dbTag, int commitTag, ID &theID, ChannelAddress *theAddress= nullptr);    
+  };
+} // end of XC namespace
+
+#endif
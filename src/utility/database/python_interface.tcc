@@ -36,6 +36,14 @@ class_<XC::BerkeleyDbDatastore, bases<XC::DBDatastore>, boost::noncopyable  >("B
 class_<XC::SQLiteDatastore, bases<XC::DBDatastore>, boost::noncopyable  >("SQLiteDatastore", no_init)
   ;
 
+class_<XC::MemoryDatastore, bases<XC::DBDatastore>, boost::noncopyable  >("MemoryDatastore", no_init)
+  .add_property("memoryBudget",&XC::MemoryDatastore::getMemoryBudget,&XC::MemoryDatastore::setMemoryBudget,"assign/retrieve the maximum number of bytes used to keep the saved states in memory (the least recently used states are written to disk).")
+  .add_property("memoryInUse",&XC::MemoryDatastore::getMemoryInUse,"return the number of bytes used by the states kept in memory.")
+  .def("getNumSnapshots",&XC::MemoryDatastore::getNumSnapshots,"return the number of saved states.")
+  .def("getNumSpilledSnapshots",&XC::MemoryDatastore::getNumSpilledSnapshots,"return the number of saved states written to disk.")
+  .def("clearAll",&XC::MemoryDatastore::clearAll,"remove all the saved states.")
+  ;
+
 //class_<XC::OracleDatastore, bases<XC::DBDatastore>, boost::noncopyable  >("OracleDatastore", no_init)
 //  ;
 
@@ -39,6 +39,16 @@ void export_utility(void)
         .add_property("tag", &XC::TaggedObject::getTag, &XC::TaggedObject::assignTag)
        ;
 
+    class_<XC::Profiler, boost::noncopyable >("Profiler", no_init)
+      .add_property("enabled", &XC::Profiler::getEnabled, &XC::Profiler::setEnabled,"If true, measure the time spent in each phase of the analysis.")
+      .add_property("trace", &XC::Profiler::getTraceEnabled, &XC::Profiler::setTraceEnabled,"If true, store each call as a trace event (see exportChromeTrace).")
+      .add_property("maxTraceEvents", &XC::Profiler::getMaxTraceEvents, &XC::Profiler::setMaxTraceEvents,"Maximum number of trace events stored.")
+      .add_property("numTraceEvents", &XC::Profiler::getNumTraceEvents,"Number of trace events stored.")
+      .def("reset", &XC::Profiler::reset,"Discard the collected data.")
+      .def("getData", &XC::Profiler::getPyDict,"Return a dictionary {phase: {'calls':..., 'wall':..., 'cpu':..., 'bytes':...}}.")
+      .def("exportChromeTrace", &XC::Profiler::exportChromeTrace,"Write the trace events in a JSON file (Chrome trace event format).")
+       ;
+
 #include "actor/channel/python_interface.tcc"
 #include "database/python_interface.tcc"
 #include "med_xc/python_interface.tcc"
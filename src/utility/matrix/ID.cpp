@@ -61,6 +61,7 @@
 
 
 #include <boost/python/extract.hpp>
+#include "utility/xc_python_utils.h"
 
 int XC::ID::ID_NOT_VALID_ENTRY= 0;
 
@@ -95,6 +96,21 @@ XC::ID::ID(const boost::python::list &l)
       (*this)[i]= boost::python::extract<int>(l[i]);
   }
 
+//! @brief Constructor (Python interface). If the object exports
+//! a buffer (i.e. NumPy arrays) its contents are copied in bulk,
+//! otherwise the object is read as a sequence.
+XC::ID::ID(const boost::python::object &o)
+  : EntCmd(), std::vector<int>()
+  {
+    if(!id_from_py_buffer(o,*this))
+      {
+        const size_t sz= len(o);
+        resize(sz);
+        for(size_t i=0; i<sz; i++)
+          (*this)[i]= boost::python::extract<int>(o[i]);
+      }
+  }
+
 XC::ID::ID(const std::set<int> &setInt)
   : EntCmd(), std::vector<int>(setInt.size())
   {
@@ -102,6 +102,7 @@ class ID: public EntCmd, public std::vector<int>
     explicit ID(const int &);
     explicit ID(const v_int &);
     ID(const boost::python::list &);
+    explicit ID(const boost::python::object &);
     explicit ID(const std::set<int> &);
     template <class InputIterator>
     inline ID(InputIterator first, InputIterator last)
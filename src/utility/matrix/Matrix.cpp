@@ -70,11 +70,12 @@
 //#include <boost/any.hpp>
 
 #include "AuxMatrix.h"
+#include "utility/xc_python_utils.h"
 
 #define MATRIX_WORK_AREA 400
 #define INT_WORK_AREA 20
 
-XC::AuxMatrix XC::Matrix::auxMatrix(MATRIX_WORK_AREA,INT_WORK_AREA);
+thread_local XC::AuxMatrix XC::Matrix::auxMatrix(MATRIX_WORK_AREA,INT_WORK_AREA);
 double XC::Matrix::MATRIX_NOT_VALID_ENTRY =0.0;
 
 //! @brief Default constructor.
@@ -163,6 +164,26 @@ XC::Matrix::Matrix(const boost::python::list &l)
       }
   }
 
+//! @brief Constructor (Python interface). If the object exports
+//! a two dimensional buffer (i.e. NumPy arrays) its contents are copied
+//! in bulk, otherwise the object is read as a sequence of rows.
+XC::Matrix::Matrix(const boost::python::object &o)
+  :numRows(0), numCols(0)
+  {
+    if(!matrix_from_py_buffer(o,*this))
+      {
+        const int nRows= len(o);
+        const int nCols= (nRows>0 ? len(o[0]) : 0);
+        resize(nRows,nCols);
+        for(int i=0; i<numRows; i++)
+          {
+            boost::python::object rowI= o[i];
+            for(int j= 0; j<numCols;j++)
+              (*this)(i,j)= boost::python::extract<double>(rowI[j]);
+          }
+      }
+  }
+
 //
 // METHODS - Zero, Assemble, Solve
 //
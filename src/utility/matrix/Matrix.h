@@ -109,7 +109,7 @@ class Matrix: public EntCmd
   {
   private:
     static double MATRIX_NOT_VALID_ENTRY;
-    static AuxMatrix auxMatrix;
+    static thread_local AuxMatrix auxMatrix;
 
     int numRows;
     int numCols;
@@ -128,6 +128,7 @@ class Matrix: public EntCmd
     Matrix(int nrows, int ncols);
     Matrix(double *data, int nrows, int ncols);
     Matrix(const boost::python::list &l);
+    explicit Matrix(const boost::python::object &);
     inline virtual ~Matrix(void) {}
 
     // utility methods
@@ -70,6 +70,7 @@
 
 #include "xc_utils/src/geom/pos_vec/Vector2d.h"
 #include "xc_utils/src/geom/pos_vec/Vector3d.h"
+#include "utility/xc_python_utils.h"
 
 double XC::Vector::VECTOR_NOT_VALID_ENTRY =0.0;
 
@@ -149,6 +150,20 @@ XC::Vector::Vector(const boost::python::list &l)
       theData[i]= boost::python::extract<double>(l[i]);
   }
 
+//! @brief Constructor (Python interface). If the object exports
+//! a buffer (i.e. NumPy arrays) its contents are copied in bulk,
+//! otherwise the object is read as a sequence.
+XC::Vector::Vector(const boost::python::object &o)
+  :sz(0), theData(nullptr), fromFree(0)
+  {
+    if(!vector_from_py_buffer(o,*this))
+      {
+        alloc(len(o));
+        for(int i=0; i<sz; i++)
+          theData[i]= boost::python::extract<double>(o[i]);
+      }
+  }
+
 //! @brief Copy from Vector2d.
 XC::Vector::Vector(const Vector2d &v)
   : sz(0), theData(nullptr), fromFree(0)
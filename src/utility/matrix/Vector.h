@@ -110,6 +110,7 @@ class Vector: public EntCmd
     Vector(const Vector &);    
     Vector(double *data, int size);
     Vector(const boost::python::list &);
+    explicit Vector(const boost::python::object &);
     virtual ~Vector(void);
 
     // utility methods
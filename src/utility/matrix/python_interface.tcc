@@ -23,10 +23,12 @@
 
 class_<XC::ID, bases<EntCmd> >("ID")
   .def(vector_indexing_suite<XC::ID>() )  
+  .def(init<boost::python::object>())
   .def(init<boost::python::list>())
   .def(init<std::set<int> >())
   .def(init<std::vector<int> >())
   .def(self_ns::str(self_ns::self))
+  .add_property("__array_interface__",XC::xc_id_array_interface,"NumPy array interface; numpy.asarray(id) returns an array that shares the memory of the ID (don't resize the ID while the array is alive).")
   // .def(self + self)
   // .def(self - self)
   // .def(self += self)
@@ -41,6 +43,7 @@ def("id_to_py_list",XC::xc_id_to_py_list);
 
 double &(XC::Vector::*getItemVector)(const size_t &)= &XC::Vector::at;
 class_<XC::Vector, bases<EntCmd> >("Vector")
+  .def(init<boost::python::object>())
   .def(init<boost::python::list>())
   .def("__getitem__",getItemVector, return_value_policy<return_by_value>())
 //  .def( "__getitem__", getItemVector, boost::python::arg( "index" ), boost::python::return_internal_reference<>() )
@@ -64,6 +67,7 @@ class_<XC::Vector, bases<EntCmd> >("Vector")
   .def("putComponents",&XC::Vector::putComponents,"Assigns the specified values to the specified set of vector components")
   .def("addComponents",&XC::Vector::addComponents,"Sums the specified values to the specified set of vector components")
   .def("Normalized",&XC::Vector::Normalized,"Returns normalizxed vector.")
+  .add_property("__array_interface__",XC::xc_vector_array_interface,"NumPy array interface; numpy.asarray(v) returns an array that shares the memory of the vector (don't resize the vector while the array is alive).")
   ;
 
 
@@ -72,6 +76,7 @@ implicitly_convertible<boost::python::list,XC::Vector>();
 
 double &(XC::Matrix::*at)(int,int)= &XC::Matrix::operator();
 class_<XC::Matrix, bases<EntCmd> >("Matrix")
+  .def(init<boost::python::object>())
   .def(init<boost::python::list>())
   .def("__call__",at, return_value_policy<return_by_value>())
   .def(self * double())
@@ -94,6 +99,7 @@ class_<XC::Matrix, bases<EntCmd> >("Matrix")
   .def("columnNorm",&XC::Matrix::columnNorm,"Column norm.")
   .def("Norm2",&XC::Matrix::Norm2,"Returns squared value of euclidean norm.")
   .def("Norm",&XC::Matrix::Norm,"Returns euclidean norm.")
+  .add_property("__array_interface__",XC::xc_matrix_array_interface,"NumPy array interface (column-major storage); numpy.asarray(m) returns an array that shares the memory of the matrix (don't resize the matrix while the array is alive).")
    ;
 
 
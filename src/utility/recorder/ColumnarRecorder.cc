@@ -0,0 +1,85 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ColumnarRecorder.cc
+
+#include <utility/recorder/ColumnarRecorder.h>
+#include <boost/lexical_cast.hpp>
+
+//! @brief Constructor.
+XC::ColumnarRecorder::ColumnarRecorder(int classTag,Domain *ptr_dom)
+  : PropRecorder(classTag,ptr_dom), compressionLevel(0) {}
+
+//! @brief Destructor (closes the file).
+XC::ColumnarRecorder::~ColumnarRecorder(void)
+  { close(); }
+
+//! @brief Opens the results file (removing its previous contents).
+int XC::ColumnarRecorder::open(const std::string &nmb)
+  {
+    fileName= nmb;
+    const int retval= writer.open(fileName,getColumns(),compressionLevel);
+    if(retval!=0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; can't open results file: '" << fileName
+                << "'." << std::endl;
+    return retval;
+  }
+
+//! @brief Writes the last chunk and the indexes and closes the file.
+//! The file can't be read until it's closed.
+int XC::ColumnarRecorder::close(void)
+  { return writer.close(); }
+
+//! @brief Returns the number of chunks (combinations) already
+//! written to the file.
+size_t XC::ColumnarRecorder::getNumChunks(void) const
+  { return writer.getNumChunks()+(writer.isChunkOpen() ? 1 : 0); }
+
+//! @brief Writes the results of the current combination when
+//! commit is triggered.
+int XC::ColumnarRecorder::record(int commitTag, double timeStamp)
+  {
+    int retval= 0;
+    lastCommitTag= commitTag;
+    lastTimeStamp= timeStamp;
+    if(!writer.isOpen())
+      return 0; //Nothing to do (file not open or already closed).
+    std::string combName= getCurrentCombinationName();
+    if(combName.empty())
+      combName= boost::lexical_cast<std::string>(commitTag);
+    if(writer.isChunkOpen() && (writer.getCurrentChunkName()==combName))
+      writer.discardChunk(); //Keep the results of the last commit.
+    retval= writer.beginChunk(combName);
+    if(retval==0)
+      retval= write_rows();
+    return retval;
+  }
+
+//! @brief Restarts the recorder (the results already written are
+//! kept, so the file accumulates the results of all the load
+//! combinations analyzed until it's closed).
+int XC::ColumnarRecorder::restart(void)
+  {
+    lastCommitTag= -1;
+    lastTimeStamp= -1.0;
+    return 0;
+  }
@@ -0,0 +1,75 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ColumnarRecorder.h
+
+#ifndef ColumnarRecorder_h
+#define ColumnarRecorder_h
+
+#include <utility/recorder/PropRecorder.h>
+#include <utility/recorder/ColumnarResultsWriter.h>
+
+namespace XC {
+
+//! @ingroup Recorder
+//
+//! @brief Base class for the recorders that write the results
+//! (internal forces, displacements,...) of each load combination
+//! in a chunk of a columnar results file (see ColumnarResultsFile).
+//!
+//! If the same combination is recorded more than once (i.e. an
+//! analysis with many steps) the results of the last commit are kept.
+class ColumnarRecorder: public PropRecorder
+  {
+  protected:
+    ColumnarResultsWriter writer; //!< Results file writer.
+    std::string fileName; //!< Name of the results file.
+    int compressionLevel; //!< Compression level (0: no compression).
+
+    //! @brief Returns the definition of the columns of the file.
+    virtual ColumnarResultsFile::column_vector getColumns(void) const= 0;
+    //! @brief Appends the rows that correspond to the current state.
+    virtual int write_rows(void)= 0;
+  public:
+    ColumnarRecorder(int classTag, Domain *ptr_dom= nullptr);
+    ~ColumnarRecorder(void);
+
+    int open(const std::string &);
+    int close(void);
+    //! @brief Returns the name of the results file.
+    inline const std::string &getFileName(void) const
+      { return fileName; }
+    //! @brief Returns the compression level.
+    inline int getCompressionLevel(void) const
+      { return compressionLevel; }
+    //! @brief Sets the compression level (zlib: 0 to 9) of the
+    //! files opened from now on.
+    inline void setCompressionLevel(const int &l)
+      { compressionLevel= l; }
+    size_t getNumChunks(void) const;
+
+    virtual int record(int,double);
+    virtual int restart(void);
+  };
+
+} // end of XC namespace
+
+#endif
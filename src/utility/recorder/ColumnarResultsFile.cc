@@ -0,0 +1,160 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ColumnarResultsFile.cc
+
+#include "ColumnarResultsFile.h"
+#include <algorithm>
+#include <iostream>
+
+const char XC::ColumnarResultsFile::magic[8]= {'X','C','C','O','L','R','E','S'};
+const char XC::ColumnarResultsFile::endMagic[8]= {'X','C','C','O','L','E','N','D'};
+const uint32_t XC::ColumnarResultsFile::version= 1;
+
+//! @brief Returns the size of the values of the column.
+size_t XC::ColumnarResultsFile::Column::getItemSize(void) const
+  {
+    size_t retval= 0;
+    if(type==INT32)
+      retval= sizeof(int32_t);
+    else if(type==FLOAT64)
+      retval= sizeof(double);
+    return retval;
+  }
+
+//! @brief Builds the index from the values of the key column.
+//!
+//! The rows with the same key are expected to be contiguous (i.e.
+//! the sections of an element); if they are not, the index
+//! stores the first group of rows for each key.
+void XC::ColumnarResultsFile::KeyIndex::build(const int32_t *values,const size_t &sz)
+  {
+    std::vector<int32_t> tmpKeys;
+    std::vector<uint64_t> tmpFirst, tmpNum;
+    size_t i= 0;
+    while(i<sz)
+      {
+        const int32_t key= values[i];
+        size_t j= i+1;
+        while((j<sz) && (values[j]==key))
+          j++;
+        tmpKeys.push_back(key);
+        tmpFirst.push_back(i);
+        tmpNum.push_back(j-i);
+        i= j;
+      }
+    //Sort the groups by key.
+    const size_t ng= tmpKeys.size();
+    std::vector<size_t> perm(ng);
+    for(size_t k= 0;k<ng;k++)
+      perm[k]= k;
+    std::stable_sort(perm.begin(),perm.end(),[&](size_t a,size_t b) { return tmpKeys[a]<tmpKeys[b]; });
+    keys.clear(); firstRows.clear(); numRows.clear();
+    keys.reserve(ng); firstRows.reserve(ng); numRows.reserve(ng);
+    for(size_t k= 0;k<ng;k++)
+      {
+        const size_t p= perm[k];
+        if(!keys.empty() && (keys.back()==tmpKeys[p]))
+          continue; //Repeated key.
+        keys.push_back(tmpKeys[p]);
+        firstRows.push_back(tmpFirst[p]);
+        numRows.push_back(tmpNum[p]);
+      }
+  }
+
+//! @brief Returns the position of the key in the index (-1 if not found).
+int XC::ColumnarResultsFile::KeyIndex::find(const int32_t &key) const
+  {
+    int retval= -1;
+    std::vector<int32_t>::const_iterator i= std::lower_bound(keys.begin(),keys.end(),key);
+    if((i!=keys.end()) && (*i==key))
+      retval= i-keys.begin();
+    return retval;
+  }
+
+//! @brief Removes the column and chunk definitions.
+void XC::ColumnarResultsFile::clear_file_data(void)
+  {
+    columns.clear();
+    chunks.clear();
+    layouts.clear();
+    chunkIndexes.clear();
+  }
+
+//! @brief Groups the bytes of the values by significance (the
+//! most significant bytes of the floating point numbers are very
+//! similar, so the shuffled block compresses much better).
+//!
+//! @param src: values to shuffle.
+//! @param dst: shuffled values.
+//! @param n: number of values.
+//! @param itemSize: size of each value.
+void XC::ColumnarResultsFile::shuffle(const char *src,char *dst,const size_t &n,const size_t &itemSize)
+  {
+    for(size_t i= 0;i<n;i++)
+      for(size_t b= 0;b<itemSize;b++)
+        dst[b*n+i]= src[i*itemSize+b];
+  }
+
+//! @brief Reverts the shuffle operation.
+void XC::ColumnarResultsFile::unshuffle(const char *src,char *dst,const size_t &n,const size_t &itemSize)
+  {
+    for(size_t i= 0;i<n;i++)
+      for(size_t b= 0;b<itemSize;b++)
+        dst[i*itemSize+b]= src[b*n+i];
+  }
+
+//! @brief Returns the index of the column whose name is being passed
+//! as parameter (-1 if not found).
+int XC::ColumnarResultsFile::getColumnIndex(const std::string &name) const
+  {
+    int retval= -1;
+    const size_t sz= columns.size();
+    for(size_t i= 0;i<sz;i++)
+      if(columns[i].name==name)
+        {
+          retval= i;
+          break;
+        }
+    return retval;
+  }
+
+//! @brief Returns the index of the chunk whose name is being passed
+//! as parameter (-1 if not found). If there are many chunks with
+//! the same name it returns the last one.
+int XC::ColumnarResultsFile::getChunkIndex(const std::string &name) const
+  {
+    int retval= -1;
+    std::map<std::string,size_t>::const_iterator i= chunkIndexes.find(name);
+    if(i!=chunkIndexes.end())
+      retval= i->second;
+    return retval;
+  }
+
+//! @brief Returns the names of the chunks.
+std::vector<std::string> XC::ColumnarResultsFile::getChunkNames(void) const
+  {
+    std::vector<std::string> retval;
+    retval.reserve(chunks.size());
+    for(std::vector<Chunk>::const_iterator i= chunks.begin();i!=chunks.end();i++)
+      retval.push_back(i->name);
+    return retval;
+  }
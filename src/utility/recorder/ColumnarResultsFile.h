@@ -0,0 +1,130 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ColumnarResultsFile.h
+
+#ifndef ColumnarResultsFile_h
+#define ColumnarResultsFile_h
+
+#include <string>
+#include <vector>
+#include <map>
+#include <cstdint>
+
+namespace XC {
+
+//! @ingroup Recorder
+//
+//! @brief Base class for the writer and the reader of the
+//! columnar results files.
+//!
+//! A columnar results file stores a table (i.e. element tag, section
+//! index and internal forces) for each load combination (chunk). Each
+//! column of each chunk is stored as a contiguous block of typed values
+//! aligned to 8 bytes, optionally compressed (byte shuffle and zlib
+//! deflate). Layout of the file:
+//!
+//! - Header: magic string, version, column names and types.
+//! - Column blocks of each chunk.
+//! - Footer: descriptors of the chunks (name, number of rows and
+//!   position of its column blocks) and indexes of the first column
+//!   (i.e. element or node tags) of the chunks.
+//! - Trailer: footer position and end magic string.
+//!
+//! The chunks whose first columns are equal share the same index, so
+//! the index of a model with many combinations is stored only once.
+class ColumnarResultsFile
+  {
+  public:
+    //! @brief Type of the values of a column.
+    enum ColumnType {INT32= 1, FLOAT64= 2};
+    //! @brief Codec used to store a column block.
+    enum Codec {RAW= 0, SHUFFLE_DEFLATE= 1};
+    //! @brief Column definition.
+    struct Column
+      {
+        std::string name; //!< Column name.
+        uint8_t type; //!< Column type.
+        Column(const std::string &nmb= "",const uint8_t &t= FLOAT64)
+          : name(nmb), type(t) {}
+        size_t getItemSize(void) const;
+      };
+    typedef std::vector<Column> column_vector;
+    //! @brief Position of a column block in the file.
+    struct Block
+      {
+        uint64_t offset; //!< Position of the block in the file.
+        uint64_t storedSize; //!< Size of the block in the file.
+        uint64_t rawSize; //!< Size of the (decompressed) values.
+        uint8_t codec; //!< Codec used to store the block.
+        Block(void)
+          : offset(0), storedSize(0), rawSize(0), codec(RAW) {}
+      };
+    //! @brief Chunk (i.e. results of a load combination) descriptor.
+    struct Chunk
+      {
+        std::string name; //!< Chunk name (i.e. load combination name).
+        uint64_t numRows; //!< Number of rows.
+        uint64_t layout; //!< Index of the key index of the chunk.
+        std::vector<Block> blocks; //!< Column blocks.
+        Chunk(const std::string &nmb= "")
+          : name(nmb), numRows(0), layout(0) {}
+      };
+    //! @brief Index of the values of the first column (key)
+    //! of the chunks: sorted keys, first row and number of rows
+    //! of each key.
+    struct KeyIndex
+      {
+        std::vector<int32_t> keys; //!< Sorted keys.
+        std::vector<uint64_t> firstRows; //!< First row of each key.
+        std::vector<uint64_t> numRows; //!< Number of rows of each key.
+        void build(const int32_t *,const size_t &);
+        int find(const int32_t &) const;
+      };
+  protected:
+    static const char magic[8];
+    static const char endMagic[8];
+    static const uint32_t version;
+
+    column_vector columns; //!< Column definitions.
+    std::vector<Chunk> chunks; //!< Chunks descriptors.
+    std::vector<KeyIndex> layouts; //!< Key indexes of the chunks.
+    std::map<std::string,size_t> chunkIndexes; //!< Chunk name to chunk index table.
+
+    void clear_file_data(void);
+    static void shuffle(const char *,char *,const size_t &,const size_t &);
+    static void unshuffle(const char *,char *,const size_t &,const size_t &);
+  public:
+    virtual ~ColumnarResultsFile(void) {}
+    inline const column_vector &getColumns(void) const
+      { return columns; }
+    int getColumnIndex(const std::string &) const;
+    inline size_t getNumColumns(void) const
+      { return columns.size(); }
+    inline size_t getNumChunks(void) const
+      { return chunks.size(); }
+    int getChunkIndex(const std::string &) const;
+    std::vector<std::string> getChunkNames(void) const;
+  };
+
+} // end of XC namespace
+
+#endif
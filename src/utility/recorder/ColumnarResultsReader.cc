@@ -0,0 +1,452 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ColumnarResultsReader.cc
+
+#include "ColumnarResultsReader.h"
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/ID.h"
+#include "utility/xc_python_utils.h"
+#include <cstring>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <zlib.h>
+
+namespace XC {
+//! @brief Reads the values from a memory block checking its bounds.
+class BlockCursor
+  {
+    const char *ptr; //!< Current position.
+    const char *end; //!< End of the block.
+    bool ok; //!< False if we've tried to read beyond the end.
+  public:
+    BlockCursor(const char *b,const char *e)
+      : ptr(b), end(e), ok(true) {}
+    inline bool good(void) const
+      { return ok; }
+    //! @brief Copies sz bytes into dst.
+    void read(void *dst,const size_t &sz)
+      {
+        if(ok && (static_cast<size_t>(end-ptr)>=sz))
+          {
+            memcpy(dst,ptr,sz);
+            ptr+= sz;
+          }
+        else
+          ok= false;
+      }
+    template <class T>
+    inline void read(T &value)
+      { read(&value,sizeof(T)); }
+    //! @brief Reads a string (length followed by characters).
+    void read(std::string &s)
+      {
+        uint32_t len= 0;
+        read(len);
+        if(ok && (static_cast<size_t>(end-ptr)>=len))
+          {
+            s.assign(ptr,len);
+            ptr+= len;
+          }
+        else
+          ok= false;
+      }
+    //! @brief Reads n values into the vector.
+    template <class T>
+    void read(std::vector<T> &v,const size_t &n)
+      {
+        if(ok && ((static_cast<size_t>(end-ptr)/sizeof(T))>=n))
+          {
+            v.resize(n);
+            read(v.data(),n*sizeof(T));
+          }
+        else
+          ok= false;
+      }
+  };
+} // end of XC namespace
+
+//! @brief Default constructor.
+XC::ColumnarResultsReader::ColumnarResultsReader(void)
+  : EntCmd(), base(nullptr), fileSize(0) {}
+
+//! @brief Constructor (opens the file).
+XC::ColumnarResultsReader::ColumnarResultsReader(const std::string &nmb)
+  : EntCmd(), base(nullptr), fileSize(0)
+  { open(nmb); }
+
+//! @brief Destructor.
+XC::ColumnarResultsReader::~ColumnarResultsReader(void)
+  { close(); }
+
+//! @brief Opens (memory maps) the file and reads its header
+//! and its footer.
+int XC::ColumnarResultsReader::open(const std::string &nmb)
+  {
+    close();
+    const int fd= ::open(nmb.c_str(),O_RDONLY);
+    if(fd<0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; can't open file: '" << nmb << "'." << std::endl;
+        return -1;
+      }
+    struct stat st;
+    if((fstat(fd,&st)!=0) || (st.st_size==0))
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; can't get the size of file: '" << nmb
+                  << "' or it's empty." << std::endl;
+        ::close(fd);
+        return -1;
+      }
+    void *ptr= mmap(nullptr,st.st_size,PROT_READ,MAP_SHARED,fd,0);
+    ::close(fd); //The mapping keeps the file open.
+    if(ptr==MAP_FAILED)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; can't map file: '" << nmb << "'." << std::endl;
+        return -1;
+      }
+    base= reinterpret_cast<const char *>(ptr);
+    fileSize= st.st_size;
+    fileName= nmb;
+    const int retval= read_structure();
+    if(retval!=0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; file: '" << nmb
+                  << "' is not a valid (or complete) columnar results file."
+                  << std::endl;
+        close();
+      }
+    return retval;
+  }
+
+//! @brief Unmaps the file.
+void XC::ColumnarResultsReader::close(void)
+  {
+    if(base)
+      munmap(const_cast<char *>(base),fileSize);
+    base= nullptr;
+    fileSize= 0;
+    fileName.clear();
+    decoded.clear();
+    clear_file_data();
+  }
+
+//! @brief Reads the column definitions, the indexes and the
+//! chunk descriptors.
+int XC::ColumnarResultsReader::read_structure(void)
+  {
+    const size_t trailerSize= sizeof(uint64_t)+sizeof(endMagic);
+    if(fileSize<(sizeof(magic)+trailerSize))
+      return -1;
+    if(memcmp(base,magic,sizeof(magic))!=0)
+      return -1;
+    const char *trailer= base+fileSize-trailerSize;
+    if(memcmp(trailer+sizeof(uint64_t),endMagic,sizeof(endMagic))!=0)
+      return -1; //File not closed.
+    //Header.
+    BlockCursor header(base+sizeof(magic),trailer);
+    uint32_t v= 0, nc= 0;
+    header.read(v);
+    header.read(nc);
+    if(!header.good() || (v!=version))
+      return -1;
+    for(uint32_t i= 0;i<nc;i++)
+      {
+        Column c;
+        header.read(c.type);
+        header.read(c.name);
+        columns.push_back(c);
+      }
+    //Footer.
+    uint64_t footerOffset= 0;
+    memcpy(&footerOffset,trailer,sizeof(footerOffset));
+    if(!header.good() || (footerOffset>=fileSize))
+      return -1;
+    BlockCursor footer(base+footerOffset,trailer);
+    uint64_t nl= 0;
+    footer.read(nl);
+    for(uint64_t i= 0;(i<nl) && footer.good();i++)
+      {
+        KeyIndex index;
+        uint64_t n= 0;
+        footer.read(n);
+        footer.read(index.keys,n);
+        footer.read(index.firstRows,n);
+        footer.read(index.numRows,n);
+        layouts.push_back(index);
+      }
+    uint64_t nch= 0;
+    footer.read(nch);
+    for(uint64_t i= 0;(i<nch) && footer.good();i++)
+      {
+        Chunk chunk;
+        footer.read(chunk.name);
+        footer.read(chunk.numRows);
+        footer.read(chunk.layout);
+        chunk.blocks.resize(nc);
+        for(uint32_t j= 0;j<nc;j++)
+          {
+            Block &b= chunk.blocks[j];
+            footer.read(b.offset);
+            footer.read(b.storedSize);
+            footer.read(b.rawSize);
+            footer.read(b.codec);
+            if((b.offset+b.storedSize>footerOffset) || (b.rawSize!=chunk.numRows*columns[j].getItemSize()))
+              return -1;
+          }
+        if(chunk.layout>=layouts.size())
+          return -1;
+        chunkIndexes[chunk.name]= chunks.size();
+        chunks.push_back(chunk);
+      }
+    return (footer.good() ? 0 : -1);
+  }
+
+//! @brief Returns the address of the values of the column of the
+//! chunk (decompressing them if needed).
+const char *XC::ColumnarResultsReader::get_column_data(const size_t &iChunk,const size_t &iCol) const
+  {
+    const Block &b= chunks[iChunk].blocks[iCol];
+    if(b.codec==RAW)
+      return base+b.offset;
+    const std::pair<size_t,size_t> key(iChunk,iCol);
+    std::map<std::pair<size_t,size_t>,std::vector<char> >::const_iterator i= decoded.find(key);
+    if(i!=decoded.end())
+      return i->second.data();
+    const char *retval= nullptr;
+    if(b.codec==SHUFFLE_DEFLATE)
+      {
+        std::vector<char> shuffled(b.rawSize);
+        uLongf destLen= b.rawSize;
+        const int ok= uncompress(reinterpret_cast<Bytef *>(shuffled.data()),&destLen,reinterpret_cast<const Bytef *>(base+b.offset),b.storedSize);
+        if((ok==Z_OK) && (destLen==b.rawSize))
+          {
+            std::vector<char> &values= decoded[key];
+            values.resize(b.rawSize);
+            unshuffle(shuffled.data(),values.data(),chunks[iChunk].numRows,columns[iCol].getItemSize());
+            retval= values.data();
+          }
+        else
+          std::cerr << getClassName() << "::" << __FUNCTION__
+                    << "; error decompressing column: '"
+                    << columns[iCol].name << "' of chunk: '"
+                    << chunks[iChunk].name << "'." << std::endl;
+      }
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; unknown codec: " << int(b.codec) << std::endl;
+    return retval;
+  }
+
+//! @brief Computes the indexes of the chunk and the column whose
+//! names are being passed as parameters.
+int XC::ColumnarResultsReader::get_column(const std::string &chunkName,const std::string &colName,size_t &iChunk,size_t &iCol) const
+  {
+    const int ich= getChunkIndex(chunkName);
+    const int icl= getColumnIndex(colName);
+    if(ich<0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; chunk: '" << chunkName << "' not found."
+                  << std::endl;
+        return -1;
+      }
+    if(icl<0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; column: '" << colName << "' not found."
+                  << std::endl;
+        return -1;
+      }
+    iChunk= ich;
+    iCol= icl;
+    return 0;
+  }
+
+//! @brief Returns the names of the columns.
+boost::python::list XC::ColumnarResultsReader::getColumnNamesPy(void) const
+  {
+    boost::python::list retval;
+    for(column_vector::const_iterator i= columns.begin();i!=columns.end();i++)
+      retval.append(i->name);
+    return retval;
+  }
+
+//! @brief Returns the names of the chunks (i.e. load combinations).
+boost::python::list XC::ColumnarResultsReader::getChunkNamesPy(void) const
+  {
+    boost::python::list retval;
+    for(std::vector<Chunk>::const_iterator i= chunks.begin();i!=chunks.end();i++)
+      retval.append(i->name);
+    return retval;
+  }
+
+//! @brief Returns the number of rows of the chunk.
+size_t XC::ColumnarResultsReader::getNumRows(const std::string &chunkName) const
+  {
+    size_t retval= 0;
+    const int i= getChunkIndex(chunkName);
+    if(i>=0)
+      retval= chunks[i].numRows;
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; chunk: '" << chunkName << "' not found."
+                << std::endl;
+    return retval;
+  }
+
+//! @brief Returns a pointer to the values of an INT32 column
+//! (nullptr if not found).
+const int32_t *XC::ColumnarResultsReader::getIntColumnPtr(const std::string &chunkName,const std::string &colName) const
+  {
+    const int32_t *retval= nullptr;
+    size_t iChunk= 0, iCol= 0;
+    if(get_column(chunkName,colName,iChunk,iCol)==0)
+      {
+        if(columns[iCol].type==INT32)
+          retval= reinterpret_cast<const int32_t *>(get_column_data(iChunk,iCol));
+        else
+          std::cerr << getClassName() << "::" << __FUNCTION__
+                    << "; column: '" << colName << "' is not of type INT32."
+                    << std::endl;
+      }
+    return retval;
+  }
+
+//! @brief Returns a pointer to the values of a FLOAT64 column
+//! (nullptr if not found).
+const double *XC::ColumnarResultsReader::getDoubleColumnPtr(const std::string &chunkName,const std::string &colName) const
+  {
+    const double *retval= nullptr;
+    size_t iChunk= 0, iCol= 0;
+    if(get_column(chunkName,colName,iChunk,iCol)==0)
+      {
+        if(columns[iCol].type==FLOAT64)
+          retval= reinterpret_cast<const double *>(get_column_data(iChunk,iCol));
+        else
+          std::cerr << getClassName() << "::" << __FUNCTION__
+                    << "; column: '" << colName << "' is not of type FLOAT64."
+                    << std::endl;
+      }
+    return retval;
+  }
+
+//! @brief Returns a copy of the values of an INT32 column.
+XC::ID XC::ColumnarResultsReader::getIntColumn(const std::string &chunkName,const std::string &colName) const
+  {
+    ID retval;
+    const int32_t *ptr= getIntColumnPtr(chunkName,colName);
+    if(ptr)
+      {
+        const size_t sz= getNumRows(chunkName);
+        retval.resize(sz);
+        for(size_t i= 0;i<sz;i++)
+          retval(i)= ptr[i];
+      }
+    return retval;
+  }
+
+//! @brief Returns a copy of the values of a FLOAT64 column.
+XC::Vector XC::ColumnarResultsReader::getDoubleColumn(const std::string &chunkName,const std::string &colName) const
+  {
+    Vector retval;
+    const double *ptr= getDoubleColumnPtr(chunkName,colName);
+    if(ptr)
+      {
+        const size_t sz= getNumRows(chunkName);
+        retval.resize(sz);
+        memcpy(retval.getDataPtr(),ptr,sz*sizeof(double));
+      }
+    return retval;
+  }
+
+//! @brief Returns the NumPy array interface (version 3, read only) of
+//! the column. The array shares the memory of the mapped file (or the
+//! decompressed values), so it becomes invalid when the reader is
+//! closed or destroyed.
+boost::python::dict XC::ColumnarResultsReader::getArrayInterface(const std::string &chunkName,const std::string &colName) const
+  {
+    boost::python::dict retval;
+    size_t iChunk= 0, iCol= 0;
+    if(get_column(chunkName,colName,iChunk,iCol)==0)
+      {
+        const char *ptr= get_column_data(iChunk,iCol);
+        if(ptr)
+          {
+            const Column &c= columns[iCol];
+            const char kind= (c.type==INT32) ? 'i' : 'f';
+            retval= xc_buffer_array_interface(ptr,kind,c.getItemSize(),chunks[iChunk].numRows,true);
+          }
+      }
+    return retval;
+  }
+
+//! @brief Returns the (sorted) keys (i.e. element tags) of the chunk.
+XC::ID XC::ColumnarResultsReader::getKeys(const std::string &chunkName) const
+  {
+    ID retval;
+    const int i= getChunkIndex(chunkName);
+    if(i>=0)
+      {
+        const std::vector<int32_t> &keys= layouts[chunks[i].layout].keys;
+        const size_t sz= keys.size();
+        retval.resize(sz);
+        for(size_t j= 0;j<sz;j++)
+          retval(j)= keys[j];
+      }
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; chunk: '" << chunkName << "' not found."
+                << std::endl;
+    return retval;
+  }
+
+//! @brief Returns the values of the FLOAT64 column for the rows of
+//! the chunk whose key is being passed as parameter (i.e. the axial
+//! forces in each section of an element).
+XC::Vector XC::ColumnarResultsReader::getValues(const std::string &chunkName,const int &key,const std::string &colName) const
+  {
+    Vector retval;
+    const double *ptr= getDoubleColumnPtr(chunkName,colName);
+    if(ptr)
+      {
+        const KeyIndex &index= layouts[chunks[getChunkIndex(chunkName)].layout];
+        const int i= index.find(key);
+        if(i>=0)
+          {
+            const size_t first= index.firstRows[i];
+            const size_t n= index.numRows[i];
+            retval.resize(n);
+            memcpy(retval.getDataPtr(),ptr+first,n*sizeof(double));
+          }
+        else
+          std::cerr << getClassName() << "::" << __FUNCTION__
+                    << "; key: " << key << " not found in chunk: '"
+                    << chunkName << "'." << std::endl;
+      }
+    return retval;
+  }
@@ -0,0 +1,84 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ColumnarResultsReader.h
+
+#ifndef ColumnarResultsReader_h
+#define ColumnarResultsReader_h
+
+#include "xc_utils/src/nucleo/EntCmd.h"
+#include "ColumnarResultsFile.h"
+#include <boost/python/list.hpp>
+#include <boost/python/dict.hpp>
+
+namespace XC {
+class Vector;
+class ID;
+
+//! @ingroup Recorder
+//
+//! @brief Reads a columnar results file (see ColumnarResultsFile).
+//!
+//! The file is memory mapped, so the values of the uncompressed
+//! columns are accessed without copying them (i.e. they can be
+//! viewed as NumPy arrays through getArrayInterface). The compressed
+//! columns are decompressed on first access and kept in memory.
+class ColumnarResultsReader: public EntCmd, public ColumnarResultsFile
+  {
+    std::string fileName; //!< Name of the file.
+    const char *base; //!< Address of the mapped file.
+    size_t fileSize; //!< Size of the file.
+    mutable std::map<std::pair<size_t,size_t>,std::vector<char> > decoded; //!< Decompressed column blocks.
+
+    int read_structure(void);
+    int get_column(const std::string &,const std::string &,size_t &,size_t &) const;
+    const char *get_column_data(const size_t &,const size_t &) const;
+    ColumnarResultsReader(const ColumnarResultsReader &);
+    ColumnarResultsReader &operator=(const ColumnarResultsReader &);
+  public:
+    ColumnarResultsReader(void);
+    ColumnarResultsReader(const std::string &);
+    ~ColumnarResultsReader(void);
+
+    int open(const std::string &);
+    void close(void);
+    //! @brief Returns true if the file is open.
+    inline bool isOpen(void) const
+      { return (base!=nullptr); }
+    //! @brief Returns the name of the file.
+    inline const std::string &getFileName(void) const
+      { return fileName; }
+
+    boost::python::list getColumnNamesPy(void) const;
+    boost::python::list getChunkNamesPy(void) const;
+    size_t getNumRows(const std::string &) const;
+    const int32_t *getIntColumnPtr(const std::string &,const std::string &) const;
+    const double *getDoubleColumnPtr(const std::string &,const std::string &) const;
+    ID getIntColumn(const std::string &,const std::string &) const;
+    Vector getDoubleColumn(const std::string &,const std::string &) const;
+    boost::python::dict getArrayInterface(const std::string &,const std::string &) const;
+    ID getKeys(const std::string &) const;
+    Vector getValues(const std::string &,const int &,const std::string &) const;
+  };
+
+} // end of XC namespace
+
+#endif
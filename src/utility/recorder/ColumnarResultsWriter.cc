@@ -0,0 +1,301 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ColumnarResultsWriter.cc
+
+#include "ColumnarResultsWriter.h"
+#include <iostream>
+#include <cstring>
+#include <algorithm>
+#include <zlib.h>
+
+//! @brief Constructor.
+XC::ColumnarResultsWriter::ColumnarResultsWriter(void)
+  : compressionLevel(0), position(0), numRows(0), chunkOpen(false) {}
+
+//! @brief Destructor (closes the file).
+XC::ColumnarResultsWriter::~ColumnarResultsWriter(void)
+  { close(); }
+
+//! @brief Writes the data to the file.
+void XC::ColumnarResultsWriter::write_raw(const void *data,const size_t &sz)
+  {
+    os.write(reinterpret_cast<const char *>(data),sz);
+    position+= sz;
+  }
+
+//! @brief Writes zeros until the position is a multiple of 8.
+void XC::ColumnarResultsWriter::pad(void)
+  {
+    static const char zeros[8]= {0,0,0,0,0,0,0,0};
+    const size_t r= position%8;
+    if(r!=0)
+      write_raw(zeros,8-r);
+  }
+
+//! @brief Opens the file and writes the header.
+//!
+//! @param nmb: file name.
+//! @param cols: column definitions (the first column must be
+//!              of type INT32, it's used as key of the index).
+//! @param compression: zlib compression level (0: no compression,
+//!                     the columns can be memory mapped without copying).
+int XC::ColumnarResultsWriter::open(const std::string &nmb,const column_vector &cols,const int &compression)
+  {
+    close();
+    if(cols.empty() || (cols[0].type!=INT32))
+      {
+        std::cerr << "ColumnarResultsWriter::" << __FUNCTION__
+                  << "; the first column must be of type INT32."
+                  << std::endl;
+        return -1;
+      }
+    for(column_vector::const_iterator i= cols.begin();i!=cols.end();i++)
+      if(i->getItemSize()==0)
+        {
+          std::cerr << "ColumnarResultsWriter::" << __FUNCTION__
+                    << "; unknown type of column: '" << i->name
+                    << "'." << std::endl;
+          return -1;
+        }
+    os.open(nmb.c_str(),std::ios::out|std::ios::binary|std::ios::trunc);
+    if(!os.is_open())
+      {
+        std::cerr << "ColumnarResultsWriter::" << __FUNCTION__
+                  << "; can't open file: '" << nmb << "'." << std::endl;
+        return -1;
+      }
+    clear_file_data();
+    layoutKeys.clear();
+    fileName= nmb;
+    columns= cols;
+    compressionLevel= std::max(0,std::min(compression,9));
+    position= 0;
+    buffers.assign(columns.size(),std::vector<char>());
+    chunkName.clear();
+    numRows= 0;
+    chunkOpen= false;
+    //Header.
+    write_raw(magic,sizeof(magic));
+    write_raw(&version,sizeof(version));
+    const uint32_t nc= columns.size();
+    write_raw(&nc,sizeof(nc));
+    for(column_vector::const_iterator i= columns.begin();i!=columns.end();i++)
+      {
+        write_raw(&(i->type),sizeof(i->type));
+        const uint32_t len= i->name.size();
+        write_raw(&len,sizeof(len));
+        write_raw(i->name.data(),len);
+      }
+    pad();
+    return (os.good() ? 0 : -1);
+  }
+
+//! @brief Starts a new chunk (finishing the previous one if needed).
+int XC::ColumnarResultsWriter::beginChunk(const std::string &nmb)
+  {
+    int retval= 0;
+    if(chunkOpen)
+      retval= endChunk();
+    for(std::vector<std::vector<char> >::iterator i= buffers.begin();i!=buffers.end();i++)
+      i->clear();
+    chunkName= nmb;
+    numRows= 0;
+    chunkOpen= true;
+    return retval;
+  }
+
+//! @brief Appends a row to the current chunk.
+//!
+//! @param intValues: values of the INT32 columns (in column order).
+//! @param dblValues: values of the FLOAT64 columns (in column order).
+void XC::ColumnarResultsWriter::appendRow(const int32_t *intValues,const double *dblValues)
+  {
+    const size_t nc= columns.size();
+    size_t iInt= 0, iDbl= 0;
+    for(size_t i= 0;i<nc;i++)
+      {
+        std::vector<char> &buffer= buffers[i];
+        const size_t sz= buffer.size();
+        if(columns[i].type==INT32)
+          {
+            buffer.resize(sz+sizeof(int32_t));
+            memcpy(&buffer[sz],intValues+iInt,sizeof(int32_t));
+            iInt++;
+          }
+        else
+          {
+            buffer.resize(sz+sizeof(double));
+            memcpy(&buffer[sz],dblValues+iDbl,sizeof(double));
+            iDbl++;
+          }
+      }
+    numRows++;
+  }
+
+//! @brief Discards the rows of the current chunk.
+void XC::ColumnarResultsWriter::discardChunk(void)
+  {
+    for(std::vector<std::vector<char> >::iterator i= buffers.begin();i!=buffers.end();i++)
+      i->clear();
+    chunkName.clear();
+    numRows= 0;
+    chunkOpen= false;
+  }
+
+//! @brief Returns the index of the layout of the current chunk (it
+//! creates a new one if its key column differs from the existing ones).
+size_t XC::ColumnarResultsWriter::get_layout(void)
+  {
+    const int32_t *keys= reinterpret_cast<const int32_t *>(buffers[0].data());
+    const size_t nl= layoutKeys.size();
+    //Search from the last one (most of the chunks share the same layout).
+    for(size_t i= nl;i>0;i--)
+      {
+        const std::vector<int32_t> &lk= layoutKeys[i-1];
+        if((lk.size()==numRows) && std::equal(lk.begin(),lk.end(),keys))
+          return i-1;
+      }
+    layoutKeys.push_back(std::vector<int32_t>(keys,keys+numRows));
+    KeyIndex index;
+    index.build(keys,numRows);
+    layouts.push_back(index);
+    return nl;
+  }
+
+//! @brief Writes the values of the column of the current chunk.
+int XC::ColumnarResultsWriter::write_block(const size_t &iCol,Block &block)
+  {
+    const std::vector<char> &buffer= buffers[iCol];
+    pad();
+    block.offset= position;
+    block.rawSize= buffer.size();
+    block.codec= RAW;
+    block.storedSize= buffer.size();
+    if((compressionLevel>0) && !buffer.empty())
+      {
+        const size_t itemSize= columns[iCol].getItemSize();
+        std::vector<char> shuffled(buffer.size());
+        shuffle(buffer.data(),shuffled.data(),numRows,itemSize);
+        uLongf destLen= compressBound(buffer.size());
+        std::vector<char> compressed(destLen);
+        const int ok= compress2(reinterpret_cast<Bytef *>(compressed.data()),&destLen,reinterpret_cast<const Bytef *>(shuffled.data()),shuffled.size(),compressionLevel);
+        if((ok==Z_OK) && (destLen<buffer.size()))
+          {
+            block.codec= SHUFFLE_DEFLATE;
+            block.storedSize= destLen;
+            write_raw(compressed.data(),destLen);
+            return (os.good() ? 0 : -1);
+          }
+      }
+    if(!buffer.empty())
+      write_raw(buffer.data(),buffer.size());
+    return (os.good() ? 0 : -1);
+  }
+
+//! @brief Writes the current chunk to the file.
+int XC::ColumnarResultsWriter::endChunk(void)
+  {
+    if(!chunkOpen)
+      return 0;
+    if(!isOpen())
+      {
+        std::cerr << "ColumnarResultsWriter::" << __FUNCTION__
+                  << "; file not open." << std::endl;
+        return -1;
+      }
+    int retval= 0;
+    Chunk chunk(chunkName);
+    chunk.numRows= numRows;
+    chunk.layout= get_layout();
+    const size_t nc= columns.size();
+    chunk.blocks.resize(nc);
+    for(size_t i= 0;i<nc;i++)
+      if(write_block(i,chunk.blocks[i])!=0)
+        {
+          std::cerr << "ColumnarResultsWriter::" << __FUNCTION__
+                    << "; error writing chunk: '" << chunkName
+                    << "'." << std::endl;
+          retval= -1;
+          break;
+        }
+    chunkIndexes[chunkName]= chunks.size();
+    chunks.push_back(chunk);
+    discardChunk();
+    return retval;
+  }
+
+//! @brief Writes the indexes and the chunk descriptors.
+void XC::ColumnarResultsWriter::write_footer(void)
+  {
+    pad();
+    const uint64_t footerOffset= position;
+    const uint64_t nl= layouts.size();
+    write_raw(&nl,sizeof(nl));
+    for(std::vector<KeyIndex>::const_iterator i= layouts.begin();i!=layouts.end();i++)
+      {
+        const uint64_t n= i->keys.size();
+        write_raw(&n,sizeof(n));
+        write_raw(i->keys.data(),n*sizeof(int32_t));
+        write_raw(i->firstRows.data(),n*sizeof(uint64_t));
+        write_raw(i->numRows.data(),n*sizeof(uint64_t));
+      }
+    const uint64_t nch= chunks.size();
+    write_raw(&nch,sizeof(nch));
+    for(std::vector<Chunk>::const_iterator i= chunks.begin();i!=chunks.end();i++)
+      {
+        const uint32_t len= i->name.size();
+        write_raw(&len,sizeof(len));
+        write_raw(i->name.data(),len);
+        write_raw(&(i->numRows),sizeof(i->numRows));
+        write_raw(&(i->layout),sizeof(i->layout));
+        for(std::vector<Block>::const_iterator j= i->blocks.begin();j!=i->blocks.end();j++)
+          {
+            write_raw(&(j->offset),sizeof(j->offset));
+            write_raw(&(j->storedSize),sizeof(j->storedSize));
+            write_raw(&(j->rawSize),sizeof(j->rawSize));
+            write_raw(&(j->codec),sizeof(j->codec));
+          }
+      }
+    write_raw(&footerOffset,sizeof(footerOffset));
+    write_raw(endMagic,sizeof(endMagic));
+  }
+
+//! @brief Writes the current chunk (if any) and the footer and
+//! closes the file.
+int XC::ColumnarResultsWriter::close(void)
+  {
+    int retval= 0;
+    if(isOpen())
+      {
+        retval= endChunk();
+        write_footer();
+        if(!os.good())
+          {
+            std::cerr << "ColumnarResultsWriter::" << __FUNCTION__
+                      << "; error writing file: '" << fileName
+                      << "'." << std::endl;
+            retval= -1;
+          }
+        os.close();
+      }
+    return retval;
+  }
@@ -0,0 +1,84 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ColumnarResultsWriter.h
+
+#ifndef ColumnarResultsWriter_h
+#define ColumnarResultsWriter_h
+
+#include "ColumnarResultsFile.h"
+#include <fstream>
+
+namespace XC {
+
+//! @ingroup Recorder
+//
+//! @brief Writes a columnar results file (see ColumnarResultsFile).
+//!
+//! The rows of the current chunk are kept in memory (one buffer
+//! for each column) and written to the file when the chunk is
+//! finished, the footer is written when the file is closed.
+class ColumnarResultsWriter: public ColumnarResultsFile
+  {
+    std::ofstream os; //!< Output stream.
+    std::string fileName; //!< Name of the file.
+    int compressionLevel; //!< zlib compression level (0: no compression).
+    uint64_t position; //!< Current position in the file.
+    std::vector<std::vector<char> > buffers; //!< Values of the current chunk.
+    std::string chunkName; //!< Name of the current chunk.
+    uint64_t numRows; //!< Number of rows of the current chunk.
+    bool chunkOpen; //!< True if there is a chunk being written.
+    std::vector<std::vector<int32_t> > layoutKeys; //!< Key column of each layout.
+
+    void write_raw(const void *,const size_t &);
+    void pad(void);
+    size_t get_layout(void);
+    int write_block(const size_t &,Block &);
+    void write_footer(void);
+    ColumnarResultsWriter(const ColumnarResultsWriter &);
+    ColumnarResultsWriter &operator=(const ColumnarResultsWriter &);
+  public:
+    ColumnarResultsWriter(void);
+    ~ColumnarResultsWriter(void);
+
+    int open(const std::string &,const column_vector &,const int &compression= 0);
+    //! @brief Returns true if the file is open.
+    inline bool isOpen(void) const
+      { return os.is_open(); }
+    //! @brief Returns the name of the file.
+    inline const std::string &getFileName(void) const
+      { return fileName; }
+    //! @brief Returns the name of the chunk being written.
+    inline const std::string &getCurrentChunkName(void) const
+      { return chunkName; }
+    //! @brief Returns true if there is a chunk being written.
+    inline bool isChunkOpen(void) const
+      { return chunkOpen; }
+    int beginChunk(const std::string &);
+    void appendRow(const int32_t *,const double *);
+    void discardChunk(void);
+    int endChunk(void);
+    int close(void);
+  };
+
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,139 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ElementForcesColumnarRecorder.cc
+
+#include <utility/recorder/ElementForcesColumnarRecorder.h>
+#include <domain/domain/Domain.h>
+#include <domain/mesh/element/Element.h>
+#include "domain/mesh/element/truss_beam_column/elasticBeamColumn/ElasticBeam2d.h"
+#include "domain/mesh/element/truss_beam_column/elasticBeamColumn/ElasticBeam3d.h"
+#include "domain/mesh/element/truss_beam_column/NLForceBeamColumn2dBase.h"
+#include "domain/mesh/element/truss_beam_column/NLForceBeamColumn3dBase.h"
+#include "utility/matrix/ID.h"
+
+namespace XC {
+//! @brief Appends the internal forces at the ends of a 2D beam
+//! element (Vz, T and My are zero).
+template <class E>
+void append_beam2d_rows(ColumnarResultsWriter &w,E &e)
+  {
+    e.getResistingForce();
+    int32_t ints[2]= {e.getTag(),0};
+    const double v1[6]= {e.getN1(),e.getV1(),0.0,0.0,0.0,e.getM1()};
+    w.appendRow(ints,v1);
+    ints[1]= 1;
+    const double v2[6]= {e.getN2(),e.getV2(),0.0,0.0,0.0,e.getM2()};
+    w.appendRow(ints,v2);
+  }
+
+//! @brief Appends the internal forces at the ends of a 3D beam element.
+template <class E>
+void append_beam3d_rows(ColumnarResultsWriter &w,E &e)
+  {
+    e.getResistingForce();
+    int32_t ints[2]= {e.getTag(),0};
+    const double v1[6]= {e.getN1(),e.getVy1(),e.getVz1(),e.getT1(),e.getMy1(),e.getMz1()};
+    w.appendRow(ints,v1);
+    ints[1]= 1;
+    const double v2[6]= {e.getN2(),e.getVy2(),e.getVz2(),e.getT2(),e.getMy2(),e.getMz2()};
+    w.appendRow(ints,v2);
+  }
+} // end of XC namespace
+
+//! @brief Constructor.
+XC::ElementForcesColumnarRecorder::ElementForcesColumnarRecorder(Domain *ptr_dom)
+  :ColumnarRecorder(RECORDER_TAGS_ElementForcesColumnarRecorder,ptr_dom) {}
+
+//! @brief Asigns elements to recorder.
+void XC::ElementForcesColumnarRecorder::setElements(const ID &iElements)
+  {
+    const int sz= iElements.Size();
+    elements.clear();
+    if(sz)
+      {
+        elements.reserve(sz);
+        for(int i= 0;i<sz;i++)
+          {
+            Element *tmp= theDomain->getElement(iElements(i));
+            if(tmp)
+              elements.push_back(tmp);
+            else
+              std::cerr << getClassName() << "::" << __FUNCTION__
+                        << "; element: " << iElements(i)
+                        << " not found." << std::endl;
+          }
+      }
+    else
+      std::cerr << "Error; " << getClassName() << "::" << __FUNCTION__
+                << " element list is empty." << std::endl;
+  }
+
+//! @brief Returns the identifiers of the elements.
+XC::ID XC::ElementForcesColumnarRecorder::getTags(void) const
+  {
+    const size_t sz= elements.size();
+    ID retval(sz);
+    for(size_t i= 0;i<sz;i++)
+      retval(i)= elements[i]->getTag();
+    return retval;
+  }
+
+//! @brief Returns the columns of the results file.
+XC::ColumnarResultsFile::column_vector XC::ElementForcesColumnarRecorder::getColumns(void) const
+  {
+    ColumnarResultsFile::column_vector retval;
+    retval.push_back(ColumnarResultsFile::Column("Elem",ColumnarResultsFile::INT32));
+    retval.push_back(ColumnarResultsFile::Column("Sect",ColumnarResultsFile::INT32));
+    const char *labels[6]= {"N","Vy","Vz","T","My","Mz"};
+    for(size_t i= 0;i<6;i++)
+      retval.push_back(ColumnarResultsFile::Column(labels[i],ColumnarResultsFile::FLOAT64));
+    return retval;
+  }
+
+//! @brief Appends the internal forces of the elements to the
+//! current chunk. The elements that are not beams are ignored
+//! (a warning is issued once for each element type).
+int XC::ElementForcesColumnarRecorder::write_rows(void)
+  {
+    for(element_vector::const_iterator i= elements.begin();i!=elements.end();i++)
+      {
+        Element *e= *i;
+        if(ElasticBeam3d *b3d= dynamic_cast<ElasticBeam3d *>(e))
+          append_beam3d_rows(writer,*b3d);
+        else if(NLForceBeamColumn3dBase *f3d= dynamic_cast<NLForceBeamColumn3dBase *>(e))
+          append_beam3d_rows(writer,*f3d);
+        else if(ElasticBeam2d *b2d= dynamic_cast<ElasticBeam2d *>(e))
+          append_beam2d_rows(writer,*b2d);
+        else if(NLForceBeamColumn2dBase *f2d= dynamic_cast<NLForceBeamColumn2dBase *>(e))
+          append_beam2d_rows(writer,*f2d);
+        else
+          {
+            const std::string type= e->getClassName();
+            if(unsupportedTypes.insert(type).second)
+              std::cerr << getClassName() << "::" << __FUNCTION__
+                        << "; internal forces of elements of type: '"
+                        << type << "' can't be recorded; ignored."
+                        << std::endl;
+          }
+      }
+    return 0;
+  }
@@ -0,0 +1,61 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ElementForcesColumnarRecorder.h
+
+#ifndef ElementForcesColumnarRecorder_h
+#define ElementForcesColumnarRecorder_h
+
+#include <utility/recorder/ColumnarRecorder.h>
+#include <set>
+
+namespace XC {
+class Element;
+class ID;
+
+//! @ingroup Recorder
+//
+//! @brief Writes the internal forces (N, Vy, Vz, T, My, Mz) at the
+//! sections of the beam elements (0: back end, 1: front end) for each
+//! load combination in a columnar results file.
+//!
+//! The columns of the file are those of the internal forces CSV files
+//! written by the limit state checking utilities: Elem, Sect, N, Vy,
+//! Vz, T, My, Mz (the load combination is the chunk name).
+class ElementForcesColumnarRecorder: public ColumnarRecorder
+  {
+  public:
+    typedef std::vector<Element *> element_vector; //!< Pointers to elements.
+  private:
+    element_vector elements; //!< Elements whose internal forces are recorded.
+    std::set<std::string> unsupportedTypes; //!< Types of the elements already reported as unsupported.
+  protected:
+    ColumnarResultsFile::column_vector getColumns(void) const;
+    int write_rows(void);
+  public:
+    ElementForcesColumnarRecorder(Domain *ptr_dom= nullptr);
+
+    void setElements(const ID &);
+    ID getTags(void) const;
+  };
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,139 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ElementPropEnvelopeRecorder.cc
+
+#include <utility/recorder/ElementPropEnvelopeRecorder.h>
+#include <domain/domain/Domain.h>
+#include <domain/mesh/element/Element.h>
+#include "domain/mesh/element/utils/Information.h"
+#include "utility/recorder/response/Response.h"
+#include "utility/matrix/ID.h"
+
+//! @brief Constructor.
+XC::ElementPropEnvelopeRecorder::ElementPropEnvelopeRecorder(Domain *ptr_dom)
+  :PropEnvelopeRecorder(RECORDER_TAGS_ElementPropEnvelopeRecorder,ptr_dom) {}
+
+//! @brief Destructor.
+XC::ElementPropEnvelopeRecorder::~ElementPropEnvelopeRecorder(void)
+  { free_responses(); }
+
+//! @brief Deletes the response objects.
+void XC::ElementPropEnvelopeRecorder::free_responses(void)
+  {
+    for(std::vector<Response *>::iterator i= responses.begin();i!=responses.end();i++)
+      {
+        delete *i;
+        *i= nullptr;
+      }
+    responses.clear();
+  }
+
+//! @brief Asigns elements to recorder.
+void XC::ElementPropEnvelopeRecorder::setElements(const ID &iElements)
+  {
+    free_responses();
+    const int sz= iElements.Size();
+    elements.clear();
+    if(sz)
+      {
+        elements.reserve(sz);
+        for(int i= 0;i<sz;i++)
+          {
+            Element *tmp= theDomain->getElement(iElements(i));
+            if(tmp)
+              elements.push_back(tmp);
+            else
+              std::cerr << getClassName() << "::" << __FUNCTION__
+                        << "; element: " << iElements(i)
+                        << " not found." << std::endl;
+          }
+      }
+    else
+      std::cerr << "Error; " << getClassName() << "::" << __FUNCTION__
+                << " element list is empty." << std::endl;
+    resize_envelopes();
+  }
+
+//! @brief Adds a quantity to record.
+void XC::ElementPropEnvelopeRecorder::addQuantity(const std::string &lbl,const std::string &responseName,const int &component)
+  {
+    free_responses();
+    PropEnvelopeRecorder::addQuantity(lbl,responseName,component);
+  }
+
+//! @brief Returns the identifiers of the elements.
+XC::ID XC::ElementPropEnvelopeRecorder::getTags(void) const
+  {
+    const size_t sz= elements.size();
+    ID retval(sz);
+    for(size_t i= 0;i<sz;i++)
+      retval(i)= elements[i]->getTag();
+    return retval;
+  }
+
+//! @brief Returns the number of elements.
+size_t XC::ElementPropEnvelopeRecorder::getNumObjects(void) const
+  { return elements.size(); }
+
+//! @brief Creates the response objects (if not already created).
+//!
+//! The elements without the requested response contribute
+//! with zero values to the envelopes.
+int XC::ElementPropEnvelopeRecorder::setup(void)
+  {
+    const size_t nq= quantities.size();
+    const size_t ne= elements.size();
+    if(responses.size()!=nq*ne)
+      {
+        free_responses();
+        responses.resize(nq*ne,nullptr);
+        Information eleInfo(1.0);
+        for(size_t i= 0;i<nq;i++)
+          {
+            const std::vector<std::string> &args= quantities[i].responseArgs;
+            const size_t offset= i*ne;
+            for(size_t j= 0;j<ne;j++)
+              {
+                Response *tmp= elements[j]->setResponse(args,eleInfo);
+                if(!tmp)
+                  {
+                    std::cerr << getClassName() << "::" << __FUNCTION__
+                              << "; element: " << elements[j]->getTag()
+                              << " has no response for quantity: '"
+                              << quantities[i].label << "'." << std::endl;
+                  }
+                responses[offset+j]= tmp;
+              }
+          }
+      }
+    return 0;
+  }
+
+//! @brief Returns the value of the quantity for the element.
+double XC::ElementPropEnvelopeRecorder::getValue(const size_t &iQuantity,const size_t &iElem)
+  {
+    double retval= 0.0;
+    Response *r= responses[iQuantity*elements.size()+iElem];
+    if(r && (r->getResponse()>=0))
+      retval= component_value(r->getInformation().getData(),quantities[iQuantity].component);
+    return retval;
+  }
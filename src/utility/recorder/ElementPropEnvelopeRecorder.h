@@ -0,0 +1,65 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ElementPropEnvelopeRecorder.h
+
+#ifndef ElementPropEnvelopeRecorder_h
+#define ElementPropEnvelopeRecorder_h
+
+#include <utility/recorder/PropEnvelopeRecorder.h>
+
+namespace XC {
+class Element;
+class Response;
+
+//! @ingroup Recorder
+//
+//! @brief Computes the envelopes of element responses (internal
+//! forces,...) at each commit.
+//!
+//! The values are obtained from the response objects returned
+//! by the setResponse method of the elements (i.e. "localForce"
+//! component 0 for the axial force at the back end of a beam
+//! or "axialForce" for a truss).
+class ElementPropEnvelopeRecorder: public PropEnvelopeRecorder
+  {
+  public:
+    typedef std::vector<Element *> element_vector; //!< Pointers to elements.
+  private:
+    element_vector elements; //!< Elements which envelopes are recorded.
+    std::vector<Response *> responses; //!< Response objects (numQuantities x numElements).
+
+    void free_responses(void);
+  protected:
+    size_t getNumObjects(void) const;
+    double getValue(const size_t &,const size_t &);
+    int setup(void);
+  public:
+    ElementPropEnvelopeRecorder(Domain *ptr_dom= nullptr);
+    ~ElementPropEnvelopeRecorder(void);
+
+    void setElements(const ID &);
+    ID getTags(void) const;
+    void addQuantity(const std::string &,const std::string &,const int &);
+  };
+} // end of XC namespace
+
+#endif
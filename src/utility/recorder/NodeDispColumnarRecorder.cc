@@ -0,0 +1,94 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//NodeDispColumnarRecorder.cc
+
+#include <utility/recorder/NodeDispColumnarRecorder.h>
+#include <domain/domain/Domain.h>
+#include <domain/mesh/node/Node.h>
+#include "utility/matrix/ID.h"
+#include "utility/matrix/Vector.h"
+
+//! @brief Constructor.
+XC::NodeDispColumnarRecorder::NodeDispColumnarRecorder(Domain *ptr_dom)
+  :ColumnarRecorder(RECORDER_TAGS_NodeDispColumnarRecorder,ptr_dom) {}
+
+//! @brief Asigns nodes to recorder.
+void XC::NodeDispColumnarRecorder::setNodes(const ID &iNodes)
+  {
+    const int sz= iNodes.Size();
+    nodes.clear();
+    if(sz)
+      {
+        nodes.reserve(sz);
+        for(int i= 0;i<sz;i++)
+          {
+            Node *tmp= theDomain->getNode(iNodes(i));
+            if(tmp)
+              nodes.push_back(tmp);
+            else
+              std::cerr << getClassName() << "::" << __FUNCTION__
+                        << "; node: " << iNodes(i)
+                        << " not found." << std::endl;
+          }
+      }
+    else
+      std::cerr << "Error; " << getClassName() << "::" << __FUNCTION__
+                << " node list is empty." << std::endl;
+  }
+
+//! @brief Returns the identifiers of the nodes.
+XC::ID XC::NodeDispColumnarRecorder::getTags(void) const
+  {
+    const size_t sz= nodes.size();
+    ID retval(sz);
+    for(size_t i= 0;i<sz;i++)
+      retval(i)= nodes[i]->getTag();
+    return retval;
+  }
+
+//! @brief Returns the columns of the results file.
+XC::ColumnarResultsFile::column_vector XC::NodeDispColumnarRecorder::getColumns(void) const
+  {
+    ColumnarResultsFile::column_vector retval;
+    retval.push_back(ColumnarResultsFile::Column("Node",ColumnarResultsFile::INT32));
+    const char *labels[6]= {"Ux","Uy","Uz","ROTx","ROTy","ROTz"};
+    for(size_t i= 0;i<6;i++)
+      retval.push_back(ColumnarResultsFile::Column(labels[i],ColumnarResultsFile::FLOAT64));
+    return retval;
+  }
+
+//! @brief Appends the displacements of the nodes to the current chunk.
+int XC::NodeDispColumnarRecorder::write_rows(void)
+  {
+    double values[6];
+    for(node_vector::const_iterator i= nodes.begin();i!=nodes.end();i++)
+      {
+        const Node *n= *i;
+        const Vector &disp= n->getDisp();
+        const int sz= std::min(disp.Size(),6);
+        for(int j= 0;j<6;j++)
+          values[j]= (j<sz) ? disp(j) : 0.0;
+        const int32_t tag= n->getTag();
+        writer.appendRow(&tag,values);
+      }
+    return 0;
+  }
@@ -0,0 +1,57 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//NodeDispColumnarRecorder.h
+
+#ifndef NodeDispColumnarRecorder_h
+#define NodeDispColumnarRecorder_h
+
+#include <utility/recorder/ColumnarRecorder.h>
+
+namespace XC {
+class Node;
+class ID;
+
+//! @ingroup Recorder
+//
+//! @brief Writes the displacements of the nodes for each load
+//! combination in a columnar results file.
+//!
+//! The columns of the file are: Node, Ux, Uy, Uz, ROTx, ROTy, ROTz
+//! (the components that don't exist in the node are zero).
+class NodeDispColumnarRecorder: public ColumnarRecorder
+  {
+  public:
+    typedef std::vector<Node *> node_vector; //!< Pointers to nodes.
+  private:
+    node_vector nodes; //!< Nodes whose displacements are recorded.
+  protected:
+    ColumnarResultsFile::column_vector getColumns(void) const;
+    int write_rows(void);
+  public:
+    NodeDispColumnarRecorder(Domain *ptr_dom= nullptr);
+
+    void setNodes(const ID &);
+    ID getTags(void) const;
+  };
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,136 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//NodePropEnvelopeRecorder.cc
+
+#include <utility/recorder/NodePropEnvelopeRecorder.h>
+#include <domain/domain/Domain.h>
+#include <domain/mesh/node/Node.h>
+#include "utility/matrix/ID.h"
+
+//! @brief Constructor.
+XC::NodePropEnvelopeRecorder::NodePropEnvelopeRecorder(Domain *ptr_dom)
+  :PropEnvelopeRecorder(RECORDER_TAGS_NodePropEnvelopeRecorder,ptr_dom), computeReactions(false) {}
+
+//! @brief Asigns nodes to recorder.
+void XC::NodePropEnvelopeRecorder::setNodes(const ID &iNodes)
+  {
+    const int sz= iNodes.Size();
+    nodes.clear();
+    if(sz)
+      {
+        nodes.reserve(sz);
+        for(int i= 0;i<sz;i++)
+          {
+            Node *tmp= theDomain->getNode(iNodes(i));
+            if(tmp)
+              nodes.push_back(tmp);
+            else
+              std::cerr << getClassName() << "::" << __FUNCTION__
+                        << "; node: " << iNodes(i)
+                        << " not found." << std::endl;
+          }
+      }
+    else
+      std::cerr << "Error; " << getClassName() << "::" << __FUNCTION__
+                << " node list is empty." << std::endl;
+    resize_envelopes();
+  }
+
+//! @brief Returns the identifiers of the nodes.
+XC::ID XC::NodePropEnvelopeRecorder::getTags(void) const
+  {
+    const size_t sz= nodes.size();
+    ID retval(sz);
+    for(size_t i= 0;i<sz;i++)
+      retval(i)= nodes[i]->getTag();
+    return retval;
+  }
+
+//! @brief Returns the number of nodes.
+size_t XC::NodePropEnvelopeRecorder::getNumObjects(void) const
+  { return nodes.size(); }
+
+//! @brief Computes the codes of the responses and, if some quantity
+//! needs them, the nodal reactions.
+int XC::NodePropEnvelopeRecorder::setup(void)
+  {
+    int retval= 0;
+    const size_t nq= quantities.size();
+    if(responseCodes.size()!=nq)
+      {
+        computeReactions= false;
+        responseCodes.resize(nq);
+        for(size_t i= 0;i<nq;i++)
+          {
+            const std::vector<std::string> &args= quantities[i].responseArgs;
+            const std::string name= (args.empty() ? std::string() : args[0]);
+            if(name=="disp")
+              responseCodes[i]= 0;
+            else if(name=="vel")
+              responseCodes[i]= 1;
+            else if(name=="accel")
+              responseCodes[i]= 2;
+            else if(name=="reaction")
+              {
+                responseCodes[i]= 3;
+                computeReactions= true;
+              }
+            else
+              {
+                std::cerr << getClassName() << "::" << __FUNCTION__
+                          << "; unknown response: '" << name
+                          << "' for quantity: '" << quantities[i].label
+                          << "'." << std::endl;
+                responseCodes.clear();
+                retval= -1;
+                break;
+              }
+          }
+      }
+    if((retval==0) && computeReactions)
+      retval= theDomain->calculateNodalReactions(true,1e-4);
+    return retval;
+  }
+
+//! @brief Returns the value of the quantity for the node.
+double XC::NodePropEnvelopeRecorder::getValue(const size_t &iQuantity,const size_t &iNode)
+  {
+    const Node *n= nodes[iNode];
+    const int &component= quantities[iQuantity].component;
+    double retval= 0.0;
+    switch(responseCodes[iQuantity])
+      {
+      case 0:
+        retval= component_value(n->getDisp(),component);
+        break;
+      case 1:
+        retval= component_value(n->getVel(),component);
+        break;
+      case 2:
+        retval= component_value(n->getAccel(),component);
+        break;
+      case 3:
+        retval= component_value(n->getReaction(),component);
+        break;
+      }
+    return retval;
+  }
@@ -0,0 +1,56 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//NodePropEnvelopeRecorder.h
+
+#ifndef NodePropEnvelopeRecorder_h
+#define NodePropEnvelopeRecorder_h
+
+#include <utility/recorder/PropEnvelopeRecorder.h>
+
+namespace XC {
+class Node;
+
+//! @ingroup Recorder
+//
+//! @brief Computes the envelopes of nodal quantities ("disp", "vel",
+//! "accel" or "reaction" components) at each commit.
+class NodePropEnvelopeRecorder: public PropEnvelopeRecorder
+  {
+  public:
+    typedef std::vector<Node *> node_vector; //!< Pointers to nodes.
+  private:
+    node_vector nodes; //!< Nodes which envelopes are recorded.
+    std::vector<int> responseCodes; //!< Code of the response for each quantity.
+    bool computeReactions; //!< True if some quantity needs the nodal reactions.
+  protected:
+    size_t getNumObjects(void) const;
+    double getValue(const size_t &,const size_t &);
+    int setup(void);
+  public:
+    NodePropEnvelopeRecorder(Domain *ptr_dom= nullptr);
+
+    void setNodes(const ID &);
+    ID getTags(void) const;
+  };
+} // end of XC namespace
+
+#endif
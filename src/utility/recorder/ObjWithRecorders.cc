@@ -64,6 +64,11 @@
 #include <utility/recorder/PatternRecorder.h>
 #include <utility/recorder/NodePropRecorder.h>
 #include <utility/recorder/ElementPropRecorder.h>
+#include <utility/recorder/NodePropEnvelopeRecorder.h>
+#include <utility/recorder/ElementPropEnvelopeRecorder.h>
+#include <utility/recorder/NodeDispColumnarRecorder.h>
+#include <utility/recorder/ElementForcesColumnarRecorder.h>
+#include "utility/Profiler.h"
 
 
 #include "boost/any.hpp"
@@ -151,6 +156,26 @@ XC::Recorder *XC::ObjWithRecorders::newRecorder(const std::string &cod,DataOutpu
         ElementPropRecorder *tmp= new ElementPropRecorder(get_domain_ptr());
         retval= tmp;
       }
+    else if(cod == "node_prop_envelope_recorder")
+      {
+        NodePropEnvelopeRecorder *tmp= new NodePropEnvelopeRecorder(get_domain_ptr());
+        retval= tmp;
+      }
+    else if(cod == "element_prop_envelope_recorder")
+      {
+        ElementPropEnvelopeRecorder *tmp= new ElementPropEnvelopeRecorder(get_domain_ptr());
+        retval= tmp;
+      }
+    else if(cod == "node_disp_columnar_recorder")
+      {
+        NodeDispColumnarRecorder *tmp= new NodeDispColumnarRecorder(get_domain_ptr());
+        retval= tmp;
+      }
+    else if(cod == "element_forces_columnar_recorder")
+      {
+        ElementForcesColumnarRecorder *tmp= new ElementForcesColumnarRecorder(get_domain_ptr());
+        retval= tmp;
+      }
     else
       std::cerr << "Recorder type: '" << cod
                 << "' unknown." << std::endl;
@@ -182,7 +207,10 @@ int XC::ObjWithRecorders::addRecorder(Recorder &theRecorder)
 int XC::ObjWithRecorders::record(int cTag, double timeStamp)
   {
     for(lista_recorders::iterator i= theRecorders.begin();i!= theRecorders.end(); i++)
-      (*i)->record(cTag, timeStamp);
+      {
+        ProfilerScope scope("Recorder::record");
+        (*i)->record(cTag, timeStamp);
+      }
     return 0;
   }
 
@@ -203,6 +231,23 @@ int XC::ObjWithRecorders::removeRecorders(void)
     return 0;
   }
 
+//! @brief Remove the recorder being passed as parameter (it's deleted
+//! so it can't be used after calling this method). Returns 0 if the
+//! recorder has been removed, -1 if it was not found.
+int XC::ObjWithRecorders::removeRecorder(const Recorder *ptr)
+  {
+    for(lista_recorders::iterator i= theRecorders.begin();i!= theRecorders.end(); i++)
+      if(*i==ptr)
+        {
+          delete *i;
+          theRecorders.erase(i);
+          return 0;
+        }
+    std::cerr << "ObjWithRecorders::" << __FUNCTION__
+              << "; recorder not found." << std::endl;
+    return -1;
+  }
+
 //! @brief Asigna el domain a los recorders.
 void XC::ObjWithRecorders::setLinks(Domain *ptr_dom)
   {
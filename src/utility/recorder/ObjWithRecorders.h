@@ -76,6 +76,7 @@ class ObjWithRecorders: public EntCmd
     virtual int record(int track, double timeStamp= 0.0);
     void restart(void);
     virtual int removeRecorders(void);
+    virtual int removeRecorder(const Recorder *);
     void setLinks(Domain *dom);
     void SetOutputHandlers(DataOutputHandler::map_output_handlers *oh);
   };
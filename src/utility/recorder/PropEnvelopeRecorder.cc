@@ -0,0 +1,404 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//PropEnvelopeRecorder.cc
+
+#include <utility/recorder/PropEnvelopeRecorder.h>
+#include <domain/domain/Domain.h>
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/ID.h"
+#include <sstream>
+#include <limits>
+#include <cmath>
+
+//! @brief Constructor.
+//!
+//! @param lbl: name of the quantity.
+//! @param responseName: name of the response (words separated by spaces).
+//! @param c: index of the component to record (-1: modulus of the response vector).
+XC::PropEnvelopeRecorder::Quantity::Quantity(const std::string &lbl,const std::string &responseName,const int &c)
+  : label(lbl), responseArgs(), component(c)
+  {
+    std::istringstream iss(responseName);
+    std::string word;
+    while(iss >> word)
+      responseArgs.push_back(word);
+  }
+
+//! @brief Constructor.
+XC::PropEnvelopeRecorder::PropEnvelopeRecorder(int classTag,Domain *ptr_dom)
+  : PropRecorder(classTag,ptr_dom) {}
+
+//! @brief Returns the component of the vector being passed as parameter
+//! (if the index is negative returns the modulus of the vector).
+double XC::PropEnvelopeRecorder::component_value(const Vector &v,const int &i)
+  {
+    double retval= 0.0;
+    if(i<0)
+      retval= v.Norm();
+    else if(i<v.Size())
+      retval= v(i);
+    return retval;
+  }
+
+//! @brief Adds a quantity to record.
+//!
+//! @param lbl: name of the quantity (i.e. "N", "Mz", "Uy",...).
+//! @param responseName: name of the response to obtain from the objects (i.e. "localForce", "disp",...).
+//! @param component: index of the component to record (-1: modulus of the response vector).
+void XC::PropEnvelopeRecorder::addQuantity(const std::string &lbl,const std::string &responseName,const int &component)
+  {
+    if(getQuantityIndex(lbl)>=0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; quantity: '" << lbl
+                << "' already defined." << std::endl;
+    else
+      {
+        quantities.push_back(Quantity(lbl,responseName,component));
+        resize_envelopes();
+      }
+  }
+
+//! @brief Returns the index of the quantity whose label is being passed
+//! as parameter (-1 if not found).
+int XC::PropEnvelopeRecorder::getQuantityIndex(const std::string &lbl) const
+  {
+    int retval= -1;
+    const size_t sz= quantities.size();
+    for(size_t i= 0;i<sz;i++)
+      if(quantities[i].label==lbl)
+        {
+          retval= i;
+          break;
+        }
+    return retval;
+  }
+
+//! @brief Returns the number of quantities to record.
+size_t XC::PropEnvelopeRecorder::getNumQuantities(void) const
+  { return quantities.size(); }
+
+//! @brief Returns the labels of the quantities.
+boost::python::list XC::PropEnvelopeRecorder::getQuantityLabels(void) const
+  {
+    boost::python::list retval;
+    for(quantity_vector::const_iterator i= quantities.begin();i!=quantities.end();i++)
+      retval.append(i->label);
+    return retval;
+  }
+
+//! @brief Returns the names of the recorded combinations.
+boost::python::list XC::PropEnvelopeRecorder::getCombinationNames(void) const
+  {
+    boost::python::list retval;
+    for(std::vector<std::string>::const_iterator i= combinationNames.begin();i!=combinationNames.end();i++)
+      retval.append(*i);
+    return retval;
+  }
+
+//! @brief Returns the index of the combination whose name is being
+//! passed as parameter (it's appended to the combination names if
+//! it's not already there).
+int XC::PropEnvelopeRecorder::getCombinationIndex(const std::string &name)
+  {
+    std::map<std::string,int>::const_iterator i= combinationIndexes.find(name);
+    int retval= -1;
+    if(i!=combinationIndexes.end())
+      retval= i->second;
+    else
+      {
+        retval= combinationNames.size();
+        combinationNames.push_back(name);
+        combinationIndexes[name]= retval;
+      }
+    return retval;
+  }
+
+//! @brief Returns the index of the current combination.
+int XC::PropEnvelopeRecorder::getCurrentCombinationIndex(void)
+  { return getCombinationIndex(getCurrentCombinationName()); }
+
+//! @brief Resizes (and initializes) the envelope arrays.
+void XC::PropEnvelopeRecorder::resize_envelopes(void)
+  {
+    const size_t sz= quantities.size()*getNumObjects();
+    const double dblMax= std::numeric_limits<double>::max();
+    maxValues.assign(sz,-dblMax);
+    minValues.assign(sz,dblMax);
+    maxCombs.assign(sz,-1);
+    minCombs.assign(sz,-1);
+  }
+
+//! @brief Updates the envelopes with the current values of the quantities.
+void XC::PropEnvelopeRecorder::update_envelopes(void)
+  {
+    const int iComb= getCurrentCombinationIndex();
+    const size_t nq= quantities.size();
+    const size_t no= getNumObjects();
+    for(size_t i= 0;i<nq;i++)
+      {
+        const size_t offset= i*no;
+        for(size_t j= 0;j<no;j++)
+          {
+            const double value= getValue(i,j);
+            const size_t k= offset+j;
+            if(value>maxValues[k])
+              {
+                maxValues[k]= value;
+                maxCombs[k]= iComb;
+              }
+            if(value<minValues[k])
+              {
+                minValues[k]= value;
+                minCombs[k]= iComb;
+              }
+          }
+      }
+  }
+
+//! @brief Returns the row of the array that corresponds to the quantity.
+XC::Vector XC::PropEnvelopeRecorder::get_values(const std::vector<double> &values,const std::string &lbl) const
+  {
+    const int iq= getQuantityIndex(lbl);
+    const size_t no= getNumObjects();
+    Vector retval;
+    if(iq<0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; quantity: '" << lbl
+                << "' not found." << std::endl;
+    else if(values.size()==quantities.size()*no)
+      {
+        retval.resize(no);
+        const size_t offset= iq*no;
+        for(size_t j= 0;j<no;j++)
+          retval(j)= values[offset+j];
+      }
+    return retval;
+  }
+
+//! @brief Returns the names of the combinations stored in the row
+//! of the array that corresponds to the quantity.
+boost::python::list XC::PropEnvelopeRecorder::get_combinations(const std::vector<int> &combs,const std::string &lbl) const
+  {
+    boost::python::list retval;
+    const int iq= getQuantityIndex(lbl);
+    const size_t no= getNumObjects();
+    if(iq<0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; quantity: '" << lbl
+                << "' not found." << std::endl;
+    else if(combs.size()==quantities.size()*no)
+      {
+        const size_t offset= iq*no;
+        for(size_t j= 0;j<no;j++)
+          {
+            const int iComb= combs[offset+j];
+            if(iComb<0)
+              retval.append(std::string());
+            else
+              retval.append(combinationNames[iComb]);
+          }
+      }
+    return retval;
+  }
+
+//! @brief Returns the maximum values of the quantity for each object.
+XC::Vector XC::PropEnvelopeRecorder::getMax(const std::string &lbl) const
+  { return get_values(maxValues,lbl); }
+
+//! @brief Returns the minimum values of the quantity for each object.
+XC::Vector XC::PropEnvelopeRecorder::getMin(const std::string &lbl) const
+  { return get_values(minValues,lbl); }
+
+//! @brief Returns the maximum absolute values of the quantity for each object.
+XC::Vector XC::PropEnvelopeRecorder::getAbsMax(const std::string &lbl) const
+  {
+    Vector retval= getMax(lbl);
+    const Vector tmp= getMin(lbl);
+    const int sz= retval.Size();
+    for(int j= 0;j<sz;j++)
+      retval(j)= std::max(std::abs(retval(j)),std::abs(tmp(j)));
+    return retval;
+  }
+
+//! @brief Returns the names of the combinations that produce
+//! the maximum value of the quantity for each object.
+boost::python::list XC::PropEnvelopeRecorder::getCombMax(const std::string &lbl) const
+  { return get_combinations(maxCombs,lbl); }
+
+//! @brief Returns the names of the combinations that produce
+//! the minimum value of the quantity for each object.
+boost::python::list XC::PropEnvelopeRecorder::getCombMin(const std::string &lbl) const
+  { return get_combinations(minCombs,lbl); }
+
+//! @brief Updates the envelopes when commit is triggered.
+int XC::PropEnvelopeRecorder::record(int commitTag, double timeStamp)
+  {
+    int retval= 0;
+    lastCommitTag= commitTag;
+    lastTimeStamp= timeStamp;
+    if(!quantities.empty() && theDomain)
+      {
+        if(maxValues.size()!=quantities.size()*getNumObjects())
+          resize_envelopes();
+        retval= setup();
+        if(retval==0)
+          update_envelopes();
+        else
+          std::cerr << getClassName() << "::" << __FUNCTION__
+                    << "; error in recorder setup." << std::endl;
+      }
+    return retval;
+  }
+
+//! @brief Clears the envelopes and the recorded combination names.
+void XC::PropEnvelopeRecorder::clearEnvelopes(void)
+  {
+    resize_envelopes();
+    combinationNames.clear();
+    combinationIndexes.clear();
+  }
+
+namespace XC {
+//! @brief Writes the value in binary form.
+template <class T>
+inline void write_binary(std::ostream &os,const T &value)
+  { os.write(reinterpret_cast<const char *>(&value),sizeof(T)); }
+
+//! @brief Reads the value in binary form.
+template <class T>
+inline void read_binary(std::istream &is,T &value)
+  { is.read(reinterpret_cast<char *>(&value),sizeof(T)); }
+} // end of XC namespace
+
+//! @brief Writes the envelopes (and the names of the combinations
+//! that produce them) in binary form.
+//!
+//! Used to transfer the results obtained in other process (see
+//! LoadCombinationFarm).
+int XC::PropEnvelopeRecorder::write_envelopes(std::ostream &os) const
+  {
+    const size_t nq= quantities.size();
+    const size_t no= getNumObjects();
+    const size_t sz= nq*no;
+    write_binary(os,nq);
+    write_binary(os,no);
+    const size_t nc= combinationNames.size();
+    write_binary(os,nc);
+    for(std::vector<std::string>::const_iterator i= combinationNames.begin();i!=combinationNames.end();i++)
+      {
+        const size_t len= i->size();
+        write_binary(os,len);
+        os.write(i->data(),len);
+      }
+    const bool sized= (maxValues.size()==sz);
+    write_binary(os,sized);
+    if(sized)
+      {
+        os.write(reinterpret_cast<const char *>(maxValues.data()),sz*sizeof(double));
+        os.write(reinterpret_cast<const char *>(minValues.data()),sz*sizeof(double));
+        os.write(reinterpret_cast<const char *>(maxCombs.data()),sz*sizeof(int));
+        os.write(reinterpret_cast<const char *>(minCombs.data()),sz*sizeof(int));
+      }
+    return (os.good() ? 0 : -1);
+  }
+
+//! @brief Reads the envelopes written by write_envelopes (on a
+//! recorder with the same quantities and objects) and merges them
+//! with the envelopes of this recorder.
+int XC::PropEnvelopeRecorder::merge_envelopes(std::istream &is)
+  {
+    const size_t nq= quantities.size();
+    const size_t no= getNumObjects();
+    const size_t sz= nq*no;
+    size_t otherNq= 0, otherNo= 0, nc= 0;
+    read_binary(is,otherNq);
+    read_binary(is,otherNo);
+    read_binary(is,nc);
+    if(!is.good() || (otherNq!=nq) || (otherNo!=no))
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; envelopes don't match this recorder." << std::endl;
+        return -1;
+      }
+    std::vector<int> combIndexes(nc,-1); //Other indexes to this ones.
+    for(size_t i= 0;i<nc;i++)
+      {
+        size_t len= 0;
+        read_binary(is,len);
+        std::string name(len,' ');
+        if(len>0)
+          is.read(&name[0],len);
+        combIndexes[i]= getCombinationIndex(name);
+      }
+    bool sized= false;
+    read_binary(is,sized);
+    if(!is.good())
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; error reading envelopes." << std::endl;
+        return -1;
+      }
+    if(sized)
+      {
+        std::vector<double> otherMax(sz), otherMin(sz);
+        std::vector<int> otherMaxCombs(sz), otherMinCombs(sz);
+        is.read(reinterpret_cast<char *>(otherMax.data()),sz*sizeof(double));
+        is.read(reinterpret_cast<char *>(otherMin.data()),sz*sizeof(double));
+        is.read(reinterpret_cast<char *>(otherMaxCombs.data()),sz*sizeof(int));
+        is.read(reinterpret_cast<char *>(otherMinCombs.data()),sz*sizeof(int));
+        if(!is.good())
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; error reading envelopes." << std::endl;
+            return -1;
+          }
+        if(maxValues.size()!=sz)
+          resize_envelopes();
+        for(size_t k= 0;k<sz;k++)
+          {
+            if((otherMaxCombs[k]>=0) && (otherMax[k]>maxValues[k]))
+              {
+                maxValues[k]= otherMax[k];
+                maxCombs[k]= combIndexes[otherMaxCombs[k]];
+              }
+            if((otherMinCombs[k]>=0) && (otherMin[k]<minValues[k]))
+              {
+                minValues[k]= otherMin[k];
+                minCombs[k]= combIndexes[otherMinCombs[k]];
+              }
+          }
+      }
+    return 0;
+  }
+
+//! @brief Restarts the recorder.
+//!
+//! The envelopes are kept, so they accumulate the results of
+//! all the load combinations analyzed between calls to
+//! Preprocessor::resetLoadCase (which restarts the recorders);
+//! use clearEnvelopes to remove them.
+int XC::PropEnvelopeRecorder::restart(void)
+  {
+    lastCommitTag= -1;
+    lastTimeStamp= -1.0;
+    return 0;
+  }
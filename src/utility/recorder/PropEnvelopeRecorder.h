@@ -0,0 +1,106 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//PropEnvelopeRecorder.h
+
+#ifndef PropEnvelopeRecorder_h
+#define PropEnvelopeRecorder_h
+
+#include <utility/recorder/PropRecorder.h>
+#include <vector>
+#include <map>
+#include <iostream>
+
+namespace XC {
+class Vector;
+
+//! @ingroup Recorder
+//
+//! @brief Base class for the recorders that compute the envelopes
+//! (maximum, minimum and the combination that produces them) of some
+//! quantities (displacements, internal forces,...) of a set of
+//! objects (nodes, elements) without calling Python code.
+//!
+//! The results are stored in flat arrays (one row for each quantity
+//! and one column for each object).
+class PropEnvelopeRecorder: public PropRecorder
+  {
+  protected:
+    //! @brief Quantity to compute the envelope for.
+    struct Quantity
+      {
+        std::string label; //!< Name of the quantity (i.e. "N", "Mz", "Ux",...).
+        std::vector<std::string> responseArgs; //!< Arguments to obtain the response (i.e. "disp", "localForce",...).
+        int component; //!< Component of the response vector (-1: modulus).
+        Quantity(const std::string &,const std::string &,const int &);
+      };
+    typedef std::vector<Quantity> quantity_vector;
+
+    quantity_vector quantities; //!< Quantities to record.
+    std::vector<double> maxValues; //!< Maximum values (numQuantities x numObjects).
+    std::vector<double> minValues; //!< Minimum values (numQuantities x numObjects).
+    std::vector<int> maxCombs; //!< Index of the combination that produces the maximum.
+    std::vector<int> minCombs; //!< Index of the combination that produces the minimum.
+    std::vector<std::string> combinationNames; //!< Names of the recorded combinations.
+    std::map<std::string,int> combinationIndexes; //!< Combination name to index table.
+
+    static double component_value(const Vector &,const int &);
+    int getQuantityIndex(const std::string &) const;
+    int getCombinationIndex(const std::string &);
+    int getCurrentCombinationIndex(void);
+    void resize_envelopes(void);
+    void update_envelopes(void);
+
+    //! @brief Returns the number of objects.
+    virtual size_t getNumObjects(void) const= 0;
+    //! @brief Computes the value of the quantity for the object.
+    virtual double getValue(const size_t &iQuantity,const size_t &iObject)= 0;
+    //! @brief Prepares the computation of the values (if needed).
+    virtual int setup(void)
+      { return 0; }
+    Vector get_values(const std::vector<double> &,const std::string &) const;
+    boost::python::list get_combinations(const std::vector<int> &,const std::string &) const;
+  public:
+    PropEnvelopeRecorder(int classTag, Domain *ptr_dom= nullptr);
+
+    virtual void addQuantity(const std::string &,const std::string &,const int &);
+    size_t getNumQuantities(void) const;
+    boost::python::list getQuantityLabels(void) const;
+    boost::python::list getCombinationNames(void) const;
+    virtual ID getTags(void) const= 0;
+
+    Vector getMax(const std::string &) const;
+    Vector getMin(const std::string &) const;
+    boost::python::list getCombMax(const std::string &) const;
+    boost::python::list getCombMin(const std::string &) const;
+    Vector getAbsMax(const std::string &) const;
+
+    void clearEnvelopes(void);
+    int write_envelopes(std::ostream &) const;
+    int merge_envelopes(std::istream &);
+
+    virtual int record(int,double);
+    virtual int restart(void);
+  };
+
+} // end of XC namespace
+
+#endif
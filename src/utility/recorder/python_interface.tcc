@@ -55,6 +55,64 @@ class_<XC::ElementPropRecorder, bases<XC::PropRecorder>, boost::noncopyable >("E
   .def("setElements",&XC::ElementPropRecorder::setElements,"Assigns elements to the recorder.")
   ;
 
+class_<XC::PropEnvelopeRecorder, bases<XC::PropRecorder>, boost::noncopyable >("PropEnvelopeRecorder", no_init)
+  .def("addQuantity",&XC::PropEnvelopeRecorder::addQuantity,"addQuantity(label,responseName,component) adds a quantity to compute the envelope for (component= -1 to use the modulus of the response vector).")
+  .add_property("numQuantities",&XC::PropEnvelopeRecorder::getNumQuantities,"Returns the number of quantities.")
+  .def("getQuantityLabels",&XC::PropEnvelopeRecorder::getQuantityLabels,"Returns the labels of the quantities.")
+  .def("getCombinationNames",&XC::PropEnvelopeRecorder::getCombinationNames,"Returns the names of the recorded combinations.")
+  .def("getTags",&XC::PropEnvelopeRecorder::getTags,"Returns the identifiers of the recorded objects.")
+  .def("getMax",&XC::PropEnvelopeRecorder::getMax,"getMax(label) returns the maximum values of the quantity.")
+  .def("getMin",&XC::PropEnvelopeRecorder::getMin,"getMin(label) returns the minimum values of the quantity.")
+  .def("getAbsMax",&XC::PropEnvelopeRecorder::getAbsMax,"getAbsMax(label) returns the maximum absolute values of the quantity.")
+  .def("getCombMax",&XC::PropEnvelopeRecorder::getCombMax,"getCombMax(label) returns the names of the combinations that produce the maximum values of the quantity.")
+  .def("getCombMin",&XC::PropEnvelopeRecorder::getCombMin,"getCombMin(label) returns the names of the combinations that produce the minimum values of the quantity.")
+  .def("clearEnvelopes",&XC::PropEnvelopeRecorder::clearEnvelopes,"Clears the envelopes (they are kept when the load case is reset).")
+  ;
+
+class_<XC::NodePropEnvelopeRecorder, bases<XC::PropEnvelopeRecorder>, boost::noncopyable >("NodePropEnvelopeRecorder", no_init)
+  .def("setNodes",&XC::NodePropEnvelopeRecorder::setNodes,"Assigns nodes to the recorder.")
+  ;
+
+class_<XC::ElementPropEnvelopeRecorder, bases<XC::PropEnvelopeRecorder>, boost::noncopyable >("ElementPropEnvelopeRecorder", no_init)
+  .def("setElements",&XC::ElementPropEnvelopeRecorder::setElements,"Assigns elements to the recorder.")
+  .def("addQuantity",&XC::ElementPropEnvelopeRecorder::addQuantity,"addQuantity(label,responseName,component) adds a quantity to compute the envelope for (i.e. addQuantity('N','localForce',0)).")
+  ;
+
+class_<XC::ColumnarRecorder, bases<XC::PropRecorder>, boost::noncopyable >("ColumnarRecorder", no_init)
+  .def("open",&XC::ColumnarRecorder::open,"open(fileName) opens the columnar results file (removing its previous contents).")
+  .def("close",&XC::ColumnarRecorder::close,"Writes the indexes and closes the results file (it can't be read until it's closed).")
+  .add_property("fileName",make_function(&XC::ColumnarRecorder::getFileName,return_value_policy<copy_const_reference>()),"Returns the name of the results file.")
+  .add_property("compressionLevel",&XC::ColumnarRecorder::getCompressionLevel,&XC::ColumnarRecorder::setCompressionLevel,"Compression level (0: no compression, 1-9: zlib compression level) of the files opened from now on.")
+  .add_property("numChunks",&XC::ColumnarRecorder::getNumChunks,"Returns the number of load combinations recorded.")
+  ;
+
+class_<XC::NodeDispColumnarRecorder, bases<XC::ColumnarRecorder>, boost::noncopyable >("NodeDispColumnarRecorder", no_init)
+  .def("setNodes",&XC::NodeDispColumnarRecorder::setNodes,"Assigns nodes to the recorder.")
+  .def("getTags",&XC::NodeDispColumnarRecorder::getTags,"Returns the identifiers of the recorded nodes.")
+  ;
+
+class_<XC::ElementForcesColumnarRecorder, bases<XC::ColumnarRecorder>, boost::noncopyable >("ElementForcesColumnarRecorder", no_init)
+  .def("setElements",&XC::ElementForcesColumnarRecorder::setElements,"Assigns elements to the recorder.")
+  .def("getTags",&XC::ElementForcesColumnarRecorder::getTags,"Returns the identifiers of the recorded elements.")
+  ;
+
+class_<XC::ColumnarResultsReader, bases<EntCmd>, boost::noncopyable >("ColumnarResultsReader")
+  .def(init<std::string>())
+  .def("open",&XC::ColumnarResultsReader::open,"open(fileName) opens (memory maps) a columnar results file.")
+  .def("close",&XC::ColumnarResultsReader::close,"Closes the file.")
+  .add_property("isOpen",&XC::ColumnarResultsReader::isOpen,"True if the file is open.")
+  .add_property("fileName",make_function(&XC::ColumnarResultsReader::getFileName,return_value_policy<copy_const_reference>()),"Returns the name of the file.")
+  .add_property("numChunks",&XC::ColumnarResultsReader::getNumChunks,"Returns the number of chunks (load combinations).")
+  .def("getColumnNames",&XC::ColumnarResultsReader::getColumnNamesPy,"Returns the names of the columns.")
+  .def("getChunkNames",&XC::ColumnarResultsReader::getChunkNamesPy,"Returns the names of the chunks (load combinations).")
+  .def("getNumRows",&XC::ColumnarResultsReader::getNumRows,"getNumRows(chunkName) returns the number of rows of the chunk.")
+  .def("getIntColumn",&XC::ColumnarResultsReader::getIntColumn,"getIntColumn(chunkName,columnName) returns a copy of the values of an integer column.")
+  .def("getDoubleColumn",&XC::ColumnarResultsReader::getDoubleColumn,"getDoubleColumn(chunkName,columnName) returns a copy of the values of a floating point column.")
+  .def("getArrayInterface",&XC::ColumnarResultsReader::getArrayInterface,"getArrayInterface(chunkName,columnName) returns the NumPy array interface of the column (shares the memory of the reader, see postprocess.columnar_results.getColumn).")
+  .def("getKeys",&XC::ColumnarResultsReader::getKeys,"getKeys(chunkName) returns the (sorted) values of the first column (element or node tags) of the chunk.")
+  .def("getValues",&XC::ColumnarResultsReader::getValues,"getValues(chunkName,tag,columnName) returns the values of the column in the rows of the element (or node) with the tag.")
+  ;
+
 // class_<XC::YsVisual , bases<XC::Recorder>, boost::noncopyable >("YsVisual", no_init);
 
 // class_<XC::DamageRecorder, bases<XC::DomainRecorderBase>, boost::noncopyable >("DamageRecorder", no_init);
@@ -86,6 +144,7 @@ class_<XC::EnvelopeElementRecorder, bases<XC::ElementRecorderBase>, boost::nonco
 class_<XC::ObjWithRecorders, bases<EntCmd>, boost::noncopyable >("ObjWithRecorders", no_init)
   .def("newRecorder",make_function(&XC::ObjWithRecorders::newRecorder,return_internal_reference<>()),"Creates a new recorder.")  
   .def("removeRecorders",&XC::ObjWithRecorders::removeRecorders,"Deletes all the recorders.")  
+  .def("removeRecorder",&XC::ObjWithRecorders::removeRecorder,"removeRecorder(recorder): deletes the recorder (it can't be used afterwards).")
   ;
 
 
@@ -0,0 +1,60 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//run_blocks.h
+
+#ifndef RUN_BLOCKS_H
+#define RUN_BLOCKS_H
+
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+namespace XC {
+
+//! @brief Runs f over the range [0,sz) splitting it in nThreads
+//! contiguous blocks. The calling thread takes the last one.
+//!
+//! The threads are created and joined on each call, so it's meant
+//! for loops that run once (i.e. building an interaction diagram);
+//! loops repeated on each iteration of an analysis use WorkerPool.
+template <class F>
+void run_blocks(F f,const size_t &sz,const size_t &nThreads)
+  {
+    const size_t nt= std::max(size_t(1),std::min(nThreads,sz));
+    const size_t blockSize= sz/nt;
+    std::vector<std::thread> workers;
+    workers.reserve(nt-1);
+    size_t begin= 0;
+    for(size_t i= 0;i<nt-1;i++)
+      {
+        const size_t end= begin+blockSize;
+        workers.push_back(std::thread(f,begin,end));
+        begin= end;
+      }
+    f(begin,sz);
+    for(std::vector<std::thread>::iterator i= workers.begin();i!=workers.end();i++)
+      (*i).join();
+  }
+
+} // end of XC namespace
+
+#endif
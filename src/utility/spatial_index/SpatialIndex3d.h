@@ -0,0 +1,538 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SpatialIndex3d.h
+
+#ifndef SpatialIndex3d_h
+#define SpatialIndex3d_h
+
+#include "SpatialIndexBox.h"
+#include "xc_utils/src/geom/pos_vec/Pos3d.h"
+#include <vector>
+#include <deque>
+#include <unordered_set>
+#include <unordered_map>
+#include <algorithm>
+#include <limits>
+#include <cmath>
+
+namespace XC {
+
+//! @ingroup Utils
+//
+//! @brief Balanced kd-tree over the positions of a set of objects
+//! (nodes, element centroids,...).
+//!
+//! The tree is bulk loaded: at each level the positions are split
+//! around the median of the widest coordinate, so its depth does not
+//! depend on the insertion order. Objects inserted or removed after
+//! the last build are kept aside (pending list and removed set) and the
+//! tree is rebuilt, on the next query, when they exceed a fraction of
+//! the indexed objects. Objects moved since the last query are
+//! relocated in the same way: the moved objects are obtained from
+//! the move log (Traits::getMovedSince) so only them are touched; if
+//! the log doesn't reach back to the last query the position stamps
+//! of all the objects are checked.
+//!
+//! The Traits class must provide:
+//! - static Pos3d getPosition(const T &): indexed position.
+//! - static size_t getPositionStamp(const T &): move counter value
+//!   when the object was last moved.
+//! - static size_t getMoveCounter(void): current move counter.
+//! - static bool getMovedSince(const size_t &,std::vector<const T *> &):
+//!   appends the objects moved since the move counter had the given
+//!   value, returns false if they are not known.
+template <class T,class Traits>
+class SpatialIndex3d
+  {
+  public:
+    typedef std::vector<const T *> ptr_vector;
+  protected:
+    //! @brief Indexed object.
+    struct Entry
+      {
+        double x[3]; //!< object position.
+        long key; //!< insertion order.
+        const T *ptr; //!< object.
+        Entry(const T *p,const long &k)
+          : key(k), ptr(p)
+          { set_position(); }
+        void set_position(void)
+          {
+            const Pos3d pos= Traits::getPosition(*ptr);
+            x[0]= pos.x(); x[1]= pos.y(); x[2]= pos.z();
+          }
+        double dist2(const double *p) const
+          {
+            const double dx= x[0]-p[0], dy= x[1]-p[1], dz= x[2]-p[2];
+            return dx*dx+dy*dy+dz*dz;
+          }
+      };
+    //! @brief kd-tree node.
+    struct TreeNode
+      {
+        SpatialIndexBox bnd; //!< bounding box of the node positions.
+        size_t begin; //!< first entry of the node.
+        size_t end; //!< one past the last entry of the node.
+        size_t left; //!< left child (zero for leafs).
+        size_t right; //!< right child (zero for leafs).
+      };
+    typedef std::vector<const Entry *> entry_vector;
+    typedef std::pair<double,const Entry *> dist_entry;
+
+    static const size_t leafSize= 8; //!< maximum number of entries in a leaf.
+    static const size_t minRebuild= 32; //!< minimum number of changes to trigger a rebuild.
+
+    mutable std::vector<Entry> entries; //!< indexed objects (in tree order).
+    mutable std::vector<TreeNode> nodes; //!< tree nodes (root first).
+    mutable std::unordered_map<const T *,size_t> positions; //!< position of each object in entries.
+    mutable std::vector<Entry> pending; //!< objects inserted after the last build.
+    mutable std::unordered_set<const T *> removed; //!< objects removed after the last build.
+    mutable size_t moveCounter; //!< Traits::getMoveCounter() at the last position check.
+    size_t numObjects; //!< number of indexed objects.
+    long firstKey; //!< insertion key of the first object.
+    long lastKey; //!< insertion key of the last object.
+
+    size_t build_node(const size_t &,const size_t &) const;
+    void rebuild(void) const;
+    void relocate(const Entry &) const;
+    void update_moved(void) const;
+    void prepare(void) const;
+    bool is_removed(const Entry &) const;
+    template <class Pred,class Accept>
+    void collect(const size_t &,Pred,Accept,entry_vector &) const;
+    template <class Pred,class Accept>
+    entry_vector collect(Pred,Accept) const;
+    void nearest(const size_t &,const double *,const size_t &,double &,std::vector<dist_entry> &) const;
+    static ptr_vector to_ptrs(entry_vector &,const bool &);
+  public:
+    SpatialIndex3d(void);
+
+    template <class InputIterator>
+    void build(InputIterator,InputIterator);
+    void insert(const T &);
+    void insertFront(const T &);
+    void erase(const T &);
+    void update(const T &);
+    void clear(void);
+    inline size_t size(void) const
+      { return numObjects; }
+
+    const T *getNearest(const Pos3d &,const double &maxDist= std::numeric_limits<double>::infinity()) const;
+    ptr_vector getKNearest(const Pos3d &,const size_t &,const double &maxDist= std::numeric_limits<double>::infinity()) const;
+    ptr_vector getWithinRadius(const Pos3d &,const double &,const bool &insertionOrder= true) const;
+    ptr_vector getInsideBox(const SpatialIndexBox &,const bool &insertionOrder= true) const;
+    ptr_vector getInsideHalfSpace(const Pos3d &,const double *,const double &tol= 0.0,const bool &insertionOrder= true) const;
+  };
+
+template <class T,class Traits>
+const size_t SpatialIndex3d<T,Traits>::leafSize;
+template <class T,class Traits>
+const size_t SpatialIndex3d<T,Traits>::minRebuild;
+
+//! @brief Constructor.
+template <class T,class Traits>
+SpatialIndex3d<T,Traits>::SpatialIndex3d(void)
+  : moveCounter(Traits::getMoveCounter()), numObjects(0), firstKey(0), lastKey(-1) {}
+
+//! @brief Builds the subtree for the entries in [begin,end) and
+//! returns the index of its root.
+template <class T,class Traits>
+size_t SpatialIndex3d<T,Traits>::build_node(const size_t &begin,const size_t &end) const
+  {
+    const size_t retval= nodes.size();
+    nodes.push_back(TreeNode());
+    SpatialIndexBox bnd;
+    for(size_t i= begin;i<end;i++)
+      bnd.extend(entries[i].x);
+    size_t left= 0, right= 0;
+    if((end-begin)>leafSize)
+      {
+        const size_t axis= bnd.getWidestAxis();
+        const size_t mid= begin+(end-begin)/2;
+        std::nth_element(entries.begin()+begin,entries.begin()+mid,entries.begin()+end,
+                         [axis](const Entry &a,const Entry &b) { return a.x[axis]<b.x[axis]; });
+        left= build_node(begin,mid);
+        right= build_node(mid,end);
+      }
+    TreeNode &node= nodes[retval]; //nodes may have been reallocated.
+    node.bnd= bnd;
+    node.begin= begin;
+    node.end= end;
+    node.left= left;
+    node.right= right;
+    return retval;
+  }
+
+//! @brief Rebuilds the tree with the current objects.
+template <class T,class Traits>
+void SpatialIndex3d<T,Traits>::rebuild(void) const
+  {
+    std::vector<Entry> tmp;
+    tmp.reserve(numObjects);
+    for(typename std::vector<Entry>::const_iterator i= entries.begin();i!=entries.end();i++)
+      if(!is_removed(*i))
+        tmp.push_back(*i);
+    tmp.insert(tmp.end(),pending.begin(),pending.end());
+    entries.swap(tmp);
+    pending.clear();
+    removed.clear();
+    nodes.clear();
+    positions.clear();
+    if(!entries.empty())
+      {
+        nodes.reserve(2*entries.size()/leafSize+1);
+        build_node(0,entries.size());
+        positions.reserve(entries.size());
+        for(size_t i= 0;i<entries.size();i++)
+          positions[entries[i].ptr]= i;
+      }
+  }
+
+//! @brief Moves the entry of the tree to the pending list, so it's
+//! relocated on the next query.
+template <class T,class Traits>
+void SpatialIndex3d<T,Traits>::relocate(const Entry &e) const
+  {
+    removed.insert(e.ptr);
+    pending.push_back(Entry(e.ptr,e.key));
+  }
+
+//! @brief Relocates the objects that have been moved since
+//! the last check.
+template <class T,class Traits>
+void SpatialIndex3d<T,Traits>::update_moved(void) const
+  {
+    const size_t counter= Traits::getMoveCounter();
+    if(counter!=moveCounter)
+      {
+        //Pending objects are traversed by every query anyway.
+        for(typename std::vector<Entry>::iterator i= pending.begin();i!=pending.end();i++)
+          if(Traits::getPositionStamp(*(i->ptr))>moveCounter)
+            i->set_position();
+        ptr_vector moved;
+        if(Traits::getMovedSince(moveCounter,moved))
+          {
+            for(typename ptr_vector::const_iterator i= moved.begin();i!=moved.end();i++)
+              {
+                typename std::unordered_map<const T *,size_t>::const_iterator j= positions.find(*i);
+                if(j!=positions.end())
+                  {
+                    const Entry &e= entries[j->second];
+                    if(!is_removed(e)) //Not yet relocated.
+                      relocate(e);
+                  }
+              }
+          }
+        else //Move log not available: check all the objects.
+          {
+            for(typename std::vector<Entry>::const_iterator i= entries.begin();i!=entries.end();i++)
+              if(!is_removed(*i) && (Traits::getPositionStamp(*(i->ptr))>moveCounter))
+                relocate(*i);
+          }
+        moveCounter= counter;
+      }
+  }
+
+//! @brief Brings the tree up to date before a query.
+template <class T,class Traits>
+void SpatialIndex3d<T,Traits>::prepare(void) const
+  {
+    update_moved();
+    const size_t changes= pending.size()+removed.size();
+    if((changes>0) && (changes>=std::max(minRebuild,entries.size()/8) || nodes.empty()))
+      rebuild();
+  }
+
+//! @brief Returns true if the entry of the tree has been removed.
+template <class T,class Traits>
+bool SpatialIndex3d<T,Traits>::is_removed(const Entry &e) const
+  { return (!removed.empty() && (removed.find(e.ptr)!=removed.end())); }
+
+//! @brief Appends to retval the entries of the subtree that satisfy
+//! accept, skipping the nodes whose bounding box doesn't satisfy pred.
+//!
+//! pred(bnd) must return 0 if no point of the box can be accepted,
+//! 2 if all of them are and 1 otherwise.
+template <class T,class Traits> template <class Pred,class Accept>
+void SpatialIndex3d<T,Traits>::collect(const size_t &iNode,Pred pred,Accept accept,entry_vector &retval) const
+  {
+    const TreeNode &node= nodes[iNode];
+    const int overlap= pred(node.bnd);
+    if(overlap==0)
+      return;
+    if(overlap==2 || node.left==0)
+      {
+        const bool all= (overlap==2);
+        for(size_t i= node.begin;i<node.end;i++)
+          {
+            const Entry &e= entries[i];
+            if((all || accept(e.x)) && !is_removed(e))
+              retval.push_back(&e);
+          }
+      }
+    else
+      {
+        collect(node.left,pred,accept,retval);
+        collect(node.right,pred,accept,retval);
+      }
+  }
+
+//! @brief Returns the entries (tree and pending ones) that
+//! satisfy accept.
+template <class T,class Traits> template <class Pred,class Accept>
+typename SpatialIndex3d<T,Traits>::entry_vector SpatialIndex3d<T,Traits>::collect(Pred pred,Accept accept) const
+  {
+    prepare();
+    entry_vector retval;
+    if(!nodes.empty())
+      collect(0,pred,accept,retval);
+    for(typename std::vector<Entry>::const_iterator i= pending.begin();i!=pending.end();i++)
+      if(accept(i->x))
+        retval.push_back(&(*i));
+    return retval;
+  }
+
+//! @brief k-nearest search on the subtree. The heap contains the
+//! k best candidates found so far and d2Max the squared distance
+//! of the worst one (or the search radius if the heap is not full).
+template <class T,class Traits>
+void SpatialIndex3d<T,Traits>::nearest(const size_t &iNode,const double *p,const size_t &k,double &d2Max,std::vector<dist_entry> &heap) const
+  {
+    const TreeNode &node= nodes[iNode];
+    if(node.left==0)
+      {
+        for(size_t i= node.begin;i<node.end;i++)
+          {
+            const Entry &e= entries[i];
+            const double d2= e.dist2(p);
+            if((d2<=d2Max) && !is_removed(e))
+              {
+                heap.push_back(dist_entry(d2,&e));
+                std::push_heap(heap.begin(),heap.end());
+                if(heap.size()>k)
+                  {
+                    std::pop_heap(heap.begin(),heap.end());
+                    heap.pop_back();
+                  }
+                if(heap.size()==k)
+                  d2Max= heap.front().first;
+              }
+          }
+      }
+    else
+      {
+        size_t first= node.left, second= node.right;
+        double d2First= nodes[first].bnd.dist2(p);
+        double d2Second= nodes[second].bnd.dist2(p);
+        if(d2Second<d2First)
+          { std::swap(first,second); std::swap(d2First,d2Second); }
+        if(d2First<=d2Max)
+          nearest(first,p,k,d2Max,heap);
+        if(d2Second<=d2Max)
+          nearest(second,p,k,d2Max,heap);
+      }
+  }
+
+//! @brief Returns the objects of the entries, sorted by insertion
+//! order if required.
+template <class T,class Traits>
+typename SpatialIndex3d<T,Traits>::ptr_vector SpatialIndex3d<T,Traits>::to_ptrs(entry_vector &ev,const bool &insertionOrder)
+  {
+    if(insertionOrder)
+      std::sort(ev.begin(),ev.end(),[](const Entry *a,const Entry *b) { return a->key<b->key; });
+    ptr_vector retval(ev.size(),nullptr);
+    for(size_t i= 0;i<ev.size();i++)
+      retval[i]= ev[i]->ptr;
+    return retval;
+  }
+
+//! @brief Replaces the contents of the index with the objects
+//! pointed by the iterators (the tree is bulk loaded on the
+//! first query).
+template <class T,class Traits> template <class InputIterator>
+void SpatialIndex3d<T,Traits>::build(InputIterator first,InputIterator last)
+  {
+    clear();
+    for(InputIterator i= first;i!=last;i++)
+      if(*i)
+        pending.push_back(Entry(*i,++lastKey));
+    numObjects= pending.size();
+  }
+
+//! @brief Inserts the object at the end of the insertion order.
+template <class T,class Traits>
+void SpatialIndex3d<T,Traits>::insert(const T &t)
+  {
+    pending.push_back(Entry(&t,++lastKey));
+    numObjects++;
+  }
+
+//! @brief Inserts the object at the beginning of the insertion order.
+template <class T,class Traits>
+void SpatialIndex3d<T,Traits>::insertFront(const T &t)
+  {
+    pending.push_back(Entry(&t,--firstKey));
+    numObjects++;
+  }
+
+//! @brief Removes the object from the index.
+template <class T,class Traits>
+void SpatialIndex3d<T,Traits>::erase(const T &t)
+  {
+    const T *ptr= &t;
+    typename std::vector<Entry>::iterator i= std::find_if(pending.begin(),pending.end(),[ptr](const Entry &e) { return e.ptr==ptr; });
+    if(i!=pending.end())
+      pending.erase(i);
+    else
+      removed.insert(ptr);
+    if(numObjects>0)
+      numObjects--;
+  }
+
+//! @brief Relocates the object (to call when its position has changed
+//! without updating its position stamp).
+template <class T,class Traits>
+void SpatialIndex3d<T,Traits>::update(const T &t)
+  {
+    const T *ptr= &t;
+    typename std::vector<Entry>::iterator i= std::find_if(pending.begin(),pending.end(),[ptr](const Entry &e) { return e.ptr==ptr; });
+    if(i!=pending.end())
+      i->set_position();
+    else
+      {
+        typename std::unordered_map<const T *,size_t>::const_iterator j= positions.find(ptr);
+        if((j!=positions.end()) && !is_removed(entries[j->second]))
+          relocate(entries[j->second]);
+      }
+  }
+
+//! @brief Removes all the objects from the index.
+template <class T,class Traits>
+void SpatialIndex3d<T,Traits>::clear(void)
+  {
+    entries.clear();
+    nodes.clear();
+    positions.clear();
+    pending.clear();
+    removed.clear();
+    moveCounter= Traits::getMoveCounter();
+    numObjects= 0;
+    firstKey= 0;
+    lastKey= -1;
+  }
+
+//! @brief Returns the object nearest to the position (nullptr if
+//! there is no object closer than maxDist).
+template <class T,class Traits>
+const T *SpatialIndex3d<T,Traits>::getNearest(const Pos3d &pos,const double &maxDist) const
+  {
+    const T *retval= nullptr;
+    const ptr_vector tmp= getKNearest(pos,1,maxDist);
+    if(!tmp.empty())
+      retval= tmp.front();
+    return retval;
+  }
+
+//! @brief Returns the k objects nearest to the position (closer
+//! than maxDist) sorted by increasing distance.
+template <class T,class Traits>
+typename SpatialIndex3d<T,Traits>::ptr_vector SpatialIndex3d<T,Traits>::getKNearest(const Pos3d &pos,const size_t &k,const double &maxDist) const
+  {
+    ptr_vector retval;
+    if(k>0)
+      {
+        prepare();
+        const double p[3]= {pos.x(),pos.y(),pos.z()};
+        double d2Max= (std::isfinite(maxDist) ? maxDist*maxDist : std::numeric_limits<double>::infinity());
+        std::vector<dist_entry> heap;
+        heap.reserve(k+1);
+        if(!nodes.empty())
+          nearest(0,p,k,d2Max,heap);
+        for(typename std::vector<Entry>::const_iterator i= pending.begin();i!=pending.end();i++)
+          {
+            const double d2= i->dist2(p);
+            if(d2<=d2Max)
+              {
+                heap.push_back(dist_entry(d2,&(*i)));
+                std::push_heap(heap.begin(),heap.end());
+                if(heap.size()>k)
+                  {
+                    std::pop_heap(heap.begin(),heap.end());
+                    heap.pop_back();
+                  }
+                if(heap.size()==k)
+                  d2Max= heap.front().first;
+              }
+          }
+        std::sort_heap(heap.begin(),heap.end());
+        retval.reserve(heap.size());
+        for(typename std::vector<dist_entry>::const_iterator i= heap.begin();i!=heap.end();i++)
+          retval.push_back(i->second->ptr);
+      }
+    return retval;
+  }
+
+//! @brief Returns the objects whose distance to the position
+//! is not greater than r.
+template <class T,class Traits>
+typename SpatialIndex3d<T,Traits>::ptr_vector SpatialIndex3d<T,Traits>::getWithinRadius(const Pos3d &pos,const double &r,const bool &insertionOrder) const
+  {
+    const double p[3]= {pos.x(),pos.y(),pos.z()};
+    const double r2= r*r;
+    entry_vector tmp= collect([&p,r2](const SpatialIndexBox &bnd) { return (bnd.dist2(p)>r2 ? 0 : 1); },
+                              [&p,r2](const double *x)
+                                {
+                                  const double dx= x[0]-p[0], dy= x[1]-p[1], dz= x[2]-p[2];
+                                  return (dx*dx+dy*dy+dz*dz)<=r2;
+                                });
+    return to_ptrs(tmp,insertionOrder);
+  }
+
+//! @brief Returns the objects inside the box.
+template <class T,class Traits>
+typename SpatialIndex3d<T,Traits>::ptr_vector SpatialIndex3d<T,Traits>::getInsideBox(const SpatialIndexBox &box,const bool &insertionOrder) const
+  {
+    entry_vector tmp= collect([&box](const SpatialIndexBox &bnd) { return (box.In(bnd) ? 2 : (box.intersects(bnd) ? 1 : 0)); },
+                              [&box](const double *x) { return box.In(x); });
+    return to_ptrs(tmp,insertionOrder);
+  }
+
+//! @brief Returns the objects that lie in the half space
+//! (p-org)·n <= tol*|n|, where n is the outward normal of its
+//! boundary plane.
+template <class T,class Traits>
+typename SpatialIndex3d<T,Traits>::ptr_vector SpatialIndex3d<T,Traits>::getInsideHalfSpace(const Pos3d &org,const double *n,const double &tol,const bool &insertionOrder) const
+  {
+    const double o[3]= {org.x(),org.y(),org.z()};
+    const double lim= n[0]*o[0]+n[1]*o[1]+n[2]*o[2]+tol*std::sqrt(n[0]*n[0]+n[1]*n[1]+n[2]*n[2]);
+    entry_vector tmp= collect([n,lim](const SpatialIndexBox &bnd)
+                                {
+                                  if(bnd.getMinProjection(n)>lim) return 0;
+                                  return (bnd.getMaxProjection(n)<=lim ? 2 : 1);
+                                },
+                              [n,lim](const double *x) { return (n[0]*x[0]+n[1]*x[1]+n[2]*x[2])<=lim; });
+    return to_ptrs(tmp,insertionOrder);
+  }
+
+} // end of XC namespace
+
+#endif
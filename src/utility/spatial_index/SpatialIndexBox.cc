@@ -0,0 +1,191 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SpatialIndexBox.cc
+
+#include "SpatialIndexBox.h"
+#include "xc_utils/src/geom/pos_vec/Pos3d.h"
+#include "xc_utils/src/geom/d3/GeomObj3d.h"
+#include "xc_utils/src/geom/d2/GeomObj2d.h"
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+namespace {
+  const double inf= std::numeric_limits<double>::infinity();
+
+  //! @brief Replaces non finite values by the infinity
+  //! with the given sign.
+  double finite_or(const double &v,const double &infValue)
+    { return (std::isfinite(v) ? v : infValue); }
+}
+
+//! @brief Constructor (empty box).
+XC::SpatialIndexBox::SpatialIndexBox(void)
+  {
+    for(size_t i= 0;i<3;i++)
+      { pMin[i]= inf; pMax[i]= -inf; }
+  }
+
+//! @brief Constructor.
+//! @param p0: corner with the minimum coordinates.
+//! @param p1: corner with the maximum coordinates.
+XC::SpatialIndexBox::SpatialIndexBox(const Pos3d &p0,const Pos3d &p1)
+  {
+    pMin[0]= std::min(p0.x(),p1.x()); pMax[0]= std::max(p0.x(),p1.x());
+    pMin[1]= std::min(p0.y(),p1.y()); pMax[1]= std::max(p0.y(),p1.y());
+    pMin[2]= std::min(p0.z(),p1.z()); pMax[2]= std::max(p0.z(),p1.z());
+  }
+
+//! @brief Constructor: bounding box of the geometric object (the
+//! directions in which the object is unbounded get infinite limits).
+XC::SpatialIndexBox::SpatialIndexBox(const GeomObj3d &geomObj)
+  {
+    for(unsigned short int i= 0;i<3;i++)
+      {
+        pMin[i]= finite_or(geomObj.GetMin(i+1),-inf);
+        pMax[i]= finite_or(geomObj.GetMax(i+1),inf);
+      }
+  }
+
+//! @brief Constructor: bounding box of the prism obtained by
+//! extruding the 2D object (defined on the XY plane) between
+//! zMin and zMax.
+XC::SpatialIndexBox::SpatialIndexBox(const GeomObj2d &geomObj,const double &zMin,const double &zMax)
+  {
+    for(unsigned short int i= 0;i<2;i++)
+      {
+        pMin[i]= finite_or(geomObj.GetMin(i+1),-inf);
+        pMax[i]= finite_or(geomObj.GetMax(i+1),inf);
+      }
+    pMin[2]= std::min(zMin,zMax);
+    pMax[2]= std::max(zMin,zMax);
+  }
+
+//! @brief Returns true if the box contains no points.
+bool XC::SpatialIndexBox::empty(void) const
+  { return ((pMin[0]>pMax[0]) || (pMin[1]>pMax[1]) || (pMin[2]>pMax[2])); }
+
+//! @brief Extends the box to contain the point.
+void XC::SpatialIndexBox::extend(const double *x)
+  {
+    for(size_t i= 0;i<3;i++)
+      {
+        pMin[i]= std::min(pMin[i],x[i]);
+        pMax[i]= std::max(pMax[i],x[i]);
+      }
+  }
+
+//! @brief Enlarges the box by tol in each direction.
+void XC::SpatialIndexBox::expand(const double &tol)
+  {
+    for(size_t i= 0;i<3;i++)
+      { pMin[i]-= tol; pMax[i]+= tol; }
+  }
+
+//! @brief Returns the index of the axis along which the box is wider.
+size_t XC::SpatialIndexBox::getWidestAxis(void) const
+  {
+    size_t retval= 0;
+    double w= pMax[0]-pMin[0];
+    for(size_t i= 1;i<3;i++)
+      {
+        const double tmp= pMax[i]-pMin[i];
+        if(tmp>w)
+          { w= tmp; retval= i; }
+      }
+    return retval;
+  }
+
+//! @brief Returns true if the point lies inside the box.
+bool XC::SpatialIndexBox::In(const double *x) const
+  {
+    return ((x[0]>=pMin[0]) && (x[0]<=pMax[0]) &&
+            (x[1]>=pMin[1]) && (x[1]<=pMax[1]) &&
+            (x[2]>=pMin[2]) && (x[2]<=pMax[2]));
+  }
+
+//! @brief Returns true if the box being passed as parameter lies
+//! inside this one.
+bool XC::SpatialIndexBox::In(const SpatialIndexBox &other) const
+  {
+    for(size_t i= 0;i<3;i++)
+      if((other.pMin[i]<pMin[i]) || (other.pMax[i]>pMax[i]))
+        return false;
+    return true;
+  }
+
+//! @brief Returns true if both boxes have at least one common point.
+bool XC::SpatialIndexBox::intersects(const SpatialIndexBox &other) const
+  {
+    for(size_t i= 0;i<3;i++)
+      if((other.pMax[i]<pMin[i]) || (other.pMin[i]>pMax[i]))
+        return false;
+    return true;
+  }
+
+//! @brief Returns the squared distance from the point to the box
+//! (zero if the point is inside).
+double XC::SpatialIndexBox::dist2(const double *x) const
+  {
+    double retval= 0.0;
+    for(size_t i= 0;i<3;i++)
+      {
+        double d= 0.0;
+        if(x[i]<pMin[i])
+          d= pMin[i]-x[i];
+        else if(x[i]>pMax[i])
+          d= x[i]-pMax[i];
+        retval+= d*d;
+      }
+    return retval;
+  }
+
+//! @brief Returns the minimum value of the dot product of the
+//! vector n with the points of the box (null components of n
+//! are skipped so unbounded boxes give no NaN).
+double XC::SpatialIndexBox::getMinProjection(const double *n) const
+  {
+    double retval= 0.0;
+    for(size_t i= 0;i<3;i++)
+      {
+        if(n[i]>0.0)
+          retval+= n[i]*pMin[i];
+        else if(n[i]<0.0)
+          retval+= n[i]*pMax[i];
+      }
+    return retval;
+  }
+
+//! @brief Returns the maximum value of the dot product of the
+//! vector n with the points of the box.
+double XC::SpatialIndexBox::getMaxProjection(const double *n) const
+  {
+    double retval= 0.0;
+    for(size_t i= 0;i<3;i++)
+      {
+        if(n[i]>0.0)
+          retval+= n[i]*pMax[i];
+        else if(n[i]<0.0)
+          retval+= n[i]*pMin[i];
+      }
+    return retval;
+  }
@@ -0,0 +1,69 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SpatialIndexBox.h
+
+#ifndef SpatialIndexBox_h
+#define SpatialIndexBox_h
+
+#include <cstddef>
+
+class Pos3d;
+class GeomObj3d;
+class GeomObj2d;
+
+namespace XC {
+
+//! @ingroup Utils
+//
+//! @brief Axis aligned box used by the spatial indexes. Unbounded
+//! directions are represented by infinite limits.
+class SpatialIndexBox
+  {
+  private:
+    double pMin[3]; //!< lower limits.
+    double pMax[3]; //!< upper limits.
+  public:
+    SpatialIndexBox(void);
+    SpatialIndexBox(const Pos3d &,const Pos3d &);
+    explicit SpatialIndexBox(const GeomObj3d &);
+    SpatialIndexBox(const GeomObj2d &,const double &,const double &);
+
+    inline const double &getMin(const size_t &i) const
+      { return pMin[i]; }
+    inline const double &getMax(const size_t &i) const
+      { return pMax[i]; }
+    bool empty(void) const;
+    void extend(const double *);
+    void expand(const double &);
+    size_t getWidestAxis(void) const;
+
+    bool In(const double *) const;
+    bool In(const SpatialIndexBox &) const;
+    bool intersects(const SpatialIndexBox &) const;
+    double dist2(const double *) const;
+    double getMinProjection(const double *) const;
+    double getMaxProjection(const double *) const;
+  };
+
+} // end of XC namespace
+
+#endif
@@ -36,9 +36,9 @@
 #include "utility/actor/actor/MovableID.h"
 
 
-XC::ID XC::TaggedObjectStorage::dbTags;
-XC::ID XC::TaggedObjectStorage::classTags;
-XC::ID XC::TaggedObjectStorage::objTags;
+thread_local XC::ID XC::TaggedObjectStorage::dbTags;
+thread_local XC::ID XC::TaggedObjectStorage::classTags;
+thread_local XC::ID XC::TaggedObjectStorage::objTags;
 const int XC::TaggedObjectStorage::posDbTag1;
 const int XC::TaggedObjectStorage::posDbTag2;
 const int XC::TaggedObjectStorage::posDbTag3;
@@ -84,9 +84,9 @@ class TaggedObjectIter;
 //! obtain access to the components.
 class TaggedObjectStorage: public EntCmd, public MovableObject
   {
-    static ID dbTags;
-    static ID classTags;
-    static ID objTags;
+    static thread_local ID dbTags;
+    static thread_local ID classTags;
+    static thread_local ID objTags;
     static const int posDbTag1= 2;
     static const int posDbTag2= 3;
     static const int posDbTag3= 4;
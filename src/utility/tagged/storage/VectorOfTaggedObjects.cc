@@ -0,0 +1,259 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//VectorOfTaggedObjects.cc
+
+#include "VectorOfTaggedObjects.h"
+#include <utility/tagged/TaggedObject.h>
+#include <algorithm>
+
+//! @brief Constructor.
+//!
+//! @param owr: object owner (this object is somewhat contained by).
+//! @param containerName: name of the container.
+XC::VectorOfTaggedObjects::VectorOfTaggedObjects(EntCmd *owr,const std::string &containerName)
+  : TaggedObjectStorage(owr,containerName), numEmptySlots(0), myIter(*this) {}
+
+//! @brief Copy constructor.
+XC::VectorOfTaggedObjects::VectorOfTaggedObjects(const VectorOfTaggedObjects &otro)
+  : TaggedObjectStorage(otro), numEmptySlots(0), myIter(*this)
+  {
+    copia(otro);
+  }
+
+//! @brief Assignment operator.
+XC::VectorOfTaggedObjects &XC::VectorOfTaggedObjects::operator=(const VectorOfTaggedObjects &otro)
+  {
+    TaggedObjectStorage::operator=(otro);
+    clearAll();
+    copia(otro);
+    return *this;
+  }
+
+//! @brief Destructor.
+XC::VectorOfTaggedObjects::~VectorOfTaggedObjects(void)
+  { clearComponents(); }
+
+//! @brief Reserves memory for \p newSize components.
+int XC::VectorOfTaggedObjects::setSize(int newSize)
+  {
+    if(newSize<0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; negative size: " << newSize << std::endl;
+        return -1;
+      }
+    theVector.reserve(newSize);
+    theIndexes.reserve(newSize);
+    return 0;
+  }
+
+//! @brief Rebuilds the tag to position table.
+void XC::VectorOfTaggedObjects::updateIndexes(void)
+  {
+    theIndexes.clear();
+    const size_t sz= theVector.size();
+    for(size_t i= 0;i<sz;i++)
+      theIndexes[theVector[i]->getTag()]= i;
+  }
+
+//! @brief Removes the empty slots from the vector (keeping the
+//! order of the components).
+void XC::VectorOfTaggedObjects::compact(void)
+  {
+    if(numEmptySlots>0)
+      {
+        tagged_vector::iterator last= std::remove(theVector.begin(),theVector.end(),static_cast<TaggedObject *>(nullptr));
+        theVector.erase(last,theVector.end());
+        numEmptySlots= 0;
+        updateIndexes();
+      }
+  }
+
+//! @brief Adds a component to the container.
+//!
+//! The object is appended at the end of the vector. Returns \p false
+//! (and doesn't add the object) if another object with the same tag
+//! already exists in the container.
+bool XC::VectorOfTaggedObjects::addComponent(TaggedObject *newComponent)
+  {
+    const int tag= newComponent->getTag();
+    if(theIndexes.find(tag)!=theIndexes.end())
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; not adding as one with similar tag exists, tag: "
+                  << tag << "\n";
+        return false;
+      }
+    if(numEmptySlots>theIndexes.size())
+      compact();
+    newComponent->set_owner(this);
+    theIndexes[tag]= theVector.size();
+    theVector.push_back(newComponent);
+    transmitIDs= true; //Component added.
+    return true;
+  }
+
+//! @brief Removes (and deletes) the component whose tag is
+//! being passed as parameter. Returns true if the component existed.
+bool XC::VectorOfTaggedObjects::removeComponent(int tag)
+  {
+    bool retval= false;
+    index_map::iterator i= theIndexes.find(tag);
+    if(i!=theIndexes.end())
+      {
+        const size_t pos= i->second;
+        delete theVector[pos];
+        theVector[pos]= nullptr;
+        theIndexes.erase(i);
+        numEmptySlots++;
+        retval= true;
+        transmitIDs= true; //Component removed.
+      }
+    return retval;
+  }
+
+//! @brief Returns the number of components currently stored in the
+//! container.
+int XC::VectorOfTaggedObjects::getNumComponents(void) const
+  { return theIndexes.size(); }
+
+//! @brief Returns a pointer to the object whose tag is being
+//! passed as parameter (nullptr if not found).
+XC::TaggedObject *XC::VectorOfTaggedObjects::getComponentPtr(int tag)
+  {
+    const VectorOfTaggedObjects *cthis= static_cast<const VectorOfTaggedObjects *>(this);
+    return const_cast<TaggedObject *>(cthis->getComponentPtr(tag));
+  }
+
+//! @brief Returns a pointer to the object whose tag is being
+//! passed as parameter (nullptr if not found). Const version of
+//! the method.
+const XC::TaggedObject *XC::VectorOfTaggedObjects::getComponentPtr(int tag) const
+  {
+    const TaggedObject *retval= nullptr;
+    index_map::const_iterator i= theIndexes.find(tag);
+    if(i!=theIndexes.end())
+      retval= theVector[i->second];
+    return retval;
+  }
+
+//! @brief Returns the iterator of this object after reset it.
+XC::TaggedObjectIter &XC::VectorOfTaggedObjects::getComponents(void)
+  {
+    myIter.reset();
+    return myIter;
+  }
+
+//! @brief Returns a new iterator over the components.
+XC::VectorOfTaggedObjectsIter XC::VectorOfTaggedObjects::getIter(void)
+  { return VectorOfTaggedObjectsIter(*this); }
+
+namespace XC {
+//! @brief Compares the tags of the objects.
+inline bool lower_tag(const TaggedObject *a,const TaggedObject *b)
+  { return (a->getTag()<b->getTag()); }
+} // end of XC namespace
+
+//! @brief Sorts the components by its tag (same iteration order
+//! that MapOfTaggedObjects).
+void XC::VectorOfTaggedObjects::sortByTag(void)
+  {
+    compact();
+    std::sort(theVector.begin(),theVector.end(),lower_tag);
+    updateIndexes();
+  }
+
+//! @brief Changes the iteration order of the components.
+//!
+//! @param tags: tags of the components in the new order. The
+//! components not included in the list are placed after them
+//! keeping its relative order.
+int XC::VectorOfTaggedObjects::setOrder(const ID &tags)
+  {
+    compact();
+    const size_t sz= theVector.size();
+    tagged_vector tmp;
+    tmp.reserve(sz);
+    const int nt= tags.Size();
+    for(int i= 0;i<nt;i++)
+      {
+        index_map::iterator j= theIndexes.find(tags(i));
+        if((j==theIndexes.end()) || !theVector[j->second])
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; component with tag: " << tags(i)
+                      << " not found or repeated.\n";
+            //Restore the previous order.
+            for(tagged_vector::const_iterator k= tmp.begin();k!=tmp.end();k++)
+              theVector[theIndexes[(*k)->getTag()]]= *k;
+            return -1;
+          }
+        tmp.push_back(theVector[j->second]);
+        theVector[j->second]= nullptr; //Already moved.
+      }
+    for(size_t i= 0;i<sz;i++)
+      if(theVector[i])
+        tmp.push_back(theVector[i]);
+    theVector.swap(tmp);
+    updateIndexes();
+    return 0;
+  }
+
+//! @brief Returns an empty copy of the container.
+XC::TaggedObjectStorage *XC::VectorOfTaggedObjects::getEmptyCopy(void)
+  {
+    VectorOfTaggedObjects *theCopy= new VectorOfTaggedObjects(Owner(),containerName);  
+    if(!theCopy)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; out of memory\n";
+    return theCopy;
+  }
+
+//! @brief Deletes the components.
+void XC::VectorOfTaggedObjects::clearComponents(void)
+  {
+    for(tagged_vector::iterator i= theVector.begin();i!=theVector.end();i++)
+      {
+        delete *i;
+        *i= nullptr;
+      }
+  }
+
+//! @brief Removes all the objects from the container and, if
+//! \p invokeDestructor is true, deletes them.
+void XC::VectorOfTaggedObjects::clearAll(bool invokeDestructor)
+  {
+    if(invokeDestructor)
+      clearComponents();
+    theVector.clear();
+    theIndexes.clear();
+    numEmptySlots= 0;
+    transmitIDs= true; //All component removed.
+  }
+
+//! @brief Print stuff.
+void XC::VectorOfTaggedObjects::Print(std::ostream &s, int flag)
+  {
+    for(tagged_vector::const_iterator i= theVector.begin();i!=theVector.end();i++)
+      if(*i)
+        (*i)->Print(s, flag);
+  }
@@ -0,0 +1,89 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//VectorOfTaggedObjects.h
+
+#ifndef VectorOfTaggedObjects_h
+#define VectorOfTaggedObjects_h
+
+#include <utility/tagged/storage/TaggedObjectStorage.h>
+#include <utility/tagged/storage/VectorOfTaggedObjectsIter.h>
+#include <vector>
+#include <unordered_map>
+
+namespace XC {
+//! @ingroup Tagged
+//
+//! @brief Container that stores the pointers to the TaggedObjects
+//! in a dense vector and uses a hash table to find the position of
+//! each object from its tag.
+//!
+//! Tag lookups are made in constant time and the objects are iterated
+//! in the order they were added (or in the order established by
+//! sortByTag or setOrder) sweeping a contiguous array of pointers. When
+//! a component is removed its slot is left empty; the vector is compacted
+//! when the number of empty slots is greater than the number of
+//! stored objects.
+class VectorOfTaggedObjects: public TaggedObjectStorage
+  {
+    typedef std::vector<TaggedObject *> tagged_vector;
+    typedef std::unordered_map<int, size_t> index_map;
+  private:
+    tagged_vector theVector; //!< pointers to the stored objects.
+    index_map theIndexes; //!< position of each object in the vector.
+    size_t numEmptySlots; //!< number of empty slots (removed objects).
+    VectorOfTaggedObjectsIter myIter; //!< iterator for this object.
+  protected:
+    void clearComponents(void);
+    void compact(void);
+    void updateIndexes(void);
+
+  public:
+    VectorOfTaggedObjects(EntCmd *owr,const std::string &containerName);
+    VectorOfTaggedObjects(const VectorOfTaggedObjects &otro);
+    VectorOfTaggedObjects &operator=(const VectorOfTaggedObjects &otro);
+    ~VectorOfTaggedObjects(void);
+
+    // public methods to populate a domain
+    int setSize(int newSize);
+    bool addComponent(TaggedObject *newComponent);
+
+    bool removeComponent(int tag);    
+    int getNumComponents(void) const;
+    
+    TaggedObject *getComponentPtr(int tag);
+    const TaggedObject *getComponentPtr(int tag) const;
+    TaggedObjectIter &getComponents();
+
+    VectorOfTaggedObjectsIter getIter();
+
+    void sortByTag(void);
+    int setOrder(const ID &);
+    
+    TaggedObjectStorage *getEmptyCopy(void);
+    void clearAll(bool invokeDestructor = true);
+    
+    void Print(std::ostream &s, int flag =0);
+    friend class VectorOfTaggedObjectsIter;
+  };
+} // end of XC namespace
+
+#endif
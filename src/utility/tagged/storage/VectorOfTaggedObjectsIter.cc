@@ -0,0 +1,49 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//VectorOfTaggedObjectsIter.cc
+
+#include <utility/tagged/storage/VectorOfTaggedObjectsIter.h>
+#include <utility/tagged/storage/VectorOfTaggedObjects.h>
+
+//! @brief Constructor.
+XC::VectorOfTaggedObjectsIter::VectorOfTaggedObjectsIter(VectorOfTaggedObjects &components)
+  : theComponents(components), currentIndex(0) {}
+
+//! @brief Points the iterator to the first component.
+void XC::VectorOfTaggedObjectsIter::reset(void)
+  { currentIndex= 0; }
+
+//! @brief Returns the next component (nullptr if there are
+//! no more components).
+XC::TaggedObject *XC::VectorOfTaggedObjectsIter::operator()(void)
+  {
+    TaggedObject *retval= nullptr;
+    const size_t sz= theComponents.theVector.size();
+    while(currentIndex<sz)
+      {
+        retval= theComponents.theVector[currentIndex];
+        currentIndex++;
+        if(retval) //Not an empty slot.
+          break;
+      }
+    return retval;
+  }
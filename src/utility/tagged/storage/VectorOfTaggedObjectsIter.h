@@ -0,0 +1,50 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//VectorOfTaggedObjectsIter.h
+
+#ifndef VectorOfTaggedObjectsIter_h
+#define VectorOfTaggedObjectsIter_h
+
+#include <utility/tagged/storage/TaggedObjectIter.h>
+#include <cstddef>
+
+namespace XC {
+class VectorOfTaggedObjects;
+
+//! @ingroup Tagged
+//
+//! @brief Iterator over the objects stored in a VectorOfTaggedObjects
+//! container (returns them in storage order skipping the empty slots).
+class VectorOfTaggedObjectsIter: public TaggedObjectIter
+  {
+  private:
+    VectorOfTaggedObjects &theComponents;
+    size_t currentIndex;
+  public:
+    VectorOfTaggedObjectsIter(VectorOfTaggedObjects &);
+    
+    virtual void reset(void);
+    virtual TaggedObject *operator()(void);    
+  };
+} // end of XC namespace
+
+#endif
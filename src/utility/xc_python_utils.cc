@@ -28,6 +28,9 @@
 
 #include "xc_python_utils.h"
 #include <boost/python/extract.hpp>
+#include <boost/python/tuple.hpp>
+#include <boost/lexical_cast.hpp>
+#include <cstring>
 #include "utility/matrix/ID.h"
 #include "utility/matrix/Vector.h"
 #include "utility/matrix/Matrix.h"
@@ -117,3 +120,247 @@ m_double XC::m_double_from_py_object(const boost::python::object &o)
       }
     return retval;
   }
+
+namespace XC {
+//! @brief Returns the NumPy type string (array interface) for
+//! the type T (i.e. '<f8' for a little endian double).
+template <class T>
+std::string array_interface_typestr(const char &kind)
+  {
+    const int one= 1;
+    const char byteOrder= ((*reinterpret_cast<const char *>(&one))==1) ? '<' : '>';
+    return std::string(1,byteOrder)+kind+boost::lexical_cast<std::string>(sizeof(T));
+  }
+
+//! @brief Returns an array interface dictionary (see NumPy
+//! __array_interface__ documentation) that describes the memory
+//! block whose address is being passed as parameter.
+//!
+//! @param ptr: address of the first element.
+//! @param typestr: type of the elements.
+//! @param shape: shape of the array.
+//! @param strides: strides (in bytes) of each dimension.
+boost::python::dict array_interface(const void *ptr,const std::string &typestr,const boost::python::tuple &shape,const boost::python::tuple &strides)
+  {
+    boost::python::dict retval;
+    retval["version"]= 3;
+    retval["typestr"]= typestr;
+    retval["shape"]= shape;
+    retval["strides"]= strides;
+    retval["data"]= boost::python::make_tuple(reinterpret_cast<size_t>(ptr),false);
+    return retval;
+  }
+
+//! @brief Buffer (see Python buffer protocol) exported by a Python
+//! object (i.e. a NumPy array). The buffer is released on destruction.
+class PyBufferView
+  {
+    Py_buffer view; //!< Buffer description.
+    bool ok; //!< True if the object exports a buffer.
+    PyBufferView(const PyBufferView &);
+    PyBufferView &operator=(const PyBufferView &);
+  public:
+    PyBufferView(const boost::python::object &o)
+      : ok(false)
+      {
+        PyObject *ptr= o.ptr();
+        if(PyObject_CheckBuffer(ptr))
+          {
+            ok= (PyObject_GetBuffer(ptr,&view,PyBUF_STRIDES|PyBUF_FORMAT)==0);
+            if(!ok)
+              PyErr_Clear();
+          }
+      }
+    ~PyBufferView(void)
+      {
+        if(ok)
+          PyBuffer_Release(&view);
+      }
+    //! @brief Returns true if the object exports a buffer.
+    inline bool isOk(void) const
+      { return ok; }
+    //! @brief Returns the number of dimensions of the buffer.
+    inline int ndim(void) const
+      { return view.ndim; }
+    //! @brief Returns the size of the i-th dimension.
+    inline size_t shape(const int &i) const
+      { return view.shape[i]; }
+    //! @brief Returns the stride (bytes) of the i-th dimension.
+    inline Py_ssize_t stride(const int &i) const
+      { return view.strides[i]; }
+    //! @brief Returns the format character of the items (without
+    //! byte order prefix) or zero if the byte order is not the native one.
+    char format(void) const
+      {
+        const char *fmt= (view.format ? view.format : "B");
+        if((*fmt=='@') || (*fmt=='='))
+          fmt++;
+        else if((*fmt=='<') || (*fmt=='>') || (*fmt=='!'))
+          {
+            const int one= 1;
+            const char native= ((*reinterpret_cast<const char *>(&one))==1) ? '<' : '>';
+            if(*fmt!=native)
+              return 0;
+            fmt++;
+          }
+        return (fmt[1]==0) ? fmt[0] : 0;
+      }
+    //! @brief Returns the address of the item.
+    inline const char *item(const size_t &i,const size_t &j= 0) const
+      {
+        const char *retval= static_cast<const char *>(view.buf)+i*view.strides[0];
+        if(view.ndim>1)
+          retval+= j*view.strides[1];
+        return retval;
+      }
+    //! @brief Returns the value of the item at the address
+    //! being passed as parameter.
+    template <class T>
+    static T value(const char *p,const char &fmt)
+      {
+        T retval= 0;
+        switch(fmt)
+          {
+          case 'd': { double v; memcpy(&v,p,sizeof(v)); retval= v; break; }
+          case 'f': { float v; memcpy(&v,p,sizeof(v)); retval= v; break; }
+          case 'q': { long long v; memcpy(&v,p,sizeof(v)); retval= v; break; }
+          case 'Q': { unsigned long long v; memcpy(&v,p,sizeof(v)); retval= v; break; }
+          case 'l': { long v; memcpy(&v,p,sizeof(v)); retval= v; break; }
+          case 'L': { unsigned long v; memcpy(&v,p,sizeof(v)); retval= v; break; }
+          case 'i': { int v; memcpy(&v,p,sizeof(v)); retval= v; break; }
+          case 'I': { unsigned int v; memcpy(&v,p,sizeof(v)); retval= v; break; }
+          case 'h': { short v; memcpy(&v,p,sizeof(v)); retval= v; break; }
+          case 'H': { unsigned short v; memcpy(&v,p,sizeof(v)); retval= v; break; }
+          case 'b': retval= *reinterpret_cast<const signed char *>(p); break;
+          case 'B': retval= *reinterpret_cast<const unsigned char *>(p); break;
+          case '?': retval= *reinterpret_cast<const bool *>(p); break;
+          default:
+            break;
+          }
+        return retval;
+      }
+    //! @brief Returns true if the format is supported.
+    static bool supported(const char &fmt)
+      { return (fmt!=0) && (strchr("dfqQlLiIhHbB?",fmt)!=nullptr); }
+    //! @brief Copies the buffer contents into the array of \p n
+    //! items (the first dimension of the buffer must be equal to n).
+    //!
+    //! @param dest: destination array.
+    //! @param ld: leading dimension of the destination (column-major
+    //! storage when the buffer has two dimensions).
+    template <class T>
+    void copy(T *dest,const size_t &ld,const char &fmt,const char &nativeFmt) const
+      {
+        const size_t nRows= shape(0);
+        const size_t nCols= (view.ndim>1 ? shape(1) : 1);
+        if(fmt==nativeFmt && view.itemsize==sizeof(T) && stride(0)==sizeof(T)) //Contiguous columns.
+          for(size_t j= 0;j<nCols;j++)
+            memcpy(dest+j*ld,item(0,j),nRows*sizeof(T));
+        else
+          for(size_t j= 0;j<nCols;j++)
+            for(size_t i= 0;i<nRows;i++)
+              dest[i+j*ld]= value<T>(item(i,j),fmt);
+      }
+  };
+} // end of XC namespace
+
+//! @brief Returns the NumPy array interface (version 3) of the
+//! vector. The returned array shares the memory of the vector (it
+//! becomes invalid if the vector is resized or destroyed).
+boost::python::dict XC::xc_vector_array_interface(Vector &v)
+  {
+    return array_interface(v.getDataPtr(),array_interface_typestr<double>('f'),boost::python::make_tuple(v.Size()),boost::python::make_tuple(sizeof(double)));
+  }
+
+//! @brief Returns the NumPy array interface (version 3) of the
+//! matrix (column-major storage). The returned array shares the memory
+//! of the matrix (it becomes invalid if the matrix is resized or destroyed).
+boost::python::dict XC::xc_matrix_array_interface(Matrix &m)
+  {
+    const int nRows= m.noRows();
+    return array_interface(m.getDataPtr(),array_interface_typestr<double>('f'),boost::python::make_tuple(nRows,m.noCols()),boost::python::make_tuple(sizeof(double),nRows*sizeof(double)));
+  }
+
+//! @brief Returns the NumPy array interface (version 3) of the
+//! ID. The returned array shares the memory of the ID (it becomes
+//! invalid if the ID is resized or destroyed).
+boost::python::dict XC::xc_id_array_interface(ID &id)
+  {
+    return array_interface(id.getDataPtr(),array_interface_typestr<int>('i'),boost::python::make_tuple(id.Size()),boost::python::make_tuple(sizeof(int)));
+  }
+
+//! @brief Returns the NumPy array interface (version 3) of a one
+//! dimensional memory block.
+//!
+//! @param ptr: address of the first element.
+//! @param kind: kind of the elements ('i': integer, 'f': floating point).
+//! @param itemSize: size of each element.
+//! @param sz: number of elements.
+//! @param readOnly: true if the memory must not be modified.
+boost::python::dict XC::xc_buffer_array_interface(const void *ptr,const char &kind,const size_t &itemSize,const size_t &sz,const bool &readOnly)
+  {
+    const std::string typestr= array_interface_typestr<char>(kind).substr(0,2)+boost::lexical_cast<std::string>(itemSize);
+    boost::python::dict retval= array_interface(ptr,typestr,boost::python::make_tuple(sz),boost::python::make_tuple(itemSize));
+    retval["data"]= boost::python::make_tuple(reinterpret_cast<size_t>(ptr),readOnly);
+    return retval;
+  }
+
+//! @brief Copies the contents of an object that exports a one
+//! dimensional buffer (NumPy arrays, array.array,...) into the vector.
+//! Returns false if the object doesn't export such a buffer.
+bool XC::vector_from_py_buffer(const boost::python::object &o,Vector &v)
+  {
+    PyBufferView view(o);
+    bool retval= false;
+    if(view.isOk() && view.ndim()==1)
+      {
+        const char fmt= view.format();
+        if(PyBufferView::supported(fmt))
+          {
+            v.resize(view.shape(0));
+            view.copy(v.getDataPtr(),view.shape(0),fmt,'d');
+            retval= true;
+          }
+      }
+    return retval;
+  }
+
+//! @brief Copies the contents of an object that exports a two
+//! dimensional buffer (NumPy arrays,...) into the matrix.
+//! Returns false if the object doesn't export such a buffer.
+bool XC::matrix_from_py_buffer(const boost::python::object &o,Matrix &m)
+  {
+    PyBufferView view(o);
+    bool retval= false;
+    if(view.isOk() && view.ndim()==2)
+      {
+        const char fmt= view.format();
+        if(PyBufferView::supported(fmt))
+          {
+            m.resize(view.shape(0),view.shape(1));
+            view.copy(m.getDataPtr(),view.shape(0),fmt,'d');
+            retval= true;
+          }
+      }
+    return retval;
+  }
+
+//! @brief Copies the contents of an object that exports a one
+//! dimensional buffer (NumPy arrays, array.array,...) into the ID.
+//! Returns false if the object doesn't export such a buffer.
+bool XC::id_from_py_buffer(const boost::python::object &o,ID &id)
+  {
+    PyBufferView view(o);
+    bool retval= false;
+    if(view.isOk() && view.ndim()==1)
+      {
+        const char fmt= view.format();
+        if(PyBufferView::supported(fmt))
+          {
+            id.resize(view.shape(0));
+            view.copy(id.getDataPtr(),view.shape(0),fmt,'i');
+            retval= true;
+          }
+      }
+    return retval;
+  }
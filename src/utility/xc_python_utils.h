@@ -25,11 +25,14 @@
 #define XC_PYTHON_UTILS_H
 
 #include <boost/python/list.hpp>
+#include <boost/python/dict.hpp>
 #include <vector>
 #include "xc_basic/src/matrices/m_double.h"
 
 namespace XC {
   class ID;
+  class Vector;
+  class Matrix;
 
 boost::python::list xc_id_to_py_list(const XC::ID &);
 
@@ -37,5 +40,14 @@ std::vector<double> vector_double_from_py_object(const boost::python::object &);
 std::vector<int> vector_int_from_py_object(const boost::python::object &);
 m_double m_double_from_py_object(const boost::python::object &);
 
+boost::python::dict xc_vector_array_interface(Vector &);
+boost::python::dict xc_matrix_array_interface(Matrix &);
+boost::python::dict xc_id_array_interface(ID &);
+boost::python::dict xc_buffer_array_interface(const void *,const char &,const size_t &,const size_t &,const bool &readOnly= false);
+
+bool vector_from_py_buffer(const boost::python::object &,Vector &);
+bool matrix_from_py_buffer(const boost::python::object &,Matrix &);
+bool id_from_py_buffer(const boost::python::object &,ID &);
+
 } // end of XC namespace
 #endif
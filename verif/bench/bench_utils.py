@@ -0,0 +1,160 @@
+# -*- coding: utf-8 -*-
+''' Utilities shared by the benchmark models: base class of the models,
+    timing of the analysis phases (using the profiler of the problem)
+    and computation of the throughput figures.'''
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import os
+import time
+import xc_base
+import geom
+import xc
+
+# Profiler phases corresponding to each of the measured stages.
+stagePhases= {'assembly':['IncrementalIntegrator::formTangent','IncrementalIntegrator::formUnbalance'],
+              'factorization':['LinearSOESolver::factor'],
+              'state_determination':['Domain::update'],
+              'commit':['Domain::commit'],
+              'recorder_output':['Recorder::record']}
+
+def getStageData(profilerData,stage):
+  ''' Returns the number of calls, the wall time and the bytes
+      accumulated by the profiler phases of the stage.'''
+  calls= 0; wall= 0.0; nBytes= 0
+  for phase in stagePhases[stage]:
+    if(phase in profilerData):
+      d= profilerData[phase]
+      calls+= d['calls']; wall+= d['wall']; nBytes+= d['bytes']
+  return calls, wall, nBytes
+
+def rate(count,wall):
+  ''' Returns count/wall or None if the time is too small
+      to be measured.'''
+  if(wall>0.0):
+    return count/wall
+  return None
+
+class BenchmarkModel(object):
+  ''' Base class for the benchmark models.
+
+      The derived classes must define the name of the benchmark, the
+      dictionary with the values of the size parameter for each
+      size label and the methods build (model generation) and
+      analyze (solution).'''
+  name= None
+  sizes= {}
+  numDOFsPerNode= 0
+
+  def __init__(self,sizeLabel):
+    self.sizeLabel= sizeLabel
+    self.n= self.sizes[sizeLabel]
+    self.feProblem= xc.FEProblem()
+    self.feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+    self.preprocessor= self.feProblem.getPreprocessor
+    self.recordedNodes= list()
+
+  def build(self):
+    ''' Creates the model.'''
+    raise NotImplementedError
+
+  def analyze(self):
+    ''' Solves the model, returns zero if ok.'''
+    raise NotImplementedError
+
+  def defineRecorder(self):
+    ''' Defines a node envelope recorder for the displacements
+        of the recorded nodes (if any).'''
+    if(self.recordedNodes):
+      rec= self.feProblem.getDomain.newRecorder("node_prop_envelope_recorder",None)
+      rec.setNodes(xc.ID(self.recordedNodes))
+      rec.addQuantity("Ux","disp",0)
+
+  def saveRestore(self,dbType,dbPath):
+    ''' Returns the times spent saving the model into the
+        database and restoring it.'''
+    if(os.path.exists(dbPath)):
+      os.remove(dbPath)
+    db= self.feProblem.newDatabase(dbType,dbPath)
+    t0= time.time()
+    db.save(100)
+    tSave= time.time()-t0
+    t0= time.time()
+    db.restore(100)
+    tRestore= time.time()-t0
+    if(os.path.exists(dbPath)):
+      os.remove(dbPath)
+    return tSave, tRestore
+
+  def run(self,dbType= 'SQLite',dbPath= '/tmp/xc_bench.db'):
+    ''' Builds and solves the model and returns a dictionary
+        with the timings and throughputs of each stage.'''
+    t0= time.time()
+    self.build()
+    self.defineRecorder()
+    tBuild= time.time()-t0
+    mesh= self.feProblem.getDomain.getMesh
+    numNodes= mesh.getNumNodes()
+    numElements= mesh.getNumElements()
+    profiler= self.feProblem.getProfiler
+    profiler.reset()
+    profiler.enabled= True
+    t0= time.time()
+    result= self.analyze()
+    tAnalysis= time.time()-t0
+    profiler.enabled= False
+    data= profiler.getData()
+    tSave, tRestore= self.saveRestore(dbType,dbPath)
+
+    numDOFs= numNodes*self.numDOFsPerNode
+    retval= {'benchmark':self.name, 'size':self.sizeLabel,
+             'sizeParameter':self.n, 'result':result,
+             'numNodes':numNodes, 'numElements':numElements,
+             'numDOFs':numDOFs, 'buildTime':tBuild,
+             'analysisTime':tAnalysis, 'phases':data}
+    stages= dict()
+    # Element contributions assembled per second (and MB/s).
+    calls, wall, nBytes= getStageData(data,'assembly')
+    stages['assembly']= {'calls':calls, 'wall':wall,
+                         'elementsPerSecond':rate(float(numElements*calls),wall),
+                         'MBPerSecond':rate(nBytes/1e6,wall)}
+    # Equations factorized per second.
+    calls, wall, nBytes= getStageData(data,'factorization')
+    stages['factorization']= {'calls':calls, 'wall':wall,
+                              'factorizationsPerSecond':rate(float(calls),wall),
+                              'DOFsPerSecond':rate(float(numDOFs*calls),wall)}
+    # Element states updated per second.
+    calls, wall, nBytes= getStageData(data,'state_determination')
+    stages['state_determination']= {'calls':calls, 'wall':wall,
+                                    'elementsPerSecond':rate(float(numElements*calls),wall)}
+    # Nodes and elements committed per second.
+    calls, wall, nBytes= getStageData(data,'commit')
+    stages['commit']= {'calls':calls, 'wall':wall,
+                       'componentsPerSecond':rate(float((numNodes+numElements)*calls),wall)}
+    # Recorded nodes per second.
+    calls, wall, nBytes= getStageData(data,'recorder_output')
+    stages['recorder_output']= {'calls':calls, 'wall':wall,
+                                'nodesPerSecond':rate(float(len(self.recordedNodes)*calls),wall)}
+    # Components saved/restored per second.
+    numComponents= float(numNodes+numElements)
+    stages['database_save']= {'calls':1, 'wall':tSave,
+                              'componentsPerSecond':rate(numComponents,tSave)}
+    stages['database_restore']= {'calls':1, 'wall':tRestore,
+                                 'componentsPerSecond':rate(numComponents,tRestore)}
+    retval['stages']= stages
+    return retval
+
+def defLoadPattern(preprocessor,tsType= "constant_ts"):
+  ''' Creates the time series and the load pattern
+      used by the benchmarks.'''
+  cargas= preprocessor.getLoadHandler
+  casos= cargas.getLoadPatterns
+  ts= casos.newTimeSeries(tsType,"ts")
+  casos.currentTimeSeries= "ts"
+  lp= casos.newLoadPattern("default","0")
+  casos.currentLoadPattern= "0"
+  return lp
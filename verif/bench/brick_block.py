@@ -0,0 +1,74 @@
+# -*- coding: utf-8 -*-
+''' Benchmark: linear static analysis of a soil block meshed with
+    8-node bricks, fixed on its base and loaded on a square area
+    of its top surface. The size parameter is the number of elements
+    on each horizontal side (the depth has half that number).'''
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+import bench_utils
+
+E= 50e6 # Young modulus of the soil (Pa).
+nu= 0.3 # Poisson's ratio.
+B= 20.0 # Block side (m).
+D= 10.0 # Block depth (m).
+q= 100e3 # Foundation pressure (Pa).
+numSteps= 3 # Number of load steps.
+
+class BrickBlock(bench_utils.BenchmarkModel):
+  name= 'brick_block'
+  sizes= {'small':6, 'medium':12, 'large':20}
+  numDOFsPerNode= 3
+
+  def nodeTag(self,i,j,k):
+    return (k*(self.n+1)+j)*(self.n+1)+i+1
+
+  def build(self):
+    preprocessor= self.preprocessor
+    nodes= preprocessor.getNodeHandler
+    modelSpace= predefined_spaces.SolidMechanics3D(nodes)
+    nz= max(self.n/2,1)
+    h= B/self.n
+    hz= D/nz
+    for k in range(0,nz+1):
+      for j in range(0,self.n+1):
+        for i in range(0,self.n+1):
+          nodes.newNodeIDXYZ(self.nodeTag(i,j,k),i*h,j*h,k*hz)
+
+    elast= typical_materials.defElasticIsotropic3d(preprocessor,"elast3d",E,nu,0.0)
+    elements= preprocessor.getElementHandler
+    elements.defaultMaterial= "elast3d"
+    elements.defaultTag= 1
+    for k in range(0,nz):
+      for j in range(0,self.n):
+        for i in range(0,self.n):
+          elements.newElement("Brick",xc.ID([self.nodeTag(i,j,k),self.nodeTag(i+1,j,k),self.nodeTag(i+1,j+1,k),self.nodeTag(i,j+1,k),self.nodeTag(i,j,k+1),self.nodeTag(i+1,j,k+1),self.nodeTag(i+1,j+1,k+1),self.nodeTag(i,j+1,k+1)]))
+
+    for j in range(0,self.n+1):
+      for i in range(0,self.n+1):
+        nodes.getNode(self.nodeTag(i,j,0)).fix(xc.ID([0,1,2]),xc.Vector([0,0,0]))
+
+    lp= bench_utils.defLoadPattern(preprocessor,"linear_ts")
+    # Load on the central quarter of the top surface.
+    nodalLoad= q*h*h
+    i0= self.n/4; i1= self.n-self.n/4
+    for j in range(i0,i1+1):
+      for i in range(i0,i1+1):
+        lp.newNodalLoad(self.nodeTag(i,j,nz),xc.Vector([0,0,-nodalLoad]))
+    for i in range(0,self.n+1):
+      self.recordedNodes.append(self.nodeTag(i,self.n/2,nz))
+    preprocessor.getLoadHandler.getLoadPatterns.addToDomain("0")
+
+  def analyze(self):
+    solution= predefined_solutions.SolutionProcedure()
+    analysis= solution.simpleNewtonRaphson(self.feProblem)
+    solution.integ.dLambda1= 1.0/numSteps
+    return analysis.analyze(numSteps)
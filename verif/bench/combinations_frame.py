@@ -0,0 +1,106 @@
+# -*- coding: utf-8 -*-
+''' Benchmark: linear analysis of many load combinations on a 2D
+    frame (10 floors, 4 bays), factorizing the stiffness matrix
+    only once (analyzeLoadCombinations). The size parameter is the
+    number of load combinations.'''
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+import bench_utils
+
+E= 30e9 # Young modulus (Pa).
+nu= 0.2 # Poisson's ratio.
+A= 0.16 # Cross section area (m2).
+Iz= 0.4**4/12.0 # Cross section moment of inertia (m4).
+bayWidth= 6.0 # Bay width (m).
+floorHeight= 3.0 # Floor height (m).
+numBays= 4 # Number of bays.
+numFloors= 10 # Number of floors.
+F= 10e3 # Load magnitude (N).
+loadPatterns= ['G','Q1','Q2','W1','W2']
+
+class CombinationsFrame(bench_utils.BenchmarkModel):
+  name= 'combinations_frame'
+  sizes= {'small':10, 'medium':100, 'large':500}
+  numDOFsPerNode= 3
+
+  def nodeTag(self,i,k):
+    return k*(numBays+1)+i+1
+
+  def build(self):
+    preprocessor= self.preprocessor
+    nodes= preprocessor.getNodeHandler
+    modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+    for k in range(0,numFloors+1):
+      for i in range(0,numBays+1):
+        nodes.newNodeIDXY(self.nodeTag(i,k),i*bayWidth,k*floorHeight)
+
+    lin= modelSpace.newLinearCrdTransf("lin")
+    sectionProperties= xc.CrossSectionProperties2d()
+    sectionProperties.A= A; sectionProperties.E= E
+    sectionProperties.G= E/(2*(1+nu)); sectionProperties.I= Iz
+    section= typical_materials.defElasticSectionFromMechProp2d(preprocessor,"section",sectionProperties)
+    elements= preprocessor.getElementHandler
+    elements.defaultTransformation= "lin"
+    elements.defaultMaterial= "section"
+    elements.defaultTag= 1
+    for k in range(0,numFloors):
+      for i in range(0,numBays+1):
+        elements.newElement("ElasticBeam2d",xc.ID([self.nodeTag(i,k),self.nodeTag(i,k+1)]))
+    for k in range(1,numFloors+1):
+      for i in range(0,numBays):
+        elements.newElement("ElasticBeam2d",xc.ID([self.nodeTag(i,k),self.nodeTag(i+1,k)]))
+    for i in range(0,numBays+1):
+      modelSpace.fixNode000(self.nodeTag(i,0))
+
+    cargas= preprocessor.getLoadHandler
+    casos= cargas.getLoadPatterns
+    ts= casos.newTimeSeries("constant_ts","ts")
+    casos.currentTimeSeries= "ts"
+    lps= dict()
+    for name in loadPatterns:
+      lps[name]= casos.newLoadPattern("default",name)
+    for k in range(1,numFloors+1):
+      for i in range(0,numBays+1):
+        tag= self.nodeTag(i,k)
+        lps['G'].newNodalLoad(tag,xc.Vector([0,-4*F,0]))
+        if(i%2==0):
+          lps['Q1'].newNodalLoad(tag,xc.Vector([0,-2*F,0]))
+        else:
+          lps['Q2'].newNodalLoad(tag,xc.Vector([0,-2*F,0]))
+      lps['W1'].newNodalLoad(self.nodeTag(0,k),xc.Vector([F*k/numFloors,0,0]))
+      lps['W2'].newNodalLoad(self.nodeTag(numBays,k),xc.Vector([-F*k/numFloors,0,0]))
+      self.recordedNodes.append(self.nodeTag(0,k))
+
+    self.combs= cargas.getLoadCombinations
+    for c in range(0,self.n):
+      # Deterministic set of factors for each combination.
+      fQ1= 1.5*((c/2)%2); fQ2= 1.5*(c%2)
+      fW= 0.9*(1+(c%3))/3.0
+      wind= 'W1' if ((c/4)%2==0) else 'W2'
+      expr= '1.35*G+'+str(fQ1)+'*Q1+'+str(fQ2)+'*Q2+'+str(fW)+'*'+wind
+      self.combs.newLoadCombination('C'+str(c),expr)
+
+  def analyze(self):
+    solu= self.feProblem.getSoluProc
+    solCtrl= solu.getSoluControl
+    solModels= solCtrl.getModelWrapperContainer
+    sm= solModels.newModelWrapper("sm")
+    numberer= sm.newNumberer("default_numberer")
+    numberer.useAlgorithm("rcm")
+    cHandler= sm.newConstraintHandler("plain_handler")
+    analysisAggregations= solCtrl.getAnalysisAggregationContainer
+    analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+    solAlgo= analysisAggregation.newSolutionAlgorithm("linear_soln_algo")
+    integ= analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+    soe= analysisAggregation.newSystemOfEqn("band_spd_lin_soe")
+    solver= soe.newSolver("band_spd_lin_lapack_solver")
+    analysis= solu.newAnalysis("static_analysis","analysisAggregation","")
+    return analysis.analyzeLoadCombinations(self.combs)
@@ -0,0 +1,104 @@
+# -*- coding: utf-8 -*-
+''' Benchmark: nonlinear static analysis of a 3D frame (3x3 bays)
+    whose columns and beams are force based elements with fiber
+    sections. The size parameter is the number of floors.'''
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import geom
+import xc
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+import bench_utils
+
+E= 210e9 # Young modulus of the steel (Pa).
+fy= 275e6 # Yield stress of the steel (Pa).
+nu= 0.3 # Poisson's ratio.
+G= E/(2*(1+nu)) # Shear modulus.
+width= 0.3 # Section width (m).
+depth= 0.3 # Section depth (m).
+J= 0.141*width**4 # Torsion constant (m4).
+bayWidth= 5.0 # Bay width (m).
+floorHeight= 3.0 # Floor height (m).
+numBays= 3 # Number of bays in each direction.
+F= 20e3 # Horizontal load on each floor node (N).
+numSteps= 5 # Number of load steps.
+
+class FiberFrame3d(bench_utils.BenchmarkModel):
+  name= 'fiber_frame_3d'
+  sizes= {'small':2, 'medium':4, 'large':8}
+  numDOFsPerNode= 6
+
+  def nodeTag(self,i,j,k):
+    ''' Tag of the node at the (i,j) column line and k floor.'''
+    return k*(numBays+1)**2+j*(numBays+1)+i+1
+
+  def build(self):
+    preprocessor= self.preprocessor
+    nodes= preprocessor.getNodeHandler
+    modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+    for k in range(0,self.n+1):
+      for j in range(0,numBays+1):
+        for i in range(0,numBays+1):
+          nodes.newNodeIDXYZ(self.nodeTag(i,j,k),i*bayWidth,j*bayWidth,k*floorHeight)
+
+    modelSpace.newLinearCrdTransf("col",xc.Vector([1,0,0]))
+    modelSpace.newLinearCrdTransf("beam",xc.Vector([0,0,1]))
+
+    steel= typical_materials.defSteel01(preprocessor,"steel",E,fy,0.001)
+    respT= typical_materials.defElasticMaterial(preprocessor,"respT",G*J)
+    respVy= typical_materials.defElasticMaterial(preprocessor,"respVy",1e9)
+    respVz= typical_materials.defElasticMaterial(preprocessor,"respVz",1e9)
+    materiales= preprocessor.getMaterialHandler
+    geomSection= materiales.newSectionGeometry("geomSection")
+    steelRegion= geomSection.getRegions.newQuadRegion("steel")
+    steelRegion.nDivIJ= 5
+    steelRegion.nDivJK= 10
+    steelRegion.pMin= geom.Pos2d(-width/2.0,-depth/2.0)
+    steelRegion.pMax= geom.Pos2d(width/2.0,depth/2.0)
+    fiberSection= materiales.newMaterial("fiber_section_3d","fiberSection")
+    fiberSection.getFiberSectionRepr().setGeomNamed("geomSection")
+    fiberSection.setupFibers()
+    agg= materiales.newMaterial("section_aggregator","agg")
+    agg.setSection("fiberSection")
+    agg.setAdditions(["T","Vy","Vz"],["respT","respVy","respVz"])
+
+    elements= preprocessor.getElementHandler
+    elements.defaultMaterial= "agg"
+    elements.numSections= 5
+    elements.defaultTag= 1
+    elements.defaultTransformation= "col"
+    for k in range(0,self.n):
+      for j in range(0,numBays+1):
+        for i in range(0,numBays+1):
+          elements.newElement("ForceBeamColumn3d",xc.ID([self.nodeTag(i,j,k),self.nodeTag(i,j,k+1)]))
+    elements.defaultTransformation= "beam"
+    for k in range(1,self.n+1):
+      for j in range(0,numBays+1):
+        for i in range(0,numBays):
+          elements.newElement("ForceBeamColumn3d",xc.ID([self.nodeTag(i,j,k),self.nodeTag(i+1,j,k)]))
+      for i in range(0,numBays+1):
+        for j in range(0,numBays):
+          elements.newElement("ForceBeamColumn3d",xc.ID([self.nodeTag(i,j,k),self.nodeTag(i,j+1,k)]))
+
+    for j in range(0,numBays+1):
+      for i in range(0,numBays+1):
+        modelSpace.fixNode000_000(self.nodeTag(i,j,0))
+
+    lp= bench_utils.defLoadPattern(preprocessor,"linear_ts")
+    for k in range(1,self.n+1):
+      for j in range(0,numBays+1):
+        lp.newNodalLoad(self.nodeTag(0,j,k),xc.Vector([F,F/2.0,-10*F,0,0,0]))
+      self.recordedNodes.append(self.nodeTag(0,0,k))
+    preprocessor.getLoadHandler.getLoadPatterns.addToDomain("0")
+
+  def analyze(self):
+    solution= predefined_solutions.SolutionProcedure()
+    analysis= solution.simpleNewtonRaphson(self.feProblem)
+    solution.integ.dLambda1= 1.0/numSteps
+    return analysis.analyze(numSteps)
@@ -0,0 +1,76 @@
+# -*- coding: utf-8 -*-
+''' Benchmark: transient analysis (Newmark integrator) of a 2D shear
+    building with lumped masses on each floor under a linearly growing
+    lateral load. The size parameter is the number of floors.'''
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+import bench_utils
+
+E= 30e9 # Young modulus (Pa).
+nu= 0.2 # Poisson's ratio.
+A= 0.16 # Cross section area (m2).
+Iz= 0.4**4/12.0 # Cross section moment of inertia (m4).
+bayWidth= 6.0 # Bay width (m).
+floorHeight= 3.0 # Floor height (m).
+numBays= 2 # Number of bays.
+floorMass= 20e3 # Mass on each floor node (kg).
+F= 5e3 # Lateral load on each floor (N).
+numSteps= 100 # Number of time steps.
+dT= 0.01 # Time step (s).
+
+class NewmarkTransient(bench_utils.BenchmarkModel):
+  name= 'newmark_transient'
+  sizes= {'small':5, 'medium':20, 'large':50}
+  numDOFsPerNode= 3
+
+  def nodeTag(self,i,k):
+    return k*(numBays+1)+i+1
+
+  def build(self):
+    preprocessor= self.preprocessor
+    nodes= preprocessor.getNodeHandler
+    modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+    massMatrix= xc.Matrix([[floorMass,0,0],[0,floorMass,0],[0,0,0]])
+    for k in range(0,self.n+1):
+      for i in range(0,numBays+1):
+        nod= nodes.newNodeIDXY(self.nodeTag(i,k),i*bayWidth,k*floorHeight)
+        if(k>0):
+          nod.mass= massMatrix
+
+    lin= modelSpace.newLinearCrdTransf("lin")
+    sectionProperties= xc.CrossSectionProperties2d()
+    sectionProperties.A= A; sectionProperties.E= E
+    sectionProperties.G= E/(2*(1+nu)); sectionProperties.I= Iz
+    section= typical_materials.defElasticSectionFromMechProp2d(preprocessor,"section",sectionProperties)
+    elements= preprocessor.getElementHandler
+    elements.defaultTransformation= "lin"
+    elements.defaultMaterial= "section"
+    elements.defaultTag= 1
+    for k in range(0,self.n):
+      for i in range(0,numBays+1):
+        elements.newElement("ElasticBeam2d",xc.ID([self.nodeTag(i,k),self.nodeTag(i,k+1)]))
+    for k in range(1,self.n+1):
+      for i in range(0,numBays):
+        elements.newElement("ElasticBeam2d",xc.ID([self.nodeTag(i,k),self.nodeTag(i+1,k)]))
+    for i in range(0,numBays+1):
+      modelSpace.fixNode000(self.nodeTag(i,0))
+
+    lp= bench_utils.defLoadPattern(preprocessor,"linear_ts")
+    for k in range(1,self.n+1):
+      lp.newNodalLoad(self.nodeTag(0,k),xc.Vector([F*k/self.n,0,0]))
+      self.recordedNodes.append(self.nodeTag(0,k))
+    preprocessor.getLoadHandler.getLoadPatterns.addToDomain("0")
+
+  def analyze(self):
+    solution= predefined_solutions.SolutionProcedure()
+    analysis= solution.penaltyNewmarkNewtonRapshon(self.feProblem)
+    return analysis.analyze(numSteps,dT)
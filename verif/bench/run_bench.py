@@ -0,0 +1,80 @@
+# -*- coding: utf-8 -*-
+''' Runs the XC benchmark suite and writes the results (timings and
+    throughput of assembly, factorization, state determination, commit,
+    recorder output and database save/restore for each model and size)
+    in a JSON file.
+
+    Usage: python run_bench.py [--output results.json]
+                               [--sizes small,medium,large]
+                               [--benchmarks fiber_frame_3d,...]
+                               [--database SQLite|Memory|BerkeleyDB]
+                               [--repeat n]'''
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import sys
+import os
+import json
+import time
+import platform
+import argparse
+
+sys.path.insert(0,os.path.dirname(os.path.abspath(__file__)))
+
+import fiber_frame_3d
+import shell_slab
+import brick_block
+import combinations_frame
+import newmark_transient
+
+benchmarks= [fiber_frame_3d.FiberFrame3d,
+             shell_slab.ShellSlab,
+             brick_block.BrickBlock,
+             combinations_frame.CombinationsFrame,
+             newmark_transient.NewmarkTransient]
+
+def runSuite(names,sizes,dbType,repeat):
+  ''' Runs the benchmarks and returns the list of results.'''
+  retval= list()
+  for bench in benchmarks:
+    if(bench.name in names):
+      for size in sizes:
+        for r in range(0,repeat):
+          sys.stderr.write('running '+bench.name+' ('+size+') ... ')
+          result= bench(size).run(dbType,'/tmp/xc_bench_'+bench.name+'.db')
+          result['repetition']= r
+          sys.stderr.write(str(result['analysisTime'])+' s\n')
+          if(result['result']!=0):
+            sys.stderr.write(bench.name+' ('+size+') analysis failed.\n')
+          retval.append(result)
+  return retval
+
+parser= argparse.ArgumentParser(description='XC benchmark suite.')
+parser.add_argument('--output',default='bench_results.json',help='output file (JSON).')
+parser.add_argument('--sizes',default='small,medium,large',help='comma separated list of model sizes.')
+parser.add_argument('--benchmarks',default=','.join([b.name for b in benchmarks]),help='comma separated list of benchmarks.')
+parser.add_argument('--database',default='SQLite',help='database type used for the save/restore benchmark.')
+parser.add_argument('--repeat',type=int,default=1,help='number of repetitions of each run.')
+args= parser.parse_args()
+
+t0= time.time()
+results= runSuite(args.benchmarks.split(','),args.sizes.split(','),args.database,args.repeat)
+report= {'date':time.strftime('%Y-%m-%dT%H:%M:%S'),
+         'host':platform.node(),
+         'platform':platform.platform(),
+         'processor':platform.processor(),
+         'python':platform.python_version(),
+         'database':args.database,
+         'totalTime':time.time()-t0,
+         'results':results}
+with open(args.output,'w') as f:
+  json.dump(report,f,indent=1,sort_keys=True)
+sys.stderr.write('results written in: '+args.output+'\n')
+
+failed= [r for r in results if r['result']!=0]
+if(failed):
+  sys.exit(1)
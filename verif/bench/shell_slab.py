@@ -0,0 +1,68 @@
+# -*- coding: utf-8 -*-
+''' Benchmark: linear static analysis of a square slab meshed with
+    ShellMITC4 elements, simply supported on its four edges under
+    a uniform load. The size parameter is the number of elements
+    on each side.'''
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+import bench_utils
+
+E= 30e9 # Young modulus of the concrete (Pa).
+nu= 0.2 # Poisson's ratio.
+thickness= 0.25 # Slab thickness (m).
+L= 10.0 # Slab side (m).
+q= 10e3 # Uniform load (Pa).
+numSteps= 5 # Number of load steps.
+
+class ShellSlab(bench_utils.BenchmarkModel):
+  name= 'shell_slab'
+  sizes= {'small':10, 'medium':30, 'large':60}
+  numDOFsPerNode= 6
+
+  def nodeTag(self,i,j):
+    return j*(self.n+1)+i+1
+
+  def build(self):
+    preprocessor= self.preprocessor
+    nodes= preprocessor.getNodeHandler
+    modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+    h= L/self.n
+    for j in range(0,self.n+1):
+      for i in range(0,self.n+1):
+        nodes.newNodeIDXYZ(self.nodeTag(i,j),i*h,j*h,0.0)
+
+    memb= typical_materials.defElasticMembranePlateSection(preprocessor,"memb",E,nu,0.0,thickness)
+    elements= preprocessor.getElementHandler
+    elements.defaultMaterial= "memb"
+    elements.defaultTag= 1
+    for j in range(0,self.n):
+      for i in range(0,self.n):
+        elements.newElement("ShellMITC4",xc.ID([self.nodeTag(i,j),self.nodeTag(i+1,j),self.nodeTag(i+1,j+1),self.nodeTag(i,j+1)]))
+
+    lp= bench_utils.defLoadPattern(preprocessor,"linear_ts")
+    nodalLoad= q*h*h
+    for j in range(0,self.n+1):
+      for i in range(0,self.n+1):
+        tag= self.nodeTag(i,j)
+        if((i==0) or (j==0) or (i==self.n) or (j==self.n)):
+          modelSpace.fixNode000_FFF(tag)
+        else:
+          lp.newNodalLoad(tag,xc.Vector([0,0,-nodalLoad,0,0,0]))
+    for i in range(0,self.n+1):
+      self.recordedNodes.append(self.nodeTag(i,self.n/2))
+    preprocessor.getLoadHandler.getLoadPatterns.addToDomain("0")
+
+  def analyze(self):
+    solution= predefined_solutions.SolutionProcedure()
+    analysis= solution.simpleNewtonRaphson(self.feProblem)
+    solution.integ.dLambda1= 1.0/numSteps
+    return analysis.analyze(numSteps)
@@ -164,6 +164,18 @@ python tests/elements/kill_elements_02.py
 
 echo "$BLEU" "Solver tests." "$NORMAL"
 python tests/solution/superlu_solver_test_01.py
+python tests/solution/multithreaded_assembly_test_01.py
+python tests/solution/multithreaded_assembly_test_02.py
+python tests/solution/scatter_map_test_01.py
+python tests/solution/node_state_pool_test_01.py
+python tests/solution/supernodal_spd_solver_test_01.py
+python tests/solution/krylov_solver_test_01.py
+python tests/solution/dof_numberer_auto_test_01.py
+python tests/solution/csr_graph_rcm_test_01.py
+python tests/solution/load_combinations_batch_solve_test_01.py
+python tests/solution/linear_factor_once_test_01.py
+python tests/solution/load_combination_farm_test_01.py
+python tests/solution/load_combination_farm_test_02.py
 
 #Constraint handlers tests.
 echo "$BLEU" "  Constraint handler tests." "$NORMAL"
@@ -193,7 +205,9 @@ python tests/solution/eigenvalues/modal_analysis_test_03.py
 python tests/solution/eigenvalues/modal_analysis_test_04.py
 python tests/solution/eigenvalues/modal_analysis_test_05.py
 python tests/solution/eigenvalues/test_cqc_01.py
+python tests/solution/eigenvalues/modal_combination_test_01.py
 python tests/solution/eigenvalues/test_band_arpackpp_solver_01.py
+python tests/solution/eigenvalues/shift_invert_lanczos_solver_test_01.py
 
 #Preprocessor tests
 echo "$BLEU" "Preprocessor tests." "$NORMAL"
@@ -203,6 +217,7 @@ python tests/preprocessor/integra_simpson_fila_j.py
 python tests/preprocessor/integra_simpson_fila_k.py
 
 echo "$BLEU" "  Preprocessor entities tests." "$NORMAL"
+python tests/preprocessor/mesh_storage_mode_test_01.py
 python tests/preprocessor/cad/linea.py
 python tests/preprocessor/cad/linea_02.py
 python tests/preprocessor/cad/k_points.py
@@ -251,6 +266,7 @@ python tests/preprocessor/sets/test_resisting_svd01.py
 python tests/preprocessor/sets/test_get_contours_01.py
 python tests/preprocessor/sets/test_get_contours_02.py
 python tests/preprocessor/sets/test_pick_entities.py
+python tests/preprocessor/sets/test_spatial_queries_01.py
 python tests/preprocessor/sets/test_sets_and_grids.py
 echo "$BLEU" "  Preprocessor grid model tests." "$NORMAL"
 python tests/preprocessor/grid_model/test_grid_model_01.py
@@ -425,9 +441,12 @@ python tests/materials/fiber_section/test_interaction_diagram03.py
 python tests/materials/fiber_section/test_interaction_diagram04.py
 python tests/materials/fiber_section/test_interaction_diagram05.py
 python tests/materials/fiber_section/test_interaction_diagram06.py
+python tests/materials/fiber_section/test_interaction_diagram07.py
+python tests/materials/fiber_section/test_interaction_diagram08.py
 python tests/materials/fiber_section/test_shear_01.py
 python tests/materials/fiber_section/test_shear_02.py
 python tests/materials/fiber_section/plastic_hinge_on_IPE200.py
+python tests/materials/fiber_section/test_packed_fibers_01.py
 echo "$BLEU" "  RC sections test." "$NORMAL"
 python tests/materials/ehe/test_Ecm_concrete.py
 python tests/materials/ehe/test_EHEconcrete.py
@@ -522,8 +541,15 @@ python tests/database/test_database_15.py
 python tests/database/sqlite_test_01.py
 python tests/database/sqlite_test_02.py
 python tests/database/sqlite_test_03.py
+python tests/database/memory_datastore_test_01.py
 python tests/database/readln_test_01.py
 
+echo "$BLEU" "Verifiying matrix and vector routines." "$NORMAL"
+python tests/utility/matrix/numpy_array_interface_test_01.py
+
+echo "$BLEU" "Verifiying analysis profiler." "$NORMAL"
+python tests/utility/profiler/analysis_profiler_test_01.py
+
 echo "$BLEU" "Verifiyng import/export routines (Salome, Code_Aster,...)." "$NORMAL"
 echo "$ROSE" "  MED tests are in quarantine (some debugging pending)." "$NORMAL"
 #python tests/utility/med_xc/test_exporta_med01.py
@@ -549,9 +575,14 @@ python tests/rough_calculations/masonryBridgeVerif_test01_minim.py
 #Postprocess tests
 echo "$BLEU" "Verifiying routines for post processing." "$NORMAL"
 python tests/postprocess/test_export_shell_internal_forces.py
+python tests/postprocess/envelope_recorder_test_01.py
+python tests/postprocess/columnar_results_test_01.py
 echo "$BLEU" "  limit state checking." "$NORMAL"
 python tests/postprocess/limit_state_checking/test_shell_normal_stresses_uls_checking.py
 python tests/postprocess/limit_state_checking/test_shear_uls_checking.py
+python tests/postprocess/limit_state_checking/test_native_normal_stresses_uls_checking.py
+python tests/postprocess/limit_state_checking/test_native_shear_uls_checking.py
+python tests/postprocess/limit_state_checking/test_native_rc_section_stresses.py
 
 #VTK tests
 ##python tests/vtk/dibuja_edges.py
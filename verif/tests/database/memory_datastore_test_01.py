@@ -0,0 +1,129 @@
+# -*- coding: utf-8 -*-
+# home made test
+'''Save and restore methods verification (in-memory database with
+   the least recently used states written to disk).'''
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+# Material properties
+E= 2.1e6*9.81/1e-4 # Elastic modulus (Pa)
+nu= 0.3 # Poisson's ratio
+G= E/(2*(1+nu)) # Shear modulus
+
+# Cross section properties (IPE-80)
+A= 7.64e-4 # Cross section area (m2)
+Iy= 80.1e-8 # Cross section moment of inertia (m4)
+Iz= 8.49e-8 # Cross section moment of inertia (m4)
+J= 0.721e-8 # Cross section torsion constant (m4)
+
+# Geometry
+L= 1.5 # Bar length (m)
+
+# Load
+F= 1.5e3 # Load magnitude (kN)
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor   
+nodes= preprocessor.getNodeHandler
+
+# Problem type
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+nodes.defaultTag= 1 #First node number.
+nod= nodes.newNodeXYZ(0,0.0,0.0)
+nod= nodes.newNodeXYZ(L,0.0,0.0)
+
+lin= modelSpace.newLinearCrdTransf("lin",xc.Vector([0,1,0]))
+    
+# Materials definition
+scc= typical_materials.defElasticSection3d(preprocessor, "scc",A,E,G,Iz,Iy,J)
+
+
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= "lin"
+elements.defaultMaterial= "scc"
+#  sintaxis: ElasticBeam3d[<tag>] 
+elements.defaultTag= 1 #Tag for next element.
+beam3d= elements.newElement("ElasticBeam3d",xc.ID([1,2]));
+
+#Constraints
+modelSpace.fixNode000_000(1)
+
+#Loads
+cargas= preprocessor.getLoadHandler
+casos= cargas.getLoadPatterns
+
+#Load modulation.
+ts= casos.newTimeSeries("constant_ts","ts")
+casos.currentTimeSeries= "ts"
+#Load case definition
+lp0= casos.newLoadPattern("default","0")
+lp0.newNodalLoad(2,xc.Vector([F,0,0,0,0,0]))
+#We add the load case to domain.
+casos.addToDomain("0")
+
+# Solution
+analisis= predefined_solutions.simple_static_linear(feProblem)
+result= analisis.analyze(1)
+import os
+db= feProblem.newDatabase("Memory","/tmp/memory_datastore_test_01")
+db.save(100)
+db.save(200)
+db.memoryBudget= 1 # Only the last saved state remains in memory.
+numSnapshots= db.getNumSnapshots()
+numSpilled= db.getNumSpilledSnapshots()
+feProblem.clearAll()
+db.restore(100) # Read from disk.
+numSpilledAfterRestore= db.getNumSpilledSnapshots()
+
+nodes= preprocessor.getNodeHandler
+ 
+nod2= nodes.getNode(2)
+delta= nod2.getDisp[0]  # Node 2 xAxis displacement
+
+elem1= elements.getElement(1)
+elem1.getResistingForce()
+N1= elem1.getN1
+
+
+
+# A state whose file can't be read is removed.
+spillFile= open("/tmp/memory_datastore_test_01_200.snp","wb") # Truncate it.
+spillFile.close()
+restoreResult= db.restore(200)
+numSnapshotsAfterError= db.getNumSnapshots()
+
+deltateor= (F*L/(E*A))
+ratio1= (delta/deltateor)
+ratio2= (N1/F)
+
+''' 
+print "delta= ",delta
+print "deltateor= ",deltateor
+print "ratio1= ",ratio1
+print "N1= ",N1
+print "ratio2= ",ratio2
+print "numSnapshots= ",numSnapshots
+print "numSpilled= ",numSpilled
+print "numSpilledAfterRestore= ",numSpilledAfterRestore
+print "restoreResult= ",restoreResult
+print "numSnapshotsAfterError= ",numSnapshotsAfterError
+   '''
+
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (abs(ratio1-1.0)<1e-5) & (abs(ratio2-1.0)<1e-5) & (numSnapshots==2) & (numSpilled==1) & (numSpilledAfterRestore==1) & (restoreResult<0) & (numSnapshotsAfterError==1):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
+db.clearAll() # Your garbage you clean it
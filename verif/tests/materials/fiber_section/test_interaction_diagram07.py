@@ -0,0 +1,160 @@
+# -*- coding: utf-8 -*-
+''' Parallel computation of interaction diagrams and cache of
+    the diagrams already computed. Home made test. '''
+from __future__ import division
+
+import os
+import shutil
+import xc_base
+import geom
+import xc
+
+from materials.ehe import EHE_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+width= 0.2 # Section width expressed in meters.
+depth= 0.4 # Section width expressed in meters.
+cover= 0.05 # Concrete cover expressed in meters.
+areaFi16= 2.01e-4 # Rebar area expressed in square meters.
+areaFi20= 3.14e-4 # Rebar area expressed in square meters.
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+# Define materials
+concr= EHE_materials.HA25
+concr.alfacc=0.85    #f_maxd= 0.85*fcd concrete long term compressive strength factor (normally alfacc=1)
+concrMatTag25= concr.defDiagD(preprocessor)
+tagB500S= EHE_materials.B500S.defDiagD(preprocessor)
+
+materiales= preprocessor.getMaterialHandler
+
+def defSection(name,barArea):
+  ''' Defines a RC section with four bars of the area
+      being passed as parameter.'''
+  geomSec= materiales.newSectionGeometry("geom"+name)
+  regiones= geomSec.getRegions
+  concrete= regiones.newQuadRegion(EHE_materials.HA25.nmbDiagD)
+  concrete.nDivIJ= 10
+  concrete.nDivJK= 10
+  concrete.pMin= geom.Pos2d(-depth/2.0,-width/2.0)
+  concrete.pMax= geom.Pos2d(depth/2.0,width/2.0)
+  reinforcement= geomSec.getReinfLayers
+  reinforcementInf= reinforcement.newStraightReinfLayer(EHE_materials.B500S.nmbDiagD)
+  reinforcementInf.numReinfBars= 2
+  reinforcementInf.barArea= barArea
+  reinforcementInf.p1= geom.Pos2d(cover-depth/2.0,width/2.0-cover) # Armadura inferior.
+  reinforcementInf.p2= geom.Pos2d(cover-depth/2.0,cover-width/2.0)
+  reinforcementSup= reinforcement.newStraightReinfLayer(EHE_materials.B500S.nmbDiagD)
+  reinforcementSup.numReinfBars= 2
+  reinforcementSup.barArea= barArea
+  reinforcementSup.p1= geom.Pos2d(depth/2.0-cover,width/2.0-cover) # Armadura superior.
+  reinforcementSup.p2= geom.Pos2d(depth/2.0-cover,cover-width/2.0)
+  sec= materiales.newMaterial("fiber_section_3d",name)
+  fiberSectionRepr= sec.getFiberSectionRepr()
+  fiberSectionRepr.setGeomNamed("geom"+name)
+  sec.setupFibers()
+  return sec
+
+secHA= defSection("secHA",areaFi16)
+secHA2= defSection("secHA2",areaFi20)
+secHA3= defSection("secHA3",areaFi16) # Same as secHA.
+
+param= xc.InteractionDiagramParameters()
+param.concreteTag= EHE_materials.HA25.matTagD
+param.tagArmadura= EHE_materials.B500S.matTagD
+
+builder= materiales.getInteractionDiagramBuilder
+sectionNames= ["secHA","secHA2","secHA3"]
+testPoints= [geom.Pos3d(352877,0,0),geom.Pos3d(352877/2.0,0,0),geom.Pos3d(-574457,41505.4,2.00089e-11),geom.Pos3d(-978599,-10679.4,62804.3),geom.Pos3d(-500e3,20e3,-15e3)]
+
+def getCapacityFactors():
+  retval= list()
+  for name in sectionNames:
+    diag= materiales.getInteractionDiagram("diagInt"+name)
+    for p in testPoints:
+      retval.append(diag.getCapacityFactor(p))
+  return retval
+
+# Serial computation.
+builder.numThreads= 1
+for name in sectionNames:
+  materiales.calcInteractionDiagram(name,param)
+refFactors= getCapacityFactors()
+# secHA3 is equal to secHA so its diagram is taken from the cache.
+serialComputed= builder.numComputed
+serialHits= builder.numCacheHits
+
+# Parallel computation.
+builder.clearCache()
+builder.resetCounters()
+builder.numThreads= 4
+materiales.calcInteractionDiagrams(sectionNames,param)
+parFactors= getCapacityFactors()
+parComputed= builder.numComputed
+parHits= builder.numCacheHits
+err= 0.0
+for (a,b) in zip(refFactors,parFactors):
+  err= max(err,abs(a-b))
+
+# Persistent cache.
+cacheDir= "/tmp/xc_interaction_diagram_cache"
+if(os.path.exists(cacheDir)):
+  shutil.rmtree(cacheDir)
+os.makedirs(cacheDir)
+builder.cacheDirectory= cacheDir
+builder.clearCache()
+builder.resetCounters()
+materiales.calcInteractionDiagrams(sectionNames,param)
+writeComputed= builder.numComputed
+numFiles= len(os.listdir(cacheDir))
+builder.clearCache() # Diagrams must be read from disk.
+builder.resetCounters()
+materiales.calcInteractionDiagrams(sectionNames,param)
+readComputed= builder.numComputed
+readHits= builder.numCacheHits
+diskFactors= getCapacityFactors()
+errDisk= 0.0
+for (a,b) in zip(refFactors,diskFactors):
+  errDisk= max(errDisk,abs(a-b))
+# Files without a valid header (i.e. written by other versions)
+# are ignored and the diagrams computed again.
+for f in os.listdir(cacheDir):
+  out= open(os.path.join(cacheDir,f),'wb')
+  out.write('\x00'*64)
+  out.close()
+builder.clearCache()
+builder.resetCounters()
+materiales.calcInteractionDiagrams(sectionNames,param)
+staleComputed= builder.numComputed
+shutil.rmtree(cacheDir)
+
+# Same key for equal sections.
+sameKey= (builder.getKey(secHA,param)==builder.getKey(secHA3,param))
+differentKey= (builder.getKey(secHA,param)!=builder.getKey(secHA2,param))
+
+ratio1= refFactors[0]-1.0
+ratio2= refFactors[1]-0.5
+
+''' 
+print "serial computed= ", serialComputed, " cache hits= ", serialHits
+print "parallel computed= ", parComputed, " cache hits= ", parHits
+print "err= ", err
+print "files in cache: ", numFiles, " computed: ", writeComputed
+print "read computed= ", readComputed, " cache hits= ", readHits
+print "errDisk= ", errDisk
+print "stale computed= ", staleComputed
+print "ratio1= ",(ratio1)
+print "ratio2= ",(ratio2)
+ '''
+
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if((abs(ratio1)<1e-5) & (abs(ratio2)<1e-5) & (serialComputed==2) & (serialHits==1) & (parComputed==2) & (parHits==1) & (err<1e-10) & (writeComputed==2) & (numFiles==2) & (readComputed==0) & (readHits==3) & (errDisk<1e-10) & (staleComputed==2) & sameKey & differentKey):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
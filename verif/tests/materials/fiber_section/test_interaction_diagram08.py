@@ -0,0 +1,101 @@
+# -*- coding: utf-8 -*-
+''' Computation of the capacity factors of a batch of internal
+    forces using the vectorized interface of the interaction
+    diagrams. Home made test. '''
+from __future__ import division
+
+import os
+import xc_base
+import geom
+import xc
+
+from materials.ehe import EHE_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+width= 0.2 # Section width expressed in meters.
+depth= 0.4 # Section width expressed in meters.
+cover= 0.05 # Concrete cover expressed in meters.
+areaFi16= 2.01e-4 # Rebar area expressed in square meters.
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+# Define materials
+concr= EHE_materials.HA25
+concr.alfacc=0.85    #f_maxd= 0.85*fcd concrete long term compressive strength factor (normally alfacc=1)
+concrMatTag25= concr.defDiagD(preprocessor)
+tagB500S= EHE_materials.B500S.defDiagD(preprocessor)
+
+materiales= preprocessor.getMaterialHandler
+geomSecHA= materiales.newSectionGeometry("geomSecHA")
+regiones= geomSecHA.getRegions
+concrete= regiones.newQuadRegion(EHE_materials.HA25.nmbDiagD)
+concrete.nDivIJ= 10
+concrete.nDivJK= 10
+concrete.pMin= geom.Pos2d(-depth/2.0,-width/2.0)
+concrete.pMax= geom.Pos2d(depth/2.0,width/2.0)
+reinforcement= geomSecHA.getReinfLayers
+reinforcementInf= reinforcement.newStraightReinfLayer(EHE_materials.B500S.nmbDiagD)
+reinforcementInf.numReinfBars= 2
+reinforcementInf.barArea= areaFi16
+reinforcementInf.p1= geom.Pos2d(cover-depth/2.0,width/2.0-cover) # Armadura inferior.
+reinforcementInf.p2= geom.Pos2d(cover-depth/2.0,cover-width/2.0)
+reinforcementSup= reinforcement.newStraightReinfLayer(EHE_materials.B500S.nmbDiagD)
+reinforcementSup.numReinfBars= 2
+reinforcementSup.barArea= areaFi16
+reinforcementSup.p1= geom.Pos2d(depth/2.0-cover,width/2.0-cover) # Armadura superior.
+reinforcementSup.p2= geom.Pos2d(depth/2.0-cover,cover-width/2.0)
+
+secHA= materiales.newMaterial("fiber_section_3d","secHA")
+fiberSectionRepr= secHA.getFiberSectionRepr()
+fiberSectionRepr.setGeomNamed("geomSecHA")
+secHA.setupFibers()
+
+param= xc.InteractionDiagramParameters()
+param.concreteTag= EHE_materials.HA25.matTagD
+param.tagArmadura= EHE_materials.B500S.matTagD
+diagIntsecHA= materiales.calcInteractionDiagram("secHA",param)
+diagNMy= materiales.calcInteractionDiagramNMy("secHA",param)
+
+# Internal forces grid.
+NValues= [-1200e3,-600e3,-100e3,0.0,50e3,200e3,400e3]
+MyValues= [-60e3,-20e3,0.0,15e3,45e3]
+MzValues= [-120e3,-40e3,0.0,30e3,90e3]
+N= list(); My= list(); Mz= list()
+for n in NValues:
+  for my in MyValues:
+    for mz in MzValues:
+      N.append(n); My.append(my); Mz.append(mz)
+
+# Capacity factors (batch and one by one).
+fc3d= diagIntsecHA.getCapacityFactors(xc.Vector(N),xc.Vector(My),xc.Vector(Mz))
+err3d= 0.0
+for i in range(0,len(N)):
+  fc= diagIntsecHA.getCapacityFactor(geom.Pos3d(N[i],My[i],Mz[i]))
+  err3d= max(err3d,abs(fc-fc3d[i])/max(fc,1.0))
+
+fc2d= diagNMy.getCapacityFactors(xc.Vector(N),xc.Vector(My))
+err2d= 0.0
+for i in range(0,len(N)):
+  fc= diagNMy.getCapacityFactor(geom.Pos2d(N[i],My[i]))
+  err2d= max(err2d,abs(fc-fc2d[i])/max(fc,1.0))
+
+ratio1= fc3d.Norm()
+
+''' 
+print "number of points: ", len(N)
+print "err3d= ", err3d
+print "err2d= ", err2d
+print "ratio1= ", ratio1
+ '''
+
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if((len(fc3d)==len(N)) & (len(fc2d)==len(N)) & (err3d<1e-8) & (err2d<1e-8) & (ratio1>0.0)):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,101 @@
+# -*- coding: utf-8 -*-
+''' Checks the section tangent stiffness and stress resultant obtained
+from the packed fiber arrays (fibers grouped by material type) against
+the values obtained fiber by fiber. The section mixes Steel01, Steel02,
+Concrete01, Concrete02, elastic and elastic perfectly-plastic fibers
+(the last ones use the generic per-fiber path). Home made test.'''
+
+import xc_base
+import geom
+import xc
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2015, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+width= 0.3 # Cross section width.
+depth= 0.6 # Cross section depth.
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+# Materials (units: MPa).
+st01= typical_materials.defSteel01(preprocessor=preprocessor,name="st01",E=200e3,fy=500,b=0.01)
+st02= typical_materials.defSteel02(preprocessor=preprocessor,name="st02",E=200e3,fy=500,b=0.01,initialStress=0.0)
+c01= typical_materials.defConcrete01(preprocessor=preprocessor,name="c01",epsc0=-0.002,fpc=-30.0,fpcu=-25.0,epscu=-0.0035)
+c02= typical_materials.defConcrete02(preprocessor=preprocessor,name="c02",epsc0=-0.002,fpc=-30.0,fpcu=-25.0,epscu=-0.0035,ratioSlope=0.1,ft=3.0,Ets=1500.0)
+ela= typical_materials.defElasticMaterial(preprocessor,"ela",30e3)
+epp= typical_materials.defElasticPPMaterial(preprocessor,"epp",200e3,400.0,-400.0)
+materialNames= ["st01","st02","c01","c02","ela","epp"]
+
+# Section geometry: a strip of fibers for each material.
+geomScc= preprocessor.getMaterialHandler.newSectionGeometry("geomScc")
+regiones= geomScc.getRegions
+nStrips= len(materialNames)
+stripDepth= depth/nStrips
+for i, matName in enumerate(materialNames):
+  reg= regiones.newQuadRegion(matName)
+  reg.nDivIJ= 4
+  reg.nDivJK= 3
+  yMin= -depth/2.0+i*stripDepth
+  reg.pMin= geom.Pos2d(yMin,-width/2.0)
+  reg.pMax= geom.Pos2d(yMin+stripDepth,width/2.0)
+
+def perFiberKR(fibers,deformation,dim):
+  ''' Return the stiffness matrix and stress resultant computed fiber by
+      fiber (virtual calls to each fiber material).'''
+  K= [[0.0]*dim for i in range(dim)]
+  R= [0.0]*dim
+  for f in fibers:
+    pos= [1.0,f.getLocY(),f.getLocZ()][0:dim]
+    eps= sum(pos[i]*deformation[i] for i in range(dim))
+    mat= f.getMaterial()
+    mat.setTrialStrain(eps,0.0)
+    A= f.getArea()
+    for i in range(dim):
+      R[i]+= mat.getStress()*A*pos[i]
+      for j in range(dim):
+        K[i][j]+= mat.getTangent()*A*pos[i]*pos[j]
+  return K, R
+
+def relativeError(scc,deformation):
+  ''' Return the maximum difference between the packed and the
+      per-fiber stiffness and stress resultant.'''
+  dim= len(deformation)
+  scc.setTrialSectionDeformation(xc.Vector(deformation))
+  Kp= scc.getTangentStiffness()
+  Rp= scc.getStressResultant()
+  packedK= [[Kp(i,j) for j in range(dim)] for i in range(dim)]
+  packedR= [Rp[i] for i in range(dim)]
+  K, R= perFiberKR(scc.getFibers(),deformation,dim)
+  err= 0.0
+  for i in range(dim):
+    err= max(err,abs(packedR[i]-R[i])/max(abs(R[i]),1.0))
+    for j in range(dim):
+      err= max(err,abs(packedK[i][j]-K[i][j])/max(abs(K[i][j]),1.0))
+  return err
+
+err= 0.0
+scc3d= preprocessor.getMaterialHandler.newMaterial("fiber_section_3d","scc3d")
+scc3d.getFiberSectionRepr().setGeomNamed("geomScc")
+scc3d.setupFibers()
+for deformation in [[-0.5e-3,6e-3,2e-3],[0.2e-3,-8e-3,-3e-3],[1e-3,2e-3,5e-3]]:
+  err= max(err,relativeError(scc3d,deformation))
+
+scc2d= preprocessor.getMaterialHandler.newMaterial("fiber_section_2d","scc2d")
+scc2d.getFiberSectionRepr().setGeomNamed("geomScc")
+scc2d.setupFibers()
+for deformation in [[-0.5e-3,6e-3],[0.2e-3,-8e-3],[1e-3,2e-3]]:
+  err= max(err,relativeError(scc2d,deformation))
+
+# print "err= ", err
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (err<1e-10):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
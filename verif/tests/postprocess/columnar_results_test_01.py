@@ -0,0 +1,145 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Checks the internal forces and displacements written by the
+# element_forces_columnar_recorder and node_disp_columnar_recorder
+# (with and without compression) against the ones obtained from Python.
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc_base
+import geom
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+from postprocess import columnar_results
+
+E= 2.1e6*9.81/1e-4 # Elastic modulus (Pa)
+nu= 0.3 # Poisson's ratio
+G= E/(2*(1+nu)) # Shear modulus
+A= 7.64e-4 # Cross section area (m2)
+Iz= 80.1e-8 # Cross section moment of inertia (m4)
+L= 4.0 # Cantilever length (m)
+F= 1.5e3 # Load magnitude (N)
+numElem= 4 # Number of elements.
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+nodes.defaultTag= 1 #First node number.
+for i in range(0,numElem+1):
+  nodes.newNodeXY(i*L/numElem,0.0)
+
+lin= modelSpace.newLinearCrdTransf("lin")
+sectionProperties= xc.CrossSectionProperties2d()
+sectionProperties.A= A; sectionProperties.E= E; sectionProperties.G= G;
+sectionProperties.I= Iz; 
+seccion= typical_materials.defElasticSectionFromMechProp2d(preprocessor, "seccion",sectionProperties)
+
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= "lin"
+elements.defaultMaterial= "seccion"
+elements.defaultTag= 1 #Tag for the next element.
+for i in range(1,numElem+1):
+  elements.newElement("ElasticBeam2d",xc.ID([i,i+1]))
+
+modelSpace.fixNode000(1)
+
+cargas= preprocessor.getLoadHandler
+casos= cargas.getLoadPatterns
+ts= casos.newTimeSeries("constant_ts","ts")
+casos.currentTimeSeries= "ts"
+lpA= casos.newLoadPattern("default","A")
+lpA.newNodalLoad(numElem+1,xc.Vector([F,0,0]))
+lpB= casos.newLoadPattern("default","B")
+lpB.newNodalLoad(numElem+1,xc.Vector([0,F,0]))
+
+combs= cargas.getLoadCombinations
+combs.newLoadCombination("ELU01","1.0*A")
+combs.newLoadCombination("ELU02","1.0*A+1.5*B")
+
+# Columnar recorders (uncompressed and compressed).
+domain= feProblem.getDomain
+elemSet= [elements.getElement(i) for i in range(1,numElem+1)]
+nodSet= [nodes.getNode(i) for i in range(1,numElem+2)]
+recorders= list()
+for level in [0,6]:
+  fIntF= '/tmp/columnar_intForce_'+str(level)+'.xcr'
+  fDispl= '/tmp/columnar_displ_'+str(level)+'.xcr'
+  recIntF= columnar_results.installInternalForcesRecorder(domain,elemSet,fIntF,level)
+  recDisp= columnar_results.installDisplacementsRecorder(domain,nodSet,fDispl,level)
+  recorders.append((recIntF,fIntF,recDisp,fDispl))
+
+# Values computed from Python.
+pyIntF= dict()
+pyDispl= dict()
+analisis= predefined_solutions.simple_static_linear(feProblem)
+for key in combs.getKeys():
+  preprocessor.resetLoadCase()
+  combs.addToDomain(key) # Sets the name of the current combination.
+  result= analisis.analyze(1)
+  for e in elemSet:
+    e.getResistingForce()
+    pyIntF[(key,e.tag,0)]= [e.getN1,e.getV1,e.getM1]
+    pyIntF[(key,e.tag,1)]= [e.getN2,e.getV2,e.getM2]
+  for n in nodSet:
+    disp= n.getDisp
+    pyDispl[(key,n.tag)]= [disp[0],disp[1],disp[2]]
+  combs.removeFromDomain(key)
+
+err= 0.0
+numChunks= 0
+numRowsOk= True
+numRemoved= 0
+for (recIntF,fIntF,recDisp,fDispl) in recorders:
+  recIntF.close()
+  recDisp.close()
+  numChunks+= recIntF.numChunks+recDisp.numChunks
+  # The recorders are no longer needed.
+  if(domain.removeRecorder(recIntF)==0):
+    numRemoved+= 1
+  if(domain.removeRecorder(recDisp)==0):
+    numRemoved+= 1
+  # Internal forces (zero-copy columns).
+  for intForc in columnar_results.readInternalForces(fIntF):
+    (N,V,M)= pyIntF[(intForc.idComb,intForc.tagElem,intForc.idSection)]
+    err+= (intForc.N-N)**2+(intForc.Vy-V)**2+(intForc.Mz-M)**2
+    err+= intForc.Vz**2+intForc.T**2+intForc.My**2
+  # Rows of each chunk: two sections by element, one row by node.
+  readerIntF= xc.ColumnarResultsReader(fIntF)
+  for comb in readerIntF.getChunkNames():
+    numRowsOk= numRowsOk & (readerIntF.getNumRows(comb)==2*numElem)
+  readerIntF.close()
+  # Displacements (index by node tag).
+  reader= xc.ColumnarResultsReader(fDispl)
+  for comb in reader.getChunkNames():
+    numRowsOk= numRowsOk & (reader.getNumRows(comb)==numElem+1)
+    keys= reader.getKeys(comb)
+    for i in range(0,len(keys)):
+      (ux,uy,rotz)= pyDispl[(comb,keys[i])]
+      err+= (reader.getValues(comb,keys[i],'Ux')[0]-ux)**2
+      err+= (reader.getValues(comb,keys[i],'Uy')[0]-uy)**2
+      err+= (reader.getValues(comb,keys[i],'ROTz')[0]-rotz)**2
+    ux= columnar_results.getColumn(reader,comb,'Ux')
+    tags= columnar_results.getColumn(reader,comb,'Node')
+    for i in range(0,len(tags)):
+      err+= (ux[i]-pyDispl[(comb,int(tags[i]))][0])**2
+
+'''
+print "err= ", err
+print "numChunks= ", numChunks
+print "numRowsOk= ", numRowsOk
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (err<1e-12) & (numChunks==8) & numRowsOk & (numRemoved==4):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,140 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Checks the envelopes (maximum, minimum and combination names) computed
+# by the node_prop_envelope_recorder and element_prop_envelope_recorder
+# against the ones obtained from Python.
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc_base
+import geom
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+
+E= 2.1e6*9.81/1e-4 # Elastic modulus (Pa)
+nu= 0.3 # Poisson's ratio
+G= E/(2*(1+nu)) # Shear modulus
+A= 7.64e-4 # Cross section area (m2)
+Iz= 80.1e-8 # Cross section moment of inertia (m4)
+L= 4.0 # Cantilever length (m)
+F= 1.5e3 # Load magnitude (N)
+numElem= 4 # Number of elements.
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+nodes.defaultTag= 1 #First node number.
+for i in range(0,numElem+1):
+  nodes.newNodeXY(i*L/numElem,0.0)
+
+lin= modelSpace.newLinearCrdTransf("lin")
+sectionProperties= xc.CrossSectionProperties2d()
+sectionProperties.A= A; sectionProperties.E= E; sectionProperties.G= G;
+sectionProperties.I= Iz; 
+seccion= typical_materials.defElasticSectionFromMechProp2d(preprocessor, "seccion",sectionProperties)
+
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= "lin"
+elements.defaultMaterial= "seccion"
+elements.defaultTag= 1 #Tag for the next element.
+for i in range(1,numElem+1):
+  elements.newElement("ElasticBeam2d",xc.ID([i,i+1]))
+
+modelSpace.fixNode000(1)
+
+cargas= preprocessor.getLoadHandler
+casos= cargas.getLoadPatterns
+ts= casos.newTimeSeries("constant_ts","ts")
+casos.currentTimeSeries= "ts"
+lpA= casos.newLoadPattern("default","A")
+lpA.newNodalLoad(numElem+1,xc.Vector([F,0,0]))
+lpB= casos.newLoadPattern("default","B")
+lpB.newNodalLoad(numElem+1,xc.Vector([0,F,0]))
+lpC= casos.newLoadPattern("default","C")
+lpC.newNodalLoad(numElem+1,xc.Vector([-2*F,-F,0]))
+
+combs= cargas.getLoadCombinations
+combs.newLoadCombination("ELU01","1.0*A")
+combs.newLoadCombination("ELU02","1.0*A+1.5*B")
+combs.newLoadCombination("ELU03","1.0*C")
+combs.newLoadCombination("ELU04","0.5*B+1.0*C")
+
+# Envelope recorders.
+domain= feProblem.getDomain
+nodeTags= [i for i in range(1,numElem+2)]
+elemTags= [i for i in range(1,numElem+1)]
+nodeRecorder= domain.newRecorder("node_prop_envelope_recorder",None)
+nodeRecorder.setNodes(xc.ID(nodeTags))
+nodeRecorder.addQuantity("Ux","disp",0)
+nodeRecorder.addQuantity("Uy","disp",1)
+elemRecorder= domain.newRecorder("element_prop_envelope_recorder",None)
+elemRecorder.setElements(xc.ID(elemTags))
+elemRecorder.addQuantity("N2","localForce",3)
+elemRecorder.addQuantity("M2","localForce",5)
+
+# Envelopes computed from Python.
+def updateEnvelope(env,key,value,combName):
+  if key in env:
+    (vMax,cMax,vMin,cMin)= env[key]
+    if(value>vMax):
+      vMax= value; cMax= combName
+    if(value<vMin):
+      vMin= value; cMin= combName
+    env[key]= (vMax,cMax,vMin,cMin)
+  else:
+    env[key]= (value,combName,value,combName)
+
+pyEnv= dict()
+analisis= predefined_solutions.simple_static_linear(feProblem)
+for key in combs.getKeys():
+  preprocessor.resetLoadCase()
+  combs.addToDomain(key) # Sets the name of the current combination.
+  result= analisis.analyze(1)
+  for tag in nodeTags:
+    disp= nodes.getNode(tag).getDisp
+    updateEnvelope(pyEnv,('Ux',tag),disp[0],key)
+    updateEnvelope(pyEnv,('Uy',tag),disp[1],key)
+  for tag in elemTags:
+    elem= elements.getElement(tag)
+    elem.getResistingForce()
+    updateEnvelope(pyEnv,('N2',tag),elem.getN2,key)
+    updateEnvelope(pyEnv,('M2',tag),elem.getM2,key)
+  combs.removeFromDomain(key)
+
+err= 0.0
+combErrors= 0
+for (rec,tags,labels) in [(nodeRecorder,nodeTags,['Ux','Uy']),(elemRecorder,elemTags,['N2','M2'])]:
+  for lbl in labels:
+    vMax= rec.getMax(lbl); cMax= rec.getCombMax(lbl)
+    vMin= rec.getMin(lbl); cMin= rec.getCombMin(lbl)
+    for i,tag in enumerate(tags):
+      (pyMax,pyCMax,pyMin,pyCMin)= pyEnv[(lbl,tag)]
+      err+= (vMax[i]-pyMax)**2+(vMin[i]-pyMin)**2
+      if(abs(pyMax-pyMin)>1e-9): # Not null quantity.
+        if((cMax[i]!=pyCMax) or (cMin[i]!=pyCMin)):
+          combErrors+= 1
+
+numCombs= len(nodeRecorder.getCombinationNames())
+
+'''
+print "err= ", err
+print "combErrors= ", combErrors
+print "numCombs= ", numCombs
+print "N2 max= ", elemRecorder.getMax('N2'), elemRecorder.getCombMax('N2')
+print "N2 min= ", elemRecorder.getMin('N2'), elemRecorder.getCombMin('N2')
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (err<1e-12) & (combErrors==0) & (numCombs==4):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,111 @@
+# -*- coding: utf-8 -*-
+''' Checks that the crack control and fatigue kernels of the native
+    limit state checker (xc.LimitStateChecker) compute the same rebar
+    and concrete stresses as the StressCalc class used by the Python
+    controllers (CrackControlSIA262PlanB and FatigueController). The
+    internal forces cover all the branches of the stress computation
+    (tension, compression, simple and combined bending).'''
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc_base
+import geom
+import xc
+from materials.sections import stressCalc as sc
+from miscUtils import LogMessages as lmsg
+
+# Section.
+b= 0.3; h= 0.4; r= 0.05; rp= 0.05
+As= 4*4e-4; Asp= 4*4e-4
+Ec= 30e9; Es= 200e9
+limitStress= 300e6 # Crack control limit stress.
+limitStressRange= 100e6 # Fatigue limit stress range.
+
+# Internal forces (N,My) for each element.
+internalForces= [(500e3,10e3), # Tension.
+                 (-2000e3,10e3), # Compression.
+                 (0.0,50e3), # Simple bending (positive).
+                 (0.0,-50e3), # Simple bending (negative).
+                 (-10e3,4e3), # Combined bending (elastic).
+                 (-100e3,60e3), # Combined bending (cracked, positive).
+                 (-100e3,-60e3), # Combined bending (cracked, negative).
+                 (100e3,60e3)] # Combined bending (cracked, positive).
+# Internal forces of the reference (unloaded) combination.
+refFactor= 0.4
+numRows= len(internalForces)
+tags= [i+1 for i in range(0,numRows)]
+
+checker= xc.LimitStateChecker(2)
+for tag in tags:
+  checker.setElementSection(tag,0,'sect')
+for face in ['Pos','Neg']:
+  kernel= checker.newCheck('crack_control','crackControl'+face)
+  kernel.negativeFace= (face=='Neg')
+  kernel.setSectionParameters('sect',b,h,r,rp,As,Asp,Ec,Es,limitStress)
+kernel= checker.newCheck('fatigue_stress_range','fatigue')
+kernel.referenceCombination= 'ELUF0'
+kernel.setSectionParameters('sect',b,h,r,rp,As,Asp,Ec,Es,limitStressRange)
+
+def checkCombination(combName,factor):
+  N= [factor*f[0] for f in internalForces]
+  My= [factor*f[1] for f in internalForces]
+  zeros= xc.Vector([0.0]*numRows)
+  return checker.checkInternalForces(combName,xc.ID(tags),xc.ID([0]*numRows),xc.Vector(N),zeros,zeros,zeros,xc.Vector(My),zeros)
+
+result= checkCombination('ELUF0',refFactor)
+result+= checkCombination('ELUF1',1.0)
+
+def getStresses(N,My):
+  ''' Stresses computed by the Python class.'''
+  s= sc.StressCalc(b,h,r,rp,As,Asp,Ec,Es)
+  s.solve(N,My)
+  return (s.sgs,s.sgsp,s.sgc)
+
+def relErr(a,b):
+  return abs(a-b)/max(abs(b),1e3)
+
+err= 0.0
+elementTags= checker.getElementTags()
+crackCFs= dict()
+crackStresses= dict()
+for face in ['Pos','Neg']:
+  crackCFs[face]= checker.getCapacityFactors('crackControl'+face)
+  crackStresses[face]= checker.getAuxValues('crackControl'+face,'steelStress')
+fatigueCFs= checker.getCapacityFactors('fatigue')
+fatigueAux= dict()
+for name in checker.getCheck('fatigue').getAuxNames():
+  fatigueAux[name]= checker.getAuxValues('fatigue',name)
+for i in range(0,len(elementTags)):
+  (N,My)= internalForces[elementTags[i]-1]
+  s0= getStresses(refFactor*N,refFactor*My)
+  s1= getStresses(N,My)
+  # Crack control: worst of both combinations.
+  for j,face in enumerate(['Pos','Neg']):
+    sg= max(s0[j],s1[j])
+    err= max(err,relErr(crackStresses[face][i],sg))
+    err= max(err,abs(crackCFs[face][i]-sg/limitStress))
+  # Fatigue: stresses under the reference and the fatigue combination.
+  err= max(err,relErr(fatigueAux['posSteelStress0'][i],s0[0]))
+  err= max(err,relErr(fatigueAux['posSteelStress'][i],s1[0]))
+  err= max(err,relErr(fatigueAux['negSteelStress0'][i],s0[1]))
+  err= max(err,relErr(fatigueAux['negSteelStress'][i],s1[1]))
+  err= max(err,relErr(fatigueAux['concreteStress0'][i],s0[2]))
+  err= max(err,relErr(fatigueAux['concreteStress'][i],s1[2]))
+  fatigueCF= max(abs(s1[0]-s0[0]),abs(s1[1]-s0[1]))/limitStressRange
+  err= max(err,abs(fatigueCFs[i]-fatigueCF))
+
+'''
+print "result= ", result
+print "err= ", err
+'''
+
+import os
+fname= os.path.basename(__file__)
+if (result==0) & (len(elementTags)==numRows) & (err<1e-9):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
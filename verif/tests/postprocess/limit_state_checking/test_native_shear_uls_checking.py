@@ -0,0 +1,120 @@
+# -*- coding: utf-8 -*-
+''' Checks that the native limit state checker (xc.LimitStateChecker)
+    gives the same results as the phantom model for the shear
+    limit state (SIA 262 ShearController).'''
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import math
+import xc_base
+import geom
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials.sia262 import SIA262_materials
+from materials.sia262 import SIA262_limit_state_checking
+from materials.sections import section_properties
+from actions import combinations as combs
+from postprocess import limit_state_data as lsd
+from postprocess import RC_material_distribution
+from materials.sections.fiber_section import defSimpleRCSection
+from miscUtils import LogMessages as lmsg
+
+# Geometry
+L= 1.0 # Bar length (m)
+
+feProblem= xc.FEProblem()
+feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+
+# Materials
+sectionGeometry= section_properties.RectangularSection("test",b=.3,h=.4)
+concr= SIA262_materials.c30_37
+section= concr.defElasticShearSection3d(preprocessor, sectionGeometry)
+
+# Problem type
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+
+#Mesh.
+n1= nodes.newNodeXYZ(0,0.0,0.0)
+n2= nodes.newNodeXYZ(L/2.0,0.0,0.0)
+n3= nodes.newNodeXYZ(L,0.0,0.0)
+
+lin= modelSpace.newLinearCrdTransf("lin",xc.Vector([0,1,0]))
+
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= "lin"
+elements.defaultMaterial= section.name
+e1= elements.newElement("ElasticBeam3d",xc.ID([n1.tag,n2.tag]));
+e2= elements.newElement("ElasticBeam3d",xc.ID([n2.tag,n3.tag]));
+
+#Constraints.
+modelSpace.fixNode000_000(n1.tag)
+
+#Loads.
+cargas= preprocessor.getLoadHandler
+casos= cargas.getLoadPatterns
+ts= casos.newTimeSeries("constant_ts","ts")
+casos.currentTimeSeries= "ts"
+lp0= casos.newLoadPattern("default","lp0")
+lp0.newNodalLoad(n3.tag,xc.Vector([-400e3,1e5,1e3,0,0,0]))
+lp1= casos.newLoadPattern("default","lp1")
+lp1.newNodalLoad(n3.tag,xc.Vector([100e3,-4e4,30e3,0,0,0]))
+
+# Load combinations
+combContainer= combs.CombContainer()
+combContainer.ULS.perm.add('ULS01', '1.0*lp0')
+combContainer.ULS.perm.add('ULS02', '1.0*lp0+1.5*lp1')
+totalSet= preprocessor.getSets.getSet('total')
+lsd.LimitStateData.internal_forces_results_directory= '/tmp/'
+lsd.shearResistance.saveAll(feProblem,combContainer,totalSet) 
+
+# RC sections.
+reinfConcreteSectionDistribution= RC_material_distribution.RCMaterialDistribution()
+sections= reinfConcreteSectionDistribution.sectionDefinition
+barArea= 4e-4
+barDiameter= math.sqrt(barArea)/math.pi
+reinfLayer= defSimpleRCSection.MainReinfLayer(rebarsDiam= barDiameter,areaRebar= barArea,rebarsSpacing=0.075,width=0.25,nominalCover=0.050)
+reinfSteel= SIA262_materials.B500B
+beamRCsect= defSimpleRCSection.RecordRCSlabBeamSection(name='beamRCsect',sectionDescr='beam section',concrType=concr, reinfSteelType=reinfSteel,width= sectionGeometry.b,depth= sectionGeometry.h)
+beamRCsect.dir1PositvRebarRows=[reinfLayer]
+beamRCsect.dir1NegatvRebarRows=[reinfLayer]
+beamRCsect.dir2PositvRebarRows=[reinfLayer]
+beamRCsect.dir2NegatvRebarRows=[reinfLayer]
+shReinf= defSimpleRCSection.RecordShearReinforcement(familyName= "sh",nShReinfBranches= 2.0,areaShReinfBranch= 0.5e-4,shReinfSpacing= 0.2)
+beamRCsect.dir1ShReinfZ= shReinf
+beamRCsect.dir2ShReinfZ= shReinf
+beamRCsect.creaTwoSections()
+sections.append(beamRCsect)
+reinfConcreteSectionDistribution.assign(elemSet=totalSet.getElements,setRCSects=beamRCsect)
+
+# Checking shear (phantom model and native checker).
+lsd.shearResistance.controller= SIA262_limit_state_checking.ShearController(lsd.shearResistance.label)
+lsd.shearResistance.controller.analysisToPerform= predefined_solutions.simple_newton_raphson
+lsd.LimitStateData.check_results_directory= '/tmp/'
+lsd.shearResistance.outputDataBaseFileName= 'resVerif'
+(FEcheckedModel,meanFCs)= reinfConcreteSectionDistribution.runChecking(lsd.shearResistance, matDiagType="d",threeDim= True)
+lsd.shearResistance.outputDataBaseFileName= 'resVerifNative'
+(FEcheckedModelNative,meanFCsNative)= reinfConcreteSectionDistribution.runNativeChecking(lsd.shearResistance, matDiagType="d",threeDim= True, numThreads= 2)
+
+ratio1= abs(meanFCs[0]-meanFCsNative[0])/meanFCs[0]
+ratio2= abs(meanFCs[1]-meanFCsNative[1])/meanFCs[1]
+
+'''
+print "meanFCs= ", meanFCs
+print "meanFCsNative= ", meanFCsNative
+print "ratio1= ",ratio1
+print "ratio2= ",ratio2
+'''
+
+import os
+fname= os.path.basename(__file__)
+if (ratio1<1e-5) & (ratio2<1e-5):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
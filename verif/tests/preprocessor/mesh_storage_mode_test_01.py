@@ -0,0 +1,101 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Checks that the "vector" storage mode of the mesh (dense storage
+# iterated in insertion order) gives the same results that the
+# default one ("map", iterated in tag order).
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+
+E= 210e9 # Young modulus (Pa)
+A= 1e-3 # Bar area (m2)
+F= 10e3 # Load on each top node (N)
+numPanels= 10 # Number of truss panels.
+
+def solve(storageMode):
+  ''' Computes the displacements of a Pratt truss using
+      the storage mode being passed as parameter.'''
+  feProblem= xc.FEProblem()
+  preprocessor=  feProblem.getPreprocessor
+  mesh= feProblem.getDomain.getMesh
+  mesh.storageMode= storageMode
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+  for i in range(numPanels,-1,-1): # Reverse order.
+    nodes.newNodeIDXY(i+1001,float(i),1.0) # Top chord.
+    nodes.newNodeIDXY(i+1,float(i),0.0) # Bottom chord.
+
+  elast= typical_materials.defElasticMaterial(preprocessor, "elast",E)
+  elements= preprocessor.getElementHandler
+  elements.defaultMaterial= "elast"
+  elements.dimElem= 2
+  elements.defaultTag= 1
+  for i in range(1,numPanels+1):
+    elements.newElement("Truss",xc.ID([i,i+1])).area= A
+    elements.newElement("Truss",xc.ID([i+1000,i+1001])).area= A
+    elements.newElement("Truss",xc.ID([i,i+1000])).area= A
+    elements.newElement("Truss",xc.ID([i,i+1001])).area= A
+  elements.newElement("Truss",xc.ID([numPanels+1,numPanels+1001])).area= A
+
+  constraints= preprocessor.getBoundaryCondHandler
+  constraints.newSPConstraint(1,0,0.0)
+  constraints.newSPConstraint(1,1,0.0)
+  constraints.newSPConstraint(numPanels+1,1,0.0)
+
+  cargas= preprocessor.getLoadHandler
+  casos= cargas.getLoadPatterns
+  ts= casos.newTimeSeries("constant_ts","ts")
+  casos.currentTimeSeries= "ts"
+  lp0= casos.newLoadPattern("default","0")
+  for i in range(0,numPanels+1):
+    lp0.newNodalLoad(i+1001,xc.Vector([0.0,-F]))
+  casos.addToDomain("0")
+
+  analisis= predefined_solutions.simple_static_linear(feProblem)
+  result= analisis.analyze(1)
+  # Tag of the first node in iteration order.
+  firstTag= mesh.getNodeIter.next().tag
+  mesh.sortComponentsByTag()
+  firstTagSorted= mesh.getNodeIter.next().tag
+  retval= list()
+  for i in range(0,numPanels+1):
+    retval.append(nodes.getNode(i+1).getDisp)
+    retval.append(nodes.getNode(i+1001).getDisp)
+  return result, retval, mesh.storageMode, firstTag, firstTagSorted
+
+resultMap, dispMap, modeMap, firstMap, firstMapSorted= solve('map')
+resultVector, dispVector, modeVector, firstVector, firstVectorSorted= solve('vector')
+
+err= 0.0
+for d1, d2 in zip(dispMap, dispVector):
+  err+= (d1-d2).Norm()**2
+
+'''
+print "resultMap= ", resultMap
+print "resultVector= ", resultVector
+print "modeMap= ", modeMap, " first node: ", firstMap, firstMapSorted
+print "modeVector= ", modeVector, " first node: ", firstVector, firstVectorSorted
+print "err= ", err
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+ok= (resultMap==0) & (resultVector==0) & (err<1e-20)
+ok= ok & (modeMap=='map') & (modeVector=='vector')
+ok= ok & (firstMap==1) & (firstMapSorted==1) # tag order.
+ok= ok & (firstVector==numPanels+1001) & (firstVectorSorted==1) # insertion order.
+if ok:
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
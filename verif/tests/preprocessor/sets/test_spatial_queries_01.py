@@ -0,0 +1,93 @@
+# -*- coding: utf-8 -*-
+'''Spatial queries (box, radius, k-nearest, half space, prism) on
+the mesh and on the sets. Home made test.'''
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+from miscUtils import LogMessages as lmsg
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor   
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+
+# 6x6x6 grid of nodes.
+grid= dict()
+for i in range(0,6):
+  for j in range(0,6):
+    for k in range(0,6):
+      grid[(i,j,k)]= nodes.newNodeXYZ(i,j,k)
+
+# Beam elements along the x axis.
+lin= modelSpace.newLinearCrdTransf("lin",xc.Vector([0,1,1]))
+seccion= typical_materials.defElasticSection3d(preprocessor, "seccion",1,1,1,1,1,1)
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= "lin"
+elements.defaultMaterial= "seccion"
+for i in range(0,5):
+  elements.newElement("ElasticBeam3d",xc.ID([grid[(i,0,0)].tag,grid[(i+1,0,0)].tag]))
+
+mesh= feProblem.getDomain.getMesh
+xcTotalSet= preprocessor.getSets.getSet('total')
+
+# Box.
+nBoxMesh= len(mesh.pickNodesInsideBox(geom.Pos3d(0.5,0.5,0.5),geom.Pos3d(2.5,2.5,2.5)))
+nBoxSet= len(xcTotalSet.nodes.pickNodesInsideBox(geom.Pos3d(0.5,0.5,0.5),geom.Pos3d(2.5,2.5,2.5)))
+nInside= len(xcTotalSet.nodes.pickNodesInside(geom.BND3d(geom.Pos3d(0.5,0.5,0.5),geom.Pos3d(2.5,2.5,2.5)),0.0))
+# Radius.
+nRadius= len(mesh.pickNodesWithinRadius(geom.Pos3d(2,2,2),1.01))
+# k-nearest.
+nearest= mesh.getNearestNodes(geom.Pos3d(2.1,2.2,2.3),4)
+nearestOk= (len(nearest)==4) and (nearest[0].tag==grid[(2,2,2)].tag)
+# Half space z<=2.5.
+nHalfSpace= len(xcTotalSet.nodes.pickNodesInsideHalfSpace(geom.Pos3d(0,0,2.5),geom.Vector3d(0,0,1),0.0))
+# Prism: triangle x+y<=4.5 (x,y>=-0.5) extruded between z=-0.5 and
+# z=1.5 (no node lies on its boundary). Inside: 15 nodes (i+j<=4)
+# on each of the levels z=0 and z=1.
+plg= geom.Poligono2d()
+plg.agregaVertice(geom.Pos2d(-0.5,-0.5))
+plg.agregaVertice(geom.Pos2d(5.0,-0.5))
+plg.agregaVertice(geom.Pos2d(-0.5,5.0))
+nPrism= len(mesh.pickNodesInsidePrism(plg,-0.5,1.5,0.0))
+# Elements.
+nElemBox0= len(xcTotalSet.elements.pickElemsInsideBox(geom.Pos3d(-0.5,-0.5,-0.5),geom.Pos3d(2.5,0.5,0.5)))
+
+# Move the origin node far away: the indexes must notice it.
+movedSet= preprocessor.getSets.defSet('movedSet')
+movedSet.getNodes.append(grid[(0,0,0)])
+trfs= preprocessor.getMultiBlockTopology.getGeometricTransformations
+transl= trfs.newTransformation("translation")
+transl.setVector(geom.Vector3d(10,10,10))
+movedSet.transforms(transl)
+
+movedOk= (mesh.getNearestNode(geom.Pos3d(10.1,10,10)).tag==grid[(0,0,0)].tag)
+nOrigin= len(xcTotalSet.nodes.pickNodesInsideBox(geom.Pos3d(-0.5,-0.5,-0.5),geom.Pos3d(0.5,0.5,0.5)))
+nElemBox1= len(mesh.pickElemsInsideBox(geom.Pos3d(-0.5,-0.5,-0.5),geom.Pos3d(2.5,0.5,0.5)))
+
+ratio= (nBoxMesh-8)**2+(nBoxSet-8)**2+(nInside-8)**2+(nRadius-7)**2+(nHalfSpace-108)**2+(nPrism-30)**2+(nElemBox0-2)**2+nOrigin**2+(nElemBox1-1)**2
+
+'''
+print 'box: ', nBoxMesh, nBoxSet, nInside
+print 'radius: ', nRadius
+print 'nearest: ', nearestOk
+print 'half space: ', nHalfSpace
+print 'prism: ', nPrism
+print 'elements in box: ', nElemBox0, nElemBox1
+print 'moved: ', movedOk, nOrigin
+'''
+
+import os
+fname= os.path.basename(__file__)
+if((abs(ratio)<1e-15) and nearestOk and movedOk):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
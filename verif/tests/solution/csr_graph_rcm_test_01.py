@@ -0,0 +1,136 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Checks the compressed sparse row graphs of the analysis model: the
+# reverse Cuthill-McKee ordering of the compressed DOF group graph must
+# be the same than the one of the Graph object and the sizes of the
+# systems of equations (bandwidth, profile,...) computed from the
+# compressed DOF graph must be the same than the ones computed from
+# the Graph object. The mesh is an L-shaped plate with the node tags
+# scrambled.
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+E= 30e6 # Young modulus (psi)
+nu= 0.3 # Poisson's ratio
+F= 1e3 # Load.
+n= 8 # Number of elements on each side of the square.
+L= 10.0 # Side length.
+
+def inside(i,j):
+  ''' True if the element (i,j) belongs to the L-shaped plate.'''
+  return (i>=0) and (j>=0) and (i<n) and (j<n) and ((i<n/2) or (j<n/2))
+
+def isNode(i,j):
+  ''' True if the node (i,j) belongs to some element of the plate.'''
+  return inside(i,j) or inside(i-1,j) or inside(i,j-1) or inside(i-1,j-1)
+
+def solve(soeType,solverType):
+  ''' Computes the displacements of the nodes using the system of
+      equations and the solver being passed as parameter. Returns the
+      orderings and the sizes computed from both graphs too.'''
+  feProblem= xc.FEProblem()
+  feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+  preprocessor=  feProblem.getPreprocessor
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+  # Nodes of the L-shaped plate.
+  positions= list()
+  for j in range(0,n+1):
+    for i in range(0,n+1):
+      if(isNode(i,j)):
+        positions.append((i,j))
+  # Scrambled tags.
+  numNodes= len(positions)
+  step= 37
+  while(numNodes%step==0):
+    step+= 1
+  nodeTags= dict()
+  for k, p in enumerate(positions):
+    tag= (k*step)%numNodes+1
+    nodes.newNodeIDXY(tag,p[0]*L/n,p[1]*L/n)
+    nodeTags[p]= tag
+  elast2d= typical_materials.defElasticIsotropicPlaneStress(preprocessor, "elast2d",E,nu,0.0)
+  elements= preprocessor.getElementHandler
+  elements.defaultMaterial= "elast2d"
+  for j in range(0,n):
+    for i in range(0,n):
+      if(inside(i,j)):
+        elements.newElement("FourNodeQuad",xc.ID([nodeTags[(i,j)],nodeTags[(i+1,j)],nodeTags[(i+1,j+1)],nodeTags[(i,j+1)]]))
+
+  constraints= preprocessor.getBoundaryCondHandler
+  for i in range(0,n+1):
+    constraints.newSPConstraint(nodeTags[(i,0)],0,0.0)
+    constraints.newSPConstraint(nodeTags[(i,0)],1,0.0)
+
+  cargas= preprocessor.getLoadHandler
+  casos= cargas.getLoadPatterns
+  ts= casos.newTimeSeries("constant_ts","ts")
+  casos.currentTimeSeries= "ts"
+  lp0= casos.newLoadPattern("default","0")
+  lp0.newNodalLoad(nodeTags[(0,n)],xc.Vector([F,-F]))
+  lp0.newNodalLoad(nodeTags[(n,n/2)],xc.Vector([-F,F]))
+  casos.addToDomain("0")
+
+  solu= feProblem.getSoluProc
+  solCtrl= solu.getSoluControl
+  solModels= solCtrl.getModelWrapperContainer
+  sm= solModels.newModelWrapper("sm")
+  numberer= sm.newNumberer("default_numberer")
+  numberer.useAlgorithm("rcm")
+  cHandler= sm.newConstraintHandler("plain_handler")
+  analysisAggregations= solCtrl.getAnalysisAggregationContainer
+  analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+  solAlgo= analysisAggregation.newSolutionAlgorithm("linear_soln_algo")
+  integ= analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+  soe= analysisAggregation.newSystemOfEqn(soeType)
+  solver= soe.newSolver(solverType)
+  analysis= solu.newAnalysis("static_analysis","analysisAggregation","")
+  result= analysis.analyze(1)
+  disp= dict()
+  for p in nodeTags:
+    disp[p]= nodes.getNode(nodeTags[p]).getDisp
+  csrOrdering= list(numberer.getGraphOrdering(True))
+  graphOrdering= list(numberer.getGraphOrdering(False))
+  csrSizes= numberer.getDOFGraphSizes(True)
+  graphSizes= numberer.getDOFGraphSizes(False)
+  numFreeNodes= numNodes-(n+1)
+  return result, disp, csrOrdering, graphOrdering, csrSizes, graphSizes, numFreeNodes
+
+def maxDiff(a,b):
+  ''' Maximum relative difference between the displacements.'''
+  norm= max([b[p].Norm() for p in b])
+  return max([(a[p]-b[p]).Norm() for p in b])/norm
+
+resultRef, dispRef, csrOrdering, graphOrdering, csrSizes, graphSizes, numFreeNodes= solve("full_gen_lin_soe","full_gen_lin_lapack_solver")
+ok= (resultRef==0)
+for soeType, solverType in [("band_gen_lin_soe","band_gen_lin_lapack_solver"),("band_spd_lin_soe","band_spd_lin_lapack_solver"),("profile_spd_lin_soe","profile_spd_lin_direct_solver"),("sparse_gen_col_lin_soe","super_lu_solver"),("sym_sparse_lin_soe","sym_sparse_lin_solver")]:
+  result, disp, csrOrdering, graphOrdering, csrSizes, graphSizes, numFreeNodes= solve(soeType,solverType)
+  ok= ok & (result==0) & (maxDiff(disp,dispRef)<1e-10)
+  # Same permutation from both graphs.
+  ok= ok & (len(csrOrdering)>0) & (csrOrdering==graphOrdering)
+  # Same sizes from both graphs.
+  ok= ok & (csrSizes==graphSizes) & (csrSizes['numEquations']==2*numFreeNodes)
+  ok= ok & (csrSizes['profile']>csrSizes['numEquations']) # Not trivial.
+  '''
+  print soeType, maxDiff(disp,dispRef)
+  print csrSizes
+  print graphSizes
+  '''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if ok:
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,114 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Checks the fill reducing orderings (approximate minimum degree and
+# nested dissection) and the automatic selection of the ordering
+# with the smallest factorization cost estimate.
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+E= 30e6 # Young modulus (psi)
+nu= 0.3 # Poisson's ratio
+F= 1e3 # Load.
+n= 20 # Number of elements on each side.
+L= 10.0 # Side length.
+
+def solve(numbererAlgorithm,soeType,solverType):
+  ''' Computes the displacements of the loaded node using the
+      numbering algorithm, the system of equations and the solver
+      being passed as parameter.'''
+  feProblem= xc.FEProblem()
+  feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+  preprocessor=  feProblem.getPreprocessor
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+  for j in range(0,n+1):
+    for i in range(0,n+1):
+      nodes.newNodeIDXY(j*(n+1)+i+1,i*L/n,j*L/n)
+  elast2d= typical_materials.defElasticIsotropicPlaneStress(preprocessor, "elast2d",E,nu,0.0)
+  elements= preprocessor.getElementHandler
+  elements.defaultMaterial= "elast2d"
+  for j in range(0,n):
+    for i in range(0,n):
+      n1= j*(n+1)+i+1
+      elements.newElement("FourNodeQuad",xc.ID([n1,n1+1,n1+n+2,n1+n+1]))
+
+  constraints= preprocessor.getBoundaryCondHandler
+  for i in range(0,n+1):
+    constraints.newSPConstraint(i+1,0,0.0)
+    constraints.newSPConstraint(i+1,1,0.0)
+
+  cargas= preprocessor.getLoadHandler
+  casos= cargas.getLoadPatterns
+  ts= casos.newTimeSeries("constant_ts","ts")
+  casos.currentTimeSeries= "ts"
+  lp0= casos.newLoadPattern("default","0")
+  loadedNode= (n+1)*(n+1)
+  lp0.newNodalLoad(loadedNode,xc.Vector([F,-F]))
+  casos.addToDomain("0")
+
+  solu= feProblem.getSoluProc
+  solCtrl= solu.getSoluControl
+  solModels= solCtrl.getModelWrapperContainer
+  sm= solModels.newModelWrapper("sm")
+  numberer= sm.newNumberer("default_numberer")
+  numberer.useAlgorithm(numbererAlgorithm)
+  cHandler= sm.newConstraintHandler("plain_handler")
+  analysisAggregations= solCtrl.getAnalysisAggregationContainer
+  analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+  solAlgo= analysisAggregation.newSolutionAlgorithm("linear_soln_algo")
+  integ= analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+  soe= analysisAggregation.newSystemOfEqn(soeType)
+  solver= soe.newSolver(solverType)
+  analysis= solu.newAnalysis("static_analysis","analysisAggregation","")
+  result= analysis.analyze(1)
+  return result, nodes.getNode(loadedNode).getDisp, numberer.algorithm, numberer.storageScheme, numberer.getOrderingEstimates()
+
+# Reference solution.
+resultRef, dispRef, alg, scheme, est= solve("rcm","sparse_gen_col_lin_soe","super_lu_solver")
+ok= (resultRef==0)
+# Explicit orderings.
+for a in ['amd','nested_dissection']:
+  result, disp, alg, scheme, est= solve(a,"sparse_gen_col_lin_soe","super_lu_solver")
+  ok= ok & (result==0) & ((disp-dispRef).Norm()/dispRef.Norm()<1e-10) & (alg==a)
+
+# Automatic selection for a sparse solver.
+resultSp, dispSp, algSp, schemeSp, estSp= solve("auto","sparse_gen_col_lin_soe","super_lu_solver")
+minCostSp= min([estSp[a]['cost'] for a in estSp])
+ok= ok & (resultSp==0) & ((dispSp-dispRef).Norm()/dispRef.Norm()<1e-10)
+ok= ok & (schemeSp=='sparse') & (estSp[algSp]['cost']==minCostSp)
+ok= ok & (algSp in ['amd','nested_dissection']) # fill reducing ordering.
+ok= ok & (estSp[algSp]['factorNonZeros']<estSp['rcm']['profile'])
+
+# Automatic selection for a band solver.
+resultBd, dispBd, algBd, schemeBd, estBd= solve("auto","band_spd_lin_soe","band_spd_lin_lapack_solver")
+minCostBd= min([estBd[a]['cost'] for a in estBd])
+ok= ok & (resultBd==0) & ((dispBd-dispRef).Norm()/dispRef.Norm()<1e-10)
+ok= ok & (schemeBd=='band') & (estBd[algBd]['cost']==minCostBd)
+ok= ok & (estBd[algBd]['bandwidth']<=estBd['amd']['bandwidth'])
+numEqn= 2*n*(n+1)
+for a in estBd:
+  ok= ok & (estBd[a]['numEquations']==numEqn)
+
+'''
+print "dispRef= ", dispRef
+print "sparse: ", algSp, estSp[algSp]
+print "band: ", algBd, estBd[algBd]
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if ok:
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
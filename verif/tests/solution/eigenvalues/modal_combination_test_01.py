@@ -0,0 +1,227 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Combination of the modal responses (SRSS and CQC) computed with
+# the ModalCombination object. The model is the one of the test
+# modal_analysis_test_02.py. The combined displacements are compared
+# with the ones obtained from the distribution factors and the
+# combined base shear with the one obtained from the equivalent
+# static loads.
+from __future__ import division
+import xc_base
+import geom
+import xc
+
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+import math
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+storeyMass= 134.4e3
+nodeMassMatrix= xc.Matrix([[storeyMass,0,0],[0,0,0],[0,0,0]])
+Ehorm= 200000*1e5 # Concrete elastic modulus.
+
+Bbaja= 0.45 # Columns size.
+Ibaja= 1/12.0*Bbaja**4 # Cross section moment of inertia.
+Hbaja= 4 # Altura de la planta baja.
+B1a= 0.40 # Columns size.
+I1a= 1/12.0*B1a**4 # Cross section moment of inertia.
+H= 3 # Altura del resto de plantas.
+B3a= 0.35 # Columns size.
+I3a= 1/12.0*B3a**4 # Cross section moment of inertia.
+
+
+kPlBaja= 20*12*Ehorm*Ibaja/(Hbaja**3)
+kPl1a= 20*12*Ehorm*I1a/(H**3)
+kPl2a= kPl1a
+kPl3a= 20*12*Ehorm*I3a/(H**3)
+kPl4a= kPl3a
+
+# Problem type
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+nodes.defaultTag= 0;
+nod0= nodes.newNodeXY(0,0)
+nod0.mass= nodeMassMatrix
+nod0.setProp("gdlsCoartados",xc.ID([0,1,2]))
+nod1= nodes.newNodeXY(0,4) 
+nod1.mass= nodeMassMatrix
+nod1.setProp("gdlsCoartados",xc.ID([1,2]))
+nod2= nodes.newNodeXY(0,4+3) 
+nod2.mass= nodeMassMatrix
+nod2.setProp("gdlsCoartados",xc.ID([1,2]))
+nod3= nodes.newNodeXY(0,4+3+3) 
+nod3.mass= nodeMassMatrix
+nod3.setProp("gdlsCoartados",xc.ID([1,2]))
+nod4= nodes.newNodeXY(0,4+3+3+3) 
+nod4.mass= nodeMassMatrix
+nod4.setProp("gdlsCoartados",xc.ID([1,2]))
+nod5= nodes.newNodeXY(0,4+3+3+3+3) 
+nod5.mass= nodeMassMatrix
+nod5.setProp("gdlsCoartados",xc.ID([1,2]))
+setTotal= preprocessor.getSets.getSet("total")
+nodes= setTotal.getNodes
+for n in nodes:
+  n.fix(n.getProp("gdlsCoartados"),xc.Vector([0,0,0]))
+
+# Materials definition
+sccPlBaja= typical_materials.defElasticSection2d(preprocessor, "sccPlBaja",20*Bbaja*Bbaja,Ehorm,20*Ibaja)
+sccPl1a= typical_materials.defElasticSection2d(preprocessor, "sccPl1a",20*B1a*B1a,Ehorm,20*I1a) 
+sccPl2a= typical_materials.defElasticSection2d(preprocessor, "sccPl2a",20*B1a*B1a,Ehorm,20*I1a) 
+sccPl3a= typical_materials.defElasticSection2d(preprocessor, "sccPl3a",20*B3a*B3a,Ehorm,20*I3a) 
+sccPl4a= typical_materials.defElasticSection2d(preprocessor, "sccPl4a",20*B3a*B3a,Ehorm,20*I3a)
+
+
+# Geometric transformation(s)
+lin= modelSpace.newLinearCrdTransf("lin")
+
+# Elements definition
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= "lin"
+elements.defaultMaterial= "sccPlBaja"
+elements.defaultTag= 1 #Tag for next element.
+beam2d= elements.newElement("ElasticBeam2d",xc.ID([0,1]))
+beam2d.h= Bbaja
+elements.defaultMaterial= "sccPl1a" 
+beam2d= elements.newElement("ElasticBeam2d",xc.ID([1,2]))
+beam2d.h= B1a
+elements.defaultMaterial= "sccPl2a" 
+beam2d= elements.newElement("ElasticBeam2d",xc.ID([2,3]))
+beam2d.h= B1a
+elements.defaultMaterial= "sccPl3a" 
+beam2d= elements.newElement("ElasticBeam2d",xc.ID([3,4]))
+beam2d.h= B3a
+elements.defaultMaterial= "sccPl4a" 
+beam2d= elements.newElement("ElasticBeam2d",xc.ID([4,5]))
+beam2d.h= B3a
+
+
+
+
+
+# Solution procedure
+solu= feProblem.getSoluProc
+solCtrl= solu.getSoluControl
+
+
+solModels= solCtrl.getModelWrapperContainer
+sm= solModels.newModelWrapper("sm")
+
+
+cHandler= sm.newConstraintHandler("transformation_constraint_handler")
+
+numberer= sm.newNumberer("default_numberer")
+numberer.useAlgorithm("rcm")
+
+analysisAggregations= solCtrl.getAnalysisAggregationContainer
+analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+solAlgo= analysisAggregation.newSolutionAlgorithm("frequency_soln_algo")
+integ= analysisAggregation.newIntegrator("eigen_integrator",xc.Vector([1.0,1,1.0,1.0]))
+
+soe= analysisAggregation.newSystemOfEqn("sym_band_eigen_soe")
+solver= soe.newSolver("sym_band_eigen_solver")
+
+analysis= solu.newAnalysis("modal_analysis","analysisAggregation","")
+ac= 0.69 # Design acceleration.
+T0= 0.24
+T1= 0.68
+meseta= 2.28
+
+spectrum= geom.FunctionGraph1D()
+
+spectrum.append(0.0,1.0)
+spectrum.append(T0,meseta)
+t=T1
+while(t<2.0):
+  spectrum.append(t,meseta*T1/t)
+  t+=1
+
+spectrum*=(ac)
+analysis.spectrum= spectrum
+
+analOk= analysis.analyze(5)
+numModes= analysis.getNumModes()
+periods= analysis.getPeriods()
+omega= analysis.getAngularFrequencies()
+accelerations= [analysis.spectrum(T) for T in periods]
+
+setTotal= preprocessor.getSets.getSet("total")
+# Modal responses computed "by hand".
+nodeDisp= [0.0]*numModes # modal displacement of the top node.
+baseShear= [0.0]*numModes # modal base shear.
+for i in range(0,numModes):
+  nodeDisp[i]= nod5.getMaxModalDisplacement(i+1,accelerations[i])[0]
+  for n in setTotal.getNodes:
+    baseShear[i]+= n.getEquivalentStaticLoad(i+1,accelerations[i])[0]
+
+# SRSS.
+modalComb= analysis.getModalCombination
+modalComb.rule= "SRSS"
+modalComb.elementResponse= "force"
+modalComb.compute(setTotal,xc.ID([0]))
+dispSRSS= math.sqrt(sum(u**2 for u in nodeDisp))
+shearSRSS= math.sqrt(sum(v**2 for v in baseShear))
+ratio1= abs(modalComb.getNodeDisplacement(nod5.tag,0)[0]-dispSRSS)/dispSRSS
+ratio2= abs(modalComb.getElementResponse(1,0)[0]-shearSRSS)/shearSRSS
+# The first mode is the dominant one.
+ratio3= abs(modalComb.getNodeSignedDisplacement(nod5.tag,0)[0]-math.copysign(dispSRSS,nodeDisp[0]))/dispSRSS
+
+# CQC.
+zeta= 0.05
+modalComb.rule= "CQC"
+modalComb.dampings= xc.Vector([zeta])
+modalComb.compute(setTotal,xc.ID([0]))
+rho= analysis.getCQCModalCrossCorrelationCoefficients(xc.Vector([zeta]*numModes))
+dispCQC= 0.0
+for i in range(0,numModes):
+  for j in range(0,numModes):
+    dispCQC+= rho(i,j)*nodeDisp[i]*nodeDisp[j]
+dispCQC= math.sqrt(dispCQC)
+ratio4= abs(modalComb.getNodeDisplacement(nod5.tag,0)[0]-dispCQC)/dispCQC
+
+# The state of the model is not modified.
+ratio5= nod5.getDisp.Norm()
+
+# Results for the whole set (one row for each node or element).
+ratio6= 0.0
+nodeDisps= modalComb.getNodeSignedDisplacements(0)
+nodeTags= modalComb.nodeTags
+for k in range(0,len(nodeTags)):
+  u= modalComb.getNodeSignedDisplacement(nodeTags[k],0)
+  for c in range(0,len(u)):
+    ratio6= max(ratio6,abs(nodeDisps(k,c)-u[c]))
+elemResponses= modalComb.getElementResponses(0)
+elemTags= modalComb.elementTags
+for k in range(0,len(elemTags)):
+  r= modalComb.getElementResponse(elemTags[k],0)
+  for c in range(0,len(r)):
+    ratio6= max(ratio6,abs(elemResponses(k,c)-r[c]))
+numRows= nodeDisps.noRows+elemResponses.noRows
+
+'''
+print "dispSRSS= ", dispSRSS
+print "shearSRSS= ", shearSRSS
+print "ratio1= ", ratio1
+print "ratio2= ", ratio2
+print "ratio3= ", ratio3
+print "dispCQC= ", dispCQC
+print "ratio4= ", ratio4
+print "ratio5= ", ratio5
+print "ratio6= ", ratio6
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (analOk==0) & (abs(ratio1)<1e-9) & (abs(ratio2)<1e-6) & (abs(ratio3)<1e-9) & (abs(ratio4)<1e-9) & (ratio5<1e-15) & (ratio6==0.0) & (numRows==11):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
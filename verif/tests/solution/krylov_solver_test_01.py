@@ -0,0 +1,117 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Checks the preconditioned Krylov solvers (CG, MINRES and GMRES with
+# Jacobi, ILU and algebraic multigrid preconditioners) against SuperLU
+# in a plane stress cantilever. Checks also the inexact Newton method
+# (forcing terms passed to the iterative solver).
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+E= 30e6 # Young modulus (psi)
+nu= 0.3 # Poisson's ratio
+F= 1e3 # Load at the tip.
+nx= 40 # Number of elements along the cantilever.
+ny= 8 # Number of elements along the depth.
+L= 10.0 # Cantilever length.
+h= 2.0 # Cantilever depth.
+
+def solve(soeType,solverType,method= None,precond= None,maxForcingTerm= 0.0):
+  ''' Computes the displacements of the cantilever tip using
+      the system of equations and solver being passed as parameter.'''
+  feProblem= xc.FEProblem()
+  feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+  preprocessor=  feProblem.getPreprocessor
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+  for j in range(0,ny+1):
+    for i in range(0,nx+1):
+      nodes.newNodeIDXY(j*(nx+1)+i+1,i*L/nx,j*h/ny)
+  elast2d= typical_materials.defElasticIsotropicPlaneStress(preprocessor, "elast2d",E,nu,0.0)
+  elements= preprocessor.getElementHandler
+  elements.defaultMaterial= "elast2d"
+  for j in range(0,ny):
+    for i in range(0,nx):
+      n1= j*(nx+1)+i+1
+      elements.newElement("FourNodeQuad",xc.ID([n1,n1+1,n1+nx+2,n1+nx+1]))
+
+  constraints= preprocessor.getBoundaryCondHandler
+  for j in range(0,ny+1):
+    tag= j*(nx+1)+1
+    constraints.newSPConstraint(tag,0,0.0)
+    constraints.newSPConstraint(tag,1,0.0)
+
+  cargas= preprocessor.getLoadHandler
+  casos= cargas.getLoadPatterns
+  ts= casos.newTimeSeries("constant_ts","ts")
+  casos.currentTimeSeries= "ts"
+  lp0= casos.newLoadPattern("default","0")
+  tipNode= (ny+1)*(nx+1)
+  lp0.newNodalLoad(tipNode,xc.Vector([0.0,-F]))
+  casos.addToDomain("0")
+
+  solu= feProblem.getSoluProc
+  solCtrl= solu.getSoluControl
+  solModels= solCtrl.getModelWrapperContainer
+  sm= solModels.newModelWrapper("sm")
+  numberer= sm.newNumberer("default_numberer")
+  numberer.useAlgorithm("simple")
+  cHandler= sm.newConstraintHandler("plain_handler")
+  analysisAggregations= solCtrl.getAnalysisAggregationContainer
+  analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+  solAlgo= analysisAggregation.newSolutionAlgorithm("newton_raphson_soln_algo")
+  solAlgo.maxForcingTerm= maxForcingTerm
+  integ= analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+  ctest= analysisAggregation.newConvergenceTest("norm_unbalance_conv_test")
+  ctest.tol= 1e-6
+  ctest.maxNumIter= 20
+  soe= analysisAggregation.newSystemOfEqn(soeType)
+  solver= soe.newSolver(solverType)
+  if(method):
+    solver.method= method
+    solver.tolerance= 1e-12
+    solver.maxNumIter= 5000
+    p= solver.setPreconditioner(precond)
+    if(precond=='amg'):
+      p.blockSize= 2 # two DOFs by node.
+  analysis= solu.newAnalysis("static_analysis","analysisAggregation","")
+  result= analysis.analyze(1)
+  return result, nodes.getNode(tipNode).getDisp
+
+resultRef, dispRef= solve("sparse_gen_col_lin_soe","super_lu_solver")
+cases= [('cg','jacobi'),('cg','ilu'),('cg','amg'),('minres','ilu'),('gmres','ilu'),('gmres','amg')]
+errors= list()
+for c in cases:
+  result, disp= solve("sparse_gen_row_lin_soe","krylov_sparse_solver",c[0],c[1])
+  errors.append((result,(disp-dispRef).Norm()/dispRef.Norm()))
+
+# Inexact Newton.
+resultIN, dispIN= solve("sparse_gen_row_lin_soe","krylov_sparse_solver",'cg','amg',0.1)
+errIN= (dispIN-dispRef).Norm()/dispRef.Norm()
+
+ok= (resultRef==0) & (resultIN==0) & (errIN<1e-6)
+for e in errors:
+  ok= ok & (e[0]==0) & (e[1]<1e-8)
+
+'''
+print "dispRef= ", dispRef
+print "errors= ", errors
+print "errIN= ", errIN
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if ok:
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,112 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Checks that the linear algorithm reusing the factorization of the
+# stiffness matrix (factorOnce) gives the same results that the
+# standard one when the load combinations change (load-only changes)
+# and after a change of the model constraints.
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc_base
+import geom
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+
+E= 2.1e6*9.81/1e-4 # Elastic modulus (Pa)
+nu= 0.3 # Poisson's ratio
+G= E/(2*(1+nu)) # Shear modulus
+A= 7.64e-4 # Cross section area (m2)
+Iz= 80.1e-8 # Cross section moment of inertia (m4)
+L= 4.0 # Cantilever length (m)
+F= 1.5e3 # Load magnitude (N)
+numElem= 4 # Number of elements.
+
+combinations= [("ELU01","1.0*A"),("ELU02","1.0*A+1.5*B"),("ELU03","1.0*C"),("ELU04","0.5*B+1.0*C")]
+
+def solve(factorOnce):
+  ''' Returns the tip displacements of a cantilever under
+      several load combinations.'''
+  feProblem= xc.FEProblem()
+  preprocessor=  feProblem.getPreprocessor
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+  nodes.defaultTag= 1 #First node number.
+  for i in range(0,numElem+1):
+    nodes.newNodeXY(i*L/numElem,0.0)
+
+  lin= modelSpace.newLinearCrdTransf("lin")
+  sectionProperties= xc.CrossSectionProperties2d()
+  sectionProperties.A= A; sectionProperties.E= E; sectionProperties.G= G;
+  sectionProperties.I= Iz; 
+  seccion= typical_materials.defElasticSectionFromMechProp2d(preprocessor, "seccion",sectionProperties)
+
+  elements= preprocessor.getElementHandler
+  elements.defaultTransformation= "lin"
+  elements.defaultMaterial= "seccion"
+  elements.defaultTag= 1 #Tag for the next element.
+  for i in range(1,numElem+1):
+    elements.newElement("ElasticBeam2d",xc.ID([i,i+1]))
+
+  constraints= preprocessor.getBoundaryCondHandler
+  modelSpace.fixNode000(1)
+
+  cargas= preprocessor.getLoadHandler
+  casos= cargas.getLoadPatterns
+  ts= casos.newTimeSeries("constant_ts","ts")
+  casos.currentTimeSeries= "ts"
+  lpA= casos.newLoadPattern("default","A")
+  lpA.newNodalLoad(numElem+1,xc.Vector([F,0,0]))
+  lpB= casos.newLoadPattern("default","B")
+  lpB.newNodalLoad(numElem+1,xc.Vector([0,F,0]))
+  lpC= casos.newLoadPattern("default","C")
+  lpC.newNodalLoad(numElem+1,xc.Vector([-2*F,-F,0]))
+
+  combs= cargas.getLoadCombinations
+  for c in combinations:
+    combs.newLoadCombination(c[0],c[1])
+
+  solution= predefined_solutions.SolutionProcedure()
+  analysis= solution.simpleStaticLinear(feProblem)
+  solution.solAlgo.factorOnce= factorOnce
+  retval= list()
+  result= 0
+  for c in combinations:
+    combs.addToDomain(c[0])
+    result+= analysis.analyze(1)
+    combs.removeFromDomain(c[0])
+    retval.append(nodes.getNode(numElem+1).getDisp)
+  # Model change (new support).
+  constraints.newSPConstraint(numElem-1,1,0.0)
+  for c in combinations:
+    combs.addToDomain(c[0])
+    result+= analysis.analyze(1)
+    combs.removeFromDomain(c[0])
+    retval.append(nodes.getNode(numElem+1).getDisp)
+  return result, retval
+
+result0, disp0= solve(False)
+result1, disp1= solve(True)
+
+err= 0.0
+for d0, d1 in zip(disp0,disp1):
+  err+= (d0-d1).Norm()**2/d0.Norm()**2
+
+'''
+print "result0= ", result0
+print "result1= ", result1
+print "err= ", err
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (result0==0) & (result1==0) & (err<1e-20):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
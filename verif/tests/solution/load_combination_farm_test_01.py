@@ -0,0 +1,138 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Checks that the envelopes computed analyzing the load combinations
+# in several worker processes (some of them starting from the state of
+# a previous combination) are the same that those obtained analyzing
+# them one after another.
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc_base
+import geom
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+
+E= 2.1e6*9.81/1e-4 # Elastic modulus (Pa)
+nu= 0.3 # Poisson's ratio
+G= E/(2*(1+nu)) # Shear modulus
+A= 7.64e-4 # Cross section area (m2)
+Iz= 80.1e-8 # Cross section moment of inertia (m4)
+L= 4.0 # Cantilever length (m)
+F= 1.5e3 # Load magnitude (N)
+numElem= 4 # Number of elements.
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+nodes.defaultTag= 1 #First node number.
+for i in range(0,numElem+1):
+  nodes.newNodeXY(i*L/numElem,0.0)
+
+lin= modelSpace.newLinearCrdTransf("lin")
+sectionProperties= xc.CrossSectionProperties2d()
+sectionProperties.A= A; sectionProperties.E= E; sectionProperties.G= G;
+sectionProperties.I= Iz; 
+seccion= typical_materials.defElasticSectionFromMechProp2d(preprocessor, "seccion",sectionProperties)
+
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= "lin"
+elements.defaultMaterial= "seccion"
+elements.defaultTag= 1 #Tag for the next element.
+for i in range(1,numElem+1):
+  elements.newElement("ElasticBeam2d",xc.ID([i,i+1]))
+
+modelSpace.fixNode000(1)
+
+cargas= preprocessor.getLoadHandler
+casos= cargas.getLoadPatterns
+ts= casos.newTimeSeries("constant_ts","ts")
+casos.currentTimeSeries= "ts"
+lpA= casos.newLoadPattern("default","A")
+lpA.newNodalLoad(numElem+1,xc.Vector([F,0,0]))
+lpB= casos.newLoadPattern("default","B")
+lpB.newNodalLoad(numElem+1,xc.Vector([0,F,0]))
+lpC= casos.newLoadPattern("default","C")
+lpC.newNodalLoad(3,xc.Vector([-2*F,-F,0]))
+
+combs= cargas.getLoadCombinations
+combs.newLoadCombination("ELU01","1.0*A")
+combs.newLoadCombination("ELU02","1.0*A+1.5*B") # Starts from ELU01.
+combs.newLoadCombination("ELU03","1.0*C")
+combs.newLoadCombination("ELU04","0.5*B+1.0*C")
+combs.newLoadCombination("ELU05","1.0*A+1.5*B+1.0*C") # Starts from ELU02.
+
+# Envelope recorders.
+domain= feProblem.getDomain
+nodeTags= [i for i in range(1,numElem+2)]
+elemTags= [i for i in range(1,numElem+1)]
+nodeRecorder= domain.newRecorder("node_prop_envelope_recorder",None)
+nodeRecorder.setNodes(xc.ID(nodeTags))
+nodeRecorder.addQuantity("Ux","disp",0)
+nodeRecorder.addQuantity("Uy","disp",1)
+nodeRecorder.addQuantity("Ry","reaction",1)
+elemRecorder= domain.newRecorder("element_prop_envelope_recorder",None)
+elemRecorder.setElements(xc.ID(elemTags))
+elemRecorder.addQuantity("N2","localForce",3)
+elemRecorder.addQuantity("M2","localForce",5)
+recorders= [(nodeRecorder,['Ux','Uy','Ry']),(elemRecorder,['N2','M2'])]
+
+analisis= predefined_solutions.simple_newton_raphson(feProblem)
+
+def getEnvelopes():
+  retval= dict()
+  for i,(rec,labels) in enumerate(recorders):
+    for lbl in labels:
+      retval[(i,lbl)]= (rec.getMax(lbl),rec.getCombMax(lbl),rec.getMin(lbl),rec.getCombMin(lbl))
+  return retval
+
+# Analysis in two worker processes.
+farm= feProblem.getSoluProc.getCombinationFarm
+farm.numWorkers= 2
+resultFarm= farm.analyze(combs)
+numFailed= len(farm.getFailedCombinations())
+farmEnv= getEnvelopes()
+numCombs= len(nodeRecorder.getCombinationNames())
+
+# Sequential analysis.
+nodeRecorder.clearEnvelopes()
+elemRecorder.clearEnvelopes()
+for key in combs.getKeys():
+  preprocessor.resetLoadCase()
+  combs.addToDomain(key)
+  result= analisis.analyze(1)
+  combs.removeFromDomain(key)
+seqEnv= getEnvelopes()
+
+err= 0.0
+combErrors= 0
+for key in seqEnv:
+  (vMax,cMax,vMin,cMin)= seqEnv[key]
+  (fMax,fCMax,fMin,fCMin)= farmEnv[key]
+  err+= (vMax-fMax).Norm()**2+(vMin-fMin).Norm()**2
+  for i in range(0,vMax.size()):
+    if(abs(vMax[i]-vMin[i])>1e-9): # Not null quantity.
+      if((cMax[i]!=fCMax[i]) or (cMin[i]!=fCMin[i])):
+        combErrors+= 1
+
+'''
+print "resultFarm= ", resultFarm
+print "numFailed= ", numFailed
+print "numCombs= ", numCombs
+print "err= ", err
+print "combErrors= ", combErrors
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (resultFarm==0) & (numFailed==0) & (numCombs==5) & (err<1e-12) & (combErrors==0):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,138 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Checks that the linear analysis of a group of load combinations
+# factoring the stiffness matrix only once (analyzeLoadCombinations)
+# gives the same results that the combination by combination analysis
+# (band SPD, profile SPD and SuperLU solvers).
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+E= 2.1e6*9.81/1e-4 # Elastic modulus (Pa)
+nu= 0.3 # Poisson's ratio
+G= E/(2*(1+nu)) # Shear modulus
+A= 7.64e-4 # Cross section area (m2)
+Iz= 80.1e-8 # Cross section moment of inertia (m4)
+L= 4.0 # Cantilever length (m)
+F= 1.5e3 # Load magnitude (N)
+numElem= 4 # Number of elements.
+
+combinations= [("ELU01","1.0*A"),("ELU02","1.0*A+1.5*B"),("ELU03","1.0*C"),("ELU04","0.5*B+1.0*C")]
+
+def solve(soeType,solverType,batch):
+  ''' Returns the envelopes of the displacements and bending moments
+      of a cantilever obtained with the solver being passed as parameter.'''
+  feProblem= xc.FEProblem()
+  preprocessor=  feProblem.getPreprocessor
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+  nodes.defaultTag= 1 #First node number.
+  for i in range(0,numElem+1):
+    nodes.newNodeXY(i*L/numElem,0.0)
+
+  lin= modelSpace.newLinearCrdTransf("lin")
+  sectionProperties= xc.CrossSectionProperties2d()
+  sectionProperties.A= A; sectionProperties.E= E; sectionProperties.G= G;
+  sectionProperties.I= Iz; 
+  seccion= typical_materials.defElasticSectionFromMechProp2d(preprocessor, "seccion",sectionProperties)
+
+  elements= preprocessor.getElementHandler
+  elements.defaultTransformation= "lin"
+  elements.defaultMaterial= "seccion"
+  elements.defaultTag= 1 #Tag for the next element.
+  for i in range(1,numElem+1):
+    elements.newElement("ElasticBeam2d",xc.ID([i,i+1]))
+
+  modelSpace.fixNode000(1)
+
+  cargas= preprocessor.getLoadHandler
+  casos= cargas.getLoadPatterns
+  ts= casos.newTimeSeries("constant_ts","ts")
+  casos.currentTimeSeries= "ts"
+  lpA= casos.newLoadPattern("default","A")
+  lpA.newNodalLoad(numElem+1,xc.Vector([F,0,0]))
+  lpB= casos.newLoadPattern("default","B")
+  lpB.newNodalLoad(numElem+1,xc.Vector([0,F,0]))
+  lpC= casos.newLoadPattern("default","C")
+  lpC.newNodalLoad(numElem+1,xc.Vector([-2*F,-F,0]))
+  lpC.newNodalLoad(numElem-1,xc.Vector([0,-F,F/10.0]))
+
+  combs= cargas.getLoadCombinations
+  for c in combinations:
+    combs.newLoadCombination(c[0],c[1])
+
+  domain= feProblem.getDomain
+  nodeRecorder= domain.newRecorder("node_prop_envelope_recorder",None)
+  nodeRecorder.setNodes(xc.ID([i for i in range(1,numElem+2)]))
+  nodeRecorder.addQuantity("Ux","disp",0)
+  nodeRecorder.addQuantity("Uy","disp",1)
+  nodeRecorder.addQuantity("Rz","disp",2)
+  elemRecorder= domain.newRecorder("element_prop_envelope_recorder",None)
+  elemRecorder.setElements(xc.ID([i for i in range(1,numElem+1)]))
+  elemRecorder.addQuantity("M2","localForce",5)
+
+  solu= feProblem.getSoluProc
+  solCtrl= solu.getSoluControl
+  solModels= solCtrl.getModelWrapperContainer
+  sm= solModels.newModelWrapper("sm")
+  numberer= sm.newNumberer("default_numberer")
+  numberer.useAlgorithm("rcm")
+  cHandler= sm.newConstraintHandler("penalty_constraint_handler")
+  cHandler.alphaSP= 1.0e15
+  cHandler.alphaMP= 1.0e15
+  analysisAggregations= solCtrl.getAnalysisAggregationContainer
+  analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+  solAlgo= analysisAggregation.newSolutionAlgorithm("linear_soln_algo")
+  integ= analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+  soe= analysisAggregation.newSystemOfEqn(soeType)
+  solver= soe.newSolver(solverType)
+  analysis= solu.newAnalysis("static_analysis","analysisAggregation","")
+
+  result= 0
+  if(batch):
+    result= analysis.analyzeLoadCombinations(combs)
+  else:
+    for c in combinations:
+      combs.addToDomain(c[0])
+      result+= analysis.analyze(1)
+      combs.removeFromDomain(c[0])
+  retval= list()
+  for rec in [nodeRecorder,elemRecorder]:
+    for label in rec.getQuantityLabels():
+      retval.append(rec.getMax(label))
+      retval.append(rec.getMin(label))
+  combNames= nodeRecorder.getCombMax("Uy")+elemRecorder.getCombMin("M2")
+  return result, retval, combNames
+
+solvers= [("band_spd_lin_soe","band_spd_lin_lapack_solver"),("profile_spd_lin_soe","profile_spd_lin_direct_solver"),("sparse_gen_col_lin_soe","super_lu_solver")]
+
+ok= True
+for s in solvers:
+  result0, env0, names0= solve(s[0],s[1],False)
+  result1, env1, names1= solve(s[0],s[1],True)
+  err= 0.0
+  for v0, v1 in zip(env0,env1):
+    err+= (v0-v1).Norm()**2/max(v0.Norm()**2,1e-12)
+  ok= ok and (result0==0) and (result1==0) and (err<1e-12) and (names0==names1)
+  '''
+  print s[1], ' result0= ', result0, ' result1= ', result1, ' err= ', err
+  print '  names0= ', names0
+  print '  names1= ', names1
+  '''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if ok:
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,100 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Checks that the multithreaded assembly of the element tangents and
+# residuals gives the same results that the serial one.
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+
+E= 210e9 # Young modulus (Pa)
+A= 1e-3 # Bar area (m2)
+K= 1e8 # Spring constant
+F= 10e3 # Load on each top node (N)
+numPanels= 40 # Number of truss panels.
+
+def solve(numThreads):
+  ''' Computes the displacements of a Pratt truss using
+      the number of threads being passed as parameter.'''
+  feProblem= xc.FEProblem()
+  preprocessor=  feProblem.getPreprocessor
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+  for i in range(0,numPanels+1):
+    nodes.newNodeIDXY(i+1,float(i),0.0) # Bottom chord.
+    nodes.newNodeIDXY(i+1001,float(i),1.0) # Top chord.
+  nodes.newNodeIDXY(2001,float(numPanels),0.0) # Spring support.
+
+  elast= typical_materials.defElasticMaterial(preprocessor, "elast",E)
+  spring= typical_materials.defElasticMaterial(preprocessor, "spring",K)
+  elements= preprocessor.getElementHandler
+  elements.defaultMaterial= "elast"
+  elements.dimElem= 2
+  elements.defaultTag= 1
+  bars= list()
+  for i in range(1,numPanels+1):
+    bars.append(elements.newElement("Truss",xc.ID([i,i+1])))
+    bars.append(elements.newElement("Truss",xc.ID([i+1000,i+1001])))
+    bars.append(elements.newElement("Truss",xc.ID([i,i+1000])))
+    bars.append(elements.newElement("Truss",xc.ID([i,i+1001])))
+  bars.append(elements.newElement("Truss",xc.ID([numPanels+1,numPanels+1001])))
+  for b in bars:
+    b.area= A
+  elements.defaultMaterial= "spring"
+  zl= elements.newElement("ZeroLength",xc.ID([2001,numPanels+1]))
+
+  constraints= preprocessor.getBoundaryCondHandler
+  for tag in [1,2001]:
+    constraints.newSPConstraint(tag,0,0.0)
+    constraints.newSPConstraint(tag,1,0.0)
+  constraints.newSPConstraint(numPanels+1,1,0.0)
+
+  cargas= preprocessor.getLoadHandler
+  casos= cargas.getLoadPatterns
+  ts= casos.newTimeSeries("constant_ts","ts")
+  casos.currentTimeSeries= "ts"
+  lp0= casos.newLoadPattern("default","0")
+  for i in range(0,numPanels+1):
+    lp0.newNodalLoad(i+1001,xc.Vector([F/10.0,-F]))
+  casos.addToDomain("0")
+
+  solution= predefined_solutions.SolutionProcedure()
+  analysis= solution.simpleNewtonRaphson(feProblem)
+  solution.integ.numThreads= numThreads
+  result= analysis.analyze(1)
+  retval= list()
+  for i in range(0,numPanels+1):
+    retval.append(nodes.getNode(i+1).getDisp)
+    retval.append(nodes.getNode(i+1001).getDisp)
+  retval.append(zl.getResistingForce())
+  return result, retval
+
+result1, disp1= solve(1)
+result4, disp4= solve(4)
+
+err= 0.0
+for d1, d4 in zip(disp1, disp4):
+  err+= (d1-d4).Norm()**2
+
+'''
+print "result1= ", result1
+print "result4= ", result4
+print "err= ", err
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (result1==0) & (result4==0) & (err<1e-20):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,104 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Checks that the multithreaded assembly of the element tangents and
+# residuals gives exactly (bit for bit) the same results than the serial
+# one when the elements have nonlinear fiber sections: the state of the
+# fibers and their materials must not be shared between threads.
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc_base
+import geom
+import xc
+from materials.sections.structural_shapes import arcelor_metric_shapes
+from materials.ec3 import EC3_materials
+from model import predefined_spaces
+from solution import predefined_solutions
+
+numColumns= 12 # Number of cantilever columns.
+numElemColumn= 3 # Number of elements on each column.
+H= 3.0 # Column height.
+
+def solve(numThreads):
+  ''' Computes the displacements of a row of cantilever columns
+      with elastic perfectly plastic fiber sections using the number
+      of threads being passed as parameter.'''
+  feProblem= xc.FEProblem()
+  feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+  preprocessor=  feProblem.getPreprocessor
+  S355JR= EC3_materials.S355JR
+  S355JR.gammaM= 1.05
+  epp= S355JR.getDesignElasticPerfectlyPlasticMaterial(preprocessor, "epp")
+  IPE200= arcelor_metric_shapes.IPEShape(S355JR,'IPE_200')
+  fs3d= IPE200.getFiberSection3d(preprocessor,'epp')
+  M0= IPE200.get('Wzpl')*S355JR.fyd() # Plastic moment.
+
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+  lin= modelSpace.newLinearCrdTransf("lin")
+  elements= preprocessor.getElementHandler
+  elements.defaultTransformation= "lin"
+  elements.defaultMaterial= IPE200.fiberSection3dName
+  constraints= preprocessor.getBoundaryCondHandler
+  cargas= preprocessor.getLoadHandler
+  casos= cargas.getLoadPatterns
+  ts= casos.newTimeSeries("constant_ts","ts")
+  casos.currentTimeSeries= "ts"
+  lp0= casos.newLoadPattern("default","0")
+  topNodes= list()
+  beams= list()
+  for i in range(0,numColumns):
+    x= 2.0*i
+    n0= nodes.newNodeXY(x,0.0)
+    modelSpace.fixNode000(n0.tag)
+    nPrev= n0
+    for j in range(1,numElemColumn+1):
+      n= nodes.newNodeXY(x,j*H/numElemColumn)
+      beams.append(elements.newElement("ForceBeamColumn2d",xc.ID([nPrev.tag,n.tag])))
+      nPrev= n
+    topNodes.append(nPrev)
+    # Different plastification on each column.
+    F= (0.5+0.4*float(i)/(numColumns-1))*M0/H
+    lp0.newNodalLoad(nPrev.tag,xc.Vector([F,-10e3,0.0]))
+  casos.addToDomain("0")
+
+  solution= predefined_solutions.SolutionProcedure()
+  solution.convergenceTestTol= 1e-6
+  solution.maxNumIter= 50
+  analysis= solution.simpleNewtonRaphson(feProblem)
+  solution.integ.numThreads= numThreads
+  result= analysis.analyze(1)
+  disp= [n.getDisp for n in topNodes]
+  forces= list()
+  for b in beams:
+    forces.append(b.getResistingForce())
+  moments= [b.getSections()[0].getStressResultantComponent("Mz") for b in beams]
+  return result, disp, forces, moments
+
+result1, disp1, forces1, moments1= solve(1)
+result4, disp4, forces4, moments4= solve(4)
+
+# Bit for bit comparison.
+ok= (result1==0) & (result4==0)
+for d1, d4 in zip(disp1+forces1, disp4+forces4):
+  ok= ok & ((d1-d4).Norm()==0.0)
+for m1, m4 in zip(moments1, moments4):
+  ok= ok & (m1==m4)
+
+'''
+print "result1= ", result1
+print "result4= ", result4
+print "disp1= ", disp1[-1], " disp4= ", disp4[-1]
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if ok:
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,103 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Checks that storing the node state in the domain wide pool
+# (contiguous arrays committed and reverted in bulk) gives the
+# same results that the storage inside each node.
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+
+E= 210e9 # Young modulus (Pa)
+A= 1e-3 # Bar area (m2)
+F= 10e3 # Load on each top node (N)
+numPanels= 20 # Number of truss panels.
+
+def solve(usePool):
+  ''' Computes the displacements of a Pratt truss storing (or not)
+      the node state in the pool.'''
+  feProblem= xc.FEProblem()
+  preprocessor=  feProblem.getPreprocessor
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+  for i in range(0,numPanels+1):
+    nodes.newNodeIDXY(i+1,float(i),0.0) # Bottom chord.
+    nodes.newNodeIDXY(i+1001,float(i),1.0) # Top chord.
+
+  elast= typical_materials.defElasticMaterial(preprocessor, "elast",E)
+  elements= preprocessor.getElementHandler
+  elements.defaultMaterial= "elast"
+  elements.dimElem= 2
+  elements.defaultTag= 1
+  for i in range(1,numPanels+1):
+    elements.newElement("Truss",xc.ID([i,i+1])).area= A
+    elements.newElement("Truss",xc.ID([i+1000,i+1001])).area= A
+    elements.newElement("Truss",xc.ID([i,i+1000])).area= A
+    elements.newElement("Truss",xc.ID([i,i+1001])).area= A
+  elements.newElement("Truss",xc.ID([numPanels+1,numPanels+1001])).area= A
+
+  constraints= preprocessor.getBoundaryCondHandler
+  constraints.newSPConstraint(1,0,0.0)
+  constraints.newSPConstraint(1,1,0.0)
+  constraints.newSPConstraint(numPanels+1,1,0.0)
+
+  mesh= preprocessor.getDomain.getMesh
+  mesh.useNodeStatePool= usePool
+  mesh.nodeStatePoolNumThreads= 4
+
+  cargas= preprocessor.getLoadHandler
+  casos= cargas.getLoadPatterns
+  ts= casos.newTimeSeries("linear_ts","ts")
+  casos.currentTimeSeries= "ts"
+  lp0= casos.newLoadPattern("default","0")
+  for i in range(0,numPanels+1):
+    lp0.newNodalLoad(i+1001,xc.Vector([F/10.0,-F]))
+  casos.addToDomain("0")
+
+  solution= predefined_solutions.SolutionProcedure()
+  analysis= solution.simpleStaticLinear(feProblem)
+  result= analysis.analyze(2)
+  retval= list()
+  for i in range(0,numPanels+1):
+    retval.append(nodes.getNode(i+1001).getDisp)
+
+  # Trial displacements must be discarded on revert.
+  n= nodes.getNode(numPanels+1001)
+  committed= n.getDisp
+  n.setTrialDisp(xc.Vector([1.0,1.0]))
+  preprocessor.getDomain.revertToLastCommit()
+  # State must survive moving it back to the nodes.
+  mesh.useNodeStatePool= False
+  errRevert= (n.getDisp-committed).Norm()
+  return result, retval, errRevert
+
+result1, disp1, errRevert1= solve(False)
+result2, disp2, errRevert2= solve(True)
+
+err= 0.0
+for d1, d2 in zip(disp1, disp2):
+  err+= (d1-d2).Norm()**2
+
+'''
+print "result1= ", result1
+print "result2= ", result2
+print "err= ", err
+print "errRevert2= ", errRevert2
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (result1==0) & (result2==0) & (err<1e-20) & (errRevert1<1e-15) & (errRevert2<1e-15):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
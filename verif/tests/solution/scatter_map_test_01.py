@@ -0,0 +1,117 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Checks the assembly of the element matrices through scatter maps:
+# the same frame is solved with sparse systems of equations with and
+# without scatter maps. Between both analysis steps a brace is added
+# to the model, so the sparsity pattern of the system (graph stamp)
+# changes and the maps must be computed again.
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+E= 30e9 # Young modulus (Pa).
+A= 0.09 # Cross section area.
+I= 0.09**2/12.0 # Cross section moment of inertia.
+xCols= [0.0,3.5,5.0,9.0] # Column axes (irregular bays).
+zFloors= [0.0,3.0,7.2,10.0] # Floor levels (irregular storeys).
+F= 10e3 # Horizontal load on each floor.
+
+def solve(soeType,solverType,useScatterMaps):
+  ''' Returns the displacements of the nodes before and after adding
+      the brace and the graph stamps of the system in both steps.'''
+  feProblem= xc.FEProblem()
+  feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+  preprocessor=  feProblem.getPreprocessor
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+  nx= len(xCols)
+  nz= len(zFloors)
+  nodeTags= list()
+  for j in range(0,nz):
+    for i in range(0,nx):
+      n= nodes.newNodeXY(xCols[i],zFloors[j])
+      nodeTags.append(n.tag)
+  def tag(i,j):
+    return nodeTags[j*nx+i]
+  scc= typical_materials.defElasticSection2d(preprocessor,"scc",A,E,I)
+  lin= modelSpace.newLinearCrdTransf("lin")
+  elements= preprocessor.getElementHandler
+  elements.defaultTransformation= "lin"
+  elements.defaultMaterial= "scc"
+  for j in range(0,nz-1):
+    for i in range(0,nx):
+      elements.newElement("ElasticBeam2d",xc.ID([tag(i,j),tag(i,j+1)])) # Columns.
+  for j in range(1,nz):
+    for i in range(0,nx-1):
+      elements.newElement("ElasticBeam2d",xc.ID([tag(i,j),tag(i+1,j)])) # Beams.
+  for i in range(0,nx):
+    modelSpace.fixNode000(tag(i,0))
+
+  cargas= preprocessor.getLoadHandler
+  casos= cargas.getLoadPatterns
+  ts= casos.newTimeSeries("constant_ts","ts")
+  casos.currentTimeSeries= "ts"
+  lp0= casos.newLoadPattern("default","0")
+  for j in range(1,nz):
+    lp0.newNodalLoad(tag(0,j),xc.Vector([F,-F/2.0,0.0]))
+  casos.addToDomain("0")
+
+  solu= feProblem.getSoluProc
+  solCtrl= solu.getSoluControl
+  solModels= solCtrl.getModelWrapperContainer
+  sm= solModels.newModelWrapper("sm")
+  numberer= sm.newNumberer("default_numberer")
+  numberer.useAlgorithm("rcm")
+  cHandler= sm.newConstraintHandler("plain_handler")
+  analysisAggregations= solCtrl.getAnalysisAggregationContainer
+  analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+  solAlgo= analysisAggregation.newSolutionAlgorithm("linear_soln_algo")
+  integ= analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+  soe= analysisAggregation.newSystemOfEqn(soeType)
+  soe.useScatterMaps= useScatterMaps
+  solver= soe.newSolver(solverType)
+  analysis= solu.newAnalysis("static_analysis","analysisAggregation","")
+  result= analysis.analyze(1)
+  disp0= [nodes.getNode(t).getDisp for t in nodeTags]
+  stamp0= soe.graphStamp
+  # Brace between nodes that were not connected (new graph).
+  elements.newElement("ElasticBeam2d",xc.ID([tag(0,0),tag(nx-1,2)]))
+  result+= analysis.analyze(1)
+  disp1= [nodes.getNode(t).getDisp for t in nodeTags]
+  stamp1= soe.graphStamp
+  return result, disp0, disp1, stamp0, stamp1
+
+def maxDiff(a,b):
+  ''' Maximum relative difference between the displacements.'''
+  norm= max([u.Norm() for u in b])
+  return max([(u-v).Norm() for u,v in zip(a,b)])/norm
+
+ok= True
+for soeType, solverType in [("sparse_gen_col_lin_soe","super_lu_solver"),("sym_sparse_lin_soe","sym_sparse_lin_solver")]:
+  resultMap, disp0Map, disp1Map, stamp0Map, stamp1Map= solve(soeType,solverType,True)
+  result, disp0, disp1, stamp0, stamp1= solve(soeType,solverType,False)
+  ok= ok & (resultMap==0) & (result==0)
+  ok= ok & (stamp0Map>0) & (stamp1Map!=stamp0Map) # Graph rebuilt.
+  ok= ok & (maxDiff(disp0Map,disp0)<1e-12) & (maxDiff(disp1Map,disp1)<1e-12)
+  ok= ok & (maxDiff(disp1,disp0)>1e-3) # The brace changes the solution.
+  '''
+  print soeType, stamp0Map, stamp1Map
+  print maxDiff(disp0Map,disp0), maxDiff(disp1Map,disp1), maxDiff(disp1,disp0)
+  '''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if ok:
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
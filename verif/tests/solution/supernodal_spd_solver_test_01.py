@@ -0,0 +1,123 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Checks that the supernodal sparse Cholesky solver gives the same
+# results that SuperLU (with one and several threads) and that
+# the symbolic analysis is computed only once while the sparsity
+# pattern doesn't change (load steps and Newton iterations).
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+E= 210e9 # Young modulus (Pa)
+A= 1e-3 # Bar area (m2)
+F= 10e3 # Load on each top node (N)
+numPanels= 60 # Number of truss panels.
+numSteps= 4 # Number of load steps.
+
+def solve(soeType,solverType,numThreads= 1):
+  ''' Computes the displacements of a Pratt truss using
+      the system of equations and solver being passed as parameter.'''
+  feProblem= xc.FEProblem()
+  feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+  preprocessor=  feProblem.getPreprocessor
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+  for i in range(0,numPanels+1):
+    nodes.newNodeIDXY(i+1,float(i),0.0) # Bottom chord.
+    nodes.newNodeIDXY(i+1001,float(i),1.0) # Top chord.
+
+  elast= typical_materials.defElasticMaterial(preprocessor, "elast",E)
+  elements= preprocessor.getElementHandler
+  elements.defaultMaterial= "elast"
+  elements.dimElem= 2
+  elements.defaultTag= 1
+  bars= list()
+  for i in range(1,numPanels+1):
+    bars.append(elements.newElement("CorotTruss",xc.ID([i,i+1])))
+    bars.append(elements.newElement("CorotTruss",xc.ID([i+1000,i+1001])))
+    bars.append(elements.newElement("CorotTruss",xc.ID([i,i+1000])))
+    bars.append(elements.newElement("CorotTruss",xc.ID([i,i+1001])))
+  bars.append(elements.newElement("CorotTruss",xc.ID([numPanels+1,numPanels+1001])))
+  for b in bars:
+    b.area= A
+
+  constraints= preprocessor.getBoundaryCondHandler
+  constraints.newSPConstraint(1,0,0.0)
+  constraints.newSPConstraint(1,1,0.0)
+  constraints.newSPConstraint(numPanels+1,1,0.0)
+
+  cargas= preprocessor.getLoadHandler
+  casos= cargas.getLoadPatterns
+  ts= casos.newTimeSeries("linear_ts","ts")
+  casos.currentTimeSeries= "ts"
+  lp0= casos.newLoadPattern("default","0")
+  for i in range(0,numPanels+1):
+    lp0.newNodalLoad(i+1001,xc.Vector([F/10.0,-F]))
+  casos.addToDomain("0")
+
+  solu= feProblem.getSoluProc
+  solCtrl= solu.getSoluControl
+  solModels= solCtrl.getModelWrapperContainer
+  sm= solModels.newModelWrapper("sm")
+  numberer= sm.newNumberer("default_numberer")
+  numberer.useAlgorithm("simple")
+  cHandler= sm.newConstraintHandler("plain_handler")
+  analysisAggregations= solCtrl.getAnalysisAggregationContainer
+  analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+  solAlgo= analysisAggregation.newSolutionAlgorithm("newton_raphson_soln_algo")
+  integ= analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+  integ.dLambda1= 1.0/numSteps
+  ctest= analysisAggregation.newConvergenceTest("norm_unbalance_conv_test")
+  ctest.tol= 1e-6
+  ctest.maxNumIter= 20
+  soe= analysisAggregation.newSystemOfEqn(soeType)
+  solver= soe.newSolver(solverType)
+  if(numThreads>1):
+    solver.numThreads= numThreads
+  analysis= solu.newAnalysis("static_analysis","analysisAggregation","")
+  result= analysis.analyze(numSteps)
+  retval= list()
+  for i in range(0,numPanels+1):
+    retval.append(nodes.getNode(i+1).getDisp)
+    retval.append(nodes.getNode(i+1001).getDisp)
+  numSymbolic= 0
+  if(hasattr(solver,'numSymbolicFactorizations')):
+    numSymbolic= solver.numSymbolicFactorizations
+  return result, retval, numSymbolic
+
+resultRef, dispRef, nSymRef= solve("sparse_gen_col_lin_soe","super_lu_solver")
+result1, disp1, nSym1= solve("supernodal_spd_lin_soe","supernodal_spd_lin_solver",1)
+result4, disp4, nSym4= solve("supernodal_spd_lin_soe","supernodal_spd_lin_solver",4)
+
+err1= 0.0
+err4= 0.0
+norm= 0.0
+for dRef, d1, d4 in zip(dispRef, disp1, disp4):
+  norm+= dRef.Norm()**2
+  err1+= (dRef-d1).Norm()**2
+  err4+= (dRef-d4).Norm()**2
+err1/= norm
+err4/= norm
+
+'''
+print "resultRef= ", resultRef
+print "result1= ", result1, " err1= ", err1, " numSymbolic= ", nSym1
+print "result4= ", result4, " err4= ", err4, " numSymbolic= ", nSym4
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (resultRef==0) & (result1==0) & (result4==0) & (err1<1e-16) & (err4<1e-16) & (nSym1==1) & (nSym4==1):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,66 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Checks the NumPy array interface of the Vector, Matrix and ID
+# classes (shared memory) and the construction of those objects
+# from NumPy arrays.
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import numpy
+import xc_base
+import geom
+import xc
+
+# Vector -> numpy (the array views the vector memory).
+v= xc.Vector([1.0,2.0,3.0])
+a= numpy.asarray(v)
+a[1]= 20.0
+ratio1= abs(v[1]-20.0)+abs(a.sum()-24.0)
+
+# Matrix -> numpy (column-major storage).
+m= xc.Matrix([[1.0,2.0,3.0],[4.0,5.0,6.0]])
+b= numpy.asarray(m)
+b[1,2]= 60.0
+ratio2= abs(b.shape[0]-2)+abs(b.shape[1]-3)+abs(m(1,2)-60.0)+abs(b[0,1]-2.0)
+
+# ID -> numpy.
+id= xc.ID([7,8,9])
+c= numpy.asarray(id)
+c[0]= 70
+ratio3= abs(id[0]-70)+abs(c.sum()-87)
+
+# numpy -> Vector, Matrix and ID.
+x= numpy.linspace(0.0,1.0,11)
+v2= xc.Vector(x)
+ratio4= abs(v2.size()-11)+abs(v2[10]-1.0)+abs(v2[5]-0.5)
+y= numpy.array([[1.0,2.0],[3.0,4.0],[5.0,6.0]]) # C ordered
+m2= xc.Matrix(y)
+z= numpy.asfortranarray(y) # Fortran ordered
+m3= xc.Matrix(z)
+ratio5= abs(m2.noRows-3)+abs(m2.noCols-2)+abs(m2(2,1)-6.0)+abs(m2(0,1)-2.0)+(m2-m3).Norm()
+id2= xc.ID(numpy.arange(5,dtype= numpy.int64))
+ratio6= abs(len(id2)-5)+abs(id2[4]-4)
+v3= xc.Vector(x[::2]) # strided array.
+ratio7= abs(v3.size()-6)+abs(v3[5]-1.0)+abs(v3[1]-0.2)
+
+'''
+print "ratio1= ", ratio1
+print "ratio2= ", ratio2
+print "ratio3= ", ratio3
+print "ratio4= ", ratio4
+print "ratio5= ", ratio5
+print "ratio6= ", ratio6
+print "ratio7= ", ratio7
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (ratio1<1e-12) & (ratio2<1e-12) & (ratio3==0) & (ratio4<1e-12) & (ratio5<1e-12) & (ratio6==0) & (ratio7<1e-12):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,93 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Checks the analysis profiler: number of calls for each phase
+# of a static analysis and export of the Chrome trace.
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import json
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+
+E= 210e9 # Young modulus (Pa)
+A= 1e-3 # Bar area (m2)
+F= 10e3 # Load (N)
+numSteps= 4
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+nodes.newNodeIDXY(1,0.0,0.0)
+nodes.newNodeIDXY(2,1.0,0.0)
+nodes.newNodeIDXY(3,0.0,1.0)
+
+elast= typical_materials.defElasticMaterial(preprocessor, "elast",E)
+elements= preprocessor.getElementHandler
+elements.defaultMaterial= "elast"
+elements.dimElem= 2
+elements.defaultTag= 1
+elements.newElement("Truss",xc.ID([1,2])).area= A
+elements.newElement("Truss",xc.ID([3,2])).area= A
+
+constraints= preprocessor.getBoundaryCondHandler
+for tag in [1,3]:
+  constraints.newSPConstraint(tag,0,0.0)
+  constraints.newSPConstraint(tag,1,0.0)
+
+cargas= preprocessor.getLoadHandler
+casos= cargas.getLoadPatterns
+ts= casos.newTimeSeries("linear_ts","ts")
+casos.currentTimeSeries= "ts"
+lp0= casos.newLoadPattern("default","0")
+lp0.newNodalLoad(2,xc.Vector([0.0,-F]))
+casos.addToDomain("0")
+
+profiler= feProblem.getProfiler
+profiler.reset()
+profiler.enabled= True
+profiler.trace= True
+
+solution= predefined_solutions.SolutionProcedure()
+analysis= solution.simpleStaticLinear(feProblem)
+result= analysis.analyze(numSteps)
+
+profiler.enabled= False
+data= profiler.getData()
+
+traceFileName= '/tmp/analysis_profiler_test_01.json'
+profiler.exportChromeTrace(traceFileName)
+with open(traceFileName) as f:
+  trace= json.load(f)
+import os
+os.remove(traceFileName)
+traceNames= set([e['name'] for e in trace['traceEvents']])
+
+ok= (result==0)
+for phase in ['IncrementalIntegrator::formTangent','IncrementalIntegrator::formUnbalance','LinearSOE::solve','LinearSOESolver::factor','Domain::update','Domain::commit','ConstraintHandler::handle','DOF_Numberer::numberDOF']:
+  ok= ok and (phase in data) and (data[phase]['calls']>0) and (phase in traceNames)
+ok= ok and (data['Domain::commit']['calls']==numSteps)
+# At least the two 4x4 truss matrices are assembled on each call.
+ok= ok and (data['IncrementalIntegrator::formTangent']['bytes']>=data['IncrementalIntegrator::formTangent']['calls']*2*16*8)
+ok= ok and (len(trace['traceEvents'])==profiler.numTraceEvents)
+
+'''
+for k in data:
+  print k, data[k]
+print "numTraceEvents= ", profiler.numTraceEvents
+'''
+
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if ok:
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')